@@ -0,0 +1,87 @@
+#!/bin/bash
+# Run the benchmark suite and write the results as JSON.
+#
+# The microbenchmarks come from quodigious -B, the macro benchmarks time each
+# engine on each width. Every result is one line of the form
+#   {"name": "<engine>/<width>", "value": <user seconds>, "unit": "s"},
+# so the files are easy to diff and to compare with the tools at hand.
+#
+# usage: ./benchmark.sh [-o output] [-b baseline] [-t threshold]
+#   -o  file to write the results to (default: benchmark.json)
+#   -b  baseline results to compare against, any result slower than the
+#       baseline by more than the threshold is a regression and makes the
+#       script exit with a non zero status
+#   -t  regression threshold in percent (default: 10)
+# environment:
+#   ENGINES  engines to time (default: quodigious lquodigious tlquodigious iquodigious)
+#   WIDTHS   widths to time (default: 8 through 14)
+#   LIMIT    seconds an engine gets per width before it is skipped (default: 600)
+
+output=benchmark.json
+baseline=
+threshold=10
+while getopts "o:b:t:" opt; do
+	case ${opt} in
+		o) output=${OPTARG} ;;
+		b) baseline=${OPTARG} ;;
+		t) threshold=${OPTARG} ;;
+		*) echo "usage: $0 [-o output] [-b baseline] [-t threshold]" >&2; exit 1 ;;
+	esac
+done
+engines=${ENGINES:-quodigious lquodigious tlquodigious iquodigious}
+widths=${WIDTHS:-8 9 10 11 12 13 14}
+limit=${LIMIT:-600}
+
+cpu=$(sed -n 's/^model name[[:space:]]*:[[:space:]]*//p' /proc/cpuinfo | head -n 1)
+compiler=$(${CXX:-c++} --version | head -n 1)
+results=$(mktemp)
+trap 'rm -f ${results}' EXIT
+
+./quodigious -B | sed 's/$/,/' >> ${results}
+for engine in ${engines}; do
+	for width in ${widths}; do
+		TIMEFORMAT="%U"
+		# only the timing goes to the captured stderr, whatever the engine
+		# logs there (like the launcher picking a build) is dropped
+		seconds=$( { time echo ${width} | timeout ${limit} ./${engine} > /dev/null 2>&1; } 2>&1 )
+		if [ $? -ne 0 ]; then
+			echo "${engine} width ${width}: took longer than ${limit}s, skipping wider ones" >&2
+			break
+		fi
+		echo "${engine} width ${width}: ${seconds}s" >&2
+		echo "{\"name\": \"${engine}/${width}\", \"value\": ${seconds}, \"unit\": \"s\"}," >> ${results}
+	done
+done
+
+{
+	echo "{"
+	echo "\"cpu\": \"${cpu}\","
+	echo "\"compiler\": \"${compiler}\","
+	echo "\"date\": \"$(date -u +%Y-%m-%dT%H:%M:%SZ)\","
+	echo "\"results\": ["
+	sed '$ s/,$//' ${results}
+	echo "]"
+	echo "}"
+} > ${output}
+
+if [ -z "${baseline}" ]; then
+	exit 0
+fi
+if [ ! -f "${baseline}" ]; then
+	echo "No baseline ${baseline} to compare against" >&2
+	exit 1
+fi
+extract() {
+	sed -n 's/^{"name": "\([^"]*\)", "value": \([^,]*\),.*/\1 \2/p' $1
+}
+# ignore anything which only shows up in one of the two files
+awk -v threshold=${threshold} '
+	NR == FNR { base[$1] = $2; next }
+	($1 in base) && base[$1] > 0 {
+		change = 100 * ($2 - base[$1]) / base[$1]
+		status = (change > threshold) ? "REGRESSION" : "ok"
+		printf "%-32s %12g %12g %+8.1f%% %s\n", $1, base[$1], $2, change, status
+		if (change > threshold) { failed = 1 }
+	}
+	END { exit failed }
+' <(extract ${baseline}) <(extract ${output})
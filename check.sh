@@ -0,0 +1,121 @@
+#!/bin/bash
+# Check every engine against the reference results in outputs/.
+#
+# Each engine and mode is run on the full widths and its sorted output has
+# to match outputs/qnums<width> exactly. Engines which skip numbers with a
+# five in them (quodigious and iquodigious) are compared against the
+# reference without those, verifying skip-five makes sure only those go
+# missing. The widths which take too long to walk in full (15 through 19) are
+# spot checked instead: a number is picked at random from the reference file,
+# its lower digits become a one entry suffix whitelist and the numbers
+# quodigious finds above that suffix have to match the reference numbers
+# ending in it.
+#
+# usage: ./check.sh
+# environment:
+#   MAX_WIDTH        widest width to walk in full (default: 14)
+#   MODE_MAX_WIDTH   widest width to walk in the extra quodigious modes (default: 12)
+#   SLOW_MAX_WIDTH   widest width to walk with lquodigious and tlquodigious (default: 10)
+#   SPOT_WIDTHS      widths to spot check (default: 15 through 19)
+#   SPOT_CHECKS      suffixes to spot check per width (default: 2)
+#   SEED             seed for picking the suffixes (default: random, always printed)
+
+maxWidth=${MAX_WIDTH:-14}
+modeMaxWidth=${MODE_MAX_WIDTH:-12}
+slowMaxWidth=${SLOW_MAX_WIDTH:-10}
+spotWidths=${SPOT_WIDTHS:-15 16 17 18 19}
+spotChecks=${SPOT_CHECKS:-2}
+seed=${SEED:-${RANDOM}}
+work=$(mktemp -d)
+trap 'rm -rf ${work}' EXIT
+failed=0
+
+# reference <width> [skip-five]
+reference() {
+	if [ "$2" = "skip-five" ]; then
+		grep . outputs/qnums$1 | grep -v 5 | sort -n
+	else
+		grep . outputs/qnums$1 | sort -n
+	fi
+}
+
+# compare <name> <width> <expected file> <actual file>
+compare() {
+	if cmp -s $3 $4; then
+		echo "ok    $1 width $2 ($(wc -l < $3) numbers)"
+	else
+		echo "FAIL  $1 width $2: expected $(wc -l < $3) numbers, got $(wc -l < $4)"
+		diff $3 $4 | head -n 5
+		failed=1
+	fi
+}
+
+# run <name> <first width> <last width> <all|skip-five> <command...>
+run() {
+	local name=$1 first=$2 last=$3 fives=$4
+	shift 4
+	for width in $(seq ${first} $(( last < maxWidth ? last : maxWidth ))); do
+		reference ${width} ${fives} > ${work}/expected
+		echo ${width} | "$@" 2> /dev/null | grep . | sort -n > ${work}/actual
+		compare "${name}" ${width} ${work}/expected ${work}/actual
+	done
+}
+
+run quodigious 1 14 skip-five ./quodigious
+run iquodigious 1 13 skip-five ./iquodigious
+run lquodigious 1 ${slowMaxWidth} all ./lquodigious
+run tlquodigious 1 ${slowMaxWidth} all ./tlquodigious
+# the pull based generators, merged back together from a thread per subtree
+run "iquodigious -g" 1 ${modeMaxWidth} skip-five ./iquodigious -g
+
+# the permutation tail at either end of its range and not at all
+for tail in 0 3 8; do
+	run "quodigious -t ${tail}" 1 ${modeMaxWidth} skip-five ./quodigious -t ${tail}
+done
+# counting every pruned subtree takes a different path through the leaves
+run "quodigious -S" 1 ${modeMaxWidth} skip-five ./quodigious -S
+# exact rules must not change the results when they are turned off
+for rule in $(./quodigious -? 2>&1 | sed -n 's/^  \([a-z-]*\) (exact).*/\1/p'); do
+	run "quodigious -x ${rule}" 1 ${modeMaxWidth} skip-five ./quodigious -x ${rule}
+done
+# sharded: every two digit suffix split over the suffix walkers
+for tens in 2 3 4 6 7 8 9; do
+	for ones in 2 3 4 6 7 8 9; do
+		echo ${tens}${ones}
+	done
+done | ./quodigious -w ${work}/sharded -M 2 2> /dev/null
+run "quodigious sharded" 3 ${modeMaxWidth} skip-five ./quodigious -w ${work}/sharded
+
+# whatever a heuristic rule skips has to turn up when verifying it
+for rule in $(./quodigious -? 2>&1 | sed -n 's/^  \([a-z-]*\) (heuristic).*/\1/p'); do
+	for width in $(seq 1 $(( modeMaxWidth < maxWidth ? modeMaxWidth : maxWidth ))); do
+		reference ${width} $([ ${rule} != skip-five ] && echo skip-five) > ${work}/expected
+		{
+			echo ${width} | ./quodigious 2> /dev/null
+			echo ${width} | ./quodigious -V ${rule} 2> /dev/null
+		} | grep . | sort -n > ${work}/actual
+		compare "quodigious -V ${rule}" ${width} ${work}/expected ${work}/actual
+	done
+done
+
+echo "spot checking with seed ${seed}"
+for width in ${spotWidths}; do
+	# leave eleven digits to walk, which only takes a moment
+	length=$(( width - 11 ))
+	length=$(( length > 8 ? 8 : length ))
+	reference ${width} > ${work}/all
+	for number in $(awk -v seed=$(( seed + width )) -v count=${spotChecks} '
+		{ numbers[NR] = $0 }
+		END { srand(seed); for (i = 0; i < count; ++i) { print numbers[int(rand() * NR) + 1] } }' ${work}/all); do
+		suffix=${number: -${length}}
+		echo ${number} | ./quodigious -w ${work}/spot -M ${length} 2> /dev/null
+		grep "${suffix}\$" ${work}/all > ${work}/expected
+		echo ${width} | ./quodigious -w ${work}/spot 2> /dev/null | grep . | sort -n > ${work}/actual
+		compare "quodigious ...${suffix}" ${width} ${work}/expected ${work}/actual
+	done
+done
+
+if [ ${failed} -ne 0 ]; then
+	echo "Some engines do not match the reference results" >&2
+fi
+exit ${failed}
@@ -1,12 +0,0 @@
-#!/bin/bash
-
-./makeSpecialized.sh 2
-./makeSpecialized.sh 3
-./makeSpecialized.sh 4
-./makeSpecialized.sh 5
-./makeSpecialized.sh 6
-./makeSpecialized.sh 7
-./makeSpecialized.sh 8
-./makeSpecialized.sh 9
-./makeSpecialized.sh 10
-
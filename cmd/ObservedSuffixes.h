@@ -0,0 +1,108 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef OBSERVED_SUFFIXES_H__
+#define OBSERVED_SUFFIXES_H__
+#include "qlib.h"
+#include <array>
+#include <cstddef>
+
+// The unique last N digits seen across all of the previous runs, these are
+// regenerated from the outputs directory with makeSuffixTables.sh
+#define X(value) value,
+inline constexpr u64 observedSuffixes2[] = {
+#include "ObservedSuffixes2.def"
+};
+inline constexpr u64 observedSuffixes3[] = {
+#include "ObservedSuffixes3.def"
+};
+inline constexpr u64 observedSuffixes4[] = {
+#include "ObservedSuffixes4.def"
+};
+inline constexpr u64 observedSuffixes5[] = {
+#include "ObservedSuffixes5.def"
+};
+inline constexpr u64 observedSuffixes6[] = {
+#include "ObservedSuffixes6.def"
+};
+inline constexpr u64 observedSuffixes7[] = {
+#include "ObservedSuffixes7.def"
+};
+inline constexpr u64 observedSuffixes8[] = {
+#include "ObservedSuffixes8.def"
+};
+inline constexpr u64 observedSuffixes9[] = {
+#include "ObservedSuffixes9.def"
+};
+inline constexpr u64 observedSuffixes10[] = {
+#include "ObservedSuffixes10.def"
+};
+#undef X
+
+// The sum and product of each suffix are computed by the compiler from the
+// suffix itself and stored alongside of it so the specialized loop only has
+// to walk three flat arrays.
+template<std::size_t count>
+struct SuffixTable {
+    std::array<u64, count> values { };
+    std::array<u64, count> sums { };
+    std::array<u64, count> products { };
+    constexpr SuffixTable(const u64 (&suffixes)[count]) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            auto sum = 0ul;
+            auto product = 1ul;
+            for (auto value = suffixes[i]; value > 0; value /= 10) {
+                sum += (value % 10);
+                product *= (value % 10);
+            }
+            values[i] = suffixes[i];
+            sums[i] = sum;
+            products[i] = product;
+        }
+    }
+    constexpr auto size() const noexcept { return count; }
+};
+
+template<u64 width>
+constexpr auto& rawObservedSuffixes() noexcept {
+    static_assert(width >= 2 && width <= 10, "Only suffixes of two to ten digits have been observed!");
+    if constexpr (width == 2) {
+        return observedSuffixes2;
+    } else if constexpr (width == 3) {
+        return observedSuffixes3;
+    } else if constexpr (width == 4) {
+        return observedSuffixes4;
+    } else if constexpr (width == 5) {
+        return observedSuffixes5;
+    } else if constexpr (width == 6) {
+        return observedSuffixes6;
+    } else if constexpr (width == 7) {
+        return observedSuffixes7;
+    } else if constexpr (width == 8) {
+        return observedSuffixes8;
+    } else if constexpr (width == 9) {
+        return observedSuffixes9;
+    } else {
+        return observedSuffixes10;
+    }
+}
+
+template<u64 width>
+inline constexpr SuffixTable observedSuffixes { rawObservedSuffixes<width>() };
+
+#endif // end OBSERVED_SUFFIXES_H__
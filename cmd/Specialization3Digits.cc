@@ -1,49 +0,0 @@
-body<0>(stream, sum+ 4 + 2 + 2, product* 4 * 2 * 2, index + 224);
-body<0>(stream, sum+ 2 + 3 + 2, product* 2 * 3 * 2, index + 232);
-body<0>(stream, sum+ 8 + 4 + 2, product* 8 * 4 * 2, index + 248);
-body<0>(stream, sum+ 4 + 6 + 2, product* 4 * 6 * 2, index + 264);
-body<0>(stream, sum+ 2 + 7 + 2, product* 2 * 7 * 2, index + 272);
-body<0>(stream, sum+ 8 + 8 + 2, product* 8 * 8 * 2, index + 288);
-body<0>(stream, sum+ 6 + 9 + 2, product* 6 * 9 * 2, index + 296);
-body<0>(stream, sum+ 8 + 2 + 3, product* 8 * 2 * 3, index + 328);
-body<0>(stream, sum+ 6 + 3 + 3, product* 6 * 3 * 3, index + 336);
-body<0>(stream, sum+ 4 + 4 + 3, product* 4 * 4 * 3, index + 344);
-body<0>(stream, sum+ 8 + 6 + 3, product* 8 * 6 * 3, index + 368);
-body<0>(stream, sum+ 6 + 7 + 3, product* 6 * 7 * 3, index + 376);
-body<0>(stream, sum+ 4 + 8 + 3, product* 4 * 8 * 3, index + 384);
-body<0>(stream, sum+ 2 + 9 + 3, product* 2 * 9 * 3, index + 392);
-body<0>(stream, sum+ 4 + 2 + 4, product* 4 * 2 * 4, index + 424);
-body<0>(stream, sum+ 2 + 3 + 4, product* 2 * 3 * 4, index + 432);
-body<0>(stream, sum+ 8 + 4 + 4, product* 8 * 4 * 4, index + 448);
-body<0>(stream, sum+ 4 + 6 + 4, product* 4 * 6 * 4, index + 464);
-body<0>(stream, sum+ 2 + 7 + 4, product* 2 * 7 * 4, index + 472);
-body<0>(stream, sum+ 8 + 8 + 4, product* 8 * 8 * 4, index + 488);
-body<0>(stream, sum+ 6 + 9 + 4, product* 6 * 9 * 4, index + 496);
-body<0>(stream, sum+ 4 + 2 + 6, product* 4 * 2 * 6, index + 624);
-body<0>(stream, sum+ 2 + 3 + 6, product* 2 * 3 * 6, index + 632);
-body<0>(stream, sum+ 8 + 4 + 6, product* 8 * 4 * 6, index + 648);
-body<0>(stream, sum+ 4 + 6 + 6, product* 4 * 6 * 6, index + 664);
-body<0>(stream, sum+ 2 + 7 + 6, product* 2 * 7 * 6, index + 672);
-body<0>(stream, sum+ 8 + 8 + 6, product* 8 * 8 * 6, index + 688);
-body<0>(stream, sum+ 6 + 9 + 6, product* 6 * 9 * 6, index + 696);
-body<0>(stream, sum+ 8 + 2 + 7, product* 8 * 2 * 7, index + 728);
-body<0>(stream, sum+ 6 + 3 + 7, product* 6 * 3 * 7, index + 736);
-body<0>(stream, sum+ 4 + 4 + 7, product* 4 * 4 * 7, index + 744);
-body<0>(stream, sum+ 8 + 6 + 7, product* 8 * 6 * 7, index + 768);
-body<0>(stream, sum+ 6 + 7 + 7, product* 6 * 7 * 7, index + 776);
-body<0>(stream, sum+ 4 + 8 + 7, product* 4 * 8 * 7, index + 784);
-body<0>(stream, sum+ 2 + 9 + 7, product* 2 * 9 * 7, index + 792);
-body<0>(stream, sum+ 4 + 2 + 8, product* 4 * 2 * 8, index + 824);
-body<0>(stream, sum+ 2 + 3 + 8, product* 2 * 3 * 8, index + 832);
-body<0>(stream, sum+ 8 + 4 + 8, product* 8 * 4 * 8, index + 848);
-body<0>(stream, sum+ 4 + 6 + 8, product* 4 * 6 * 8, index + 864);
-body<0>(stream, sum+ 2 + 7 + 8, product* 2 * 7 * 8, index + 872);
-body<0>(stream, sum+ 8 + 8 + 8, product* 8 * 8 * 8, index + 888);
-body<0>(stream, sum+ 6 + 9 + 8, product* 6 * 9 * 8, index + 896);
-body<0>(stream, sum+ 8 + 2 + 9, product* 8 * 2 * 9, index + 928);
-body<0>(stream, sum+ 6 + 3 + 9, product* 6 * 3 * 9, index + 936);
-body<0>(stream, sum+ 4 + 4 + 9, product* 4 * 4 * 9, index + 944);
-body<0>(stream, sum+ 8 + 6 + 9, product* 8 * 6 * 9, index + 968);
-body<0>(stream, sum+ 6 + 7 + 9, product* 6 * 7 * 9, index + 976);
-body<0>(stream, sum+ 4 + 8 + 9, product* 4 * 8 * 9, index + 984);
-body<0>(stream, sum+ 2 + 9 + 9, product* 2 * 9 * 9, index + 992);
@@ -1,171 +0,0 @@
-body<0>(stream, sum+ 4 + 2 + 2 + 2, product* 4 * 2 * 2 * 2, index + 2224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2, product* 2 * 7 * 2 * 2, index + 2272);
-body<0>(stream, sum+ 8 + 8 + 2 + 2, product* 8 * 8 * 2 * 2, index + 2288);
-body<0>(stream, sum+ 6 + 3 + 3 + 2, product* 6 * 3 * 3 * 2, index + 2336);
-body<0>(stream, sum+ 8 + 6 + 3 + 2, product* 8 * 6 * 3 * 2, index + 2368);
-body<0>(stream, sum+ 4 + 8 + 3 + 2, product* 4 * 8 * 3 * 2, index + 2384);
-body<0>(stream, sum+ 2 + 3 + 4 + 2, product* 2 * 3 * 4 * 2, index + 2432);
-body<0>(stream, sum+ 8 + 4 + 4 + 2, product* 8 * 4 * 4 * 2, index + 2448);
-body<0>(stream, sum+ 4 + 6 + 4 + 2, product* 4 * 6 * 4 * 2, index + 2464);
-body<0>(stream, sum+ 6 + 9 + 4 + 2, product* 6 * 9 * 4 * 2, index + 2496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2, product* 4 * 2 * 6 * 2, index + 2624);
-body<0>(stream, sum+ 2 + 7 + 6 + 2, product* 2 * 7 * 6 * 2, index + 2672);
-body<0>(stream, sum+ 8 + 8 + 6 + 2, product* 8 * 8 * 6 * 2, index + 2688);
-body<0>(stream, sum+ 6 + 3 + 7 + 2, product* 6 * 3 * 7 * 2, index + 2736);
-body<0>(stream, sum+ 8 + 6 + 7 + 2, product* 8 * 6 * 7 * 2, index + 2768);
-body<0>(stream, sum+ 4 + 8 + 7 + 2, product* 4 * 8 * 7 * 2, index + 2784);
-body<0>(stream, sum+ 2 + 3 + 8 + 2, product* 2 * 3 * 8 * 2, index + 2832);
-body<0>(stream, sum+ 8 + 4 + 8 + 2, product* 8 * 4 * 8 * 2, index + 2848);
-body<0>(stream, sum+ 4 + 6 + 8 + 2, product* 4 * 6 * 8 * 2, index + 2864);
-body<0>(stream, sum+ 6 + 9 + 8 + 2, product* 6 * 9 * 8 * 2, index + 2896);
-body<0>(stream, sum+ 8 + 2 + 9 + 2, product* 8 * 2 * 9 * 2, index + 2928);
-body<0>(stream, sum+ 4 + 4 + 9 + 2, product* 4 * 4 * 9 * 2, index + 2944);
-body<0>(stream, sum+ 6 + 7 + 9 + 2, product* 6 * 7 * 9 * 2, index + 2976);
-body<0>(stream, sum+ 2 + 9 + 9 + 2, product* 2 * 9 * 9 * 2, index + 2992);
-body<0>(stream, sum+ 2 + 3 + 2 + 3, product* 2 * 3 * 2 * 3, index + 3232);
-body<0>(stream, sum+ 8 + 4 + 2 + 3, product* 8 * 4 * 2 * 3, index + 3248);
-body<0>(stream, sum+ 4 + 6 + 2 + 3, product* 4 * 6 * 2 * 3, index + 3264);
-body<0>(stream, sum+ 6 + 9 + 2 + 3, product* 6 * 9 * 2 * 3, index + 3296);
-body<0>(stream, sum+ 8 + 2 + 3 + 3, product* 8 * 2 * 3 * 3, index + 3328);
-body<0>(stream, sum+ 4 + 4 + 3 + 3, product* 4 * 4 * 3 * 3, index + 3344);
-body<0>(stream, sum+ 6 + 7 + 3 + 3, product* 6 * 7 * 3 * 3, index + 3376);
-body<0>(stream, sum+ 2 + 9 + 3 + 3, product* 2 * 9 * 3 * 3, index + 3392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3, product* 4 * 2 * 4 * 3, index + 3424);
-body<0>(stream, sum+ 2 + 7 + 4 + 3, product* 2 * 7 * 4 * 3, index + 3472);
-body<0>(stream, sum+ 8 + 8 + 4 + 3, product* 8 * 8 * 4 * 3, index + 3488);
-body<0>(stream, sum+ 2 + 3 + 6 + 3, product* 2 * 3 * 6 * 3, index + 3632);
-body<0>(stream, sum+ 8 + 4 + 6 + 3, product* 8 * 4 * 6 * 3, index + 3648);
-body<0>(stream, sum+ 4 + 6 + 6 + 3, product* 4 * 6 * 6 * 3, index + 3664);
-body<0>(stream, sum+ 6 + 9 + 6 + 3, product* 6 * 9 * 6 * 3, index + 3696);
-body<0>(stream, sum+ 8 + 2 + 7 + 3, product* 8 * 2 * 7 * 3, index + 3728);
-body<0>(stream, sum+ 4 + 4 + 7 + 3, product* 4 * 4 * 7 * 3, index + 3744);
-body<0>(stream, sum+ 6 + 7 + 7 + 3, product* 6 * 7 * 7 * 3, index + 3776);
-body<0>(stream, sum+ 2 + 9 + 7 + 3, product* 2 * 9 * 7 * 3, index + 3792);
-body<0>(stream, sum+ 4 + 2 + 8 + 3, product* 4 * 2 * 8 * 3, index + 3824);
-body<0>(stream, sum+ 2 + 7 + 8 + 3, product* 2 * 7 * 8 * 3, index + 3872);
-body<0>(stream, sum+ 8 + 8 + 8 + 3, product* 8 * 8 * 8 * 3, index + 3888);
-body<0>(stream, sum+ 6 + 3 + 9 + 3, product* 6 * 3 * 9 * 3, index + 3936);
-body<0>(stream, sum+ 8 + 6 + 9 + 3, product* 8 * 6 * 9 * 3, index + 3968);
-body<0>(stream, sum+ 4 + 8 + 9 + 3, product* 4 * 8 * 9 * 3, index + 3984);
-body<0>(stream, sum+ 4 + 2 + 2 + 4, product* 4 * 2 * 2 * 4, index + 4224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4, product* 2 * 7 * 2 * 4, index + 4272);
-body<0>(stream, sum+ 8 + 8 + 2 + 4, product* 8 * 8 * 2 * 4, index + 4288);
-body<0>(stream, sum+ 6 + 3 + 3 + 4, product* 6 * 3 * 3 * 4, index + 4336);
-body<0>(stream, sum+ 8 + 6 + 3 + 4, product* 8 * 6 * 3 * 4, index + 4368);
-body<0>(stream, sum+ 4 + 8 + 3 + 4, product* 4 * 8 * 3 * 4, index + 4384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4, product* 2 * 3 * 4 * 4, index + 4432);
-body<0>(stream, sum+ 8 + 4 + 4 + 4, product* 8 * 4 * 4 * 4, index + 4448);
-body<0>(stream, sum+ 4 + 6 + 4 + 4, product* 4 * 6 * 4 * 4, index + 4464);
-body<0>(stream, sum+ 6 + 9 + 4 + 4, product* 6 * 9 * 4 * 4, index + 4496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4, product* 4 * 2 * 6 * 4, index + 4624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4, product* 2 * 7 * 6 * 4, index + 4672);
-body<0>(stream, sum+ 8 + 8 + 6 + 4, product* 8 * 8 * 6 * 4, index + 4688);
-body<0>(stream, sum+ 6 + 3 + 7 + 4, product* 6 * 3 * 7 * 4, index + 4736);
-body<0>(stream, sum+ 8 + 6 + 7 + 4, product* 8 * 6 * 7 * 4, index + 4768);
-body<0>(stream, sum+ 4 + 8 + 7 + 4, product* 4 * 8 * 7 * 4, index + 4784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4, product* 2 * 3 * 8 * 4, index + 4832);
-body<0>(stream, sum+ 8 + 4 + 8 + 4, product* 8 * 4 * 8 * 4, index + 4848);
-body<0>(stream, sum+ 4 + 6 + 8 + 4, product* 4 * 6 * 8 * 4, index + 4864);
-body<0>(stream, sum+ 6 + 9 + 8 + 4, product* 6 * 9 * 8 * 4, index + 4896);
-body<0>(stream, sum+ 8 + 2 + 9 + 4, product* 8 * 2 * 9 * 4, index + 4928);
-body<0>(stream, sum+ 4 + 4 + 9 + 4, product* 4 * 4 * 9 * 4, index + 4944);
-body<0>(stream, sum+ 6 + 7 + 9 + 4, product* 6 * 7 * 9 * 4, index + 4976);
-body<0>(stream, sum+ 2 + 9 + 9 + 4, product* 2 * 9 * 9 * 4, index + 4992);
-body<0>(stream, sum+ 4 + 2 + 2 + 6, product* 4 * 2 * 2 * 6, index + 6224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6, product* 2 * 7 * 2 * 6, index + 6272);
-body<0>(stream, sum+ 8 + 8 + 2 + 6, product* 8 * 8 * 2 * 6, index + 6288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6, product* 6 * 3 * 3 * 6, index + 6336);
-body<0>(stream, sum+ 8 + 6 + 3 + 6, product* 8 * 6 * 3 * 6, index + 6368);
-body<0>(stream, sum+ 4 + 8 + 3 + 6, product* 4 * 8 * 3 * 6, index + 6384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6, product* 2 * 3 * 4 * 6, index + 6432);
-body<0>(stream, sum+ 8 + 4 + 4 + 6, product* 8 * 4 * 4 * 6, index + 6448);
-body<0>(stream, sum+ 4 + 6 + 4 + 6, product* 4 * 6 * 4 * 6, index + 6464);
-body<0>(stream, sum+ 6 + 9 + 4 + 6, product* 6 * 9 * 4 * 6, index + 6496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6, product* 4 * 2 * 6 * 6, index + 6624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6, product* 2 * 7 * 6 * 6, index + 6672);
-body<0>(stream, sum+ 8 + 8 + 6 + 6, product* 8 * 8 * 6 * 6, index + 6688);
-body<0>(stream, sum+ 6 + 3 + 7 + 6, product* 6 * 3 * 7 * 6, index + 6736);
-body<0>(stream, sum+ 8 + 6 + 7 + 6, product* 8 * 6 * 7 * 6, index + 6768);
-body<0>(stream, sum+ 4 + 8 + 7 + 6, product* 4 * 8 * 7 * 6, index + 6784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6, product* 2 * 3 * 8 * 6, index + 6832);
-body<0>(stream, sum+ 8 + 4 + 8 + 6, product* 8 * 4 * 8 * 6, index + 6848);
-body<0>(stream, sum+ 4 + 6 + 8 + 6, product* 4 * 6 * 8 * 6, index + 6864);
-body<0>(stream, sum+ 6 + 9 + 8 + 6, product* 6 * 9 * 8 * 6, index + 6896);
-body<0>(stream, sum+ 8 + 2 + 9 + 6, product* 8 * 2 * 9 * 6, index + 6928);
-body<0>(stream, sum+ 4 + 4 + 9 + 6, product* 4 * 4 * 9 * 6, index + 6944);
-body<0>(stream, sum+ 6 + 7 + 9 + 6, product* 6 * 7 * 9 * 6, index + 6976);
-body<0>(stream, sum+ 2 + 9 + 9 + 6, product* 2 * 9 * 9 * 6, index + 6992);
-body<0>(stream, sum+ 2 + 3 + 2 + 7, product* 2 * 3 * 2 * 7, index + 7232);
-body<0>(stream, sum+ 8 + 4 + 2 + 7, product* 8 * 4 * 2 * 7, index + 7248);
-body<0>(stream, sum+ 4 + 6 + 2 + 7, product* 4 * 6 * 2 * 7, index + 7264);
-body<0>(stream, sum+ 6 + 9 + 2 + 7, product* 6 * 9 * 2 * 7, index + 7296);
-body<0>(stream, sum+ 8 + 2 + 3 + 7, product* 8 * 2 * 3 * 7, index + 7328);
-body<0>(stream, sum+ 4 + 4 + 3 + 7, product* 4 * 4 * 3 * 7, index + 7344);
-body<0>(stream, sum+ 6 + 7 + 3 + 7, product* 6 * 7 * 3 * 7, index + 7376);
-body<0>(stream, sum+ 2 + 9 + 3 + 7, product* 2 * 9 * 3 * 7, index + 7392);
-body<0>(stream, sum+ 4 + 2 + 4 + 7, product* 4 * 2 * 4 * 7, index + 7424);
-body<0>(stream, sum+ 2 + 7 + 4 + 7, product* 2 * 7 * 4 * 7, index + 7472);
-body<0>(stream, sum+ 8 + 8 + 4 + 7, product* 8 * 8 * 4 * 7, index + 7488);
-body<0>(stream, sum+ 2 + 3 + 6 + 7, product* 2 * 3 * 6 * 7, index + 7632);
-body<0>(stream, sum+ 8 + 4 + 6 + 7, product* 8 * 4 * 6 * 7, index + 7648);
-body<0>(stream, sum+ 4 + 6 + 6 + 7, product* 4 * 6 * 6 * 7, index + 7664);
-body<0>(stream, sum+ 6 + 9 + 6 + 7, product* 6 * 9 * 6 * 7, index + 7696);
-body<0>(stream, sum+ 8 + 2 + 7 + 7, product* 8 * 2 * 7 * 7, index + 7728);
-body<0>(stream, sum+ 4 + 4 + 7 + 7, product* 4 * 4 * 7 * 7, index + 7744);
-body<0>(stream, sum+ 6 + 7 + 7 + 7, product* 6 * 7 * 7 * 7, index + 7776);
-body<0>(stream, sum+ 2 + 9 + 7 + 7, product* 2 * 9 * 7 * 7, index + 7792);
-body<0>(stream, sum+ 4 + 2 + 8 + 7, product* 4 * 2 * 8 * 7, index + 7824);
-body<0>(stream, sum+ 2 + 7 + 8 + 7, product* 2 * 7 * 8 * 7, index + 7872);
-body<0>(stream, sum+ 8 + 8 + 8 + 7, product* 8 * 8 * 8 * 7, index + 7888);
-body<0>(stream, sum+ 6 + 3 + 9 + 7, product* 6 * 3 * 9 * 7, index + 7936);
-body<0>(stream, sum+ 8 + 6 + 9 + 7, product* 8 * 6 * 9 * 7, index + 7968);
-body<0>(stream, sum+ 4 + 8 + 9 + 7, product* 4 * 8 * 9 * 7, index + 7984);
-body<0>(stream, sum+ 4 + 2 + 2 + 8, product* 4 * 2 * 2 * 8, index + 8224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8, product* 2 * 7 * 2 * 8, index + 8272);
-body<0>(stream, sum+ 8 + 8 + 2 + 8, product* 8 * 8 * 2 * 8, index + 8288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8, product* 6 * 3 * 3 * 8, index + 8336);
-body<0>(stream, sum+ 8 + 6 + 3 + 8, product* 8 * 6 * 3 * 8, index + 8368);
-body<0>(stream, sum+ 4 + 8 + 3 + 8, product* 4 * 8 * 3 * 8, index + 8384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8, product* 2 * 3 * 4 * 8, index + 8432);
-body<0>(stream, sum+ 8 + 4 + 4 + 8, product* 8 * 4 * 4 * 8, index + 8448);
-body<0>(stream, sum+ 4 + 6 + 4 + 8, product* 4 * 6 * 4 * 8, index + 8464);
-body<0>(stream, sum+ 6 + 9 + 4 + 8, product* 6 * 9 * 4 * 8, index + 8496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8, product* 4 * 2 * 6 * 8, index + 8624);
-body<0>(stream, sum+ 2 + 7 + 6 + 8, product* 2 * 7 * 6 * 8, index + 8672);
-body<0>(stream, sum+ 8 + 8 + 6 + 8, product* 8 * 8 * 6 * 8, index + 8688);
-body<0>(stream, sum+ 6 + 3 + 7 + 8, product* 6 * 3 * 7 * 8, index + 8736);
-body<0>(stream, sum+ 8 + 6 + 7 + 8, product* 8 * 6 * 7 * 8, index + 8768);
-body<0>(stream, sum+ 4 + 8 + 7 + 8, product* 4 * 8 * 7 * 8, index + 8784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8, product* 2 * 3 * 8 * 8, index + 8832);
-body<0>(stream, sum+ 8 + 4 + 8 + 8, product* 8 * 4 * 8 * 8, index + 8848);
-body<0>(stream, sum+ 4 + 6 + 8 + 8, product* 4 * 6 * 8 * 8, index + 8864);
-body<0>(stream, sum+ 6 + 9 + 8 + 8, product* 6 * 9 * 8 * 8, index + 8896);
-body<0>(stream, sum+ 8 + 2 + 9 + 8, product* 8 * 2 * 9 * 8, index + 8928);
-body<0>(stream, sum+ 4 + 4 + 9 + 8, product* 4 * 4 * 9 * 8, index + 8944);
-body<0>(stream, sum+ 6 + 7 + 9 + 8, product* 6 * 7 * 9 * 8, index + 8976);
-body<0>(stream, sum+ 2 + 9 + 9 + 8, product* 2 * 9 * 9 * 8, index + 8992);
-body<0>(stream, sum+ 2 + 3 + 2 + 9, product* 2 * 3 * 2 * 9, index + 9232);
-body<0>(stream, sum+ 8 + 4 + 2 + 9, product* 8 * 4 * 2 * 9, index + 9248);
-body<0>(stream, sum+ 4 + 6 + 2 + 9, product* 4 * 6 * 2 * 9, index + 9264);
-body<0>(stream, sum+ 6 + 9 + 2 + 9, product* 6 * 9 * 2 * 9, index + 9296);
-body<0>(stream, sum+ 8 + 2 + 3 + 9, product* 8 * 2 * 3 * 9, index + 9328);
-body<0>(stream, sum+ 4 + 4 + 3 + 9, product* 4 * 4 * 3 * 9, index + 9344);
-body<0>(stream, sum+ 6 + 7 + 3 + 9, product* 6 * 7 * 3 * 9, index + 9376);
-body<0>(stream, sum+ 2 + 9 + 3 + 9, product* 2 * 9 * 3 * 9, index + 9392);
-body<0>(stream, sum+ 4 + 2 + 4 + 9, product* 4 * 2 * 4 * 9, index + 9424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9, product* 2 * 7 * 4 * 9, index + 9472);
-body<0>(stream, sum+ 8 + 8 + 4 + 9, product* 8 * 8 * 4 * 9, index + 9488);
-body<0>(stream, sum+ 2 + 3 + 6 + 9, product* 2 * 3 * 6 * 9, index + 9632);
-body<0>(stream, sum+ 8 + 4 + 6 + 9, product* 8 * 4 * 6 * 9, index + 9648);
-body<0>(stream, sum+ 4 + 6 + 6 + 9, product* 4 * 6 * 6 * 9, index + 9664);
-body<0>(stream, sum+ 6 + 9 + 6 + 9, product* 6 * 9 * 6 * 9, index + 9696);
-body<0>(stream, sum+ 8 + 2 + 7 + 9, product* 8 * 2 * 7 * 9, index + 9728);
-body<0>(stream, sum+ 4 + 4 + 7 + 9, product* 4 * 4 * 7 * 9, index + 9744);
-body<0>(stream, sum+ 6 + 7 + 7 + 9, product* 6 * 7 * 7 * 9, index + 9776);
-body<0>(stream, sum+ 2 + 9 + 7 + 9, product* 2 * 9 * 7 * 9, index + 9792);
-body<0>(stream, sum+ 4 + 2 + 8 + 9, product* 4 * 2 * 8 * 9, index + 9824);
-body<0>(stream, sum+ 2 + 7 + 8 + 9, product* 2 * 7 * 8 * 9, index + 9872);
-body<0>(stream, sum+ 8 + 8 + 8 + 9, product* 8 * 8 * 8 * 9, index + 9888);
-body<0>(stream, sum+ 6 + 3 + 9 + 9, product* 6 * 3 * 9 * 9, index + 9936);
-body<0>(stream, sum+ 8 + 6 + 9 + 9, product* 8 * 6 * 9 * 9, index + 9968);
-body<0>(stream, sum+ 4 + 8 + 9 + 9, product* 4 * 8 * 9 * 9, index + 9984);
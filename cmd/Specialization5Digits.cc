@@ -1,574 +0,0 @@
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2, product* 2 * 7 * 2 * 2 * 2, index + 22272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2, product* 6 * 3 * 3 * 2 * 2, index + 22336);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2, product* 8 * 6 * 3 * 2 * 2, index + 22368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2, product* 2 * 3 * 4 * 2 * 2, index + 22432);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2, product* 4 * 6 * 4 * 2 * 2, index + 22464);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2, product* 6 * 9 * 4 * 2 * 2, index + 22496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2, product* 4 * 2 * 6 * 2 * 2, index + 22624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2, product* 8 * 8 * 6 * 2 * 2, index + 22688);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2, product* 4 * 8 * 7 * 2 * 2, index + 22784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2, product* 8 * 4 * 8 * 2 * 2, index + 22848);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2, product* 4 * 4 * 9 * 2 * 2, index + 22944);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2, product* 6 * 7 * 9 * 2 * 2, index + 22976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2, product* 2 * 3 * 2 * 3 * 2, index + 23232);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2, product* 4 * 6 * 2 * 3 * 2, index + 23264);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2, product* 6 * 9 * 2 * 3 * 2, index + 23296);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2, product* 8 * 2 * 3 * 3 * 2, index + 23328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2, product* 2 * 9 * 3 * 3 * 2, index + 23392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2, product* 4 * 2 * 4 * 3 * 2, index + 23424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2, product* 8 * 8 * 4 * 3 * 2, index + 23488);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2, product* 8 * 4 * 6 * 3 * 2, index + 23648);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2, product* 4 * 4 * 7 * 3 * 2, index + 23744);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2, product* 6 * 7 * 7 * 3 * 2, index + 23776);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2, product* 2 * 7 * 8 * 3 * 2, index + 23872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2, product* 6 * 3 * 9 * 3 * 2, index + 23936);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2, product* 8 * 6 * 9 * 3 * 2, index + 23968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2, product* 4 * 2 * 2 * 4 * 2, index + 24224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2, product* 8 * 8 * 2 * 4 * 2, index + 24288);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2, product* 4 * 8 * 3 * 4 * 2, index + 24384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2, product* 8 * 4 * 4 * 4 * 2, index + 24448);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2, product* 2 * 7 * 6 * 4 * 2, index + 24672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2, product* 6 * 3 * 7 * 4 * 2, index + 24736);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2, product* 8 * 6 * 7 * 4 * 2, index + 24768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2, product* 2 * 3 * 8 * 4 * 2, index + 24832);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2, product* 4 * 6 * 8 * 4 * 2, index + 24864);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2, product* 6 * 9 * 8 * 4 * 2, index + 24896);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2, product* 8 * 2 * 9 * 4 * 2, index + 24928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2, product* 2 * 9 * 9 * 4 * 2, index + 24992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2, product* 2 * 7 * 2 * 6 * 2, index + 26272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2, product* 6 * 3 * 3 * 6 * 2, index + 26336);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2, product* 8 * 6 * 3 * 6 * 2, index + 26368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2, product* 2 * 3 * 4 * 6 * 2, index + 26432);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2, product* 4 * 6 * 4 * 6 * 2, index + 26464);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2, product* 6 * 9 * 4 * 6 * 2, index + 26496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2, product* 4 * 2 * 6 * 6 * 2, index + 26624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2, product* 8 * 8 * 6 * 6 * 2, index + 26688);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2, product* 4 * 8 * 7 * 6 * 2, index + 26784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2, product* 8 * 4 * 8 * 6 * 2, index + 26848);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2, product* 4 * 4 * 9 * 6 * 2, index + 26944);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2, product* 6 * 7 * 9 * 6 * 2, index + 26976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2, product* 2 * 3 * 2 * 7 * 2, index + 27232);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2, product* 4 * 6 * 2 * 7 * 2, index + 27264);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2, product* 6 * 9 * 2 * 7 * 2, index + 27296);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2, product* 8 * 2 * 3 * 7 * 2, index + 27328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2, product* 2 * 9 * 3 * 7 * 2, index + 27392);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2, product* 4 * 2 * 4 * 7 * 2, index + 27424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2, product* 8 * 8 * 4 * 7 * 2, index + 27488);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2, product* 8 * 4 * 6 * 7 * 2, index + 27648);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2, product* 4 * 4 * 7 * 7 * 2, index + 27744);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2, product* 6 * 7 * 7 * 7 * 2, index + 27776);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2, product* 2 * 7 * 8 * 7 * 2, index + 27872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2, product* 6 * 3 * 9 * 7 * 2, index + 27936);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2, product* 8 * 6 * 9 * 7 * 2, index + 27968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2, product* 4 * 2 * 2 * 8 * 2, index + 28224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2, product* 8 * 8 * 2 * 8 * 2, index + 28288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2, product* 4 * 8 * 3 * 8 * 2, index + 28384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2, product* 8 * 4 * 4 * 8 * 2, index + 28448);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2, product* 2 * 7 * 6 * 8 * 2, index + 28672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2, product* 6 * 3 * 7 * 8 * 2, index + 28736);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2, product* 8 * 6 * 7 * 8 * 2, index + 28768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2, product* 2 * 3 * 8 * 8 * 2, index + 28832);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2, product* 4 * 6 * 8 * 8 * 2, index + 28864);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2, product* 6 * 9 * 8 * 8 * 2, index + 28896);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2, product* 8 * 2 * 9 * 8 * 2, index + 28928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2, product* 2 * 9 * 9 * 8 * 2, index + 28992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2, product* 8 * 4 * 2 * 9 * 2, index + 29248);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2, product* 4 * 4 * 3 * 9 * 2, index + 29344);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2, product* 6 * 7 * 3 * 9 * 2, index + 29376);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2, product* 2 * 7 * 4 * 9 * 2, index + 29472);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2, product* 2 * 3 * 6 * 9 * 2, index + 29632);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2, product* 4 * 6 * 6 * 9 * 2, index + 29664);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2, product* 6 * 9 * 6 * 9 * 2, index + 29696);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2, product* 8 * 2 * 7 * 9 * 2, index + 29728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2, product* 2 * 9 * 7 * 9 * 2, index + 29792);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2, product* 4 * 2 * 8 * 9 * 2, index + 29824);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 2, product* 8 * 8 * 8 * 9 * 2, index + 29888);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2, product* 4 * 8 * 9 * 9 * 2, index + 29984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3, product* 4 * 2 * 2 * 2 * 3, index + 32224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3, product* 8 * 8 * 2 * 2 * 3, index + 32288);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3, product* 4 * 8 * 3 * 2 * 3, index + 32384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3, product* 8 * 4 * 4 * 2 * 3, index + 32448);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3, product* 2 * 7 * 6 * 2 * 3, index + 32672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3, product* 6 * 3 * 7 * 2 * 3, index + 32736);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3, product* 8 * 6 * 7 * 2 * 3, index + 32768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3, product* 2 * 3 * 8 * 2 * 3, index + 32832);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3, product* 4 * 6 * 8 * 2 * 3, index + 32864);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3, product* 6 * 9 * 8 * 2 * 3, index + 32896);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3, product* 8 * 2 * 9 * 2 * 3, index + 32928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3, product* 2 * 9 * 9 * 2 * 3, index + 32992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3, product* 8 * 4 * 2 * 3 * 3, index + 33248);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3, product* 4 * 4 * 3 * 3 * 3, index + 33344);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3, product* 6 * 7 * 3 * 3 * 3, index + 33376);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3, product* 2 * 7 * 4 * 3 * 3, index + 33472);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3, product* 2 * 3 * 6 * 3 * 3, index + 33632);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3, product* 4 * 6 * 6 * 3 * 3, index + 33664);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3, product* 6 * 9 * 6 * 3 * 3, index + 33696);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3, product* 8 * 2 * 7 * 3 * 3, index + 33728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3, product* 2 * 9 * 7 * 3 * 3, index + 33792);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3, product* 4 * 2 * 8 * 3 * 3, index + 33824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3, product* 8 * 8 * 8 * 3 * 3, index + 33888);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3, product* 4 * 8 * 9 * 3 * 3, index + 33984);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3, product* 2 * 7 * 2 * 4 * 3, index + 34272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3, product* 6 * 3 * 3 * 4 * 3, index + 34336);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3, product* 8 * 6 * 3 * 4 * 3, index + 34368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3, product* 2 * 3 * 4 * 4 * 3, index + 34432);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3, product* 4 * 6 * 4 * 4 * 3, index + 34464);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3, product* 6 * 9 * 4 * 4 * 3, index + 34496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3, product* 4 * 2 * 6 * 4 * 3, index + 34624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3, product* 8 * 8 * 6 * 4 * 3, index + 34688);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3, product* 4 * 8 * 7 * 4 * 3, index + 34784);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3, product* 4 * 4 * 9 * 4 * 3, index + 34944);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3, product* 6 * 7 * 9 * 4 * 3, index + 34976);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3, product* 4 * 2 * 2 * 6 * 3, index + 36224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3, product* 8 * 8 * 2 * 6 * 3, index + 36288);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3, product* 4 * 8 * 3 * 6 * 3, index + 36384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3, product* 8 * 4 * 4 * 6 * 3, index + 36448);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3, product* 2 * 7 * 6 * 6 * 3, index + 36672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3, product* 6 * 3 * 7 * 6 * 3, index + 36736);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 3, product* 8 * 6 * 7 * 6 * 3, index + 36768);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3, product* 2 * 3 * 8 * 6 * 3, index + 36832);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3, product* 4 * 6 * 8 * 6 * 3, index + 36864);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3, product* 6 * 9 * 8 * 6 * 3, index + 36896);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3, product* 8 * 2 * 9 * 6 * 3, index + 36928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3, product* 2 * 9 * 9 * 6 * 3, index + 36992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3, product* 8 * 4 * 2 * 7 * 3, index + 37248);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3, product* 4 * 4 * 3 * 7 * 3, index + 37344);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3, product* 6 * 7 * 3 * 7 * 3, index + 37376);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3, product* 2 * 7 * 4 * 7 * 3, index + 37472);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3, product* 2 * 3 * 6 * 7 * 3, index + 37632);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3, product* 4 * 6 * 6 * 7 * 3, index + 37664);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3, product* 6 * 9 * 6 * 7 * 3, index + 37696);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3, product* 8 * 2 * 7 * 7 * 3, index + 37728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3, product* 2 * 9 * 7 * 7 * 3, index + 37792);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3, product* 4 * 2 * 8 * 7 * 3, index + 37824);
-body<0>(stream, sum+ 8 + 8 + 8 + 7 + 3, product* 8 * 8 * 8 * 7 * 3, index + 37888);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3, product* 4 * 8 * 9 * 7 * 3, index + 37984);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3, product* 2 * 7 * 2 * 8 * 3, index + 38272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3, product* 6 * 3 * 3 * 8 * 3, index + 38336);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3, product* 8 * 6 * 3 * 8 * 3, index + 38368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3, product* 2 * 3 * 4 * 8 * 3, index + 38432);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3, product* 4 * 6 * 4 * 8 * 3, index + 38464);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3, product* 6 * 9 * 4 * 8 * 3, index + 38496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3, product* 4 * 2 * 6 * 8 * 3, index + 38624);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3, product* 8 * 8 * 6 * 8 * 3, index + 38688);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3, product* 4 * 8 * 7 * 8 * 3, index + 38784);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3, product* 8 * 4 * 8 * 8 * 3, index + 38848);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3, product* 4 * 4 * 9 * 8 * 3, index + 38944);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3, product* 6 * 7 * 9 * 8 * 3, index + 38976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3, product* 2 * 3 * 2 * 9 * 3, index + 39232);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3, product* 4 * 6 * 2 * 9 * 3, index + 39264);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3, product* 6 * 9 * 2 * 9 * 3, index + 39296);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3, product* 8 * 2 * 3 * 9 * 3, index + 39328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3, product* 2 * 9 * 3 * 9 * 3, index + 39392);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3, product* 4 * 2 * 4 * 9 * 3, index + 39424);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3, product* 8 * 8 * 4 * 9 * 3, index + 39488);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3, product* 8 * 4 * 6 * 9 * 3, index + 39648);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3, product* 4 * 4 * 7 * 9 * 3, index + 39744);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 3, product* 6 * 7 * 7 * 9 * 3, index + 39776);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3, product* 2 * 7 * 8 * 9 * 3, index + 39872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3, product* 6 * 3 * 9 * 9 * 3, index + 39936);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3, product* 8 * 6 * 9 * 9 * 3, index + 39968);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4, product* 2 * 7 * 2 * 2 * 4, index + 42272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4, product* 6 * 3 * 3 * 2 * 4, index + 42336);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4, product* 8 * 6 * 3 * 2 * 4, index + 42368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4, product* 2 * 3 * 4 * 2 * 4, index + 42432);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4, product* 4 * 6 * 4 * 2 * 4, index + 42464);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4, product* 6 * 9 * 4 * 2 * 4, index + 42496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4, product* 4 * 2 * 6 * 2 * 4, index + 42624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4, product* 8 * 8 * 6 * 2 * 4, index + 42688);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4, product* 4 * 8 * 7 * 2 * 4, index + 42784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4, product* 8 * 4 * 8 * 2 * 4, index + 42848);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4, product* 4 * 4 * 9 * 2 * 4, index + 42944);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4, product* 6 * 7 * 9 * 2 * 4, index + 42976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4, product* 2 * 3 * 2 * 3 * 4, index + 43232);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4, product* 4 * 6 * 2 * 3 * 4, index + 43264);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4, product* 6 * 9 * 2 * 3 * 4, index + 43296);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4, product* 8 * 2 * 3 * 3 * 4, index + 43328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4, product* 2 * 9 * 3 * 3 * 4, index + 43392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4, product* 4 * 2 * 4 * 3 * 4, index + 43424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4, product* 8 * 8 * 4 * 3 * 4, index + 43488);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4, product* 8 * 4 * 6 * 3 * 4, index + 43648);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4, product* 4 * 4 * 7 * 3 * 4, index + 43744);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4, product* 6 * 7 * 7 * 3 * 4, index + 43776);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4, product* 2 * 7 * 8 * 3 * 4, index + 43872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4, product* 6 * 3 * 9 * 3 * 4, index + 43936);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4, product* 8 * 6 * 9 * 3 * 4, index + 43968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4, product* 4 * 2 * 2 * 4 * 4, index + 44224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4, product* 8 * 8 * 2 * 4 * 4, index + 44288);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4, product* 4 * 8 * 3 * 4 * 4, index + 44384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4, product* 8 * 4 * 4 * 4 * 4, index + 44448);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4, product* 2 * 7 * 6 * 4 * 4, index + 44672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4, product* 6 * 3 * 7 * 4 * 4, index + 44736);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4, product* 8 * 6 * 7 * 4 * 4, index + 44768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4, product* 2 * 3 * 8 * 4 * 4, index + 44832);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4, product* 4 * 6 * 8 * 4 * 4, index + 44864);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 4, product* 6 * 9 * 8 * 4 * 4, index + 44896);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4, product* 8 * 2 * 9 * 4 * 4, index + 44928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4, product* 2 * 9 * 9 * 4 * 4, index + 44992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4, product* 2 * 7 * 2 * 6 * 4, index + 46272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4, product* 6 * 3 * 3 * 6 * 4, index + 46336);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4, product* 8 * 6 * 3 * 6 * 4, index + 46368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4, product* 2 * 3 * 4 * 6 * 4, index + 46432);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4, product* 4 * 6 * 4 * 6 * 4, index + 46464);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4, product* 6 * 9 * 4 * 6 * 4, index + 46496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4, product* 4 * 2 * 6 * 6 * 4, index + 46624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4, product* 8 * 8 * 6 * 6 * 4, index + 46688);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4, product* 4 * 8 * 7 * 6 * 4, index + 46784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4, product* 8 * 4 * 8 * 6 * 4, index + 46848);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4, product* 4 * 4 * 9 * 6 * 4, index + 46944);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4, product* 6 * 7 * 9 * 6 * 4, index + 46976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4, product* 2 * 3 * 2 * 7 * 4, index + 47232);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4, product* 4 * 6 * 2 * 7 * 4, index + 47264);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4, product* 6 * 9 * 2 * 7 * 4, index + 47296);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4, product* 8 * 2 * 3 * 7 * 4, index + 47328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4, product* 2 * 9 * 3 * 7 * 4, index + 47392);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4, product* 4 * 2 * 4 * 7 * 4, index + 47424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4, product* 8 * 8 * 4 * 7 * 4, index + 47488);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4, product* 8 * 4 * 6 * 7 * 4, index + 47648);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4, product* 4 * 4 * 7 * 7 * 4, index + 47744);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4, product* 6 * 7 * 7 * 7 * 4, index + 47776);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4, product* 2 * 7 * 8 * 7 * 4, index + 47872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4, product* 6 * 3 * 9 * 7 * 4, index + 47936);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4, product* 4 * 2 * 2 * 8 * 4, index + 48224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4, product* 8 * 8 * 2 * 8 * 4, index + 48288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4, product* 4 * 8 * 3 * 8 * 4, index + 48384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4, product* 8 * 4 * 4 * 8 * 4, index + 48448);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4, product* 2 * 7 * 6 * 8 * 4, index + 48672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4, product* 6 * 3 * 7 * 8 * 4, index + 48736);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4, product* 8 * 6 * 7 * 8 * 4, index + 48768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4, product* 2 * 3 * 8 * 8 * 4, index + 48832);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4, product* 4 * 6 * 8 * 8 * 4, index + 48864);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4, product* 6 * 9 * 8 * 8 * 4, index + 48896);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4, product* 8 * 2 * 9 * 8 * 4, index + 48928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4, product* 2 * 9 * 9 * 8 * 4, index + 48992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4, product* 8 * 4 * 2 * 9 * 4, index + 49248);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4, product* 4 * 4 * 3 * 9 * 4, index + 49344);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4, product* 6 * 7 * 3 * 9 * 4, index + 49376);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4, product* 2 * 7 * 4 * 9 * 4, index + 49472);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4, product* 2 * 3 * 6 * 9 * 4, index + 49632);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4, product* 4 * 6 * 6 * 9 * 4, index + 49664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4, product* 8 * 2 * 7 * 9 * 4, index + 49728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4, product* 2 * 9 * 7 * 9 * 4, index + 49792);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4, product* 4 * 2 * 8 * 9 * 4, index + 49824);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4, product* 4 * 8 * 9 * 9 * 4, index + 49984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6, product* 2 * 7 * 2 * 2 * 6, index + 62272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6, product* 6 * 3 * 3 * 2 * 6, index + 62336);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6, product* 8 * 6 * 3 * 2 * 6, index + 62368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6, product* 2 * 3 * 4 * 2 * 6, index + 62432);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6, product* 4 * 6 * 4 * 2 * 6, index + 62464);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6, product* 6 * 9 * 4 * 2 * 6, index + 62496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6, product* 4 * 2 * 6 * 2 * 6, index + 62624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6, product* 8 * 8 * 6 * 2 * 6, index + 62688);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6, product* 4 * 8 * 7 * 2 * 6, index + 62784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6, product* 8 * 4 * 8 * 2 * 6, index + 62848);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6, product* 4 * 4 * 9 * 2 * 6, index + 62944);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6, product* 6 * 7 * 9 * 2 * 6, index + 62976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6, product* 2 * 3 * 2 * 3 * 6, index + 63232);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6, product* 4 * 6 * 2 * 3 * 6, index + 63264);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6, product* 6 * 9 * 2 * 3 * 6, index + 63296);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6, product* 8 * 2 * 3 * 3 * 6, index + 63328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6, product* 2 * 9 * 3 * 3 * 6, index + 63392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6, product* 4 * 2 * 4 * 3 * 6, index + 63424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6, product* 8 * 8 * 4 * 3 * 6, index + 63488);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6, product* 8 * 4 * 6 * 3 * 6, index + 63648);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6, product* 4 * 4 * 7 * 3 * 6, index + 63744);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6, product* 6 * 7 * 7 * 3 * 6, index + 63776);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6, product* 2 * 7 * 8 * 3 * 6, index + 63872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6, product* 6 * 3 * 9 * 3 * 6, index + 63936);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6, product* 8 * 6 * 9 * 3 * 6, index + 63968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6, product* 4 * 2 * 2 * 4 * 6, index + 64224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6, product* 8 * 8 * 2 * 4 * 6, index + 64288);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6, product* 4 * 8 * 3 * 4 * 6, index + 64384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6, product* 8 * 4 * 4 * 4 * 6, index + 64448);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6, product* 2 * 7 * 6 * 4 * 6, index + 64672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6, product* 6 * 3 * 7 * 4 * 6, index + 64736);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6, product* 8 * 6 * 7 * 4 * 6, index + 64768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6, product* 2 * 3 * 8 * 4 * 6, index + 64832);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6, product* 4 * 6 * 8 * 4 * 6, index + 64864);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6, product* 6 * 9 * 8 * 4 * 6, index + 64896);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6, product* 8 * 2 * 9 * 4 * 6, index + 64928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6, product* 2 * 9 * 9 * 4 * 6, index + 64992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6, product* 2 * 7 * 2 * 6 * 6, index + 66272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6, product* 6 * 3 * 3 * 6 * 6, index + 66336);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6, product* 8 * 6 * 3 * 6 * 6, index + 66368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6, product* 2 * 3 * 4 * 6 * 6, index + 66432);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6, product* 4 * 6 * 4 * 6 * 6, index + 66464);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6, product* 6 * 9 * 4 * 6 * 6, index + 66496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6, product* 4 * 2 * 6 * 6 * 6, index + 66624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6, product* 8 * 8 * 6 * 6 * 6, index + 66688);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6, product* 4 * 8 * 7 * 6 * 6, index + 66784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6, product* 8 * 4 * 8 * 6 * 6, index + 66848);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6, product* 4 * 4 * 9 * 6 * 6, index + 66944);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6, product* 6 * 7 * 9 * 6 * 6, index + 66976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6, product* 2 * 3 * 2 * 7 * 6, index + 67232);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6, product* 4 * 6 * 2 * 7 * 6, index + 67264);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6, product* 6 * 9 * 2 * 7 * 6, index + 67296);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6, product* 8 * 2 * 3 * 7 * 6, index + 67328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6, product* 2 * 9 * 3 * 7 * 6, index + 67392);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6, product* 4 * 2 * 4 * 7 * 6, index + 67424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6, product* 8 * 8 * 4 * 7 * 6, index + 67488);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6, product* 8 * 4 * 6 * 7 * 6, index + 67648);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 6, product* 4 * 4 * 7 * 7 * 6, index + 67744);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6, product* 6 * 7 * 7 * 7 * 6, index + 67776);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6, product* 2 * 7 * 8 * 7 * 6, index + 67872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6, product* 6 * 3 * 9 * 7 * 6, index + 67936);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 6, product* 8 * 6 * 9 * 7 * 6, index + 67968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6, product* 4 * 2 * 2 * 8 * 6, index + 68224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6, product* 8 * 8 * 2 * 8 * 6, index + 68288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6, product* 4 * 8 * 3 * 8 * 6, index + 68384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6, product* 8 * 4 * 4 * 8 * 6, index + 68448);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6, product* 2 * 7 * 6 * 8 * 6, index + 68672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6, product* 6 * 3 * 7 * 8 * 6, index + 68736);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6, product* 2 * 3 * 8 * 8 * 6, index + 68832);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6, product* 4 * 6 * 8 * 8 * 6, index + 68864);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 6, product* 6 * 9 * 8 * 8 * 6, index + 68896);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6, product* 8 * 2 * 9 * 8 * 6, index + 68928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6, product* 2 * 9 * 9 * 8 * 6, index + 68992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6, product* 8 * 4 * 2 * 9 * 6, index + 69248);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6, product* 4 * 4 * 3 * 9 * 6, index + 69344);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6, product* 6 * 7 * 3 * 9 * 6, index + 69376);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6, product* 2 * 7 * 4 * 9 * 6, index + 69472);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6, product* 2 * 3 * 6 * 9 * 6, index + 69632);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6, product* 4 * 6 * 6 * 9 * 6, index + 69664);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 6, product* 6 * 9 * 6 * 9 * 6, index + 69696);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6, product* 8 * 2 * 7 * 9 * 6, index + 69728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 6, product* 2 * 9 * 7 * 9 * 6, index + 69792);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6, product* 4 * 2 * 8 * 9 * 6, index + 69824);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 6, product* 8 * 8 * 8 * 9 * 6, index + 69888);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 6, product* 4 * 8 * 9 * 9 * 6, index + 69984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7, product* 4 * 2 * 2 * 2 * 7, index + 72224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7, product* 8 * 8 * 2 * 2 * 7, index + 72288);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7, product* 4 * 8 * 3 * 2 * 7, index + 72384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7, product* 8 * 4 * 4 * 2 * 7, index + 72448);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7, product* 2 * 7 * 6 * 2 * 7, index + 72672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7, product* 6 * 3 * 7 * 2 * 7, index + 72736);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7, product* 8 * 6 * 7 * 2 * 7, index + 72768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7, product* 2 * 3 * 8 * 2 * 7, index + 72832);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7, product* 4 * 6 * 8 * 2 * 7, index + 72864);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7, product* 6 * 9 * 8 * 2 * 7, index + 72896);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7, product* 8 * 2 * 9 * 2 * 7, index + 72928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7, product* 2 * 9 * 9 * 2 * 7, index + 72992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7, product* 8 * 4 * 2 * 3 * 7, index + 73248);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7, product* 4 * 4 * 3 * 3 * 7, index + 73344);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7, product* 6 * 7 * 3 * 3 * 7, index + 73376);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7, product* 2 * 7 * 4 * 3 * 7, index + 73472);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7, product* 2 * 3 * 6 * 3 * 7, index + 73632);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7, product* 4 * 6 * 6 * 3 * 7, index + 73664);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 7, product* 6 * 9 * 6 * 3 * 7, index + 73696);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7, product* 8 * 2 * 7 * 3 * 7, index + 73728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7, product* 2 * 9 * 7 * 3 * 7, index + 73792);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7, product* 4 * 2 * 8 * 3 * 7, index + 73824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 7, product* 8 * 8 * 8 * 3 * 7, index + 73888);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7, product* 4 * 8 * 9 * 3 * 7, index + 73984);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7, product* 2 * 7 * 2 * 4 * 7, index + 74272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7, product* 6 * 3 * 3 * 4 * 7, index + 74336);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7, product* 8 * 6 * 3 * 4 * 7, index + 74368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7, product* 2 * 3 * 4 * 4 * 7, index + 74432);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7, product* 4 * 6 * 4 * 4 * 7, index + 74464);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7, product* 6 * 9 * 4 * 4 * 7, index + 74496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7, product* 4 * 2 * 6 * 4 * 7, index + 74624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7, product* 8 * 8 * 6 * 4 * 7, index + 74688);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7, product* 4 * 8 * 7 * 4 * 7, index + 74784);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7, product* 4 * 4 * 9 * 4 * 7, index + 74944);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7, product* 6 * 7 * 9 * 4 * 7, index + 74976);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7, product* 4 * 2 * 2 * 6 * 7, index + 76224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7, product* 8 * 8 * 2 * 6 * 7, index + 76288);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7, product* 4 * 8 * 3 * 6 * 7, index + 76384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7, product* 8 * 4 * 4 * 6 * 7, index + 76448);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7, product* 2 * 7 * 6 * 6 * 7, index + 76672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7, product* 6 * 3 * 7 * 6 * 7, index + 76736);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 7, product* 8 * 6 * 7 * 6 * 7, index + 76768);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7, product* 2 * 3 * 8 * 6 * 7, index + 76832);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7, product* 4 * 6 * 8 * 6 * 7, index + 76864);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 7, product* 6 * 9 * 8 * 6 * 7, index + 76896);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7, product* 8 * 2 * 9 * 6 * 7, index + 76928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7, product* 2 * 9 * 9 * 6 * 7, index + 76992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7, product* 8 * 4 * 2 * 7 * 7, index + 77248);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7, product* 4 * 4 * 3 * 7 * 7, index + 77344);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7, product* 6 * 7 * 3 * 7 * 7, index + 77376);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7, product* 2 * 7 * 4 * 7 * 7, index + 77472);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7, product* 2 * 3 * 6 * 7 * 7, index + 77632);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 7, product* 4 * 6 * 6 * 7 * 7, index + 77664);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7, product* 6 * 9 * 6 * 7 * 7, index + 77696);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7, product* 8 * 2 * 7 * 7 * 7, index + 77728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7, product* 4 * 2 * 8 * 7 * 7, index + 77824);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7, product* 4 * 8 * 9 * 7 * 7, index + 77984);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7, product* 2 * 7 * 2 * 8 * 7, index + 78272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7, product* 6 * 3 * 3 * 8 * 7, index + 78336);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7, product* 8 * 6 * 3 * 8 * 7, index + 78368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7, product* 2 * 3 * 4 * 8 * 7, index + 78432);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7, product* 4 * 6 * 4 * 8 * 7, index + 78464);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7, product* 6 * 9 * 4 * 8 * 7, index + 78496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7, product* 4 * 2 * 6 * 8 * 7, index + 78624);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7, product* 4 * 8 * 7 * 8 * 7, index + 78784);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 7, product* 8 * 4 * 8 * 8 * 7, index + 78848);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7, product* 4 * 4 * 9 * 8 * 7, index + 78944);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7, product* 6 * 7 * 9 * 8 * 7, index + 78976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7, product* 2 * 3 * 2 * 9 * 7, index + 79232);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7, product* 4 * 6 * 2 * 9 * 7, index + 79264);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7, product* 6 * 9 * 2 * 9 * 7, index + 79296);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7, product* 8 * 2 * 3 * 9 * 7, index + 79328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7, product* 2 * 9 * 3 * 9 * 7, index + 79392);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7, product* 4 * 2 * 4 * 9 * 7, index + 79424);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7, product* 8 * 8 * 4 * 9 * 7, index + 79488);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 7, product* 8 * 4 * 6 * 9 * 7, index + 79648);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7, product* 4 * 4 * 7 * 9 * 7, index + 79744);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 7, product* 6 * 7 * 7 * 9 * 7, index + 79776);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7, product* 2 * 7 * 8 * 9 * 7, index + 79872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7, product* 6 * 3 * 9 * 9 * 7, index + 79936);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8, product* 2 * 7 * 2 * 2 * 8, index + 82272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8, product* 6 * 3 * 3 * 2 * 8, index + 82336);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8, product* 8 * 6 * 3 * 2 * 8, index + 82368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8, product* 2 * 3 * 4 * 2 * 8, index + 82432);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8, product* 4 * 6 * 4 * 2 * 8, index + 82464);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8, product* 6 * 9 * 4 * 2 * 8, index + 82496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8, product* 4 * 2 * 6 * 2 * 8, index + 82624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8, product* 8 * 8 * 6 * 2 * 8, index + 82688);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8, product* 4 * 8 * 7 * 2 * 8, index + 82784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8, product* 8 * 4 * 8 * 2 * 8, index + 82848);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8, product* 4 * 4 * 9 * 2 * 8, index + 82944);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 8, product* 6 * 7 * 9 * 2 * 8, index + 82976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8, product* 2 * 3 * 2 * 3 * 8, index + 83232);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8, product* 4 * 6 * 2 * 3 * 8, index + 83264);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8, product* 6 * 9 * 2 * 3 * 8, index + 83296);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8, product* 8 * 2 * 3 * 3 * 8, index + 83328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8, product* 2 * 9 * 3 * 3 * 8, index + 83392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8, product* 4 * 2 * 4 * 3 * 8, index + 83424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8, product* 8 * 8 * 4 * 3 * 8, index + 83488);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8, product* 8 * 4 * 6 * 3 * 8, index + 83648);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8, product* 4 * 4 * 7 * 3 * 8, index + 83744);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8, product* 6 * 7 * 7 * 3 * 8, index + 83776);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8, product* 2 * 7 * 8 * 3 * 8, index + 83872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8, product* 6 * 3 * 9 * 3 * 8, index + 83936);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8, product* 8 * 6 * 9 * 3 * 8, index + 83968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8, product* 4 * 2 * 2 * 4 * 8, index + 84224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8, product* 8 * 8 * 2 * 4 * 8, index + 84288);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8, product* 4 * 8 * 3 * 4 * 8, index + 84384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8, product* 8 * 4 * 4 * 4 * 8, index + 84448);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8, product* 2 * 7 * 6 * 4 * 8, index + 84672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8, product* 6 * 3 * 7 * 4 * 8, index + 84736);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 8, product* 8 * 6 * 7 * 4 * 8, index + 84768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8, product* 2 * 3 * 8 * 4 * 8, index + 84832);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8, product* 4 * 6 * 8 * 4 * 8, index + 84864);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 8, product* 6 * 9 * 8 * 4 * 8, index + 84896);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8, product* 8 * 2 * 9 * 4 * 8, index + 84928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8, product* 2 * 9 * 9 * 4 * 8, index + 84992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8, product* 2 * 7 * 2 * 6 * 8, index + 86272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8, product* 6 * 3 * 3 * 6 * 8, index + 86336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8, product* 2 * 3 * 4 * 6 * 8, index + 86432);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8, product* 4 * 6 * 4 * 6 * 8, index + 86464);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8, product* 6 * 9 * 4 * 6 * 8, index + 86496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8, product* 4 * 2 * 6 * 6 * 8, index + 86624);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 8, product* 4 * 8 * 7 * 6 * 8, index + 86784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8, product* 8 * 4 * 8 * 6 * 8, index + 86848);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8, product* 4 * 4 * 9 * 6 * 8, index + 86944);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 8, product* 6 * 7 * 9 * 6 * 8, index + 86976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8, product* 2 * 3 * 2 * 7 * 8, index + 87232);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8, product* 4 * 6 * 2 * 7 * 8, index + 87264);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8, product* 6 * 9 * 2 * 7 * 8, index + 87296);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8, product* 8 * 2 * 3 * 7 * 8, index + 87328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8, product* 2 * 9 * 3 * 7 * 8, index + 87392);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8, product* 4 * 2 * 4 * 7 * 8, index + 87424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 8, product* 8 * 8 * 4 * 7 * 8, index + 87488);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8, product* 8 * 4 * 6 * 7 * 8, index + 87648);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8, product* 4 * 4 * 7 * 7 * 8, index + 87744);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 8, product* 6 * 7 * 7 * 7 * 8, index + 87776);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8, product* 2 * 7 * 8 * 7 * 8, index + 87872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8, product* 6 * 3 * 9 * 7 * 8, index + 87936);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8, product* 4 * 2 * 2 * 8 * 8, index + 88224);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8, product* 4 * 8 * 3 * 8 * 8, index + 88384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8, product* 8 * 4 * 4 * 8 * 8, index + 88448);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8, product* 2 * 7 * 6 * 8 * 8, index + 88672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 8, product* 6 * 3 * 7 * 8 * 8, index + 88736);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8, product* 8 * 6 * 7 * 8 * 8, index + 88768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8, product* 2 * 3 * 8 * 8 * 8, index + 88832);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8, product* 4 * 6 * 8 * 8 * 8, index + 88864);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8, product* 6 * 9 * 8 * 8 * 8, index + 88896);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8, product* 2 * 9 * 9 * 8 * 8, index + 88992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8, product* 8 * 4 * 2 * 9 * 8, index + 89248);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8, product* 4 * 4 * 3 * 9 * 8, index + 89344);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 8, product* 6 * 7 * 3 * 9 * 8, index + 89376);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8, product* 2 * 7 * 4 * 9 * 8, index + 89472);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8, product* 2 * 3 * 6 * 9 * 8, index + 89632);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8, product* 4 * 6 * 6 * 9 * 8, index + 89664);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 8, product* 6 * 9 * 6 * 9 * 8, index + 89696);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8, product* 8 * 2 * 7 * 9 * 8, index + 89728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8, product* 2 * 9 * 7 * 9 * 8, index + 89792);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8, product* 4 * 2 * 8 * 9 * 8, index + 89824);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8, product* 4 * 8 * 9 * 9 * 8, index + 89984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9, product* 4 * 2 * 2 * 2 * 9, index + 92224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9, product* 8 * 8 * 2 * 2 * 9, index + 92288);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9, product* 4 * 8 * 3 * 2 * 9, index + 92384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9, product* 8 * 4 * 4 * 2 * 9, index + 92448);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9, product* 2 * 7 * 6 * 2 * 9, index + 92672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9, product* 6 * 3 * 7 * 2 * 9, index + 92736);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9, product* 8 * 6 * 7 * 2 * 9, index + 92768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9, product* 2 * 3 * 8 * 2 * 9, index + 92832);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9, product* 4 * 6 * 8 * 2 * 9, index + 92864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9, product* 8 * 2 * 9 * 2 * 9, index + 92928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9, product* 2 * 9 * 9 * 2 * 9, index + 92992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9, product* 8 * 4 * 2 * 3 * 9, index + 93248);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9, product* 4 * 4 * 3 * 3 * 9, index + 93344);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9, product* 6 * 7 * 3 * 3 * 9, index + 93376);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 9, product* 2 * 9 * 3 * 3 * 9, index + 93392);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9, product* 2 * 7 * 4 * 3 * 9, index + 93472);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9, product* 2 * 3 * 6 * 3 * 9, index + 93632);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9, product* 4 * 6 * 6 * 3 * 9, index + 93664);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9, product* 6 * 9 * 6 * 3 * 9, index + 93696);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9, product* 8 * 2 * 7 * 3 * 9, index + 93728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9, product* 2 * 9 * 7 * 3 * 9, index + 93792);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9, product* 4 * 2 * 8 * 3 * 9, index + 93824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9, product* 8 * 8 * 8 * 3 * 9, index + 93888);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9, product* 4 * 8 * 9 * 3 * 9, index + 93984);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9, product* 2 * 7 * 2 * 4 * 9, index + 94272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9, product* 6 * 3 * 3 * 4 * 9, index + 94336);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9, product* 8 * 6 * 3 * 4 * 9, index + 94368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9, product* 2 * 3 * 4 * 4 * 9, index + 94432);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9, product* 4 * 6 * 4 * 4 * 9, index + 94464);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9, product* 6 * 9 * 4 * 4 * 9, index + 94496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9, product* 4 * 2 * 6 * 4 * 9, index + 94624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9, product* 8 * 8 * 6 * 4 * 9, index + 94688);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9, product* 4 * 8 * 7 * 4 * 9, index + 94784);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9, product* 8 * 4 * 8 * 4 * 9, index + 94848);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9, product* 4 * 4 * 9 * 4 * 9, index + 94944);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9, product* 6 * 7 * 9 * 4 * 9, index + 94976);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9, product* 4 * 2 * 2 * 6 * 9, index + 96224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9, product* 8 * 8 * 2 * 6 * 9, index + 96288);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9, product* 4 * 8 * 3 * 6 * 9, index + 96384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9, product* 8 * 4 * 4 * 6 * 9, index + 96448);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9, product* 2 * 7 * 6 * 6 * 9, index + 96672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9, product* 6 * 3 * 7 * 6 * 9, index + 96736);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 9, product* 8 * 6 * 7 * 6 * 9, index + 96768);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9, product* 2 * 3 * 8 * 6 * 9, index + 96832);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 9, product* 4 * 6 * 8 * 6 * 9, index + 96864);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 9, product* 6 * 9 * 8 * 6 * 9, index + 96896);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9, product* 8 * 2 * 9 * 6 * 9, index + 96928);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9, product* 8 * 4 * 2 * 7 * 9, index + 97248);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9, product* 4 * 4 * 3 * 7 * 9, index + 97344);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9, product* 6 * 7 * 3 * 7 * 9, index + 97376);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9, product* 2 * 7 * 4 * 7 * 9, index + 97472);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9, product* 2 * 3 * 6 * 7 * 9, index + 97632);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9, product* 4 * 6 * 6 * 7 * 9, index + 97664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9, product* 8 * 2 * 7 * 7 * 9, index + 97728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9, product* 2 * 9 * 7 * 7 * 9, index + 97792);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9, product* 4 * 2 * 8 * 7 * 9, index + 97824);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9, product* 4 * 8 * 9 * 7 * 9, index + 97984);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9, product* 2 * 7 * 2 * 8 * 9, index + 98272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9, product* 6 * 3 * 3 * 8 * 9, index + 98336);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9, product* 8 * 6 * 3 * 8 * 9, index + 98368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9, product* 2 * 3 * 4 * 8 * 9, index + 98432);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9, product* 4 * 6 * 4 * 8 * 9, index + 98464);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9, product* 6 * 9 * 4 * 8 * 9, index + 98496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9, product* 4 * 2 * 6 * 8 * 9, index + 98624);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 9, product* 8 * 4 * 8 * 8 * 9, index + 98848);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9, product* 4 * 4 * 9 * 8 * 9, index + 98944);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 9, product* 6 * 7 * 9 * 8 * 9, index + 98976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9, product* 2 * 3 * 2 * 9 * 9, index + 99232);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9, product* 4 * 6 * 2 * 9 * 9, index + 99264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9, product* 8 * 2 * 3 * 9 * 9, index + 99328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9, product* 2 * 9 * 3 * 9 * 9, index + 99392);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9, product* 4 * 2 * 4 * 9 * 9, index + 99424);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9, product* 8 * 4 * 6 * 9 * 9, index + 99648);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9, product* 4 * 4 * 7 * 9 * 9, index + 99744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 9, product* 2 * 7 * 8 * 9 * 9, index + 99872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 9, product* 6 * 3 * 9 * 9 * 9, index + 99936);
@@ -1,1666 +0,0 @@
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2, product* 2 * 7 * 2 * 2 * 2 * 2, index + 222272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2, product* 6 * 3 * 3 * 2 * 2 * 2, index + 222336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2, product* 4 * 6 * 4 * 2 * 2 * 2, index + 222464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2, product* 4 * 8 * 7 * 2 * 2 * 2, index + 222784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2, product* 8 * 4 * 8 * 2 * 2 * 2, index + 222848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2, product* 6 * 7 * 9 * 2 * 2 * 2, index + 222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2, product* 2 * 3 * 2 * 3 * 2 * 2, index + 223232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2, product* 6 * 9 * 2 * 3 * 2 * 2, index + 223296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2, product* 4 * 2 * 4 * 3 * 2 * 2, index + 223424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2, product* 8 * 8 * 4 * 3 * 2 * 2, index + 223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2, product* 4 * 4 * 7 * 3 * 2 * 2, index + 223744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2, product* 2 * 7 * 8 * 3 * 2 * 2, index + 223872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2, product* 6 * 3 * 9 * 3 * 2 * 2, index + 223936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2, product* 4 * 8 * 3 * 4 * 2 * 2, index + 224384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2, product* 8 * 4 * 4 * 4 * 2 * 2, index + 224448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2, product* 8 * 6 * 7 * 4 * 2 * 2, index + 224768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2, product* 2 * 3 * 8 * 4 * 2 * 2, index + 224832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2, product* 6 * 9 * 8 * 4 * 2 * 2, index + 224896);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2, product* 8 * 6 * 3 * 6 * 2 * 2, index + 226368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2, product* 2 * 3 * 4 * 6 * 2 * 2, index + 226432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 2, product* 6 * 9 * 4 * 6 * 2 * 2, index + 226496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2, product* 4 * 2 * 6 * 6 * 2 * 2, index + 226624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 2, product* 8 * 8 * 6 * 6 * 2 * 2, index + 226688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2, product* 4 * 4 * 9 * 6 * 2 * 2, index + 226944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2, product* 4 * 6 * 2 * 7 * 2 * 2, index + 227264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2, product* 8 * 2 * 3 * 7 * 2 * 2, index + 227328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2, product* 2 * 9 * 3 * 7 * 2 * 2, index + 227392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2, product* 8 * 4 * 6 * 7 * 2 * 2, index + 227648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 2, product* 6 * 7 * 7 * 7 * 2 * 2, index + 227776);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 2, product* 8 * 6 * 9 * 7 * 2 * 2, index + 227968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2, product* 4 * 2 * 2 * 8 * 2 * 2, index + 228224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2, product* 8 * 8 * 2 * 8 * 2 * 2, index + 228288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2, product* 2 * 7 * 6 * 8 * 2 * 2, index + 228672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2, product* 6 * 3 * 7 * 8 * 2 * 2, index + 228736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2, product* 4 * 6 * 8 * 8 * 2 * 2, index + 228864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2, product* 8 * 2 * 9 * 8 * 2 * 2, index + 228928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2, product* 2 * 9 * 9 * 8 * 2 * 2, index + 228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2, product* 8 * 4 * 2 * 9 * 2 * 2, index + 229248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2, product* 6 * 7 * 3 * 9 * 2 * 2, index + 229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2, product* 2 * 3 * 6 * 9 * 2 * 2, index + 229632);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 2, product* 6 * 9 * 6 * 9 * 2 * 2, index + 229696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2, product* 4 * 2 * 8 * 9 * 2 * 2, index + 229824);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 2 + 2, product* 8 * 8 * 8 * 9 * 2 * 2, index + 229888);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2, product* 4 * 8 * 3 * 2 * 3 * 2, index + 232384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2, product* 8 * 4 * 4 * 2 * 3 * 2, index + 232448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2, product* 8 * 6 * 7 * 2 * 3 * 2, index + 232768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2, product* 2 * 3 * 8 * 2 * 3 * 2, index + 232832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 2, product* 6 * 9 * 8 * 2 * 3 * 2, index + 232896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2, product* 4 * 4 * 3 * 3 * 3 * 2, index + 233344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2, product* 2 * 7 * 4 * 3 * 3 * 2, index + 233472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2, product* 4 * 6 * 6 * 3 * 3 * 2, index + 233664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2, product* 8 * 2 * 7 * 3 * 3 * 2, index + 233728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2, product* 2 * 9 * 7 * 3 * 3 * 2, index + 233792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2, product* 4 * 8 * 9 * 3 * 3 * 2, index + 233984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2, product* 8 * 6 * 3 * 4 * 3 * 2, index + 234368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2, product* 2 * 3 * 4 * 4 * 3 * 2, index + 234432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2, product* 6 * 9 * 4 * 4 * 3 * 2, index + 234496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2, product* 4 * 2 * 6 * 4 * 3 * 2, index + 234624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 2, product* 8 * 8 * 6 * 4 * 3 * 2, index + 234688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2, product* 4 * 4 * 9 * 4 * 3 * 2, index + 234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2, product* 4 * 2 * 2 * 6 * 3 * 2, index + 236224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2, product* 8 * 8 * 2 * 6 * 3 * 2, index + 236288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2, product* 2 * 7 * 6 * 6 * 3 * 2, index + 236672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 2, product* 6 * 3 * 7 * 6 * 3 * 2, index + 236736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2, product* 4 * 6 * 8 * 6 * 3 * 2, index + 236864);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2, product* 8 * 2 * 9 * 6 * 3 * 2, index + 236928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 2, product* 2 * 9 * 9 * 6 * 3 * 2, index + 236992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2, product* 8 * 4 * 2 * 7 * 3 * 2, index + 237248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2, product* 6 * 7 * 3 * 7 * 3 * 2, index + 237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2, product* 2 * 3 * 6 * 7 * 3 * 2, index + 237632);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2, product* 6 * 9 * 6 * 7 * 3 * 2, index + 237696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2, product* 4 * 2 * 8 * 7 * 3 * 2, index + 237824);
-body<0>(stream, sum+ 8 + 8 + 8 + 7 + 3 + 2, product* 8 * 8 * 8 * 7 * 3 * 2, index + 237888);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2, product* 2 * 7 * 2 * 8 * 3 * 2, index + 238272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2, product* 6 * 3 * 3 * 8 * 3 * 2, index + 238336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2, product* 4 * 6 * 4 * 8 * 3 * 2, index + 238464);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 2, product* 4 * 8 * 7 * 8 * 3 * 2, index + 238784);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 2, product* 8 * 4 * 8 * 8 * 3 * 2, index + 238848);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2, product* 6 * 7 * 9 * 8 * 3 * 2, index + 238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2, product* 2 * 3 * 2 * 9 * 3 * 2, index + 239232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 2, product* 6 * 9 * 2 * 9 * 3 * 2, index + 239296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2, product* 4 * 2 * 4 * 9 * 3 * 2, index + 239424);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2, product* 8 * 8 * 4 * 9 * 3 * 2, index + 239488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2, product* 4 * 4 * 7 * 9 * 3 * 2, index + 239744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2, product* 2 * 7 * 8 * 9 * 3 * 2, index + 239872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2, product* 6 * 3 * 9 * 9 * 3 * 2, index + 239936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2, product* 8 * 6 * 3 * 2 * 4 * 2, index + 242368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2, product* 2 * 3 * 4 * 2 * 4 * 2, index + 242432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2, product* 6 * 9 * 4 * 2 * 4 * 2, index + 242496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2, product* 4 * 2 * 6 * 2 * 4 * 2, index + 242624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2, product* 8 * 8 * 6 * 2 * 4 * 2, index + 242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2, product* 4 * 4 * 9 * 2 * 4 * 2, index + 242944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2, product* 4 * 6 * 2 * 3 * 4 * 2, index + 243264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2, product* 8 * 2 * 3 * 3 * 4 * 2, index + 243328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2, product* 2 * 9 * 3 * 3 * 4 * 2, index + 243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2, product* 8 * 4 * 6 * 3 * 4 * 2, index + 243648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2, product* 6 * 7 * 7 * 3 * 4 * 2, index + 243776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 2, product* 8 * 6 * 9 * 3 * 4 * 2, index + 243968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2, product* 4 * 2 * 2 * 4 * 4 * 2, index + 244224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2, product* 8 * 8 * 2 * 4 * 4 * 2, index + 244288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2, product* 2 * 7 * 6 * 4 * 4 * 2, index + 244672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2, product* 6 * 3 * 7 * 4 * 4 * 2, index + 244736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2, product* 4 * 6 * 8 * 4 * 4 * 2, index + 244864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 2, product* 8 * 2 * 9 * 4 * 4 * 2, index + 244928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2, product* 2 * 9 * 9 * 4 * 4 * 2, index + 244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2, product* 2 * 7 * 2 * 6 * 4 * 2, index + 246272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2, product* 6 * 3 * 3 * 6 * 4 * 2, index + 246336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 2, product* 4 * 6 * 4 * 6 * 4 * 2, index + 246464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 2, product* 4 * 8 * 7 * 6 * 4 * 2, index + 246784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 2, product* 8 * 4 * 8 * 6 * 4 * 2, index + 246848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2, product* 2 * 3 * 2 * 7 * 4 * 2, index + 247232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2, product* 6 * 9 * 2 * 7 * 4 * 2, index + 247296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2, product* 4 * 2 * 4 * 7 * 4 * 2, index + 247424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 2, product* 8 * 8 * 4 * 7 * 4 * 2, index + 247488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 2, product* 4 * 4 * 7 * 7 * 4 * 2, index + 247744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 2, product* 2 * 7 * 8 * 7 * 4 * 2, index + 247872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2, product* 6 * 3 * 9 * 7 * 4 * 2, index + 247936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2, product* 4 * 8 * 3 * 8 * 4 * 2, index + 248384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 2, product* 8 * 4 * 4 * 8 * 4 * 2, index + 248448);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 2, product* 8 * 6 * 7 * 8 * 4 * 2, index + 248768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2, product* 2 * 3 * 8 * 8 * 4 * 2, index + 248832);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4 + 2, product* 6 * 9 * 8 * 8 * 4 * 2, index + 248896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2, product* 4 * 4 * 3 * 9 * 4 * 2, index + 249344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2, product* 2 * 7 * 4 * 9 * 4 * 2, index + 249472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 2, product* 4 * 6 * 6 * 9 * 4 * 2, index + 249664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2, product* 8 * 2 * 7 * 9 * 4 * 2, index + 249728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 2, product* 2 * 9 * 7 * 9 * 4 * 2, index + 249792);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 2, product* 4 * 8 * 9 * 9 * 4 * 2, index + 249984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2, product* 2 * 7 * 2 * 2 * 6 * 2, index + 262272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2, product* 6 * 3 * 3 * 2 * 6 * 2, index + 262336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2, product* 4 * 6 * 4 * 2 * 6 * 2, index + 262464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2, product* 4 * 8 * 7 * 2 * 6 * 2, index + 262784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2, product* 8 * 4 * 8 * 2 * 6 * 2, index + 262848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 2, product* 6 * 7 * 9 * 2 * 6 * 2, index + 262976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2, product* 2 * 3 * 2 * 3 * 6 * 2, index + 263232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2, product* 6 * 9 * 2 * 3 * 6 * 2, index + 263296);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 2, product* 2 * 9 * 3 * 3 * 6 * 2, index + 263392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2, product* 4 * 2 * 4 * 3 * 6 * 2, index + 263424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2, product* 8 * 8 * 4 * 3 * 6 * 2, index + 263488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 2, product* 4 * 4 * 7 * 3 * 6 * 2, index + 263744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2, product* 2 * 7 * 8 * 3 * 6 * 2, index + 263872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2, product* 6 * 3 * 9 * 3 * 6 * 2, index + 263936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2, product* 4 * 8 * 3 * 4 * 6 * 2, index + 264384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2, product* 8 * 4 * 4 * 4 * 6 * 2, index + 264448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 2, product* 8 * 6 * 7 * 4 * 6 * 2, index + 264768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2, product* 2 * 3 * 8 * 4 * 6 * 2, index + 264832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6 + 2, product* 6 * 9 * 8 * 4 * 6 * 2, index + 264896);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 2, product* 8 * 6 * 3 * 6 * 6 * 2, index + 266368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2, product* 2 * 3 * 4 * 6 * 6 * 2, index + 266432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 2, product* 6 * 9 * 4 * 6 * 6 * 2, index + 266496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2, product* 4 * 2 * 6 * 6 * 6 * 2, index + 266624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 2, product* 8 * 8 * 6 * 6 * 6 * 2, index + 266688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 2, product* 4 * 4 * 9 * 6 * 6 * 2, index + 266944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2, product* 4 * 6 * 2 * 7 * 6 * 2, index + 267264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2, product* 8 * 2 * 3 * 7 * 6 * 2, index + 267328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2, product* 2 * 9 * 3 * 7 * 6 * 2, index + 267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2, product* 8 * 4 * 6 * 7 * 6 * 2, index + 267648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 2, product* 6 * 7 * 7 * 7 * 6 * 2, index + 267776);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 6 + 2, product* 8 * 6 * 9 * 7 * 6 * 2, index + 267968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2, product* 4 * 2 * 2 * 8 * 6 * 2, index + 268224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 2, product* 8 * 8 * 2 * 8 * 6 * 2, index + 268288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2, product* 2 * 7 * 6 * 8 * 6 * 2, index + 268672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 2, product* 6 * 3 * 7 * 8 * 6 * 2, index + 268736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 2, product* 4 * 6 * 8 * 8 * 6 * 2, index + 268864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2, product* 8 * 2 * 9 * 8 * 6 * 2, index + 268928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 2, product* 2 * 9 * 9 * 8 * 6 * 2, index + 268992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 2, product* 8 * 4 * 2 * 9 * 6 * 2, index + 269248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 2, product* 6 * 7 * 3 * 9 * 6 * 2, index + 269376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2, product* 2 * 3 * 6 * 9 * 6 * 2, index + 269632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2, product* 4 * 2 * 8 * 9 * 6 * 2, index + 269824);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 6 + 2, product* 8 * 8 * 8 * 9 * 6 * 2, index + 269888);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2, product* 4 * 8 * 3 * 2 * 7 * 2, index + 272384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2, product* 8 * 4 * 4 * 2 * 7 * 2, index + 272448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2, product* 8 * 6 * 7 * 2 * 7 * 2, index + 272768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2, product* 2 * 3 * 8 * 2 * 7 * 2, index + 272832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2, product* 6 * 9 * 8 * 2 * 7 * 2, index + 272896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2, product* 4 * 4 * 3 * 3 * 7 * 2, index + 273344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2, product* 2 * 7 * 4 * 3 * 7 * 2, index + 273472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2, product* 4 * 6 * 6 * 3 * 7 * 2, index + 273664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2, product* 8 * 2 * 7 * 3 * 7 * 2, index + 273728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2, product* 2 * 9 * 7 * 3 * 7 * 2, index + 273792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2, product* 4 * 8 * 9 * 3 * 7 * 2, index + 273984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2, product* 8 * 6 * 3 * 4 * 7 * 2, index + 274368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2, product* 2 * 3 * 4 * 4 * 7 * 2, index + 274432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2, product* 6 * 9 * 4 * 4 * 7 * 2, index + 274496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2, product* 4 * 2 * 6 * 4 * 7 * 2, index + 274624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 2, product* 8 * 8 * 6 * 4 * 7 * 2, index + 274688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2, product* 4 * 4 * 9 * 4 * 7 * 2, index + 274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2, product* 4 * 2 * 2 * 6 * 7 * 2, index + 276224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 2, product* 8 * 8 * 2 * 6 * 7 * 2, index + 276288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2, product* 2 * 7 * 6 * 6 * 7 * 2, index + 276672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 2, product* 6 * 3 * 7 * 6 * 7 * 2, index + 276736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 2, product* 4 * 6 * 8 * 6 * 7 * 2, index + 276864);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 2, product* 8 * 2 * 9 * 6 * 7 * 2, index + 276928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 2, product* 2 * 9 * 9 * 6 * 7 * 2, index + 276992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2, product* 8 * 4 * 2 * 7 * 7 * 2, index + 277248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 2, product* 6 * 7 * 3 * 7 * 7 * 2, index + 277376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2, product* 2 * 3 * 6 * 7 * 7 * 2, index + 277632);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 2, product* 6 * 9 * 6 * 7 * 7 * 2, index + 277696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2, product* 4 * 2 * 8 * 7 * 7 * 2, index + 277824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2, product* 2 * 7 * 2 * 8 * 7 * 2, index + 278272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2, product* 6 * 3 * 3 * 8 * 7 * 2, index + 278336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 2, product* 4 * 6 * 4 * 8 * 7 * 2, index + 278464);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 2, product* 4 * 8 * 7 * 8 * 7 * 2, index + 278784);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 2, product* 6 * 7 * 9 * 8 * 7 * 2, index + 278976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2, product* 2 * 3 * 2 * 9 * 7 * 2, index + 279232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 2, product* 6 * 9 * 2 * 9 * 7 * 2, index + 279296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2, product* 4 * 2 * 4 * 9 * 7 * 2, index + 279424);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7 + 2, product* 8 * 8 * 4 * 9 * 7 * 2, index + 279488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 2, product* 4 * 4 * 7 * 9 * 7 * 2, index + 279744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7 + 2, product* 2 * 7 * 8 * 9 * 7 * 2, index + 279872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 2, product* 6 * 3 * 9 * 9 * 7 * 2, index + 279936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2, product* 8 * 6 * 3 * 2 * 8 * 2, index + 282368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2, product* 2 * 3 * 4 * 2 * 8 * 2, index + 282432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2, product* 6 * 9 * 4 * 2 * 8 * 2, index + 282496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2, product* 4 * 2 * 6 * 2 * 8 * 2, index + 282624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 2, product* 8 * 8 * 6 * 2 * 8 * 2, index + 282688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2, product* 4 * 4 * 9 * 2 * 8 * 2, index + 282944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2, product* 4 * 6 * 2 * 3 * 8 * 2, index + 283264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2, product* 8 * 2 * 3 * 3 * 8 * 2, index + 283328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2, product* 2 * 9 * 3 * 3 * 8 * 2, index + 283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2, product* 8 * 4 * 6 * 3 * 8 * 2, index + 283648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 2, product* 6 * 7 * 7 * 3 * 8 * 2, index + 283776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 2, product* 8 * 6 * 9 * 3 * 8 * 2, index + 283968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2, product* 4 * 2 * 2 * 4 * 8 * 2, index + 284224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2, product* 8 * 8 * 2 * 4 * 8 * 2, index + 284288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2, product* 2 * 7 * 6 * 4 * 8 * 2, index + 284672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2, product* 6 * 3 * 7 * 4 * 8 * 2, index + 284736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 2, product* 4 * 6 * 8 * 4 * 8 * 2, index + 284864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2, product* 8 * 2 * 9 * 4 * 8 * 2, index + 284928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 2, product* 2 * 9 * 9 * 4 * 8 * 2, index + 284992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2, product* 2 * 7 * 2 * 6 * 8 * 2, index + 286272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2, product* 6 * 3 * 3 * 6 * 8 * 2, index + 286336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2, product* 4 * 6 * 4 * 6 * 8 * 2, index + 286464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 8 + 2, product* 4 * 8 * 7 * 6 * 8 * 2, index + 286784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 2, product* 8 * 4 * 8 * 6 * 8 * 2, index + 286848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 8 + 2, product* 6 * 7 * 9 * 6 * 8 * 2, index + 286976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2, product* 2 * 3 * 2 * 7 * 8 * 2, index + 287232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 2, product* 6 * 9 * 2 * 7 * 8 * 2, index + 287296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2, product* 4 * 2 * 4 * 7 * 8 * 2, index + 287424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 8 + 2, product* 8 * 8 * 4 * 7 * 8 * 2, index + 287488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 2, product* 4 * 4 * 7 * 7 * 8 * 2, index + 287744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 2, product* 2 * 7 * 8 * 7 * 8 * 2, index + 287872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8 + 2, product* 6 * 3 * 9 * 7 * 8 * 2, index + 287936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2, product* 4 * 8 * 3 * 8 * 8 * 2, index + 288384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 2, product* 8 * 4 * 4 * 8 * 8 * 2, index + 288448);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8 + 2, product* 8 * 6 * 7 * 8 * 8 * 2, index + 288768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2, product* 2 * 3 * 8 * 8 * 8 * 2, index + 288832);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8 + 2, product* 6 * 9 * 8 * 8 * 8 * 2, index + 288896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 2, product* 4 * 4 * 3 * 9 * 8 * 2, index + 289344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 2, product* 2 * 7 * 4 * 9 * 8 * 2, index + 289472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2, product* 4 * 6 * 6 * 9 * 8 * 2, index + 289664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 2, product* 8 * 2 * 7 * 9 * 8 * 2, index + 289728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 2, product* 2 * 9 * 7 * 9 * 8 * 2, index + 289792);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8 + 2, product* 4 * 8 * 9 * 9 * 8 * 2, index + 289984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2, product* 4 * 2 * 2 * 2 * 9 * 2, index + 292224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2, product* 8 * 8 * 2 * 2 * 9 * 2, index + 292288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2, product* 2 * 7 * 6 * 2 * 9 * 2, index + 292672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2, product* 6 * 3 * 7 * 2 * 9 * 2, index + 292736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2, product* 4 * 6 * 8 * 2 * 9 * 2, index + 292864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 2, product* 8 * 2 * 9 * 2 * 9 * 2, index + 292928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2, product* 2 * 9 * 9 * 2 * 9 * 2, index + 292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2, product* 8 * 4 * 2 * 3 * 9 * 2, index + 293248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2, product* 6 * 7 * 3 * 3 * 9 * 2, index + 293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2, product* 2 * 3 * 6 * 3 * 9 * 2, index + 293632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 2, product* 6 * 9 * 6 * 3 * 9 * 2, index + 293696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2, product* 4 * 2 * 8 * 3 * 9 * 2, index + 293824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2, product* 8 * 8 * 8 * 3 * 9 * 2, index + 293888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2, product* 2 * 7 * 2 * 4 * 9 * 2, index + 294272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 2, product* 6 * 3 * 3 * 4 * 9 * 2, index + 294336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2, product* 4 * 6 * 4 * 4 * 9 * 2, index + 294464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2, product* 4 * 8 * 7 * 4 * 9 * 2, index + 294784);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 2, product* 8 * 4 * 8 * 4 * 9 * 2, index + 294848);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9 + 2, product* 8 * 4 * 4 * 6 * 9 * 2, index + 296448);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 9 + 2, product* 8 * 6 * 7 * 6 * 9 * 2, index + 296768);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2, product* 2 * 3 * 8 * 6 * 9 * 2, index + 296832);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 9 + 2, product* 6 * 9 * 8 * 6 * 9 * 2, index + 296896);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2, product* 4 * 4 * 3 * 7 * 9 * 2, index + 297344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2, product* 2 * 7 * 4 * 7 * 9 * 2, index + 297472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 2, product* 4 * 6 * 6 * 7 * 9 * 2, index + 297664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 2, product* 8 * 2 * 7 * 7 * 9 * 2, index + 297728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 2, product* 2 * 9 * 7 * 7 * 9 * 2, index + 297792);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9 + 2, product* 4 * 8 * 9 * 7 * 9 * 2, index + 297984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2, product* 8 * 6 * 3 * 8 * 9 * 2, index + 298368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2, product* 2 * 3 * 4 * 8 * 9 * 2, index + 298432);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 2, product* 6 * 9 * 4 * 8 * 9 * 2, index + 298496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2, product* 4 * 2 * 6 * 8 * 9 * 2, index + 298624);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 2, product* 4 * 4 * 9 * 8 * 9 * 2, index + 298944);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 2, product* 4 * 6 * 2 * 9 * 9 * 2, index + 299264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 2, product* 8 * 2 * 3 * 9 * 9 * 2, index + 299328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2, product* 2 * 9 * 3 * 9 * 9 * 2, index + 299392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9 + 2, product* 8 * 4 * 6 * 9 * 9 * 2, index + 299648);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3, product* 8 * 6 * 3 * 2 * 2 * 3, index + 322368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3, product* 2 * 3 * 4 * 2 * 2 * 3, index + 322432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3, product* 6 * 9 * 4 * 2 * 2 * 3, index + 322496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3, product* 4 * 2 * 6 * 2 * 2 * 3, index + 322624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3, product* 8 * 8 * 6 * 2 * 2 * 3, index + 322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3, product* 4 * 4 * 9 * 2 * 2 * 3, index + 322944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3, product* 4 * 6 * 2 * 3 * 2 * 3, index + 323264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3, product* 8 * 2 * 3 * 3 * 2 * 3, index + 323328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3, product* 2 * 9 * 3 * 3 * 2 * 3, index + 323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3, product* 8 * 4 * 6 * 3 * 2 * 3, index + 323648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3, product* 6 * 7 * 7 * 3 * 2 * 3, index + 323776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3, product* 8 * 6 * 9 * 3 * 2 * 3, index + 323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3, product* 4 * 2 * 2 * 4 * 2 * 3, index + 324224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3, product* 8 * 8 * 2 * 4 * 2 * 3, index + 324288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3, product* 2 * 7 * 6 * 4 * 2 * 3, index + 324672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3, product* 6 * 3 * 7 * 4 * 2 * 3, index + 324736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3, product* 4 * 6 * 8 * 4 * 2 * 3, index + 324864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3, product* 8 * 2 * 9 * 4 * 2 * 3, index + 324928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3, product* 2 * 9 * 9 * 4 * 2 * 3, index + 324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3, product* 2 * 7 * 2 * 6 * 2 * 3, index + 326272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3, product* 6 * 3 * 3 * 6 * 2 * 3, index + 326336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3, product* 4 * 6 * 4 * 6 * 2 * 3, index + 326464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3, product* 4 * 8 * 7 * 6 * 2 * 3, index + 326784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 3, product* 8 * 4 * 8 * 6 * 2 * 3, index + 326848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 3, product* 6 * 7 * 9 * 6 * 2 * 3, index + 326976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3, product* 2 * 3 * 2 * 7 * 2 * 3, index + 327232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3, product* 6 * 9 * 2 * 7 * 2 * 3, index + 327296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3, product* 4 * 2 * 4 * 7 * 2 * 3, index + 327424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3, product* 8 * 8 * 4 * 7 * 2 * 3, index + 327488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3, product* 4 * 4 * 7 * 7 * 2 * 3, index + 327744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3, product* 2 * 7 * 8 * 7 * 2 * 3, index + 327872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3, product* 6 * 3 * 9 * 7 * 2 * 3, index + 327936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3, product* 4 * 8 * 3 * 8 * 2 * 3, index + 328384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3, product* 8 * 4 * 4 * 8 * 2 * 3, index + 328448);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3, product* 8 * 6 * 7 * 8 * 2 * 3, index + 328768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3, product* 2 * 3 * 8 * 8 * 2 * 3, index + 328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3, product* 4 * 4 * 3 * 9 * 2 * 3, index + 329344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3, product* 2 * 7 * 4 * 9 * 2 * 3, index + 329472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 3, product* 4 * 6 * 6 * 9 * 2 * 3, index + 329664);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 3, product* 6 * 9 * 6 * 9 * 2 * 3, index + 329696);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3, product* 8 * 2 * 7 * 9 * 2 * 3, index + 329728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3, product* 2 * 9 * 7 * 9 * 2 * 3, index + 329792);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 3, product* 4 * 8 * 9 * 9 * 2 * 3, index + 329984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3, product* 4 * 2 * 2 * 2 * 3 * 3, index + 332224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3, product* 8 * 8 * 2 * 2 * 3 * 3, index + 332288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3, product* 2 * 7 * 6 * 2 * 3 * 3, index + 332672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3, product* 6 * 3 * 7 * 2 * 3 * 3, index + 332736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3, product* 4 * 6 * 8 * 2 * 3 * 3, index + 332864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3, product* 8 * 2 * 9 * 2 * 3 * 3, index + 332928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3, product* 2 * 9 * 9 * 2 * 3 * 3, index + 332992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3, product* 8 * 4 * 2 * 3 * 3 * 3, index + 333248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3, product* 6 * 7 * 3 * 3 * 3 * 3, index + 333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3, product* 2 * 3 * 6 * 3 * 3 * 3, index + 333632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 3, product* 6 * 9 * 6 * 3 * 3 * 3, index + 333696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3, product* 4 * 2 * 8 * 3 * 3 * 3, index + 333824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 3, product* 8 * 8 * 8 * 3 * 3 * 3, index + 333888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3, product* 2 * 7 * 2 * 4 * 3 * 3, index + 334272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3, product* 6 * 3 * 3 * 4 * 3 * 3, index + 334336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3, product* 4 * 6 * 4 * 4 * 3 * 3, index + 334464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 3, product* 4 * 8 * 7 * 4 * 3 * 3, index + 334784);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3, product* 6 * 7 * 9 * 4 * 3 * 3, index + 334976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3, product* 4 * 8 * 3 * 6 * 3 * 3, index + 336384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 3, product* 8 * 4 * 4 * 6 * 3 * 3, index + 336448);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 3 + 3, product* 8 * 6 * 7 * 6 * 3 * 3, index + 336768);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3, product* 2 * 3 * 8 * 6 * 3 * 3, index + 336832);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 3, product* 6 * 9 * 8 * 6 * 3 * 3, index + 336896);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3, product* 4 * 4 * 3 * 7 * 3 * 3, index + 337344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3, product* 2 * 7 * 4 * 7 * 3 * 3, index + 337472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3, product* 4 * 6 * 6 * 7 * 3 * 3, index + 337664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 3, product* 8 * 2 * 7 * 7 * 3 * 3, index + 337728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3, product* 2 * 9 * 7 * 7 * 3 * 3, index + 337792);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3 + 3, product* 4 * 8 * 9 * 7 * 3 * 3, index + 337984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 3, product* 8 * 6 * 3 * 8 * 3 * 3, index + 338368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3, product* 2 * 3 * 4 * 8 * 3 * 3, index + 338432);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3 + 3, product* 6 * 9 * 4 * 8 * 3 * 3, index + 338496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3, product* 4 * 2 * 6 * 8 * 3 * 3, index + 338624);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 3, product* 8 * 8 * 6 * 8 * 3 * 3, index + 338688);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 3, product* 4 * 4 * 9 * 8 * 3 * 3, index + 338944);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 3, product* 2 * 3 * 2 * 9 * 3 * 3, index + 339232);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3, product* 4 * 6 * 2 * 9 * 3 * 3, index + 339264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3, product* 8 * 2 * 3 * 9 * 3 * 3, index + 339328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3, product* 2 * 9 * 3 * 9 * 3 * 3, index + 339392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 3, product* 8 * 4 * 6 * 9 * 3 * 3, index + 339648);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 3 + 3, product* 6 * 7 * 7 * 9 * 3 * 3, index + 339776);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3 + 3, product* 8 * 6 * 9 * 9 * 3 * 3, index + 339968);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3, product* 2 * 7 * 2 * 2 * 4 * 3, index + 342272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3, product* 6 * 3 * 3 * 2 * 4 * 3, index + 342336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3, product* 4 * 6 * 4 * 2 * 4 * 3, index + 342464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3, product* 4 * 8 * 7 * 2 * 4 * 3, index + 342784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3, product* 8 * 4 * 8 * 2 * 4 * 3, index + 342848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 3, product* 6 * 7 * 9 * 2 * 4 * 3, index + 342976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3, product* 2 * 3 * 2 * 3 * 4 * 3, index + 343232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3, product* 6 * 9 * 2 * 3 * 4 * 3, index + 343296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3, product* 4 * 2 * 4 * 3 * 4 * 3, index + 343424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3, product* 8 * 8 * 4 * 3 * 4 * 3, index + 343488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3, product* 4 * 4 * 7 * 3 * 4 * 3, index + 343744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3, product* 2 * 7 * 8 * 3 * 4 * 3, index + 343872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3, product* 6 * 3 * 9 * 3 * 4 * 3, index + 343936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3, product* 4 * 8 * 3 * 4 * 4 * 3, index + 344384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3, product* 8 * 4 * 4 * 4 * 4 * 3, index + 344448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3, product* 8 * 6 * 7 * 4 * 4 * 3, index + 344768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3, product* 2 * 3 * 8 * 4 * 4 * 3, index + 344832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 4 + 3, product* 6 * 9 * 8 * 4 * 4 * 3, index + 344896);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3, product* 8 * 6 * 3 * 6 * 4 * 3, index + 346368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3, product* 2 * 3 * 4 * 6 * 4 * 3, index + 346432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3, product* 6 * 9 * 4 * 6 * 4 * 3, index + 346496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3, product* 4 * 2 * 6 * 6 * 4 * 3, index + 346624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 3, product* 8 * 8 * 6 * 6 * 4 * 3, index + 346688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 3, product* 4 * 4 * 9 * 6 * 4 * 3, index + 346944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3, product* 4 * 6 * 2 * 7 * 4 * 3, index + 347264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3, product* 8 * 2 * 3 * 7 * 4 * 3, index + 347328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3, product* 2 * 9 * 3 * 7 * 4 * 3, index + 347392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 3, product* 8 * 4 * 6 * 7 * 4 * 3, index + 347648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4 + 3, product* 6 * 7 * 7 * 7 * 4 * 3, index + 347776);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3, product* 4 * 2 * 2 * 8 * 4 * 3, index + 348224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 3, product* 8 * 8 * 2 * 8 * 4 * 3, index + 348288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 3, product* 2 * 7 * 6 * 8 * 4 * 3, index + 348672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3, product* 6 * 3 * 7 * 8 * 4 * 3, index + 348736);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3, product* 8 * 2 * 9 * 8 * 4 * 3, index + 348928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 3, product* 2 * 9 * 9 * 8 * 4 * 3, index + 348992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3, product* 8 * 4 * 2 * 9 * 4 * 3, index + 349248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3, product* 2 * 3 * 6 * 9 * 4 * 3, index + 349632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3, product* 4 * 2 * 8 * 9 * 4 * 3, index + 349824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3, product* 8 * 6 * 3 * 2 * 6 * 3, index + 362368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3, product* 2 * 3 * 4 * 2 * 6 * 3, index + 362432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3, product* 6 * 9 * 4 * 2 * 6 * 3, index + 362496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3, product* 4 * 2 * 6 * 2 * 6 * 3, index + 362624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 3, product* 8 * 8 * 6 * 2 * 6 * 3, index + 362688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3, product* 4 * 4 * 9 * 2 * 6 * 3, index + 362944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3, product* 4 * 6 * 2 * 3 * 6 * 3, index + 363264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3, product* 8 * 2 * 3 * 3 * 6 * 3, index + 363328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3, product* 2 * 9 * 3 * 3 * 6 * 3, index + 363392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3, product* 8 * 4 * 6 * 3 * 6 * 3, index + 363648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 3, product* 6 * 7 * 7 * 3 * 6 * 3, index + 363776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3, product* 8 * 6 * 9 * 3 * 6 * 3, index + 363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3, product* 4 * 2 * 2 * 4 * 6 * 3, index + 364224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3, product* 8 * 8 * 2 * 4 * 6 * 3, index + 364288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3, product* 2 * 7 * 6 * 4 * 6 * 3, index + 364672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 3, product* 6 * 3 * 7 * 4 * 6 * 3, index + 364736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 3, product* 4 * 6 * 8 * 4 * 6 * 3, index + 364864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3, product* 8 * 2 * 9 * 4 * 6 * 3, index + 364928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6 + 3, product* 2 * 9 * 9 * 4 * 6 * 3, index + 364992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3, product* 2 * 7 * 2 * 6 * 6 * 3, index + 366272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3, product* 6 * 3 * 3 * 6 * 6 * 3, index + 366336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3, product* 4 * 6 * 4 * 6 * 6 * 3, index + 366464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 3, product* 4 * 8 * 7 * 6 * 6 * 3, index + 366784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 3, product* 8 * 4 * 8 * 6 * 6 * 3, index + 366848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6 + 3, product* 6 * 7 * 9 * 6 * 6 * 3, index + 366976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3, product* 2 * 3 * 2 * 7 * 6 * 3, index + 367232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 3, product* 6 * 9 * 2 * 7 * 6 * 3, index + 367296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3, product* 4 * 2 * 4 * 7 * 6 * 3, index + 367424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3, product* 8 * 8 * 4 * 7 * 6 * 3, index + 367488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 6 + 3, product* 4 * 4 * 7 * 7 * 6 * 3, index + 367744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6 + 3, product* 2 * 7 * 8 * 7 * 6 * 3, index + 367872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 3, product* 6 * 3 * 9 * 7 * 6 * 3, index + 367936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3, product* 4 * 8 * 3 * 8 * 6 * 3, index + 368384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3, product* 8 * 4 * 4 * 8 * 6 * 3, index + 368448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 3, product* 2 * 3 * 8 * 8 * 6 * 3, index + 368832);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 6 + 3, product* 6 * 9 * 8 * 8 * 6 * 3, index + 368896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 3, product* 4 * 4 * 3 * 9 * 6 * 3, index + 369344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 3, product* 2 * 7 * 4 * 9 * 6 * 3, index + 369472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6 + 3, product* 4 * 6 * 6 * 9 * 6 * 3, index + 369664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 3, product* 8 * 2 * 7 * 9 * 6 * 3, index + 369728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 6 + 3, product* 2 * 9 * 7 * 9 * 6 * 3, index + 369792);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 6 + 3, product* 4 * 8 * 9 * 9 * 6 * 3, index + 369984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3, product* 4 * 2 * 2 * 2 * 7 * 3, index + 372224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3, product* 8 * 8 * 2 * 2 * 7 * 3, index + 372288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3, product* 2 * 7 * 6 * 2 * 7 * 3, index + 372672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3, product* 6 * 3 * 7 * 2 * 7 * 3, index + 372736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3, product* 4 * 6 * 8 * 2 * 7 * 3, index + 372864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3, product* 8 * 2 * 9 * 2 * 7 * 3, index + 372928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3, product* 2 * 9 * 9 * 2 * 7 * 3, index + 372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3, product* 8 * 4 * 2 * 3 * 7 * 3, index + 373248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3, product* 6 * 7 * 3 * 3 * 7 * 3, index + 373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3, product* 2 * 3 * 6 * 3 * 7 * 3, index + 373632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 7 + 3, product* 6 * 9 * 6 * 3 * 7 * 3, index + 373696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3, product* 4 * 2 * 8 * 3 * 7 * 3, index + 373824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 7 + 3, product* 8 * 8 * 8 * 3 * 7 * 3, index + 373888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3, product* 2 * 7 * 2 * 4 * 7 * 3, index + 374272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3, product* 6 * 3 * 3 * 4 * 7 * 3, index + 374336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 3, product* 4 * 6 * 4 * 4 * 7 * 3, index + 374464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 3, product* 4 * 8 * 7 * 4 * 7 * 3, index + 374784);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 3, product* 6 * 7 * 9 * 4 * 7 * 3, index + 374976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 3, product* 4 * 8 * 3 * 6 * 7 * 3, index + 376384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3, product* 8 * 4 * 4 * 6 * 7 * 3, index + 376448);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 7 + 3, product* 8 * 6 * 7 * 6 * 7 * 3, index + 376768);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3, product* 2 * 3 * 8 * 6 * 7 * 3, index + 376832);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 7 + 3, product* 6 * 9 * 8 * 6 * 7 * 3, index + 376896);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3, product* 4 * 4 * 3 * 7 * 7 * 3, index + 377344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3, product* 2 * 7 * 4 * 7 * 7 * 3, index + 377472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 7 + 3, product* 4 * 6 * 6 * 7 * 7 * 3, index + 377664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3, product* 8 * 2 * 7 * 7 * 7 * 3, index + 377728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 3, product* 4 * 8 * 9 * 7 * 7 * 3, index + 377984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 3, product* 8 * 6 * 3 * 8 * 7 * 3, index + 378368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3, product* 2 * 3 * 4 * 8 * 7 * 3, index + 378432);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3, product* 6 * 9 * 4 * 8 * 7 * 3, index + 378496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3, product* 4 * 2 * 6 * 8 * 7 * 3, index + 378624);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 3, product* 4 * 4 * 9 * 8 * 7 * 3, index + 378944);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3, product* 4 * 6 * 2 * 9 * 7 * 3, index + 379264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 3, product* 8 * 2 * 3 * 9 * 7 * 3, index + 379328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3, product* 2 * 9 * 3 * 9 * 7 * 3, index + 379392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3, product* 2 * 7 * 2 * 2 * 8 * 3, index + 382272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3, product* 6 * 3 * 3 * 2 * 8 * 3, index + 382336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3, product* 4 * 6 * 4 * 2 * 8 * 3, index + 382464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3, product* 4 * 8 * 7 * 2 * 8 * 3, index + 382784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3, product* 8 * 4 * 8 * 2 * 8 * 3, index + 382848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 8 + 3, product* 6 * 7 * 9 * 2 * 8 * 3, index + 382976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3, product* 2 * 3 * 2 * 3 * 8 * 3, index + 383232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3, product* 6 * 9 * 2 * 3 * 8 * 3, index + 383296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3, product* 4 * 2 * 4 * 3 * 8 * 3, index + 383424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3, product* 8 * 8 * 4 * 3 * 8 * 3, index + 383488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 3, product* 4 * 4 * 7 * 3 * 8 * 3, index + 383744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3, product* 2 * 7 * 8 * 3 * 8 * 3, index + 383872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 3, product* 6 * 3 * 9 * 3 * 8 * 3, index + 383936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3, product* 4 * 8 * 3 * 4 * 8 * 3, index + 384384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 3, product* 8 * 4 * 4 * 4 * 8 * 3, index + 384448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 8 + 3, product* 8 * 6 * 7 * 4 * 8 * 3, index + 384768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3, product* 2 * 3 * 8 * 4 * 8 * 3, index + 384832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 8 + 3, product* 6 * 9 * 8 * 4 * 8 * 3, index + 384896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3, product* 2 * 3 * 4 * 6 * 8 * 3, index + 386432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8 + 3, product* 6 * 9 * 4 * 6 * 8 * 3, index + 386496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 3, product* 4 * 2 * 6 * 6 * 8 * 3, index + 386624);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3, product* 4 * 4 * 9 * 6 * 8 * 3, index + 386944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 3, product* 4 * 6 * 2 * 7 * 8 * 3, index + 387264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3, product* 8 * 2 * 3 * 7 * 8 * 3, index + 387328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 3, product* 2 * 9 * 3 * 7 * 8 * 3, index + 387392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8 + 3, product* 8 * 4 * 6 * 7 * 8 * 3, index + 387648);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3, product* 4 * 2 * 2 * 8 * 8 * 3, index + 388224);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 3, product* 2 * 7 * 6 * 8 * 8 * 3, index + 388672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 8 + 3, product* 6 * 3 * 7 * 8 * 8 * 3, index + 388736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 3, product* 4 * 6 * 8 * 8 * 8 * 3, index + 388864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 3, product* 2 * 9 * 9 * 8 * 8 * 3, index + 388992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 3, product* 8 * 4 * 2 * 9 * 8 * 3, index + 389248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 8 + 3, product* 6 * 7 * 3 * 9 * 8 * 3, index + 389376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3, product* 2 * 3 * 6 * 9 * 8 * 3, index + 389632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 3, product* 4 * 2 * 8 * 9 * 8 * 3, index + 389824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3, product* 4 * 8 * 3 * 2 * 9 * 3, index + 392384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3, product* 8 * 4 * 4 * 2 * 9 * 3, index + 392448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 3, product* 8 * 6 * 7 * 2 * 9 * 3, index + 392768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3, product* 2 * 3 * 8 * 2 * 9 * 3, index + 392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3, product* 4 * 4 * 3 * 3 * 9 * 3, index + 393344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3, product* 2 * 7 * 4 * 3 * 9 * 3, index + 393472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 3, product* 4 * 6 * 6 * 3 * 9 * 3, index + 393664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3, product* 8 * 2 * 7 * 3 * 9 * 3, index + 393728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3, product* 2 * 9 * 7 * 3 * 9 * 3, index + 393792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 3, product* 4 * 8 * 9 * 3 * 9 * 3, index + 393984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9 + 3, product* 8 * 6 * 3 * 4 * 9 * 3, index + 394368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3, product* 2 * 3 * 4 * 4 * 9 * 3, index + 394432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 3, product* 6 * 9 * 4 * 4 * 9 * 3, index + 394496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3, product* 4 * 2 * 6 * 4 * 9 * 3, index + 394624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9 + 3, product* 8 * 8 * 6 * 4 * 9 * 3, index + 394688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 3, product* 4 * 2 * 2 * 6 * 9 * 3, index + 396224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 3, product* 8 * 8 * 2 * 6 * 9 * 3, index + 396288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3, product* 2 * 7 * 6 * 6 * 9 * 3, index + 396672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9 + 3, product* 6 * 3 * 7 * 6 * 9 * 3, index + 396736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 9 + 3, product* 4 * 6 * 8 * 6 * 9 * 3, index + 396864);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 3, product* 8 * 2 * 9 * 6 * 9 * 3, index + 396928);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3, product* 2 * 3 * 6 * 7 * 9 * 3, index + 397632);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3, product* 4 * 2 * 8 * 7 * 9 * 3, index + 397824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9 + 3, product* 2 * 7 * 2 * 8 * 9 * 3, index + 398272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3, product* 6 * 3 * 3 * 8 * 9 * 3, index + 398336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 3, product* 4 * 6 * 4 * 8 * 9 * 3, index + 398464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3, product* 2 * 3 * 2 * 9 * 9 * 3, index + 399232);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3, product* 4 * 2 * 4 * 9 * 9 * 3, index + 399424);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 3, product* 4 * 4 * 7 * 9 * 9 * 3, index + 399744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4, product* 2 * 7 * 2 * 2 * 2 * 4, index + 422272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4, product* 6 * 3 * 3 * 2 * 2 * 4, index + 422336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4, product* 4 * 6 * 4 * 2 * 2 * 4, index + 422464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4, product* 4 * 8 * 7 * 2 * 2 * 4, index + 422784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4, product* 8 * 4 * 8 * 2 * 2 * 4, index + 422848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4, product* 6 * 7 * 9 * 2 * 2 * 4, index + 422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4, product* 2 * 3 * 2 * 3 * 2 * 4, index + 423232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4, product* 6 * 9 * 2 * 3 * 2 * 4, index + 423296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4, product* 4 * 2 * 4 * 3 * 2 * 4, index + 423424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4, product* 8 * 8 * 4 * 3 * 2 * 4, index + 423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4, product* 4 * 4 * 7 * 3 * 2 * 4, index + 423744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4, product* 2 * 7 * 8 * 3 * 2 * 4, index + 423872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4, product* 6 * 3 * 9 * 3 * 2 * 4, index + 423936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4, product* 4 * 8 * 3 * 4 * 2 * 4, index + 424384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4, product* 8 * 4 * 4 * 4 * 2 * 4, index + 424448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 4, product* 8 * 6 * 7 * 4 * 2 * 4, index + 424768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4, product* 2 * 3 * 8 * 4 * 2 * 4, index + 424832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 4, product* 6 * 9 * 8 * 4 * 2 * 4, index + 424896);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4, product* 8 * 6 * 3 * 6 * 2 * 4, index + 426368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4, product* 2 * 3 * 4 * 6 * 2 * 4, index + 426432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 4, product* 6 * 9 * 4 * 6 * 2 * 4, index + 426496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4, product* 4 * 2 * 6 * 6 * 2 * 4, index + 426624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 4, product* 8 * 8 * 6 * 6 * 2 * 4, index + 426688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 4, product* 4 * 4 * 9 * 6 * 2 * 4, index + 426944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4, product* 4 * 6 * 2 * 7 * 2 * 4, index + 427264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4, product* 8 * 2 * 3 * 7 * 2 * 4, index + 427328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4, product* 2 * 9 * 3 * 7 * 2 * 4, index + 427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4, product* 8 * 4 * 6 * 7 * 2 * 4, index + 427648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 4, product* 6 * 7 * 7 * 7 * 2 * 4, index + 427776);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4, product* 4 * 2 * 2 * 8 * 2 * 4, index + 428224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4, product* 8 * 8 * 2 * 8 * 2 * 4, index + 428288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4, product* 2 * 7 * 6 * 8 * 2 * 4, index + 428672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4, product* 6 * 3 * 7 * 8 * 2 * 4, index + 428736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 4, product* 4 * 6 * 8 * 8 * 2 * 4, index + 428864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 4, product* 8 * 2 * 9 * 8 * 2 * 4, index + 428928);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4, product* 8 * 4 * 2 * 9 * 2 * 4, index + 429248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 4, product* 6 * 7 * 3 * 9 * 2 * 4, index + 429376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4, product* 2 * 3 * 6 * 9 * 2 * 4, index + 429632);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 4, product* 6 * 9 * 6 * 9 * 2 * 4, index + 429696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4, product* 4 * 2 * 8 * 9 * 2 * 4, index + 429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4, product* 4 * 8 * 3 * 2 * 3 * 4, index + 432384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4, product* 8 * 4 * 4 * 2 * 3 * 4, index + 432448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4, product* 8 * 6 * 7 * 2 * 3 * 4, index + 432768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4, product* 2 * 3 * 8 * 2 * 3 * 4, index + 432832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4, product* 6 * 9 * 8 * 2 * 3 * 4, index + 432896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4, product* 4 * 4 * 3 * 3 * 3 * 4, index + 433344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4, product* 2 * 7 * 4 * 3 * 3 * 4, index + 433472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4, product* 4 * 6 * 6 * 3 * 3 * 4, index + 433664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4, product* 8 * 2 * 7 * 3 * 3 * 4, index + 433728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4, product* 2 * 9 * 7 * 3 * 3 * 4, index + 433792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4, product* 4 * 8 * 9 * 3 * 3 * 4, index + 433984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4, product* 8 * 6 * 3 * 4 * 3 * 4, index + 434368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4, product* 2 * 3 * 4 * 4 * 3 * 4, index + 434432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 4, product* 6 * 9 * 4 * 4 * 3 * 4, index + 434496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4, product* 4 * 2 * 6 * 4 * 3 * 4, index + 434624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 4, product* 8 * 8 * 6 * 4 * 3 * 4, index + 434688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 4, product* 4 * 4 * 9 * 4 * 3 * 4, index + 434944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4, product* 4 * 2 * 2 * 6 * 3 * 4, index + 436224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4, product* 8 * 8 * 2 * 6 * 3 * 4, index + 436288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 4, product* 2 * 7 * 6 * 6 * 3 * 4, index + 436672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4, product* 6 * 3 * 7 * 6 * 3 * 4, index + 436736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4, product* 4 * 6 * 8 * 6 * 3 * 4, index + 436864);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 4, product* 8 * 2 * 9 * 6 * 3 * 4, index + 436928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 4, product* 2 * 9 * 9 * 6 * 3 * 4, index + 436992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4, product* 8 * 4 * 2 * 7 * 3 * 4, index + 437248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 4, product* 6 * 7 * 3 * 7 * 3 * 4, index + 437376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4, product* 2 * 3 * 6 * 7 * 3 * 4, index + 437632);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 4, product* 6 * 9 * 6 * 7 * 3 * 4, index + 437696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4, product* 4 * 2 * 8 * 7 * 3 * 4, index + 437824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4, product* 2 * 7 * 2 * 8 * 3 * 4, index + 438272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4, product* 6 * 3 * 3 * 8 * 3 * 4, index + 438336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 4, product* 4 * 6 * 4 * 8 * 3 * 4, index + 438464);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 4, product* 4 * 8 * 7 * 8 * 3 * 4, index + 438784);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 4, product* 8 * 4 * 8 * 8 * 3 * 4, index + 438848);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 4, product* 6 * 7 * 9 * 8 * 3 * 4, index + 438976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4, product* 2 * 3 * 2 * 9 * 3 * 4, index + 439232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 4, product* 6 * 9 * 2 * 9 * 3 * 4, index + 439296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4, product* 4 * 2 * 4 * 9 * 3 * 4, index + 439424);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 4, product* 8 * 8 * 4 * 9 * 3 * 4, index + 439488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 4, product* 4 * 4 * 7 * 9 * 3 * 4, index + 439744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 4, product* 2 * 7 * 8 * 9 * 3 * 4, index + 439872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 4, product* 6 * 3 * 9 * 9 * 3 * 4, index + 439936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4, product* 8 * 6 * 3 * 2 * 4 * 4, index + 442368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4, product* 2 * 3 * 4 * 2 * 4 * 4, index + 442432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 4, product* 6 * 9 * 4 * 2 * 4 * 4, index + 442496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4, product* 4 * 2 * 6 * 2 * 4 * 4, index + 442624);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4, product* 4 * 4 * 9 * 2 * 4 * 4, index + 442944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4, product* 4 * 6 * 2 * 3 * 4 * 4, index + 443264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4, product* 8 * 2 * 3 * 3 * 4 * 4, index + 443328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4, product* 2 * 9 * 3 * 3 * 4 * 4, index + 443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4, product* 8 * 4 * 6 * 3 * 4 * 4, index + 443648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4, product* 6 * 7 * 7 * 3 * 4 * 4, index + 443776);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4, product* 4 * 2 * 2 * 4 * 4 * 4, index + 444224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4, product* 8 * 8 * 2 * 4 * 4 * 4, index + 444288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4, product* 2 * 7 * 6 * 4 * 4 * 4, index + 444672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 4, product* 6 * 3 * 7 * 4 * 4 * 4, index + 444736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 4, product* 4 * 6 * 8 * 4 * 4 * 4, index + 444864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4, product* 8 * 2 * 9 * 4 * 4 * 4, index + 444928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 4, product* 2 * 9 * 9 * 4 * 4 * 4, index + 444992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4, product* 2 * 7 * 2 * 6 * 4 * 4, index + 446272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4, product* 6 * 3 * 3 * 6 * 4 * 4, index + 446336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4, product* 4 * 6 * 4 * 6 * 4 * 4, index + 446464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 4, product* 4 * 8 * 7 * 6 * 4 * 4, index + 446784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 4, product* 8 * 4 * 8 * 6 * 4 * 4, index + 446848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 4, product* 6 * 7 * 9 * 6 * 4 * 4, index + 446976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4, product* 2 * 3 * 2 * 7 * 4 * 4, index + 447232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 4, product* 6 * 9 * 2 * 7 * 4 * 4, index + 447296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4, product* 4 * 2 * 4 * 7 * 4 * 4, index + 447424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 4, product* 8 * 8 * 4 * 7 * 4 * 4, index + 447488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 4, product* 4 * 4 * 7 * 7 * 4 * 4, index + 447744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 4, product* 2 * 7 * 8 * 7 * 4 * 4, index + 447872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 4, product* 6 * 3 * 9 * 7 * 4 * 4, index + 447936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 4, product* 4 * 8 * 3 * 8 * 4 * 4, index + 448384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 4, product* 8 * 4 * 4 * 8 * 4 * 4, index + 448448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 4, product* 2 * 3 * 8 * 8 * 4 * 4, index + 448832);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4 + 4, product* 6 * 9 * 8 * 8 * 4 * 4, index + 448896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4, product* 4 * 4 * 3 * 9 * 4 * 4, index + 449344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 4, product* 2 * 7 * 4 * 9 * 4 * 4, index + 449472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4, product* 4 * 6 * 6 * 9 * 4 * 4, index + 449664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 4, product* 8 * 2 * 7 * 9 * 4 * 4, index + 449728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4, product* 2 * 7 * 2 * 2 * 6 * 4, index + 462272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4, product* 6 * 3 * 3 * 2 * 6 * 4, index + 462336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4, product* 4 * 6 * 4 * 2 * 6 * 4, index + 462464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 4, product* 4 * 8 * 7 * 2 * 6 * 4, index + 462784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4, product* 8 * 4 * 8 * 2 * 6 * 4, index + 462848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 4, product* 6 * 7 * 9 * 2 * 6 * 4, index + 462976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4, product* 2 * 3 * 2 * 3 * 6 * 4, index + 463232);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4, product* 4 * 2 * 4 * 3 * 6 * 4, index + 463424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 4, product* 8 * 8 * 4 * 3 * 6 * 4, index + 463488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4, product* 4 * 4 * 7 * 3 * 6 * 4, index + 463744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4, product* 2 * 7 * 8 * 3 * 6 * 4, index + 463872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 4, product* 6 * 3 * 9 * 3 * 6 * 4, index + 463936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4, product* 4 * 8 * 3 * 4 * 6 * 4, index + 464384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 4, product* 8 * 4 * 4 * 4 * 6 * 4, index + 464448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 4, product* 8 * 6 * 7 * 4 * 6 * 4, index + 464768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4, product* 2 * 3 * 8 * 4 * 6 * 4, index + 464832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 4, product* 8 * 6 * 3 * 6 * 6 * 4, index + 466368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4, product* 2 * 3 * 4 * 6 * 6 * 4, index + 466432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 4, product* 6 * 9 * 4 * 6 * 6 * 4, index + 466496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 4, product* 4 * 2 * 6 * 6 * 6 * 4, index + 466624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 4, product* 8 * 8 * 6 * 6 * 6 * 4, index + 466688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 4, product* 4 * 4 * 9 * 6 * 6 * 4, index + 466944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4, product* 4 * 6 * 2 * 7 * 6 * 4, index + 467264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 4, product* 8 * 2 * 3 * 7 * 6 * 4, index + 467328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 4, product* 2 * 9 * 3 * 7 * 6 * 4, index + 467392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 4, product* 8 * 4 * 6 * 7 * 6 * 4, index + 467648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 4, product* 6 * 7 * 7 * 7 * 6 * 4, index + 467776);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4, product* 4 * 2 * 2 * 8 * 6 * 4, index + 468224);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 4, product* 2 * 7 * 6 * 8 * 6 * 4, index + 468672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 4, product* 6 * 3 * 7 * 8 * 6 * 4, index + 468736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 4, product* 4 * 6 * 8 * 8 * 6 * 4, index + 468864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 4, product* 8 * 2 * 9 * 8 * 6 * 4, index + 468928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 4, product* 2 * 9 * 9 * 8 * 6 * 4, index + 468992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4, product* 8 * 4 * 2 * 9 * 6 * 4, index + 469248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4, product* 2 * 3 * 6 * 9 * 6 * 4, index + 469632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 4, product* 4 * 2 * 8 * 9 * 6 * 4, index + 469824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4, product* 4 * 8 * 3 * 2 * 7 * 4, index + 472384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4, product* 8 * 4 * 4 * 2 * 7 * 4, index + 472448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 4, product* 8 * 6 * 7 * 2 * 7 * 4, index + 472768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4, product* 2 * 3 * 8 * 2 * 7 * 4, index + 472832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 4, product* 6 * 9 * 8 * 2 * 7 * 4, index + 472896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4, product* 4 * 4 * 3 * 3 * 7 * 4, index + 473344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4, product* 2 * 7 * 4 * 3 * 7 * 4, index + 473472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 4, product* 4 * 6 * 6 * 3 * 7 * 4, index + 473664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4, product* 8 * 2 * 7 * 3 * 7 * 4, index + 473728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 4, product* 4 * 8 * 9 * 3 * 7 * 4, index + 473984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 4, product* 8 * 6 * 3 * 4 * 7 * 4, index + 474368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4, product* 2 * 3 * 4 * 4 * 7 * 4, index + 474432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 4, product* 6 * 9 * 4 * 4 * 7 * 4, index + 474496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4, product* 4 * 2 * 6 * 4 * 7 * 4, index + 474624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 4, product* 8 * 8 * 6 * 4 * 7 * 4, index + 474688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 4, product* 4 * 4 * 9 * 4 * 7 * 4, index + 474944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4, product* 4 * 2 * 2 * 6 * 7 * 4, index + 476224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 4, product* 8 * 8 * 2 * 6 * 7 * 4, index + 476288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4, product* 2 * 7 * 6 * 6 * 7 * 4, index + 476672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 4, product* 6 * 3 * 7 * 6 * 7 * 4, index + 476736);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 4, product* 8 * 2 * 9 * 6 * 7 * 4, index + 476928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 4, product* 2 * 9 * 9 * 6 * 7 * 4, index + 476992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 4, product* 8 * 4 * 2 * 7 * 7 * 4, index + 477248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4, product* 2 * 3 * 6 * 7 * 7 * 4, index + 477632);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 4, product* 6 * 9 * 6 * 7 * 7 * 4, index + 477696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4, product* 4 * 2 * 8 * 7 * 7 * 4, index + 477824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4, product* 2 * 7 * 2 * 8 * 7 * 4, index + 478272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4, product* 6 * 3 * 3 * 8 * 7 * 4, index + 478336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 4, product* 4 * 6 * 4 * 8 * 7 * 4, index + 478464);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 7 + 4, product* 8 * 4 * 8 * 8 * 7 * 4, index + 478848);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 4, product* 6 * 7 * 9 * 8 * 7 * 4, index + 478976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4, product* 2 * 3 * 2 * 9 * 7 * 4, index + 479232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 4, product* 6 * 9 * 2 * 9 * 7 * 4, index + 479296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 4, product* 4 * 2 * 4 * 9 * 7 * 4, index + 479424);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 4, product* 4 * 4 * 7 * 9 * 7 * 4, index + 479744);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 4, product* 6 * 3 * 9 * 9 * 7 * 4, index + 479936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4, product* 8 * 6 * 3 * 2 * 8 * 4, index + 482368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4, product* 2 * 3 * 4 * 2 * 8 * 4, index + 482432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 4, product* 6 * 9 * 4 * 2 * 8 * 4, index + 482496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4, product* 4 * 2 * 6 * 2 * 8 * 4, index + 482624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 4, product* 8 * 8 * 6 * 2 * 8 * 4, index + 482688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 4, product* 4 * 4 * 9 * 2 * 8 * 4, index + 482944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 4, product* 4 * 6 * 2 * 3 * 8 * 4, index + 483264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4, product* 8 * 2 * 3 * 3 * 8 * 4, index + 483328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4, product* 2 * 9 * 3 * 3 * 8 * 4, index + 483392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 4, product* 8 * 4 * 6 * 3 * 8 * 4, index + 483648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 4, product* 6 * 7 * 7 * 3 * 8 * 4, index + 483776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 4, product* 8 * 6 * 9 * 3 * 8 * 4, index + 483968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4, product* 4 * 2 * 2 * 4 * 8 * 4, index + 484224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 4, product* 8 * 8 * 2 * 4 * 8 * 4, index + 484288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 4, product* 2 * 7 * 6 * 4 * 8 * 4, index + 484672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 4, product* 6 * 3 * 7 * 4 * 8 * 4, index + 484736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 4, product* 4 * 6 * 8 * 4 * 8 * 4, index + 484864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 4, product* 2 * 9 * 9 * 4 * 8 * 4, index + 484992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4, product* 2 * 7 * 2 * 6 * 8 * 4, index + 486272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 4, product* 6 * 3 * 3 * 6 * 8 * 4, index + 486336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4, product* 4 * 6 * 4 * 6 * 8 * 4, index + 486464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4, product* 2 * 3 * 2 * 7 * 8 * 4, index + 487232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 4, product* 6 * 9 * 2 * 7 * 8 * 4, index + 487296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4, product* 4 * 2 * 4 * 7 * 8 * 4, index + 487424);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 4, product* 4 * 4 * 7 * 7 * 8 * 4, index + 487744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 4, product* 2 * 7 * 8 * 7 * 8 * 4, index + 487872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 4, product* 4 * 8 * 3 * 8 * 8 * 4, index + 488384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 4, product* 8 * 4 * 4 * 8 * 8 * 4, index + 488448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 4, product* 2 * 3 * 8 * 8 * 8 * 4, index + 488832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 4, product* 4 * 4 * 3 * 9 * 8 * 4, index + 489344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4, product* 2 * 7 * 4 * 9 * 8 * 4, index + 489472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 4, product* 4 * 6 * 6 * 9 * 8 * 4, index + 489664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 4, product* 8 * 2 * 7 * 9 * 8 * 4, index + 489728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 4, product* 2 * 9 * 7 * 9 * 8 * 4, index + 489792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4, product* 4 * 2 * 2 * 2 * 9 * 4, index + 492224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4, product* 8 * 8 * 2 * 2 * 9 * 4, index + 492288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4, product* 2 * 7 * 6 * 2 * 9 * 4, index + 492672);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 4, product* 4 * 6 * 8 * 2 * 9 * 4, index + 492864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4, product* 8 * 2 * 9 * 2 * 9 * 4, index + 492928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 4, product* 2 * 9 * 9 * 2 * 9 * 4, index + 492992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4, product* 8 * 4 * 2 * 3 * 9 * 4, index + 493248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 4, product* 6 * 7 * 3 * 3 * 9 * 4, index + 493376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4, product* 2 * 3 * 6 * 3 * 9 * 4, index + 493632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 4, product* 6 * 9 * 6 * 3 * 9 * 4, index + 493696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4, product* 4 * 2 * 8 * 3 * 9 * 4, index + 493824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 4, product* 8 * 8 * 8 * 3 * 9 * 4, index + 493888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4, product* 2 * 7 * 2 * 4 * 9 * 4, index + 494272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4, product* 6 * 3 * 3 * 4 * 9 * 4, index + 494336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 4, product* 4 * 6 * 4 * 4 * 9 * 4, index + 494464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 4, product* 6 * 7 * 9 * 4 * 9 * 4, index + 494976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 4, product* 4 * 8 * 3 * 6 * 9 * 4, index + 496384);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4, product* 2 * 3 * 8 * 6 * 9 * 4, index + 496832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 4, product* 4 * 4 * 3 * 7 * 9 * 4, index + 497344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 4, product* 2 * 7 * 4 * 7 * 9 * 4, index + 497472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 4, product* 4 * 6 * 6 * 7 * 9 * 4, index + 497664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 4, product* 8 * 2 * 7 * 7 * 9 * 4, index + 497728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 4, product* 2 * 9 * 7 * 7 * 9 * 4, index + 497792);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9 + 4, product* 4 * 8 * 9 * 7 * 9 * 4, index + 497984);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 4, product* 2 * 3 * 4 * 8 * 9 * 4, index + 498432);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 4, product* 6 * 9 * 4 * 8 * 9 * 4, index + 498496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 4, product* 4 * 2 * 6 * 8 * 9 * 4, index + 498624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 4, product* 4 * 6 * 2 * 9 * 9 * 4, index + 499264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 4, product* 8 * 2 * 3 * 9 * 9 * 4, index + 499328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 4, product* 2 * 9 * 3 * 9 * 9 * 4, index + 499392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9 + 4, product* 8 * 4 * 6 * 9 * 9 * 4, index + 499648);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6, product* 2 * 7 * 2 * 2 * 2 * 6, index + 622272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6, product* 6 * 3 * 3 * 2 * 2 * 6, index + 622336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6, product* 4 * 6 * 4 * 2 * 2 * 6, index + 622464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6, product* 4 * 8 * 7 * 2 * 2 * 6, index + 622784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6, product* 8 * 4 * 8 * 2 * 2 * 6, index + 622848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6, product* 6 * 7 * 9 * 2 * 2 * 6, index + 622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6, product* 2 * 3 * 2 * 3 * 2 * 6, index + 623232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6, product* 6 * 9 * 2 * 3 * 2 * 6, index + 623296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6, product* 4 * 2 * 4 * 3 * 2 * 6, index + 623424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 6, product* 8 * 8 * 4 * 3 * 2 * 6, index + 623488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6, product* 4 * 4 * 7 * 3 * 2 * 6, index + 623744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6, product* 2 * 7 * 8 * 3 * 2 * 6, index + 623872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6, product* 6 * 3 * 9 * 3 * 2 * 6, index + 623936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6, product* 4 * 8 * 3 * 4 * 2 * 6, index + 624384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6, product* 8 * 4 * 4 * 4 * 2 * 6, index + 624448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 6, product* 8 * 6 * 7 * 4 * 2 * 6, index + 624768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6, product* 2 * 3 * 8 * 4 * 2 * 6, index + 624832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6, product* 6 * 9 * 8 * 4 * 2 * 6, index + 624896);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 6, product* 8 * 6 * 3 * 6 * 2 * 6, index + 626368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6, product* 2 * 3 * 4 * 6 * 2 * 6, index + 626432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 6, product* 6 * 9 * 4 * 6 * 2 * 6, index + 626496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6, product* 4 * 2 * 6 * 6 * 2 * 6, index + 626624);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 6, product* 4 * 4 * 9 * 6 * 2 * 6, index + 626944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6, product* 4 * 6 * 2 * 7 * 2 * 6, index + 627264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6, product* 8 * 2 * 3 * 7 * 2 * 6, index + 627328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6, product* 2 * 9 * 3 * 7 * 2 * 6, index + 627392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 6, product* 8 * 4 * 6 * 7 * 2 * 6, index + 627648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 6, product* 6 * 7 * 7 * 7 * 2 * 6, index + 627776);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 6, product* 8 * 6 * 9 * 7 * 2 * 6, index + 627968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6, product* 4 * 2 * 2 * 8 * 2 * 6, index + 628224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 6, product* 8 * 8 * 2 * 8 * 2 * 6, index + 628288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 6, product* 2 * 7 * 6 * 8 * 2 * 6, index + 628672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6, product* 6 * 3 * 7 * 8 * 2 * 6, index + 628736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 6, product* 4 * 6 * 8 * 8 * 2 * 6, index + 628864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 6, product* 8 * 2 * 9 * 8 * 2 * 6, index + 628928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 6, product* 2 * 9 * 9 * 8 * 2 * 6, index + 628992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 6, product* 8 * 4 * 2 * 9 * 2 * 6, index + 629248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6, product* 6 * 7 * 3 * 9 * 2 * 6, index + 629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6, product* 2 * 3 * 6 * 9 * 2 * 6, index + 629632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 6, product* 4 * 2 * 8 * 9 * 2 * 6, index + 629824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6, product* 4 * 8 * 3 * 2 * 3 * 6, index + 632384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6, product* 8 * 4 * 4 * 2 * 3 * 6, index + 632448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 6, product* 8 * 6 * 7 * 2 * 3 * 6, index + 632768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6, product* 2 * 3 * 8 * 2 * 3 * 6, index + 632832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 6, product* 6 * 9 * 8 * 2 * 3 * 6, index + 632896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6, product* 4 * 4 * 3 * 3 * 3 * 6, index + 633344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6, product* 2 * 7 * 4 * 3 * 3 * 6, index + 633472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6, product* 4 * 6 * 6 * 3 * 3 * 6, index + 633664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6, product* 8 * 2 * 7 * 3 * 3 * 6, index + 633728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 6, product* 2 * 9 * 7 * 3 * 3 * 6, index + 633792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6, product* 4 * 8 * 9 * 3 * 3 * 6, index + 633984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 6, product* 8 * 6 * 3 * 4 * 3 * 6, index + 634368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6, product* 2 * 3 * 4 * 4 * 3 * 6, index + 634432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6, product* 6 * 9 * 4 * 4 * 3 * 6, index + 634496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6, product* 4 * 2 * 6 * 4 * 3 * 6, index + 634624);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 6, product* 4 * 4 * 9 * 4 * 3 * 6, index + 634944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6, product* 4 * 2 * 2 * 6 * 3 * 6, index + 636224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6, product* 8 * 8 * 2 * 6 * 3 * 6, index + 636288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6, product* 2 * 7 * 6 * 6 * 3 * 6, index + 636672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 6, product* 6 * 3 * 7 * 6 * 3 * 6, index + 636736);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 6, product* 8 * 2 * 9 * 6 * 3 * 6, index + 636928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 6, product* 2 * 9 * 9 * 6 * 3 * 6, index + 636992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 6, product* 8 * 4 * 2 * 7 * 3 * 6, index + 637248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 6, product* 6 * 7 * 3 * 7 * 3 * 6, index + 637376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 6, product* 2 * 3 * 6 * 7 * 3 * 6, index + 637632);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6, product* 4 * 2 * 8 * 7 * 3 * 6, index + 637824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6, product* 2 * 7 * 2 * 8 * 3 * 6, index + 638272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6, product* 6 * 3 * 3 * 8 * 3 * 6, index + 638336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6, product* 4 * 6 * 4 * 8 * 3 * 6, index + 638464);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 6, product* 4 * 8 * 7 * 8 * 3 * 6, index + 638784);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 6, product* 8 * 4 * 8 * 8 * 3 * 6, index + 638848);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6, product* 2 * 3 * 2 * 9 * 3 * 6, index + 639232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 6, product* 6 * 9 * 2 * 9 * 3 * 6, index + 639296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6, product* 4 * 2 * 4 * 9 * 3 * 6, index + 639424);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 6, product* 8 * 8 * 4 * 9 * 3 * 6, index + 639488);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 6, product* 2 * 7 * 8 * 9 * 3 * 6, index + 639872);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 6, product* 8 * 6 * 3 * 2 * 4 * 6, index + 642368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6, product* 2 * 3 * 4 * 2 * 4 * 6, index + 642432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 6, product* 6 * 9 * 4 * 2 * 4 * 6, index + 642496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6, product* 4 * 2 * 6 * 2 * 4 * 6, index + 642624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 6, product* 8 * 8 * 6 * 2 * 4 * 6, index + 642688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6, product* 4 * 4 * 9 * 2 * 4 * 6, index + 642944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6, product* 4 * 6 * 2 * 3 * 4 * 6, index + 643264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6, product* 8 * 2 * 3 * 3 * 4 * 6, index + 643328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 6, product* 2 * 9 * 3 * 3 * 4 * 6, index + 643392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 6, product* 8 * 4 * 6 * 3 * 4 * 6, index + 643648);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 6, product* 6 * 3 * 9 * 3 * 4 * 6, index + 643936);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 6, product* 8 * 6 * 9 * 3 * 4 * 6, index + 643968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6, product* 4 * 2 * 2 * 4 * 4 * 6, index + 644224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 6, product* 8 * 8 * 2 * 4 * 4 * 6, index + 644288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6, product* 2 * 7 * 6 * 4 * 4 * 6, index + 644672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 6, product* 6 * 3 * 7 * 4 * 4 * 6, index + 644736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 6, product* 4 * 6 * 8 * 4 * 4 * 6, index + 644864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 6, product* 8 * 2 * 9 * 4 * 4 * 6, index + 644928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 6, product* 2 * 9 * 9 * 4 * 4 * 6, index + 644992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6, product* 2 * 7 * 2 * 6 * 4 * 6, index + 646272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6, product* 6 * 3 * 3 * 6 * 4 * 6, index + 646336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 6, product* 4 * 6 * 4 * 6 * 4 * 6, index + 646464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 6, product* 4 * 8 * 7 * 6 * 4 * 6, index + 646784);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 6, product* 6 * 7 * 9 * 6 * 4 * 6, index + 646976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6, product* 2 * 3 * 2 * 7 * 4 * 6, index + 647232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6, product* 6 * 9 * 2 * 7 * 4 * 6, index + 647296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6, product* 4 * 2 * 4 * 7 * 4 * 6, index + 647424);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 6, product* 4 * 4 * 7 * 7 * 4 * 6, index + 647744);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 6, product* 6 * 3 * 9 * 7 * 4 * 6, index + 647936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 6, product* 4 * 8 * 3 * 8 * 4 * 6, index + 648384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 6, product* 8 * 4 * 4 * 8 * 4 * 6, index + 648448);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 6, product* 8 * 6 * 7 * 8 * 4 * 6, index + 648768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6, product* 2 * 3 * 8 * 8 * 4 * 6, index + 648832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 6, product* 4 * 4 * 3 * 9 * 4 * 6, index + 649344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6, product* 2 * 7 * 4 * 9 * 4 * 6, index + 649472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 6, product* 8 * 2 * 7 * 9 * 4 * 6, index + 649728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 6, product* 2 * 9 * 7 * 9 * 4 * 6, index + 649792);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 6, product* 4 * 8 * 9 * 9 * 4 * 6, index + 649984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6, product* 2 * 7 * 2 * 2 * 6 * 6, index + 662272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6, product* 6 * 3 * 3 * 2 * 6 * 6, index + 662336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6, product* 4 * 6 * 4 * 2 * 6 * 6, index + 662464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6, product* 4 * 8 * 7 * 2 * 6 * 6, index + 662784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6, product* 8 * 4 * 8 * 2 * 6 * 6, index + 662848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6, product* 2 * 3 * 2 * 3 * 6 * 6, index + 663232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6, product* 6 * 9 * 2 * 3 * 6 * 6, index + 663296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6, product* 4 * 2 * 4 * 3 * 6 * 6, index + 663424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 6, product* 8 * 8 * 4 * 3 * 6 * 6, index + 663488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6, product* 4 * 4 * 7 * 3 * 6 * 6, index + 663744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 6, product* 2 * 7 * 8 * 3 * 6 * 6, index + 663872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6, product* 6 * 3 * 9 * 3 * 6 * 6, index + 663936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 6, product* 4 * 8 * 3 * 4 * 6 * 6, index + 664384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6, product* 8 * 4 * 4 * 4 * 6 * 6, index + 664448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 6, product* 8 * 6 * 7 * 4 * 6 * 6, index + 664768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6, product* 2 * 3 * 8 * 4 * 6 * 6, index + 664832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 6, product* 8 * 6 * 3 * 6 * 6 * 6, index + 666368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6, product* 2 * 3 * 4 * 6 * 6 * 6, index + 666432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 6, product* 6 * 9 * 4 * 6 * 6 * 6, index + 666496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6, product* 4 * 2 * 6 * 6 * 6 * 6, index + 666624);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 6, product* 4 * 4 * 9 * 6 * 6 * 6, index + 666944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 6, product* 4 * 6 * 2 * 7 * 6 * 6, index + 667264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 6, product* 8 * 2 * 3 * 7 * 6 * 6, index + 667328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6, product* 2 * 9 * 3 * 7 * 6 * 6, index + 667392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 6, product* 8 * 4 * 6 * 7 * 6 * 6, index + 667648);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6, product* 4 * 2 * 2 * 8 * 6 * 6, index + 668224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 6, product* 8 * 8 * 2 * 8 * 6 * 6, index + 668288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 6, product* 2 * 7 * 6 * 8 * 6 * 6, index + 668672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 6, product* 8 * 2 * 9 * 8 * 6 * 6, index + 668928);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 6, product* 8 * 4 * 2 * 9 * 6 * 6, index + 669248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 6, product* 6 * 7 * 3 * 9 * 6 * 6, index + 669376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 6, product* 2 * 3 * 6 * 9 * 6 * 6, index + 669632);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 6 + 6, product* 6 * 9 * 6 * 9 * 6 * 6, index + 669696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 6, product* 4 * 2 * 8 * 9 * 6 * 6, index + 669824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6, product* 4 * 8 * 3 * 2 * 7 * 6, index + 672384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6, product* 8 * 4 * 4 * 2 * 7 * 6, index + 672448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 6, product* 8 * 6 * 7 * 2 * 7 * 6, index + 672768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6, product* 2 * 3 * 8 * 2 * 7 * 6, index + 672832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 6, product* 6 * 9 * 8 * 2 * 7 * 6, index + 672896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 6, product* 4 * 4 * 3 * 3 * 7 * 6, index + 673344);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 6, product* 4 * 6 * 6 * 3 * 7 * 6, index + 673664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 6, product* 8 * 2 * 7 * 3 * 7 * 6, index + 673728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 6, product* 2 * 9 * 7 * 3 * 7 * 6, index + 673792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6, product* 2 * 3 * 4 * 4 * 7 * 6, index + 674432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6, product* 4 * 2 * 6 * 4 * 7 * 6, index + 674624);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 6, product* 4 * 4 * 9 * 4 * 7 * 6, index + 674944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6, product* 4 * 2 * 2 * 6 * 7 * 6, index + 676224);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 6, product* 2 * 7 * 6 * 6 * 7 * 6, index + 676672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 6, product* 6 * 3 * 7 * 6 * 7 * 6, index + 676736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 6, product* 4 * 6 * 8 * 6 * 7 * 6, index + 676864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 6, product* 2 * 9 * 9 * 6 * 7 * 6, index + 676992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6, product* 8 * 4 * 2 * 7 * 7 * 6, index + 677248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6, product* 2 * 3 * 6 * 7 * 7 * 6, index + 677632);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 6, product* 6 * 9 * 6 * 7 * 7 * 6, index + 677696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 6, product* 4 * 2 * 8 * 7 * 7 * 6, index + 677824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6, product* 2 * 7 * 2 * 8 * 7 * 6, index + 678272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6, product* 6 * 3 * 3 * 8 * 7 * 6, index + 678336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 6, product* 4 * 6 * 4 * 8 * 7 * 6, index + 678464);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 6, product* 4 * 8 * 7 * 8 * 7 * 6, index + 678784);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6, product* 2 * 3 * 2 * 9 * 7 * 6, index + 679232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 6, product* 6 * 9 * 2 * 9 * 7 * 6, index + 679296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6, product* 4 * 2 * 4 * 9 * 7 * 6, index + 679424);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7 + 6, product* 2 * 7 * 8 * 9 * 7 * 6, index + 679872);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 6, product* 8 * 6 * 3 * 2 * 8 * 6, index + 682368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6, product* 2 * 3 * 4 * 2 * 8 * 6, index + 682432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6, product* 6 * 9 * 4 * 2 * 8 * 6, index + 682496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6, product* 4 * 2 * 6 * 2 * 8 * 6, index + 682624);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 6, product* 4 * 4 * 9 * 2 * 8 * 6, index + 682944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6, product* 4 * 6 * 2 * 3 * 8 * 6, index + 683264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6, product* 8 * 2 * 3 * 3 * 8 * 6, index + 683328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6, product* 2 * 9 * 3 * 3 * 8 * 6, index + 683392);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6, product* 4 * 2 * 2 * 4 * 8 * 6, index + 684224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 6, product* 8 * 8 * 2 * 4 * 8 * 6, index + 684288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 6, product* 2 * 7 * 6 * 4 * 8 * 6, index + 684672);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 6, product* 4 * 6 * 8 * 4 * 8 * 6, index + 684864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 6, product* 8 * 2 * 9 * 4 * 8 * 6, index + 684928);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6, product* 2 * 7 * 2 * 6 * 8 * 6, index + 686272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 6, product* 6 * 3 * 3 * 6 * 8 * 6, index + 686336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 6, product* 4 * 6 * 4 * 6 * 8 * 6, index + 686464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6, product* 2 * 3 * 2 * 7 * 8 * 6, index + 687232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 6, product* 6 * 9 * 2 * 7 * 8 * 6, index + 687296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 6, product* 4 * 2 * 4 * 7 * 8 * 6, index + 687424);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 6, product* 4 * 4 * 7 * 7 * 8 * 6, index + 687744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 6, product* 2 * 7 * 8 * 7 * 8 * 6, index + 687872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 6, product* 4 * 8 * 3 * 8 * 8 * 6, index + 688384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 6, product* 8 * 4 * 4 * 8 * 8 * 6, index + 688448);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 6, product* 4 * 4 * 3 * 9 * 8 * 6, index + 689344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 6, product* 2 * 7 * 4 * 9 * 8 * 6, index + 689472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 6, product* 4 * 6 * 6 * 9 * 8 * 6, index + 689664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 6, product* 8 * 2 * 7 * 9 * 8 * 6, index + 689728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 6, product* 2 * 9 * 7 * 9 * 8 * 6, index + 689792);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8 + 6, product* 4 * 8 * 9 * 9 * 8 * 6, index + 689984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6, product* 4 * 2 * 2 * 2 * 9 * 6, index + 692224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 6, product* 8 * 8 * 2 * 2 * 9 * 6, index + 692288);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 6, product* 6 * 3 * 7 * 2 * 9 * 6, index + 692736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6, product* 4 * 6 * 8 * 2 * 9 * 6, index + 692864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 6, product* 2 * 9 * 9 * 2 * 9 * 6, index + 692992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6, product* 8 * 4 * 2 * 3 * 9 * 6, index + 693248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6, product* 6 * 7 * 3 * 3 * 9 * 6, index + 693376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6, product* 2 * 3 * 6 * 3 * 9 * 6, index + 693632);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 6, product* 4 * 2 * 8 * 3 * 9 * 6, index + 693824);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6, product* 2 * 7 * 2 * 4 * 9 * 6, index + 694272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 6, product* 6 * 3 * 3 * 4 * 9 * 6, index + 694336);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 6, product* 8 * 4 * 8 * 4 * 9 * 6, index + 694848);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 6, product* 4 * 8 * 3 * 6 * 9 * 6, index + 696384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9 + 6, product* 8 * 4 * 4 * 6 * 9 * 6, index + 696448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6, product* 2 * 3 * 8 * 6 * 9 * 6, index + 696832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 6, product* 4 * 4 * 3 * 7 * 9 * 6, index + 697344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6, product* 2 * 7 * 4 * 7 * 9 * 6, index + 697472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 6, product* 8 * 2 * 7 * 7 * 9 * 6, index + 697728);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 6, product* 8 * 6 * 3 * 8 * 9 * 6, index + 698368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 6, product* 2 * 3 * 4 * 8 * 9 * 6, index + 698432);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 6, product* 4 * 2 * 6 * 8 * 9 * 6, index + 698624);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 6, product* 4 * 4 * 9 * 8 * 9 * 6, index + 698944);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 6, product* 4 * 6 * 2 * 9 * 9 * 6, index + 699264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 6, product* 2 * 9 * 3 * 9 * 9 * 6, index + 699392);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7, product* 8 * 6 * 3 * 2 * 2 * 7, index + 722368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7, product* 2 * 3 * 4 * 2 * 2 * 7, index + 722432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7, product* 6 * 9 * 4 * 2 * 2 * 7, index + 722496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7, product* 4 * 2 * 6 * 2 * 2 * 7, index + 722624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 7, product* 8 * 8 * 6 * 2 * 2 * 7, index + 722688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7, product* 4 * 4 * 9 * 2 * 2 * 7, index + 722944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7, product* 4 * 6 * 2 * 3 * 2 * 7, index + 723264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7, product* 8 * 2 * 3 * 3 * 2 * 7, index + 723328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7, product* 2 * 9 * 3 * 3 * 2 * 7, index + 723392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 7, product* 8 * 4 * 6 * 3 * 2 * 7, index + 723648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 7, product* 6 * 7 * 7 * 3 * 2 * 7, index + 723776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 7, product* 8 * 6 * 9 * 3 * 2 * 7, index + 723968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7, product* 4 * 2 * 2 * 4 * 2 * 7, index + 724224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7, product* 8 * 8 * 2 * 4 * 2 * 7, index + 724288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7, product* 2 * 7 * 6 * 4 * 2 * 7, index + 724672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7, product* 6 * 3 * 7 * 4 * 2 * 7, index + 724736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7, product* 4 * 6 * 8 * 4 * 2 * 7, index + 724864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 7, product* 8 * 2 * 9 * 4 * 2 * 7, index + 724928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7, product* 2 * 9 * 9 * 4 * 2 * 7, index + 724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7, product* 2 * 7 * 2 * 6 * 2 * 7, index + 726272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7, product* 6 * 3 * 3 * 6 * 2 * 7, index + 726336);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7, product* 4 * 8 * 7 * 6 * 2 * 7, index + 726784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 7, product* 8 * 4 * 8 * 6 * 2 * 7, index + 726848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 7, product* 6 * 7 * 9 * 6 * 2 * 7, index + 726976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7, product* 2 * 3 * 2 * 7 * 2 * 7, index + 727232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7, product* 6 * 9 * 2 * 7 * 2 * 7, index + 727296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7, product* 4 * 2 * 4 * 7 * 2 * 7, index + 727424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 7, product* 8 * 8 * 4 * 7 * 2 * 7, index + 727488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 7, product* 4 * 4 * 7 * 7 * 2 * 7, index + 727744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 7, product* 2 * 7 * 8 * 7 * 2 * 7, index + 727872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 7, product* 6 * 3 * 9 * 7 * 2 * 7, index + 727936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 7, product* 4 * 8 * 3 * 8 * 2 * 7, index + 728384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7, product* 8 * 4 * 4 * 8 * 2 * 7, index + 728448);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 7, product* 8 * 6 * 7 * 8 * 2 * 7, index + 728768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7, product* 2 * 3 * 8 * 8 * 2 * 7, index + 728832);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 7, product* 6 * 9 * 8 * 8 * 2 * 7, index + 728896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7, product* 4 * 4 * 3 * 9 * 2 * 7, index + 729344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7, product* 2 * 7 * 4 * 9 * 2 * 7, index + 729472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 7, product* 4 * 6 * 6 * 9 * 2 * 7, index + 729664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7, product* 8 * 2 * 7 * 9 * 2 * 7, index + 729728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 7, product* 4 * 8 * 9 * 9 * 2 * 7, index + 729984);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7, product* 4 * 2 * 2 * 2 * 3 * 7, index + 732224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7, product* 8 * 8 * 2 * 2 * 3 * 7, index + 732288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7, product* 2 * 7 * 6 * 2 * 3 * 7, index + 732672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7, product* 6 * 3 * 7 * 2 * 3 * 7, index + 732736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 7, product* 4 * 6 * 8 * 2 * 3 * 7, index + 732864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7, product* 8 * 2 * 9 * 2 * 3 * 7, index + 732928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7, product* 2 * 9 * 9 * 2 * 3 * 7, index + 732992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7, product* 8 * 4 * 2 * 3 * 3 * 7, index + 733248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 7, product* 6 * 7 * 3 * 3 * 3 * 7, index + 733376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7, product* 2 * 3 * 6 * 3 * 3 * 7, index + 733632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 7, product* 6 * 9 * 6 * 3 * 3 * 7, index + 733696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7, product* 4 * 2 * 8 * 3 * 3 * 7, index + 733824);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 7, product* 8 * 8 * 8 * 3 * 3 * 7, index + 733888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7, product* 2 * 7 * 2 * 4 * 3 * 7, index + 734272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7, product* 6 * 3 * 3 * 4 * 3 * 7, index + 734336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7, product* 4 * 6 * 4 * 4 * 3 * 7, index + 734464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 7, product* 4 * 8 * 7 * 4 * 3 * 7, index + 734784);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 7, product* 6 * 7 * 9 * 4 * 3 * 7, index + 734976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7, product* 4 * 8 * 3 * 6 * 3 * 7, index + 736384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 7, product* 8 * 4 * 4 * 6 * 3 * 7, index + 736448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7, product* 2 * 3 * 8 * 6 * 3 * 7, index + 736832);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 7, product* 6 * 9 * 8 * 6 * 3 * 7, index + 736896);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 7, product* 4 * 4 * 3 * 7 * 3 * 7, index + 737344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7, product* 2 * 7 * 4 * 7 * 3 * 7, index + 737472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7, product* 4 * 6 * 6 * 7 * 3 * 7, index + 737664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 7, product* 8 * 2 * 7 * 7 * 3 * 7, index + 737728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 7, product* 2 * 9 * 7 * 7 * 3 * 7, index + 737792);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 7, product* 8 * 6 * 3 * 8 * 3 * 7, index + 738368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7, product* 2 * 3 * 4 * 8 * 3 * 7, index + 738432);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7, product* 4 * 2 * 6 * 8 * 3 * 7, index + 738624);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 7, product* 8 * 8 * 6 * 8 * 3 * 7, index + 738688);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 7, product* 4 * 4 * 9 * 8 * 3 * 7, index + 738944);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 7, product* 4 * 6 * 2 * 9 * 3 * 7, index + 739264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7, product* 8 * 2 * 3 * 9 * 3 * 7, index + 739328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 7, product* 2 * 9 * 3 * 9 * 3 * 7, index + 739392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7, product* 2 * 7 * 2 * 2 * 4 * 7, index + 742272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7, product* 6 * 3 * 3 * 2 * 4 * 7, index + 742336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7, product* 4 * 6 * 4 * 2 * 4 * 7, index + 742464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7, product* 4 * 8 * 7 * 2 * 4 * 7, index + 742784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 7, product* 8 * 4 * 8 * 2 * 4 * 7, index + 742848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 7, product* 6 * 7 * 9 * 2 * 4 * 7, index + 742976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7, product* 2 * 3 * 2 * 3 * 4 * 7, index + 743232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7, product* 6 * 9 * 2 * 3 * 4 * 7, index + 743296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7, product* 4 * 2 * 4 * 3 * 4 * 7, index + 743424);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 7, product* 8 * 8 * 4 * 3 * 4 * 7, index + 743488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 7, product* 4 * 4 * 7 * 3 * 4 * 7, index + 743744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 7, product* 2 * 7 * 8 * 3 * 4 * 7, index + 743872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7, product* 6 * 3 * 9 * 3 * 4 * 7, index + 743936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 7, product* 4 * 8 * 3 * 4 * 4 * 7, index + 744384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 7, product* 8 * 4 * 4 * 4 * 4 * 7, index + 744448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 7, product* 8 * 6 * 7 * 4 * 4 * 7, index + 744768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7, product* 2 * 3 * 8 * 4 * 4 * 7, index + 744832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 7, product* 8 * 6 * 3 * 6 * 4 * 7, index + 746368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 7, product* 2 * 3 * 4 * 6 * 4 * 7, index + 746432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 7, product* 6 * 9 * 4 * 6 * 4 * 7, index + 746496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7, product* 4 * 2 * 6 * 6 * 4 * 7, index + 746624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 7, product* 8 * 8 * 6 * 6 * 4 * 7, index + 746688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 7, product* 4 * 4 * 9 * 6 * 4 * 7, index + 746944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7, product* 4 * 6 * 2 * 7 * 4 * 7, index + 747264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 7, product* 8 * 2 * 3 * 7 * 4 * 7, index + 747328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7, product* 2 * 9 * 3 * 7 * 4 * 7, index + 747392);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4 + 7, product* 6 * 7 * 7 * 7 * 4 * 7, index + 747776);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7, product* 4 * 2 * 2 * 8 * 4 * 7, index + 748224);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7, product* 2 * 7 * 6 * 8 * 4 * 7, index + 748672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 7, product* 6 * 3 * 7 * 8 * 4 * 7, index + 748736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 7, product* 4 * 6 * 8 * 8 * 4 * 7, index + 748864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 7, product* 8 * 2 * 9 * 8 * 4 * 7, index + 748928);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 7, product* 2 * 9 * 9 * 8 * 4 * 7, index + 748992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 7, product* 8 * 4 * 2 * 9 * 4 * 7, index + 749248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4 + 7, product* 6 * 7 * 3 * 9 * 4 * 7, index + 749376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 7, product* 2 * 3 * 6 * 9 * 4 * 7, index + 749632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 7, product* 4 * 2 * 8 * 9 * 4 * 7, index + 749824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7, product* 8 * 6 * 3 * 2 * 6 * 7, index + 762368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7, product* 2 * 3 * 4 * 2 * 6 * 7, index + 762432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 7, product* 6 * 9 * 4 * 2 * 6 * 7, index + 762496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7, product* 4 * 2 * 6 * 2 * 6 * 7, index + 762624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 7, product* 8 * 8 * 6 * 2 * 6 * 7, index + 762688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7, product* 4 * 4 * 9 * 2 * 6 * 7, index + 762944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7, product* 4 * 6 * 2 * 3 * 6 * 7, index + 763264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7, product* 2 * 9 * 3 * 3 * 6 * 7, index + 763392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 7, product* 6 * 7 * 7 * 3 * 6 * 7, index + 763776);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7, product* 4 * 2 * 2 * 4 * 6 * 7, index + 764224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 7, product* 8 * 8 * 2 * 4 * 6 * 7, index + 764288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 7, product* 2 * 7 * 6 * 4 * 6 * 7, index + 764672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 7, product* 6 * 3 * 7 * 4 * 6 * 7, index + 764736);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 7, product* 8 * 2 * 9 * 4 * 6 * 7, index + 764928);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 7, product* 2 * 7 * 2 * 6 * 6 * 7, index + 766272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7, product* 6 * 3 * 3 * 6 * 6 * 7, index + 766336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 7, product* 4 * 6 * 4 * 6 * 6 * 7, index + 766464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 7, product* 4 * 8 * 7 * 6 * 6 * 7, index + 766784);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 7, product* 8 * 4 * 8 * 6 * 6 * 7, index + 766848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6 + 7, product* 6 * 7 * 9 * 6 * 6 * 7, index + 766976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7, product* 2 * 3 * 2 * 7 * 6 * 7, index + 767232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 7, product* 6 * 9 * 2 * 7 * 6 * 7, index + 767296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 7, product* 4 * 2 * 4 * 7 * 6 * 7, index + 767424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 7, product* 6 * 3 * 9 * 7 * 6 * 7, index + 767936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 7, product* 4 * 8 * 3 * 8 * 6 * 7, index + 768384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 7, product* 8 * 4 * 4 * 8 * 6 * 7, index + 768448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 7, product* 2 * 3 * 8 * 8 * 6 * 7, index + 768832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 7, product* 4 * 4 * 3 * 9 * 6 * 7, index + 769344);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6 + 7, product* 4 * 6 * 6 * 9 * 6 * 7, index + 769664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7, product* 4 * 2 * 2 * 2 * 7 * 7, index + 772224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 7, product* 8 * 8 * 2 * 2 * 7 * 7, index + 772288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 7, product* 2 * 7 * 6 * 2 * 7 * 7, index + 772672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7, product* 6 * 3 * 7 * 2 * 7 * 7, index + 772736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 7, product* 4 * 6 * 8 * 2 * 7 * 7, index + 772864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 7, product* 8 * 2 * 9 * 2 * 7 * 7, index + 772928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 7, product* 2 * 9 * 9 * 2 * 7 * 7, index + 772992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7, product* 8 * 4 * 2 * 3 * 7 * 7, index + 773248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 7, product* 6 * 7 * 3 * 3 * 7 * 7, index + 773376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7, product* 2 * 3 * 6 * 3 * 7 * 7, index + 773632);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 7, product* 4 * 2 * 8 * 3 * 7 * 7, index + 773824);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7, product* 2 * 7 * 2 * 4 * 7 * 7, index + 774272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 7, product* 6 * 3 * 3 * 4 * 7 * 7, index + 774336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 7, product* 4 * 6 * 4 * 4 * 7 * 7, index + 774464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 7, product* 4 * 8 * 7 * 4 * 7 * 7, index + 774784);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 7, product* 6 * 7 * 9 * 4 * 7 * 7, index + 774976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 7, product* 4 * 8 * 3 * 6 * 7 * 7, index + 776384);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7, product* 8 * 4 * 4 * 6 * 7 * 7, index + 776448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7, product* 2 * 3 * 8 * 6 * 7 * 7, index + 776832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 7, product* 4 * 4 * 3 * 7 * 7 * 7, index + 777344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 7, product* 2 * 7 * 4 * 7 * 7 * 7, index + 777472);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 7, product* 4 * 8 * 9 * 7 * 7 * 7, index + 777984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 7, product* 8 * 6 * 3 * 8 * 7 * 7, index + 778368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 7, product* 2 * 3 * 4 * 8 * 7 * 7, index + 778432);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 7, product* 4 * 2 * 6 * 8 * 7 * 7, index + 778624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 7, product* 4 * 6 * 2 * 9 * 7 * 7, index + 779264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7, product* 8 * 2 * 3 * 9 * 7 * 7, index + 779328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 7, product* 2 * 9 * 3 * 9 * 7 * 7, index + 779392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 7 + 7, product* 8 * 4 * 6 * 9 * 7 * 7, index + 779648);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 7 + 7, product* 6 * 7 * 7 * 9 * 7 * 7, index + 779776);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 7, product* 6 * 3 * 9 * 9 * 7 * 7, index + 779936);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7, product* 2 * 7 * 2 * 2 * 8 * 7, index + 782272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7, product* 6 * 3 * 3 * 2 * 8 * 7, index + 782336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7, product* 4 * 6 * 4 * 2 * 8 * 7, index + 782464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7, product* 2 * 3 * 2 * 3 * 8 * 7, index + 783232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 7, product* 6 * 9 * 2 * 3 * 8 * 7, index + 783296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7, product* 4 * 2 * 4 * 3 * 8 * 7, index + 783424);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7, product* 4 * 4 * 7 * 3 * 8 * 7, index + 783744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 7, product* 2 * 7 * 8 * 3 * 8 * 7, index + 783872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 7, product* 6 * 3 * 9 * 3 * 8 * 7, index + 783936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 7, product* 4 * 8 * 3 * 4 * 8 * 7, index + 784384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7, product* 2 * 3 * 4 * 6 * 8 * 7, index + 786432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8 + 7, product* 6 * 9 * 4 * 6 * 8 * 7, index + 786496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 7, product* 4 * 2 * 6 * 6 * 8 * 7, index + 786624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 7, product* 4 * 6 * 2 * 7 * 8 * 7, index + 787264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7, product* 8 * 2 * 3 * 7 * 8 * 7, index + 787328);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8 + 7, product* 8 * 4 * 6 * 7 * 8 * 7, index + 787648);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7, product* 4 * 2 * 2 * 8 * 8 * 7, index + 788224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 7, product* 4 * 6 * 8 * 8 * 8 * 7, index + 788864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 7, product* 2 * 9 * 9 * 8 * 8 * 7, index + 788992);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 7, product* 2 * 3 * 6 * 9 * 8 * 7, index + 789632);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 8 + 7, product* 6 * 9 * 6 * 9 * 8 * 7, index + 789696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 7, product* 4 * 2 * 8 * 9 * 8 * 7, index + 789824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 7, product* 4 * 8 * 3 * 2 * 9 * 7, index + 792384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7, product* 8 * 4 * 4 * 2 * 9 * 7, index + 792448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7, product* 2 * 3 * 8 * 2 * 9 * 7, index + 792832);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 7, product* 2 * 9 * 9 * 2 * 9 * 7, index + 792992);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7, product* 4 * 4 * 3 * 3 * 9 * 7, index + 793344);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 9 + 7, product* 2 * 9 * 3 * 3 * 9 * 7, index + 793392);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7, product* 2 * 7 * 4 * 3 * 9 * 7, index + 793472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 7, product* 4 * 6 * 6 * 3 * 9 * 7, index + 793664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 7, product* 8 * 2 * 7 * 3 * 9 * 7, index + 793728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 7, product* 2 * 9 * 7 * 3 * 9 * 7, index + 793792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 7, product* 4 * 8 * 9 * 3 * 9 * 7, index + 793984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9 + 7, product* 8 * 6 * 3 * 4 * 9 * 7, index + 794368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7, product* 2 * 3 * 4 * 4 * 9 * 7, index + 794432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 7, product* 6 * 9 * 4 * 4 * 9 * 7, index + 794496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 7, product* 4 * 2 * 6 * 4 * 9 * 7, index + 794624);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9 + 7, product* 4 * 4 * 9 * 4 * 9 * 7, index + 794944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7, product* 4 * 2 * 2 * 6 * 9 * 7, index + 796224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 7, product* 8 * 8 * 2 * 6 * 9 * 7, index + 796288);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9 + 7, product* 6 * 3 * 7 * 6 * 9 * 7, index + 796736);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 7, product* 8 * 2 * 9 * 6 * 9 * 7, index + 796928);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9 + 7, product* 8 * 4 * 2 * 7 * 9 * 7, index + 797248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 7, product* 2 * 3 * 6 * 7 * 9 * 7, index + 797632);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 7, product* 4 * 2 * 8 * 7 * 9 * 7, index + 797824);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 9 + 7, product* 8 * 4 * 8 * 8 * 9 * 7, index + 798848);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7, product* 2 * 3 * 2 * 9 * 9 * 7, index + 799232);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 7, product* 4 * 2 * 4 * 9 * 9 * 7, index + 799424);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 7, product* 4 * 4 * 7 * 9 * 9 * 7, index + 799744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 9 + 7, product* 2 * 7 * 8 * 9 * 9 * 7, index + 799872);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8, product* 2 * 7 * 2 * 2 * 2 * 8, index + 822272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8, product* 6 * 3 * 3 * 2 * 2 * 8, index + 822336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8, product* 4 * 6 * 4 * 2 * 2 * 8, index + 822464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8, product* 4 * 8 * 7 * 2 * 2 * 8, index + 822784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 8, product* 8 * 4 * 8 * 2 * 2 * 8, index + 822848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 8, product* 6 * 7 * 9 * 2 * 2 * 8, index + 822976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8, product* 2 * 3 * 2 * 3 * 2 * 8, index + 823232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8, product* 6 * 9 * 2 * 3 * 2 * 8, index + 823296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8, product* 4 * 2 * 4 * 3 * 2 * 8, index + 823424);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8, product* 4 * 4 * 7 * 3 * 2 * 8, index + 823744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8, product* 2 * 7 * 8 * 3 * 2 * 8, index + 823872);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8, product* 6 * 3 * 9 * 3 * 2 * 8, index + 823936);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8, product* 4 * 8 * 3 * 4 * 2 * 8, index + 824384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8, product* 8 * 4 * 4 * 4 * 2 * 8, index + 824448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 8, product* 8 * 6 * 7 * 4 * 2 * 8, index + 824768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8, product* 2 * 3 * 8 * 4 * 2 * 8, index + 824832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8, product* 6 * 9 * 8 * 4 * 2 * 8, index + 824896);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 8, product* 8 * 6 * 3 * 6 * 2 * 8, index + 826368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8, product* 2 * 3 * 4 * 6 * 2 * 8, index + 826432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 8, product* 6 * 9 * 4 * 6 * 2 * 8, index + 826496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 8, product* 4 * 2 * 6 * 6 * 2 * 8, index + 826624);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 8, product* 4 * 4 * 9 * 6 * 2 * 8, index + 826944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8, product* 4 * 6 * 2 * 7 * 2 * 8, index + 827264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8, product* 8 * 2 * 3 * 7 * 2 * 8, index + 827328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8, product* 2 * 9 * 3 * 7 * 2 * 8, index + 827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8, product* 8 * 4 * 6 * 7 * 2 * 8, index + 827648);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 8, product* 8 * 6 * 9 * 7 * 2 * 8, index + 827968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8, product* 4 * 2 * 2 * 8 * 2 * 8, index + 828224);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 8, product* 2 * 7 * 6 * 8 * 2 * 8, index + 828672);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 8, product* 6 * 3 * 7 * 8 * 2 * 8, index + 828736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8, product* 8 * 4 * 2 * 9 * 2 * 8, index + 829248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 8, product* 6 * 7 * 3 * 9 * 2 * 8, index + 829376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8, product* 2 * 3 * 6 * 9 * 2 * 8, index + 829632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8, product* 4 * 2 * 8 * 9 * 2 * 8, index + 829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8, product* 4 * 8 * 3 * 2 * 3 * 8, index + 832384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 8, product* 8 * 4 * 4 * 2 * 3 * 8, index + 832448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 8, product* 8 * 6 * 7 * 2 * 3 * 8, index + 832768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8, product* 2 * 3 * 8 * 2 * 3 * 8, index + 832832);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 8, product* 6 * 9 * 8 * 2 * 3 * 8, index + 832896);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8, product* 4 * 4 * 3 * 3 * 3 * 8, index + 833344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8, product* 2 * 7 * 4 * 3 * 3 * 8, index + 833472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8, product* 4 * 6 * 6 * 3 * 3 * 8, index + 833664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8, product* 8 * 2 * 7 * 3 * 3 * 8, index + 833728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8, product* 2 * 9 * 7 * 3 * 3 * 8, index + 833792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 8, product* 4 * 8 * 9 * 3 * 3 * 8, index + 833984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 8, product* 8 * 6 * 3 * 4 * 3 * 8, index + 834368);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8, product* 2 * 3 * 4 * 4 * 3 * 8, index + 834432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8, product* 4 * 2 * 6 * 4 * 3 * 8, index + 834624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 8, product* 8 * 8 * 6 * 4 * 3 * 8, index + 834688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 8, product* 4 * 4 * 9 * 4 * 3 * 8, index + 834944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8, product* 4 * 2 * 2 * 6 * 3 * 8, index + 836224);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 8, product* 8 * 8 * 2 * 6 * 3 * 8, index + 836288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 8, product* 2 * 7 * 6 * 6 * 3 * 8, index + 836672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8, product* 6 * 3 * 7 * 6 * 3 * 8, index + 836736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 8, product* 4 * 6 * 8 * 6 * 3 * 8, index + 836864);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 8, product* 8 * 2 * 9 * 6 * 3 * 8, index + 836928);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 8, product* 2 * 9 * 9 * 6 * 3 * 8, index + 836992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 8, product* 8 * 4 * 2 * 7 * 3 * 8, index + 837248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8, product* 2 * 3 * 6 * 7 * 3 * 8, index + 837632);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8, product* 4 * 2 * 8 * 7 * 3 * 8, index + 837824);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8, product* 2 * 7 * 2 * 8 * 3 * 8, index + 838272);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 8, product* 4 * 6 * 4 * 8 * 3 * 8, index + 838464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8, product* 2 * 3 * 2 * 9 * 3 * 8, index + 839232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8, product* 6 * 9 * 2 * 9 * 3 * 8, index + 839296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8, product* 4 * 2 * 4 * 9 * 3 * 8, index + 839424);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 8, product* 4 * 4 * 7 * 9 * 3 * 8, index + 839744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 8, product* 2 * 7 * 8 * 9 * 3 * 8, index + 839872);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 8, product* 8 * 6 * 3 * 2 * 4 * 8, index + 842368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8, product* 2 * 3 * 4 * 2 * 4 * 8, index + 842432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 8, product* 6 * 9 * 4 * 2 * 4 * 8, index + 842496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8, product* 4 * 2 * 6 * 2 * 4 * 8, index + 842624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 8, product* 8 * 8 * 6 * 2 * 4 * 8, index + 842688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8, product* 4 * 4 * 9 * 2 * 4 * 8, index + 842944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8, product* 4 * 6 * 2 * 3 * 4 * 8, index + 843264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 8, product* 8 * 2 * 3 * 3 * 4 * 8, index + 843328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8, product* 2 * 9 * 3 * 3 * 4 * 8, index + 843392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 8, product* 8 * 4 * 6 * 3 * 4 * 8, index + 843648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 8, product* 6 * 7 * 7 * 3 * 4 * 8, index + 843776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 8, product* 8 * 6 * 9 * 3 * 4 * 8, index + 843968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8, product* 4 * 2 * 2 * 4 * 4 * 8, index + 844224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8, product* 8 * 8 * 2 * 4 * 4 * 8, index + 844288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8, product* 2 * 7 * 6 * 4 * 4 * 8, index + 844672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 8, product* 6 * 3 * 7 * 4 * 4 * 8, index + 844736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 8, product* 4 * 6 * 8 * 4 * 4 * 8, index + 844864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 8, product* 8 * 2 * 9 * 4 * 4 * 8, index + 844928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 8, product* 2 * 9 * 9 * 4 * 4 * 8, index + 844992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8, product* 2 * 7 * 2 * 6 * 4 * 8, index + 846272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8, product* 6 * 3 * 3 * 6 * 4 * 8, index + 846336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8, product* 4 * 6 * 4 * 6 * 4 * 8, index + 846464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 8, product* 4 * 8 * 7 * 6 * 4 * 8, index + 846784);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 8, product* 6 * 7 * 9 * 6 * 4 * 8, index + 846976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8, product* 2 * 3 * 2 * 7 * 4 * 8, index + 847232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 8, product* 4 * 2 * 4 * 7 * 4 * 8, index + 847424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 8, product* 8 * 8 * 4 * 7 * 4 * 8, index + 847488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8, product* 4 * 4 * 7 * 7 * 4 * 8, index + 847744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 8, product* 2 * 7 * 8 * 7 * 4 * 8, index + 847872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 8, product* 4 * 8 * 3 * 8 * 4 * 8, index + 848384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 8, product* 8 * 6 * 7 * 8 * 4 * 8, index + 848768);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 8, product* 2 * 7 * 4 * 9 * 4 * 8, index + 849472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 8, product* 4 * 6 * 6 * 9 * 4 * 8, index + 849664);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 8, product* 4 * 8 * 9 * 9 * 4 * 8, index + 849984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8, product* 2 * 7 * 2 * 2 * 6 * 8, index + 862272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8, product* 6 * 3 * 3 * 2 * 6 * 8, index + 862336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8, product* 4 * 6 * 4 * 2 * 6 * 8, index + 862464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 8, product* 4 * 8 * 7 * 2 * 6 * 8, index + 862784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 8, product* 8 * 4 * 8 * 2 * 6 * 8, index + 862848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 8, product* 6 * 7 * 9 * 2 * 6 * 8, index + 862976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8, product* 2 * 3 * 2 * 3 * 6 * 8, index + 863232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 8, product* 6 * 9 * 2 * 3 * 6 * 8, index + 863296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8, product* 4 * 2 * 4 * 3 * 6 * 8, index + 863424);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8, product* 4 * 4 * 7 * 3 * 6 * 8, index + 863744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8, product* 2 * 7 * 8 * 3 * 6 * 8, index + 863872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 8, product* 4 * 8 * 3 * 4 * 6 * 8, index + 864384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 8, product* 8 * 4 * 4 * 4 * 6 * 8, index + 864448);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 8, product* 8 * 6 * 7 * 4 * 6 * 8, index + 864768);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8, product* 2 * 3 * 8 * 4 * 6 * 8, index + 864832);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6 + 8, product* 6 * 9 * 8 * 4 * 6 * 8, index + 864896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8, product* 2 * 3 * 4 * 6 * 6 * 8, index + 866432);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 8, product* 6 * 9 * 4 * 6 * 6 * 8, index + 866496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 8, product* 4 * 2 * 6 * 6 * 6 * 8, index + 866624);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 8, product* 8 * 8 * 6 * 6 * 6 * 8, index + 866688);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 8, product* 4 * 6 * 2 * 7 * 6 * 8, index + 867264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 8, product* 8 * 2 * 3 * 7 * 6 * 8, index + 867328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 8, product* 2 * 9 * 3 * 7 * 6 * 8, index + 867392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 8, product* 8 * 4 * 6 * 7 * 6 * 8, index + 867648);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8, product* 4 * 2 * 2 * 8 * 6 * 8, index + 868224);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 8, product* 2 * 7 * 6 * 8 * 6 * 8, index + 868672);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 8, product* 4 * 6 * 8 * 8 * 6 * 8, index + 868864);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 8, product* 8 * 2 * 9 * 8 * 6 * 8, index + 868928);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 8, product* 8 * 4 * 2 * 9 * 6 * 8, index + 869248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 8, product* 6 * 7 * 3 * 9 * 6 * 8, index + 869376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8, product* 2 * 3 * 6 * 9 * 6 * 8, index + 869632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 8, product* 4 * 2 * 8 * 9 * 6 * 8, index + 869824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 8, product* 4 * 8 * 3 * 2 * 7 * 8, index + 872384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 8, product* 8 * 4 * 4 * 2 * 7 * 8, index + 872448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 8, product* 8 * 6 * 7 * 2 * 7 * 8, index + 872768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8, product* 2 * 3 * 8 * 2 * 7 * 8, index + 872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8, product* 4 * 4 * 3 * 3 * 7 * 8, index + 873344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 8, product* 2 * 7 * 4 * 3 * 7 * 8, index + 873472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 8, product* 4 * 6 * 6 * 3 * 7 * 8, index + 873664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 8, product* 8 * 2 * 7 * 3 * 7 * 8, index + 873728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 8, product* 2 * 9 * 7 * 3 * 7 * 8, index + 873792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 8, product* 4 * 8 * 9 * 3 * 7 * 8, index + 873984);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 8, product* 2 * 3 * 4 * 4 * 7 * 8, index + 874432);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 8, product* 6 * 9 * 4 * 4 * 7 * 8, index + 874496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8, product* 4 * 2 * 6 * 4 * 7 * 8, index + 874624);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8, product* 4 * 2 * 2 * 6 * 7 * 8, index + 876224);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 8, product* 2 * 7 * 6 * 6 * 7 * 8, index + 876672);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 8, product* 4 * 6 * 8 * 6 * 7 * 8, index + 876864);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 8, product* 8 * 2 * 9 * 6 * 7 * 8, index + 876928);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 8, product* 8 * 4 * 2 * 7 * 7 * 8, index + 877248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 8, product* 6 * 7 * 3 * 7 * 7 * 8, index + 877376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 8, product* 2 * 3 * 6 * 7 * 7 * 8, index + 877632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 8, product* 2 * 7 * 2 * 8 * 7 * 8, index + 878272);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 8, product* 6 * 3 * 3 * 8 * 7 * 8, index + 878336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 8, product* 4 * 6 * 4 * 8 * 7 * 8, index + 878464);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 8, product* 4 * 8 * 7 * 8 * 7 * 8, index + 878784);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 8, product* 6 * 7 * 9 * 8 * 7 * 8, index + 878976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8, product* 2 * 3 * 2 * 9 * 7 * 8, index + 879232);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 8, product* 4 * 2 * 4 * 9 * 7 * 8, index + 879424);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 8, product* 4 * 4 * 7 * 9 * 7 * 8, index + 879744);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 8, product* 6 * 3 * 9 * 9 * 7 * 8, index + 879936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 8, product* 8 * 6 * 3 * 2 * 8 * 8, index + 882368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8, product* 2 * 3 * 4 * 2 * 8 * 8, index + 882432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 8, product* 6 * 9 * 4 * 2 * 8 * 8, index + 882496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 8, product* 4 * 2 * 6 * 2 * 8 * 8, index + 882624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8, product* 4 * 6 * 2 * 3 * 8 * 8, index + 883264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8, product* 8 * 2 * 3 * 3 * 8 * 8, index + 883328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 8, product* 2 * 9 * 3 * 3 * 8 * 8, index + 883392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 8, product* 6 * 7 * 7 * 3 * 8 * 8, index + 883776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 8, product* 8 * 6 * 9 * 3 * 8 * 8, index + 883968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8, product* 4 * 2 * 2 * 4 * 8 * 8, index + 884224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 8, product* 8 * 8 * 2 * 4 * 8 * 8, index + 884288);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 8, product* 6 * 3 * 7 * 4 * 8 * 8, index + 884736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 8, product* 2 * 9 * 9 * 4 * 8 * 8, index + 884992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 8, product* 2 * 7 * 2 * 6 * 8 * 8, index + 886272);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 8, product* 4 * 6 * 4 * 6 * 8 * 8, index + 886464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 8, product* 8 * 4 * 8 * 6 * 8 * 8, index + 886848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8, product* 2 * 3 * 2 * 7 * 8 * 8, index + 887232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 8, product* 6 * 9 * 2 * 7 * 8 * 8, index + 887296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 8, product* 4 * 2 * 4 * 7 * 8 * 8, index + 887424);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 8, product* 4 * 4 * 7 * 7 * 8 * 8, index + 887744);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8 + 8, product* 6 * 3 * 9 * 7 * 8 * 8, index + 887936);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8 + 8, product* 6 * 9 * 8 * 8 * 8 * 8, index + 888896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 8, product* 4 * 4 * 3 * 9 * 8 * 8, index + 889344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 8, product* 2 * 7 * 4 * 9 * 8 * 8, index + 889472);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8, product* 4 * 2 * 2 * 2 * 9 * 8, index + 892224);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 8, product* 2 * 7 * 6 * 2 * 9 * 8, index + 892672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 8, product* 6 * 3 * 7 * 2 * 9 * 8, index + 892736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 8, product* 8 * 2 * 9 * 2 * 9 * 8, index + 892928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 8, product* 2 * 9 * 9 * 2 * 9 * 8, index + 892992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 8, product* 8 * 4 * 2 * 3 * 9 * 8, index + 893248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 8, product* 6 * 7 * 3 * 3 * 9 * 8, index + 893376);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8, product* 4 * 2 * 8 * 3 * 9 * 8, index + 893824);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 8, product* 2 * 7 * 2 * 4 * 9 * 8, index + 894272);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 8, product* 4 * 6 * 4 * 4 * 9 * 8, index + 894464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 8, product* 6 * 7 * 9 * 4 * 9 * 8, index + 894976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 8, product* 4 * 8 * 3 * 6 * 9 * 8, index + 896384);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 8, product* 2 * 3 * 8 * 6 * 9 * 8, index + 896832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 8, product* 4 * 4 * 3 * 7 * 9 * 8, index + 897344);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 8, product* 4 * 6 * 6 * 7 * 9 * 8, index + 897664);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 8, product* 2 * 9 * 7 * 7 * 9 * 8, index + 897792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 8, product* 2 * 3 * 4 * 8 * 9 * 8, index + 898432);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 8, product* 4 * 2 * 6 * 8 * 9 * 8, index + 898624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 8, product* 2 * 9 * 3 * 9 * 9 * 8, index + 899392);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9, product* 8 * 6 * 3 * 2 * 2 * 9, index + 922368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9, product* 2 * 3 * 4 * 2 * 2 * 9, index + 922432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9, product* 6 * 9 * 4 * 2 * 2 * 9, index + 922496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9, product* 4 * 2 * 6 * 2 * 2 * 9, index + 922624);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 9, product* 8 * 8 * 6 * 2 * 2 * 9, index + 922688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9, product* 4 * 4 * 9 * 2 * 2 * 9, index + 922944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9, product* 4 * 6 * 2 * 3 * 2 * 9, index + 923264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9, product* 8 * 2 * 3 * 3 * 2 * 9, index + 923328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9, product* 2 * 9 * 3 * 3 * 2 * 9, index + 923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9, product* 8 * 4 * 6 * 3 * 2 * 9, index + 923648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 9, product* 6 * 7 * 7 * 3 * 2 * 9, index + 923776);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 9, product* 8 * 6 * 9 * 3 * 2 * 9, index + 923968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9, product* 4 * 2 * 2 * 4 * 2 * 9, index + 924224);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9, product* 8 * 8 * 2 * 4 * 2 * 9, index + 924288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9, product* 2 * 7 * 6 * 4 * 2 * 9, index + 924672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9, product* 6 * 3 * 7 * 4 * 2 * 9, index + 924736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 9, product* 4 * 6 * 8 * 4 * 2 * 9, index + 924864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9, product* 8 * 2 * 9 * 4 * 2 * 9, index + 924928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 9, product* 2 * 9 * 9 * 4 * 2 * 9, index + 924992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9, product* 2 * 7 * 2 * 6 * 2 * 9, index + 926272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9, product* 6 * 3 * 3 * 6 * 2 * 9, index + 926336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 9, product* 4 * 6 * 4 * 6 * 2 * 9, index + 926464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 9, product* 4 * 8 * 7 * 6 * 2 * 9, index + 926784);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9, product* 2 * 3 * 2 * 7 * 2 * 9, index + 927232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9, product* 6 * 9 * 2 * 7 * 2 * 9, index + 927296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9, product* 4 * 2 * 4 * 7 * 2 * 9, index + 927424);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 9, product* 8 * 8 * 4 * 7 * 2 * 9, index + 927488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 9, product* 4 * 4 * 7 * 7 * 2 * 9, index + 927744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 9, product* 2 * 7 * 8 * 7 * 2 * 9, index + 927872);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 9, product* 6 * 3 * 9 * 7 * 2 * 9, index + 927936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9, product* 4 * 8 * 3 * 8 * 2 * 9, index + 928384);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 9, product* 8 * 4 * 4 * 8 * 2 * 9, index + 928448);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 9, product* 8 * 6 * 7 * 8 * 2 * 9, index + 928768);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 9, product* 2 * 3 * 8 * 8 * 2 * 9, index + 928832);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 9, product* 6 * 9 * 8 * 8 * 2 * 9, index + 928896);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 9, product* 4 * 4 * 3 * 9 * 2 * 9, index + 929344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9, product* 2 * 7 * 4 * 9 * 2 * 9, index + 929472);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 9, product* 4 * 6 * 6 * 9 * 2 * 9, index + 929664);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 9, product* 8 * 2 * 7 * 9 * 2 * 9, index + 929728);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9, product* 4 * 2 * 2 * 2 * 3 * 9, index + 932224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 9, product* 8 * 8 * 2 * 2 * 3 * 9, index + 932288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9, product* 2 * 7 * 6 * 2 * 3 * 9, index + 932672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9, product* 6 * 3 * 7 * 2 * 3 * 9, index + 932736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 9, product* 4 * 6 * 8 * 2 * 3 * 9, index + 932864);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 9, product* 8 * 2 * 9 * 2 * 3 * 9, index + 932928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9, product* 2 * 9 * 9 * 2 * 3 * 9, index + 932992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9, product* 8 * 4 * 2 * 3 * 3 * 9, index + 933248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 9, product* 6 * 7 * 3 * 3 * 3 * 9, index + 933376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9, product* 2 * 3 * 6 * 3 * 3 * 9, index + 933632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 9, product* 6 * 9 * 6 * 3 * 3 * 9, index + 933696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9, product* 4 * 2 * 8 * 3 * 3 * 9, index + 933824);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9, product* 2 * 7 * 2 * 4 * 3 * 9, index + 934272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9, product* 6 * 3 * 3 * 4 * 3 * 9, index + 934336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 9, product* 4 * 6 * 4 * 4 * 3 * 9, index + 934464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 9, product* 4 * 8 * 7 * 4 * 3 * 9, index + 934784);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 9, product* 6 * 7 * 9 * 4 * 3 * 9, index + 934976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 9, product* 4 * 8 * 3 * 6 * 3 * 9, index + 936384);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9, product* 2 * 3 * 8 * 6 * 3 * 9, index + 936832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9, product* 4 * 4 * 3 * 7 * 3 * 9, index + 937344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 9, product* 2 * 7 * 4 * 7 * 3 * 9, index + 937472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 9, product* 4 * 6 * 6 * 7 * 3 * 9, index + 937664);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9, product* 8 * 2 * 7 * 7 * 3 * 9, index + 937728);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 9, product* 2 * 9 * 7 * 7 * 3 * 9, index + 937792);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 9, product* 8 * 6 * 3 * 8 * 3 * 9, index + 938368);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9, product* 2 * 3 * 4 * 8 * 3 * 9, index + 938432);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3 + 9, product* 6 * 9 * 4 * 8 * 3 * 9, index + 938496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 9, product* 4 * 2 * 6 * 8 * 3 * 9, index + 938624);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 9, product* 4 * 4 * 9 * 8 * 3 * 9, index + 938944);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 9, product* 4 * 6 * 2 * 9 * 3 * 9, index + 939264);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 9, product* 8 * 2 * 3 * 9 * 3 * 9, index + 939328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 9, product* 2 * 9 * 3 * 9 * 3 * 9, index + 939392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 9, product* 8 * 4 * 6 * 9 * 3 * 9, index + 939648);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3 + 9, product* 8 * 6 * 9 * 9 * 3 * 9, index + 939968);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9, product* 2 * 7 * 2 * 2 * 4 * 9, index + 942272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9, product* 6 * 3 * 3 * 2 * 4 * 9, index + 942336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9, product* 4 * 6 * 4 * 2 * 4 * 9, index + 942464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 9, product* 8 * 4 * 8 * 2 * 4 * 9, index + 942848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 9, product* 6 * 7 * 9 * 2 * 4 * 9, index + 942976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9, product* 2 * 3 * 2 * 3 * 4 * 9, index + 943232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 9, product* 6 * 9 * 2 * 3 * 4 * 9, index + 943296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9, product* 4 * 2 * 4 * 3 * 4 * 9, index + 943424);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9, product* 4 * 4 * 7 * 3 * 4 * 9, index + 943744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9, product* 2 * 7 * 8 * 3 * 4 * 9, index + 943872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9, product* 4 * 8 * 3 * 4 * 4 * 9, index + 944384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 9, product* 8 * 4 * 4 * 4 * 4 * 9, index + 944448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9, product* 2 * 3 * 8 * 4 * 4 * 9, index + 944832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 9, product* 8 * 6 * 3 * 6 * 4 * 9, index + 946368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9, product* 2 * 3 * 4 * 6 * 4 * 9, index + 946432);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 9, product* 4 * 2 * 6 * 6 * 4 * 9, index + 946624);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 9, product* 4 * 4 * 9 * 6 * 4 * 9, index + 946944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 9, product* 4 * 6 * 2 * 7 * 4 * 9, index + 947264);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9, product* 8 * 2 * 3 * 7 * 4 * 9, index + 947328);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 9, product* 2 * 9 * 3 * 7 * 4 * 9, index + 947392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 9, product* 8 * 4 * 6 * 7 * 4 * 9, index + 947648);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9, product* 4 * 2 * 2 * 8 * 4 * 9, index + 948224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 9, product* 8 * 8 * 2 * 8 * 4 * 9, index + 948288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 9, product* 2 * 7 * 6 * 8 * 4 * 9, index + 948672);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 9, product* 4 * 6 * 8 * 8 * 4 * 9, index + 948864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 9, product* 8 * 4 * 2 * 9 * 4 * 9, index + 949248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4 + 9, product* 6 * 7 * 3 * 9 * 4 * 9, index + 949376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9, product* 2 * 3 * 6 * 9 * 4 * 9, index + 949632);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 9, product* 4 * 2 * 8 * 9 * 4 * 9, index + 949824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 9, product* 8 * 6 * 3 * 2 * 6 * 9, index + 962368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9, product* 2 * 3 * 4 * 2 * 6 * 9, index + 962432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9, product* 4 * 2 * 6 * 2 * 6 * 9, index + 962624);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 9, product* 4 * 4 * 9 * 2 * 6 * 9, index + 962944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 9, product* 4 * 6 * 2 * 3 * 6 * 9, index + 963264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9, product* 8 * 2 * 3 * 3 * 6 * 9, index + 963328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 9, product* 2 * 9 * 3 * 3 * 6 * 9, index + 963392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 9, product* 8 * 4 * 6 * 3 * 6 * 9, index + 963648);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9, product* 4 * 2 * 2 * 4 * 6 * 9, index + 964224);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 9, product* 2 * 7 * 6 * 4 * 6 * 9, index + 964672);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 9, product* 6 * 3 * 7 * 4 * 6 * 9, index + 964736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 9, product* 4 * 6 * 8 * 4 * 6 * 9, index + 964864);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 9, product* 8 * 2 * 9 * 4 * 6 * 9, index + 964928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6 + 9, product* 2 * 9 * 9 * 4 * 6 * 9, index + 964992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 9, product* 2 * 7 * 2 * 6 * 6 * 9, index + 966272);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 9, product* 4 * 6 * 4 * 6 * 6 * 9, index + 966464);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 9, product* 4 * 8 * 7 * 6 * 6 * 9, index + 966784);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9, product* 2 * 3 * 2 * 7 * 6 * 9, index + 967232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 9, product* 6 * 9 * 2 * 7 * 6 * 9, index + 967296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 9, product* 4 * 2 * 4 * 7 * 6 * 9, index + 967424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 9, product* 6 * 3 * 9 * 7 * 6 * 9, index + 967936);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 9, product* 4 * 8 * 3 * 8 * 6 * 9, index + 968384);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 9, product* 2 * 3 * 8 * 8 * 6 * 9, index + 968832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 9, product* 4 * 4 * 3 * 9 * 6 * 9, index + 969344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 9, product* 2 * 7 * 4 * 9 * 6 * 9, index + 969472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 9, product* 8 * 2 * 7 * 9 * 6 * 9, index + 969728);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9, product* 4 * 2 * 2 * 2 * 7 * 9, index + 972224);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 9, product* 8 * 8 * 2 * 2 * 7 * 9, index + 972288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 9, product* 2 * 7 * 6 * 2 * 7 * 9, index + 972672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 9, product* 6 * 3 * 7 * 2 * 7 * 9, index + 972736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 9, product* 8 * 2 * 9 * 2 * 7 * 9, index + 972928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 9, product* 2 * 9 * 9 * 2 * 7 * 9, index + 972992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 9, product* 8 * 4 * 2 * 3 * 7 * 9, index + 973248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9, product* 2 * 3 * 6 * 3 * 7 * 9, index + 973632);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 9, product* 4 * 2 * 8 * 3 * 7 * 9, index + 973824);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9, product* 2 * 7 * 2 * 4 * 7 * 9, index + 974272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 9, product* 6 * 3 * 3 * 4 * 7 * 9, index + 974336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 9, product* 4 * 6 * 4 * 4 * 7 * 9, index + 974464);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 9, product* 4 * 8 * 7 * 4 * 7 * 9, index + 974784);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 9, product* 6 * 7 * 9 * 4 * 7 * 9, index + 974976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 9, product* 4 * 8 * 3 * 6 * 7 * 9, index + 976384);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 9, product* 2 * 3 * 8 * 6 * 7 * 9, index + 976832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 9, product* 4 * 4 * 3 * 7 * 7 * 9, index + 977344);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 9, product* 8 * 2 * 7 * 7 * 7 * 9, index + 977728);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9, product* 2 * 3 * 4 * 8 * 7 * 9, index + 978432);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 9, product* 6 * 9 * 4 * 8 * 7 * 9, index + 978496);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 9, product* 4 * 4 * 9 * 8 * 7 * 9, index + 978944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 9, product* 8 * 2 * 3 * 9 * 7 * 9, index + 979328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 9, product* 2 * 9 * 3 * 9 * 7 * 9, index + 979392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9, product* 2 * 7 * 2 * 2 * 8 * 9, index + 982272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 9, product* 6 * 3 * 3 * 2 * 8 * 9, index + 982336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 9, product* 4 * 6 * 4 * 2 * 8 * 9, index + 982464);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 9, product* 4 * 8 * 7 * 2 * 8 * 9, index + 982784);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 9, product* 8 * 4 * 8 * 2 * 8 * 9, index + 982848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9, product* 2 * 3 * 2 * 3 * 8 * 9, index + 983232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 9, product* 6 * 9 * 2 * 3 * 8 * 9, index + 983296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9, product* 4 * 2 * 4 * 3 * 8 * 9, index + 983424);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 9, product* 4 * 8 * 3 * 4 * 8 * 9, index + 984384);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 9, product* 8 * 4 * 4 * 4 * 8 * 9, index + 984448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 9, product* 2 * 3 * 8 * 4 * 8 * 9, index + 984832);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 9, product* 2 * 3 * 4 * 6 * 8 * 9, index + 986432);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 9, product* 4 * 2 * 6 * 6 * 8 * 9, index + 986624);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 9, product* 4 * 4 * 9 * 6 * 8 * 9, index + 986944);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 9, product* 4 * 6 * 2 * 7 * 8 * 9, index + 987264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 9, product* 2 * 9 * 3 * 7 * 8 * 9, index + 987392);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 8 + 9, product* 6 * 7 * 7 * 7 * 8 * 9, index + 987776);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 9, product* 4 * 2 * 2 * 8 * 8 * 9, index + 988224);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 9, product* 2 * 7 * 6 * 8 * 8 * 9, index + 988672);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 9, product* 8 * 4 * 2 * 9 * 8 * 9, index + 989248);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 9, product* 4 * 2 * 8 * 9 * 8 * 9, index + 989824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9, product* 4 * 8 * 3 * 2 * 9 * 9, index + 992384);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 9, product* 8 * 4 * 4 * 2 * 9 * 9, index + 992448);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 9, product* 8 * 6 * 7 * 2 * 9 * 9, index + 992768);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9, product* 2 * 3 * 8 * 2 * 9 * 9, index + 992832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 9, product* 4 * 4 * 3 * 3 * 9 * 9, index + 993344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 9, product* 2 * 7 * 4 * 3 * 9 * 9, index + 993472);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 9, product* 4 * 6 * 6 * 3 * 9 * 9, index + 993664);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 9, product* 8 * 2 * 7 * 3 * 9 * 9, index + 993728);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9, product* 2 * 3 * 4 * 4 * 9 * 9, index + 994432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 9, product* 4 * 2 * 6 * 4 * 9 * 9, index + 994624);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9 + 9, product* 8 * 8 * 6 * 4 * 9 * 9, index + 994688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9 + 9, product* 4 * 4 * 9 * 4 * 9 * 9, index + 994944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 9, product* 4 * 2 * 2 * 6 * 9 * 9, index + 996224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9 + 9, product* 8 * 4 * 2 * 7 * 9 * 9, index + 997248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9 + 9, product* 6 * 7 * 3 * 7 * 9 * 9, index + 997376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 9, product* 2 * 3 * 6 * 7 * 9 * 9, index + 997632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9 + 9, product* 2 * 7 * 2 * 8 * 9 * 9, index + 998272);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 9, product* 4 * 6 * 4 * 8 * 9 * 9, index + 998464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 9 + 9, product* 6 * 7 * 9 * 8 * 9 * 9, index + 998976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 9, product* 2 * 3 * 2 * 9 * 9 * 9, index + 999232);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 9, product* 4 * 2 * 4 * 9 * 9 * 9, index + 999424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 9 + 9, product* 6 * 3 * 9 * 9 * 9 * 9, index + 999936);
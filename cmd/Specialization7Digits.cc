@@ -1,3803 +0,0 @@
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 2, product* 6 * 3 * 3 * 2 * 2 * 2 * 2, index + 2222336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 2, product* 4 * 6 * 4 * 2 * 2 * 2 * 2, index + 2222464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 2, product* 8 * 4 * 8 * 2 * 2 * 2 * 2, index + 2222848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 2, product* 6 * 7 * 9 * 2 * 2 * 2 * 2, index + 2222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 2, product* 2 * 3 * 2 * 3 * 2 * 2 * 2, index + 2223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 2, product* 8 * 8 * 4 * 3 * 2 * 2 * 2, index + 2223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 2, product* 4 * 4 * 7 * 3 * 2 * 2 * 2, index + 2223744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 2, product* 2 * 7 * 8 * 3 * 2 * 2 * 2, index + 2223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 2, product* 4 * 8 * 3 * 4 * 2 * 2 * 2, index + 2224384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 2, product* 8 * 6 * 7 * 4 * 2 * 2 * 2, index + 2224768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 2, product* 6 * 9 * 8 * 4 * 2 * 2 * 2, index + 2224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 2, product* 2 * 3 * 4 * 6 * 2 * 2 * 2, index + 2226432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 2 + 2, product* 8 * 8 * 6 * 6 * 2 * 2 * 2, index + 2226688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 2, product* 4 * 4 * 9 * 6 * 2 * 2 * 2, index + 2226944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 2, product* 8 * 2 * 3 * 7 * 2 * 2 * 2, index + 2227328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 2 + 2, product* 8 * 6 * 9 * 7 * 2 * 2 * 2, index + 2227968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 2, product* 4 * 2 * 2 * 8 * 2 * 2 * 2, index + 2228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 2, product* 6 * 3 * 7 * 8 * 2 * 2 * 2, index + 2228736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 2, product* 4 * 6 * 8 * 8 * 2 * 2 * 2, index + 2228864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 2, product* 2 * 9 * 9 * 8 * 2 * 2 * 2, index + 2228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 2, product* 8 * 4 * 2 * 9 * 2 * 2 * 2, index + 2229248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 2, product* 6 * 7 * 3 * 9 * 2 * 2 * 2, index + 2229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 2, product* 2 * 3 * 6 * 9 * 2 * 2 * 2, index + 2229632);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 2 + 2 + 2, product* 8 * 8 * 8 * 9 * 2 * 2 * 2, index + 2229888);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 2, product* 8 * 4 * 4 * 2 * 3 * 2 * 2, index + 2232448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 2, product* 2 * 3 * 8 * 2 * 3 * 2 * 2, index + 2232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 2, product* 4 * 4 * 3 * 3 * 3 * 2 * 2, index + 2233344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 2, product* 2 * 7 * 4 * 3 * 3 * 2 * 2, index + 2233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 2, product* 8 * 2 * 7 * 3 * 3 * 2 * 2, index + 2233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 2, product* 4 * 8 * 9 * 3 * 3 * 2 * 2, index + 2233984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 2, product* 8 * 6 * 3 * 4 * 3 * 2 * 2, index + 2234368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 2, product* 6 * 9 * 4 * 4 * 3 * 2 * 2, index + 2234496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 2, product* 4 * 2 * 6 * 4 * 3 * 2 * 2, index + 2234624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 2, product* 8 * 8 * 2 * 6 * 3 * 2 * 2, index + 2236288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 2, product* 2 * 7 * 6 * 6 * 3 * 2 * 2, index + 2236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 2, product* 8 * 2 * 9 * 6 * 3 * 2 * 2, index + 2236928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 2, product* 6 * 9 * 6 * 7 * 3 * 2 * 2, index + 2237696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 2, product* 4 * 2 * 8 * 7 * 3 * 2 * 2, index + 2237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 2, product* 6 * 3 * 3 * 8 * 3 * 2 * 2, index + 2238336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 2, product* 4 * 6 * 4 * 8 * 3 * 2 * 2, index + 2238464);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 2 + 2, product* 8 * 4 * 8 * 8 * 3 * 2 * 2, index + 2238848);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2 + 2, product* 6 * 7 * 9 * 8 * 3 * 2 * 2, index + 2238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 2, product* 2 * 3 * 2 * 9 * 3 * 2 * 2, index + 2239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 2, product* 8 * 8 * 4 * 9 * 3 * 2 * 2, index + 2239488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2 + 2, product* 4 * 4 * 7 * 9 * 3 * 2 * 2, index + 2239744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 2, product* 2 * 7 * 8 * 9 * 3 * 2 * 2, index + 2239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 2, product* 2 * 3 * 4 * 2 * 4 * 2 * 2, index + 2242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 2, product* 8 * 8 * 6 * 2 * 4 * 2 * 2, index + 2242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 2, product* 4 * 4 * 9 * 2 * 4 * 2 * 2, index + 2242944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 2, product* 8 * 2 * 3 * 3 * 4 * 2 * 2, index + 2243328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 2, product* 2 * 9 * 3 * 3 * 4 * 2 * 2, index + 2243392);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 2, product* 4 * 2 * 2 * 4 * 4 * 2 * 2, index + 2244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 2, product* 6 * 3 * 7 * 4 * 4 * 2 * 2, index + 2244736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 2, product* 4 * 6 * 8 * 4 * 4 * 2 * 2, index + 2244864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 2, product* 2 * 9 * 9 * 4 * 4 * 2 * 2, index + 2244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 2, product* 2 * 7 * 2 * 6 * 4 * 2 * 2, index + 2246272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 2 + 2, product* 4 * 8 * 7 * 6 * 4 * 2 * 2, index + 2246784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 2, product* 6 * 9 * 2 * 7 * 4 * 2 * 2, index + 2247296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 2, product* 4 * 2 * 4 * 7 * 4 * 2 * 2, index + 2247424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 2, product* 6 * 3 * 9 * 7 * 4 * 2 * 2, index + 2247936);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 2, product* 2 * 3 * 8 * 8 * 4 * 2 * 2, index + 2248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 2, product* 4 * 4 * 3 * 9 * 4 * 2 * 2, index + 2249344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 2, product* 2 * 7 * 4 * 9 * 4 * 2 * 2, index + 2249472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 2, product* 8 * 2 * 7 * 9 * 4 * 2 * 2, index + 2249728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 2 + 2, product* 4 * 8 * 9 * 9 * 4 * 2 * 2, index + 2249984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 2, product* 2 * 7 * 2 * 2 * 6 * 2 * 2, index + 2262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 2, product* 4 * 8 * 7 * 2 * 6 * 2 * 2, index + 2262784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 2, product* 6 * 9 * 2 * 3 * 6 * 2 * 2, index + 2263296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 2, product* 4 * 2 * 4 * 3 * 6 * 2 * 2, index + 2263424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2 + 2, product* 6 * 3 * 9 * 3 * 6 * 2 * 2, index + 2263936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 2, product* 8 * 4 * 4 * 4 * 6 * 2 * 2, index + 2264448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 2, product* 2 * 3 * 8 * 4 * 6 * 2 * 2, index + 2264832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 2 + 2, product* 8 * 6 * 3 * 6 * 6 * 2 * 2, index + 2266368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 2, product* 4 * 2 * 6 * 6 * 6 * 2 * 2, index + 2266624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 2, product* 4 * 6 * 2 * 7 * 6 * 2 * 2, index + 2267264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 2, product* 2 * 9 * 3 * 7 * 6 * 2 * 2, index + 2267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 2, product* 8 * 4 * 6 * 7 * 6 * 2 * 2, index + 2267648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 2 + 2, product* 6 * 7 * 7 * 7 * 6 * 2 * 2, index + 2267776);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 2 + 2, product* 8 * 8 * 2 * 8 * 6 * 2 * 2, index + 2268288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 2, product* 2 * 7 * 6 * 8 * 6 * 2 * 2, index + 2268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 2, product* 8 * 2 * 9 * 8 * 6 * 2 * 2, index + 2268928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 2, product* 4 * 2 * 8 * 9 * 6 * 2 * 2, index + 2269824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 2, product* 4 * 8 * 3 * 2 * 7 * 2 * 2, index + 2272384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 2, product* 8 * 6 * 7 * 2 * 7 * 2 * 2, index + 2272768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 2, product* 6 * 9 * 8 * 2 * 7 * 2 * 2, index + 2272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 2, product* 4 * 6 * 6 * 3 * 7 * 2 * 2, index + 2273664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 2, product* 2 * 9 * 7 * 3 * 7 * 2 * 2, index + 2273792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 2, product* 2 * 3 * 4 * 4 * 7 * 2 * 2, index + 2274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 2, product* 4 * 4 * 9 * 4 * 7 * 2 * 2, index + 2274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 2, product* 4 * 2 * 2 * 6 * 7 * 2 * 2, index + 2276224);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 2 + 2, product* 4 * 6 * 8 * 6 * 7 * 2 * 2, index + 2276864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 2 + 2, product* 2 * 9 * 9 * 6 * 7 * 2 * 2, index + 2276992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 2, product* 8 * 4 * 2 * 7 * 7 * 2 * 2, index + 2277248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 2 + 2, product* 6 * 7 * 3 * 7 * 7 * 2 * 2, index + 2277376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 2, product* 2 * 3 * 6 * 7 * 7 * 2 * 2, index + 2277632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 2, product* 2 * 7 * 2 * 8 * 7 * 2 * 2, index + 2278272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 2 + 2, product* 4 * 8 * 7 * 8 * 7 * 2 * 2, index + 2278784);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 2, product* 4 * 2 * 4 * 9 * 7 * 2 * 2, index + 2279424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 2 + 2, product* 6 * 3 * 9 * 9 * 7 * 2 * 2, index + 2279936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 2, product* 8 * 6 * 3 * 2 * 8 * 2 * 2, index + 2282368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2 + 2, product* 6 * 9 * 4 * 2 * 8 * 2 * 2, index + 2282496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 2, product* 4 * 2 * 6 * 2 * 8 * 2 * 2, index + 2282624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 2, product* 4 * 6 * 2 * 3 * 8 * 2 * 2, index + 2283264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 2, product* 2 * 9 * 3 * 3 * 8 * 2 * 2, index + 2283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 2, product* 8 * 4 * 6 * 3 * 8 * 2 * 2, index + 2283648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 2 + 2, product* 6 * 7 * 7 * 3 * 8 * 2 * 2, index + 2283776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 2, product* 8 * 8 * 2 * 4 * 8 * 2 * 2, index + 2284288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 2, product* 2 * 7 * 6 * 4 * 8 * 2 * 2, index + 2284672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 2, product* 8 * 2 * 9 * 4 * 8 * 2 * 2, index + 2284928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 2, product* 6 * 3 * 3 * 6 * 8 * 2 * 2, index + 2286336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 2, product* 4 * 6 * 4 * 6 * 8 * 2 * 2, index + 2286464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 2 + 2, product* 8 * 4 * 8 * 6 * 8 * 2 * 2, index + 2286848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 8 + 2 + 2, product* 6 * 7 * 9 * 6 * 8 * 2 * 2, index + 2286976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 2, product* 2 * 3 * 2 * 7 * 8 * 2 * 2, index + 2287232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 2 + 2, product* 4 * 4 * 7 * 7 * 8 * 2 * 2, index + 2287744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 2 + 2, product* 2 * 7 * 8 * 7 * 8 * 2 * 2, index + 2287872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2 + 2, product* 4 * 8 * 3 * 8 * 8 * 2 * 2, index + 2288384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8 + 2 + 2, product* 8 * 6 * 7 * 8 * 8 * 2 * 2, index + 2288768);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8 + 2 + 2, product* 6 * 9 * 8 * 8 * 8 * 2 * 2, index + 2288896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 2, product* 4 * 6 * 6 * 9 * 8 * 2 * 2, index + 2289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 2, product* 4 * 2 * 2 * 2 * 9 * 2 * 2, index + 2292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 2, product* 6 * 3 * 7 * 2 * 9 * 2 * 2, index + 2292736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 2, product* 4 * 6 * 8 * 2 * 9 * 2 * 2, index + 2292864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 2, product* 2 * 9 * 9 * 2 * 9 * 2 * 2, index + 2292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 2, product* 8 * 4 * 2 * 3 * 9 * 2 * 2, index + 2293248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 2, product* 6 * 7 * 3 * 3 * 9 * 2 * 2, index + 2293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 2, product* 2 * 3 * 6 * 3 * 9 * 2 * 2, index + 2293632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2 + 2, product* 8 * 8 * 8 * 3 * 9 * 2 * 2, index + 2293888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 2, product* 2 * 7 * 2 * 4 * 9 * 2 * 2, index + 2294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 2, product* 4 * 8 * 7 * 4 * 9 * 2 * 2, index + 2294784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 2, product* 2 * 3 * 8 * 6 * 9 * 2 * 2, index + 2296832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 2, product* 4 * 4 * 3 * 7 * 9 * 2 * 2, index + 2297344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 2, product* 2 * 7 * 4 * 7 * 9 * 2 * 2, index + 2297472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 2 + 2, product* 8 * 2 * 7 * 7 * 9 * 2 * 2, index + 2297728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9 + 2 + 2, product* 4 * 8 * 9 * 7 * 9 * 2 * 2, index + 2297984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2 + 2, product* 8 * 6 * 3 * 8 * 9 * 2 * 2, index + 2298368);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 2 + 2, product* 6 * 9 * 4 * 8 * 9 * 2 * 2, index + 2298496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2 + 2, product* 4 * 2 * 6 * 8 * 9 * 2 * 2, index + 2298624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 2 + 2, product* 4 * 6 * 2 * 9 * 9 * 2 * 2, index + 2299264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 2, product* 2 * 9 * 3 * 9 * 9 * 2 * 2, index + 2299392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9 + 2 + 2, product* 8 * 4 * 6 * 9 * 9 * 2 * 2, index + 2299648);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 2, product* 2 * 3 * 4 * 2 * 2 * 3 * 2, index + 2322432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3 + 2, product* 8 * 8 * 6 * 2 * 2 * 3 * 2, index + 2322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 2, product* 4 * 4 * 9 * 2 * 2 * 3 * 2, index + 2322944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 2, product* 8 * 2 * 3 * 3 * 2 * 3 * 2, index + 2323328);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 2, product* 2 * 9 * 3 * 3 * 2 * 3 * 2, index + 2323392);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3 + 2, product* 8 * 6 * 9 * 3 * 2 * 3 * 2, index + 2323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 2, product* 4 * 2 * 2 * 4 * 2 * 3 * 2, index + 2324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 2, product* 6 * 3 * 7 * 4 * 2 * 3 * 2, index + 2324736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 2, product* 4 * 6 * 8 * 4 * 2 * 3 * 2, index + 2324864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 2, product* 2 * 9 * 9 * 4 * 2 * 3 * 2, index + 2324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 2, product* 2 * 7 * 2 * 6 * 2 * 3 * 2, index + 2326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 2, product* 4 * 8 * 7 * 6 * 2 * 3 * 2, index + 2326784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 2, product* 6 * 9 * 2 * 7 * 2 * 3 * 2, index + 2327296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 2, product* 4 * 2 * 4 * 7 * 2 * 3 * 2, index + 2327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 2, product* 6 * 3 * 9 * 7 * 2 * 3 * 2, index + 2327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 2, product* 8 * 4 * 4 * 8 * 2 * 3 * 2, index + 2328448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 2, product* 2 * 3 * 8 * 8 * 2 * 3 * 2, index + 2328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 2, product* 4 * 4 * 3 * 9 * 2 * 3 * 2, index + 2329344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 2, product* 2 * 7 * 4 * 9 * 2 * 3 * 2, index + 2329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 2, product* 8 * 2 * 7 * 9 * 2 * 3 * 2, index + 2329728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 3 + 2, product* 4 * 8 * 9 * 9 * 2 * 3 * 2, index + 2329984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 2, product* 8 * 8 * 2 * 2 * 3 * 3 * 2, index + 2332288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 2, product* 2 * 7 * 6 * 2 * 3 * 3 * 2, index + 2332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 2, product* 8 * 2 * 9 * 2 * 3 * 3 * 2, index + 2332928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 3 + 2, product* 6 * 9 * 6 * 3 * 3 * 3 * 2, index + 2333696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 2, product* 4 * 2 * 8 * 3 * 3 * 3 * 2, index + 2333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 2, product* 6 * 3 * 3 * 4 * 3 * 3 * 2, index + 2334336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 2, product* 4 * 6 * 4 * 4 * 3 * 3 * 2, index + 2334464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3 + 2, product* 6 * 7 * 9 * 4 * 3 * 3 * 2, index + 2334976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 2, product* 4 * 8 * 3 * 6 * 3 * 3 * 2, index + 2336384);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 3 + 2, product* 6 * 9 * 8 * 6 * 3 * 3 * 2, index + 2336896);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 2, product* 2 * 9 * 7 * 7 * 3 * 3 * 2, index + 2337792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 2, product* 2 * 3 * 4 * 8 * 3 * 3 * 2, index + 2338432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 3 + 2, product* 4 * 4 * 9 * 8 * 3 * 3 * 2, index + 2338944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 2, product* 8 * 2 * 3 * 9 * 3 * 3 * 2, index + 2339328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 2, product* 2 * 7 * 2 * 2 * 4 * 3 * 2, index + 2342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 2, product* 4 * 8 * 7 * 2 * 4 * 3 * 2, index + 2342784);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 2, product* 2 * 3 * 2 * 3 * 4 * 3 * 2, index + 2343232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 2, product* 6 * 9 * 2 * 3 * 4 * 3 * 2, index + 2343296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 2, product* 4 * 2 * 4 * 3 * 4 * 3 * 2, index + 2343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 2, product* 6 * 3 * 9 * 3 * 4 * 3 * 2, index + 2343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 2, product* 8 * 4 * 4 * 4 * 4 * 3 * 2, index + 2344448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 2, product* 2 * 3 * 8 * 4 * 4 * 3 * 2, index + 2344832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 2, product* 4 * 2 * 6 * 6 * 4 * 3 * 2, index + 2346624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 2, product* 4 * 6 * 2 * 7 * 4 * 3 * 2, index + 2347264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 2, product* 2 * 9 * 3 * 7 * 4 * 3 * 2, index + 2347392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 3 + 2, product* 8 * 4 * 6 * 7 * 4 * 3 * 2, index + 2347648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4 + 3 + 2, product* 6 * 7 * 7 * 7 * 4 * 3 * 2, index + 2347776);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 3 + 2, product* 2 * 7 * 6 * 8 * 4 * 3 * 2, index + 2348672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 2, product* 8 * 2 * 9 * 8 * 4 * 3 * 2, index + 2348928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3 + 2, product* 4 * 2 * 8 * 9 * 4 * 3 * 2, index + 2349824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3 + 2, product* 8 * 6 * 3 * 2 * 6 * 3 * 2, index + 2362368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 2, product* 6 * 9 * 4 * 2 * 6 * 3 * 2, index + 2362496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 2, product* 4 * 2 * 6 * 2 * 6 * 3 * 2, index + 2362624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 2, product* 4 * 6 * 2 * 3 * 6 * 3 * 2, index + 2363264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 2, product* 2 * 9 * 3 * 3 * 6 * 3 * 2, index + 2363392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3 + 2, product* 8 * 4 * 6 * 3 * 6 * 3 * 2, index + 2363648);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 2, product* 8 * 8 * 2 * 4 * 6 * 3 * 2, index + 2364288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 2, product* 2 * 7 * 6 * 4 * 6 * 3 * 2, index + 2364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 2, product* 8 * 2 * 9 * 4 * 6 * 3 * 2, index + 2364928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 2, product* 6 * 3 * 3 * 6 * 6 * 3 * 2, index + 2366336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 2, product* 4 * 6 * 4 * 6 * 6 * 3 * 2, index + 2366464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6 + 3 + 2, product* 6 * 7 * 9 * 6 * 6 * 3 * 2, index + 2366976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 2, product* 2 * 3 * 2 * 7 * 6 * 3 * 2, index + 2367232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3 + 2, product* 8 * 8 * 4 * 7 * 6 * 3 * 2, index + 2367488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 6 + 3 + 2, product* 4 * 4 * 7 * 7 * 6 * 3 * 2, index + 2367744);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3 + 2, product* 4 * 8 * 3 * 8 * 6 * 3 * 2, index + 2368384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 6 + 3 + 2, product* 6 * 9 * 8 * 8 * 6 * 3 * 2, index + 2368896);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 6 + 3 + 2, product* 2 * 9 * 7 * 9 * 6 * 3 * 2, index + 2369792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 2, product* 4 * 2 * 2 * 2 * 7 * 3 * 2, index + 2372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 2, product* 6 * 3 * 7 * 2 * 7 * 3 * 2, index + 2372736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 2, product* 4 * 6 * 8 * 2 * 7 * 3 * 2, index + 2372864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 2, product* 2 * 9 * 9 * 2 * 7 * 3 * 2, index + 2372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 2, product* 8 * 4 * 2 * 3 * 7 * 3 * 2, index + 2373248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 2, product* 6 * 7 * 3 * 3 * 7 * 3 * 2, index + 2373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 2, product* 2 * 3 * 6 * 3 * 7 * 3 * 2, index + 2373632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 7 + 3 + 2, product* 8 * 8 * 8 * 3 * 7 * 3 * 2, index + 2373888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 2, product* 2 * 7 * 2 * 4 * 7 * 3 * 2, index + 2374272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 3 + 2, product* 4 * 8 * 7 * 4 * 7 * 3 * 2, index + 2374784);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 2, product* 8 * 4 * 4 * 6 * 7 * 3 * 2, index + 2376448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3 + 2, product* 2 * 3 * 8 * 6 * 7 * 3 * 2, index + 2376832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 2, product* 4 * 4 * 3 * 7 * 7 * 3 * 2, index + 2377344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 2, product* 2 * 7 * 4 * 7 * 7 * 3 * 2, index + 2377472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 2, product* 8 * 2 * 7 * 7 * 7 * 3 * 2, index + 2377728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 3 + 2, product* 4 * 8 * 9 * 7 * 7 * 3 * 2, index + 2377984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 3 + 2, product* 8 * 6 * 3 * 8 * 7 * 3 * 2, index + 2378368);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3 + 2, product* 6 * 9 * 4 * 8 * 7 * 3 * 2, index + 2378496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3 + 2, product* 4 * 2 * 6 * 8 * 7 * 3 * 2, index + 2378624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 2, product* 4 * 6 * 2 * 9 * 7 * 3 * 2, index + 2379264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 2, product* 2 * 9 * 3 * 9 * 7 * 3 * 2, index + 2379392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 2, product* 6 * 3 * 3 * 2 * 8 * 3 * 2, index + 2382336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 2, product* 4 * 6 * 4 * 2 * 8 * 3 * 2, index + 2382464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3 + 2, product* 8 * 4 * 8 * 2 * 8 * 3 * 2, index + 2382848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 2, product* 2 * 3 * 2 * 3 * 8 * 3 * 2, index + 2383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 2, product* 8 * 8 * 4 * 3 * 8 * 3 * 2, index + 2383488);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 2, product* 2 * 7 * 8 * 3 * 8 * 3 * 2, index + 2383872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 2, product* 4 * 8 * 3 * 4 * 8 * 3 * 2, index + 2384384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 8 + 3 + 2, product* 8 * 6 * 7 * 4 * 8 * 3 * 2, index + 2384768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 8 + 3 + 2, product* 6 * 9 * 8 * 4 * 8 * 3 * 2, index + 2384896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 2, product* 2 * 3 * 4 * 6 * 8 * 3 * 2, index + 2386432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3 + 2, product* 4 * 4 * 9 * 6 * 8 * 3 * 2, index + 2386944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 2, product* 8 * 2 * 3 * 7 * 8 * 3 * 2, index + 2387328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 2, product* 4 * 2 * 2 * 8 * 8 * 3 * 2, index + 2388224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 3 + 2, product* 2 * 9 * 9 * 8 * 8 * 3 * 2, index + 2388992);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 8 + 3 + 2, product* 6 * 7 * 3 * 9 * 8 * 3 * 2, index + 2389376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3 + 2, product* 2 * 3 * 6 * 9 * 8 * 3 * 2, index + 2389632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 2, product* 8 * 4 * 4 * 2 * 9 * 3 * 2, index + 2392448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 2, product* 2 * 3 * 8 * 2 * 9 * 3 * 2, index + 2392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 2, product* 4 * 4 * 3 * 3 * 9 * 3 * 2, index + 2393344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 2, product* 2 * 7 * 4 * 3 * 9 * 3 * 2, index + 2393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 2, product* 8 * 2 * 7 * 3 * 9 * 3 * 2, index + 2393728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3 + 2, product* 2 * 9 * 7 * 3 * 9 * 3 * 2, index + 2393792);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 2, product* 4 * 2 * 6 * 4 * 9 * 3 * 2, index + 2394624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 2, product* 2 * 7 * 6 * 6 * 9 * 3 * 2, index + 2396672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 3 + 2, product* 8 * 2 * 9 * 6 * 9 * 3 * 2, index + 2396928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 2, product* 4 * 2 * 8 * 7 * 9 * 3 * 2, index + 2397824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3 + 2, product* 6 * 3 * 3 * 8 * 9 * 3 * 2, index + 2398336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 3 + 2, product* 4 * 6 * 4 * 8 * 9 * 3 * 2, index + 2398464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 2, product* 2 * 3 * 2 * 9 * 9 * 3 * 2, index + 2399232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 3 + 2, product* 4 * 4 * 7 * 9 * 9 * 3 * 2, index + 2399744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 2, product* 2 * 7 * 2 * 2 * 2 * 4 * 2, index + 2422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 2, product* 4 * 8 * 7 * 2 * 2 * 4 * 2, index + 2422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 2, product* 6 * 9 * 2 * 3 * 2 * 4 * 2, index + 2423296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 2, product* 4 * 2 * 4 * 3 * 2 * 4 * 2, index + 2423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 2, product* 6 * 3 * 9 * 3 * 2 * 4 * 2, index + 2423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 2, product* 8 * 4 * 4 * 4 * 2 * 4 * 2, index + 2424448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 2, product* 2 * 3 * 8 * 4 * 2 * 4 * 2, index + 2424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 2, product* 8 * 6 * 3 * 6 * 2 * 4 * 2, index + 2426368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 4 + 2, product* 6 * 9 * 4 * 6 * 2 * 4 * 2, index + 2426496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 2, product* 4 * 2 * 6 * 6 * 2 * 4 * 2, index + 2426624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 2, product* 4 * 6 * 2 * 7 * 2 * 4 * 2, index + 2427264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 2, product* 2 * 9 * 3 * 7 * 2 * 4 * 2, index + 2427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 2, product* 8 * 4 * 6 * 7 * 2 * 4 * 2, index + 2427648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 4 + 2, product* 6 * 7 * 7 * 7 * 2 * 4 * 2, index + 2427776);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 2, product* 8 * 8 * 2 * 8 * 2 * 4 * 2, index + 2428288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 2, product* 2 * 7 * 6 * 8 * 2 * 4 * 2, index + 2428672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 4 + 2, product* 8 * 2 * 9 * 8 * 2 * 4 * 2, index + 2428928);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 4 + 2, product* 6 * 9 * 6 * 9 * 2 * 4 * 2, index + 2429696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 2, product* 4 * 2 * 8 * 9 * 2 * 4 * 2, index + 2429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 2, product* 4 * 8 * 3 * 2 * 3 * 4 * 2, index + 2432384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 2, product* 8 * 6 * 7 * 2 * 3 * 4 * 2, index + 2432768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 2, product* 6 * 9 * 8 * 2 * 3 * 4 * 2, index + 2432896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 2, product* 4 * 6 * 6 * 3 * 3 * 4 * 2, index + 2433664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 2, product* 2 * 9 * 7 * 3 * 3 * 4 * 2, index + 2433792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 2, product* 2 * 3 * 4 * 4 * 3 * 4 * 2, index + 2434432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 4 + 2, product* 8 * 8 * 6 * 4 * 3 * 4 * 2, index + 2434688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 4 + 2, product* 4 * 4 * 9 * 4 * 3 * 4 * 2, index + 2434944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 2, product* 4 * 2 * 2 * 6 * 3 * 4 * 2, index + 2436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 2, product* 6 * 3 * 7 * 6 * 3 * 4 * 2, index + 2436736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 2, product* 4 * 6 * 8 * 6 * 3 * 4 * 2, index + 2436864);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 2, product* 8 * 4 * 2 * 7 * 3 * 4 * 2, index + 2437248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 4 + 2, product* 6 * 7 * 3 * 7 * 3 * 4 * 2, index + 2437376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 2, product* 2 * 3 * 6 * 7 * 3 * 4 * 2, index + 2437632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 2, product* 2 * 7 * 2 * 8 * 3 * 4 * 2, index + 2438272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 4 + 2, product* 4 * 8 * 7 * 8 * 3 * 4 * 2, index + 2438784);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 4 + 2, product* 6 * 9 * 2 * 9 * 3 * 4 * 2, index + 2439296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 2, product* 4 * 2 * 4 * 9 * 3 * 4 * 2, index + 2439424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 4 + 2, product* 6 * 3 * 9 * 9 * 3 * 4 * 2, index + 2439936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 2, product* 8 * 6 * 3 * 2 * 4 * 4 * 2, index + 2442368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 4 + 2, product* 6 * 9 * 4 * 2 * 4 * 4 * 2, index + 2442496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 2, product* 4 * 2 * 6 * 2 * 4 * 4 * 2, index + 2442624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 2, product* 4 * 6 * 2 * 3 * 4 * 4 * 2, index + 2443264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 2, product* 2 * 9 * 3 * 3 * 4 * 4 * 2, index + 2443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 2, product* 8 * 4 * 6 * 3 * 4 * 4 * 2, index + 2443648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 2, product* 6 * 7 * 7 * 3 * 4 * 4 * 2, index + 2443776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 2, product* 8 * 8 * 2 * 4 * 4 * 4 * 2, index + 2444288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 2, product* 2 * 7 * 6 * 4 * 4 * 4 * 2, index + 2444672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 2, product* 8 * 2 * 9 * 4 * 4 * 4 * 2, index + 2444928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 2, product* 6 * 3 * 3 * 6 * 4 * 4 * 2, index + 2446336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 2, product* 4 * 6 * 4 * 6 * 4 * 4 * 2, index + 2446464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 4 + 2, product* 6 * 7 * 9 * 6 * 4 * 4 * 2, index + 2446976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 2, product* 2 * 3 * 2 * 7 * 4 * 4 * 2, index + 2447232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 4 + 2, product* 4 * 4 * 7 * 7 * 4 * 4 * 2, index + 2447744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 4 + 2, product* 2 * 7 * 8 * 7 * 4 * 4 * 2, index + 2447872);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4 + 4 + 2, product* 6 * 9 * 8 * 8 * 4 * 4 * 2, index + 2448896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 2, product* 4 * 6 * 6 * 9 * 4 * 4 * 2, index + 2449664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 2, product* 6 * 3 * 3 * 2 * 6 * 4 * 2, index + 2462336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 2, product* 4 * 6 * 4 * 2 * 6 * 4 * 2, index + 2462464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 4 + 2, product* 6 * 7 * 9 * 2 * 6 * 4 * 2, index + 2462976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 2, product* 2 * 3 * 2 * 3 * 6 * 4 * 2, index + 2463232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 4 + 2, product* 8 * 8 * 4 * 3 * 6 * 4 * 2, index + 2463488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 2, product* 4 * 4 * 7 * 3 * 6 * 4 * 2, index + 2463744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 2, product* 2 * 7 * 8 * 3 * 6 * 4 * 2, index + 2463872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 2, product* 4 * 8 * 3 * 4 * 6 * 4 * 2, index + 2464384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 2, product* 2 * 3 * 4 * 6 * 6 * 4 * 2, index + 2466432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 4 + 2, product* 4 * 4 * 9 * 6 * 6 * 4 * 2, index + 2466944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 4 + 2, product* 8 * 2 * 3 * 7 * 6 * 4 * 2, index + 2467328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 2, product* 4 * 2 * 2 * 8 * 6 * 4 * 2, index + 2468224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 4 + 2, product* 6 * 3 * 7 * 8 * 6 * 4 * 2, index + 2468736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 4 + 2, product* 4 * 6 * 8 * 8 * 6 * 4 * 2, index + 2468864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 2, product* 8 * 4 * 2 * 9 * 6 * 4 * 2, index + 2469248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 2, product* 2 * 3 * 6 * 9 * 6 * 4 * 2, index + 2469632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 2, product* 8 * 4 * 4 * 2 * 7 * 4 * 2, index + 2472448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 2, product* 2 * 3 * 8 * 2 * 7 * 4 * 2, index + 2472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 2, product* 4 * 4 * 3 * 3 * 7 * 4 * 2, index + 2473344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 2, product* 2 * 7 * 4 * 3 * 7 * 4 * 2, index + 2473472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 2, product* 8 * 2 * 7 * 3 * 7 * 4 * 2, index + 2473728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 4 + 2, product* 4 * 8 * 9 * 3 * 7 * 4 * 2, index + 2473984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 4 + 2, product* 8 * 6 * 3 * 4 * 7 * 4 * 2, index + 2474368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 4 + 2, product* 6 * 9 * 4 * 4 * 7 * 4 * 2, index + 2474496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 2, product* 4 * 2 * 6 * 4 * 7 * 4 * 2, index + 2474624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 4 + 2, product* 8 * 8 * 2 * 6 * 7 * 4 * 2, index + 2476288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 2, product* 2 * 7 * 6 * 6 * 7 * 4 * 2, index + 2476672);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 2, product* 4 * 2 * 8 * 7 * 7 * 4 * 2, index + 2477824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 2, product* 6 * 3 * 3 * 8 * 7 * 4 * 2, index + 2478336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 4 + 2, product* 4 * 6 * 4 * 8 * 7 * 4 * 2, index + 2478464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 4 + 2, product* 6 * 7 * 9 * 8 * 7 * 4 * 2, index + 2478976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 2, product* 2 * 3 * 2 * 9 * 7 * 4 * 2, index + 2479232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 4 + 2, product* 4 * 4 * 7 * 9 * 7 * 4 * 2, index + 2479744);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 2, product* 2 * 3 * 4 * 2 * 8 * 4 * 2, index + 2482432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 4 + 2, product* 8 * 8 * 6 * 2 * 8 * 4 * 2, index + 2482688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 4 + 2, product* 4 * 4 * 9 * 2 * 8 * 4 * 2, index + 2482944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 2, product* 8 * 2 * 3 * 3 * 8 * 4 * 2, index + 2483328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 4 + 2, product* 8 * 6 * 9 * 3 * 8 * 4 * 2, index + 2483968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 2, product* 4 * 2 * 2 * 4 * 8 * 4 * 2, index + 2484224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 4 + 2, product* 6 * 3 * 7 * 4 * 8 * 4 * 2, index + 2484736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 4 + 2, product* 2 * 9 * 9 * 4 * 8 * 4 * 2, index + 2484992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 2, product* 2 * 7 * 2 * 6 * 8 * 4 * 2, index + 2486272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 4 + 2, product* 6 * 9 * 2 * 7 * 8 * 4 * 2, index + 2487296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 2, product* 4 * 2 * 4 * 7 * 8 * 4 * 2, index + 2487424);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 4 + 2, product* 2 * 3 * 8 * 8 * 8 * 4 * 2, index + 2488832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 4 + 2, product* 4 * 4 * 3 * 9 * 8 * 4 * 2, index + 2489344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 2, product* 2 * 7 * 4 * 9 * 8 * 4 * 2, index + 2489472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4 + 2, product* 8 * 8 * 2 * 2 * 9 * 4 * 2, index + 2492288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 2, product* 2 * 7 * 6 * 2 * 9 * 4 * 2, index + 2492672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 2, product* 8 * 2 * 9 * 2 * 9 * 4 * 2, index + 2492928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 4 + 2, product* 6 * 9 * 6 * 3 * 9 * 4 * 2, index + 2493696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 2, product* 4 * 2 * 8 * 3 * 9 * 4 * 2, index + 2493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 2, product* 6 * 3 * 3 * 4 * 9 * 4 * 2, index + 2494336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 4 + 2, product* 4 * 6 * 4 * 4 * 9 * 4 * 2, index + 2494464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 4 + 2, product* 4 * 8 * 3 * 6 * 9 * 4 * 2, index + 2496384);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 4 + 2, product* 2 * 9 * 7 * 7 * 9 * 4 * 2, index + 2497792);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 2, product* 6 * 3 * 3 * 2 * 2 * 6 * 2, index + 2622336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 2, product* 4 * 6 * 4 * 2 * 2 * 6 * 2, index + 2622464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 2, product* 8 * 4 * 8 * 2 * 2 * 6 * 2, index + 2622848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 2, product* 6 * 7 * 9 * 2 * 2 * 6 * 2, index + 2622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 2, product* 2 * 3 * 2 * 3 * 2 * 6 * 2, index + 2623232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 6 + 2, product* 8 * 8 * 4 * 3 * 2 * 6 * 2, index + 2623488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 2, product* 4 * 4 * 7 * 3 * 2 * 6 * 2, index + 2623744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 2, product* 2 * 7 * 8 * 3 * 2 * 6 * 2, index + 2623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 2, product* 4 * 8 * 3 * 4 * 2 * 6 * 2, index + 2624384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 6 + 2, product* 8 * 6 * 7 * 4 * 2 * 6 * 2, index + 2624768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 2, product* 6 * 9 * 8 * 4 * 2 * 6 * 2, index + 2624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 2, product* 2 * 3 * 4 * 6 * 2 * 6 * 2, index + 2626432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 2, product* 8 * 2 * 3 * 7 * 2 * 6 * 2, index + 2627328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 2, product* 4 * 2 * 2 * 8 * 2 * 6 * 2, index + 2628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 2, product* 6 * 3 * 7 * 8 * 2 * 6 * 2, index + 2628736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 6 + 2, product* 4 * 6 * 8 * 8 * 2 * 6 * 2, index + 2628864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 6 + 2, product* 8 * 4 * 2 * 9 * 2 * 6 * 2, index + 2629248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 2, product* 6 * 7 * 3 * 9 * 2 * 6 * 2, index + 2629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 2, product* 2 * 3 * 6 * 9 * 2 * 6 * 2, index + 2629632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 2, product* 8 * 4 * 4 * 2 * 3 * 6 * 2, index + 2632448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 2, product* 2 * 3 * 8 * 2 * 3 * 6 * 2, index + 2632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 2, product* 4 * 4 * 3 * 3 * 3 * 6 * 2, index + 2633344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 2, product* 2 * 7 * 4 * 3 * 3 * 6 * 2, index + 2633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 2, product* 8 * 2 * 7 * 3 * 3 * 6 * 2, index + 2633728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 6 + 2, product* 2 * 9 * 7 * 3 * 3 * 6 * 2, index + 2633792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 2, product* 4 * 8 * 9 * 3 * 3 * 6 * 2, index + 2633984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 6 + 2, product* 8 * 6 * 3 * 4 * 3 * 6 * 2, index + 2634368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 2, product* 6 * 9 * 4 * 4 * 3 * 6 * 2, index + 2634496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 2, product* 4 * 2 * 6 * 4 * 3 * 6 * 2, index + 2634624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 2, product* 8 * 8 * 2 * 6 * 3 * 6 * 2, index + 2636288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 2, product* 2 * 7 * 6 * 6 * 3 * 6 * 2, index + 2636672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 6 + 2, product* 8 * 2 * 9 * 6 * 3 * 6 * 2, index + 2636928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 2, product* 4 * 2 * 8 * 7 * 3 * 6 * 2, index + 2637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 2, product* 6 * 3 * 3 * 8 * 3 * 6 * 2, index + 2638336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6 + 2, product* 4 * 6 * 4 * 8 * 3 * 6 * 2, index + 2638464);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 6 + 2, product* 8 * 4 * 8 * 8 * 3 * 6 * 2, index + 2638848);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 2, product* 2 * 3 * 2 * 9 * 3 * 6 * 2, index + 2639232);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 6 + 2, product* 2 * 7 * 8 * 9 * 3 * 6 * 2, index + 2639872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 2, product* 2 * 3 * 4 * 2 * 4 * 6 * 2, index + 2642432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 6 + 2, product* 8 * 8 * 6 * 2 * 4 * 6 * 2, index + 2642688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 2, product* 4 * 4 * 9 * 2 * 4 * 6 * 2, index + 2642944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 2, product* 8 * 2 * 3 * 3 * 4 * 6 * 2, index + 2643328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 6 + 2, product* 8 * 6 * 9 * 3 * 4 * 6 * 2, index + 2643968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 2, product* 4 * 2 * 2 * 4 * 4 * 6 * 2, index + 2644224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 6 + 2, product* 6 * 3 * 7 * 4 * 4 * 6 * 2, index + 2644736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 6 + 2, product* 4 * 6 * 8 * 4 * 4 * 6 * 2, index + 2644864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 6 + 2, product* 2 * 9 * 9 * 4 * 4 * 6 * 2, index + 2644992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 2, product* 2 * 7 * 2 * 6 * 4 * 6 * 2, index + 2646272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 6 + 2, product* 4 * 8 * 7 * 6 * 4 * 6 * 2, index + 2646784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 2, product* 6 * 9 * 2 * 7 * 4 * 6 * 2, index + 2647296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 2, product* 4 * 2 * 4 * 7 * 4 * 6 * 2, index + 2647424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 6 + 2, product* 6 * 3 * 9 * 7 * 4 * 6 * 2, index + 2647936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 6 + 2, product* 8 * 4 * 4 * 8 * 4 * 6 * 2, index + 2648448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 2, product* 2 * 3 * 8 * 8 * 4 * 6 * 2, index + 2648832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 6 + 2, product* 4 * 4 * 3 * 9 * 4 * 6 * 2, index + 2649344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 2, product* 2 * 7 * 4 * 9 * 4 * 6 * 2, index + 2649472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 6 + 2, product* 8 * 2 * 7 * 9 * 4 * 6 * 2, index + 2649728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 6 + 2, product* 4 * 8 * 9 * 9 * 4 * 6 * 2, index + 2649984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 2, product* 2 * 7 * 2 * 2 * 6 * 6 * 2, index + 2662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 2, product* 4 * 8 * 7 * 2 * 6 * 6 * 2, index + 2662784);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 2, product* 2 * 3 * 2 * 3 * 6 * 6 * 2, index + 2663232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 2, product* 6 * 9 * 2 * 3 * 6 * 6 * 2, index + 2663296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 2, product* 4 * 2 * 4 * 3 * 6 * 6 * 2, index + 2663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 2, product* 6 * 3 * 9 * 3 * 6 * 6 * 2, index + 2663936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 2, product* 8 * 4 * 4 * 4 * 6 * 6 * 2, index + 2664448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 2, product* 2 * 3 * 8 * 4 * 6 * 6 * 2, index + 2664832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 6 + 2, product* 6 * 9 * 4 * 6 * 6 * 6 * 2, index + 2666496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 2, product* 4 * 2 * 6 * 6 * 6 * 6 * 2, index + 2666624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 6 + 2, product* 4 * 6 * 2 * 7 * 6 * 6 * 2, index + 2667264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 2, product* 2 * 9 * 3 * 7 * 6 * 6 * 2, index + 2667392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 6 + 2, product* 8 * 4 * 6 * 7 * 6 * 6 * 2, index + 2667648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 6 + 2, product* 2 * 7 * 6 * 8 * 6 * 6 * 2, index + 2668672);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 6 + 6 + 2, product* 6 * 9 * 6 * 9 * 6 * 6 * 2, index + 2669696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 6 + 2, product* 4 * 2 * 8 * 9 * 6 * 6 * 2, index + 2669824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 2, product* 4 * 8 * 3 * 2 * 7 * 6 * 2, index + 2672384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 6 + 2, product* 6 * 9 * 8 * 2 * 7 * 6 * 2, index + 2672896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 6 + 2, product* 4 * 6 * 6 * 3 * 7 * 6 * 2, index + 2673664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 2, product* 2 * 3 * 4 * 4 * 7 * 6 * 2, index + 2674432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 6 + 2, product* 4 * 4 * 9 * 4 * 7 * 6 * 2, index + 2674944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 2, product* 4 * 2 * 2 * 6 * 7 * 6 * 2, index + 2676224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 6 + 2, product* 6 * 3 * 7 * 6 * 7 * 6 * 2, index + 2676736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 6 + 2, product* 4 * 6 * 8 * 6 * 7 * 6 * 2, index + 2676864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 6 + 2, product* 2 * 9 * 9 * 6 * 7 * 6 * 2, index + 2676992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6 + 2, product* 8 * 4 * 2 * 7 * 7 * 6 * 2, index + 2677248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 2, product* 2 * 3 * 6 * 7 * 7 * 6 * 2, index + 2677632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 2, product* 2 * 7 * 2 * 8 * 7 * 6 * 2, index + 2678272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 6 + 2, product* 6 * 9 * 2 * 9 * 7 * 6 * 2, index + 2679296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 2, product* 4 * 2 * 4 * 9 * 7 * 6 * 2, index + 2679424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 6 + 2, product* 8 * 6 * 3 * 2 * 8 * 6 * 2, index + 2682368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6 + 2, product* 6 * 9 * 4 * 2 * 8 * 6 * 2, index + 2682496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 2, product* 4 * 2 * 6 * 2 * 8 * 6 * 2, index + 2682624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 2, product* 4 * 6 * 2 * 3 * 8 * 6 * 2, index + 2683264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 2, product* 2 * 9 * 3 * 3 * 8 * 6 * 2, index + 2683392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 6 + 2, product* 2 * 7 * 6 * 4 * 8 * 6 * 2, index + 2684672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 6 + 2, product* 8 * 2 * 9 * 4 * 8 * 6 * 2, index + 2684928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 2, product* 2 * 3 * 2 * 7 * 8 * 6 * 2, index + 2687232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 6 + 2, product* 4 * 4 * 7 * 7 * 8 * 6 * 2, index + 2687744);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 6 + 2, product* 2 * 9 * 7 * 9 * 8 * 6 * 2, index + 2689792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 2, product* 4 * 2 * 2 * 2 * 9 * 6 * 2, index + 2692224);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6 + 2, product* 4 * 6 * 8 * 2 * 9 * 6 * 2, index + 2692864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 6 + 2, product* 2 * 9 * 9 * 2 * 9 * 6 * 2, index + 2692992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 2, product* 8 * 4 * 2 * 3 * 9 * 6 * 2, index + 2693248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6 + 2, product* 6 * 7 * 3 * 3 * 9 * 6 * 2, index + 2693376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 2, product* 2 * 3 * 6 * 3 * 9 * 6 * 2, index + 2693632);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 2, product* 2 * 3 * 8 * 6 * 9 * 6 * 2, index + 2696832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 6 + 2, product* 4 * 4 * 3 * 7 * 9 * 6 * 2, index + 2697344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6 + 2, product* 2 * 7 * 4 * 7 * 9 * 6 * 2, index + 2697472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 6 + 2, product* 8 * 2 * 7 * 7 * 9 * 6 * 2, index + 2697728);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 6 + 2, product* 4 * 2 * 6 * 8 * 9 * 6 * 2, index + 2698624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 6 + 2, product* 4 * 6 * 2 * 9 * 9 * 6 * 2, index + 2699264);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 2, product* 2 * 3 * 4 * 2 * 2 * 7 * 2, index + 2722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 2, product* 4 * 4 * 9 * 2 * 2 * 7 * 2, index + 2722944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 2, product* 8 * 2 * 3 * 3 * 2 * 7 * 2, index + 2723328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 7 + 2, product* 8 * 6 * 9 * 3 * 2 * 7 * 2, index + 2723968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 2, product* 4 * 2 * 2 * 4 * 2 * 7 * 2, index + 2724224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7 + 2, product* 6 * 3 * 7 * 4 * 2 * 7 * 2, index + 2724736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 2, product* 4 * 6 * 8 * 4 * 2 * 7 * 2, index + 2724864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 2, product* 2 * 9 * 9 * 4 * 2 * 7 * 2, index + 2724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 2, product* 2 * 7 * 2 * 6 * 2 * 7 * 2, index + 2726272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7 + 2, product* 4 * 8 * 7 * 6 * 2 * 7 * 2, index + 2726784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 2, product* 6 * 9 * 2 * 7 * 2 * 7 * 2, index + 2727296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 2, product* 4 * 2 * 4 * 7 * 2 * 7 * 2, index + 2727424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 7 + 2, product* 6 * 3 * 9 * 7 * 2 * 7 * 2, index + 2727936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 2, product* 8 * 4 * 4 * 8 * 2 * 7 * 2, index + 2728448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 2, product* 2 * 3 * 8 * 8 * 2 * 7 * 2, index + 2728832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 2, product* 4 * 4 * 3 * 9 * 2 * 7 * 2, index + 2729344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 2, product* 2 * 7 * 4 * 9 * 2 * 7 * 2, index + 2729472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 2, product* 8 * 2 * 7 * 9 * 2 * 7 * 2, index + 2729728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 7 + 2, product* 4 * 8 * 9 * 9 * 2 * 7 * 2, index + 2729984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7 + 2, product* 8 * 8 * 2 * 2 * 3 * 7 * 2, index + 2732288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 2, product* 2 * 7 * 6 * 2 * 3 * 7 * 2, index + 2732672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 2, product* 6 * 3 * 7 * 2 * 3 * 7 * 2, index + 2732736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 2, product* 8 * 2 * 9 * 2 * 3 * 7 * 2, index + 2732928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 2, product* 2 * 9 * 9 * 2 * 3 * 7 * 2, index + 2732992);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 2, product* 2 * 3 * 6 * 3 * 3 * 7 * 2, index + 2733632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 7 + 2, product* 6 * 9 * 6 * 3 * 3 * 7 * 2, index + 2733696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 2, product* 4 * 2 * 8 * 3 * 3 * 7 * 2, index + 2733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 2, product* 6 * 3 * 3 * 4 * 3 * 7 * 2, index + 2734336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 2, product* 4 * 6 * 4 * 4 * 3 * 7 * 2, index + 2734464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 7 + 2, product* 6 * 7 * 9 * 4 * 3 * 7 * 2, index + 2734976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 2, product* 4 * 8 * 3 * 6 * 3 * 7 * 2, index + 2736384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7 + 2, product* 4 * 6 * 6 * 7 * 3 * 7 * 2, index + 2737664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 2, product* 2 * 3 * 4 * 8 * 3 * 7 * 2, index + 2738432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 7 + 2, product* 4 * 4 * 9 * 8 * 3 * 7 * 2, index + 2738944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 2, product* 8 * 2 * 3 * 9 * 3 * 7 * 2, index + 2739328);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 7 + 2, product* 2 * 9 * 3 * 9 * 3 * 7 * 2, index + 2739392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 2, product* 2 * 7 * 2 * 2 * 4 * 7 * 2, index + 2742272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7 + 2, product* 4 * 8 * 7 * 2 * 4 * 7 * 2, index + 2742784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7 + 2, product* 6 * 9 * 2 * 3 * 4 * 7 * 2, index + 2743296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 2, product* 4 * 2 * 4 * 3 * 4 * 7 * 2, index + 2743424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 7 + 2, product* 8 * 4 * 4 * 4 * 4 * 7 * 2, index + 2744448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 2, product* 2 * 3 * 8 * 4 * 4 * 7 * 2, index + 2744832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 7 + 2, product* 8 * 6 * 3 * 6 * 4 * 7 * 2, index + 2746368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 2, product* 4 * 2 * 6 * 6 * 4 * 7 * 2, index + 2746624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 2, product* 4 * 6 * 2 * 7 * 4 * 7 * 2, index + 2747264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 2, product* 2 * 9 * 3 * 7 * 4 * 7 * 2, index + 2747392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 2, product* 2 * 7 * 6 * 8 * 4 * 7 * 2, index + 2748672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 7 + 2, product* 8 * 2 * 9 * 8 * 4 * 7 * 2, index + 2748928);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7 + 2, product* 8 * 6 * 3 * 2 * 6 * 7 * 2, index + 2762368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 7 + 2, product* 6 * 9 * 4 * 2 * 6 * 7 * 2, index + 2762496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 2, product* 4 * 2 * 6 * 2 * 6 * 7 * 2, index + 2762624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 2, product* 4 * 6 * 2 * 3 * 6 * 7 * 2, index + 2763264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 2, product* 2 * 9 * 3 * 3 * 6 * 7 * 2, index + 2763392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 7 + 2, product* 8 * 8 * 2 * 4 * 6 * 7 * 2, index + 2764288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 7 + 2, product* 2 * 7 * 6 * 4 * 6 * 7 * 2, index + 2764672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 2, product* 6 * 3 * 3 * 6 * 6 * 7 * 2, index + 2766336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 7 + 2, product* 4 * 6 * 4 * 6 * 6 * 7 * 2, index + 2766464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6 + 7 + 2, product* 6 * 7 * 9 * 6 * 6 * 7 * 2, index + 2766976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 2, product* 2 * 3 * 2 * 7 * 6 * 7 * 2, index + 2767232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 7 + 2, product* 4 * 8 * 3 * 8 * 6 * 7 * 2, index + 2768384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6 + 7 + 2, product* 4 * 6 * 6 * 9 * 6 * 7 * 2, index + 2769664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 2, product* 4 * 2 * 2 * 2 * 7 * 7 * 2, index + 2772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 2, product* 6 * 3 * 7 * 2 * 7 * 7 * 2, index + 2772736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 7 + 2, product* 2 * 9 * 9 * 2 * 7 * 7 * 2, index + 2772992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 2, product* 8 * 4 * 2 * 3 * 7 * 7 * 2, index + 2773248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 7 + 2, product* 6 * 7 * 3 * 3 * 7 * 7 * 2, index + 2773376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 2, product* 2 * 3 * 6 * 3 * 7 * 7 * 2, index + 2773632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 2, product* 2 * 7 * 2 * 4 * 7 * 7 * 2, index + 2774272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 7 + 2, product* 4 * 8 * 7 * 4 * 7 * 7 * 2, index + 2774784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 2, product* 2 * 3 * 8 * 6 * 7 * 7 * 2, index + 2776832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 7 + 2, product* 4 * 4 * 3 * 7 * 7 * 7 * 2, index + 2777344);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 7 + 2, product* 4 * 8 * 9 * 7 * 7 * 7 * 2, index + 2777984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 7 + 2, product* 8 * 6 * 3 * 8 * 7 * 7 * 2, index + 2778368);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 7 + 2, product* 4 * 6 * 2 * 9 * 7 * 7 * 2, index + 2779264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 7 + 2, product* 2 * 9 * 3 * 9 * 7 * 7 * 2, index + 2779392);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 7 + 7 + 2, product* 6 * 7 * 7 * 9 * 7 * 7 * 2, index + 2779776);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 2, product* 6 * 3 * 3 * 2 * 8 * 7 * 2, index + 2782336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7 + 2, product* 4 * 6 * 4 * 2 * 8 * 7 * 2, index + 2782464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 2, product* 2 * 3 * 2 * 3 * 8 * 7 * 2, index + 2783232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7 + 2, product* 4 * 4 * 7 * 3 * 8 * 7 * 2, index + 2783744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 7 + 2, product* 2 * 7 * 8 * 3 * 8 * 7 * 2, index + 2783872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 7 + 2, product* 4 * 8 * 3 * 4 * 8 * 7 * 2, index + 2784384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 2, product* 2 * 3 * 4 * 6 * 8 * 7 * 2, index + 2786432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 2, product* 8 * 2 * 3 * 7 * 8 * 7 * 2, index + 2787328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 2, product* 4 * 2 * 2 * 8 * 8 * 7 * 2, index + 2788224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 7 + 2, product* 4 * 6 * 8 * 8 * 8 * 7 * 2, index + 2788864);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7 + 2, product* 8 * 4 * 4 * 2 * 9 * 7 * 2, index + 2792448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 2, product* 2 * 3 * 8 * 2 * 9 * 7 * 2, index + 2792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 2, product* 4 * 4 * 3 * 3 * 9 * 7 * 2, index + 2793344);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 9 + 7 + 2, product* 2 * 9 * 3 * 3 * 9 * 7 * 2, index + 2793392);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 2, product* 2 * 7 * 4 * 3 * 9 * 7 * 2, index + 2793472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 7 + 2, product* 8 * 2 * 7 * 3 * 9 * 7 * 2, index + 2793728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 7 + 2, product* 4 * 8 * 9 * 3 * 9 * 7 * 2, index + 2793984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9 + 7 + 2, product* 8 * 6 * 3 * 4 * 9 * 7 * 2, index + 2794368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 7 + 2, product* 4 * 2 * 6 * 4 * 9 * 7 * 2, index + 2794624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 7 + 2, product* 8 * 8 * 2 * 6 * 9 * 7 * 2, index + 2796288);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 7 + 2, product* 8 * 2 * 9 * 6 * 9 * 7 * 2, index + 2796928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 7 + 2, product* 4 * 2 * 8 * 7 * 9 * 7 * 2, index + 2797824);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 9 + 7 + 2, product* 8 * 4 * 8 * 8 * 9 * 7 * 2, index + 2798848);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 2, product* 2 * 3 * 2 * 9 * 9 * 7 * 2, index + 2799232);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 9 + 7 + 2, product* 2 * 7 * 8 * 9 * 9 * 7 * 2, index + 2799872);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 2, product* 2 * 7 * 2 * 2 * 2 * 8 * 2, index + 2822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 2, product* 4 * 8 * 7 * 2 * 2 * 8 * 2, index + 2822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 2, product* 6 * 9 * 2 * 3 * 2 * 8 * 2, index + 2823296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 2, product* 4 * 2 * 4 * 3 * 2 * 8 * 2, index + 2823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 2, product* 6 * 3 * 9 * 3 * 2 * 8 * 2, index + 2823936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 2, product* 8 * 4 * 4 * 4 * 2 * 8 * 2, index + 2824448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 2, product* 2 * 3 * 8 * 4 * 2 * 8 * 2, index + 2824832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 8 + 2, product* 8 * 6 * 3 * 6 * 2 * 8 * 2, index + 2826368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 8 + 2, product* 6 * 9 * 4 * 6 * 2 * 8 * 2, index + 2826496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 2, product* 4 * 6 * 2 * 7 * 2 * 8 * 2, index + 2827264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 2, product* 2 * 9 * 3 * 7 * 2 * 8 * 2, index + 2827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 2, product* 8 * 4 * 6 * 7 * 2 * 8 * 2, index + 2827648);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 2, product* 4 * 2 * 8 * 9 * 2 * 8 * 2, index + 2829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 2, product* 4 * 8 * 3 * 2 * 3 * 8 * 2, index + 2832384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 8 + 2, product* 8 * 6 * 7 * 2 * 3 * 8 * 2, index + 2832768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 8 + 2, product* 6 * 9 * 8 * 2 * 3 * 8 * 2, index + 2832896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8 + 2, product* 4 * 6 * 6 * 3 * 3 * 8 * 2, index + 2833664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 2, product* 2 * 9 * 7 * 3 * 3 * 8 * 2, index + 2833792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 2, product* 2 * 3 * 4 * 4 * 3 * 8 * 2, index + 2834432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 8 + 2, product* 4 * 4 * 9 * 4 * 3 * 8 * 2, index + 2834944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 2, product* 4 * 2 * 2 * 6 * 3 * 8 * 2, index + 2836224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8 + 2, product* 6 * 3 * 7 * 6 * 3 * 8 * 2, index + 2836736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 8 + 2, product* 4 * 6 * 8 * 6 * 3 * 8 * 2, index + 2836864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 8 + 2, product* 2 * 9 * 9 * 6 * 3 * 8 * 2, index + 2836992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 8 + 2, product* 8 * 4 * 2 * 7 * 3 * 8 * 2, index + 2837248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 2, product* 2 * 3 * 6 * 7 * 3 * 8 * 2, index + 2837632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 2, product* 2 * 7 * 2 * 8 * 3 * 8 * 2, index + 2838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 2, product* 6 * 9 * 2 * 9 * 3 * 8 * 2, index + 2839296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8 + 2, product* 4 * 2 * 4 * 9 * 3 * 8 * 2, index + 2839424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 8 + 2, product* 8 * 6 * 3 * 2 * 4 * 8 * 2, index + 2842368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 2, product* 4 * 2 * 6 * 2 * 4 * 8 * 2, index + 2842624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 2, product* 4 * 6 * 2 * 3 * 4 * 8 * 2, index + 2843264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 2, product* 2 * 9 * 3 * 3 * 4 * 8 * 2, index + 2843392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 8 + 2, product* 8 * 4 * 6 * 3 * 4 * 8 * 2, index + 2843648);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 2, product* 8 * 8 * 2 * 4 * 4 * 8 * 2, index + 2844288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 2, product* 2 * 7 * 6 * 4 * 4 * 8 * 2, index + 2844672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 8 + 2, product* 8 * 2 * 9 * 4 * 4 * 8 * 2, index + 2844928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 2, product* 6 * 3 * 3 * 6 * 4 * 8 * 2, index + 2846336);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 8 + 2, product* 6 * 7 * 9 * 6 * 4 * 8 * 2, index + 2846976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 2, product* 2 * 3 * 2 * 7 * 4 * 8 * 2, index + 2847232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 8 + 2, product* 8 * 8 * 4 * 7 * 4 * 8 * 2, index + 2847488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8 + 2, product* 4 * 4 * 7 * 7 * 4 * 8 * 2, index + 2847744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 8 + 2, product* 2 * 7 * 8 * 7 * 4 * 8 * 2, index + 2847872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 8 + 2, product* 4 * 8 * 3 * 8 * 4 * 8 * 2, index + 2848384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 8 + 2, product* 8 * 6 * 7 * 8 * 4 * 8 * 2, index + 2848768);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 2, product* 6 * 3 * 3 * 2 * 6 * 8 * 2, index + 2862336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 2, product* 4 * 6 * 4 * 2 * 6 * 8 * 2, index + 2862464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 8 + 2, product* 8 * 4 * 8 * 2 * 6 * 8 * 2, index + 2862848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 8 + 2, product* 6 * 7 * 9 * 2 * 6 * 8 * 2, index + 2862976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 2, product* 2 * 3 * 2 * 3 * 6 * 8 * 2, index + 2863232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8 + 2, product* 4 * 4 * 7 * 3 * 6 * 8 * 2, index + 2863744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 2, product* 2 * 7 * 8 * 3 * 6 * 8 * 2, index + 2863872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 8 + 2, product* 4 * 8 * 3 * 4 * 6 * 8 * 2, index + 2864384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 8 + 2, product* 8 * 6 * 7 * 4 * 6 * 8 * 2, index + 2864768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6 + 8 + 2, product* 6 * 9 * 8 * 4 * 6 * 8 * 2, index + 2864896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 2, product* 2 * 3 * 4 * 6 * 6 * 8 * 2, index + 2866432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 2, product* 4 * 2 * 2 * 8 * 6 * 8 * 2, index + 2868224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 8 + 2, product* 4 * 6 * 8 * 8 * 6 * 8 * 2, index + 2868864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 8 + 2, product* 8 * 4 * 2 * 9 * 6 * 8 * 2, index + 2869248);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 8 + 2, product* 8 * 4 * 4 * 2 * 7 * 8 * 2, index + 2872448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 2, product* 2 * 3 * 8 * 2 * 7 * 8 * 2, index + 2872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 2, product* 4 * 4 * 3 * 3 * 7 * 8 * 2, index + 2873344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 8 + 2, product* 2 * 7 * 4 * 3 * 7 * 8 * 2, index + 2873472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 8 + 2, product* 8 * 2 * 7 * 3 * 7 * 8 * 2, index + 2873728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 8 + 2, product* 4 * 8 * 9 * 3 * 7 * 8 * 2, index + 2873984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 8 + 2, product* 6 * 9 * 4 * 4 * 7 * 8 * 2, index + 2874496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 2, product* 4 * 2 * 6 * 4 * 7 * 8 * 2, index + 2874624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 8 + 2, product* 2 * 7 * 6 * 6 * 7 * 8 * 2, index + 2876672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 8 + 2, product* 8 * 2 * 9 * 6 * 7 * 8 * 2, index + 2876928);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 8 + 2, product* 6 * 3 * 3 * 8 * 7 * 8 * 2, index + 2878336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 8 + 2, product* 4 * 6 * 4 * 8 * 7 * 8 * 2, index + 2878464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 8 + 2, product* 6 * 7 * 9 * 8 * 7 * 8 * 2, index + 2878976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 2, product* 2 * 3 * 2 * 9 * 7 * 8 * 2, index + 2879232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 8 + 2, product* 4 * 4 * 7 * 9 * 7 * 8 * 2, index + 2879744);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 2, product* 2 * 3 * 4 * 2 * 8 * 8 * 2, index + 2882432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 2, product* 8 * 2 * 3 * 3 * 8 * 8 * 2, index + 2883328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 2, product* 4 * 2 * 2 * 4 * 8 * 8 * 2, index + 2884224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 8 + 2, product* 6 * 3 * 7 * 4 * 8 * 8 * 2, index + 2884736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 8 + 2, product* 2 * 7 * 2 * 6 * 8 * 8 * 2, index + 2886272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 8 + 2, product* 4 * 2 * 4 * 7 * 8 * 8 * 2, index + 2887424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8 + 8 + 2, product* 6 * 3 * 9 * 7 * 8 * 8 * 2, index + 2887936);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 8 + 2, product* 4 * 4 * 3 * 9 * 8 * 8 * 2, index + 2889344);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 2, product* 4 * 2 * 8 * 3 * 9 * 8 * 2, index + 2893824);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 8 + 2, product* 4 * 6 * 4 * 4 * 9 * 8 * 2, index + 2894464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 8 + 2, product* 4 * 8 * 3 * 6 * 9 * 8 * 2, index + 2896384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 8 + 2, product* 4 * 6 * 6 * 7 * 9 * 8 * 2, index + 2897664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 8 + 2, product* 2 * 3 * 4 * 8 * 9 * 8 * 2, index + 2898432);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 2, product* 8 * 6 * 3 * 2 * 2 * 9 * 2, index + 2922368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 2, product* 6 * 9 * 4 * 2 * 2 * 9 * 2, index + 2922496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 2, product* 4 * 2 * 6 * 2 * 2 * 9 * 2, index + 2922624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 2, product* 4 * 6 * 2 * 3 * 2 * 9 * 2, index + 2923264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 2, product* 2 * 9 * 3 * 3 * 2 * 9 * 2, index + 2923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9 + 2, product* 8 * 4 * 6 * 3 * 2 * 9 * 2, index + 2923648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 9 + 2, product* 6 * 7 * 7 * 3 * 2 * 9 * 2, index + 2923776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9 + 2, product* 8 * 8 * 2 * 4 * 2 * 9 * 2, index + 2924288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 2, product* 2 * 7 * 6 * 4 * 2 * 9 * 2, index + 2924672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9 + 2, product* 8 * 2 * 9 * 4 * 2 * 9 * 2, index + 2924928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 2, product* 6 * 3 * 3 * 6 * 2 * 9 * 2, index + 2926336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 2, product* 2 * 3 * 2 * 7 * 2 * 9 * 2, index + 2927232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 9 + 2, product* 4 * 4 * 7 * 7 * 2 * 9 * 2, index + 2927744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 9 + 2, product* 2 * 7 * 8 * 7 * 2 * 9 * 2, index + 2927872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9 + 2, product* 4 * 8 * 3 * 8 * 2 * 9 * 2, index + 2928384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 9 + 2, product* 6 * 9 * 8 * 8 * 2 * 9 * 2, index + 2928896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 2, product* 4 * 2 * 2 * 2 * 3 * 9 * 2, index + 2932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 2, product* 6 * 3 * 7 * 2 * 3 * 9 * 2, index + 2932736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 9 + 2, product* 4 * 6 * 8 * 2 * 3 * 9 * 2, index + 2932864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 2, product* 2 * 9 * 9 * 2 * 3 * 9 * 2, index + 2932992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 2, product* 8 * 4 * 2 * 3 * 3 * 9 * 2, index + 2933248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 9 + 2, product* 6 * 7 * 3 * 3 * 3 * 9 * 2, index + 2933376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 2, product* 2 * 3 * 6 * 3 * 3 * 9 * 2, index + 2933632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 2, product* 2 * 7 * 2 * 4 * 3 * 9 * 2, index + 2934272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 9 + 2, product* 4 * 8 * 7 * 4 * 3 * 9 * 2, index + 2934784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 2, product* 2 * 3 * 8 * 6 * 3 * 9 * 2, index + 2936832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9 + 2, product* 4 * 4 * 3 * 7 * 3 * 9 * 2, index + 2937344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 9 + 2, product* 2 * 7 * 4 * 7 * 3 * 9 * 2, index + 2937472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 2, product* 8 * 2 * 7 * 7 * 3 * 9 * 2, index + 2937728);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3 + 9 + 2, product* 6 * 9 * 4 * 8 * 3 * 9 * 2, index + 2938496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 9 + 2, product* 4 * 2 * 6 * 8 * 3 * 9 * 2, index + 2938624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 9 + 2, product* 2 * 9 * 3 * 9 * 3 * 9 * 2, index + 2939392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 2, product* 6 * 3 * 3 * 2 * 4 * 9 * 2, index + 2942336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 2, product* 4 * 6 * 4 * 2 * 4 * 9 * 2, index + 2942464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 9 + 2, product* 8 * 4 * 8 * 2 * 4 * 9 * 2, index + 2942848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 9 + 2, product* 6 * 7 * 9 * 2 * 4 * 9 * 2, index + 2942976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 2, product* 2 * 3 * 2 * 3 * 4 * 9 * 2, index + 2943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 2, product* 4 * 4 * 7 * 3 * 4 * 9 * 2, index + 2943744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 2, product* 2 * 7 * 8 * 3 * 4 * 9 * 2, index + 2943872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 2, product* 4 * 8 * 3 * 4 * 4 * 9 * 2, index + 2944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 2, product* 2 * 3 * 4 * 6 * 4 * 9 * 2, index + 2946432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 2, product* 8 * 2 * 3 * 7 * 4 * 9 * 2, index + 2947328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 2, product* 4 * 2 * 2 * 8 * 4 * 9 * 2, index + 2948224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 9 + 2, product* 4 * 6 * 8 * 8 * 4 * 9 * 2, index + 2948864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 9 + 2, product* 8 * 4 * 2 * 9 * 4 * 9 * 2, index + 2949248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4 + 9 + 2, product* 6 * 7 * 3 * 9 * 4 * 9 * 2, index + 2949376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 2, product* 2 * 3 * 6 * 9 * 4 * 9 * 2, index + 2949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 2, product* 2 * 3 * 4 * 2 * 6 * 9 * 2, index + 2962432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9 + 2, product* 8 * 2 * 3 * 3 * 6 * 9 * 2, index + 2963328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 2, product* 4 * 2 * 2 * 4 * 6 * 9 * 2, index + 2964224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 9 + 2, product* 6 * 3 * 7 * 4 * 6 * 9 * 2, index + 2964736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6 + 9 + 2, product* 2 * 9 * 9 * 4 * 6 * 9 * 2, index + 2964992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 9 + 2, product* 2 * 7 * 2 * 6 * 6 * 9 * 2, index + 2966272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 9 + 2, product* 4 * 8 * 7 * 6 * 6 * 9 * 2, index + 2966784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 9 + 2, product* 6 * 9 * 2 * 7 * 6 * 9 * 2, index + 2967296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 9 + 2, product* 2 * 3 * 8 * 8 * 6 * 9 * 2, index + 2968832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 9 + 2, product* 4 * 4 * 3 * 9 * 6 * 9 * 2, index + 2969344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 9 + 2, product* 2 * 7 * 4 * 9 * 6 * 9 * 2, index + 2969472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 9 + 2, product* 8 * 2 * 7 * 9 * 6 * 9 * 2, index + 2969728);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 9 + 2, product* 2 * 7 * 6 * 2 * 7 * 9 * 2, index + 2972672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 9 + 2, product* 8 * 2 * 9 * 2 * 7 * 9 * 2, index + 2972928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 9 + 2, product* 2 * 9 * 9 * 2 * 7 * 9 * 2, index + 2972992);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9 + 2, product* 2 * 3 * 6 * 3 * 7 * 9 * 2, index + 2973632);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 9 + 2, product* 4 * 2 * 8 * 3 * 7 * 9 * 2, index + 2973824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 9 + 2, product* 6 * 3 * 3 * 4 * 7 * 9 * 2, index + 2974336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 9 + 2, product* 4 * 6 * 4 * 4 * 7 * 9 * 2, index + 2974464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 9 + 2, product* 6 * 7 * 9 * 4 * 7 * 9 * 2, index + 2974976);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 2, product* 2 * 3 * 4 * 8 * 7 * 9 * 2, index + 2978432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 9 + 2, product* 4 * 4 * 9 * 8 * 7 * 9 * 2, index + 2978944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 9 + 2, product* 8 * 2 * 3 * 9 * 7 * 9 * 2, index + 2979328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 2, product* 2 * 7 * 2 * 2 * 8 * 9 * 2, index + 2982272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 2, product* 4 * 2 * 4 * 3 * 8 * 9 * 2, index + 2983424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 9 + 2, product* 8 * 4 * 4 * 4 * 8 * 9 * 2, index + 2984448);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 9 + 2, product* 4 * 2 * 6 * 6 * 8 * 9 * 2, index + 2986624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 9 + 2, product* 4 * 6 * 2 * 7 * 8 * 9 * 2, index + 2987264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 9 + 2, product* 2 * 9 * 3 * 7 * 8 * 9 * 2, index + 2987392);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 8 + 9 + 2, product* 6 * 7 * 7 * 7 * 8 * 9 * 2, index + 2987776);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 9 + 2, product* 2 * 7 * 6 * 8 * 8 * 9 * 2, index + 2988672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 9 + 2, product* 4 * 2 * 8 * 9 * 8 * 9 * 2, index + 2989824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 2, product* 4 * 8 * 3 * 2 * 9 * 9 * 2, index + 2992384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 9 + 2, product* 8 * 6 * 7 * 2 * 9 * 9 * 2, index + 2992768);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 9 + 2, product* 4 * 6 * 6 * 3 * 9 * 9 * 2, index + 2993664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9 + 2, product* 2 * 3 * 4 * 4 * 9 * 9 * 2, index + 2994432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9 + 9 + 2, product* 8 * 8 * 6 * 4 * 9 * 9 * 2, index + 2994688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 9 + 2, product* 4 * 2 * 2 * 6 * 9 * 9 * 2, index + 2996224);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9 + 9 + 2, product* 6 * 7 * 3 * 7 * 9 * 9 * 2, index + 2997376);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9 + 9 + 2, product* 2 * 7 * 2 * 8 * 9 * 9 * 2, index + 2998272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 9 + 2, product* 4 * 2 * 4 * 9 * 9 * 9 * 2, index + 2999424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 9 + 9 + 2, product* 6 * 3 * 9 * 9 * 9 * 9 * 2, index + 2999936);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 3, product* 2 * 7 * 2 * 2 * 2 * 2 * 3, index + 3222272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 3, product* 6 * 3 * 3 * 2 * 2 * 2 * 3, index + 3222336);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 3, product* 4 * 8 * 7 * 2 * 2 * 2 * 3, index + 3222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 3, product* 6 * 9 * 2 * 3 * 2 * 2 * 3, index + 3223296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 3, product* 4 * 2 * 4 * 3 * 2 * 2 * 3, index + 3223424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 3, product* 6 * 3 * 9 * 3 * 2 * 2 * 3, index + 3223936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 3, product* 8 * 4 * 4 * 4 * 2 * 2 * 3, index + 3224448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 3, product* 2 * 3 * 8 * 4 * 2 * 2 * 3, index + 3224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 3, product* 8 * 6 * 3 * 6 * 2 * 2 * 3, index + 3226368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 2 + 3, product* 6 * 9 * 4 * 6 * 2 * 2 * 3, index + 3226496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 3, product* 4 * 2 * 6 * 6 * 2 * 2 * 3, index + 3226624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 3, product* 4 * 6 * 2 * 7 * 2 * 2 * 3, index + 3227264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 3, product* 2 * 9 * 3 * 7 * 2 * 2 * 3, index + 3227392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2 + 3, product* 8 * 4 * 6 * 7 * 2 * 2 * 3, index + 3227648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 2 + 3, product* 6 * 7 * 7 * 7 * 2 * 2 * 3, index + 3227776);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2 + 3, product* 8 * 8 * 2 * 8 * 2 * 2 * 3, index + 3228288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2 + 3, product* 2 * 7 * 6 * 8 * 2 * 2 * 3, index + 3228672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 3, product* 8 * 2 * 9 * 8 * 2 * 2 * 3, index + 3228928);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 2 + 3, product* 6 * 9 * 6 * 9 * 2 * 2 * 3, index + 3229696);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2 + 3, product* 4 * 2 * 8 * 9 * 2 * 2 * 3, index + 3229824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 3, product* 4 * 8 * 3 * 2 * 3 * 2 * 3, index + 3232384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 3, product* 8 * 6 * 7 * 2 * 3 * 2 * 3, index + 3232768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 2 + 3, product* 6 * 9 * 8 * 2 * 3 * 2 * 3, index + 3232896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 3, product* 4 * 6 * 6 * 3 * 3 * 2 * 3, index + 3233664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 3, product* 2 * 9 * 7 * 3 * 3 * 2 * 3, index + 3233792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 3, product* 2 * 3 * 4 * 4 * 3 * 2 * 3, index + 3234432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 2 + 3, product* 8 * 8 * 6 * 4 * 3 * 2 * 3, index + 3234688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 3, product* 4 * 4 * 9 * 4 * 3 * 2 * 3, index + 3234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 3, product* 4 * 2 * 2 * 6 * 3 * 2 * 3, index + 3236224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 2 + 3, product* 6 * 3 * 7 * 6 * 3 * 2 * 3, index + 3236736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 3, product* 4 * 6 * 8 * 6 * 3 * 2 * 3, index + 3236864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 2 + 3, product* 2 * 9 * 9 * 6 * 3 * 2 * 3, index + 3236992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 3, product* 8 * 4 * 2 * 7 * 3 * 2 * 3, index + 3237248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 3, product* 6 * 7 * 3 * 7 * 3 * 2 * 3, index + 3237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 3, product* 2 * 3 * 6 * 7 * 3 * 2 * 3, index + 3237632);
-body<0>(stream, sum+ 8 + 8 + 8 + 7 + 3 + 2 + 3, product* 8 * 8 * 8 * 7 * 3 * 2 * 3, index + 3237888);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 3, product* 2 * 7 * 2 * 8 * 3 * 2 * 3, index + 3238272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 2 + 3, product* 4 * 8 * 7 * 8 * 3 * 2 * 3, index + 3238784);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 3, product* 2 * 3 * 2 * 9 * 3 * 2 * 3, index + 3239232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 2 + 3, product* 6 * 9 * 2 * 9 * 3 * 2 * 3, index + 3239296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 3, product* 4 * 2 * 4 * 9 * 3 * 2 * 3, index + 3239424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 3, product* 6 * 3 * 9 * 9 * 3 * 2 * 3, index + 3239936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 3, product* 8 * 6 * 3 * 2 * 4 * 2 * 3, index + 3242368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 3, product* 6 * 9 * 4 * 2 * 4 * 2 * 3, index + 3242496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 3, product* 4 * 2 * 6 * 2 * 4 * 2 * 3, index + 3242624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 3, product* 4 * 6 * 2 * 3 * 4 * 2 * 3, index + 3243264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 3, product* 2 * 9 * 3 * 3 * 4 * 2 * 3, index + 3243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 3, product* 8 * 4 * 6 * 3 * 4 * 2 * 3, index + 3243648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 3, product* 6 * 7 * 7 * 3 * 4 * 2 * 3, index + 3243776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 3, product* 8 * 8 * 2 * 4 * 4 * 2 * 3, index + 3244288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 3, product* 2 * 7 * 6 * 4 * 4 * 2 * 3, index + 3244672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 2 + 3, product* 8 * 2 * 9 * 4 * 4 * 2 * 3, index + 3244928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 3, product* 6 * 3 * 3 * 6 * 4 * 2 * 3, index + 3246336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 2 + 3, product* 4 * 6 * 4 * 6 * 4 * 2 * 3, index + 3246464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 2 + 3, product* 8 * 4 * 8 * 6 * 4 * 2 * 3, index + 3246848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 3, product* 2 * 3 * 2 * 7 * 4 * 2 * 3, index + 3247232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 2 + 3, product* 8 * 8 * 4 * 7 * 4 * 2 * 3, index + 3247488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 2 + 3, product* 4 * 4 * 7 * 7 * 4 * 2 * 3, index + 3247744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 2 + 3, product* 2 * 7 * 8 * 7 * 4 * 2 * 3, index + 3247872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 3, product* 4 * 8 * 3 * 8 * 4 * 2 * 3, index + 3248384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 2 + 3, product* 8 * 6 * 7 * 8 * 4 * 2 * 3, index + 3248768);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 2 + 3, product* 4 * 6 * 6 * 9 * 4 * 2 * 3, index + 3249664);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 2 + 3, product* 2 * 9 * 7 * 9 * 4 * 2 * 3, index + 3249792);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 3, product* 6 * 3 * 3 * 2 * 6 * 2 * 3, index + 3262336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 3, product* 4 * 6 * 4 * 2 * 6 * 2 * 3, index + 3262464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 3, product* 8 * 4 * 8 * 2 * 6 * 2 * 3, index + 3262848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 2 + 3, product* 6 * 7 * 9 * 2 * 6 * 2 * 3, index + 3262976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 3, product* 2 * 3 * 2 * 3 * 6 * 2 * 3, index + 3263232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 3, product* 8 * 8 * 4 * 3 * 6 * 2 * 3, index + 3263488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 2 + 3, product* 4 * 4 * 7 * 3 * 6 * 2 * 3, index + 3263744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 3, product* 2 * 7 * 8 * 3 * 6 * 2 * 3, index + 3263872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 3, product* 4 * 8 * 3 * 4 * 6 * 2 * 3, index + 3264384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 2 + 3, product* 8 * 6 * 7 * 4 * 6 * 2 * 3, index + 3264768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 3, product* 2 * 3 * 4 * 6 * 6 * 2 * 3, index + 3266432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 2 + 3, product* 8 * 8 * 6 * 6 * 6 * 2 * 3, index + 3266688);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 3, product* 8 * 2 * 3 * 7 * 6 * 2 * 3, index + 3267328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 6 + 2 + 3, product* 8 * 6 * 9 * 7 * 6 * 2 * 3, index + 3267968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 3, product* 4 * 2 * 2 * 8 * 6 * 2 * 3, index + 3268224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 2 + 3, product* 6 * 3 * 7 * 8 * 6 * 2 * 3, index + 3268736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 2 + 3, product* 4 * 6 * 8 * 8 * 6 * 2 * 3, index + 3268864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 2 + 3, product* 2 * 9 * 9 * 8 * 6 * 2 * 3, index + 3268992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 2 + 3, product* 8 * 4 * 2 * 9 * 6 * 2 * 3, index + 3269248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 2 + 3, product* 6 * 7 * 3 * 9 * 6 * 2 * 3, index + 3269376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2 + 3, product* 2 * 3 * 6 * 9 * 6 * 2 * 3, index + 3269632);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 6 + 2 + 3, product* 8 * 8 * 8 * 9 * 6 * 2 * 3, index + 3269888);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 3, product* 8 * 4 * 4 * 2 * 7 * 2 * 3, index + 3272448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 3, product* 2 * 3 * 8 * 2 * 7 * 2 * 3, index + 3272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 3, product* 4 * 4 * 3 * 3 * 7 * 2 * 3, index + 3273344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 3, product* 2 * 7 * 4 * 3 * 7 * 2 * 3, index + 3273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 3, product* 8 * 2 * 7 * 3 * 7 * 2 * 3, index + 3273728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 3, product* 4 * 8 * 9 * 3 * 7 * 2 * 3, index + 3273984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 3, product* 8 * 6 * 3 * 4 * 7 * 2 * 3, index + 3274368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2 + 3, product* 6 * 9 * 4 * 4 * 7 * 2 * 3, index + 3274496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 3, product* 4 * 2 * 6 * 4 * 7 * 2 * 3, index + 3274624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 2 + 3, product* 8 * 8 * 2 * 6 * 7 * 2 * 3, index + 3276288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 3, product* 2 * 7 * 6 * 6 * 7 * 2 * 3, index + 3276672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 2 + 3, product* 8 * 2 * 9 * 6 * 7 * 2 * 3, index + 3276928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 3, product* 4 * 2 * 8 * 7 * 7 * 2 * 3, index + 3277824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2 + 3, product* 6 * 3 * 3 * 8 * 7 * 2 * 3, index + 3278336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 2 + 3, product* 4 * 6 * 4 * 8 * 7 * 2 * 3, index + 3278464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 3, product* 2 * 3 * 2 * 9 * 7 * 2 * 3, index + 3279232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7 + 2 + 3, product* 8 * 8 * 4 * 9 * 7 * 2 * 3, index + 3279488);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7 + 2 + 3, product* 2 * 7 * 8 * 9 * 7 * 2 * 3, index + 3279872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 3, product* 2 * 3 * 4 * 2 * 8 * 2 * 3, index + 3282432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 2 + 3, product* 8 * 8 * 6 * 2 * 8 * 2 * 3, index + 3282688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 3, product* 4 * 4 * 9 * 2 * 8 * 2 * 3, index + 3282944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 3, product* 8 * 2 * 3 * 3 * 8 * 2 * 3, index + 3283328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 2 + 3, product* 8 * 6 * 9 * 3 * 8 * 2 * 3, index + 3283968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 3, product* 4 * 2 * 2 * 4 * 8 * 2 * 3, index + 3284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 3, product* 6 * 3 * 7 * 4 * 8 * 2 * 3, index + 3284736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 2 + 3, product* 4 * 6 * 8 * 4 * 8 * 2 * 3, index + 3284864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 2 + 3, product* 2 * 9 * 9 * 4 * 8 * 2 * 3, index + 3284992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 3, product* 2 * 7 * 2 * 6 * 8 * 2 * 3, index + 3286272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 8 + 2 + 3, product* 4 * 8 * 7 * 6 * 8 * 2 * 3, index + 3286784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 2 + 3, product* 6 * 9 * 2 * 7 * 8 * 2 * 3, index + 3287296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2 + 3, product* 4 * 2 * 4 * 7 * 8 * 2 * 3, index + 3287424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 2 + 3, product* 8 * 4 * 4 * 8 * 8 * 2 * 3, index + 3288448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2 + 3, product* 2 * 3 * 8 * 8 * 8 * 2 * 3, index + 3288832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 2 + 3, product* 4 * 4 * 3 * 9 * 8 * 2 * 3, index + 3289344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 2 + 3, product* 2 * 7 * 4 * 9 * 8 * 2 * 3, index + 3289472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8 + 2 + 3, product* 4 * 8 * 9 * 9 * 8 * 2 * 3, index + 3289984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 3, product* 8 * 8 * 2 * 2 * 9 * 2 * 3, index + 3292288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 3, product* 2 * 7 * 6 * 2 * 9 * 2 * 3, index + 3292672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 2 + 3, product* 8 * 2 * 9 * 2 * 9 * 2 * 3, index + 3292928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 2 + 3, product* 6 * 9 * 6 * 3 * 9 * 2 * 3, index + 3293696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 3, product* 4 * 2 * 8 * 3 * 9 * 2 * 3, index + 3293824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 2 + 3, product* 6 * 3 * 3 * 4 * 9 * 2 * 3, index + 3294336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 3, product* 4 * 6 * 4 * 4 * 9 * 2 * 3, index + 3294464);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 2 + 3, product* 8 * 4 * 8 * 4 * 9 * 2 * 3, index + 3294848);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 9 + 2 + 3, product* 6 * 9 * 8 * 6 * 9 * 2 * 3, index + 3296896);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 2 + 3, product* 4 * 6 * 6 * 7 * 9 * 2 * 3, index + 3297664);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 2 + 3, product* 2 * 9 * 7 * 7 * 9 * 2 * 3, index + 3297792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 3, product* 2 * 3 * 4 * 8 * 9 * 2 * 3, index + 3298432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 2 + 3, product* 4 * 4 * 9 * 8 * 9 * 2 * 3, index + 3298944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 2 + 3, product* 8 * 2 * 3 * 9 * 9 * 2 * 3, index + 3299328);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 3, product* 8 * 6 * 3 * 2 * 2 * 3 * 3, index + 3322368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 3, product* 6 * 9 * 4 * 2 * 2 * 3 * 3, index + 3322496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 3, product* 4 * 2 * 6 * 2 * 2 * 3 * 3, index + 3322624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 3, product* 4 * 6 * 2 * 3 * 2 * 3 * 3, index + 3323264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 3, product* 2 * 9 * 3 * 3 * 2 * 3 * 3, index + 3323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 3, product* 8 * 4 * 6 * 3 * 2 * 3 * 3, index + 3323648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 3, product* 6 * 7 * 7 * 3 * 2 * 3 * 3, index + 3323776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 3, product* 8 * 8 * 2 * 4 * 2 * 3 * 3, index + 3324288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 3, product* 2 * 7 * 6 * 4 * 2 * 3 * 3, index + 3324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 3, product* 8 * 2 * 9 * 4 * 2 * 3 * 3, index + 3324928);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 3, product* 2 * 9 * 9 * 4 * 2 * 3 * 3, index + 3324992);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 3, product* 6 * 3 * 3 * 6 * 2 * 3 * 3, index + 3326336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 3, product* 4 * 6 * 4 * 6 * 2 * 3 * 3, index + 3326464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 3 + 3, product* 8 * 4 * 8 * 6 * 2 * 3 * 3, index + 3326848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 3, product* 2 * 3 * 2 * 7 * 2 * 3 * 3, index + 3327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 3, product* 8 * 8 * 4 * 7 * 2 * 3 * 3, index + 3327488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 3, product* 4 * 4 * 7 * 7 * 2 * 3 * 3, index + 3327744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 3, product* 2 * 7 * 8 * 7 * 2 * 3 * 3, index + 3327872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 3, product* 4 * 8 * 3 * 8 * 2 * 3 * 3, index + 3328384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3 + 3, product* 8 * 6 * 7 * 8 * 2 * 3 * 3, index + 3328768);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 3 + 3, product* 4 * 6 * 6 * 9 * 2 * 3 * 3, index + 3329664);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 3, product* 2 * 9 * 7 * 9 * 2 * 3 * 3, index + 3329792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 3, product* 4 * 2 * 2 * 2 * 3 * 3 * 3, index + 3332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 3, product* 6 * 3 * 7 * 2 * 3 * 3 * 3, index + 3332736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 3, product* 4 * 6 * 8 * 2 * 3 * 3 * 3, index + 3332864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 3, product* 2 * 9 * 9 * 2 * 3 * 3 * 3, index + 3332992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 3, product* 8 * 4 * 2 * 3 * 3 * 3 * 3, index + 3333248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 3, product* 6 * 7 * 3 * 3 * 3 * 3 * 3, index + 3333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 3, product* 2 * 3 * 6 * 3 * 3 * 3 * 3, index + 3333632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 3 + 3, product* 8 * 8 * 8 * 3 * 3 * 3 * 3, index + 3333888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 3, product* 2 * 7 * 2 * 4 * 3 * 3 * 3, index + 3334272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 3 + 3, product* 4 * 8 * 7 * 4 * 3 * 3 * 3, index + 3334784);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 3 + 3, product* 8 * 4 * 4 * 6 * 3 * 3 * 3, index + 3336448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 3, product* 2 * 3 * 8 * 6 * 3 * 3 * 3, index + 3336832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 3, product* 4 * 4 * 3 * 7 * 3 * 3 * 3, index + 3337344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 3, product* 2 * 7 * 4 * 7 * 3 * 3 * 3, index + 3337472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 3 + 3, product* 8 * 2 * 7 * 7 * 3 * 3 * 3, index + 3337728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3 + 3 + 3, product* 4 * 8 * 9 * 7 * 3 * 3 * 3, index + 3337984);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3 + 3 + 3, product* 6 * 9 * 4 * 8 * 3 * 3 * 3, index + 3338496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 3, product* 4 * 2 * 6 * 8 * 3 * 3 * 3, index + 3338624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 3 + 3, product* 2 * 3 * 2 * 9 * 3 * 3 * 3, index + 3339232);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 3, product* 4 * 6 * 2 * 9 * 3 * 3 * 3, index + 3339264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 3, product* 2 * 9 * 3 * 9 * 3 * 3 * 3, index + 3339392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 3 + 3, product* 8 * 4 * 6 * 9 * 3 * 3 * 3, index + 3339648);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 3, product* 2 * 7 * 2 * 2 * 4 * 3 * 3, index + 3342272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 3, product* 6 * 3 * 3 * 2 * 4 * 3 * 3, index + 3342336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 3, product* 4 * 6 * 4 * 2 * 4 * 3 * 3, index + 3342464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 3, product* 8 * 4 * 8 * 2 * 4 * 3 * 3, index + 3342848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 3 + 3, product* 6 * 7 * 9 * 2 * 4 * 3 * 3, index + 3342976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 3, product* 2 * 3 * 2 * 3 * 4 * 3 * 3, index + 3343232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3 + 3, product* 8 * 8 * 4 * 3 * 4 * 3 * 3, index + 3343488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 3, product* 4 * 4 * 7 * 3 * 4 * 3 * 3, index + 3343744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 3, product* 2 * 7 * 8 * 3 * 4 * 3 * 3, index + 3343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 3, product* 4 * 8 * 3 * 4 * 4 * 3 * 3, index + 3344384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3 + 3, product* 8 * 6 * 7 * 4 * 4 * 3 * 3, index + 3344768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 3, product* 2 * 3 * 4 * 6 * 4 * 3 * 3, index + 3346432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 3 + 3, product* 8 * 8 * 6 * 6 * 4 * 3 * 3, index + 3346688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 3 + 3, product* 4 * 4 * 9 * 6 * 4 * 3 * 3, index + 3346944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 3, product* 8 * 2 * 3 * 7 * 4 * 3 * 3, index + 3347328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 3, product* 4 * 2 * 2 * 8 * 4 * 3 * 3, index + 3348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 3, product* 6 * 3 * 7 * 8 * 4 * 3 * 3, index + 3348736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 3 + 3, product* 2 * 9 * 9 * 8 * 4 * 3 * 3, index + 3348992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 3, product* 8 * 4 * 2 * 9 * 4 * 3 * 3, index + 3349248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 3, product* 2 * 3 * 6 * 9 * 4 * 3 * 3, index + 3349632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 3, product* 2 * 3 * 4 * 2 * 6 * 3 * 3, index + 3362432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 3 + 3, product* 8 * 8 * 6 * 2 * 6 * 3 * 3, index + 3362688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 3, product* 4 * 4 * 9 * 2 * 6 * 3 * 3, index + 3362944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 3, product* 8 * 2 * 3 * 3 * 6 * 3 * 3, index + 3363328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 3, product* 8 * 6 * 9 * 3 * 6 * 3 * 3, index + 3363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 3, product* 4 * 2 * 2 * 4 * 6 * 3 * 3, index + 3364224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 3 + 3, product* 6 * 3 * 7 * 4 * 6 * 3 * 3, index + 3364736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 3 + 3, product* 4 * 6 * 8 * 4 * 6 * 3 * 3, index + 3364864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3 + 3, product* 2 * 7 * 2 * 6 * 6 * 3 * 3, index + 3366272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 3, product* 4 * 2 * 4 * 7 * 6 * 3 * 3, index + 3367424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 3 + 3, product* 6 * 3 * 9 * 7 * 6 * 3 * 3, index + 3367936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 3, product* 8 * 4 * 4 * 8 * 6 * 3 * 3, index + 3368448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 3 + 3, product* 2 * 7 * 4 * 9 * 6 * 3 * 3, index + 3369472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 3 + 3, product* 8 * 2 * 7 * 9 * 6 * 3 * 3, index + 3369728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 6 + 3 + 3, product* 4 * 8 * 9 * 9 * 6 * 3 * 3, index + 3369984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3 + 3, product* 8 * 8 * 2 * 2 * 7 * 3 * 3, index + 3372288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 3, product* 2 * 7 * 6 * 2 * 7 * 3 * 3, index + 3372672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3 + 3, product* 8 * 2 * 9 * 2 * 7 * 3 * 3, index + 3372928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 7 + 3 + 3, product* 6 * 9 * 6 * 3 * 7 * 3 * 3, index + 3373696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 3, product* 4 * 2 * 8 * 3 * 7 * 3 * 3, index + 3373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 3, product* 6 * 3 * 3 * 4 * 7 * 3 * 3, index + 3374336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 3 + 3, product* 4 * 6 * 4 * 4 * 7 * 3 * 3, index + 3374464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 3 + 3, product* 6 * 7 * 9 * 4 * 7 * 3 * 3, index + 3374976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 3 + 3, product* 4 * 8 * 3 * 6 * 7 * 3 * 3, index + 3376384);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 7 + 3 + 3, product* 8 * 6 * 7 * 6 * 7 * 3 * 3, index + 3376768);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 7 + 3 + 3, product* 6 * 9 * 8 * 6 * 7 * 3 * 3, index + 3376896);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 3, product* 2 * 7 * 4 * 7 * 7 * 3 * 3, index + 3377472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 7 + 3 + 3, product* 4 * 6 * 6 * 7 * 7 * 3 * 3, index + 3377664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 3, product* 2 * 3 * 4 * 8 * 7 * 3 * 3, index + 3378432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 3 + 3, product* 4 * 4 * 9 * 8 * 7 * 3 * 3, index + 3378944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 3 + 3, product* 8 * 2 * 3 * 9 * 7 * 3 * 3, index + 3379328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 3, product* 2 * 7 * 2 * 2 * 8 * 3 * 3, index + 3382272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3 + 3, product* 4 * 8 * 7 * 2 * 8 * 3 * 3, index + 3382784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 3, product* 6 * 9 * 2 * 3 * 8 * 3 * 3, index + 3383296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 3, product* 4 * 2 * 4 * 3 * 8 * 3 * 3, index + 3383424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 3 + 3, product* 8 * 4 * 4 * 4 * 8 * 3 * 3, index + 3384448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 3, product* 2 * 3 * 8 * 4 * 8 * 3 * 3, index + 3384832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8 + 3 + 3, product* 6 * 9 * 4 * 6 * 8 * 3 * 3, index + 3386496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 3 + 3, product* 4 * 2 * 6 * 6 * 8 * 3 * 3, index + 3386624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 3 + 3, product* 4 * 6 * 2 * 7 * 8 * 3 * 3, index + 3387264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 3 + 3, product* 2 * 9 * 3 * 7 * 8 * 3 * 3, index + 3387392);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 3 + 3, product* 4 * 2 * 8 * 9 * 8 * 3 * 3, index + 3389824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 3, product* 4 * 8 * 3 * 2 * 9 * 3 * 3, index + 3392384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 3 + 3, product* 8 * 6 * 7 * 2 * 9 * 3 * 3, index + 3392768);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 3 + 3, product* 4 * 6 * 6 * 3 * 9 * 3 * 3, index + 3393664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3 + 3, product* 2 * 9 * 7 * 3 * 9 * 3 * 3, index + 3393792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 3, product* 2 * 3 * 4 * 4 * 9 * 3 * 3, index + 3394432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9 + 3 + 3, product* 8 * 8 * 6 * 4 * 9 * 3 * 3, index + 3394688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 3 + 3, product* 4 * 2 * 2 * 6 * 9 * 3 * 3, index + 3396224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9 + 3 + 3, product* 6 * 3 * 7 * 6 * 9 * 3 * 3, index + 3396736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 9 + 3 + 3, product* 4 * 6 * 8 * 6 * 9 * 3 * 3, index + 3396864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3 + 3, product* 2 * 3 * 6 * 7 * 9 * 3 * 3, index + 3397632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 3, product* 4 * 2 * 4 * 9 * 9 * 3 * 3, index + 3399424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 3, product* 6 * 3 * 3 * 2 * 2 * 4 * 3, index + 3422336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 3, product* 4 * 6 * 4 * 2 * 2 * 4 * 3, index + 3422464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4 + 3, product* 8 * 4 * 8 * 2 * 2 * 4 * 3, index + 3422848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 3, product* 6 * 7 * 9 * 2 * 2 * 4 * 3, index + 3422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 3, product* 2 * 3 * 2 * 3 * 2 * 4 * 3, index + 3423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 3, product* 8 * 8 * 4 * 3 * 2 * 4 * 3, index + 3423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 3, product* 4 * 4 * 7 * 3 * 2 * 4 * 3, index + 3423744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 3, product* 2 * 7 * 8 * 3 * 2 * 4 * 3, index + 3423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 3, product* 4 * 8 * 3 * 4 * 2 * 4 * 3, index + 3424384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 4 + 3, product* 8 * 6 * 7 * 4 * 2 * 4 * 3, index + 3424768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 4 + 3, product* 6 * 9 * 8 * 4 * 2 * 4 * 3, index + 3424896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 3, product* 2 * 3 * 4 * 6 * 2 * 4 * 3, index + 3426432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 4 + 3, product* 8 * 8 * 6 * 6 * 2 * 4 * 3, index + 3426688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 4 + 3, product* 4 * 4 * 9 * 6 * 2 * 4 * 3, index + 3426944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 3, product* 8 * 2 * 3 * 7 * 2 * 4 * 3, index + 3427328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 3, product* 4 * 2 * 2 * 8 * 2 * 4 * 3, index + 3428224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4 + 3, product* 6 * 3 * 7 * 8 * 2 * 4 * 3, index + 3428736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 4 + 3, product* 4 * 6 * 8 * 8 * 2 * 4 * 3, index + 3428864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4 + 3, product* 8 * 4 * 2 * 9 * 2 * 4 * 3, index + 3429248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 3, product* 2 * 3 * 6 * 9 * 2 * 4 * 3, index + 3429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 3, product* 8 * 4 * 4 * 2 * 3 * 4 * 3, index + 3432448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 3, product* 2 * 3 * 8 * 2 * 3 * 4 * 3, index + 3432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 3, product* 4 * 4 * 3 * 3 * 3 * 4 * 3, index + 3433344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 3, product* 2 * 7 * 4 * 3 * 3 * 4 * 3, index + 3433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 3, product* 8 * 2 * 7 * 3 * 3 * 4 * 3, index + 3433728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 3, product* 4 * 8 * 9 * 3 * 3 * 4 * 3, index + 3433984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4 + 3, product* 8 * 6 * 3 * 4 * 3 * 4 * 3, index + 3434368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 4 + 3, product* 6 * 9 * 4 * 4 * 3 * 4 * 3, index + 3434496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 3, product* 4 * 2 * 6 * 4 * 3 * 4 * 3, index + 3434624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4 + 3, product* 8 * 8 * 2 * 6 * 3 * 4 * 3, index + 3436288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 4 + 3, product* 2 * 7 * 6 * 6 * 3 * 4 * 3, index + 3436672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 4 + 3, product* 8 * 2 * 9 * 6 * 3 * 4 * 3, index + 3436928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 4 + 3, product* 6 * 9 * 6 * 7 * 3 * 4 * 3, index + 3437696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4 + 3, product* 4 * 2 * 8 * 7 * 3 * 4 * 3, index + 3437824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 3, product* 6 * 3 * 3 * 8 * 3 * 4 * 3, index + 3438336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 4 + 3, product* 4 * 6 * 4 * 8 * 3 * 4 * 3, index + 3438464);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 4 + 3, product* 8 * 4 * 8 * 8 * 3 * 4 * 3, index + 3438848);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 3, product* 2 * 3 * 2 * 9 * 3 * 4 * 3, index + 3439232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 4 + 3, product* 8 * 8 * 4 * 9 * 3 * 4 * 3, index + 3439488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 4 + 3, product* 4 * 4 * 7 * 9 * 3 * 4 * 3, index + 3439744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 4 + 3, product* 2 * 7 * 8 * 9 * 3 * 4 * 3, index + 3439872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 3, product* 2 * 3 * 4 * 2 * 4 * 4 * 3, index + 3442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 3, product* 4 * 4 * 9 * 2 * 4 * 4 * 3, index + 3442944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 3, product* 8 * 2 * 3 * 3 * 4 * 4 * 3, index + 3443328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 3, product* 4 * 2 * 2 * 4 * 4 * 4 * 3, index + 3444224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 4 + 3, product* 6 * 3 * 7 * 4 * 4 * 4 * 3, index + 3444736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 4 + 3, product* 4 * 6 * 8 * 4 * 4 * 4 * 3, index + 3444864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 4 + 3, product* 2 * 9 * 9 * 4 * 4 * 4 * 3, index + 3444992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 3, product* 2 * 7 * 2 * 6 * 4 * 4 * 3, index + 3446272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 4 + 3, product* 4 * 8 * 7 * 6 * 4 * 4 * 3, index + 3446784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 4 + 3, product* 6 * 9 * 2 * 7 * 4 * 4 * 3, index + 3447296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 3, product* 4 * 2 * 4 * 7 * 4 * 4 * 3, index + 3447424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 4 + 3, product* 8 * 4 * 4 * 8 * 4 * 4 * 3, index + 3448448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 4 + 3, product* 2 * 3 * 8 * 8 * 4 * 4 * 3, index + 3448832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 3, product* 4 * 4 * 3 * 9 * 4 * 4 * 3, index + 3449344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 4 + 3, product* 2 * 7 * 4 * 9 * 4 * 4 * 3, index + 3449472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 4 + 3, product* 8 * 2 * 7 * 9 * 4 * 4 * 3, index + 3449728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 3, product* 2 * 7 * 2 * 2 * 6 * 4 * 3, index + 3462272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 4 + 3, product* 4 * 8 * 7 * 2 * 6 * 4 * 3, index + 3462784);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 3, product* 4 * 2 * 4 * 3 * 6 * 4 * 3, index + 3463424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 4 + 3, product* 6 * 3 * 9 * 3 * 6 * 4 * 3, index + 3463936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 4 + 3, product* 8 * 4 * 4 * 4 * 6 * 4 * 3, index + 3464448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 3, product* 2 * 3 * 8 * 4 * 6 * 4 * 3, index + 3464832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 4 + 3, product* 8 * 6 * 3 * 6 * 6 * 4 * 3, index + 3466368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 4 + 3, product* 4 * 2 * 6 * 6 * 6 * 4 * 3, index + 3466624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 3, product* 4 * 6 * 2 * 7 * 6 * 4 * 3, index + 3467264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 4 + 3, product* 2 * 9 * 3 * 7 * 6 * 4 * 3, index + 3467392);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 4 + 3, product* 6 * 7 * 7 * 7 * 6 * 4 * 3, index + 3467776);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 4 + 3, product* 8 * 2 * 9 * 8 * 6 * 4 * 3, index + 3468928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 4 + 3, product* 4 * 2 * 8 * 9 * 6 * 4 * 3, index + 3469824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 3, product* 4 * 8 * 3 * 2 * 7 * 4 * 3, index + 3472384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 4 + 3, product* 4 * 6 * 6 * 3 * 7 * 4 * 3, index + 3473664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 3, product* 2 * 3 * 4 * 4 * 7 * 4 * 3, index + 3474432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 4 + 3, product* 8 * 8 * 6 * 4 * 7 * 4 * 3, index + 3474688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 4 + 3, product* 4 * 4 * 9 * 4 * 7 * 4 * 3, index + 3474944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 3, product* 4 * 2 * 2 * 6 * 7 * 4 * 3, index + 3476224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 4 + 3, product* 6 * 3 * 7 * 6 * 7 * 4 * 3, index + 3476736);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 4 + 3, product* 2 * 9 * 9 * 6 * 7 * 4 * 3, index + 3476992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 4 + 3, product* 8 * 4 * 2 * 7 * 7 * 4 * 3, index + 3477248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 3, product* 2 * 3 * 6 * 7 * 7 * 4 * 3, index + 3477632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 3, product* 2 * 7 * 2 * 8 * 7 * 4 * 3, index + 3478272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 4 + 3, product* 6 * 9 * 2 * 9 * 7 * 4 * 3, index + 3479296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 4 + 3, product* 4 * 2 * 4 * 9 * 7 * 4 * 3, index + 3479424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4 + 3, product* 8 * 6 * 3 * 2 * 8 * 4 * 3, index + 3482368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 3, product* 4 * 2 * 6 * 2 * 8 * 4 * 3, index + 3482624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 4 + 3, product* 4 * 6 * 2 * 3 * 8 * 4 * 3, index + 3483264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 3, product* 2 * 9 * 3 * 3 * 8 * 4 * 3, index + 3483392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 4 + 3, product* 8 * 4 * 6 * 3 * 8 * 4 * 3, index + 3483648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 4 + 3, product* 6 * 7 * 7 * 3 * 8 * 4 * 3, index + 3483776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 4 + 3, product* 8 * 8 * 2 * 4 * 8 * 4 * 3, index + 3484288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 4 + 3, product* 2 * 7 * 6 * 4 * 8 * 4 * 3, index + 3484672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 4 + 3, product* 6 * 3 * 3 * 6 * 8 * 4 * 3, index + 3486336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4 + 3, product* 4 * 6 * 4 * 6 * 8 * 4 * 3, index + 3486464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 3, product* 2 * 3 * 2 * 7 * 8 * 4 * 3, index + 3487232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 4 + 3, product* 4 * 4 * 7 * 7 * 8 * 4 * 3, index + 3487744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 4 + 3, product* 2 * 7 * 8 * 7 * 8 * 4 * 3, index + 3487872);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 4 + 3, product* 4 * 6 * 6 * 9 * 8 * 4 * 3, index + 3489664);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 4 + 3, product* 2 * 9 * 7 * 9 * 8 * 4 * 3, index + 3489792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 3, product* 4 * 2 * 2 * 2 * 9 * 4 * 3, index + 3492224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 4 + 3, product* 2 * 9 * 9 * 2 * 9 * 4 * 3, index + 3492992);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 4 + 3, product* 6 * 7 * 3 * 3 * 9 * 4 * 3, index + 3493376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 3, product* 2 * 3 * 6 * 3 * 9 * 4 * 3, index + 3493632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 4 + 3, product* 8 * 8 * 8 * 3 * 9 * 4 * 3, index + 3493888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4 + 3, product* 2 * 7 * 2 * 4 * 9 * 4 * 3, index + 3494272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4 + 3, product* 2 * 3 * 8 * 6 * 9 * 4 * 3, index + 3496832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 4 + 3, product* 4 * 4 * 3 * 7 * 9 * 4 * 3, index + 3497344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 4 + 3, product* 2 * 7 * 4 * 7 * 9 * 4 * 3, index + 3497472);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9 + 4 + 3, product* 4 * 8 * 9 * 7 * 9 * 4 * 3, index + 3497984);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 4 + 3, product* 6 * 9 * 4 * 8 * 9 * 4 * 3, index + 3498496);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 4 + 3, product* 4 * 2 * 6 * 8 * 9 * 4 * 3, index + 3498624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 4 + 3, product* 4 * 6 * 2 * 9 * 9 * 4 * 3, index + 3499264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 4 + 3, product* 2 * 9 * 3 * 9 * 9 * 4 * 3, index + 3499392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 3, product* 2 * 7 * 2 * 2 * 2 * 6 * 3, index + 3622272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6 + 3, product* 4 * 8 * 7 * 2 * 2 * 6 * 3, index + 3622784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 3, product* 6 * 9 * 2 * 3 * 2 * 6 * 3, index + 3623296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 3, product* 4 * 2 * 4 * 3 * 2 * 6 * 3, index + 3623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 3, product* 6 * 3 * 9 * 3 * 2 * 6 * 3, index + 3623936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 3, product* 8 * 4 * 4 * 4 * 2 * 6 * 3, index + 3624448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 3, product* 2 * 3 * 8 * 4 * 2 * 6 * 3, index + 3624832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 6 + 3, product* 8 * 6 * 3 * 6 * 2 * 6 * 3, index + 3626368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 6 + 3, product* 6 * 9 * 4 * 6 * 2 * 6 * 3, index + 3626496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 3, product* 4 * 2 * 6 * 6 * 2 * 6 * 3, index + 3626624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 3, product* 4 * 6 * 2 * 7 * 2 * 6 * 3, index + 3627264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 3, product* 2 * 9 * 3 * 7 * 2 * 6 * 3, index + 3627392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 6 + 3, product* 8 * 4 * 6 * 7 * 2 * 6 * 3, index + 3627648);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 6 + 3, product* 8 * 8 * 2 * 8 * 2 * 6 * 3, index + 3628288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 6 + 3, product* 2 * 7 * 6 * 8 * 2 * 6 * 3, index + 3628672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 6 + 3, product* 4 * 2 * 8 * 9 * 2 * 6 * 3, index + 3629824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 3, product* 4 * 8 * 3 * 2 * 3 * 6 * 3, index + 3632384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 6 + 3, product* 8 * 6 * 7 * 2 * 3 * 6 * 3, index + 3632768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 6 + 3, product* 6 * 9 * 8 * 2 * 3 * 6 * 3, index + 3632896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6 + 3, product* 4 * 6 * 6 * 3 * 3 * 6 * 3, index + 3633664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 6 + 3, product* 2 * 9 * 7 * 3 * 3 * 6 * 3, index + 3633792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 3, product* 2 * 3 * 4 * 4 * 3 * 6 * 3, index + 3634432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 6 + 3, product* 4 * 4 * 9 * 4 * 3 * 6 * 3, index + 3634944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 3, product* 4 * 2 * 2 * 6 * 3 * 6 * 3, index + 3636224);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 3, product* 2 * 7 * 6 * 6 * 3 * 6 * 3, index + 3636672);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 6 + 3, product* 6 * 3 * 7 * 6 * 3 * 6 * 3, index + 3636736);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 6 + 3, product* 2 * 9 * 9 * 6 * 3 * 6 * 3, index + 3636992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 6 + 3, product* 8 * 4 * 2 * 7 * 3 * 6 * 3, index + 3637248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 6 + 3, product* 6 * 7 * 3 * 7 * 3 * 6 * 3, index + 3637376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 6 + 3, product* 2 * 3 * 6 * 7 * 3 * 6 * 3, index + 3637632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 3, product* 2 * 7 * 2 * 8 * 3 * 6 * 3, index + 3638272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 6 + 3, product* 4 * 8 * 7 * 8 * 3 * 6 * 3, index + 3638784);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 6 + 3, product* 6 * 9 * 2 * 9 * 3 * 6 * 3, index + 3639296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 3, product* 4 * 2 * 4 * 9 * 3 * 6 * 3, index + 3639424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 6 + 3, product* 8 * 6 * 3 * 2 * 4 * 6 * 3, index + 3642368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 6 + 3, product* 6 * 9 * 4 * 2 * 4 * 6 * 3, index + 3642496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 3, product* 4 * 2 * 6 * 2 * 4 * 6 * 3, index + 3642624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 3, product* 4 * 6 * 2 * 3 * 4 * 6 * 3, index + 3643264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 6 + 3, product* 2 * 9 * 3 * 3 * 4 * 6 * 3, index + 3643392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 6 + 3, product* 8 * 4 * 6 * 3 * 4 * 6 * 3, index + 3643648);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 6 + 3, product* 8 * 8 * 2 * 4 * 4 * 6 * 3, index + 3644288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 3, product* 2 * 7 * 6 * 4 * 4 * 6 * 3, index + 3644672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 6 + 3, product* 8 * 2 * 9 * 4 * 4 * 6 * 3, index + 3644928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 3, product* 6 * 3 * 3 * 6 * 4 * 6 * 3, index + 3646336);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 6 + 3, product* 6 * 7 * 9 * 6 * 4 * 6 * 3, index + 3646976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 3, product* 2 * 3 * 2 * 7 * 4 * 6 * 3, index + 3647232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 6 + 3, product* 4 * 4 * 7 * 7 * 4 * 6 * 3, index + 3647744);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 6 + 3, product* 6 * 3 * 9 * 7 * 4 * 6 * 3, index + 3647936);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 6 + 3, product* 8 * 6 * 7 * 8 * 4 * 6 * 3, index + 3648768);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 6 + 3, product* 2 * 9 * 7 * 9 * 4 * 6 * 3, index + 3649792);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 3, product* 6 * 3 * 3 * 2 * 6 * 6 * 3, index + 3662336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 3, product* 4 * 6 * 4 * 2 * 6 * 6 * 3, index + 3662464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6 + 3, product* 8 * 4 * 8 * 2 * 6 * 6 * 3, index + 3662848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 3, product* 2 * 3 * 2 * 3 * 6 * 6 * 3, index + 3663232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 6 + 3, product* 8 * 8 * 4 * 3 * 6 * 6 * 3, index + 3663488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 3, product* 4 * 4 * 7 * 3 * 6 * 6 * 3, index + 3663744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 6 + 3, product* 2 * 7 * 8 * 3 * 6 * 6 * 3, index + 3663872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 6 + 3, product* 4 * 8 * 3 * 4 * 6 * 6 * 3, index + 3664384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 3, product* 2 * 3 * 4 * 6 * 6 * 6 * 3, index + 3666432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 6 + 3, product* 4 * 4 * 9 * 6 * 6 * 6 * 3, index + 3666944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 3, product* 4 * 2 * 2 * 8 * 6 * 6 * 3, index + 3668224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 6 + 3, product* 8 * 4 * 2 * 9 * 6 * 6 * 3, index + 3669248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 6 + 3, product* 2 * 3 * 6 * 9 * 6 * 6 * 3, index + 3669632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 3, product* 8 * 4 * 4 * 2 * 7 * 6 * 3, index + 3672448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 3, product* 2 * 3 * 8 * 2 * 7 * 6 * 3, index + 3672832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 6 + 3, product* 4 * 4 * 3 * 3 * 7 * 6 * 3, index + 3673344);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 6 + 3, product* 8 * 2 * 7 * 3 * 7 * 6 * 3, index + 3673728);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 3, product* 4 * 2 * 6 * 4 * 7 * 6 * 3, index + 3674624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 6 + 3, product* 2 * 7 * 6 * 6 * 7 * 6 * 3, index + 3676672);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 6 + 3, product* 6 * 9 * 6 * 7 * 7 * 6 * 3, index + 3677696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 6 + 3, product* 4 * 2 * 8 * 7 * 7 * 6 * 3, index + 3677824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6 + 3, product* 6 * 3 * 3 * 8 * 7 * 6 * 3, index + 3678336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 6 + 3, product* 4 * 6 * 4 * 8 * 7 * 6 * 3, index + 3678464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 3, product* 2 * 3 * 2 * 9 * 7 * 6 * 3, index + 3679232);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7 + 6 + 3, product* 2 * 7 * 8 * 9 * 7 * 6 * 3, index + 3679872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 3, product* 2 * 3 * 4 * 2 * 8 * 6 * 3, index + 3682432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6 + 3, product* 8 * 2 * 3 * 3 * 8 * 6 * 3, index + 3683328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 3, product* 4 * 2 * 2 * 4 * 8 * 6 * 3, index + 3684224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 3, product* 2 * 7 * 2 * 6 * 8 * 6 * 3, index + 3686272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 6 + 3, product* 6 * 9 * 2 * 7 * 8 * 6 * 3, index + 3687296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 6 + 3, product* 4 * 2 * 4 * 7 * 8 * 6 * 3, index + 3687424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 6 + 3, product* 8 * 4 * 4 * 8 * 8 * 6 * 3, index + 3688448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 6 + 3, product* 2 * 7 * 4 * 9 * 8 * 6 * 3, index + 3689472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8 + 6 + 3, product* 4 * 8 * 9 * 9 * 8 * 6 * 3, index + 3689984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 6 + 3, product* 8 * 8 * 2 * 2 * 9 * 6 * 3, index + 3692288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 6 + 3, product* 4 * 2 * 8 * 3 * 9 * 6 * 3, index + 3693824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 6 + 3, product* 6 * 3 * 3 * 4 * 9 * 6 * 3, index + 3694336);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 6 + 3, product* 8 * 4 * 8 * 4 * 9 * 6 * 3, index + 3694848);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 6 + 3, product* 4 * 8 * 3 * 6 * 9 * 6 * 3, index + 3696384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 6 + 3, product* 2 * 3 * 4 * 8 * 9 * 6 * 3, index + 3698432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 6 + 3, product* 4 * 4 * 9 * 8 * 9 * 6 * 3, index + 3698944);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 3, product* 8 * 6 * 3 * 2 * 2 * 7 * 3, index + 3722368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 3, product* 6 * 9 * 4 * 2 * 2 * 7 * 3, index + 3722496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 3, product* 4 * 2 * 6 * 2 * 2 * 7 * 3, index + 3722624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 3, product* 4 * 6 * 2 * 3 * 2 * 7 * 3, index + 3723264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 3, product* 2 * 9 * 3 * 3 * 2 * 7 * 3, index + 3723392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 7 + 3, product* 8 * 4 * 6 * 3 * 2 * 7 * 3, index + 3723648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 7 + 3, product* 6 * 7 * 7 * 3 * 2 * 7 * 3, index + 3723776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 3, product* 8 * 8 * 2 * 4 * 2 * 7 * 3, index + 3724288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7 + 3, product* 2 * 7 * 6 * 4 * 2 * 7 * 3, index + 3724672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 7 + 3, product* 8 * 2 * 9 * 4 * 2 * 7 * 3, index + 3724928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7 + 3, product* 6 * 3 * 3 * 6 * 2 * 7 * 3, index + 3726336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 7 + 3, product* 8 * 4 * 8 * 6 * 2 * 7 * 3, index + 3726848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 7 + 3, product* 6 * 7 * 9 * 6 * 2 * 7 * 3, index + 3726976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 3, product* 2 * 3 * 2 * 7 * 2 * 7 * 3, index + 3727232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 7 + 3, product* 8 * 8 * 4 * 7 * 2 * 7 * 3, index + 3727488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 7 + 3, product* 4 * 4 * 7 * 7 * 2 * 7 * 3, index + 3727744);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 7 + 3, product* 4 * 8 * 3 * 8 * 2 * 7 * 3, index + 3728384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 7 + 3, product* 8 * 6 * 7 * 8 * 2 * 7 * 3, index + 3728768);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 7 + 3, product* 6 * 9 * 8 * 8 * 2 * 7 * 3, index + 3728896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 7 + 3, product* 4 * 6 * 6 * 9 * 2 * 7 * 3, index + 3729664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 3, product* 4 * 2 * 2 * 2 * 3 * 7 * 3, index + 3732224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 3, product* 6 * 3 * 7 * 2 * 3 * 7 * 3, index + 3732736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 3, product* 2 * 9 * 9 * 2 * 3 * 7 * 3, index + 3732992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 3, product* 8 * 4 * 2 * 3 * 3 * 7 * 3, index + 3733248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 3, product* 2 * 3 * 6 * 3 * 3 * 7 * 3, index + 3733632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 3, product* 2 * 7 * 2 * 4 * 3 * 7 * 3, index + 3734272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 7 + 3, product* 4 * 8 * 7 * 4 * 3 * 7 * 3, index + 3734784);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 7 + 3, product* 8 * 4 * 4 * 6 * 3 * 7 * 3, index + 3736448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7 + 3, product* 2 * 3 * 8 * 6 * 3 * 7 * 3, index + 3736832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 7 + 3, product* 4 * 4 * 3 * 7 * 3 * 7 * 3, index + 3737344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 3, product* 2 * 7 * 4 * 7 * 3 * 7 * 3, index + 3737472);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 7 + 3, product* 8 * 6 * 3 * 8 * 3 * 7 * 3, index + 3738368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 3, product* 4 * 2 * 6 * 8 * 3 * 7 * 3, index + 3738624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 7 + 3, product* 4 * 6 * 2 * 9 * 3 * 7 * 3, index + 3739264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 3, product* 6 * 3 * 3 * 2 * 4 * 7 * 3, index + 3742336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 3, product* 4 * 6 * 4 * 2 * 4 * 7 * 3, index + 3742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 3, product* 2 * 3 * 2 * 3 * 4 * 7 * 3, index + 3743232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 7 + 3, product* 8 * 8 * 4 * 3 * 4 * 7 * 3, index + 3743488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 7 + 3, product* 4 * 4 * 7 * 3 * 4 * 7 * 3, index + 3743744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 7 + 3, product* 2 * 7 * 8 * 3 * 4 * 7 * 3, index + 3743872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 7 + 3, product* 4 * 8 * 3 * 4 * 4 * 7 * 3, index + 3744384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 7 + 3, product* 2 * 3 * 4 * 6 * 4 * 7 * 3, index + 3746432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 7 + 3, product* 4 * 4 * 9 * 6 * 4 * 7 * 3, index + 3746944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 7 + 3, product* 8 * 2 * 3 * 7 * 4 * 7 * 3, index + 3747328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 3, product* 4 * 2 * 2 * 8 * 4 * 7 * 3, index + 3748224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 7 + 3, product* 6 * 3 * 7 * 8 * 4 * 7 * 3, index + 3748736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 7 + 3, product* 4 * 6 * 8 * 8 * 4 * 7 * 3, index + 3748864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 7 + 3, product* 2 * 9 * 9 * 8 * 4 * 7 * 3, index + 3748992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 7 + 3, product* 8 * 4 * 2 * 9 * 4 * 7 * 3, index + 3749248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4 + 7 + 3, product* 6 * 7 * 3 * 9 * 4 * 7 * 3, index + 3749376);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 3, product* 2 * 3 * 4 * 2 * 6 * 7 * 3, index + 3762432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 7 + 3, product* 8 * 8 * 6 * 2 * 6 * 7 * 3, index + 3762688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7 + 3, product* 4 * 4 * 9 * 2 * 6 * 7 * 3, index + 3762944);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 3, product* 2 * 9 * 3 * 3 * 6 * 7 * 3, index + 3763392);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 3, product* 4 * 2 * 2 * 4 * 6 * 7 * 3, index + 3764224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 7 + 3, product* 6 * 3 * 7 * 4 * 6 * 7 * 3, index + 3764736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 7 + 3, product* 2 * 7 * 2 * 6 * 6 * 7 * 3, index + 3766272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 7 + 3, product* 4 * 8 * 7 * 6 * 6 * 7 * 3, index + 3766784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 7 + 3, product* 6 * 9 * 2 * 7 * 6 * 7 * 3, index + 3767296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 7 + 3, product* 4 * 2 * 4 * 7 * 6 * 7 * 3, index + 3767424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 7 + 3, product* 8 * 4 * 4 * 8 * 6 * 7 * 3, index + 3768448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 7 + 3, product* 2 * 3 * 8 * 8 * 6 * 7 * 3, index + 3768832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 7 + 3, product* 4 * 4 * 3 * 9 * 6 * 7 * 3, index + 3769344);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 7 + 3, product* 8 * 8 * 2 * 2 * 7 * 7 * 3, index + 3772288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 7 + 3, product* 2 * 7 * 6 * 2 * 7 * 7 * 3, index + 3772672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 3, product* 6 * 3 * 7 * 2 * 7 * 7 * 3, index + 3772736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 7 + 3, product* 8 * 2 * 9 * 2 * 7 * 7 * 3, index + 3772928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 7 + 3, product* 4 * 2 * 8 * 3 * 7 * 7 * 3, index + 3773824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 7 + 3, product* 6 * 3 * 3 * 4 * 7 * 7 * 3, index + 3774336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 7 + 3, product* 4 * 6 * 4 * 4 * 7 * 7 * 3, index + 3774464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 7 + 3, product* 6 * 7 * 9 * 4 * 7 * 7 * 3, index + 3774976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 7 + 3, product* 4 * 8 * 3 * 6 * 7 * 7 * 3, index + 3776384);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7 + 3, product* 8 * 2 * 3 * 9 * 7 * 7 * 3, index + 3779328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 3, product* 2 * 7 * 2 * 2 * 8 * 7 * 3, index + 3782272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 7 + 3, product* 6 * 9 * 2 * 3 * 8 * 7 * 3, index + 3783296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7 + 3, product* 4 * 2 * 4 * 3 * 8 * 7 * 3, index + 3783424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 7 + 3, product* 6 * 3 * 9 * 3 * 8 * 7 * 3, index + 3783936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8 + 7 + 3, product* 6 * 9 * 4 * 6 * 8 * 7 * 3, index + 3786496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 7 + 3, product* 4 * 2 * 6 * 6 * 8 * 7 * 3, index + 3786624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 7 + 3, product* 4 * 6 * 2 * 7 * 8 * 7 * 3, index + 3787264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 7 + 3, product* 4 * 2 * 8 * 9 * 8 * 7 * 3, index + 3789824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 7 + 3, product* 4 * 8 * 3 * 2 * 9 * 7 * 3, index + 3792384);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 7 + 3, product* 2 * 9 * 9 * 2 * 9 * 7 * 3, index + 3792992);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 7 + 3, product* 4 * 6 * 6 * 3 * 9 * 7 * 3, index + 3793664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 7 + 3, product* 2 * 9 * 7 * 3 * 9 * 7 * 3, index + 3793792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 3, product* 2 * 3 * 4 * 4 * 9 * 7 * 3, index + 3794432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9 + 7 + 3, product* 4 * 4 * 9 * 4 * 9 * 7 * 3, index + 3794944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7 + 3, product* 4 * 2 * 2 * 6 * 9 * 7 * 3, index + 3796224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9 + 7 + 3, product* 6 * 3 * 7 * 6 * 9 * 7 * 3, index + 3796736);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 7 + 3, product* 2 * 3 * 6 * 7 * 9 * 7 * 3, index + 3797632);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 3, product* 6 * 3 * 3 * 2 * 2 * 8 * 3, index + 3822336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 3, product* 4 * 6 * 4 * 2 * 2 * 8 * 3, index + 3822464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 3, product* 2 * 3 * 2 * 3 * 2 * 8 * 3, index + 3823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 3, product* 4 * 4 * 7 * 3 * 2 * 8 * 3, index + 3823744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 3, product* 2 * 7 * 8 * 3 * 2 * 8 * 3, index + 3823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 3, product* 4 * 8 * 3 * 4 * 2 * 8 * 3, index + 3824384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8 + 3, product* 6 * 9 * 8 * 4 * 2 * 8 * 3, index + 3824896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 3, product* 2 * 3 * 4 * 6 * 2 * 8 * 3, index + 3826432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 8 + 3, product* 4 * 4 * 9 * 6 * 2 * 8 * 3, index + 3826944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8 + 3, product* 8 * 2 * 3 * 7 * 2 * 8 * 3, index + 3827328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 8 + 3, product* 8 * 6 * 9 * 7 * 2 * 8 * 3, index + 3827968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 3, product* 4 * 2 * 2 * 8 * 2 * 8 * 3, index + 3828224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 8 + 3, product* 6 * 3 * 7 * 8 * 2 * 8 * 3, index + 3828736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 3, product* 8 * 4 * 2 * 9 * 2 * 8 * 3, index + 3829248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 8 + 3, product* 6 * 7 * 3 * 9 * 2 * 8 * 3, index + 3829376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8 + 3, product* 2 * 3 * 6 * 9 * 2 * 8 * 3, index + 3829632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 8 + 3, product* 8 * 4 * 4 * 2 * 3 * 8 * 3, index + 3832448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 3, product* 2 * 3 * 8 * 2 * 3 * 8 * 3, index + 3832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 3, product* 4 * 4 * 3 * 3 * 3 * 8 * 3, index + 3833344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 3, product* 2 * 7 * 4 * 3 * 3 * 8 * 3, index + 3833472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 3, product* 8 * 2 * 7 * 3 * 3 * 8 * 3, index + 3833728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 8 + 3, product* 4 * 8 * 9 * 3 * 3 * 8 * 3, index + 3833984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 8 + 3, product* 8 * 6 * 3 * 4 * 3 * 8 * 3, index + 3834368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 3, product* 4 * 2 * 6 * 4 * 3 * 8 * 3, index + 3834624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 8 + 3, product* 2 * 7 * 6 * 6 * 3 * 8 * 3, index + 3836672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 8 + 3, product* 8 * 2 * 9 * 6 * 3 * 8 * 3, index + 3836928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 3, product* 4 * 2 * 8 * 7 * 3 * 8 * 3, index + 3837824);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 8 + 3, product* 4 * 6 * 4 * 8 * 3 * 8 * 3, index + 3838464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 3, product* 2 * 3 * 2 * 9 * 3 * 8 * 3, index + 3839232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 8 + 3, product* 4 * 4 * 7 * 9 * 3 * 8 * 3, index + 3839744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 8 + 3, product* 2 * 7 * 8 * 9 * 3 * 8 * 3, index + 3839872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 3, product* 2 * 3 * 4 * 2 * 4 * 8 * 3, index + 3842432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 8 + 3, product* 8 * 8 * 6 * 2 * 4 * 8 * 3, index + 3842688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 3, product* 4 * 4 * 9 * 2 * 4 * 8 * 3, index + 3842944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 8 + 3, product* 8 * 2 * 3 * 3 * 4 * 8 * 3, index + 3843328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 8 + 3, product* 8 * 6 * 9 * 3 * 4 * 8 * 3, index + 3843968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 3, product* 4 * 2 * 2 * 4 * 4 * 8 * 3, index + 3844224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 3, product* 2 * 7 * 2 * 6 * 4 * 8 * 3, index + 3846272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 8 + 3, product* 4 * 8 * 7 * 6 * 4 * 8 * 3, index + 3846784);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 8 + 3, product* 4 * 2 * 4 * 7 * 4 * 8 * 3, index + 3847424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 8 + 3, product* 2 * 7 * 4 * 9 * 4 * 8 * 3, index + 3849472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 8 + 3, product* 4 * 8 * 9 * 9 * 4 * 8 * 3, index + 3849984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 3, product* 2 * 7 * 2 * 2 * 6 * 8 * 3, index + 3862272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 8 + 3, product* 4 * 8 * 7 * 2 * 6 * 8 * 3, index + 3862784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 8 + 3, product* 6 * 9 * 2 * 3 * 6 * 8 * 3, index + 3863296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 3, product* 4 * 2 * 4 * 3 * 6 * 8 * 3, index + 3863424);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8 + 3, product* 2 * 3 * 8 * 4 * 6 * 8 * 3, index + 3864832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 8 + 3, product* 6 * 9 * 4 * 6 * 6 * 8 * 3, index + 3866496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 8 + 3, product* 4 * 2 * 6 * 6 * 6 * 8 * 3, index + 3866624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 8 + 3, product* 4 * 6 * 2 * 7 * 6 * 8 * 3, index + 3867264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 8 + 3, product* 2 * 9 * 3 * 7 * 6 * 8 * 3, index + 3867392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 8 + 3, product* 8 * 4 * 6 * 7 * 6 * 8 * 3, index + 3867648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 8 + 3, product* 2 * 7 * 6 * 8 * 6 * 8 * 3, index + 3868672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 8 + 3, product* 8 * 2 * 9 * 8 * 6 * 8 * 3, index + 3868928);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 8 + 3, product* 4 * 8 * 3 * 2 * 7 * 8 * 3, index + 3872384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 8 + 3, product* 8 * 6 * 7 * 2 * 7 * 8 * 3, index + 3872768);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 8 + 3, product* 2 * 3 * 4 * 4 * 7 * 8 * 3, index + 3874432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 3, product* 4 * 2 * 2 * 6 * 7 * 8 * 3, index + 3876224);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 8 + 3, product* 4 * 6 * 8 * 6 * 7 * 8 * 3, index + 3876864);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 8 + 3, product* 8 * 4 * 2 * 7 * 7 * 8 * 3, index + 3877248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 8 + 3, product* 6 * 7 * 3 * 7 * 7 * 8 * 3, index + 3877376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 8 + 3, product* 2 * 3 * 6 * 7 * 7 * 8 * 3, index + 3877632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 8 + 3, product* 2 * 7 * 2 * 8 * 7 * 8 * 3, index + 3878272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 8 + 3, product* 4 * 2 * 4 * 9 * 7 * 8 * 3, index + 3879424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 8 + 3, product* 6 * 3 * 9 * 9 * 7 * 8 * 3, index + 3879936);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 8 + 3, product* 6 * 9 * 4 * 2 * 8 * 8 * 3, index + 3882496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 8 + 3, product* 4 * 2 * 6 * 2 * 8 * 8 * 3, index + 3882624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 3, product* 4 * 6 * 2 * 3 * 8 * 8 * 3, index + 3883264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 8 + 3, product* 2 * 9 * 3 * 3 * 8 * 8 * 3, index + 3883392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 8 + 3, product* 6 * 7 * 7 * 3 * 8 * 8 * 3, index + 3883776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 8 + 3, product* 8 * 8 * 2 * 4 * 8 * 8 * 3, index + 3884288);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 8 + 3, product* 4 * 6 * 4 * 6 * 8 * 8 * 3, index + 3886464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 8 + 3, product* 8 * 4 * 8 * 6 * 8 * 8 * 3, index + 3886848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 3, product* 2 * 3 * 2 * 7 * 8 * 8 * 3, index + 3887232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 3, product* 4 * 2 * 2 * 2 * 9 * 8 * 3, index + 3892224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 8 + 3, product* 6 * 3 * 7 * 2 * 9 * 8 * 3, index + 3892736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 8 + 3, product* 2 * 9 * 9 * 2 * 9 * 8 * 3, index + 3892992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 8 + 3, product* 8 * 4 * 2 * 3 * 9 * 8 * 3, index + 3893248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 8 + 3, product* 6 * 7 * 3 * 3 * 9 * 8 * 3, index + 3893376);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 8 + 3, product* 2 * 7 * 2 * 4 * 9 * 8 * 3, index + 3894272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 8 + 3, product* 2 * 3 * 8 * 6 * 9 * 8 * 3, index + 3896832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 8 + 3, product* 4 * 4 * 3 * 7 * 9 * 8 * 3, index + 3897344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 8 + 3, product* 4 * 2 * 6 * 8 * 9 * 8 * 3, index + 3898624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 8 + 3, product* 2 * 9 * 3 * 9 * 9 * 8 * 3, index + 3899392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 3, product* 2 * 3 * 4 * 2 * 2 * 9 * 3, index + 3922432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 3, product* 4 * 4 * 9 * 2 * 2 * 9 * 3, index + 3922944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 3, product* 8 * 2 * 3 * 3 * 2 * 9 * 3, index + 3923328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 3, product* 4 * 2 * 2 * 4 * 2 * 9 * 3, index + 3924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 3, product* 6 * 3 * 7 * 4 * 2 * 9 * 3, index + 3924736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 9 + 3, product* 4 * 6 * 8 * 4 * 2 * 9 * 3, index + 3924864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 9 + 3, product* 2 * 9 * 9 * 4 * 2 * 9 * 3, index + 3924992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 3, product* 2 * 7 * 2 * 6 * 2 * 9 * 3, index + 3926272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9 + 3, product* 6 * 9 * 2 * 7 * 2 * 9 * 3, index + 3927296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 3, product* 4 * 2 * 4 * 7 * 2 * 9 * 3, index + 3927424);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 9 + 3, product* 2 * 3 * 8 * 8 * 2 * 9 * 3, index + 3928832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 9 + 3, product* 4 * 4 * 3 * 9 * 2 * 9 * 3, index + 3929344);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 9 + 3, product* 8 * 2 * 7 * 9 * 2 * 9 * 3, index + 3929728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 9 + 3, product* 8 * 8 * 2 * 2 * 3 * 9 * 3, index + 3932288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 3, product* 2 * 7 * 6 * 2 * 3 * 9 * 3, index + 3932672);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 3, product* 4 * 2 * 8 * 3 * 3 * 9 * 3, index + 3933824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 3, product* 6 * 3 * 3 * 4 * 3 * 9 * 3, index + 3934336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 9 + 3, product* 4 * 6 * 4 * 4 * 3 * 9 * 3, index + 3934464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 9 + 3, product* 6 * 7 * 9 * 4 * 3 * 9 * 3, index + 3934976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 9 + 3, product* 4 * 8 * 3 * 6 * 3 * 9 * 3, index + 3936384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 9 + 3, product* 4 * 6 * 6 * 7 * 3 * 9 * 3, index + 3937664);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 9 + 3, product* 2 * 9 * 7 * 7 * 3 * 9 * 3, index + 3937792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 3, product* 2 * 3 * 4 * 8 * 3 * 9 * 3, index + 3938432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 9 + 3, product* 8 * 2 * 3 * 9 * 3 * 9 * 3, index + 3939328);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3 + 9 + 3, product* 8 * 6 * 9 * 9 * 3 * 9 * 3, index + 3939968);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 3, product* 2 * 7 * 2 * 2 * 4 * 9 * 3, index + 3942272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 9 + 3, product* 6 * 9 * 2 * 3 * 4 * 9 * 3, index + 3943296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9 + 3, product* 4 * 2 * 4 * 3 * 4 * 9 * 3, index + 3943424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 9 + 3, product* 8 * 4 * 4 * 4 * 4 * 9 * 3, index + 3944448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 3, product* 2 * 3 * 8 * 4 * 4 * 9 * 3, index + 3944832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 9 + 3, product* 8 * 6 * 3 * 6 * 4 * 9 * 3, index + 3946368);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 9 + 3, product* 4 * 6 * 2 * 7 * 4 * 9 * 3, index + 3947264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 9 + 3, product* 8 * 8 * 2 * 8 * 4 * 9 * 3, index + 3948288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 9 + 3, product* 2 * 7 * 6 * 8 * 4 * 9 * 3, index + 3948672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 9 + 3, product* 4 * 2 * 8 * 9 * 4 * 9 * 3, index + 3949824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 9 + 3, product* 8 * 6 * 3 * 2 * 6 * 9 * 3, index + 3962368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 3, product* 4 * 2 * 6 * 2 * 6 * 9 * 3, index + 3962624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 9 + 3, product* 4 * 6 * 2 * 3 * 6 * 9 * 3, index + 3963264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 9 + 3, product* 2 * 9 * 3 * 3 * 6 * 9 * 3, index + 3963392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 9 + 3, product* 2 * 7 * 6 * 4 * 6 * 9 * 3, index + 3964672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 9 + 3, product* 8 * 2 * 9 * 4 * 6 * 9 * 3, index + 3964928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 9 + 3, product* 4 * 6 * 4 * 6 * 6 * 9 * 3, index + 3966464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 3, product* 2 * 3 * 2 * 7 * 6 * 9 * 3, index + 3967232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 9 + 3, product* 4 * 8 * 3 * 8 * 6 * 9 * 3, index + 3968384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 3, product* 4 * 2 * 2 * 2 * 7 * 9 * 3, index + 3972224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 9 + 3, product* 6 * 3 * 7 * 2 * 7 * 9 * 3, index + 3972736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 9 + 3, product* 8 * 4 * 2 * 3 * 7 * 9 * 3, index + 3973248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9 + 3, product* 2 * 3 * 6 * 3 * 7 * 9 * 3, index + 3973632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 3, product* 2 * 7 * 2 * 4 * 7 * 9 * 3, index + 3974272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 9 + 3, product* 4 * 8 * 7 * 4 * 7 * 9 * 3, index + 3974784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 9 + 3, product* 2 * 3 * 8 * 6 * 7 * 9 * 3, index + 3976832);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 9 + 3, product* 8 * 2 * 7 * 7 * 7 * 9 * 3, index + 3977728);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 9 + 3, product* 6 * 9 * 4 * 8 * 7 * 9 * 3, index + 3978496);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 9 + 3, product* 6 * 3 * 3 * 2 * 8 * 9 * 3, index + 3982336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 9 + 3, product* 4 * 6 * 4 * 2 * 8 * 9 * 3, index + 3982464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 9 + 3, product* 8 * 4 * 8 * 2 * 8 * 9 * 3, index + 3982848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 3, product* 2 * 3 * 2 * 3 * 8 * 9 * 3, index + 3983232);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 9 + 3, product* 4 * 8 * 3 * 4 * 8 * 9 * 3, index + 3984384);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 9 + 3, product* 4 * 4 * 9 * 6 * 8 * 9 * 3, index + 3986944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 9 + 3, product* 4 * 2 * 2 * 8 * 8 * 9 * 3, index + 3988224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 9 + 3, product* 8 * 4 * 2 * 9 * 8 * 9 * 3, index + 3989248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9 + 3, product* 2 * 3 * 8 * 2 * 9 * 9 * 3, index + 3992832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 9 + 3, product* 4 * 4 * 3 * 3 * 9 * 9 * 3, index + 3993344);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 9 + 3, product* 8 * 2 * 7 * 3 * 9 * 9 * 3, index + 3993728);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 9 + 3, product* 4 * 2 * 6 * 4 * 9 * 9 * 3, index + 3994624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 9 + 3, product* 2 * 3 * 2 * 9 * 9 * 9 * 3, index + 3999232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 4, product* 6 * 3 * 3 * 2 * 2 * 2 * 4, index + 4222336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 4, product* 4 * 6 * 4 * 2 * 2 * 2 * 4, index + 4222464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 4, product* 8 * 4 * 8 * 2 * 2 * 2 * 4, index + 4222848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 4, product* 6 * 7 * 9 * 2 * 2 * 2 * 4, index + 4222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 4, product* 2 * 3 * 2 * 3 * 2 * 2 * 4, index + 4223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 4, product* 8 * 8 * 4 * 3 * 2 * 2 * 4, index + 4223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 4, product* 4 * 4 * 7 * 3 * 2 * 2 * 4, index + 4223744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 4, product* 2 * 7 * 8 * 3 * 2 * 2 * 4, index + 4223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 4, product* 4 * 8 * 3 * 4 * 2 * 2 * 4, index + 4224384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 4, product* 8 * 6 * 7 * 4 * 2 * 2 * 4, index + 4224768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 4, product* 6 * 9 * 8 * 4 * 2 * 2 * 4, index + 4224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 4, product* 2 * 3 * 4 * 6 * 2 * 2 * 4, index + 4226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 4, product* 4 * 4 * 9 * 6 * 2 * 2 * 4, index + 4226944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 4, product* 8 * 2 * 3 * 7 * 2 * 2 * 4, index + 4227328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 2 + 4, product* 8 * 6 * 9 * 7 * 2 * 2 * 4, index + 4227968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 4, product* 4 * 2 * 2 * 8 * 2 * 2 * 4, index + 4228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 4, product* 6 * 3 * 7 * 8 * 2 * 2 * 4, index + 4228736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 4, product* 4 * 6 * 8 * 8 * 2 * 2 * 4, index + 4228864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 4, product* 8 * 4 * 2 * 9 * 2 * 2 * 4, index + 4229248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 4, product* 6 * 7 * 3 * 9 * 2 * 2 * 4, index + 4229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 4, product* 2 * 3 * 6 * 9 * 2 * 2 * 4, index + 4229632);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 2 + 2 + 4, product* 8 * 8 * 8 * 9 * 2 * 2 * 4, index + 4229888);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 4, product* 8 * 4 * 4 * 2 * 3 * 2 * 4, index + 4232448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 4, product* 2 * 3 * 8 * 2 * 3 * 2 * 4, index + 4232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 4, product* 4 * 4 * 3 * 3 * 3 * 2 * 4, index + 4233344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 4, product* 2 * 7 * 4 * 3 * 3 * 2 * 4, index + 4233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 4, product* 8 * 2 * 7 * 3 * 3 * 2 * 4, index + 4233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 4, product* 4 * 8 * 9 * 3 * 3 * 2 * 4, index + 4233984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 4, product* 6 * 9 * 4 * 4 * 3 * 2 * 4, index + 4234496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 4, product* 4 * 2 * 6 * 4 * 3 * 2 * 4, index + 4234624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 4, product* 8 * 8 * 2 * 6 * 3 * 2 * 4, index + 4236288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 4, product* 2 * 7 * 6 * 6 * 3 * 2 * 4, index + 4236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 4, product* 8 * 2 * 9 * 6 * 3 * 2 * 4, index + 4236928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 4, product* 6 * 9 * 6 * 7 * 3 * 2 * 4, index + 4237696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 4, product* 4 * 2 * 8 * 7 * 3 * 2 * 4, index + 4237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 4, product* 6 * 3 * 3 * 8 * 3 * 2 * 4, index + 4238336);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2 + 4, product* 6 * 7 * 9 * 8 * 3 * 2 * 4, index + 4238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 4, product* 2 * 3 * 2 * 9 * 3 * 2 * 4, index + 4239232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2 + 4, product* 4 * 4 * 7 * 9 * 3 * 2 * 4, index + 4239744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 4, product* 2 * 7 * 8 * 9 * 3 * 2 * 4, index + 4239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 4, product* 2 * 3 * 4 * 2 * 4 * 2 * 4, index + 4242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 4, product* 8 * 8 * 6 * 2 * 4 * 2 * 4, index + 4242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 4, product* 4 * 4 * 9 * 2 * 4 * 2 * 4, index + 4242944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 4, product* 8 * 2 * 3 * 3 * 4 * 2 * 4, index + 4243328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 2 + 4, product* 8 * 6 * 9 * 3 * 4 * 2 * 4, index + 4243968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 4, product* 4 * 2 * 2 * 4 * 4 * 2 * 4, index + 4244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 4, product* 6 * 3 * 7 * 4 * 4 * 2 * 4, index + 4244736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 4, product* 2 * 7 * 2 * 6 * 4 * 2 * 4, index + 4246272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 4, product* 6 * 9 * 2 * 7 * 4 * 2 * 4, index + 4247296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 4, product* 4 * 2 * 4 * 7 * 4 * 2 * 4, index + 4247424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 2 + 4, product* 8 * 4 * 4 * 8 * 4 * 2 * 4, index + 4248448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 4, product* 2 * 3 * 8 * 8 * 4 * 2 * 4, index + 4248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 4, product* 4 * 4 * 3 * 9 * 4 * 2 * 4, index + 4249344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 4, product* 2 * 7 * 4 * 9 * 4 * 2 * 4, index + 4249472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 4, product* 2 * 7 * 2 * 2 * 6 * 2 * 4, index + 4262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 4, product* 4 * 8 * 7 * 2 * 6 * 2 * 4, index + 4262784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 4, product* 6 * 9 * 2 * 3 * 6 * 2 * 4, index + 4263296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 4, product* 4 * 2 * 4 * 3 * 6 * 2 * 4, index + 4263424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2 + 4, product* 6 * 3 * 9 * 3 * 6 * 2 * 4, index + 4263936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 4, product* 8 * 4 * 4 * 4 * 6 * 2 * 4, index + 4264448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 4, product* 2 * 3 * 8 * 4 * 6 * 2 * 4, index + 4264832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 2 + 4, product* 6 * 9 * 4 * 6 * 6 * 2 * 4, index + 4266496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 4, product* 4 * 2 * 6 * 6 * 6 * 2 * 4, index + 4266624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 4, product* 4 * 6 * 2 * 7 * 6 * 2 * 4, index + 4267264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 4, product* 2 * 9 * 3 * 7 * 6 * 2 * 4, index + 4267392);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 2 + 4, product* 8 * 8 * 2 * 8 * 6 * 2 * 4, index + 4268288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 4, product* 2 * 7 * 6 * 8 * 6 * 2 * 4, index + 4268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 4, product* 8 * 2 * 9 * 8 * 6 * 2 * 4, index + 4268928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 4, product* 4 * 2 * 8 * 9 * 6 * 2 * 4, index + 4269824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 4, product* 4 * 8 * 3 * 2 * 7 * 2 * 4, index + 4272384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 4, product* 8 * 6 * 7 * 2 * 7 * 2 * 4, index + 4272768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 4, product* 6 * 9 * 8 * 2 * 7 * 2 * 4, index + 4272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 4, product* 4 * 6 * 6 * 3 * 7 * 2 * 4, index + 4273664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 4, product* 2 * 9 * 7 * 3 * 7 * 2 * 4, index + 4273792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 4, product* 2 * 3 * 4 * 4 * 7 * 2 * 4, index + 4274432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 2 + 4, product* 8 * 8 * 6 * 4 * 7 * 2 * 4, index + 4274688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 4, product* 4 * 4 * 9 * 4 * 7 * 2 * 4, index + 4274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 4, product* 4 * 2 * 2 * 6 * 7 * 2 * 4, index + 4276224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 2 + 4, product* 6 * 3 * 7 * 6 * 7 * 2 * 4, index + 4276736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 4, product* 8 * 4 * 2 * 7 * 7 * 2 * 4, index + 4277248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 4, product* 2 * 3 * 6 * 7 * 7 * 2 * 4, index + 4277632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 4, product* 2 * 7 * 2 * 8 * 7 * 2 * 4, index + 4278272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 2 + 4, product* 6 * 9 * 2 * 9 * 7 * 2 * 4, index + 4279296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 4, product* 4 * 2 * 4 * 9 * 7 * 2 * 4, index + 4279424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 4, product* 8 * 6 * 3 * 2 * 8 * 2 * 4, index + 4282368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2 + 4, product* 6 * 9 * 4 * 2 * 8 * 2 * 4, index + 4282496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 4, product* 4 * 2 * 6 * 2 * 8 * 2 * 4, index + 4282624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 4, product* 4 * 6 * 2 * 3 * 8 * 2 * 4, index + 4283264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 4, product* 2 * 9 * 3 * 3 * 8 * 2 * 4, index + 4283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 4, product* 8 * 4 * 6 * 3 * 8 * 2 * 4, index + 4283648);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 4, product* 8 * 8 * 2 * 4 * 8 * 2 * 4, index + 4284288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 4, product* 2 * 7 * 6 * 4 * 8 * 2 * 4, index + 4284672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 4, product* 8 * 2 * 9 * 4 * 8 * 2 * 4, index + 4284928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 4, product* 4 * 6 * 4 * 6 * 8 * 2 * 4, index + 4286464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 4, product* 2 * 3 * 2 * 7 * 8 * 2 * 4, index + 4287232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 8 + 2 + 4, product* 8 * 8 * 4 * 7 * 8 * 2 * 4, index + 4287488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 2 + 4, product* 4 * 4 * 7 * 7 * 8 * 2 * 4, index + 4287744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8 + 2 + 4, product* 8 * 6 * 7 * 8 * 8 * 2 * 4, index + 4288768);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 4, product* 4 * 6 * 6 * 9 * 8 * 2 * 4, index + 4289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 4, product* 4 * 2 * 2 * 2 * 9 * 2 * 4, index + 4292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 4, product* 6 * 3 * 7 * 2 * 9 * 2 * 4, index + 4292736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 4, product* 4 * 6 * 8 * 2 * 9 * 2 * 4, index + 4292864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 4, product* 2 * 9 * 9 * 2 * 9 * 2 * 4, index + 4292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 4, product* 8 * 4 * 2 * 3 * 9 * 2 * 4, index + 4293248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 4, product* 6 * 7 * 3 * 3 * 9 * 2 * 4, index + 4293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 4, product* 2 * 3 * 6 * 3 * 9 * 2 * 4, index + 4293632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2 + 4, product* 8 * 8 * 8 * 3 * 9 * 2 * 4, index + 4293888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 4, product* 2 * 7 * 2 * 4 * 9 * 2 * 4, index + 4294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 4, product* 4 * 8 * 7 * 4 * 9 * 2 * 4, index + 4294784);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9 + 2 + 4, product* 8 * 4 * 4 * 6 * 9 * 2 * 4, index + 4296448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 4, product* 2 * 3 * 8 * 6 * 9 * 2 * 4, index + 4296832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 4, product* 4 * 4 * 3 * 7 * 9 * 2 * 4, index + 4297344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 4, product* 2 * 7 * 4 * 7 * 9 * 2 * 4, index + 4297472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 2 + 4, product* 8 * 2 * 7 * 7 * 9 * 2 * 4, index + 4297728);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2 + 4, product* 8 * 6 * 3 * 8 * 9 * 2 * 4, index + 4298368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 4, product* 2 * 9 * 3 * 9 * 9 * 2 * 4, index + 4299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 4, product* 2 * 3 * 4 * 2 * 2 * 3 * 4, index + 4322432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3 + 4, product* 8 * 8 * 6 * 2 * 2 * 3 * 4, index + 4322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 4, product* 4 * 4 * 9 * 2 * 2 * 3 * 4, index + 4322944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 4, product* 8 * 2 * 3 * 3 * 2 * 3 * 4, index + 4323328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 4, product* 4 * 2 * 2 * 4 * 2 * 3 * 4, index + 4324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 4, product* 6 * 3 * 7 * 4 * 2 * 3 * 4, index + 4324736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 4, product* 4 * 6 * 8 * 4 * 2 * 3 * 4, index + 4324864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 4, product* 2 * 9 * 9 * 4 * 2 * 3 * 4, index + 4324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 4, product* 2 * 7 * 2 * 6 * 2 * 3 * 4, index + 4326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 4, product* 4 * 8 * 7 * 6 * 2 * 3 * 4, index + 4326784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 4, product* 6 * 9 * 2 * 7 * 2 * 3 * 4, index + 4327296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 4, product* 4 * 2 * 4 * 7 * 2 * 3 * 4, index + 4327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 4, product* 6 * 3 * 9 * 7 * 2 * 3 * 4, index + 4327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 4, product* 8 * 4 * 4 * 8 * 2 * 3 * 4, index + 4328448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 4, product* 2 * 3 * 8 * 8 * 2 * 3 * 4, index + 4328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 4, product* 4 * 4 * 3 * 9 * 2 * 3 * 4, index + 4329344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 4, product* 2 * 7 * 4 * 9 * 2 * 3 * 4, index + 4329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 4, product* 8 * 2 * 7 * 9 * 2 * 3 * 4, index + 4329728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 4, product* 2 * 9 * 7 * 9 * 2 * 3 * 4, index + 4329792);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 4, product* 8 * 8 * 2 * 2 * 3 * 3 * 4, index + 4332288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 4, product* 2 * 7 * 6 * 2 * 3 * 3 * 4, index + 4332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 4, product* 8 * 2 * 9 * 2 * 3 * 3 * 4, index + 4332928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 3 + 4, product* 6 * 9 * 6 * 3 * 3 * 3 * 4, index + 4333696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 4, product* 4 * 2 * 8 * 3 * 3 * 3 * 4, index + 4333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 4, product* 6 * 3 * 3 * 4 * 3 * 3 * 4, index + 4334336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 4, product* 4 * 6 * 4 * 4 * 3 * 3 * 4, index + 4334464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 4, product* 4 * 8 * 3 * 6 * 3 * 3 * 4, index + 4336384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3 + 4, product* 4 * 6 * 6 * 7 * 3 * 3 * 4, index + 4337664);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 4, product* 2 * 9 * 7 * 7 * 3 * 3 * 4, index + 4337792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 4, product* 2 * 3 * 4 * 8 * 3 * 3 * 4, index + 4338432);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 3 + 4, product* 8 * 8 * 6 * 8 * 3 * 3 * 4, index + 4338688);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 3 + 4, product* 4 * 4 * 9 * 8 * 3 * 3 * 4, index + 4338944);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 4, product* 8 * 2 * 3 * 9 * 3 * 3 * 4, index + 4339328);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3 + 3 + 4, product* 8 * 6 * 9 * 9 * 3 * 3 * 4, index + 4339968);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 4, product* 2 * 7 * 2 * 2 * 4 * 3 * 4, index + 4342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 4, product* 4 * 8 * 7 * 2 * 4 * 3 * 4, index + 4342784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 4, product* 6 * 9 * 2 * 3 * 4 * 3 * 4, index + 4343296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 4, product* 4 * 2 * 4 * 3 * 4 * 3 * 4, index + 4343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 4, product* 6 * 3 * 9 * 3 * 4 * 3 * 4, index + 4343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 4, product* 8 * 4 * 4 * 4 * 4 * 3 * 4, index + 4344448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 4, product* 2 * 3 * 8 * 4 * 4 * 3 * 4, index + 4344832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 4, product* 8 * 6 * 3 * 6 * 4 * 3 * 4, index + 4346368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3 + 4, product* 6 * 9 * 4 * 6 * 4 * 3 * 4, index + 4346496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 4, product* 4 * 2 * 6 * 6 * 4 * 3 * 4, index + 4346624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 4, product* 4 * 6 * 2 * 7 * 4 * 3 * 4, index + 4347264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 4, product* 2 * 9 * 3 * 7 * 4 * 3 * 4, index + 4347392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 3 + 4, product* 8 * 4 * 6 * 7 * 4 * 3 * 4, index + 4347648);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 3 + 4, product* 8 * 8 * 2 * 8 * 4 * 3 * 4, index + 4348288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 3 + 4, product* 2 * 7 * 6 * 8 * 4 * 3 * 4, index + 4348672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 4, product* 8 * 2 * 9 * 8 * 4 * 3 * 4, index + 4348928);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 4, product* 6 * 9 * 4 * 2 * 6 * 3 * 4, index + 4362496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 4, product* 4 * 2 * 6 * 2 * 6 * 3 * 4, index + 4362624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 4, product* 4 * 6 * 2 * 3 * 6 * 3 * 4, index + 4363264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 4, product* 2 * 9 * 3 * 3 * 6 * 3 * 4, index + 4363392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3 + 4, product* 8 * 4 * 6 * 3 * 6 * 3 * 4, index + 4363648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 3 + 4, product* 6 * 7 * 7 * 3 * 6 * 3 * 4, index + 4363776);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 4, product* 2 * 7 * 6 * 4 * 6 * 3 * 4, index + 4364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 4, product* 8 * 2 * 9 * 4 * 6 * 3 * 4, index + 4364928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 4, product* 6 * 3 * 3 * 6 * 6 * 3 * 4, index + 4366336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 4, product* 4 * 6 * 4 * 6 * 6 * 3 * 4, index + 4366464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 4, product* 2 * 3 * 2 * 7 * 6 * 3 * 4, index + 4367232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3 + 4, product* 8 * 8 * 4 * 7 * 6 * 3 * 4, index + 4367488);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6 + 3 + 4, product* 2 * 7 * 8 * 7 * 6 * 3 * 4, index + 4367872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3 + 4, product* 4 * 8 * 3 * 8 * 6 * 3 * 4, index + 4368384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 6 + 3 + 4, product* 6 * 9 * 8 * 8 * 6 * 3 * 4, index + 4368896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6 + 3 + 4, product* 4 * 6 * 6 * 9 * 6 * 3 * 4, index + 4369664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 4, product* 4 * 2 * 2 * 2 * 7 * 3 * 4, index + 4372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 4, product* 6 * 3 * 7 * 2 * 7 * 3 * 4, index + 4372736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 4, product* 4 * 6 * 8 * 2 * 7 * 3 * 4, index + 4372864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 4, product* 2 * 9 * 9 * 2 * 7 * 3 * 4, index + 4372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 4, product* 8 * 4 * 2 * 3 * 7 * 3 * 4, index + 4373248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 4, product* 6 * 7 * 3 * 3 * 7 * 3 * 4, index + 4373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 4, product* 2 * 3 * 6 * 3 * 7 * 3 * 4, index + 4373632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 4, product* 2 * 7 * 2 * 4 * 7 * 3 * 4, index + 4374272);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 4, product* 8 * 4 * 4 * 6 * 7 * 3 * 4, index + 4376448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3 + 4, product* 2 * 3 * 8 * 6 * 7 * 3 * 4, index + 4376832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 4, product* 4 * 4 * 3 * 7 * 7 * 3 * 4, index + 4377344);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 4, product* 8 * 2 * 7 * 7 * 7 * 3 * 4, index + 4377728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 3 + 4, product* 4 * 8 * 9 * 7 * 7 * 3 * 4, index + 4377984);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 3 + 4, product* 8 * 6 * 3 * 8 * 7 * 3 * 4, index + 4378368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3 + 4, product* 4 * 2 * 6 * 8 * 7 * 3 * 4, index + 4378624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 4, product* 4 * 6 * 2 * 9 * 7 * 3 * 4, index + 4379264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 4, product* 2 * 9 * 3 * 9 * 7 * 3 * 4, index + 4379392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 4, product* 6 * 3 * 3 * 2 * 8 * 3 * 4, index + 4382336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 4, product* 4 * 6 * 4 * 2 * 8 * 3 * 4, index + 4382464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 8 + 3 + 4, product* 6 * 7 * 9 * 2 * 8 * 3 * 4, index + 4382976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 4, product* 2 * 3 * 2 * 3 * 8 * 3 * 4, index + 4383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 4, product* 8 * 8 * 4 * 3 * 8 * 3 * 4, index + 4383488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 3 + 4, product* 4 * 4 * 7 * 3 * 8 * 3 * 4, index + 4383744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 4, product* 2 * 7 * 8 * 3 * 8 * 3 * 4, index + 4383872);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 8 + 3 + 4, product* 8 * 6 * 7 * 4 * 8 * 3 * 4, index + 4384768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 4, product* 2 * 3 * 4 * 6 * 8 * 3 * 4, index + 4386432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 4, product* 8 * 2 * 3 * 7 * 8 * 3 * 4, index + 4387328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 4, product* 4 * 2 * 2 * 8 * 8 * 3 * 4, index + 4388224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 8 + 3 + 4, product* 6 * 3 * 7 * 8 * 8 * 3 * 4, index + 4388736);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3 + 4, product* 2 * 3 * 6 * 9 * 8 * 3 * 4, index + 4389632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 4, product* 8 * 4 * 4 * 2 * 9 * 3 * 4, index + 4392448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 4, product* 2 * 3 * 8 * 2 * 9 * 3 * 4, index + 4392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 4, product* 4 * 4 * 3 * 3 * 9 * 3 * 4, index + 4393344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 4, product* 2 * 7 * 4 * 3 * 9 * 3 * 4, index + 4393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 4, product* 8 * 2 * 7 * 3 * 9 * 3 * 4, index + 4393728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 3 + 4, product* 4 * 8 * 9 * 3 * 9 * 3 * 4, index + 4393984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 3 + 4, product* 6 * 9 * 4 * 4 * 9 * 3 * 4, index + 4394496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 4, product* 4 * 2 * 6 * 4 * 9 * 3 * 4, index + 4394624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 3 + 4, product* 8 * 8 * 2 * 6 * 9 * 3 * 4, index + 4396288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 4, product* 2 * 7 * 6 * 6 * 9 * 3 * 4, index + 4396672);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 4, product* 4 * 2 * 8 * 7 * 9 * 3 * 4, index + 4397824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3 + 4, product* 6 * 3 * 3 * 8 * 9 * 3 * 4, index + 4398336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 4, product* 2 * 3 * 2 * 9 * 9 * 3 * 4, index + 4399232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 3 + 4, product* 4 * 4 * 7 * 9 * 9 * 3 * 4, index + 4399744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 4, product* 2 * 7 * 2 * 2 * 2 * 4 * 4, index + 4422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 4, product* 4 * 8 * 7 * 2 * 2 * 4 * 4, index + 4422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 4, product* 6 * 9 * 2 * 3 * 2 * 4 * 4, index + 4423296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 4, product* 4 * 2 * 4 * 3 * 2 * 4 * 4, index + 4423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 4, product* 6 * 3 * 9 * 3 * 2 * 4 * 4, index + 4423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 4, product* 8 * 4 * 4 * 4 * 2 * 4 * 4, index + 4424448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 4, product* 2 * 3 * 8 * 4 * 2 * 4 * 4, index + 4424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 4, product* 8 * 6 * 3 * 6 * 2 * 4 * 4, index + 4426368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 4 + 4, product* 6 * 9 * 4 * 6 * 2 * 4 * 4, index + 4426496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 4, product* 4 * 2 * 6 * 6 * 2 * 4 * 4, index + 4426624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 4, product* 4 * 6 * 2 * 7 * 2 * 4 * 4, index + 4427264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 4, product* 2 * 9 * 3 * 7 * 2 * 4 * 4, index + 4427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 4, product* 8 * 4 * 6 * 7 * 2 * 4 * 4, index + 4427648);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 4 + 4, product* 6 * 7 * 7 * 7 * 2 * 4 * 4, index + 4427776);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 4, product* 8 * 8 * 2 * 8 * 2 * 4 * 4, index + 4428288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 4, product* 2 * 7 * 6 * 8 * 2 * 4 * 4, index + 4428672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 4, product* 4 * 2 * 8 * 9 * 2 * 4 * 4, index + 4429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 4, product* 4 * 8 * 3 * 2 * 3 * 4 * 4, index + 4432384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 4, product* 8 * 6 * 7 * 2 * 3 * 4 * 4, index + 4432768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 4, product* 6 * 9 * 8 * 2 * 3 * 4 * 4, index + 4432896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 4, product* 4 * 6 * 6 * 3 * 3 * 4 * 4, index + 4433664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 4, product* 2 * 9 * 7 * 3 * 3 * 4 * 4, index + 4433792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 4, product* 2 * 3 * 4 * 4 * 3 * 4 * 4, index + 4434432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 4 + 4, product* 4 * 4 * 9 * 4 * 3 * 4 * 4, index + 4434944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 4, product* 4 * 2 * 2 * 6 * 3 * 4 * 4, index + 4436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 4, product* 6 * 3 * 7 * 6 * 3 * 4 * 4, index + 4436736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 4, product* 4 * 6 * 8 * 6 * 3 * 4 * 4, index + 4436864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 4 + 4, product* 2 * 9 * 9 * 6 * 3 * 4 * 4, index + 4436992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 4, product* 8 * 4 * 2 * 7 * 3 * 4 * 4, index + 4437248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 4, product* 2 * 3 * 6 * 7 * 3 * 4 * 4, index + 4437632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 4, product* 2 * 7 * 2 * 8 * 3 * 4 * 4, index + 4438272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 4 + 4, product* 6 * 9 * 2 * 9 * 3 * 4 * 4, index + 4439296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 4, product* 4 * 2 * 4 * 9 * 3 * 4 * 4, index + 4439424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 4, product* 8 * 6 * 3 * 2 * 4 * 4 * 4, index + 4442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 4, product* 4 * 2 * 6 * 2 * 4 * 4 * 4, index + 4442624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 4, product* 4 * 6 * 2 * 3 * 4 * 4 * 4, index + 4443264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 4, product* 2 * 9 * 3 * 3 * 4 * 4 * 4, index + 4443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 4, product* 8 * 4 * 6 * 3 * 4 * 4 * 4, index + 4443648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 4, product* 6 * 7 * 7 * 3 * 4 * 4 * 4, index + 4443776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 4, product* 8 * 8 * 2 * 4 * 4 * 4 * 4, index + 4444288);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 4, product* 8 * 2 * 9 * 4 * 4 * 4 * 4, index + 4444928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 4, product* 4 * 6 * 4 * 6 * 4 * 4 * 4, index + 4446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 4, product* 2 * 3 * 2 * 7 * 4 * 4 * 4, index + 4447232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 4 + 4, product* 8 * 8 * 4 * 7 * 4 * 4 * 4, index + 4447488);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 4, product* 4 * 6 * 6 * 9 * 4 * 4 * 4, index + 4449664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 4, product* 6 * 3 * 3 * 2 * 6 * 4 * 4, index + 4462336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 4, product* 4 * 6 * 4 * 2 * 6 * 4 * 4, index + 4462464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 4, product* 8 * 4 * 8 * 2 * 6 * 4 * 4, index + 4462848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 4, product* 2 * 3 * 2 * 3 * 6 * 4 * 4, index + 4463232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 4, product* 4 * 4 * 7 * 3 * 6 * 4 * 4, index + 4463744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 4, product* 2 * 7 * 8 * 3 * 6 * 4 * 4, index + 4463872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 4, product* 4 * 8 * 3 * 4 * 6 * 4 * 4, index + 4464384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 4 + 4, product* 8 * 6 * 7 * 4 * 6 * 4 * 4, index + 4464768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 4, product* 2 * 3 * 4 * 6 * 6 * 4 * 4, index + 4466432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 4 + 4, product* 8 * 8 * 6 * 6 * 6 * 4 * 4, index + 4466688);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 4 + 4, product* 8 * 2 * 3 * 7 * 6 * 4 * 4, index + 4467328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 4, product* 4 * 2 * 2 * 8 * 6 * 4 * 4, index + 4468224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 4 + 4, product* 2 * 9 * 9 * 8 * 6 * 4 * 4, index + 4468992);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 4, product* 2 * 3 * 6 * 9 * 6 * 4 * 4, index + 4469632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 4, product* 8 * 4 * 4 * 2 * 7 * 4 * 4, index + 4472448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 4, product* 2 * 3 * 8 * 2 * 7 * 4 * 4, index + 4472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 4, product* 4 * 4 * 3 * 3 * 7 * 4 * 4, index + 4473344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 4, product* 2 * 7 * 4 * 3 * 7 * 4 * 4, index + 4473472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 4, product* 8 * 2 * 7 * 3 * 7 * 4 * 4, index + 4473728);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 4 + 4, product* 8 * 6 * 3 * 4 * 7 * 4 * 4, index + 4474368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 4, product* 4 * 2 * 6 * 4 * 7 * 4 * 4, index + 4474624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 4, product* 2 * 7 * 6 * 6 * 7 * 4 * 4, index + 4476672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 4 + 4, product* 8 * 2 * 9 * 6 * 7 * 4 * 4, index + 4476928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 4, product* 4 * 2 * 8 * 7 * 7 * 4 * 4, index + 4477824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 4, product* 6 * 3 * 3 * 8 * 7 * 4 * 4, index + 4478336);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 7 + 4 + 4, product* 8 * 4 * 8 * 8 * 7 * 4 * 4, index + 4478848);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 4, product* 2 * 3 * 2 * 9 * 7 * 4 * 4, index + 4479232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 4, product* 2 * 3 * 4 * 2 * 8 * 4 * 4, index + 4482432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 4 + 4, product* 4 * 4 * 9 * 2 * 8 * 4 * 4, index + 4482944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 4, product* 8 * 2 * 3 * 3 * 8 * 4 * 4, index + 4483328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 4, product* 4 * 2 * 2 * 4 * 8 * 4 * 4, index + 4484224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 4, product* 2 * 7 * 2 * 6 * 8 * 4 * 4, index + 4486272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 4, product* 4 * 2 * 4 * 7 * 8 * 4 * 4, index + 4487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 4, product* 2 * 7 * 4 * 9 * 8 * 4 * 4, index + 4489472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4 + 4, product* 8 * 8 * 2 * 2 * 9 * 4 * 4, index + 4492288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 4, product* 2 * 7 * 6 * 2 * 9 * 4 * 4, index + 4492672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 4, product* 8 * 2 * 9 * 2 * 9 * 4 * 4, index + 4492928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 4, product* 4 * 2 * 8 * 3 * 9 * 4 * 4, index + 4493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 4, product* 6 * 3 * 3 * 4 * 9 * 4 * 4, index + 4494336);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 4 + 4, product* 6 * 7 * 9 * 4 * 9 * 4 * 4, index + 4494976);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 4 + 4, product* 4 * 8 * 3 * 6 * 9 * 4 * 4, index + 4496384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 4 + 4, product* 4 * 6 * 6 * 7 * 9 * 4 * 4, index + 4497664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 4 + 4, product* 2 * 3 * 4 * 8 * 9 * 4 * 4, index + 4498432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 4, product* 6 * 3 * 3 * 2 * 2 * 6 * 4, index + 4622336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 4, product* 4 * 6 * 4 * 2 * 2 * 6 * 4, index + 4622464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 4, product* 8 * 4 * 8 * 2 * 2 * 6 * 4, index + 4622848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 4, product* 6 * 7 * 9 * 2 * 2 * 6 * 4, index + 4622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 4, product* 2 * 3 * 2 * 3 * 2 * 6 * 4, index + 4623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 4, product* 4 * 4 * 7 * 3 * 2 * 6 * 4, index + 4623744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 4, product* 2 * 7 * 8 * 3 * 2 * 6 * 4, index + 4623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 4, product* 4 * 8 * 3 * 4 * 2 * 6 * 4, index + 4624384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 6 + 4, product* 8 * 6 * 7 * 4 * 2 * 6 * 4, index + 4624768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 4, product* 6 * 9 * 8 * 4 * 2 * 6 * 4, index + 4624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 4, product* 2 * 3 * 4 * 6 * 2 * 6 * 4, index + 4626432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 6 + 4, product* 4 * 4 * 9 * 6 * 2 * 6 * 4, index + 4626944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 4, product* 8 * 2 * 3 * 7 * 2 * 6 * 4, index + 4627328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 6 + 4, product* 8 * 6 * 9 * 7 * 2 * 6 * 4, index + 4627968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 4, product* 4 * 2 * 2 * 8 * 2 * 6 * 4, index + 4628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 4, product* 6 * 3 * 7 * 8 * 2 * 6 * 4, index + 4628736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 6 + 4, product* 2 * 9 * 9 * 8 * 2 * 6 * 4, index + 4628992);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 4, product* 6 * 7 * 3 * 9 * 2 * 6 * 4, index + 4629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 4, product* 2 * 3 * 6 * 9 * 2 * 6 * 4, index + 4629632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 4, product* 8 * 4 * 4 * 2 * 3 * 6 * 4, index + 4632448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 4, product* 2 * 3 * 8 * 2 * 3 * 6 * 4, index + 4632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 4, product* 4 * 4 * 3 * 3 * 3 * 6 * 4, index + 4633344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 4, product* 2 * 7 * 4 * 3 * 3 * 6 * 4, index + 4633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 4, product* 8 * 2 * 7 * 3 * 3 * 6 * 4, index + 4633728);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 6 + 4, product* 8 * 6 * 3 * 4 * 3 * 6 * 4, index + 4634368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 4, product* 6 * 9 * 4 * 4 * 3 * 6 * 4, index + 4634496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 4, product* 4 * 2 * 6 * 4 * 3 * 6 * 4, index + 4634624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 4, product* 8 * 8 * 2 * 6 * 3 * 6 * 4, index + 4636288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 4, product* 2 * 7 * 6 * 6 * 3 * 6 * 4, index + 4636672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 6 + 4, product* 8 * 2 * 9 * 6 * 3 * 6 * 4, index + 4636928);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 4, product* 6 * 3 * 3 * 8 * 3 * 6 * 4, index + 4638336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6 + 4, product* 4 * 6 * 4 * 8 * 3 * 6 * 4, index + 4638464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 4, product* 2 * 3 * 2 * 9 * 3 * 6 * 4, index + 4639232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 6 + 4, product* 8 * 8 * 4 * 9 * 3 * 6 * 4, index + 4639488);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 4, product* 2 * 3 * 4 * 2 * 4 * 6 * 4, index + 4642432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 4, product* 4 * 4 * 9 * 2 * 4 * 6 * 4, index + 4642944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 4, product* 8 * 2 * 3 * 3 * 4 * 6 * 4, index + 4643328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 4, product* 4 * 2 * 2 * 4 * 4 * 6 * 4, index + 4644224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 6 + 4, product* 4 * 6 * 8 * 4 * 4 * 6 * 4, index + 4644864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 4, product* 2 * 7 * 2 * 6 * 4 * 6 * 4, index + 4646272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 4, product* 6 * 9 * 2 * 7 * 4 * 6 * 4, index + 4647296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 4, product* 4 * 2 * 4 * 7 * 4 * 6 * 4, index + 4647424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 6 + 4, product* 8 * 4 * 4 * 8 * 4 * 6 * 4, index + 4648448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 4, product* 2 * 3 * 8 * 8 * 4 * 6 * 4, index + 4648832);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 4, product* 2 * 7 * 4 * 9 * 4 * 6 * 4, index + 4649472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 6 + 4, product* 8 * 2 * 7 * 9 * 4 * 6 * 4, index + 4649728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 4, product* 2 * 7 * 2 * 2 * 6 * 6 * 4, index + 4662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 4, product* 4 * 8 * 7 * 2 * 6 * 6 * 4, index + 4662784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 4, product* 6 * 9 * 2 * 3 * 6 * 6 * 4, index + 4663296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 4, product* 4 * 2 * 4 * 3 * 6 * 6 * 4, index + 4663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 4, product* 6 * 3 * 9 * 3 * 6 * 6 * 4, index + 4663936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 4, product* 2 * 3 * 8 * 4 * 6 * 6 * 4, index + 4664832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 6 + 4, product* 8 * 6 * 3 * 6 * 6 * 6 * 4, index + 4666368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 6 + 4, product* 6 * 9 * 4 * 6 * 6 * 6 * 4, index + 4666496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 4, product* 4 * 2 * 6 * 6 * 6 * 6 * 4, index + 4666624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 4, product* 2 * 9 * 3 * 7 * 6 * 6 * 4, index + 4667392);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 6 + 4, product* 8 * 8 * 2 * 8 * 6 * 6 * 4, index + 4668288);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 6 + 4, product* 8 * 2 * 9 * 8 * 6 * 6 * 4, index + 4668928);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 4, product* 4 * 8 * 3 * 2 * 7 * 6 * 4, index + 4672384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 4, product* 2 * 3 * 4 * 4 * 7 * 6 * 4, index + 4674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 4, product* 4 * 2 * 2 * 6 * 7 * 6 * 4, index + 4676224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 6 + 4, product* 6 * 3 * 7 * 6 * 7 * 6 * 4, index + 4676736);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 6 + 4, product* 2 * 9 * 9 * 6 * 7 * 6 * 4, index + 4676992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6 + 4, product* 8 * 4 * 2 * 7 * 7 * 6 * 4, index + 4677248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 4, product* 2 * 3 * 6 * 7 * 7 * 6 * 4, index + 4677632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 4, product* 2 * 7 * 2 * 8 * 7 * 6 * 4, index + 4678272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 4, product* 4 * 2 * 4 * 9 * 7 * 6 * 4, index + 4679424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 6 + 4, product* 8 * 6 * 3 * 2 * 8 * 6 * 4, index + 4682368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6 + 4, product* 6 * 9 * 4 * 2 * 8 * 6 * 4, index + 4682496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 4, product* 4 * 2 * 6 * 2 * 8 * 6 * 4, index + 4682624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 4, product* 4 * 6 * 2 * 3 * 8 * 6 * 4, index + 4683264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 4, product* 2 * 9 * 3 * 3 * 8 * 6 * 4, index + 4683392);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 6 + 4, product* 6 * 3 * 3 * 6 * 8 * 6 * 4, index + 4686336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 6 + 4, product* 4 * 6 * 4 * 6 * 8 * 6 * 4, index + 4686464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 4, product* 2 * 3 * 2 * 7 * 8 * 6 * 4, index + 4687232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 6 + 4, product* 4 * 4 * 7 * 7 * 8 * 6 * 4, index + 4687744);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 6 + 4, product* 4 * 8 * 3 * 8 * 8 * 6 * 4, index + 4688384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 4, product* 4 * 2 * 2 * 2 * 9 * 6 * 4, index + 4692224);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6 + 4, product* 4 * 6 * 8 * 2 * 9 * 6 * 4, index + 4692864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 6 + 4, product* 2 * 9 * 9 * 2 * 9 * 6 * 4, index + 4692992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 4, product* 8 * 4 * 2 * 3 * 9 * 6 * 4, index + 4693248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 4, product* 2 * 3 * 6 * 3 * 9 * 6 * 4, index + 4693632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 4, product* 2 * 7 * 2 * 4 * 9 * 6 * 4, index + 4694272);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6 + 4, product* 2 * 7 * 4 * 7 * 9 * 6 * 4, index + 4697472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 6 + 4, product* 8 * 2 * 7 * 7 * 9 * 6 * 4, index + 4697728);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 6 + 4, product* 2 * 9 * 3 * 9 * 9 * 6 * 4, index + 4699392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 4, product* 2 * 3 * 4 * 2 * 2 * 7 * 4, index + 4722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 4, product* 4 * 4 * 9 * 2 * 2 * 7 * 4, index + 4722944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 4, product* 8 * 2 * 3 * 3 * 2 * 7 * 4, index + 4723328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 4, product* 4 * 2 * 2 * 4 * 2 * 7 * 4, index + 4724224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 4, product* 4 * 6 * 8 * 4 * 2 * 7 * 4, index + 4724864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 4, product* 2 * 9 * 9 * 4 * 2 * 7 * 4, index + 4724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 4, product* 2 * 7 * 2 * 6 * 2 * 7 * 4, index + 4726272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7 + 4, product* 4 * 8 * 7 * 6 * 2 * 7 * 4, index + 4726784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 4, product* 6 * 9 * 2 * 7 * 2 * 7 * 4, index + 4727296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 4, product* 4 * 2 * 4 * 7 * 2 * 7 * 4, index + 4727424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 4, product* 8 * 4 * 4 * 8 * 2 * 7 * 4, index + 4728448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 4, product* 2 * 3 * 8 * 8 * 2 * 7 * 4, index + 4728832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 4, product* 4 * 4 * 3 * 9 * 2 * 7 * 4, index + 4729344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 4, product* 2 * 7 * 4 * 9 * 2 * 7 * 4, index + 4729472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 7 + 4, product* 4 * 8 * 9 * 9 * 2 * 7 * 4, index + 4729984);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 4, product* 2 * 7 * 6 * 2 * 3 * 7 * 4, index + 4732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 4, product* 8 * 2 * 9 * 2 * 3 * 7 * 4, index + 4732928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 4, product* 4 * 2 * 8 * 3 * 3 * 7 * 4, index + 4733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 4, product* 6 * 3 * 3 * 4 * 3 * 7 * 4, index + 4734336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 4, product* 4 * 6 * 4 * 4 * 3 * 7 * 4, index + 4734464);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7 + 4, product* 4 * 6 * 6 * 7 * 3 * 7 * 4, index + 4737664);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 7 + 4, product* 2 * 9 * 7 * 7 * 3 * 7 * 4, index + 4737792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 4, product* 2 * 3 * 4 * 8 * 3 * 7 * 4, index + 4738432);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 7 + 4, product* 8 * 8 * 6 * 8 * 3 * 7 * 4, index + 4738688);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 4, product* 8 * 2 * 3 * 9 * 3 * 7 * 4, index + 4739328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 4, product* 2 * 7 * 2 * 2 * 4 * 7 * 4, index + 4742272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7 + 4, product* 6 * 9 * 2 * 3 * 4 * 7 * 4, index + 4743296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 4, product* 4 * 2 * 4 * 3 * 4 * 7 * 4, index + 4743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 4, product* 6 * 3 * 9 * 3 * 4 * 7 * 4, index + 4743936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 4, product* 2 * 3 * 8 * 4 * 4 * 7 * 4, index + 4744832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 7 + 4, product* 6 * 9 * 4 * 6 * 4 * 7 * 4, index + 4746496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 4, product* 4 * 2 * 6 * 6 * 4 * 7 * 4, index + 4746624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 4, product* 4 * 6 * 2 * 7 * 4 * 7 * 4, index + 4747264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4 + 7 + 4, product* 6 * 7 * 7 * 7 * 4 * 7 * 4, index + 4747776);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 4, product* 2 * 7 * 6 * 8 * 4 * 7 * 4, index + 4748672);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 7 + 4, product* 6 * 9 * 4 * 2 * 6 * 7 * 4, index + 4762496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 4, product* 4 * 2 * 6 * 2 * 6 * 7 * 4, index + 4762624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 4, product* 4 * 6 * 2 * 3 * 6 * 7 * 4, index + 4763264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 4, product* 2 * 9 * 3 * 3 * 6 * 7 * 4, index + 4763392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 7 + 4, product* 6 * 7 * 7 * 3 * 6 * 7 * 4, index + 4763776);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 7 + 4, product* 8 * 2 * 9 * 4 * 6 * 7 * 4, index + 4764928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 4, product* 2 * 3 * 2 * 7 * 6 * 7 * 4, index + 4767232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 4, product* 4 * 2 * 2 * 2 * 7 * 7 * 4, index + 4772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 4, product* 6 * 3 * 7 * 2 * 7 * 7 * 4, index + 4772736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 7 + 4, product* 4 * 6 * 8 * 2 * 7 * 7 * 4, index + 4772864);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 4, product* 8 * 4 * 2 * 3 * 7 * 7 * 4, index + 4773248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 4, product* 2 * 3 * 6 * 3 * 7 * 7 * 4, index + 4773632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 4, product* 2 * 7 * 2 * 4 * 7 * 7 * 4, index + 4774272);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7 + 4, product* 8 * 4 * 4 * 6 * 7 * 7 * 4, index + 4776448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 4, product* 2 * 3 * 8 * 6 * 7 * 7 * 4, index + 4776832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 7 + 4, product* 4 * 4 * 3 * 7 * 7 * 7 * 4, index + 4777344);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 7 + 4, product* 4 * 6 * 2 * 9 * 7 * 7 * 4, index + 4779264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 4, product* 6 * 3 * 3 * 2 * 8 * 7 * 4, index + 4782336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 4, product* 2 * 3 * 2 * 3 * 8 * 7 * 4, index + 4783232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7 + 4, product* 4 * 4 * 7 * 3 * 8 * 7 * 4, index + 4783744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 7 + 4, product* 2 * 7 * 8 * 3 * 8 * 7 * 4, index + 4783872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 4, product* 2 * 3 * 4 * 6 * 8 * 7 * 4, index + 4786432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 4, product* 8 * 2 * 3 * 7 * 8 * 7 * 4, index + 4787328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 4, product* 4 * 2 * 2 * 8 * 8 * 7 * 4, index + 4788224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 7 + 4, product* 2 * 9 * 9 * 8 * 8 * 7 * 4, index + 4788992);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7 + 4, product* 8 * 4 * 4 * 2 * 9 * 7 * 4, index + 4792448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 4, product* 2 * 3 * 8 * 2 * 9 * 7 * 4, index + 4792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 4, product* 4 * 4 * 3 * 3 * 9 * 7 * 4, index + 4793344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 4, product* 2 * 7 * 4 * 3 * 9 * 7 * 4, index + 4793472);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 7 + 4, product* 4 * 2 * 6 * 4 * 9 * 7 * 4, index + 4794624);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 4, product* 2 * 7 * 2 * 2 * 2 * 8 * 4, index + 4822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 4, product* 4 * 8 * 7 * 2 * 2 * 8 * 4, index + 4822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 4, product* 6 * 9 * 2 * 3 * 2 * 8 * 4, index + 4823296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 4, product* 4 * 2 * 4 * 3 * 2 * 8 * 4, index + 4823424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 4, product* 8 * 4 * 4 * 4 * 2 * 8 * 4, index + 4824448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 4, product* 2 * 3 * 8 * 4 * 2 * 8 * 4, index + 4824832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 8 + 4, product* 8 * 6 * 3 * 6 * 2 * 8 * 4, index + 4826368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 8 + 4, product* 4 * 2 * 6 * 6 * 2 * 8 * 4, index + 4826624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 4, product* 4 * 6 * 2 * 7 * 2 * 8 * 4, index + 4827264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 4, product* 2 * 9 * 3 * 7 * 2 * 8 * 4, index + 4827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 4, product* 8 * 4 * 6 * 7 * 2 * 8 * 4, index + 4827648);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 4, product* 4 * 2 * 8 * 9 * 2 * 8 * 4, index + 4829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 4, product* 4 * 8 * 3 * 2 * 3 * 8 * 4, index + 4832384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 8 + 4, product* 8 * 6 * 7 * 2 * 3 * 8 * 4, index + 4832768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 4, product* 2 * 9 * 7 * 3 * 3 * 8 * 4, index + 4833792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 4, product* 2 * 3 * 4 * 4 * 3 * 8 * 4, index + 4834432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 8 + 4, product* 8 * 8 * 6 * 4 * 3 * 8 * 4, index + 4834688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 4, product* 4 * 2 * 2 * 6 * 3 * 8 * 4, index + 4836224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8 + 4, product* 6 * 3 * 7 * 6 * 3 * 8 * 4, index + 4836736);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 4, product* 2 * 3 * 6 * 7 * 3 * 8 * 4, index + 4837632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 4, product* 2 * 7 * 2 * 8 * 3 * 8 * 4, index + 4838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 4, product* 6 * 9 * 2 * 9 * 3 * 8 * 4, index + 4839296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8 + 4, product* 4 * 2 * 4 * 9 * 3 * 8 * 4, index + 4839424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 8 + 4, product* 8 * 6 * 3 * 2 * 4 * 8 * 4, index + 4842368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 8 + 4, product* 6 * 9 * 4 * 2 * 4 * 8 * 4, index + 4842496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 4, product* 4 * 2 * 6 * 2 * 4 * 8 * 4, index + 4842624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 4, product* 4 * 6 * 2 * 3 * 4 * 8 * 4, index + 4843264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 4, product* 2 * 9 * 3 * 3 * 4 * 8 * 4, index + 4843392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 8 + 4, product* 6 * 7 * 7 * 3 * 4 * 8 * 4, index + 4843776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 4, product* 8 * 8 * 2 * 4 * 4 * 8 * 4, index + 4844288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 4, product* 2 * 7 * 6 * 4 * 4 * 8 * 4, index + 4844672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 4, product* 6 * 3 * 3 * 6 * 4 * 8 * 4, index + 4846336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8 + 4, product* 4 * 6 * 4 * 6 * 4 * 8 * 4, index + 4846464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 4, product* 2 * 3 * 2 * 7 * 4 * 8 * 4, index + 4847232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 8 + 4, product* 4 * 8 * 3 * 8 * 4 * 8 * 4, index + 4848384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 8 + 4, product* 4 * 6 * 6 * 9 * 4 * 8 * 4, index + 4849664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 4, product* 6 * 3 * 3 * 2 * 6 * 8 * 4, index + 4862336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 4, product* 4 * 6 * 4 * 2 * 6 * 8 * 4, index + 4862464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 4, product* 2 * 3 * 2 * 3 * 6 * 8 * 4, index + 4863232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8 + 4, product* 4 * 4 * 7 * 3 * 6 * 8 * 4, index + 4863744);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 4, product* 2 * 3 * 4 * 6 * 6 * 8 * 4, index + 4866432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 4, product* 4 * 2 * 2 * 8 * 6 * 8 * 4, index + 4868224);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 4, product* 2 * 3 * 6 * 9 * 6 * 8 * 4, index + 4869632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 4, product* 2 * 3 * 8 * 2 * 7 * 8 * 4, index + 4872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 4, product* 4 * 4 * 3 * 3 * 7 * 8 * 4, index + 4873344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 8 + 4, product* 2 * 7 * 4 * 3 * 7 * 8 * 4, index + 4873472);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 8 + 4, product* 4 * 6 * 4 * 8 * 7 * 8 * 4, index + 4878464);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 4, product* 2 * 3 * 4 * 2 * 8 * 8 * 4, index + 4882432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 4, product* 4 * 2 * 2 * 4 * 8 * 8 * 4, index + 4884224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 8 + 4, product* 2 * 9 * 9 * 4 * 8 * 8 * 4, index + 4884992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 8 + 4, product* 2 * 7 * 2 * 6 * 8 * 8 * 4, index + 4886272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 8 + 4, product* 6 * 9 * 2 * 7 * 8 * 8 * 4, index + 4887296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 8 + 4, product* 4 * 2 * 4 * 7 * 8 * 8 * 4, index + 4887424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 8 + 4, product* 2 * 7 * 4 * 9 * 8 * 8 * 4, index + 4889472);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 8 + 4, product* 2 * 7 * 6 * 2 * 9 * 8 * 4, index + 4892672);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 4, product* 4 * 2 * 8 * 3 * 9 * 8 * 4, index + 4893824);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 8 + 4, product* 6 * 7 * 9 * 4 * 9 * 8 * 4, index + 4894976);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 8 + 4, product* 2 * 9 * 7 * 7 * 9 * 8 * 4, index + 4897792);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 4, product* 8 * 6 * 3 * 2 * 2 * 9 * 4, index + 4922368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 4, product* 6 * 9 * 4 * 2 * 2 * 9 * 4, index + 4922496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 4, product* 4 * 2 * 6 * 2 * 2 * 9 * 4, index + 4922624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 4, product* 4 * 6 * 2 * 3 * 2 * 9 * 4, index + 4923264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 4, product* 2 * 9 * 3 * 3 * 2 * 9 * 4, index + 4923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9 + 4, product* 8 * 4 * 6 * 3 * 2 * 9 * 4, index + 4923648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 9 + 4, product* 6 * 7 * 7 * 3 * 2 * 9 * 4, index + 4923776);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 4, product* 2 * 7 * 6 * 4 * 2 * 9 * 4, index + 4924672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 9 + 4, product* 4 * 6 * 4 * 6 * 2 * 9 * 4, index + 4926464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 4, product* 2 * 3 * 2 * 7 * 2 * 9 * 4, index + 4927232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 9 + 4, product* 8 * 8 * 4 * 7 * 2 * 9 * 4, index + 4927488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 9 + 4, product* 4 * 4 * 7 * 7 * 2 * 9 * 4, index + 4927744);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9 + 4, product* 4 * 8 * 3 * 8 * 2 * 9 * 4, index + 4928384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 9 + 4, product* 8 * 6 * 7 * 8 * 2 * 9 * 4, index + 4928768);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 4, product* 4 * 2 * 2 * 2 * 3 * 9 * 4, index + 4932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 4, product* 6 * 3 * 7 * 2 * 3 * 9 * 4, index + 4932736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 4, product* 8 * 4 * 2 * 3 * 3 * 9 * 4, index + 4933248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 9 + 4, product* 6 * 7 * 3 * 3 * 3 * 9 * 4, index + 4933376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 4, product* 2 * 3 * 6 * 3 * 3 * 9 * 4, index + 4933632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 4, product* 2 * 7 * 2 * 4 * 3 * 9 * 4, index + 4934272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 4, product* 2 * 3 * 8 * 6 * 3 * 9 * 4, index + 4936832);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 4, product* 8 * 2 * 7 * 7 * 3 * 9 * 4, index + 4937728);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 9 + 4, product* 4 * 6 * 2 * 9 * 3 * 9 * 4, index + 4939264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 9 + 4, product* 2 * 9 * 3 * 9 * 3 * 9 * 4, index + 4939392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 4, product* 6 * 3 * 3 * 2 * 4 * 9 * 4, index + 4942336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 4, product* 4 * 6 * 4 * 2 * 4 * 9 * 4, index + 4942464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 9 + 4, product* 6 * 7 * 9 * 2 * 4 * 9 * 4, index + 4942976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 4, product* 2 * 3 * 2 * 3 * 4 * 9 * 4, index + 4943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 4, product* 4 * 4 * 7 * 3 * 4 * 9 * 4, index + 4943744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 4, product* 2 * 7 * 8 * 3 * 4 * 9 * 4, index + 4943872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 4, product* 4 * 8 * 3 * 4 * 4 * 9 * 4, index + 4944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 4, product* 2 * 3 * 4 * 6 * 4 * 9 * 4, index + 4946432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 9 + 4, product* 4 * 4 * 9 * 6 * 4 * 9 * 4, index + 4946944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 4, product* 8 * 2 * 3 * 7 * 4 * 9 * 4, index + 4947328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 4, product* 4 * 2 * 2 * 8 * 4 * 9 * 4, index + 4948224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 9 + 4, product* 8 * 4 * 2 * 9 * 4 * 9 * 4, index + 4949248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 4, product* 2 * 3 * 6 * 9 * 4 * 9 * 4, index + 4949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 4, product* 2 * 3 * 4 * 2 * 6 * 9 * 4, index + 4962432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 9 + 4, product* 4 * 4 * 9 * 2 * 6 * 9 * 4, index + 4962944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9 + 4, product* 8 * 2 * 3 * 3 * 6 * 9 * 4, index + 4963328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 4, product* 4 * 2 * 2 * 4 * 6 * 9 * 4, index + 4964224);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 9 + 4, product* 4 * 2 * 4 * 7 * 6 * 9 * 4, index + 4967424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 9 + 4, product* 6 * 3 * 9 * 7 * 6 * 9 * 4, index + 4967936);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 9 + 4, product* 4 * 4 * 3 * 9 * 6 * 9 * 4, index + 4969344);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 9 + 4, product* 8 * 8 * 2 * 2 * 7 * 9 * 4, index + 4972288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 9 + 4, product* 4 * 2 * 8 * 3 * 7 * 9 * 4, index + 4973824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 9 + 4, product* 4 * 8 * 3 * 6 * 7 * 9 * 4, index + 4976384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 4, product* 2 * 3 * 4 * 8 * 7 * 9 * 4, index + 4978432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 9 + 4, product* 8 * 2 * 3 * 9 * 7 * 9 * 4, index + 4979328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 4, product* 2 * 7 * 2 * 2 * 8 * 9 * 4, index + 4982272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 9 + 4, product* 4 * 8 * 7 * 2 * 8 * 9 * 4, index + 4982784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 9 + 4, product* 6 * 9 * 2 * 3 * 8 * 9 * 4, index + 4983296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 4, product* 4 * 2 * 4 * 3 * 8 * 9 * 4, index + 4983424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 9 + 4, product* 8 * 4 * 4 * 4 * 8 * 9 * 4, index + 4984448);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 9 + 4, product* 4 * 2 * 6 * 6 * 8 * 9 * 4, index + 4986624);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 4, product* 4 * 8 * 3 * 2 * 9 * 9 * 4, index + 4992384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9 + 4, product* 2 * 3 * 4 * 4 * 9 * 9 * 4, index + 4994432);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9 + 9 + 4, product* 6 * 7 * 3 * 7 * 9 * 9 * 4, index + 4997376);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 6, product* 6 * 3 * 3 * 2 * 2 * 2 * 6, index + 6222336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 6, product* 4 * 6 * 4 * 2 * 2 * 2 * 6, index + 6222464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 6, product* 8 * 4 * 8 * 2 * 2 * 2 * 6, index + 6222848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 6, product* 6 * 7 * 9 * 2 * 2 * 2 * 6, index + 6222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 6, product* 2 * 3 * 2 * 3 * 2 * 2 * 6, index + 6223232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 6, product* 4 * 4 * 7 * 3 * 2 * 2 * 6, index + 6223744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 6, product* 2 * 7 * 8 * 3 * 2 * 2 * 6, index + 6223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 6, product* 4 * 8 * 3 * 4 * 2 * 2 * 6, index + 6224384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 6, product* 8 * 6 * 7 * 4 * 2 * 2 * 6, index + 6224768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 6, product* 6 * 9 * 8 * 4 * 2 * 2 * 6, index + 6224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 6, product* 2 * 3 * 4 * 6 * 2 * 2 * 6, index + 6226432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 2 + 6, product* 8 * 8 * 6 * 6 * 2 * 2 * 6, index + 6226688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 6, product* 4 * 4 * 9 * 6 * 2 * 2 * 6, index + 6226944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 6, product* 8 * 2 * 3 * 7 * 2 * 2 * 6, index + 6227328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 6, product* 4 * 2 * 2 * 8 * 2 * 2 * 6, index + 6228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 6, product* 6 * 3 * 7 * 8 * 2 * 2 * 6, index + 6228736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 6, product* 4 * 6 * 8 * 8 * 2 * 2 * 6, index + 6228864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 6, product* 2 * 9 * 9 * 8 * 2 * 2 * 6, index + 6228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 6, product* 8 * 4 * 2 * 9 * 2 * 2 * 6, index + 6229248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 6, product* 2 * 3 * 6 * 9 * 2 * 2 * 6, index + 6229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 6, product* 8 * 4 * 4 * 2 * 3 * 2 * 6, index + 6232448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 6, product* 2 * 3 * 8 * 2 * 3 * 2 * 6, index + 6232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 6, product* 4 * 4 * 3 * 3 * 3 * 2 * 6, index + 6233344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 6, product* 2 * 7 * 4 * 3 * 3 * 2 * 6, index + 6233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 6, product* 8 * 2 * 7 * 3 * 3 * 2 * 6, index + 6233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 6, product* 4 * 8 * 9 * 3 * 3 * 2 * 6, index + 6233984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 6, product* 8 * 6 * 3 * 4 * 3 * 2 * 6, index + 6234368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 6, product* 6 * 9 * 4 * 4 * 3 * 2 * 6, index + 6234496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 6, product* 4 * 2 * 6 * 4 * 3 * 2 * 6, index + 6234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 6, product* 2 * 7 * 6 * 6 * 3 * 2 * 6, index + 6236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 6, product* 8 * 2 * 9 * 6 * 3 * 2 * 6, index + 6236928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 6, product* 6 * 9 * 6 * 7 * 3 * 2 * 6, index + 6237696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 6, product* 4 * 2 * 8 * 7 * 3 * 2 * 6, index + 6237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 6, product* 6 * 3 * 3 * 8 * 3 * 2 * 6, index + 6238336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 6, product* 4 * 6 * 4 * 8 * 3 * 2 * 6, index + 6238464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 6, product* 2 * 3 * 2 * 9 * 3 * 2 * 6, index + 6239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 6, product* 8 * 8 * 4 * 9 * 3 * 2 * 6, index + 6239488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2 + 6, product* 4 * 4 * 7 * 9 * 3 * 2 * 6, index + 6239744);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 6, product* 2 * 7 * 8 * 9 * 3 * 2 * 6, index + 6239872);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 6, product* 6 * 3 * 9 * 9 * 3 * 2 * 6, index + 6239936);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 6, product* 2 * 3 * 4 * 2 * 4 * 2 * 6, index + 6242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 6, product* 8 * 8 * 6 * 2 * 4 * 2 * 6, index + 6242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 6, product* 4 * 4 * 9 * 2 * 4 * 2 * 6, index + 6242944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 6, product* 8 * 2 * 3 * 3 * 4 * 2 * 6, index + 6243328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 6, product* 4 * 2 * 2 * 4 * 4 * 2 * 6, index + 6244224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 6, product* 4 * 6 * 8 * 4 * 4 * 2 * 6, index + 6244864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 6, product* 2 * 9 * 9 * 4 * 4 * 2 * 6, index + 6244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 6, product* 2 * 7 * 2 * 6 * 4 * 2 * 6, index + 6246272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 2 + 6, product* 4 * 8 * 7 * 6 * 4 * 2 * 6, index + 6246784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 6, product* 6 * 9 * 2 * 7 * 4 * 2 * 6, index + 6247296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 6, product* 4 * 2 * 4 * 7 * 4 * 2 * 6, index + 6247424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 6, product* 6 * 3 * 9 * 7 * 4 * 2 * 6, index + 6247936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 2 + 6, product* 8 * 4 * 4 * 8 * 4 * 2 * 6, index + 6248448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 6, product* 2 * 3 * 8 * 8 * 4 * 2 * 6, index + 6248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 6, product* 4 * 4 * 3 * 9 * 4 * 2 * 6, index + 6249344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 6, product* 2 * 7 * 4 * 9 * 4 * 2 * 6, index + 6249472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 6, product* 8 * 2 * 7 * 9 * 4 * 2 * 6, index + 6249728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 2 + 6, product* 4 * 8 * 9 * 9 * 4 * 2 * 6, index + 6249984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 6, product* 2 * 7 * 2 * 2 * 6 * 2 * 6, index + 6262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 6, product* 4 * 8 * 7 * 2 * 6 * 2 * 6, index + 6262784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 6, product* 6 * 9 * 2 * 3 * 6 * 2 * 6, index + 6263296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 6, product* 4 * 2 * 4 * 3 * 6 * 2 * 6, index + 6263424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 6, product* 8 * 4 * 4 * 4 * 6 * 2 * 6, index + 6264448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 6, product* 2 * 3 * 8 * 4 * 6 * 2 * 6, index + 6264832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 6, product* 4 * 2 * 6 * 6 * 6 * 2 * 6, index + 6266624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 6, product* 4 * 6 * 2 * 7 * 6 * 2 * 6, index + 6267264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 6, product* 2 * 9 * 3 * 7 * 6 * 2 * 6, index + 6267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 6, product* 8 * 4 * 6 * 7 * 6 * 2 * 6, index + 6267648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 6, product* 2 * 7 * 6 * 8 * 6 * 2 * 6, index + 6268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 6, product* 8 * 2 * 9 * 8 * 6 * 2 * 6, index + 6268928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 6, product* 4 * 2 * 8 * 9 * 6 * 2 * 6, index + 6269824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 6, product* 4 * 8 * 3 * 2 * 7 * 2 * 6, index + 6272384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 6, product* 8 * 6 * 7 * 2 * 7 * 2 * 6, index + 6272768);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 6, product* 4 * 6 * 6 * 3 * 7 * 2 * 6, index + 6273664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 6, product* 2 * 9 * 7 * 3 * 7 * 2 * 6, index + 6273792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 6, product* 2 * 3 * 4 * 4 * 7 * 2 * 6, index + 6274432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 2 + 6, product* 8 * 8 * 6 * 4 * 7 * 2 * 6, index + 6274688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 6, product* 4 * 4 * 9 * 4 * 7 * 2 * 6, index + 6274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 6, product* 4 * 2 * 2 * 6 * 7 * 2 * 6, index + 6276224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 2 + 6, product* 6 * 3 * 7 * 6 * 7 * 2 * 6, index + 6276736);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 2 + 6, product* 6 * 7 * 3 * 7 * 7 * 2 * 6, index + 6277376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 6, product* 2 * 3 * 6 * 7 * 7 * 2 * 6, index + 6277632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 6, product* 2 * 7 * 2 * 8 * 7 * 2 * 6, index + 6278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 6, product* 8 * 6 * 3 * 2 * 8 * 2 * 6, index + 6282368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2 + 6, product* 6 * 9 * 4 * 2 * 8 * 2 * 6, index + 6282496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 6, product* 4 * 2 * 6 * 2 * 8 * 2 * 6, index + 6282624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 6, product* 4 * 6 * 2 * 3 * 8 * 2 * 6, index + 6283264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 6, product* 2 * 9 * 3 * 3 * 8 * 2 * 6, index + 6283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 6, product* 8 * 4 * 6 * 3 * 8 * 2 * 6, index + 6283648);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 6, product* 8 * 8 * 2 * 4 * 8 * 2 * 6, index + 6284288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 6, product* 2 * 7 * 6 * 4 * 8 * 2 * 6, index + 6284672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 6, product* 6 * 3 * 3 * 6 * 8 * 2 * 6, index + 6286336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 6, product* 4 * 6 * 4 * 6 * 8 * 2 * 6, index + 6286464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 6, product* 2 * 3 * 2 * 7 * 8 * 2 * 6, index + 6287232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2 + 6, product* 4 * 8 * 3 * 8 * 8 * 2 * 6, index + 6288384);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 2 + 6, product* 2 * 9 * 7 * 9 * 8 * 2 * 6, index + 6289792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 6, product* 4 * 2 * 2 * 2 * 9 * 2 * 6, index + 6292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 6, product* 6 * 3 * 7 * 2 * 9 * 2 * 6, index + 6292736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 6, product* 4 * 6 * 8 * 2 * 9 * 2 * 6, index + 6292864);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 6, product* 8 * 4 * 2 * 3 * 9 * 2 * 6, index + 6293248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 6, product* 2 * 3 * 6 * 3 * 9 * 2 * 6, index + 6293632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 6, product* 2 * 7 * 2 * 4 * 9 * 2 * 6, index + 6294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 6, product* 4 * 8 * 7 * 4 * 9 * 2 * 6, index + 6294784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 6, product* 2 * 3 * 8 * 6 * 9 * 2 * 6, index + 6296832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 6, product* 4 * 4 * 3 * 7 * 9 * 2 * 6, index + 6297344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 6, product* 2 * 7 * 4 * 7 * 9 * 2 * 6, index + 6297472);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2 + 6, product* 8 * 6 * 3 * 8 * 9 * 2 * 6, index + 6298368);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 2 + 6, product* 6 * 9 * 4 * 8 * 9 * 2 * 6, index + 6298496);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 6, product* 2 * 9 * 3 * 9 * 9 * 2 * 6, index + 6299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 6, product* 2 * 3 * 4 * 2 * 2 * 3 * 6, index + 6322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 6, product* 4 * 4 * 9 * 2 * 2 * 3 * 6, index + 6322944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 6, product* 8 * 2 * 3 * 3 * 2 * 3 * 6, index + 6323328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 6, product* 4 * 2 * 2 * 4 * 2 * 3 * 6, index + 6324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 6, product* 6 * 3 * 7 * 4 * 2 * 3 * 6, index + 6324736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 6, product* 4 * 6 * 8 * 4 * 2 * 3 * 6, index + 6324864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 6, product* 2 * 9 * 9 * 4 * 2 * 3 * 6, index + 6324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 6, product* 2 * 7 * 2 * 6 * 2 * 3 * 6, index + 6326272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 6, product* 6 * 9 * 2 * 7 * 2 * 3 * 6, index + 6327296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 6, product* 4 * 2 * 4 * 7 * 2 * 3 * 6, index + 6327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 6, product* 6 * 3 * 9 * 7 * 2 * 3 * 6, index + 6327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 6, product* 8 * 4 * 4 * 8 * 2 * 3 * 6, index + 6328448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 6, product* 2 * 3 * 8 * 8 * 2 * 3 * 6, index + 6328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 6, product* 4 * 4 * 3 * 9 * 2 * 3 * 6, index + 6329344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 6, product* 2 * 7 * 4 * 9 * 2 * 3 * 6, index + 6329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 6, product* 8 * 2 * 7 * 9 * 2 * 3 * 6, index + 6329728);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 6, product* 2 * 9 * 7 * 9 * 2 * 3 * 6, index + 6329792);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 6, product* 8 * 8 * 2 * 2 * 3 * 3 * 6, index + 6332288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 6, product* 2 * 7 * 6 * 2 * 3 * 3 * 6, index + 6332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 6, product* 8 * 2 * 9 * 2 * 3 * 3 * 6, index + 6332928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 6, product* 4 * 2 * 8 * 3 * 3 * 3 * 6, index + 6333824);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 6, product* 4 * 6 * 4 * 4 * 3 * 3 * 6, index + 6334464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3 + 6, product* 6 * 7 * 9 * 4 * 3 * 3 * 6, index + 6334976);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3 + 6, product* 4 * 6 * 6 * 7 * 3 * 3 * 6, index + 6337664);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 6, product* 2 * 9 * 7 * 7 * 3 * 3 * 6, index + 6337792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 6, product* 2 * 3 * 4 * 8 * 3 * 3 * 6, index + 6338432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 6, product* 8 * 2 * 3 * 9 * 3 * 3 * 6, index + 6339328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 6, product* 2 * 7 * 2 * 2 * 4 * 3 * 6, index + 6342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 6, product* 4 * 8 * 7 * 2 * 4 * 3 * 6, index + 6342784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 6, product* 6 * 9 * 2 * 3 * 4 * 3 * 6, index + 6343296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 6, product* 4 * 2 * 4 * 3 * 4 * 3 * 6, index + 6343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 6, product* 6 * 3 * 9 * 3 * 4 * 3 * 6, index + 6343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 6, product* 8 * 4 * 4 * 4 * 4 * 3 * 6, index + 6344448);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 6, product* 8 * 6 * 3 * 6 * 4 * 3 * 6, index + 6346368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3 + 6, product* 6 * 9 * 4 * 6 * 4 * 3 * 6, index + 6346496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 6, product* 4 * 2 * 6 * 6 * 4 * 3 * 6, index + 6346624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 6, product* 4 * 6 * 2 * 7 * 4 * 3 * 6, index + 6347264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 6, product* 2 * 9 * 3 * 7 * 4 * 3 * 6, index + 6347392);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 3 + 6, product* 8 * 8 * 2 * 8 * 4 * 3 * 6, index + 6348288);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 6, product* 8 * 2 * 9 * 8 * 4 * 3 * 6, index + 6348928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3 + 6, product* 4 * 2 * 8 * 9 * 4 * 3 * 6, index + 6349824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3 + 6, product* 8 * 6 * 3 * 2 * 6 * 3 * 6, index + 6362368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 6, product* 6 * 9 * 4 * 2 * 6 * 3 * 6, index + 6362496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 6, product* 4 * 2 * 6 * 2 * 6 * 3 * 6, index + 6362624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 6, product* 4 * 6 * 2 * 3 * 6 * 3 * 6, index + 6363264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 6, product* 2 * 9 * 3 * 3 * 6 * 3 * 6, index + 6363392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 6, product* 8 * 8 * 2 * 4 * 6 * 3 * 6, index + 6364288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 6, product* 2 * 7 * 6 * 4 * 6 * 3 * 6, index + 6364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 6, product* 8 * 2 * 9 * 4 * 6 * 3 * 6, index + 6364928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 6, product* 4 * 6 * 4 * 6 * 6 * 3 * 6, index + 6366464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 3 + 6, product* 8 * 4 * 8 * 6 * 6 * 3 * 6, index + 6366848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 6, product* 2 * 3 * 2 * 7 * 6 * 3 * 6, index + 6367232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3 + 6, product* 8 * 8 * 4 * 7 * 6 * 3 * 6, index + 6367488);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 6 + 3 + 6, product* 2 * 9 * 7 * 9 * 6 * 3 * 6, index + 6369792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 6, product* 4 * 2 * 2 * 2 * 7 * 3 * 6, index + 6372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 6, product* 6 * 3 * 7 * 2 * 7 * 3 * 6, index + 6372736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 6, product* 4 * 6 * 8 * 2 * 7 * 3 * 6, index + 6372864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 6, product* 2 * 9 * 9 * 2 * 7 * 3 * 6, index + 6372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 6, product* 8 * 4 * 2 * 3 * 7 * 3 * 6, index + 6373248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 6, product* 6 * 7 * 3 * 3 * 7 * 3 * 6, index + 6373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 6, product* 2 * 3 * 6 * 3 * 7 * 3 * 6, index + 6373632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 6, product* 2 * 7 * 2 * 4 * 7 * 3 * 6, index + 6374272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 3 + 6, product* 4 * 8 * 7 * 4 * 7 * 3 * 6, index + 6374784);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 6, product* 8 * 4 * 4 * 6 * 7 * 3 * 6, index + 6376448);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 6, product* 4 * 4 * 3 * 7 * 7 * 3 * 6, index + 6377344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 6, product* 2 * 7 * 4 * 7 * 7 * 3 * 6, index + 6377472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 6, product* 8 * 2 * 7 * 7 * 7 * 3 * 6, index + 6377728);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3 + 6, product* 6 * 9 * 4 * 8 * 7 * 3 * 6, index + 6378496);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 6, product* 4 * 6 * 2 * 9 * 7 * 3 * 6, index + 6379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 6, product* 6 * 3 * 3 * 2 * 8 * 3 * 6, index + 6382336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 6, product* 4 * 6 * 4 * 2 * 8 * 3 * 6, index + 6382464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3 + 6, product* 8 * 4 * 8 * 2 * 8 * 3 * 6, index + 6382848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 6, product* 2 * 3 * 2 * 3 * 8 * 3 * 6, index + 6383232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 3 + 6, product* 4 * 4 * 7 * 3 * 8 * 3 * 6, index + 6383744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 6, product* 2 * 7 * 8 * 3 * 8 * 3 * 6, index + 6383872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 6, product* 4 * 8 * 3 * 4 * 8 * 3 * 6, index + 6384384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 6, product* 2 * 3 * 4 * 6 * 8 * 3 * 6, index + 6386432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3 + 6, product* 4 * 4 * 9 * 6 * 8 * 3 * 6, index + 6386944);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 8 + 3 + 6, product* 6 * 3 * 7 * 8 * 8 * 3 * 6, index + 6388736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 3 + 6, product* 4 * 6 * 8 * 8 * 8 * 3 * 6, index + 6388864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 3 + 6, product* 2 * 9 * 9 * 8 * 8 * 3 * 6, index + 6388992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 3 + 6, product* 8 * 4 * 2 * 9 * 8 * 3 * 6, index + 6389248);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 6, product* 8 * 4 * 4 * 2 * 9 * 3 * 6, index + 6392448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 6, product* 2 * 3 * 8 * 2 * 9 * 3 * 6, index + 6392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 6, product* 4 * 4 * 3 * 3 * 9 * 3 * 6, index + 6393344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 6, product* 2 * 7 * 4 * 3 * 9 * 3 * 6, index + 6393472);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9 + 3 + 6, product* 8 * 6 * 3 * 4 * 9 * 3 * 6, index + 6394368);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 6, product* 2 * 7 * 6 * 6 * 9 * 3 * 6, index + 6396672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 6, product* 2 * 3 * 2 * 9 * 9 * 3 * 6, index + 6399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 6, product* 2 * 7 * 2 * 2 * 2 * 4 * 6, index + 6422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 6, product* 4 * 8 * 7 * 2 * 2 * 4 * 6, index + 6422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 6, product* 6 * 9 * 2 * 3 * 2 * 4 * 6, index + 6423296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 6, product* 4 * 2 * 4 * 3 * 2 * 4 * 6, index + 6423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 6, product* 6 * 3 * 9 * 3 * 2 * 4 * 6, index + 6423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 6, product* 8 * 4 * 4 * 4 * 2 * 4 * 6, index + 6424448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 6, product* 2 * 3 * 8 * 4 * 2 * 4 * 6, index + 6424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 6, product* 8 * 6 * 3 * 6 * 2 * 4 * 6, index + 6426368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 6, product* 4 * 2 * 6 * 6 * 2 * 4 * 6, index + 6426624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 6, product* 4 * 6 * 2 * 7 * 2 * 4 * 6, index + 6427264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 6, product* 2 * 9 * 3 * 7 * 2 * 4 * 6, index + 6427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 6, product* 8 * 4 * 6 * 7 * 2 * 4 * 6, index + 6427648);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 6, product* 8 * 8 * 2 * 8 * 2 * 4 * 6, index + 6428288);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 6, product* 2 * 7 * 6 * 8 * 2 * 4 * 6, index + 6428672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 4 + 6, product* 8 * 2 * 9 * 8 * 2 * 4 * 6, index + 6428928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 6, product* 4 * 2 * 8 * 9 * 2 * 4 * 6, index + 6429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 6, product* 4 * 8 * 3 * 2 * 3 * 4 * 6, index + 6432384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 6, product* 8 * 6 * 7 * 2 * 3 * 4 * 6, index + 6432768);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 6, product* 4 * 6 * 6 * 3 * 3 * 4 * 6, index + 6433664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 6, product* 2 * 9 * 7 * 3 * 3 * 4 * 6, index + 6433792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 6, product* 2 * 3 * 4 * 4 * 3 * 4 * 6, index + 6434432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 4 + 6, product* 8 * 8 * 6 * 4 * 3 * 4 * 6, index + 6434688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 6, product* 4 * 2 * 2 * 6 * 3 * 4 * 6, index + 6436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 6, product* 6 * 3 * 7 * 6 * 3 * 4 * 6, index + 6436736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 6, product* 4 * 6 * 8 * 6 * 3 * 4 * 6, index + 6436864);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 6, product* 8 * 4 * 2 * 7 * 3 * 4 * 6, index + 6437248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 6, product* 2 * 3 * 6 * 7 * 3 * 4 * 6, index + 6437632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 6, product* 2 * 7 * 2 * 8 * 3 * 4 * 6, index + 6438272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 6, product* 4 * 2 * 4 * 9 * 3 * 4 * 6, index + 6439424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 6, product* 8 * 6 * 3 * 2 * 4 * 4 * 6, index + 6442368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 4 + 6, product* 6 * 9 * 4 * 2 * 4 * 4 * 6, index + 6442496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 6, product* 4 * 2 * 6 * 2 * 4 * 4 * 6, index + 6442624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 6, product* 4 * 6 * 2 * 3 * 4 * 4 * 6, index + 6443264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 6, product* 2 * 9 * 3 * 3 * 4 * 4 * 6, index + 6443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 6, product* 8 * 4 * 6 * 3 * 4 * 4 * 6, index + 6443648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 6, product* 6 * 7 * 7 * 3 * 4 * 4 * 6, index + 6443776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 6, product* 8 * 8 * 2 * 4 * 4 * 4 * 6, index + 6444288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 6, product* 2 * 7 * 6 * 4 * 4 * 4 * 6, index + 6444672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 6, product* 6 * 3 * 3 * 6 * 4 * 4 * 6, index + 6446336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 6, product* 4 * 6 * 4 * 6 * 4 * 4 * 6, index + 6446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 6, product* 2 * 3 * 2 * 7 * 4 * 4 * 6, index + 6447232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 4 + 6, product* 4 * 8 * 3 * 8 * 4 * 4 * 6, index + 6448384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 6, product* 4 * 6 * 6 * 9 * 4 * 4 * 6, index + 6449664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 6, product* 6 * 3 * 3 * 2 * 6 * 4 * 6, index + 6462336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 6, product* 4 * 6 * 4 * 2 * 6 * 4 * 6, index + 6462464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 6, product* 8 * 4 * 8 * 2 * 6 * 4 * 6, index + 6462848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 4 + 6, product* 6 * 7 * 9 * 2 * 6 * 4 * 6, index + 6462976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 6, product* 2 * 3 * 2 * 3 * 6 * 4 * 6, index + 6463232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 4 + 6, product* 8 * 8 * 4 * 3 * 6 * 4 * 6, index + 6463488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 6, product* 4 * 4 * 7 * 3 * 6 * 4 * 6, index + 6463744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 6, product* 2 * 7 * 8 * 3 * 6 * 4 * 6, index + 6463872);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 4 + 6, product* 8 * 6 * 7 * 4 * 6 * 4 * 6, index + 6464768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 6, product* 2 * 3 * 4 * 6 * 6 * 4 * 6, index + 6466432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 6, product* 4 * 2 * 2 * 8 * 6 * 4 * 6, index + 6468224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 6, product* 8 * 4 * 2 * 9 * 6 * 4 * 6, index + 6469248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 6, product* 2 * 3 * 6 * 9 * 6 * 4 * 6, index + 6469632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 6, product* 8 * 4 * 4 * 2 * 7 * 4 * 6, index + 6472448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 6, product* 2 * 3 * 8 * 2 * 7 * 4 * 6, index + 6472832);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 6, product* 2 * 7 * 4 * 3 * 7 * 4 * 6, index + 6473472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 6, product* 8 * 2 * 7 * 3 * 7 * 4 * 6, index + 6473728);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 4 + 6, product* 6 * 9 * 6 * 7 * 7 * 4 * 6, index + 6477696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 6, product* 4 * 2 * 8 * 7 * 7 * 4 * 6, index + 6477824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 6, product* 6 * 3 * 3 * 8 * 7 * 4 * 6, index + 6478336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 6, product* 2 * 3 * 4 * 2 * 8 * 4 * 6, index + 6482432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 4 + 6, product* 8 * 8 * 6 * 2 * 8 * 4 * 6, index + 6482688);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 6, product* 8 * 2 * 3 * 3 * 8 * 4 * 6, index + 6483328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 6, product* 4 * 2 * 2 * 4 * 8 * 4 * 6, index + 6484224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 4 + 6, product* 6 * 3 * 7 * 4 * 8 * 4 * 6, index + 6484736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 6, product* 2 * 7 * 2 * 6 * 8 * 4 * 6, index + 6486272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 6, product* 4 * 2 * 4 * 7 * 8 * 4 * 6, index + 6487424);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 4 + 6, product* 2 * 3 * 8 * 8 * 8 * 4 * 6, index + 6488832);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 6, product* 2 * 7 * 4 * 9 * 8 * 4 * 6, index + 6489472);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 6, product* 2 * 7 * 6 * 2 * 9 * 4 * 6, index + 6492672);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 4 + 6, product* 2 * 3 * 4 * 8 * 9 * 4 * 6, index + 6498432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 4 + 6, product* 8 * 2 * 3 * 9 * 9 * 4 * 6, index + 6499328);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 6, product* 6 * 3 * 3 * 2 * 2 * 6 * 6, index + 6622336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 6, product* 4 * 6 * 4 * 2 * 2 * 6 * 6, index + 6622464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 6, product* 8 * 4 * 8 * 2 * 2 * 6 * 6, index + 6622848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 6, product* 6 * 7 * 9 * 2 * 2 * 6 * 6, index + 6622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 6, product* 2 * 3 * 2 * 3 * 2 * 6 * 6, index + 6623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 6, product* 4 * 4 * 7 * 3 * 2 * 6 * 6, index + 6623744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 6, product* 2 * 7 * 8 * 3 * 2 * 6 * 6, index + 6623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 6, product* 4 * 8 * 3 * 4 * 2 * 6 * 6, index + 6624384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 6, product* 6 * 9 * 8 * 4 * 2 * 6 * 6, index + 6624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 6, product* 2 * 3 * 4 * 6 * 2 * 6 * 6, index + 6626432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 6 + 6, product* 4 * 4 * 9 * 6 * 2 * 6 * 6, index + 6626944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 6, product* 8 * 2 * 3 * 7 * 2 * 6 * 6, index + 6627328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 6 + 6, product* 8 * 6 * 9 * 7 * 2 * 6 * 6, index + 6627968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 6, product* 4 * 2 * 2 * 8 * 2 * 6 * 6, index + 6628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 6, product* 6 * 3 * 7 * 8 * 2 * 6 * 6, index + 6628736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 6 + 6, product* 4 * 6 * 8 * 8 * 2 * 6 * 6, index + 6628864);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 6 + 6, product* 2 * 9 * 9 * 8 * 2 * 6 * 6, index + 6628992);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 6, product* 6 * 7 * 3 * 9 * 2 * 6 * 6, index + 6629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 6, product* 2 * 3 * 6 * 9 * 2 * 6 * 6, index + 6629632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 6, product* 2 * 3 * 8 * 2 * 3 * 6 * 6, index + 6632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 6, product* 4 * 4 * 3 * 3 * 3 * 6 * 6, index + 6633344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 6, product* 2 * 7 * 4 * 3 * 3 * 6 * 6, index + 6633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 6, product* 8 * 2 * 7 * 3 * 3 * 6 * 6, index + 6633728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 6, product* 4 * 8 * 9 * 3 * 3 * 6 * 6, index + 6633984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 6, product* 6 * 9 * 4 * 4 * 3 * 6 * 6, index + 6634496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 6, product* 4 * 2 * 6 * 4 * 3 * 6 * 6, index + 6634624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 6, product* 8 * 8 * 2 * 6 * 3 * 6 * 6, index + 6636288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 6, product* 4 * 2 * 8 * 7 * 3 * 6 * 6, index + 6637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 6, product* 6 * 3 * 3 * 8 * 3 * 6 * 6, index + 6638336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 6, product* 2 * 3 * 2 * 9 * 3 * 6 * 6, index + 6639232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 6, product* 2 * 3 * 4 * 2 * 4 * 6 * 6, index + 6642432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 6, product* 4 * 4 * 9 * 2 * 4 * 6 * 6, index + 6642944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 6, product* 8 * 2 * 3 * 3 * 4 * 6 * 6, index + 6643328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 6, product* 4 * 2 * 2 * 4 * 4 * 6 * 6, index + 6644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 6, product* 2 * 7 * 2 * 6 * 4 * 6 * 6, index + 6646272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 6, product* 4 * 2 * 4 * 7 * 4 * 6 * 6, index + 6647424);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 6, product* 2 * 3 * 8 * 8 * 4 * 6 * 6, index + 6648832);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 6, product* 2 * 7 * 4 * 9 * 4 * 6 * 6, index + 6649472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 6, product* 2 * 7 * 2 * 2 * 6 * 6 * 6, index + 6662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 6, product* 4 * 8 * 7 * 2 * 6 * 6 * 6, index + 6662784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 6, product* 6 * 9 * 2 * 3 * 6 * 6 * 6, index + 6663296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 6, product* 4 * 2 * 4 * 3 * 6 * 6 * 6, index + 6663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 6, product* 6 * 3 * 9 * 3 * 6 * 6 * 6, index + 6663936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 6, product* 8 * 4 * 4 * 4 * 6 * 6 * 6, index + 6664448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 6, product* 2 * 3 * 8 * 4 * 6 * 6 * 6, index + 6664832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 6, product* 4 * 2 * 6 * 6 * 6 * 6 * 6, index + 6666624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 6 + 6, product* 4 * 6 * 2 * 7 * 6 * 6 * 6, index + 6667264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 6, product* 2 * 9 * 3 * 7 * 6 * 6 * 6, index + 6667392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 6 + 6, product* 2 * 7 * 6 * 8 * 6 * 6 * 6, index + 6668672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 6 + 6, product* 8 * 2 * 9 * 8 * 6 * 6 * 6, index + 6668928);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 6, product* 4 * 8 * 3 * 2 * 7 * 6 * 6, index + 6672384);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 6 + 6, product* 2 * 9 * 7 * 3 * 7 * 6 * 6, index + 6673792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 6, product* 2 * 3 * 4 * 4 * 7 * 6 * 6, index + 6674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 6, product* 4 * 2 * 2 * 6 * 7 * 6 * 6, index + 6676224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6 + 6, product* 8 * 4 * 2 * 7 * 7 * 6 * 6, index + 6677248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 6, product* 2 * 3 * 6 * 7 * 7 * 6 * 6, index + 6677632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 6, product* 2 * 7 * 2 * 8 * 7 * 6 * 6, index + 6678272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 6 + 6, product* 4 * 8 * 7 * 8 * 7 * 6 * 6, index + 6678784);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 6, product* 4 * 2 * 6 * 2 * 8 * 6 * 6, index + 6682624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 6, product* 4 * 6 * 2 * 3 * 8 * 6 * 6, index + 6683264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 6 + 6, product* 8 * 8 * 2 * 4 * 8 * 6 * 6, index + 6684288);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 6 + 6, product* 4 * 6 * 6 * 9 * 8 * 6 * 6, index + 6689664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 6, product* 4 * 2 * 2 * 2 * 9 * 6 * 6, index + 6692224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 6 + 6, product* 6 * 3 * 7 * 2 * 9 * 6 * 6, index + 6692736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 6, product* 8 * 4 * 2 * 3 * 9 * 6 * 6, index + 6693248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6 + 6, product* 6 * 7 * 3 * 3 * 9 * 6 * 6, index + 6693376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 6, product* 2 * 3 * 6 * 3 * 9 * 6 * 6, index + 6693632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 6, product* 2 * 7 * 2 * 4 * 9 * 6 * 6, index + 6694272);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9 + 6 + 6, product* 8 * 4 * 4 * 6 * 9 * 6 * 6, index + 6696448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 6, product* 2 * 3 * 8 * 6 * 9 * 6 * 6, index + 6696832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 6 + 6, product* 2 * 9 * 3 * 9 * 9 * 6 * 6, index + 6699392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 6, product* 2 * 3 * 4 * 2 * 2 * 7 * 6, index + 6722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 6, product* 4 * 4 * 9 * 2 * 2 * 7 * 6, index + 6722944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 6, product* 8 * 2 * 3 * 3 * 2 * 7 * 6, index + 6723328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 6, product* 4 * 2 * 2 * 4 * 2 * 7 * 6, index + 6724224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7 + 6, product* 6 * 3 * 7 * 4 * 2 * 7 * 6, index + 6724736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 6, product* 4 * 6 * 8 * 4 * 2 * 7 * 6, index + 6724864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 6, product* 2 * 7 * 2 * 6 * 2 * 7 * 6, index + 6726272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7 + 6, product* 4 * 8 * 7 * 6 * 2 * 7 * 6, index + 6726784);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 6, product* 4 * 2 * 4 * 7 * 2 * 7 * 6, index + 6727424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 6, product* 8 * 4 * 4 * 8 * 2 * 7 * 6, index + 6728448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 6, product* 2 * 3 * 8 * 8 * 2 * 7 * 6, index + 6728832);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 6, product* 2 * 7 * 4 * 9 * 2 * 7 * 6, index + 6729472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 6, product* 8 * 2 * 7 * 9 * 2 * 7 * 6, index + 6729728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7 + 6, product* 8 * 8 * 2 * 2 * 3 * 7 * 6, index + 6732288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 6, product* 2 * 7 * 6 * 2 * 3 * 7 * 6, index + 6732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 6, product* 8 * 2 * 9 * 2 * 3 * 7 * 6, index + 6732928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 6, product* 4 * 2 * 8 * 3 * 3 * 7 * 6, index + 6733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 6, product* 6 * 3 * 3 * 4 * 3 * 7 * 6, index + 6734336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 6, product* 4 * 6 * 4 * 4 * 3 * 7 * 6, index + 6734464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 6, product* 4 * 8 * 3 * 6 * 3 * 7 * 6, index + 6736384);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 7 + 6, product* 6 * 9 * 8 * 6 * 3 * 7 * 6, index + 6736896);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 6, product* 2 * 3 * 4 * 8 * 3 * 7 * 6, index + 6738432);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 7 + 6, product* 8 * 8 * 6 * 8 * 3 * 7 * 6, index + 6738688);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 6, product* 2 * 7 * 2 * 2 * 4 * 7 * 6, index + 6742272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7 + 6, product* 4 * 8 * 7 * 2 * 4 * 7 * 6, index + 6742784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7 + 6, product* 6 * 9 * 2 * 3 * 4 * 7 * 6, index + 6743296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 6, product* 4 * 2 * 4 * 3 * 4 * 7 * 6, index + 6743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 6, product* 6 * 3 * 9 * 3 * 4 * 7 * 6, index + 6743936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 6, product* 2 * 3 * 8 * 4 * 4 * 7 * 6, index + 6744832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 7 + 6, product* 8 * 6 * 3 * 6 * 4 * 7 * 6, index + 6746368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 6, product* 4 * 2 * 6 * 6 * 4 * 7 * 6, index + 6746624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 6, product* 2 * 9 * 3 * 7 * 4 * 7 * 6, index + 6747392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 6, product* 2 * 7 * 6 * 8 * 4 * 7 * 6, index + 6748672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 7 + 6, product* 4 * 2 * 8 * 9 * 4 * 7 * 6, index + 6749824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7 + 6, product* 8 * 6 * 3 * 2 * 6 * 7 * 6, index + 6762368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 6, product* 4 * 2 * 6 * 2 * 6 * 7 * 6, index + 6762624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 6, product* 4 * 6 * 2 * 3 * 6 * 7 * 6, index + 6763264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 6, product* 2 * 9 * 3 * 3 * 6 * 7 * 6, index + 6763392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 7 + 6, product* 6 * 7 * 7 * 3 * 6 * 7 * 6, index + 6763776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 7 + 6, product* 8 * 8 * 2 * 4 * 6 * 7 * 6, index + 6764288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 6, product* 6 * 3 * 3 * 6 * 6 * 7 * 6, index + 6766336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 6, product* 2 * 3 * 2 * 7 * 6 * 7 * 6, index + 6767232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 6, product* 4 * 2 * 2 * 2 * 7 * 7 * 6, index + 6772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 6, product* 6 * 3 * 7 * 2 * 7 * 7 * 6, index + 6772736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 7 + 6, product* 2 * 9 * 9 * 2 * 7 * 7 * 6, index + 6772992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 6, product* 8 * 4 * 2 * 3 * 7 * 7 * 6, index + 6773248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 6, product* 2 * 7 * 2 * 4 * 7 * 7 * 6, index + 6774272);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7 + 6, product* 8 * 4 * 4 * 6 * 7 * 7 * 6, index + 6776448);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 6, product* 2 * 3 * 8 * 6 * 7 * 7 * 6, index + 6776832);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 7 + 6, product* 2 * 7 * 4 * 7 * 7 * 7 * 6, index + 6777472);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 7 + 6, product* 4 * 2 * 6 * 8 * 7 * 7 * 6, index + 6778624);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 7 + 7 + 6, product* 8 * 4 * 6 * 9 * 7 * 7 * 6, index + 6779648);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7 + 6, product* 4 * 6 * 4 * 2 * 8 * 7 * 6, index + 6782464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 6, product* 2 * 3 * 2 * 3 * 8 * 7 * 6, index + 6783232);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 7 + 6, product* 4 * 8 * 3 * 4 * 8 * 7 * 6, index + 6784384);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 6, product* 8 * 2 * 3 * 7 * 8 * 7 * 6, index + 6787328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 6, product* 4 * 2 * 2 * 8 * 8 * 7 * 6, index + 6788224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 7 + 6, product* 4 * 6 * 8 * 8 * 8 * 7 * 6, index + 6788864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 7 + 6, product* 2 * 3 * 6 * 9 * 8 * 7 * 6, index + 6789632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 6, product* 2 * 3 * 8 * 2 * 9 * 7 * 6, index + 6792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 6, product* 4 * 4 * 3 * 3 * 9 * 7 * 6, index + 6793344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 6, product* 2 * 7 * 4 * 3 * 9 * 7 * 6, index + 6793472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 7 + 6, product* 8 * 2 * 7 * 3 * 9 * 7 * 6, index + 6793728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 7 + 6, product* 4 * 2 * 8 * 7 * 9 * 7 * 6, index + 6797824);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 6, product* 2 * 3 * 2 * 9 * 9 * 7 * 6, index + 6799232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 7 + 6, product* 4 * 4 * 7 * 9 * 9 * 7 * 6, index + 6799744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 6, product* 2 * 7 * 2 * 2 * 2 * 8 * 6, index + 6822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 6, product* 4 * 8 * 7 * 2 * 2 * 8 * 6, index + 6822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 6, product* 6 * 9 * 2 * 3 * 2 * 8 * 6, index + 6823296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 6, product* 4 * 2 * 4 * 3 * 2 * 8 * 6, index + 6823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 6, product* 6 * 3 * 9 * 3 * 2 * 8 * 6, index + 6823936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 6, product* 8 * 4 * 4 * 4 * 2 * 8 * 6, index + 6824448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 6, product* 4 * 6 * 2 * 7 * 2 * 8 * 6, index + 6827264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 6, product* 2 * 9 * 3 * 7 * 2 * 8 * 6, index + 6827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 6, product* 8 * 4 * 6 * 7 * 2 * 8 * 6, index + 6827648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 8 + 6, product* 2 * 7 * 6 * 8 * 2 * 8 * 6, index + 6828672);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 6, product* 4 * 8 * 3 * 2 * 3 * 8 * 6, index + 6832384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 8 + 6, product* 6 * 9 * 8 * 2 * 3 * 8 * 6, index + 6832896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8 + 6, product* 4 * 6 * 6 * 3 * 3 * 8 * 6, index + 6833664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 6, product* 2 * 9 * 7 * 3 * 3 * 8 * 6, index + 6833792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 6, product* 2 * 3 * 4 * 4 * 3 * 8 * 6, index + 6834432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 8 + 6, product* 4 * 4 * 9 * 4 * 3 * 8 * 6, index + 6834944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 6, product* 4 * 2 * 2 * 6 * 3 * 8 * 6, index + 6836224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8 + 6, product* 6 * 3 * 7 * 6 * 3 * 8 * 6, index + 6836736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 8 + 6, product* 8 * 4 * 2 * 7 * 3 * 8 * 6, index + 6837248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 6, product* 2 * 7 * 2 * 8 * 3 * 8 * 6, index + 6838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 6, product* 6 * 9 * 2 * 9 * 3 * 8 * 6, index + 6839296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 6, product* 4 * 2 * 6 * 2 * 4 * 8 * 6, index + 6842624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 6, product* 4 * 6 * 2 * 3 * 4 * 8 * 6, index + 6843264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 6, product* 2 * 9 * 3 * 3 * 4 * 8 * 6, index + 6843392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 6, product* 8 * 8 * 2 * 4 * 4 * 8 * 6, index + 6844288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 6, product* 2 * 7 * 6 * 4 * 4 * 8 * 6, index + 6844672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 8 + 6, product* 8 * 2 * 9 * 4 * 4 * 8 * 6, index + 6844928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8 + 6, product* 4 * 6 * 4 * 6 * 4 * 8 * 6, index + 6846464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 6, product* 2 * 3 * 2 * 7 * 4 * 8 * 6, index + 6847232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8 + 6, product* 4 * 4 * 7 * 7 * 4 * 8 * 6, index + 6847744);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 8 + 6, product* 4 * 6 * 6 * 9 * 4 * 8 * 6, index + 6849664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 6, product* 6 * 3 * 3 * 2 * 6 * 8 * 6, index + 6862336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 6, product* 4 * 6 * 4 * 2 * 6 * 8 * 6, index + 6862464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 8 + 6, product* 6 * 7 * 9 * 2 * 6 * 8 * 6, index + 6862976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 6, product* 2 * 3 * 2 * 3 * 6 * 8 * 6, index + 6863232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8 + 6, product* 4 * 4 * 7 * 3 * 6 * 8 * 6, index + 6863744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 6, product* 2 * 7 * 8 * 3 * 6 * 8 * 6, index + 6863872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 6, product* 2 * 3 * 4 * 6 * 6 * 8 * 6, index + 6866432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 8 + 6, product* 8 * 8 * 6 * 6 * 6 * 8 * 6, index + 6866688);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 6, product* 4 * 2 * 2 * 8 * 6 * 8 * 6, index + 6868224);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 8 + 6, product* 6 * 7 * 3 * 9 * 6 * 8 * 6, index + 6869376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 6, product* 2 * 3 * 6 * 9 * 6 * 8 * 6, index + 6869632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 6, product* 2 * 3 * 8 * 2 * 7 * 8 * 6, index + 6872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 6, product* 4 * 4 * 3 * 3 * 7 * 8 * 6, index + 6873344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 6, product* 4 * 2 * 6 * 4 * 7 * 8 * 6, index + 6874624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 8 + 6, product* 2 * 7 * 6 * 6 * 7 * 8 * 6, index + 6876672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 8 + 6, product* 8 * 2 * 9 * 6 * 7 * 8 * 6, index + 6876928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 6, product* 2 * 3 * 2 * 9 * 7 * 8 * 6, index + 6879232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 6, product* 2 * 3 * 4 * 2 * 8 * 8 * 6, index + 6882432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 6, product* 8 * 2 * 3 * 3 * 8 * 8 * 6, index + 6883328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 6, product* 4 * 2 * 2 * 4 * 8 * 8 * 6, index + 6884224);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 8 + 6, product* 2 * 7 * 4 * 9 * 8 * 8 * 6, index + 6889472);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 8 + 6, product* 2 * 7 * 6 * 2 * 9 * 8 * 6, index + 6892672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 8 + 6, product* 4 * 6 * 4 * 4 * 9 * 8 * 6, index + 6894464);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 8 + 6, product* 2 * 3 * 4 * 8 * 9 * 8 * 6, index + 6898432);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 6, product* 8 * 6 * 3 * 2 * 2 * 9 * 6, index + 6922368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 6, product* 6 * 9 * 4 * 2 * 2 * 9 * 6, index + 6922496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 6, product* 4 * 2 * 6 * 2 * 2 * 9 * 6, index + 6922624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 6, product* 4 * 6 * 2 * 3 * 2 * 9 * 6, index + 6923264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 6, product* 2 * 9 * 3 * 3 * 2 * 9 * 6, index + 6923392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9 + 6, product* 8 * 8 * 2 * 4 * 2 * 9 * 6, index + 6924288);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9 + 6, product* 8 * 2 * 9 * 4 * 2 * 9 * 6, index + 6924928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 6, product* 6 * 3 * 3 * 6 * 2 * 9 * 6, index + 6926336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 9 + 6, product* 4 * 6 * 4 * 6 * 2 * 9 * 6, index + 6926464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 6, product* 2 * 3 * 2 * 7 * 2 * 9 * 6, index + 6927232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 9 + 6, product* 8 * 8 * 4 * 7 * 2 * 9 * 6, index + 6927488);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 9 + 6, product* 4 * 6 * 6 * 9 * 2 * 9 * 6, index + 6929664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 6, product* 4 * 2 * 2 * 2 * 3 * 9 * 6, index + 6932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 6, product* 6 * 3 * 7 * 2 * 3 * 9 * 6, index + 6932736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 6, product* 8 * 4 * 2 * 3 * 3 * 9 * 6, index + 6933248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 6, product* 2 * 3 * 6 * 3 * 3 * 9 * 6, index + 6933632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 6, product* 2 * 7 * 2 * 4 * 3 * 9 * 6, index + 6934272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 6, product* 2 * 3 * 8 * 6 * 3 * 9 * 6, index + 6936832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9 + 6, product* 4 * 4 * 3 * 7 * 3 * 9 * 6, index + 6937344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 9 + 6, product* 8 * 6 * 3 * 8 * 3 * 9 * 6, index + 6938368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 9 + 6, product* 4 * 2 * 6 * 8 * 3 * 9 * 6, index + 6938624);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 9 + 6, product* 8 * 4 * 6 * 9 * 3 * 9 * 6, index + 6939648);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 6, product* 6 * 3 * 3 * 2 * 4 * 9 * 6, index + 6942336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 6, product* 4 * 6 * 4 * 2 * 4 * 9 * 6, index + 6942464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 6, product* 2 * 3 * 2 * 3 * 4 * 9 * 6, index + 6943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 6, product* 4 * 4 * 7 * 3 * 4 * 9 * 6, index + 6943744);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 6, product* 4 * 8 * 3 * 4 * 4 * 9 * 6, index + 6944384);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 6, product* 8 * 2 * 3 * 7 * 4 * 9 * 6, index + 6947328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 6, product* 4 * 2 * 2 * 8 * 4 * 9 * 6, index + 6948224);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 6, product* 2 * 3 * 6 * 9 * 4 * 9 * 6, index + 6949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 6, product* 2 * 3 * 4 * 2 * 6 * 9 * 6, index + 6962432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9 + 6, product* 8 * 2 * 3 * 3 * 6 * 9 * 6, index + 6963328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 6, product* 4 * 2 * 2 * 4 * 6 * 9 * 6, index + 6964224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 9 + 6, product* 4 * 6 * 8 * 4 * 6 * 9 * 6, index + 6964864);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 9 + 6, product* 2 * 7 * 4 * 9 * 6 * 9 * 6, index + 6969472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 6, product* 2 * 7 * 2 * 2 * 8 * 9 * 6, index + 6982272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 6, product* 4 * 2 * 4 * 3 * 8 * 9 * 6, index + 6983424);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 9 + 6, product* 2 * 3 * 8 * 4 * 8 * 9 * 6, index + 6984832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 9 + 6, product* 2 * 7 * 6 * 8 * 8 * 9 * 6, index + 6988672);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 6, product* 4 * 8 * 3 * 2 * 9 * 9 * 6, index + 6992384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9 + 6, product* 2 * 3 * 4 * 4 * 9 * 9 * 6, index + 6994432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9 + 9 + 6, product* 4 * 4 * 9 * 4 * 9 * 9 * 6, index + 6994944);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9 + 9 + 6, product* 8 * 4 * 2 * 7 * 9 * 9 * 6, index + 6997248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 9 + 6, product* 2 * 3 * 6 * 7 * 9 * 9 * 6, index + 6997632);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 7, product* 2 * 7 * 2 * 2 * 2 * 2 * 7, index + 7222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 7, product* 4 * 8 * 7 * 2 * 2 * 2 * 7, index + 7222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 7, product* 6 * 9 * 2 * 3 * 2 * 2 * 7, index + 7223296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 7, product* 4 * 2 * 4 * 3 * 2 * 2 * 7, index + 7223424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 7, product* 8 * 4 * 4 * 4 * 2 * 2 * 7, index + 7224448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 7, product* 2 * 3 * 8 * 4 * 2 * 2 * 7, index + 7224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 7, product* 8 * 6 * 3 * 6 * 2 * 2 * 7, index + 7226368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 2 + 7, product* 6 * 9 * 4 * 6 * 2 * 2 * 7, index + 7226496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 7, product* 4 * 2 * 6 * 6 * 2 * 2 * 7, index + 7226624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 7, product* 4 * 6 * 2 * 7 * 2 * 2 * 7, index + 7227264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 7, product* 2 * 9 * 3 * 7 * 2 * 2 * 7, index + 7227392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2 + 7, product* 8 * 4 * 6 * 7 * 2 * 2 * 7, index + 7227648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2 + 7, product* 2 * 7 * 6 * 8 * 2 * 2 * 7, index + 7228672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 7, product* 8 * 2 * 9 * 8 * 2 * 2 * 7, index + 7228928);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 2 + 7, product* 6 * 9 * 6 * 9 * 2 * 2 * 7, index + 7229696);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 7, product* 4 * 8 * 3 * 2 * 3 * 2 * 7, index + 7232384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 7, product* 8 * 6 * 7 * 2 * 3 * 2 * 7, index + 7232768);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 7, product* 4 * 6 * 6 * 3 * 3 * 2 * 7, index + 7233664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 7, product* 2 * 9 * 7 * 3 * 3 * 2 * 7, index + 7233792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 7, product* 2 * 3 * 4 * 4 * 3 * 2 * 7, index + 7234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 7, product* 4 * 4 * 9 * 4 * 3 * 2 * 7, index + 7234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 7, product* 4 * 2 * 2 * 6 * 3 * 2 * 7, index + 7236224);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 7, product* 4 * 6 * 8 * 6 * 3 * 2 * 7, index + 7236864);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 2 + 7, product* 2 * 9 * 9 * 6 * 3 * 2 * 7, index + 7236992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 7, product* 8 * 4 * 2 * 7 * 3 * 2 * 7, index + 7237248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 7, product* 6 * 7 * 3 * 7 * 3 * 2 * 7, index + 7237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 7, product* 2 * 3 * 6 * 7 * 3 * 2 * 7, index + 7237632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 7, product* 2 * 7 * 2 * 8 * 3 * 2 * 7, index + 7238272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 7, product* 4 * 2 * 4 * 9 * 3 * 2 * 7, index + 7239424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 7, product* 6 * 3 * 9 * 9 * 3 * 2 * 7, index + 7239936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 7, product* 8 * 6 * 3 * 2 * 4 * 2 * 7, index + 7242368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 7, product* 6 * 9 * 4 * 2 * 4 * 2 * 7, index + 7242496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 7, product* 4 * 2 * 6 * 2 * 4 * 2 * 7, index + 7242624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 7, product* 4 * 6 * 2 * 3 * 4 * 2 * 7, index + 7243264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 7, product* 2 * 9 * 3 * 3 * 4 * 2 * 7, index + 7243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 7, product* 8 * 4 * 6 * 3 * 4 * 2 * 7, index + 7243648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 7, product* 6 * 7 * 7 * 3 * 4 * 2 * 7, index + 7243776);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 7, product* 6 * 3 * 3 * 6 * 4 * 2 * 7, index + 7246336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 2 + 7, product* 8 * 4 * 8 * 6 * 4 * 2 * 7, index + 7246848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 7, product* 2 * 3 * 2 * 7 * 4 * 2 * 7, index + 7247232);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 2 + 7, product* 2 * 7 * 8 * 7 * 4 * 2 * 7, index + 7247872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 7, product* 4 * 8 * 3 * 8 * 4 * 2 * 7, index + 7248384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4 + 2 + 7, product* 6 * 9 * 8 * 8 * 4 * 2 * 7, index + 7248896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 2 + 7, product* 4 * 6 * 6 * 9 * 4 * 2 * 7, index + 7249664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 7, product* 6 * 3 * 3 * 2 * 6 * 2 * 7, index + 7262336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 7, product* 4 * 6 * 4 * 2 * 6 * 2 * 7, index + 7262464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 7, product* 8 * 4 * 8 * 2 * 6 * 2 * 7, index + 7262848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 7, product* 2 * 3 * 2 * 3 * 6 * 2 * 7, index + 7263232);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 2 + 7, product* 2 * 9 * 3 * 3 * 6 * 2 * 7, index + 7263392);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 7, product* 8 * 8 * 4 * 3 * 6 * 2 * 7, index + 7263488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 2 + 7, product* 4 * 4 * 7 * 3 * 6 * 2 * 7, index + 7263744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 7, product* 2 * 7 * 8 * 3 * 6 * 2 * 7, index + 7263872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 7, product* 4 * 8 * 3 * 4 * 6 * 2 * 7, index + 7264384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6 + 2 + 7, product* 6 * 9 * 8 * 4 * 6 * 2 * 7, index + 7264896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 7, product* 2 * 3 * 4 * 6 * 6 * 2 * 7, index + 7266432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 7, product* 8 * 2 * 3 * 7 * 6 * 2 * 7, index + 7267328);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 6 + 2 + 7, product* 8 * 6 * 9 * 7 * 6 * 2 * 7, index + 7267968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 7, product* 4 * 2 * 2 * 8 * 6 * 2 * 7, index + 7268224);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2 + 7, product* 2 * 3 * 6 * 9 * 6 * 2 * 7, index + 7269632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 7, product* 8 * 4 * 4 * 2 * 7 * 2 * 7, index + 7272448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 7, product* 2 * 3 * 8 * 2 * 7 * 2 * 7, index + 7272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 7, product* 4 * 4 * 3 * 3 * 7 * 2 * 7, index + 7273344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 7, product* 2 * 7 * 4 * 3 * 7 * 2 * 7, index + 7273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 7, product* 8 * 2 * 7 * 3 * 7 * 2 * 7, index + 7273728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 7, product* 4 * 8 * 9 * 3 * 7 * 2 * 7, index + 7273984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 7, product* 8 * 6 * 3 * 4 * 7 * 2 * 7, index + 7274368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2 + 7, product* 6 * 9 * 4 * 4 * 7 * 2 * 7, index + 7274496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 7, product* 4 * 2 * 6 * 4 * 7 * 2 * 7, index + 7274624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 7, product* 2 * 7 * 6 * 6 * 7 * 2 * 7, index + 7276672);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 2 + 7, product* 6 * 9 * 6 * 7 * 7 * 2 * 7, index + 7277696);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 7, product* 4 * 2 * 8 * 7 * 7 * 2 * 7, index + 7277824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2 + 7, product* 6 * 3 * 3 * 8 * 7 * 2 * 7, index + 7278336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 2 + 7, product* 4 * 6 * 4 * 8 * 7 * 2 * 7, index + 7278464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 2 + 7, product* 6 * 7 * 9 * 8 * 7 * 2 * 7, index + 7278976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 7, product* 2 * 3 * 2 * 9 * 7 * 2 * 7, index + 7279232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 7, product* 2 * 3 * 4 * 2 * 8 * 2 * 7, index + 7282432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 7, product* 4 * 4 * 9 * 2 * 8 * 2 * 7, index + 7282944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 7, product* 8 * 2 * 3 * 3 * 8 * 2 * 7, index + 7283328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 2 + 7, product* 8 * 6 * 9 * 3 * 8 * 2 * 7, index + 7283968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 7, product* 4 * 2 * 2 * 4 * 8 * 2 * 7, index + 7284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 7, product* 6 * 3 * 7 * 4 * 8 * 2 * 7, index + 7284736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 2 + 7, product* 2 * 9 * 9 * 4 * 8 * 2 * 7, index + 7284992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 7, product* 2 * 7 * 2 * 6 * 8 * 2 * 7, index + 7286272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2 + 7, product* 2 * 3 * 8 * 8 * 8 * 2 * 7, index + 7288832);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 7, product* 8 * 8 * 2 * 2 * 9 * 2 * 7, index + 7292288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 7, product* 2 * 7 * 6 * 2 * 9 * 2 * 7, index + 7292672);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 2 + 7, product* 6 * 9 * 6 * 3 * 9 * 2 * 7, index + 7293696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 7, product* 4 * 2 * 8 * 3 * 9 * 2 * 7, index + 7293824);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 7, product* 4 * 6 * 4 * 4 * 9 * 2 * 7, index + 7294464);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 9 + 2 + 7, product* 8 * 6 * 7 * 6 * 9 * 2 * 7, index + 7296768);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 7, product* 2 * 3 * 4 * 8 * 9 * 2 * 7, index + 7298432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 2 + 7, product* 8 * 2 * 3 * 9 * 9 * 2 * 7, index + 7299328);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 7, product* 8 * 6 * 3 * 2 * 2 * 3 * 7, index + 7322368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 7, product* 6 * 9 * 4 * 2 * 2 * 3 * 7, index + 7322496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 7, product* 4 * 2 * 6 * 2 * 2 * 3 * 7, index + 7322624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 7, product* 4 * 6 * 2 * 3 * 2 * 3 * 7, index + 7323264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 7, product* 2 * 9 * 3 * 3 * 2 * 3 * 7, index + 7323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 7, product* 8 * 4 * 6 * 3 * 2 * 3 * 7, index + 7323648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 7, product* 6 * 7 * 7 * 3 * 2 * 3 * 7, index + 7323776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 7, product* 8 * 8 * 2 * 4 * 2 * 3 * 7, index + 7324288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 7, product* 2 * 7 * 6 * 4 * 2 * 3 * 7, index + 7324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 7, product* 8 * 2 * 9 * 4 * 2 * 3 * 7, index + 7324928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 7, product* 6 * 3 * 3 * 6 * 2 * 3 * 7, index + 7326336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 7, product* 4 * 6 * 4 * 6 * 2 * 3 * 7, index + 7326464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 3 + 7, product* 6 * 7 * 9 * 6 * 2 * 3 * 7, index + 7326976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 7, product* 2 * 3 * 2 * 7 * 2 * 3 * 7, index + 7327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 7, product* 8 * 8 * 4 * 7 * 2 * 3 * 7, index + 7327488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 7, product* 4 * 4 * 7 * 7 * 2 * 3 * 7, index + 7327744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 7, product* 2 * 7 * 8 * 7 * 2 * 3 * 7, index + 7327872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 7, product* 4 * 8 * 3 * 8 * 2 * 3 * 7, index + 7328384);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 3 + 7, product* 6 * 9 * 6 * 9 * 2 * 3 * 7, index + 7329696);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 7, product* 2 * 9 * 7 * 9 * 2 * 3 * 7, index + 7329792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 7, product* 4 * 2 * 2 * 2 * 3 * 3 * 7, index + 7332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 7, product* 6 * 3 * 7 * 2 * 3 * 3 * 7, index + 7332736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 7, product* 4 * 6 * 8 * 2 * 3 * 3 * 7, index + 7332864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 7, product* 2 * 9 * 9 * 2 * 3 * 3 * 7, index + 7332992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 7, product* 8 * 4 * 2 * 3 * 3 * 3 * 7, index + 7333248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 7, product* 6 * 7 * 3 * 3 * 3 * 3 * 7, index + 7333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 7, product* 2 * 3 * 6 * 3 * 3 * 3 * 7, index + 7333632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 3 + 7, product* 8 * 8 * 8 * 3 * 3 * 3 * 7, index + 7333888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 7, product* 2 * 7 * 2 * 4 * 3 * 3 * 7, index + 7334272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 7, product* 4 * 4 * 3 * 7 * 3 * 3 * 7, index + 7337344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 7, product* 2 * 7 * 4 * 7 * 3 * 3 * 7, index + 7337472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3 + 7, product* 4 * 6 * 6 * 7 * 3 * 3 * 7, index + 7337664);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 3 + 7, product* 8 * 6 * 3 * 8 * 3 * 3 * 7, index + 7338368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 7, product* 4 * 2 * 6 * 8 * 3 * 3 * 7, index + 7338624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 7, product* 4 * 6 * 2 * 9 * 3 * 3 * 7, index + 7339264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 7, product* 2 * 9 * 3 * 9 * 3 * 3 * 7, index + 7339392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 3 + 7, product* 8 * 4 * 6 * 9 * 3 * 3 * 7, index + 7339648);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 3 + 3 + 7, product* 6 * 7 * 7 * 9 * 3 * 3 * 7, index + 7339776);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 7, product* 6 * 3 * 3 * 2 * 4 * 3 * 7, index + 7342336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 7, product* 4 * 6 * 4 * 2 * 4 * 3 * 7, index + 7342464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 7, product* 8 * 4 * 8 * 2 * 4 * 3 * 7, index + 7342848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 7, product* 2 * 3 * 2 * 3 * 4 * 3 * 7, index + 7343232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 7, product* 4 * 4 * 7 * 3 * 4 * 3 * 7, index + 7343744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 7, product* 2 * 7 * 8 * 3 * 4 * 3 * 7, index + 7343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 7, product* 4 * 8 * 3 * 4 * 4 * 3 * 7, index + 7344384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3 + 7, product* 8 * 6 * 7 * 4 * 4 * 3 * 7, index + 7344768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 4 + 3 + 7, product* 6 * 9 * 8 * 4 * 4 * 3 * 7, index + 7344896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 7, product* 2 * 3 * 4 * 6 * 4 * 3 * 7, index + 7346432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 7, product* 8 * 2 * 3 * 7 * 4 * 3 * 7, index + 7347328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 7, product* 4 * 2 * 2 * 8 * 4 * 3 * 7, index + 7348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 7, product* 6 * 3 * 7 * 8 * 4 * 3 * 7, index + 7348736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 7, product* 8 * 4 * 2 * 9 * 4 * 3 * 7, index + 7349248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 7, product* 2 * 3 * 6 * 9 * 4 * 3 * 7, index + 7349632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 7, product* 2 * 3 * 4 * 2 * 6 * 3 * 7, index + 7362432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 7, product* 4 * 4 * 9 * 2 * 6 * 3 * 7, index + 7362944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 7, product* 8 * 2 * 3 * 3 * 6 * 3 * 7, index + 7363328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 7, product* 8 * 6 * 9 * 3 * 6 * 3 * 7, index + 7363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 7, product* 4 * 2 * 2 * 4 * 6 * 3 * 7, index + 7364224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 3 + 7, product* 4 * 6 * 8 * 4 * 6 * 3 * 7, index + 7364864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3 + 7, product* 2 * 7 * 2 * 6 * 6 * 3 * 7, index + 7366272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 3 + 7, product* 4 * 8 * 7 * 6 * 6 * 3 * 7, index + 7366784);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 7, product* 2 * 3 * 2 * 7 * 6 * 3 * 7, index + 7367232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 3 + 7, product* 6 * 9 * 2 * 7 * 6 * 3 * 7, index + 7367296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 7, product* 4 * 2 * 4 * 7 * 6 * 3 * 7, index + 7367424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 7, product* 8 * 4 * 4 * 8 * 6 * 3 * 7, index + 7368448);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 3 + 7, product* 4 * 4 * 3 * 9 * 6 * 3 * 7, index + 7369344);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3 + 7, product* 8 * 8 * 2 * 2 * 7 * 3 * 7, index + 7372288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 7, product* 2 * 7 * 6 * 2 * 7 * 3 * 7, index + 7372672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3 + 7, product* 8 * 2 * 9 * 2 * 7 * 3 * 7, index + 7372928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 7, product* 4 * 2 * 8 * 3 * 7 * 3 * 7, index + 7373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 7, product* 6 * 3 * 3 * 4 * 7 * 3 * 7, index + 7374336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 3 + 7, product* 4 * 6 * 4 * 4 * 7 * 3 * 7, index + 7374464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 3 + 7, product* 4 * 8 * 3 * 6 * 7 * 3 * 7, index + 7376384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 7, product* 2 * 3 * 4 * 8 * 7 * 3 * 7, index + 7378432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 3 + 7, product* 4 * 4 * 9 * 8 * 7 * 3 * 7, index + 7378944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 7, product* 2 * 7 * 2 * 2 * 8 * 3 * 7, index + 7382272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3 + 7, product* 4 * 8 * 7 * 2 * 8 * 3 * 7, index + 7382784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 7, product* 6 * 9 * 2 * 3 * 8 * 3 * 7, index + 7383296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 7, product* 4 * 2 * 4 * 3 * 8 * 3 * 7, index + 7383424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 3 + 7, product* 6 * 3 * 9 * 3 * 8 * 3 * 7, index + 7383936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 7, product* 2 * 3 * 8 * 4 * 8 * 3 * 7, index + 7384832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 3 + 7, product* 4 * 2 * 6 * 6 * 8 * 3 * 7, index + 7386624);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8 + 3 + 7, product* 8 * 4 * 6 * 7 * 8 * 3 * 7, index + 7387648);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 7, product* 4 * 8 * 3 * 2 * 9 * 3 * 7, index + 7392384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 3 + 7, product* 4 * 6 * 6 * 3 * 9 * 3 * 7, index + 7393664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 7, product* 2 * 3 * 4 * 4 * 9 * 3 * 7, index + 7394432);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 7, product* 4 * 2 * 4 * 9 * 9 * 3 * 7, index + 7399424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 7, product* 6 * 3 * 3 * 2 * 2 * 4 * 7, index + 7422336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 7, product* 4 * 6 * 4 * 2 * 2 * 4 * 7, index + 7422464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4 + 7, product* 8 * 4 * 8 * 2 * 2 * 4 * 7, index + 7422848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 7, product* 6 * 7 * 9 * 2 * 2 * 4 * 7, index + 7422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 7, product* 2 * 3 * 2 * 3 * 2 * 4 * 7, index + 7423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 7, product* 8 * 8 * 4 * 3 * 2 * 4 * 7, index + 7423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 7, product* 4 * 4 * 7 * 3 * 2 * 4 * 7, index + 7423744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 7, product* 2 * 7 * 8 * 3 * 2 * 4 * 7, index + 7423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 7, product* 4 * 8 * 3 * 4 * 2 * 4 * 7, index + 7424384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 4 + 7, product* 6 * 9 * 8 * 4 * 2 * 4 * 7, index + 7424896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 7, product* 2 * 3 * 4 * 6 * 2 * 4 * 7, index + 7426432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 7, product* 8 * 2 * 3 * 7 * 2 * 4 * 7, index + 7427328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 7, product* 4 * 2 * 2 * 8 * 2 * 4 * 7, index + 7428224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4 + 7, product* 6 * 3 * 7 * 8 * 2 * 4 * 7, index + 7428736);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 4 + 7, product* 4 * 6 * 8 * 8 * 2 * 4 * 7, index + 7428864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 4 + 7, product* 6 * 7 * 3 * 9 * 2 * 4 * 7, index + 7429376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 7, product* 2 * 3 * 6 * 9 * 2 * 4 * 7, index + 7429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 7, product* 8 * 4 * 4 * 2 * 3 * 4 * 7, index + 7432448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 7, product* 2 * 3 * 8 * 2 * 3 * 4 * 7, index + 7432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 7, product* 4 * 4 * 3 * 3 * 3 * 4 * 7, index + 7433344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 7, product* 2 * 7 * 4 * 3 * 3 * 4 * 7, index + 7433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 7, product* 8 * 2 * 7 * 3 * 3 * 4 * 7, index + 7433728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 7, product* 4 * 8 * 9 * 3 * 3 * 4 * 7, index + 7433984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4 + 7, product* 8 * 6 * 3 * 4 * 3 * 4 * 7, index + 7434368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 7, product* 4 * 2 * 6 * 4 * 3 * 4 * 7, index + 7434624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4 + 7, product* 8 * 8 * 2 * 6 * 3 * 4 * 7, index + 7436288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4 + 7, product* 4 * 2 * 8 * 7 * 3 * 4 * 7, index + 7437824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 7, product* 6 * 3 * 3 * 8 * 3 * 4 * 7, index + 7438336);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 4 + 7, product* 6 * 7 * 9 * 8 * 3 * 4 * 7, index + 7438976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 7, product* 2 * 3 * 2 * 9 * 3 * 4 * 7, index + 7439232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 4 + 7, product* 8 * 8 * 4 * 9 * 3 * 4 * 7, index + 7439488);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 4 + 7, product* 2 * 7 * 8 * 9 * 3 * 4 * 7, index + 7439872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 7, product* 2 * 3 * 4 * 2 * 4 * 4 * 7, index + 7442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 7, product* 4 * 4 * 9 * 2 * 4 * 4 * 7, index + 7442944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 7, product* 8 * 2 * 3 * 3 * 4 * 4 * 7, index + 7443328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 7, product* 4 * 2 * 2 * 4 * 4 * 4 * 7, index + 7444224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 4 + 7, product* 6 * 3 * 7 * 4 * 4 * 4 * 7, index + 7444736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 7, product* 2 * 7 * 2 * 6 * 4 * 4 * 7, index + 7446272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 4 + 7, product* 4 * 8 * 7 * 6 * 4 * 4 * 7, index + 7446784);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 7, product* 4 * 2 * 4 * 7 * 4 * 4 * 7, index + 7447424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 4 + 7, product* 6 * 3 * 9 * 7 * 4 * 4 * 7, index + 7447936);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 4 + 7, product* 2 * 3 * 8 * 8 * 4 * 4 * 7, index + 7448832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 7, product* 4 * 4 * 3 * 9 * 4 * 4 * 7, index + 7449344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 7, product* 2 * 7 * 2 * 2 * 6 * 4 * 7, index + 7462272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 4 + 7, product* 4 * 8 * 7 * 2 * 6 * 4 * 7, index + 7462784);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 7, product* 4 * 2 * 4 * 3 * 6 * 4 * 7, index + 7463424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 4 + 7, product* 6 * 3 * 9 * 3 * 6 * 4 * 7, index + 7463936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 7, product* 2 * 3 * 8 * 4 * 6 * 4 * 7, index + 7464832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 4 + 7, product* 6 * 9 * 4 * 6 * 6 * 4 * 7, index + 7466496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 4 + 7, product* 4 * 2 * 6 * 6 * 6 * 4 * 7, index + 7466624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 7, product* 4 * 6 * 2 * 7 * 6 * 4 * 7, index + 7467264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 4 + 7, product* 2 * 9 * 3 * 7 * 6 * 4 * 7, index + 7467392);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 4 + 7, product* 6 * 7 * 7 * 7 * 6 * 4 * 7, index + 7467776);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 4 + 7, product* 2 * 7 * 6 * 8 * 6 * 4 * 7, index + 7468672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 4 + 7, product* 4 * 2 * 8 * 9 * 6 * 4 * 7, index + 7469824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 7, product* 4 * 8 * 3 * 2 * 7 * 4 * 7, index + 7472384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 4 + 7, product* 6 * 9 * 8 * 2 * 7 * 4 * 7, index + 7472896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 7, product* 2 * 3 * 4 * 4 * 7 * 4 * 7, index + 7474432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 4 + 7, product* 4 * 4 * 9 * 4 * 7 * 4 * 7, index + 7474944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 7, product* 4 * 2 * 2 * 6 * 7 * 4 * 7, index + 7476224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 4 + 7, product* 2 * 9 * 9 * 6 * 7 * 4 * 7, index + 7476992);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 7, product* 2 * 3 * 6 * 7 * 7 * 4 * 7, index + 7477632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 7, product* 2 * 7 * 2 * 8 * 7 * 4 * 7, index + 7478272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 4 + 7, product* 6 * 9 * 2 * 9 * 7 * 4 * 7, index + 7479296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 4 + 7, product* 4 * 2 * 4 * 9 * 7 * 4 * 7, index + 7479424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 4 + 7, product* 6 * 3 * 9 * 9 * 7 * 4 * 7, index + 7479936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4 + 7, product* 8 * 6 * 3 * 2 * 8 * 4 * 7, index + 7482368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 7, product* 4 * 2 * 6 * 2 * 8 * 4 * 7, index + 7482624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 7, product* 2 * 9 * 3 * 3 * 8 * 4 * 7, index + 7483392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 4 + 7, product* 2 * 7 * 6 * 4 * 8 * 4 * 7, index + 7484672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 4 + 7, product* 6 * 3 * 3 * 6 * 8 * 4 * 7, index + 7486336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4 + 7, product* 4 * 6 * 4 * 6 * 8 * 4 * 7, index + 7486464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 7, product* 2 * 3 * 2 * 7 * 8 * 4 * 7, index + 7487232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 4 + 7, product* 4 * 4 * 7 * 7 * 8 * 4 * 7, index + 7487744);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 7, product* 4 * 2 * 2 * 2 * 9 * 4 * 7, index + 7492224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4 + 7, product* 8 * 4 * 2 * 3 * 9 * 4 * 7, index + 7493248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 4 + 7, product* 6 * 7 * 3 * 3 * 9 * 4 * 7, index + 7493376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 7, product* 2 * 3 * 6 * 3 * 9 * 4 * 7, index + 7493632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4 + 7, product* 2 * 7 * 2 * 4 * 9 * 4 * 7, index + 7494272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4 + 7, product* 2 * 3 * 8 * 6 * 9 * 4 * 7, index + 7496832);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 4 + 7, product* 8 * 2 * 7 * 7 * 9 * 4 * 7, index + 7497728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 7, product* 2 * 7 * 2 * 2 * 2 * 6 * 7, index + 7622272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6 + 7, product* 4 * 8 * 7 * 2 * 2 * 6 * 7, index + 7622784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 7, product* 6 * 9 * 2 * 3 * 2 * 6 * 7, index + 7623296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 7, product* 4 * 2 * 4 * 3 * 2 * 6 * 7, index + 7623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 7, product* 6 * 3 * 9 * 3 * 2 * 6 * 7, index + 7623936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 7, product* 8 * 4 * 4 * 4 * 2 * 6 * 7, index + 7624448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 7, product* 2 * 3 * 8 * 4 * 2 * 6 * 7, index + 7624832);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 6 + 7, product* 6 * 9 * 4 * 6 * 2 * 6 * 7, index + 7626496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 7, product* 4 * 2 * 6 * 6 * 2 * 6 * 7, index + 7626624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 7, product* 4 * 6 * 2 * 7 * 2 * 6 * 7, index + 7627264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 7, product* 2 * 9 * 3 * 7 * 2 * 6 * 7, index + 7627392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 6 + 7, product* 8 * 4 * 6 * 7 * 2 * 6 * 7, index + 7627648);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 7, product* 4 * 8 * 3 * 2 * 3 * 6 * 7, index + 7632384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6 + 7, product* 4 * 6 * 6 * 3 * 3 * 6 * 7, index + 7633664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 7, product* 2 * 3 * 4 * 4 * 3 * 6 * 7, index + 7634432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 7, product* 4 * 2 * 2 * 6 * 3 * 6 * 7, index + 7636224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 7, product* 2 * 7 * 2 * 8 * 3 * 6 * 7, index + 7638272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 7, product* 4 * 2 * 4 * 9 * 3 * 6 * 7, index + 7639424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 6 + 7, product* 8 * 6 * 3 * 2 * 4 * 6 * 7, index + 7642368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 7, product* 4 * 2 * 6 * 2 * 4 * 6 * 7, index + 7642624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 7, product* 4 * 6 * 2 * 3 * 4 * 6 * 7, index + 7643264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 6 + 7, product* 2 * 9 * 3 * 3 * 4 * 6 * 7, index + 7643392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 6 + 7, product* 8 * 4 * 6 * 3 * 4 * 6 * 7, index + 7643648);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 6 + 7, product* 6 * 3 * 9 * 3 * 4 * 6 * 7, index + 7643936);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 7, product* 2 * 7 * 6 * 4 * 4 * 6 * 7, index + 7644672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 7, product* 6 * 3 * 3 * 6 * 4 * 6 * 7, index + 7646336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 6 + 7, product* 4 * 6 * 4 * 6 * 4 * 6 * 7, index + 7646464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 7, product* 2 * 3 * 2 * 7 * 4 * 6 * 7, index + 7647232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 7, product* 6 * 3 * 3 * 2 * 6 * 6 * 7, index + 7662336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 7, product* 4 * 6 * 4 * 2 * 6 * 6 * 7, index + 7662464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6 + 7, product* 8 * 4 * 8 * 2 * 6 * 6 * 7, index + 7662848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 7, product* 2 * 3 * 2 * 3 * 6 * 6 * 7, index + 7663232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 6 + 7, product* 2 * 7 * 8 * 3 * 6 * 6 * 7, index + 7663872);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 6 + 7, product* 8 * 6 * 7 * 4 * 6 * 6 * 7, index + 7664768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 7, product* 2 * 3 * 4 * 6 * 6 * 6 * 7, index + 7666432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 6 + 7, product* 4 * 4 * 9 * 6 * 6 * 6 * 7, index + 7666944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 7, product* 4 * 2 * 2 * 8 * 6 * 6 * 7, index + 7668224);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 6 + 7, product* 6 * 7 * 3 * 9 * 6 * 6 * 7, index + 7669376);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 7, product* 8 * 4 * 4 * 2 * 7 * 6 * 7, index + 7672448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 7, product* 2 * 3 * 8 * 2 * 7 * 6 * 7, index + 7672832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 6 + 7, product* 4 * 4 * 3 * 3 * 7 * 6 * 7, index + 7673344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 7, product* 4 * 2 * 6 * 4 * 7 * 6 * 7, index + 7674624);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 6 + 7, product* 4 * 2 * 8 * 7 * 7 * 6 * 7, index + 7677824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6 + 7, product* 6 * 3 * 3 * 8 * 7 * 6 * 7, index + 7678336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 7, product* 2 * 3 * 2 * 9 * 7 * 6 * 7, index + 7679232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 7, product* 2 * 3 * 4 * 2 * 8 * 6 * 7, index + 7682432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6 + 7, product* 8 * 2 * 3 * 3 * 8 * 6 * 7, index + 7683328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 7, product* 4 * 2 * 2 * 4 * 8 * 6 * 7, index + 7684224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 6 + 7, product* 4 * 6 * 8 * 4 * 8 * 6 * 7, index + 7684864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 7, product* 2 * 7 * 2 * 6 * 8 * 6 * 7, index + 7686272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 6 + 7, product* 4 * 4 * 3 * 9 * 8 * 6 * 7, index + 7689344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 6 + 7, product* 2 * 7 * 4 * 9 * 8 * 6 * 7, index + 7689472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 6 + 7, product* 8 * 2 * 7 * 9 * 8 * 6 * 7, index + 7689728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 6 + 7, product* 8 * 8 * 2 * 2 * 9 * 6 * 7, index + 7692288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 6 + 7, product* 4 * 2 * 8 * 3 * 9 * 6 * 7, index + 7693824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 7, product* 8 * 6 * 3 * 2 * 2 * 7 * 7, index + 7722368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 7, product* 6 * 9 * 4 * 2 * 2 * 7 * 7, index + 7722496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 7, product* 4 * 2 * 6 * 2 * 2 * 7 * 7, index + 7722624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 7, product* 4 * 6 * 2 * 3 * 2 * 7 * 7, index + 7723264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 7, product* 8 * 8 * 2 * 4 * 2 * 7 * 7, index + 7724288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7 + 7, product* 2 * 7 * 6 * 4 * 2 * 7 * 7, index + 7724672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 7, product* 2 * 3 * 2 * 7 * 2 * 7 * 7, index + 7727232);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 7 + 7, product* 2 * 7 * 8 * 7 * 2 * 7 * 7, index + 7727872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 7, product* 4 * 2 * 2 * 2 * 3 * 7 * 7, index + 7732224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 7, product* 6 * 3 * 7 * 2 * 3 * 7 * 7, index + 7732736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 7 + 7, product* 4 * 6 * 8 * 2 * 3 * 7 * 7, index + 7732864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 7, product* 2 * 9 * 9 * 2 * 3 * 7 * 7, index + 7732992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 7, product* 8 * 4 * 2 * 3 * 3 * 7 * 7, index + 7733248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 7 + 7, product* 6 * 7 * 3 * 3 * 3 * 7 * 7, index + 7733376);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 7 + 7, product* 8 * 8 * 8 * 3 * 3 * 7 * 7, index + 7733888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 7, product* 2 * 7 * 2 * 4 * 3 * 7 * 7, index + 7734272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7 + 7, product* 2 * 3 * 8 * 6 * 3 * 7 * 7, index + 7736832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 7 + 7, product* 4 * 4 * 3 * 7 * 3 * 7 * 7, index + 7737344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 7, product* 2 * 7 * 4 * 7 * 3 * 7 * 7, index + 7737472);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 7, product* 4 * 2 * 6 * 8 * 3 * 7 * 7, index + 7738624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 7 + 7, product* 2 * 9 * 3 * 9 * 3 * 7 * 7, index + 7739392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 7, product* 4 * 6 * 4 * 2 * 4 * 7 * 7, index + 7742464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 7 + 7, product* 8 * 4 * 8 * 2 * 4 * 7 * 7, index + 7742848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 7 + 7, product* 6 * 7 * 9 * 2 * 4 * 7 * 7, index + 7742976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 7, product* 2 * 3 * 2 * 3 * 4 * 7 * 7, index + 7743232);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 7 + 7, product* 8 * 6 * 7 * 4 * 4 * 7 * 7, index + 7744768);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 7 + 7, product* 2 * 3 * 4 * 6 * 4 * 7 * 7, index + 7746432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 7 + 7, product* 8 * 8 * 6 * 6 * 4 * 7 * 7, index + 7746688);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 7 + 7, product* 8 * 2 * 3 * 7 * 4 * 7 * 7, index + 7747328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 7, product* 4 * 2 * 2 * 8 * 4 * 7 * 7, index + 7748224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 7 + 7, product* 4 * 6 * 8 * 8 * 4 * 7 * 7, index + 7748864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 7 + 7, product* 2 * 3 * 6 * 9 * 4 * 7 * 7, index + 7749632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 7, product* 2 * 3 * 4 * 2 * 6 * 7 * 7, index + 7762432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 7, product* 4 * 2 * 2 * 4 * 6 * 7 * 7, index + 7764224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 7 + 7, product* 6 * 3 * 7 * 4 * 6 * 7 * 7, index + 7764736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 7 + 7, product* 2 * 7 * 2 * 6 * 6 * 7 * 7, index + 7766272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 7 + 7, product* 4 * 8 * 7 * 6 * 6 * 7 * 7, index + 7766784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 7 + 7, product* 6 * 9 * 2 * 7 * 6 * 7 * 7, index + 7767296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 7 + 7, product* 2 * 3 * 8 * 8 * 6 * 7 * 7, index + 7768832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 7 + 7, product* 2 * 7 * 6 * 2 * 7 * 7 * 7, index + 7772672);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 7 + 7, product* 4 * 2 * 8 * 3 * 7 * 7 * 7, index + 7773824);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 7 + 7, product* 4 * 6 * 4 * 4 * 7 * 7 * 7, index + 7774464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 7 + 7, product* 4 * 8 * 3 * 6 * 7 * 7 * 7, index + 7776384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 7 + 7, product* 2 * 3 * 4 * 8 * 7 * 7 * 7, index + 7778432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7 + 7, product* 8 * 2 * 3 * 9 * 7 * 7 * 7, index + 7779328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 7, product* 2 * 7 * 2 * 2 * 8 * 7 * 7, index + 7782272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7 + 7, product* 4 * 2 * 4 * 3 * 8 * 7 * 7, index + 7783424);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8 + 7 + 7, product* 8 * 4 * 6 * 7 * 8 * 7 * 7, index + 7787648);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 8 + 7 + 7, product* 6 * 9 * 6 * 9 * 8 * 7 * 7, index + 7789696);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 7 + 7, product* 4 * 8 * 3 * 2 * 9 * 7 * 7, index + 7792384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 7 + 7, product* 4 * 6 * 6 * 3 * 9 * 7 * 7, index + 7793664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 7, product* 2 * 3 * 4 * 4 * 9 * 7 * 7, index + 7794432);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9 + 7 + 7, product* 8 * 4 * 2 * 7 * 9 * 7 * 7, index + 7797248);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 7 + 7, product* 4 * 2 * 4 * 9 * 9 * 7 * 7, index + 7799424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 7, product* 6 * 3 * 3 * 2 * 2 * 8 * 7, index + 7822336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 7, product* 2 * 3 * 2 * 3 * 2 * 8 * 7, index + 7823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 7, product* 4 * 4 * 7 * 3 * 2 * 8 * 7, index + 7823744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 7, product* 2 * 7 * 8 * 3 * 2 * 8 * 7, index + 7823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 7, product* 4 * 8 * 3 * 4 * 2 * 8 * 7, index + 7824384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 8 + 7, product* 8 * 6 * 7 * 4 * 2 * 8 * 7, index + 7824768);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8 + 7, product* 6 * 9 * 8 * 4 * 2 * 8 * 7, index + 7824896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 7, product* 2 * 3 * 4 * 6 * 2 * 8 * 7, index + 7826432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 7, product* 4 * 2 * 2 * 8 * 2 * 8 * 7, index + 7828224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 7, product* 8 * 4 * 2 * 9 * 2 * 8 * 7, index + 7829248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8 + 7, product* 2 * 3 * 6 * 9 * 2 * 8 * 7, index + 7829632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 7, product* 2 * 3 * 8 * 2 * 3 * 8 * 7, index + 7832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 7, product* 4 * 4 * 3 * 3 * 3 * 8 * 7, index + 7833344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 7, product* 2 * 7 * 4 * 3 * 3 * 8 * 7, index + 7833472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 7, product* 8 * 2 * 7 * 3 * 3 * 8 * 7, index + 7833728);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 7, product* 4 * 2 * 6 * 4 * 3 * 8 * 7, index + 7834624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 8 + 7, product* 2 * 7 * 6 * 6 * 3 * 8 * 7, index + 7836672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 8 + 7, product* 8 * 2 * 9 * 6 * 3 * 8 * 7, index + 7836928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 7, product* 4 * 2 * 8 * 7 * 3 * 8 * 7, index + 7837824);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 8 + 7, product* 4 * 6 * 4 * 8 * 3 * 8 * 7, index + 7838464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 7, product* 2 * 3 * 2 * 9 * 3 * 8 * 7, index + 7839232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 7, product* 2 * 3 * 4 * 2 * 4 * 8 * 7, index + 7842432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 7, product* 4 * 4 * 9 * 2 * 4 * 8 * 7, index + 7842944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 8 + 7, product* 8 * 2 * 3 * 3 * 4 * 8 * 7, index + 7843328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 7, product* 4 * 2 * 2 * 4 * 4 * 8 * 7, index + 7844224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 8 + 7, product* 6 * 3 * 7 * 4 * 4 * 8 * 7, index + 7844736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 8 + 7, product* 4 * 6 * 8 * 4 * 4 * 8 * 7, index + 7844864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 8 + 7, product* 2 * 9 * 9 * 4 * 4 * 8 * 7, index + 7844992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 7, product* 2 * 7 * 2 * 6 * 4 * 8 * 7, index + 7846272);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 7, product* 2 * 7 * 2 * 2 * 6 * 8 * 7, index + 7862272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 7, product* 4 * 2 * 4 * 3 * 6 * 8 * 7, index + 7863424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 8 + 7, product* 8 * 4 * 4 * 4 * 6 * 8 * 7, index + 7864448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8 + 7, product* 2 * 3 * 8 * 4 * 6 * 8 * 7, index + 7864832);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 8 + 7, product* 4 * 6 * 2 * 7 * 6 * 8 * 7, index + 7867264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 8 + 7, product* 4 * 2 * 8 * 9 * 6 * 8 * 7, index + 7869824);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 8 + 7, product* 4 * 6 * 6 * 3 * 7 * 8 * 7, index + 7873664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 8 + 7, product* 2 * 9 * 7 * 3 * 7 * 8 * 7, index + 7873792);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 7, product* 4 * 2 * 2 * 6 * 7 * 8 * 7, index + 7876224);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 8 + 7, product* 8 * 6 * 3 * 2 * 8 * 8 * 7, index + 7882368);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 7, product* 4 * 6 * 2 * 3 * 8 * 8 * 7, index + 7883264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 8 + 7, product* 2 * 9 * 3 * 3 * 8 * 8 * 7, index + 7883392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 8 + 7, product* 8 * 8 * 2 * 4 * 8 * 8 * 7, index + 7884288);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 7, product* 2 * 3 * 2 * 7 * 8 * 8 * 7, index + 7887232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 8 + 7, product* 4 * 4 * 7 * 7 * 8 * 8 * 7, index + 7887744);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8 + 8 + 7, product* 6 * 9 * 8 * 8 * 8 * 8 * 7, index + 7888896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 7, product* 4 * 2 * 2 * 2 * 9 * 8 * 7, index + 7892224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 8 + 7, product* 2 * 9 * 9 * 2 * 9 * 8 * 7, index + 7892992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 8 + 7, product* 2 * 7 * 2 * 4 * 9 * 8 * 7, index + 7894272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 7, product* 2 * 3 * 4 * 2 * 2 * 9 * 7, index + 7922432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 9 + 7, product* 8 * 8 * 6 * 2 * 2 * 9 * 7, index + 7922688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 7, product* 4 * 4 * 9 * 2 * 2 * 9 * 7, index + 7922944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 7, product* 8 * 2 * 3 * 3 * 2 * 9 * 7, index + 7923328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 9 + 7, product* 8 * 6 * 9 * 3 * 2 * 9 * 7, index + 7923968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 7, product* 4 * 2 * 2 * 4 * 2 * 9 * 7, index + 7924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 7, product* 6 * 3 * 7 * 4 * 2 * 9 * 7, index + 7924736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 7, product* 2 * 7 * 2 * 6 * 2 * 9 * 7, index + 7926272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 9 + 7, product* 4 * 8 * 7 * 6 * 2 * 9 * 7, index + 7926784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9 + 7, product* 6 * 9 * 2 * 7 * 2 * 9 * 7, index + 7927296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 7, product* 4 * 2 * 4 * 7 * 2 * 9 * 7, index + 7927424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9 + 7, product* 2 * 7 * 4 * 9 * 2 * 9 * 7, index + 7929472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 9 + 7, product* 8 * 8 * 2 * 2 * 3 * 9 * 7, index + 7932288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 7, product* 2 * 7 * 6 * 2 * 3 * 9 * 7, index + 7932672);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 9 + 7, product* 6 * 9 * 6 * 3 * 3 * 9 * 7, index + 7933696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 7, product* 4 * 2 * 8 * 3 * 3 * 9 * 7, index + 7933824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 7, product* 6 * 3 * 3 * 4 * 3 * 9 * 7, index + 7934336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 9 + 7, product* 4 * 6 * 4 * 4 * 3 * 9 * 7, index + 7934464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 9 + 7, product* 2 * 9 * 7 * 7 * 3 * 9 * 7, index + 7937792);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 7, product* 2 * 3 * 4 * 8 * 3 * 9 * 7, index + 7938432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 9 + 7, product* 4 * 4 * 9 * 8 * 3 * 9 * 7, index + 7938944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 7, product* 2 * 7 * 2 * 2 * 4 * 9 * 7, index + 7942272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9 + 7, product* 4 * 2 * 4 * 3 * 4 * 9 * 7, index + 7943424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 9 + 7, product* 8 * 4 * 4 * 4 * 4 * 9 * 7, index + 7944448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 7, product* 2 * 3 * 8 * 4 * 4 * 9 * 7, index + 7944832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 9 + 7, product* 4 * 2 * 6 * 6 * 4 * 9 * 7, index + 7946624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 9 + 7, product* 2 * 9 * 3 * 7 * 4 * 9 * 7, index + 7947392);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 7, product* 4 * 2 * 6 * 2 * 6 * 9 * 7, index + 7962624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 9 + 7, product* 2 * 9 * 3 * 3 * 6 * 9 * 7, index + 7963392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 7, product* 2 * 3 * 2 * 7 * 6 * 9 * 7, index + 7967232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 7, product* 4 * 2 * 2 * 2 * 7 * 9 * 7, index + 7972224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 9 + 7, product* 2 * 9 * 9 * 2 * 7 * 9 * 7, index + 7972992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 7, product* 2 * 7 * 2 * 4 * 7 * 9 * 7, index + 7974272);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 9 + 7, product* 8 * 2 * 7 * 7 * 7 * 9 * 7, index + 7977728);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 9 + 7, product* 4 * 6 * 4 * 2 * 8 * 9 * 7, index + 7982464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 7, product* 2 * 3 * 2 * 3 * 8 * 9 * 7, index + 7983232);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 9 + 7, product* 2 * 3 * 4 * 6 * 8 * 9 * 7, index + 7986432);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 9 + 7, product* 8 * 4 * 2 * 9 * 8 * 9 * 7, index + 7989248);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 9 + 7, product* 8 * 4 * 4 * 2 * 9 * 9 * 7, index + 7992448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9 + 7, product* 2 * 3 * 8 * 2 * 9 * 9 * 7, index + 7992832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 9 + 7, product* 4 * 4 * 3 * 3 * 9 * 9 * 7, index + 7993344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 9 + 7, product* 2 * 7 * 4 * 3 * 9 * 9 * 7, index + 7993472);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 9 + 7, product* 4 * 2 * 6 * 4 * 9 * 9 * 7, index + 7994624);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 9 + 7, product* 4 * 6 * 4 * 8 * 9 * 9 * 7, index + 7998464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 9 + 9 + 7, product* 6 * 7 * 9 * 8 * 9 * 9 * 7, index + 7998976);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 8, product* 6 * 3 * 3 * 2 * 2 * 2 * 8, index + 8222336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 8, product* 4 * 6 * 4 * 2 * 2 * 2 * 8, index + 8222464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 8, product* 8 * 4 * 8 * 2 * 2 * 2 * 8, index + 8222848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 8, product* 6 * 7 * 9 * 2 * 2 * 2 * 8, index + 8222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 8, product* 2 * 3 * 2 * 3 * 2 * 2 * 8, index + 8223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 8, product* 8 * 8 * 4 * 3 * 2 * 2 * 8, index + 8223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 8, product* 4 * 4 * 7 * 3 * 2 * 2 * 8, index + 8223744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 8, product* 2 * 7 * 8 * 3 * 2 * 2 * 8, index + 8223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 8, product* 4 * 8 * 3 * 4 * 2 * 2 * 8, index + 8224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 8, product* 2 * 3 * 4 * 6 * 2 * 2 * 8, index + 8226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 8, product* 4 * 4 * 9 * 6 * 2 * 2 * 8, index + 8226944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 8, product* 8 * 2 * 3 * 7 * 2 * 2 * 8, index + 8227328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 8, product* 4 * 2 * 2 * 8 * 2 * 2 * 8, index + 8228224);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 8, product* 4 * 6 * 8 * 8 * 2 * 2 * 8, index + 8228864);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 8, product* 8 * 4 * 2 * 9 * 2 * 2 * 8, index + 8229248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 8, product* 6 * 7 * 3 * 9 * 2 * 2 * 8, index + 8229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 8, product* 2 * 3 * 6 * 9 * 2 * 2 * 8, index + 8229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 8, product* 8 * 4 * 4 * 2 * 3 * 2 * 8, index + 8232448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 8, product* 2 * 3 * 8 * 2 * 3 * 2 * 8, index + 8232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 8, product* 4 * 4 * 3 * 3 * 3 * 2 * 8, index + 8233344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 8, product* 2 * 7 * 4 * 3 * 3 * 2 * 8, index + 8233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 8, product* 8 * 2 * 7 * 3 * 3 * 2 * 8, index + 8233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 8, product* 4 * 8 * 9 * 3 * 3 * 2 * 8, index + 8233984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 8, product* 8 * 6 * 3 * 4 * 3 * 2 * 8, index + 8234368);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 8, product* 6 * 9 * 4 * 4 * 3 * 2 * 8, index + 8234496);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 8, product* 4 * 2 * 6 * 4 * 3 * 2 * 8, index + 8234624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 8, product* 8 * 8 * 2 * 6 * 3 * 2 * 8, index + 8236288);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 8, product* 2 * 7 * 6 * 6 * 3 * 2 * 8, index + 8236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 8, product* 8 * 2 * 9 * 6 * 3 * 2 * 8, index + 8236928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 8, product* 4 * 2 * 8 * 7 * 3 * 2 * 8, index + 8237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 8, product* 6 * 3 * 3 * 8 * 3 * 2 * 8, index + 8238336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 8, product* 4 * 6 * 4 * 8 * 3 * 2 * 8, index + 8238464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 8, product* 2 * 3 * 2 * 9 * 3 * 2 * 8, index + 8239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 8, product* 8 * 8 * 4 * 9 * 3 * 2 * 8, index + 8239488);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 8, product* 2 * 3 * 4 * 2 * 4 * 2 * 8, index + 8242432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 8, product* 4 * 4 * 9 * 2 * 4 * 2 * 8, index + 8242944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 8, product* 8 * 2 * 3 * 3 * 4 * 2 * 8, index + 8243328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 2 + 8, product* 8 * 6 * 9 * 3 * 4 * 2 * 8, index + 8243968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 8, product* 4 * 2 * 2 * 4 * 4 * 2 * 8, index + 8244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 8, product* 6 * 3 * 7 * 4 * 4 * 2 * 8, index + 8244736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 8, product* 4 * 6 * 8 * 4 * 4 * 2 * 8, index + 8244864);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 8, product* 2 * 9 * 9 * 4 * 4 * 2 * 8, index + 8244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 8, product* 2 * 7 * 2 * 6 * 4 * 2 * 8, index + 8246272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 8, product* 4 * 2 * 4 * 7 * 4 * 2 * 8, index + 8247424);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 8, product* 2 * 3 * 8 * 8 * 4 * 2 * 8, index + 8248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 8, product* 4 * 4 * 3 * 9 * 4 * 2 * 8, index + 8249344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 8, product* 2 * 7 * 2 * 2 * 6 * 2 * 8, index + 8262272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 8, product* 6 * 9 * 2 * 3 * 6 * 2 * 8, index + 8263296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 8, product* 4 * 2 * 4 * 3 * 6 * 2 * 8, index + 8263424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2 + 8, product* 6 * 3 * 9 * 3 * 6 * 2 * 8, index + 8263936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 8, product* 2 * 3 * 8 * 4 * 6 * 2 * 8, index + 8264832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 2 + 8, product* 8 * 6 * 3 * 6 * 6 * 2 * 8, index + 8266368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 8, product* 4 * 2 * 6 * 6 * 6 * 2 * 8, index + 8266624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 8, product* 4 * 6 * 2 * 7 * 6 * 2 * 8, index + 8267264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 8, product* 2 * 9 * 3 * 7 * 6 * 2 * 8, index + 8267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 8, product* 8 * 4 * 6 * 7 * 6 * 2 * 8, index + 8267648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 8, product* 2 * 7 * 6 * 8 * 6 * 2 * 8, index + 8268672);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 8, product* 4 * 8 * 3 * 2 * 7 * 2 * 8, index + 8272384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 8, product* 8 * 6 * 7 * 2 * 7 * 2 * 8, index + 8272768);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 8, product* 6 * 9 * 8 * 2 * 7 * 2 * 8, index + 8272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 8, product* 4 * 6 * 6 * 3 * 7 * 2 * 8, index + 8273664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 8, product* 2 * 9 * 7 * 3 * 7 * 2 * 8, index + 8273792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 8, product* 2 * 3 * 4 * 4 * 7 * 2 * 8, index + 8274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 8, product* 4 * 4 * 9 * 4 * 7 * 2 * 8, index + 8274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 8, product* 4 * 2 * 2 * 6 * 7 * 2 * 8, index + 8276224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 8, product* 8 * 4 * 2 * 7 * 7 * 2 * 8, index + 8277248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 8, product* 2 * 3 * 6 * 7 * 7 * 2 * 8, index + 8277632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 8, product* 2 * 7 * 2 * 8 * 7 * 2 * 8, index + 8278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 8, product* 8 * 6 * 3 * 2 * 8 * 2 * 8, index + 8282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 8, product* 4 * 2 * 6 * 2 * 8 * 2 * 8, index + 8282624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 8, product* 4 * 6 * 2 * 3 * 8 * 2 * 8, index + 8283264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 8, product* 2 * 9 * 3 * 3 * 8 * 2 * 8, index + 8283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 8, product* 8 * 4 * 6 * 3 * 8 * 2 * 8, index + 8283648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 2 + 8, product* 6 * 7 * 7 * 3 * 8 * 2 * 8, index + 8283776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 8, product* 8 * 8 * 2 * 4 * 8 * 2 * 8, index + 8284288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 8, product* 2 * 7 * 6 * 4 * 8 * 2 * 8, index + 8284672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 8, product* 8 * 2 * 9 * 4 * 8 * 2 * 8, index + 8284928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 8, product* 6 * 3 * 3 * 6 * 8 * 2 * 8, index + 8286336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 8, product* 4 * 6 * 4 * 6 * 8 * 2 * 8, index + 8286464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 8, product* 2 * 3 * 2 * 7 * 8 * 2 * 8, index + 8287232);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 8, product* 4 * 6 * 6 * 9 * 8 * 2 * 8, index + 8289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 8, product* 4 * 2 * 2 * 2 * 9 * 2 * 8, index + 8292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 8, product* 6 * 3 * 7 * 2 * 9 * 2 * 8, index + 8292736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 8, product* 2 * 9 * 9 * 2 * 9 * 2 * 8, index + 8292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 8, product* 8 * 4 * 2 * 3 * 9 * 2 * 8, index + 8293248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 8, product* 6 * 7 * 3 * 3 * 9 * 2 * 8, index + 8293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 8, product* 2 * 3 * 6 * 3 * 9 * 2 * 8, index + 8293632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2 + 8, product* 8 * 8 * 8 * 3 * 9 * 2 * 8, index + 8293888);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 8, product* 2 * 7 * 2 * 4 * 9 * 2 * 8, index + 8294272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 8, product* 2 * 3 * 8 * 6 * 9 * 2 * 8, index + 8296832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 8, product* 4 * 4 * 3 * 7 * 9 * 2 * 8, index + 8297344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 8, product* 2 * 7 * 4 * 7 * 9 * 2 * 8, index + 8297472);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2 + 8, product* 4 * 2 * 6 * 8 * 9 * 2 * 8, index + 8298624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 2 + 8, product* 4 * 6 * 2 * 9 * 9 * 2 * 8, index + 8299264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 8, product* 2 * 9 * 3 * 9 * 9 * 2 * 8, index + 8299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 8, product* 2 * 3 * 4 * 2 * 2 * 3 * 8, index + 8322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 8, product* 4 * 4 * 9 * 2 * 2 * 3 * 8, index + 8322944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 8, product* 8 * 2 * 3 * 3 * 2 * 3 * 8, index + 8323328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3 + 8, product* 8 * 6 * 9 * 3 * 2 * 3 * 8, index + 8323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 8, product* 4 * 2 * 2 * 4 * 2 * 3 * 8, index + 8324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 8, product* 6 * 3 * 7 * 4 * 2 * 3 * 8, index + 8324736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 8, product* 2 * 7 * 2 * 6 * 2 * 3 * 8, index + 8326272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 8, product* 6 * 9 * 2 * 7 * 2 * 3 * 8, index + 8327296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 8, product* 4 * 2 * 4 * 7 * 2 * 3 * 8, index + 8327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 8, product* 6 * 3 * 9 * 7 * 2 * 3 * 8, index + 8327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 8, product* 8 * 4 * 4 * 8 * 2 * 3 * 8, index + 8328448);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 8, product* 4 * 4 * 3 * 9 * 2 * 3 * 8, index + 8329344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 8, product* 2 * 7 * 4 * 9 * 2 * 3 * 8, index + 8329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 8, product* 8 * 2 * 7 * 9 * 2 * 3 * 8, index + 8329728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 8, product* 8 * 8 * 2 * 2 * 3 * 3 * 8, index + 8332288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 8, product* 2 * 7 * 6 * 2 * 3 * 3 * 8, index + 8332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 8, product* 8 * 2 * 9 * 2 * 3 * 3 * 8, index + 8332928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 8, product* 4 * 2 * 8 * 3 * 3 * 3 * 8, index + 8333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 8, product* 6 * 3 * 3 * 4 * 3 * 3 * 8, index + 8334336);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3 + 8, product* 6 * 7 * 9 * 4 * 3 * 3 * 8, index + 8334976);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 3 + 3 + 8, product* 8 * 6 * 7 * 6 * 3 * 3 * 8, index + 8336768);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 3 + 8, product* 6 * 9 * 8 * 6 * 3 * 3 * 8, index + 8336896);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 8, product* 2 * 3 * 4 * 8 * 3 * 3 * 8, index + 8338432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 8, product* 8 * 2 * 3 * 9 * 3 * 3 * 8, index + 8339328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 8, product* 2 * 7 * 2 * 2 * 4 * 3 * 8, index + 8342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 8, product* 4 * 8 * 7 * 2 * 4 * 3 * 8, index + 8342784);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 8, product* 4 * 2 * 4 * 3 * 4 * 3 * 8, index + 8343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 8, product* 6 * 3 * 9 * 3 * 4 * 3 * 8, index + 8343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 8, product* 8 * 4 * 4 * 4 * 4 * 3 * 8, index + 8344448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 8, product* 2 * 3 * 8 * 4 * 4 * 3 * 8, index + 8344832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 8, product* 8 * 6 * 3 * 6 * 4 * 3 * 8, index + 8346368);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3 + 8, product* 6 * 9 * 4 * 6 * 4 * 3 * 8, index + 8346496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 8, product* 4 * 2 * 6 * 6 * 4 * 3 * 8, index + 8346624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 8, product* 4 * 6 * 2 * 7 * 4 * 3 * 8, index + 8347264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 8, product* 2 * 9 * 3 * 7 * 4 * 3 * 8, index + 8347392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 8, product* 8 * 2 * 9 * 8 * 4 * 3 * 8, index + 8348928);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 8, product* 4 * 2 * 6 * 2 * 6 * 3 * 8, index + 8362624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 8, product* 4 * 6 * 2 * 3 * 6 * 3 * 8, index + 8363264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 8, product* 2 * 9 * 3 * 3 * 6 * 3 * 8, index + 8363392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 8, product* 8 * 8 * 2 * 4 * 6 * 3 * 8, index + 8364288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 8, product* 6 * 3 * 3 * 6 * 6 * 3 * 8, index + 8366336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 8, product* 4 * 6 * 4 * 6 * 6 * 3 * 8, index + 8366464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 3 + 8, product* 8 * 4 * 8 * 6 * 6 * 3 * 8, index + 8366848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 8, product* 2 * 3 * 2 * 7 * 6 * 3 * 8, index + 8367232);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6 + 3 + 8, product* 2 * 7 * 8 * 7 * 6 * 3 * 8, index + 8367872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 8, product* 4 * 2 * 2 * 2 * 7 * 3 * 8, index + 8372224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 8, product* 2 * 9 * 9 * 2 * 7 * 3 * 8, index + 8372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 8, product* 8 * 4 * 2 * 3 * 7 * 3 * 8, index + 8373248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 8, product* 2 * 3 * 6 * 3 * 7 * 3 * 8, index + 8373632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 8, product* 2 * 7 * 2 * 4 * 7 * 3 * 8, index + 8374272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 8, product* 4 * 4 * 3 * 7 * 7 * 3 * 8, index + 8377344);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 8, product* 8 * 2 * 7 * 7 * 7 * 3 * 8, index + 8377728);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3 + 8, product* 4 * 2 * 6 * 8 * 7 * 3 * 8, index + 8378624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 8, product* 4 * 6 * 2 * 9 * 7 * 3 * 8, index + 8379264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 8, product* 2 * 9 * 3 * 9 * 7 * 3 * 8, index + 8379392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 8, product* 6 * 3 * 3 * 2 * 8 * 3 * 8, index + 8382336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 8, product* 4 * 6 * 4 * 2 * 8 * 3 * 8, index + 8382464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 8, product* 2 * 3 * 2 * 3 * 8 * 3 * 8, index + 8383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 8, product* 8 * 8 * 4 * 3 * 8 * 3 * 8, index + 8383488);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 8, product* 4 * 8 * 3 * 4 * 8 * 3 * 8, index + 8384384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 8, product* 2 * 3 * 4 * 6 * 8 * 3 * 8, index + 8386432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 8, product* 8 * 2 * 3 * 7 * 8 * 3 * 8, index + 8387328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 8, product* 4 * 2 * 2 * 8 * 8 * 3 * 8, index + 8388224);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3 + 8, product* 2 * 3 * 6 * 9 * 8 * 3 * 8, index + 8389632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 8, product* 8 * 4 * 4 * 2 * 9 * 3 * 8, index + 8392448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 8, product* 2 * 3 * 8 * 2 * 9 * 3 * 8, index + 8392832);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 8, product* 2 * 7 * 4 * 3 * 9 * 3 * 8, index + 8393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 8, product* 8 * 2 * 7 * 3 * 9 * 3 * 8, index + 8393728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 8, product* 4 * 2 * 8 * 7 * 9 * 3 * 8, index + 8397824);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 8, product* 2 * 3 * 2 * 9 * 9 * 3 * 8, index + 8399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 8, product* 2 * 7 * 2 * 2 * 2 * 4 * 8, index + 8422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 8, product* 4 * 8 * 7 * 2 * 2 * 4 * 8, index + 8422784);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 8, product* 4 * 2 * 4 * 3 * 2 * 4 * 8, index + 8423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 8, product* 6 * 3 * 9 * 3 * 2 * 4 * 8, index + 8423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 8, product* 8 * 4 * 4 * 4 * 2 * 4 * 8, index + 8424448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 8, product* 2 * 3 * 8 * 4 * 2 * 4 * 8, index + 8424832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 8, product* 4 * 2 * 6 * 6 * 2 * 4 * 8, index + 8426624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 8, product* 4 * 6 * 2 * 7 * 2 * 4 * 8, index + 8427264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 8, product* 2 * 9 * 3 * 7 * 2 * 4 * 8, index + 8427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 8, product* 8 * 4 * 6 * 7 * 2 * 4 * 8, index + 8427648);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 8, product* 8 * 8 * 2 * 8 * 2 * 4 * 8, index + 8428288);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 8, product* 4 * 8 * 3 * 2 * 3 * 4 * 8, index + 8432384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 8, product* 6 * 9 * 8 * 2 * 3 * 4 * 8, index + 8432896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 8, product* 4 * 6 * 6 * 3 * 3 * 4 * 8, index + 8433664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 8, product* 2 * 9 * 7 * 3 * 3 * 4 * 8, index + 8433792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 8, product* 2 * 3 * 4 * 4 * 3 * 4 * 8, index + 8434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 8, product* 4 * 2 * 2 * 6 * 3 * 4 * 8, index + 8436224);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 8, product* 4 * 6 * 8 * 6 * 3 * 4 * 8, index + 8436864);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 8, product* 8 * 4 * 2 * 7 * 3 * 4 * 8, index + 8437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 8, product* 2 * 7 * 2 * 8 * 3 * 4 * 8, index + 8438272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 4 + 8, product* 4 * 8 * 7 * 8 * 3 * 4 * 8, index + 8438784);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 8, product* 4 * 2 * 4 * 9 * 3 * 4 * 8, index + 8439424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 8, product* 8 * 6 * 3 * 2 * 4 * 4 * 8, index + 8442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 8, product* 4 * 2 * 6 * 2 * 4 * 4 * 8, index + 8442624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 8, product* 4 * 6 * 2 * 3 * 4 * 4 * 8, index + 8443264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 8, product* 2 * 9 * 3 * 3 * 4 * 4 * 8, index + 8443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 8, product* 8 * 4 * 6 * 3 * 4 * 4 * 8, index + 8443648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 8, product* 2 * 7 * 6 * 4 * 4 * 4 * 8, index + 8444672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 8, product* 8 * 2 * 9 * 4 * 4 * 4 * 8, index + 8444928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 8, product* 6 * 3 * 3 * 6 * 4 * 4 * 8, index + 8446336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 4 + 8, product* 8 * 4 * 8 * 6 * 4 * 4 * 8, index + 8446848);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 4 + 8, product* 6 * 7 * 9 * 6 * 4 * 4 * 8, index + 8446976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 8, product* 2 * 3 * 2 * 7 * 4 * 4 * 8, index + 8447232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 8, product* 6 * 3 * 3 * 2 * 6 * 4 * 8, index + 8462336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 8, product* 4 * 6 * 4 * 2 * 6 * 4 * 8, index + 8462464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 8, product* 8 * 4 * 8 * 2 * 6 * 4 * 8, index + 8462848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 8, product* 2 * 3 * 2 * 3 * 6 * 4 * 8, index + 8463232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 8, product* 2 * 7 * 8 * 3 * 6 * 4 * 8, index + 8463872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 8, product* 4 * 8 * 3 * 4 * 6 * 4 * 8, index + 8464384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 8, product* 2 * 3 * 4 * 6 * 6 * 4 * 8, index + 8466432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 4 + 8, product* 4 * 4 * 9 * 6 * 6 * 4 * 8, index + 8466944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 8, product* 4 * 2 * 2 * 8 * 6 * 4 * 8, index + 8468224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 8, product* 8 * 4 * 2 * 9 * 6 * 4 * 8, index + 8469248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 8, product* 2 * 3 * 8 * 2 * 7 * 4 * 8, index + 8472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 8, product* 4 * 4 * 3 * 3 * 7 * 4 * 8, index + 8473344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 8, product* 4 * 2 * 6 * 4 * 7 * 4 * 8, index + 8474624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 8, product* 2 * 7 * 6 * 6 * 7 * 4 * 8, index + 8476672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 4 + 8, product* 8 * 2 * 9 * 6 * 7 * 4 * 8, index + 8476928);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 8, product* 6 * 3 * 3 * 8 * 7 * 4 * 8, index + 8478336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 8, product* 2 * 3 * 2 * 9 * 7 * 4 * 8, index + 8479232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 4 + 8, product* 4 * 4 * 7 * 9 * 7 * 4 * 8, index + 8479744);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 8, product* 2 * 3 * 4 * 2 * 8 * 4 * 8, index + 8482432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 8, product* 8 * 2 * 3 * 3 * 8 * 4 * 8, index + 8483328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 8, product* 4 * 2 * 2 * 4 * 8 * 4 * 8, index + 8484224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 4 + 8, product* 4 * 6 * 8 * 4 * 8 * 4 * 8, index + 8484864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 8, product* 2 * 7 * 2 * 6 * 8 * 4 * 8, index + 8486272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 8, product* 4 * 2 * 4 * 7 * 8 * 4 * 8, index + 8487424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 4 + 8, product* 8 * 4 * 4 * 8 * 8 * 4 * 8, index + 8488448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 8, product* 2 * 7 * 4 * 9 * 8 * 4 * 8, index + 8489472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 4 + 8, product* 8 * 2 * 7 * 9 * 8 * 4 * 8, index + 8489728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4 + 8, product* 8 * 8 * 2 * 2 * 9 * 4 * 8, index + 8492288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 8, product* 4 * 2 * 8 * 3 * 9 * 4 * 8, index + 8493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 8, product* 6 * 3 * 3 * 4 * 9 * 4 * 8, index + 8494336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 4 + 8, product* 4 * 6 * 4 * 4 * 9 * 4 * 8, index + 8494464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 4 + 8, product* 6 * 7 * 9 * 4 * 9 * 4 * 8, index + 8494976);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 8, product* 6 * 3 * 3 * 2 * 2 * 6 * 8, index + 8622336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 8, product* 4 * 6 * 4 * 2 * 2 * 6 * 8, index + 8622464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 8, product* 8 * 4 * 8 * 2 * 2 * 6 * 8, index + 8622848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 8, product* 2 * 3 * 2 * 3 * 2 * 6 * 8, index + 8623232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 6 + 8, product* 8 * 8 * 4 * 3 * 2 * 6 * 8, index + 8623488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 8, product* 4 * 4 * 7 * 3 * 2 * 6 * 8, index + 8623744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 8, product* 2 * 7 * 8 * 3 * 2 * 6 * 8, index + 8623872);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 8, product* 6 * 9 * 8 * 4 * 2 * 6 * 8, index + 8624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 8, product* 2 * 3 * 4 * 6 * 2 * 6 * 8, index + 8626432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 8, product* 8 * 2 * 3 * 7 * 2 * 6 * 8, index + 8627328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 8, product* 4 * 2 * 2 * 8 * 2 * 6 * 8, index + 8628224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 6 + 8, product* 8 * 4 * 2 * 9 * 2 * 6 * 8, index + 8629248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 8, product* 6 * 7 * 3 * 9 * 2 * 6 * 8, index + 8629376);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 8, product* 8 * 4 * 4 * 2 * 3 * 6 * 8, index + 8632448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 8, product* 2 * 3 * 8 * 2 * 3 * 6 * 8, index + 8632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 8, product* 4 * 4 * 3 * 3 * 3 * 6 * 8, index + 8633344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 8, product* 2 * 7 * 4 * 3 * 3 * 6 * 8, index + 8633472);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 8, product* 4 * 2 * 6 * 4 * 3 * 6 * 8, index + 8634624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 8, product* 2 * 7 * 6 * 6 * 3 * 6 * 8, index + 8636672);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 8, product* 4 * 2 * 8 * 7 * 3 * 6 * 8, index + 8637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 8, product* 6 * 3 * 3 * 8 * 3 * 6 * 8, index + 8638336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 8, product* 2 * 3 * 2 * 9 * 3 * 6 * 8, index + 8639232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 8, product* 2 * 3 * 4 * 2 * 4 * 6 * 8, index + 8642432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 8, product* 8 * 2 * 3 * 3 * 4 * 6 * 8, index + 8643328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 8, product* 4 * 2 * 2 * 4 * 4 * 6 * 8, index + 8644224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 6 + 8, product* 6 * 3 * 7 * 4 * 4 * 6 * 8, index + 8644736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 8, product* 2 * 7 * 2 * 6 * 4 * 6 * 8, index + 8646272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 8, product* 6 * 9 * 2 * 7 * 4 * 6 * 8, index + 8647296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 8, product* 4 * 2 * 4 * 7 * 4 * 6 * 8, index + 8647424);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 6 + 8, product* 4 * 4 * 3 * 9 * 4 * 6 * 8, index + 8649344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 8, product* 2 * 7 * 2 * 2 * 6 * 6 * 8, index + 8662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 8, product* 4 * 8 * 7 * 2 * 6 * 6 * 8, index + 8662784);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 8, product* 4 * 2 * 4 * 3 * 6 * 6 * 8, index + 8663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 8, product* 6 * 3 * 9 * 3 * 6 * 6 * 8, index + 8663936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 8, product* 2 * 3 * 8 * 4 * 6 * 6 * 8, index + 8664832);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 8, product* 4 * 8 * 3 * 2 * 7 * 6 * 8, index + 8672384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 6 + 8, product* 8 * 6 * 7 * 2 * 7 * 6 * 8, index + 8672768);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 8, product* 2 * 3 * 4 * 4 * 7 * 6 * 8, index + 8674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 8, product* 4 * 2 * 2 * 6 * 7 * 6 * 8, index + 8676224);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 8, product* 4 * 2 * 4 * 9 * 7 * 6 * 8, index + 8679424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6 + 8, product* 6 * 9 * 4 * 2 * 8 * 6 * 8, index + 8682496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 8, product* 4 * 6 * 2 * 3 * 8 * 6 * 8, index + 8683264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 6 + 8, product* 6 * 3 * 3 * 6 * 8 * 6 * 8, index + 8686336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 8, product* 2 * 3 * 2 * 7 * 8 * 6 * 8, index + 8687232);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 6 + 8, product* 2 * 7 * 8 * 7 * 8 * 6 * 8, index + 8687872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 8, product* 4 * 2 * 2 * 2 * 9 * 6 * 8, index + 8692224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 6 + 8, product* 6 * 3 * 7 * 2 * 9 * 6 * 8, index + 8692736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6 + 8, product* 4 * 6 * 8 * 2 * 9 * 6 * 8, index + 8692864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 8, product* 2 * 3 * 6 * 3 * 9 * 6 * 8, index + 8693632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 8, product* 2 * 7 * 2 * 4 * 9 * 6 * 8, index + 8694272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 8, product* 2 * 3 * 8 * 6 * 9 * 6 * 8, index + 8696832);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 6 + 8, product* 8 * 6 * 3 * 8 * 9 * 6 * 8, index + 8698368);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 6 + 8, product* 4 * 6 * 2 * 9 * 9 * 6 * 8, index + 8699264);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 8, product* 2 * 3 * 4 * 2 * 2 * 7 * 8, index + 8722432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 7 + 8, product* 8 * 8 * 6 * 2 * 2 * 7 * 8, index + 8722688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 8, product* 4 * 4 * 9 * 2 * 2 * 7 * 8, index + 8722944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 8, product* 8 * 2 * 3 * 3 * 2 * 7 * 8, index + 8723328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 8, product* 4 * 2 * 2 * 4 * 2 * 7 * 8, index + 8724224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7 + 8, product* 6 * 3 * 7 * 4 * 2 * 7 * 8, index + 8724736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 8, product* 2 * 9 * 9 * 4 * 2 * 7 * 8, index + 8724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 8, product* 2 * 7 * 2 * 6 * 2 * 7 * 8, index + 8726272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 8, product* 6 * 9 * 2 * 7 * 2 * 7 * 8, index + 8727296);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 8, product* 8 * 4 * 4 * 8 * 2 * 7 * 8, index + 8728448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 8, product* 2 * 3 * 8 * 8 * 2 * 7 * 8, index + 8728832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 8, product* 4 * 4 * 3 * 9 * 2 * 7 * 8, index + 8729344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 8, product* 2 * 7 * 4 * 9 * 2 * 7 * 8, index + 8729472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 8, product* 8 * 2 * 7 * 9 * 2 * 7 * 8, index + 8729728);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 8, product* 2 * 7 * 6 * 2 * 3 * 7 * 8, index + 8732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 8, product* 8 * 2 * 9 * 2 * 3 * 7 * 8, index + 8732928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 7 + 8, product* 6 * 9 * 6 * 3 * 3 * 7 * 8, index + 8733696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 8, product* 4 * 2 * 8 * 3 * 3 * 7 * 8, index + 8733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 8, product* 6 * 3 * 3 * 4 * 3 * 7 * 8, index + 8734336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 8, product* 4 * 6 * 4 * 4 * 3 * 7 * 8, index + 8734464);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 8, product* 4 * 8 * 3 * 6 * 3 * 7 * 8, index + 8736384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 8, product* 2 * 3 * 4 * 8 * 3 * 7 * 8, index + 8738432);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 8, product* 8 * 2 * 3 * 9 * 3 * 7 * 8, index + 8739328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 8, product* 2 * 7 * 2 * 2 * 4 * 7 * 8, index + 8742272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 8, product* 4 * 2 * 4 * 3 * 4 * 7 * 8, index + 8743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 8, product* 6 * 3 * 9 * 3 * 4 * 7 * 8, index + 8743936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 7 + 8, product* 8 * 4 * 4 * 4 * 4 * 7 * 8, index + 8744448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 7 + 8, product* 6 * 9 * 4 * 6 * 4 * 7 * 8, index + 8746496);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 8, product* 4 * 2 * 6 * 6 * 4 * 7 * 8, index + 8746624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 8, product* 2 * 9 * 3 * 7 * 4 * 7 * 8, index + 8747392);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7 + 8, product* 8 * 6 * 3 * 2 * 6 * 7 * 8, index + 8762368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 8, product* 4 * 2 * 6 * 2 * 6 * 7 * 8, index + 8762624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 8, product* 2 * 9 * 3 * 3 * 6 * 7 * 8, index + 8763392);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 8, product* 6 * 3 * 3 * 6 * 6 * 7 * 8, index + 8766336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 7 + 8, product* 8 * 4 * 8 * 6 * 6 * 7 * 8, index + 8766848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 8, product* 2 * 3 * 2 * 7 * 6 * 7 * 8, index + 8767232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 7 + 8, product* 4 * 8 * 3 * 8 * 6 * 7 * 8, index + 8768384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 8, product* 4 * 2 * 2 * 2 * 7 * 7 * 8, index + 8772224);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 7 + 8, product* 4 * 6 * 8 * 2 * 7 * 7 * 8, index + 8772864);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 8, product* 8 * 4 * 2 * 3 * 7 * 7 * 8, index + 8773248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 7 + 8, product* 6 * 7 * 3 * 3 * 7 * 7 * 8, index + 8773376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 8, product* 2 * 3 * 6 * 3 * 7 * 7 * 8, index + 8773632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 8, product* 2 * 7 * 2 * 4 * 7 * 7 * 8, index + 8774272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 8, product* 2 * 3 * 8 * 6 * 7 * 7 * 8, index + 8776832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 7 + 8, product* 2 * 9 * 3 * 9 * 7 * 7 * 8, index + 8779392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 8, product* 6 * 3 * 3 * 2 * 8 * 7 * 8, index + 8782336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 8, product* 2 * 3 * 2 * 3 * 8 * 7 * 8, index + 8783232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7 + 8, product* 4 * 4 * 7 * 3 * 8 * 7 * 8, index + 8783744);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 8, product* 2 * 3 * 4 * 6 * 8 * 7 * 8, index + 8786432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 8, product* 4 * 2 * 2 * 8 * 8 * 7 * 8, index + 8788224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 8, product* 2 * 3 * 8 * 2 * 9 * 7 * 8, index + 8792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 8, product* 4 * 4 * 3 * 3 * 9 * 7 * 8, index + 8793344);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 7 + 8, product* 6 * 9 * 4 * 4 * 9 * 7 * 8, index + 8794496);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 8, product* 2 * 3 * 2 * 9 * 9 * 7 * 8, index + 8799232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 8, product* 2 * 7 * 2 * 2 * 2 * 8 * 8, index + 8822272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 8, product* 6 * 9 * 2 * 3 * 2 * 8 * 8, index + 8823296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 8, product* 4 * 2 * 4 * 3 * 2 * 8 * 8, index + 8823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 8, product* 6 * 3 * 9 * 3 * 2 * 8 * 8, index + 8823936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 8, product* 2 * 3 * 8 * 4 * 2 * 8 * 8, index + 8824832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 8 + 8, product* 4 * 2 * 6 * 6 * 2 * 8 * 8, index + 8826624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 8, product* 2 * 9 * 3 * 7 * 2 * 8 * 8, index + 8827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 8, product* 8 * 4 * 6 * 7 * 2 * 8 * 8, index + 8827648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 8 + 8, product* 2 * 7 * 6 * 8 * 2 * 8 * 8, index + 8828672);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 8, product* 4 * 2 * 8 * 9 * 2 * 8 * 8, index + 8829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 8, product* 4 * 8 * 3 * 2 * 3 * 8 * 8, index + 8832384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8 + 8, product* 4 * 6 * 6 * 3 * 3 * 8 * 8, index + 8833664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 8, product* 2 * 9 * 7 * 3 * 3 * 8 * 8, index + 8833792);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 8, product* 4 * 2 * 2 * 6 * 3 * 8 * 8, index + 8836224);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 8 + 8, product* 4 * 6 * 8 * 6 * 3 * 8 * 8, index + 8836864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 8, product* 2 * 3 * 6 * 7 * 3 * 8 * 8, index + 8837632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 8, product* 2 * 7 * 2 * 8 * 3 * 8 * 8, index + 8838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 8, product* 6 * 9 * 2 * 9 * 3 * 8 * 8, index + 8839296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8 + 8, product* 4 * 2 * 4 * 9 * 3 * 8 * 8, index + 8839424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 8 + 8, product* 6 * 9 * 4 * 2 * 4 * 8 * 8, index + 8842496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 8, product* 4 * 2 * 6 * 2 * 4 * 8 * 8, index + 8842624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 8, product* 4 * 6 * 2 * 3 * 4 * 8 * 8, index + 8843264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 8, product* 2 * 9 * 3 * 3 * 4 * 8 * 8, index + 8843392);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 8, product* 6 * 3 * 3 * 6 * 4 * 8 * 8, index + 8846336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8 + 8, product* 4 * 6 * 4 * 6 * 4 * 8 * 8, index + 8846464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 8, product* 2 * 3 * 2 * 7 * 4 * 8 * 8, index + 8847232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 8, product* 6 * 3 * 3 * 2 * 6 * 8 * 8, index + 8862336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 8, product* 2 * 3 * 2 * 3 * 6 * 8 * 8, index + 8863232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 8, product* 2 * 7 * 8 * 3 * 6 * 8 * 8, index + 8863872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 8, product* 2 * 3 * 4 * 6 * 6 * 8 * 8, index + 8866432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 8 + 8, product* 8 * 2 * 3 * 7 * 6 * 8 * 8, index + 8867328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 8, product* 2 * 3 * 6 * 9 * 6 * 8 * 8, index + 8869632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 8, product* 2 * 3 * 8 * 2 * 7 * 8 * 8, index + 8872832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 8, product* 4 * 2 * 6 * 4 * 7 * 8 * 8, index + 8874624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 8, product* 2 * 3 * 2 * 9 * 7 * 8 * 8, index + 8879232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 8, product* 2 * 3 * 4 * 2 * 8 * 8 * 8, index + 8882432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 8, product* 8 * 2 * 3 * 3 * 8 * 8 * 8, index + 8883328);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 8 + 8, product* 8 * 6 * 9 * 3 * 8 * 8 * 8, index + 8883968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 8, product* 4 * 2 * 2 * 4 * 8 * 8 * 8, index + 8884224);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 8 + 8, product* 8 * 2 * 9 * 2 * 9 * 8 * 8, index + 8892928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 8, product* 4 * 2 * 8 * 3 * 9 * 8 * 8, index + 8893824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 8, product* 8 * 6 * 3 * 2 * 2 * 9 * 8, index + 8922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 8, product* 4 * 2 * 6 * 2 * 2 * 9 * 8, index + 8922624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 8, product* 4 * 6 * 2 * 3 * 2 * 9 * 8, index + 8923264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 8, product* 2 * 9 * 3 * 3 * 2 * 9 * 8, index + 8923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9 + 8, product* 8 * 4 * 6 * 3 * 2 * 9 * 8, index + 8923648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 8, product* 2 * 7 * 6 * 4 * 2 * 9 * 8, index + 8924672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9 + 8, product* 8 * 2 * 9 * 4 * 2 * 9 * 8, index + 8924928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 8, product* 6 * 3 * 3 * 6 * 2 * 9 * 8, index + 8926336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 8, product* 2 * 3 * 2 * 7 * 2 * 9 * 8, index + 8927232);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 9 + 8, product* 2 * 7 * 8 * 7 * 2 * 9 * 8, index + 8927872);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 9 + 8, product* 6 * 9 * 8 * 8 * 2 * 9 * 8, index + 8928896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 8, product* 4 * 2 * 2 * 2 * 3 * 9 * 8, index + 8932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 8, product* 6 * 3 * 7 * 2 * 3 * 9 * 8, index + 8932736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 8, product* 2 * 9 * 9 * 2 * 3 * 9 * 8, index + 8932992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 8, product* 2 * 7 * 2 * 4 * 3 * 9 * 8, index + 8934272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 9 + 8, product* 4 * 8 * 7 * 4 * 3 * 9 * 8, index + 8934784);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 8, product* 8 * 2 * 7 * 7 * 3 * 9 * 8, index + 8937728);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 8, product* 6 * 3 * 3 * 2 * 4 * 9 * 8, index + 8942336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 8, product* 2 * 3 * 2 * 3 * 4 * 9 * 8, index + 8943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 8, product* 4 * 4 * 7 * 3 * 4 * 9 * 8, index + 8943744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 8, product* 2 * 7 * 8 * 3 * 4 * 9 * 8, index + 8943872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 8, product* 4 * 8 * 3 * 4 * 4 * 9 * 8, index + 8944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 8, product* 2 * 3 * 4 * 6 * 4 * 9 * 8, index + 8946432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 8, product* 8 * 2 * 3 * 7 * 4 * 9 * 8, index + 8947328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 8, product* 4 * 2 * 2 * 8 * 4 * 9 * 8, index + 8948224);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 8, product* 2 * 3 * 4 * 2 * 6 * 9 * 8, index + 8962432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 9 + 8, product* 4 * 4 * 9 * 2 * 6 * 9 * 8, index + 8962944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 8, product* 4 * 2 * 2 * 4 * 6 * 9 * 8, index + 8964224);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 9 + 8, product* 4 * 2 * 4 * 7 * 6 * 9 * 8, index + 8967424);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 9 + 8, product* 8 * 8 * 2 * 2 * 7 * 9 * 8, index + 8972288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 9 + 8, product* 2 * 7 * 6 * 2 * 7 * 9 * 8, index + 8972672);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 8, product* 2 * 3 * 4 * 8 * 7 * 9 * 8, index + 8978432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 8, product* 2 * 7 * 2 * 2 * 8 * 9 * 8, index + 8982272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 8, product* 4 * 2 * 4 * 3 * 8 * 9 * 8, index + 8983424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 9, product* 2 * 7 * 2 * 2 * 2 * 2 * 9, index + 9222272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 9, product* 6 * 3 * 3 * 2 * 2 * 2 * 9, index + 9222336);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 9, product* 4 * 8 * 7 * 2 * 2 * 2 * 9, index + 9222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 9, product* 6 * 9 * 2 * 3 * 2 * 2 * 9, index + 9223296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 9, product* 4 * 2 * 4 * 3 * 2 * 2 * 9, index + 9223424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 9, product* 6 * 3 * 9 * 3 * 2 * 2 * 9, index + 9223936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 9, product* 8 * 4 * 4 * 4 * 2 * 2 * 9, index + 9224448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 9, product* 2 * 3 * 8 * 4 * 2 * 2 * 9, index + 9224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 9, product* 8 * 6 * 3 * 6 * 2 * 2 * 9, index + 9226368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 9, product* 4 * 2 * 6 * 6 * 2 * 2 * 9, index + 9226624);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 9, product* 4 * 6 * 2 * 7 * 2 * 2 * 9, index + 9227264);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 9, product* 2 * 9 * 3 * 7 * 2 * 2 * 9, index + 9227392);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2 + 9, product* 8 * 8 * 2 * 8 * 2 * 2 * 9, index + 9228288);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 9, product* 8 * 2 * 9 * 8 * 2 * 2 * 9, index + 9228928);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2 + 9, product* 4 * 2 * 8 * 9 * 2 * 2 * 9, index + 9229824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 9, product* 4 * 8 * 3 * 2 * 3 * 2 * 9, index + 9232384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 9, product* 4 * 6 * 6 * 3 * 3 * 2 * 9, index + 9233664);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 9, product* 2 * 9 * 7 * 3 * 3 * 2 * 9, index + 9233792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 9, product* 2 * 3 * 4 * 4 * 3 * 2 * 9, index + 9234432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 2 + 9, product* 8 * 8 * 6 * 4 * 3 * 2 * 9, index + 9234688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 9, product* 4 * 4 * 9 * 4 * 3 * 2 * 9, index + 9234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 9, product* 4 * 2 * 2 * 6 * 3 * 2 * 9, index + 9236224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 2 + 9, product* 6 * 3 * 7 * 6 * 3 * 2 * 9, index + 9236736);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 9, product* 4 * 6 * 8 * 6 * 3 * 2 * 9, index + 9236864);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 9, product* 8 * 4 * 2 * 7 * 3 * 2 * 9, index + 9237248);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 9, product* 6 * 7 * 3 * 7 * 3 * 2 * 9, index + 9237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 9, product* 2 * 3 * 6 * 7 * 3 * 2 * 9, index + 9237632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 9, product* 2 * 7 * 2 * 8 * 3 * 2 * 9, index + 9238272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 2 + 9, product* 6 * 9 * 2 * 9 * 3 * 2 * 9, index + 9239296);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 9, product* 4 * 2 * 4 * 9 * 3 * 2 * 9, index + 9239424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 9, product* 8 * 6 * 3 * 2 * 4 * 2 * 9, index + 9242368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 9, product* 4 * 2 * 6 * 2 * 4 * 2 * 9, index + 9242624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 9, product* 4 * 6 * 2 * 3 * 4 * 2 * 9, index + 9243264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 9, product* 2 * 9 * 3 * 3 * 4 * 2 * 9, index + 9243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 9, product* 8 * 4 * 6 * 3 * 4 * 2 * 9, index + 9243648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 9, product* 6 * 7 * 7 * 3 * 4 * 2 * 9, index + 9243776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 9, product* 8 * 8 * 2 * 4 * 4 * 2 * 9, index + 9244288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 9, product* 2 * 7 * 6 * 4 * 4 * 2 * 9, index + 9244672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 9, product* 6 * 3 * 3 * 6 * 4 * 2 * 9, index + 9246336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 9, product* 2 * 3 * 2 * 7 * 4 * 2 * 9, index + 9247232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 2 + 9, product* 4 * 4 * 7 * 7 * 4 * 2 * 9, index + 9247744);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 9, product* 4 * 8 * 3 * 8 * 4 * 2 * 9, index + 9248384);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 2 + 9, product* 2 * 9 * 7 * 9 * 4 * 2 * 9, index + 9249792);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 9, product* 6 * 3 * 3 * 2 * 6 * 2 * 9, index + 9262336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 9, product* 4 * 6 * 4 * 2 * 6 * 2 * 9, index + 9262464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 9, product* 8 * 4 * 8 * 2 * 6 * 2 * 9, index + 9262848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 9, product* 2 * 3 * 2 * 3 * 6 * 2 * 9, index + 9263232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 9, product* 2 * 7 * 8 * 3 * 6 * 2 * 9, index + 9263872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 9, product* 4 * 8 * 3 * 4 * 6 * 2 * 9, index + 9264384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 9, product* 2 * 3 * 4 * 6 * 6 * 2 * 9, index + 9266432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 2 + 9, product* 4 * 4 * 9 * 6 * 6 * 2 * 9, index + 9266944);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 9, product* 8 * 2 * 3 * 7 * 6 * 2 * 9, index + 9267328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 9, product* 4 * 2 * 2 * 8 * 6 * 2 * 9, index + 9268224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 2 + 9, product* 2 * 9 * 9 * 8 * 6 * 2 * 9, index + 9268992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 2 + 9, product* 8 * 4 * 2 * 9 * 6 * 2 * 9, index + 9269248);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 9, product* 8 * 4 * 4 * 2 * 7 * 2 * 9, index + 9272448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 9, product* 2 * 3 * 8 * 2 * 7 * 2 * 9, index + 9272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 9, product* 4 * 4 * 3 * 3 * 7 * 2 * 9, index + 9273344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 9, product* 2 * 7 * 4 * 3 * 7 * 2 * 9, index + 9273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 9, product* 8 * 2 * 7 * 3 * 7 * 2 * 9, index + 9273728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 9, product* 4 * 8 * 9 * 3 * 7 * 2 * 9, index + 9273984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 9, product* 8 * 6 * 3 * 4 * 7 * 2 * 9, index + 9274368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 9, product* 4 * 2 * 6 * 4 * 7 * 2 * 9, index + 9274624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 9, product* 2 * 7 * 6 * 6 * 7 * 2 * 9, index + 9276672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 2 + 9, product* 8 * 2 * 9 * 6 * 7 * 2 * 9, index + 9276928);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 9, product* 4 * 2 * 8 * 7 * 7 * 2 * 9, index + 9277824);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 9, product* 2 * 3 * 2 * 9 * 7 * 2 * 9, index + 9279232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7 + 2 + 9, product* 8 * 8 * 4 * 9 * 7 * 2 * 9, index + 9279488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 2 + 9, product* 4 * 4 * 7 * 9 * 7 * 2 * 9, index + 9279744);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 9, product* 2 * 3 * 4 * 2 * 8 * 2 * 9, index + 9282432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 9, product* 4 * 4 * 9 * 2 * 8 * 2 * 9, index + 9282944);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 9, product* 8 * 2 * 3 * 3 * 8 * 2 * 9, index + 9283328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 9, product* 4 * 2 * 2 * 4 * 8 * 2 * 9, index + 9284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 9, product* 6 * 3 * 7 * 4 * 8 * 2 * 9, index + 9284736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 9, product* 2 * 7 * 2 * 6 * 8 * 2 * 9, index + 9286272);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2 + 9, product* 4 * 2 * 4 * 7 * 8 * 2 * 9, index + 9287424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8 + 2 + 9, product* 6 * 3 * 9 * 7 * 8 * 2 * 9, index + 9287936);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2 + 9, product* 2 * 3 * 8 * 8 * 8 * 2 * 9, index + 9288832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 2 + 9, product* 4 * 4 * 3 * 9 * 8 * 2 * 9, index + 9289344);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 2 + 9, product* 2 * 7 * 4 * 9 * 8 * 2 * 9, index + 9289472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 2 + 9, product* 8 * 2 * 7 * 9 * 8 * 2 * 9, index + 9289728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 9, product* 8 * 8 * 2 * 2 * 9 * 2 * 9, index + 9292288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 9, product* 2 * 7 * 6 * 2 * 9 * 2 * 9, index + 9292672);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 9, product* 4 * 2 * 8 * 3 * 9 * 2 * 9, index + 9293824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 2 + 9, product* 6 * 3 * 3 * 4 * 9 * 2 * 9, index + 9294336);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 9, product* 4 * 6 * 4 * 4 * 9 * 2 * 9, index + 9294464);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 2 + 9, product* 8 * 4 * 8 * 4 * 9 * 2 * 9, index + 9294848);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 2 + 9, product* 4 * 6 * 6 * 7 * 9 * 2 * 9, index + 9297664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 9, product* 2 * 3 * 4 * 8 * 9 * 2 * 9, index + 9298432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 2 + 9, product* 4 * 4 * 9 * 8 * 9 * 2 * 9, index + 9298944);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 9, product* 8 * 6 * 3 * 2 * 2 * 3 * 9, index + 9322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 9, product* 4 * 2 * 6 * 2 * 2 * 3 * 9, index + 9322624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 9, product* 4 * 6 * 2 * 3 * 2 * 3 * 9, index + 9323264);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 9, product* 8 * 4 * 6 * 3 * 2 * 3 * 9, index + 9323648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 9, product* 6 * 7 * 7 * 3 * 2 * 3 * 9, index + 9323776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 9, product* 8 * 8 * 2 * 4 * 2 * 3 * 9, index + 9324288);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 9, product* 8 * 2 * 9 * 4 * 2 * 3 * 9, index + 9324928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 9, product* 6 * 3 * 3 * 6 * 2 * 3 * 9, index + 9326336);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 9, product* 4 * 6 * 4 * 6 * 2 * 3 * 9, index + 9326464);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 3 + 9, product* 8 * 4 * 8 * 6 * 2 * 3 * 9, index + 9326848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 9, product* 2 * 3 * 2 * 7 * 2 * 3 * 9, index + 9327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 9, product* 8 * 8 * 4 * 7 * 2 * 3 * 9, index + 9327488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 9, product* 4 * 4 * 7 * 7 * 2 * 3 * 9, index + 9327744);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 9, product* 2 * 7 * 8 * 7 * 2 * 3 * 9, index + 9327872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 9, product* 4 * 8 * 3 * 8 * 2 * 3 * 9, index + 9328384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3 + 9, product* 8 * 6 * 7 * 8 * 2 * 3 * 9, index + 9328768);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 3 + 9, product* 4 * 6 * 6 * 9 * 2 * 3 * 9, index + 9329664);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 9, product* 2 * 9 * 7 * 9 * 2 * 3 * 9, index + 9329792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 9, product* 4 * 2 * 2 * 2 * 3 * 3 * 9, index + 9332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 9, product* 6 * 3 * 7 * 2 * 3 * 3 * 9, index + 9332736);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 9, product* 4 * 6 * 8 * 2 * 3 * 3 * 9, index + 9332864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 9, product* 2 * 9 * 9 * 2 * 3 * 3 * 9, index + 9332992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 9, product* 8 * 4 * 2 * 3 * 3 * 3 * 9, index + 9333248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 9, product* 6 * 7 * 3 * 3 * 3 * 3 * 9, index + 9333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 9, product* 2 * 3 * 6 * 3 * 3 * 3 * 9, index + 9333632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 9, product* 2 * 7 * 2 * 4 * 3 * 3 * 9, index + 9334272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 9, product* 2 * 3 * 8 * 6 * 3 * 3 * 9, index + 9336832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 9, product* 4 * 4 * 3 * 7 * 3 * 3 * 9, index + 9337344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 9, product* 2 * 7 * 4 * 7 * 3 * 3 * 9, index + 9337472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 3 + 9, product* 8 * 2 * 7 * 7 * 3 * 3 * 9, index + 9337728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3 + 3 + 9, product* 4 * 8 * 9 * 7 * 3 * 3 * 9, index + 9337984);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 9, product* 4 * 2 * 6 * 8 * 3 * 3 * 9, index + 9338624);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 9, product* 4 * 6 * 2 * 9 * 3 * 3 * 9, index + 9339264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 9, product* 2 * 9 * 3 * 9 * 3 * 3 * 9, index + 9339392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 9, product* 6 * 3 * 3 * 2 * 4 * 3 * 9, index + 9342336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 9, product* 4 * 6 * 4 * 2 * 4 * 3 * 9, index + 9342464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 9, product* 8 * 4 * 8 * 2 * 4 * 3 * 9, index + 9342848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 3 + 9, product* 6 * 7 * 9 * 2 * 4 * 3 * 9, index + 9342976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 9, product* 2 * 3 * 2 * 3 * 4 * 3 * 9, index + 9343232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3 + 9, product* 8 * 8 * 4 * 3 * 4 * 3 * 9, index + 9343488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 9, product* 4 * 4 * 7 * 3 * 4 * 3 * 9, index + 9343744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 9, product* 2 * 7 * 8 * 3 * 4 * 3 * 9, index + 9343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 9, product* 4 * 8 * 3 * 4 * 4 * 3 * 9, index + 9344384);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3 + 9, product* 8 * 6 * 7 * 4 * 4 * 3 * 9, index + 9344768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 9, product* 8 * 2 * 3 * 7 * 4 * 3 * 9, index + 9347328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 9, product* 4 * 2 * 2 * 8 * 4 * 3 * 9, index + 9348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 9, product* 6 * 3 * 7 * 8 * 4 * 3 * 9, index + 9348736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 9, product* 8 * 4 * 2 * 9 * 4 * 3 * 9, index + 9349248);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 9, product* 2 * 3 * 6 * 9 * 4 * 3 * 9, index + 9349632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 9, product* 2 * 3 * 4 * 2 * 6 * 3 * 9, index + 9362432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 9, product* 4 * 4 * 9 * 2 * 6 * 3 * 9, index + 9362944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 9, product* 8 * 6 * 9 * 3 * 6 * 3 * 9, index + 9363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 9, product* 4 * 2 * 2 * 4 * 6 * 3 * 9, index + 9364224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 3 + 9, product* 6 * 3 * 7 * 4 * 6 * 3 * 9, index + 9364736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6 + 3 + 9, product* 2 * 9 * 9 * 4 * 6 * 3 * 9, index + 9364992);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 9, product* 4 * 2 * 4 * 7 * 6 * 3 * 9, index + 9367424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 9, product* 8 * 4 * 4 * 8 * 6 * 3 * 9, index + 9368448);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 3 + 9, product* 2 * 3 * 8 * 8 * 6 * 3 * 9, index + 9368832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 3 + 9, product* 4 * 4 * 3 * 9 * 6 * 3 * 9, index + 9369344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 9, product* 2 * 7 * 6 * 2 * 7 * 3 * 9, index + 9372672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 9, product* 6 * 3 * 7 * 2 * 7 * 3 * 9, index + 9372736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3 + 9, product* 8 * 2 * 9 * 2 * 7 * 3 * 9, index + 9372928);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 9, product* 2 * 3 * 6 * 3 * 7 * 3 * 9, index + 9373632);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 7 + 3 + 9, product* 6 * 9 * 6 * 3 * 7 * 3 * 9, index + 9373696);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 9, product* 4 * 2 * 8 * 3 * 7 * 3 * 9, index + 9373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 9, product* 6 * 3 * 3 * 4 * 7 * 3 * 9, index + 9374336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 9, product* 2 * 3 * 4 * 8 * 7 * 3 * 9, index + 9378432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 9, product* 2 * 7 * 2 * 2 * 8 * 3 * 9, index + 9382272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 9, product* 4 * 2 * 4 * 3 * 8 * 3 * 9, index + 9383424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 3 + 9, product* 6 * 3 * 9 * 3 * 8 * 3 * 9, index + 9383936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 3 + 9, product* 8 * 4 * 4 * 4 * 8 * 3 * 9, index + 9384448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 9, product* 2 * 3 * 8 * 4 * 8 * 3 * 9, index + 9384832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 3 + 9, product* 2 * 7 * 6 * 8 * 8 * 3 * 9, index + 9388672);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 9, product* 4 * 8 * 3 * 2 * 9 * 3 * 9, index + 9392384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 3 + 9, product* 8 * 6 * 7 * 2 * 9 * 3 * 9, index + 9392768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3 + 9, product* 2 * 9 * 7 * 3 * 9 * 3 * 9, index + 9393792);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 9, product* 2 * 3 * 4 * 4 * 9 * 3 * 9, index + 9394432);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3 + 9, product* 2 * 3 * 6 * 7 * 9 * 3 * 9, index + 9397632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9 + 3 + 9, product* 2 * 7 * 2 * 8 * 9 * 3 * 9, index + 9398272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 9, product* 4 * 2 * 4 * 9 * 9 * 3 * 9, index + 9399424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 9, product* 6 * 3 * 3 * 2 * 2 * 4 * 9, index + 9422336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 9, product* 4 * 6 * 4 * 2 * 2 * 4 * 9, index + 9422464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 9, product* 6 * 7 * 9 * 2 * 2 * 4 * 9, index + 9422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 9, product* 2 * 3 * 2 * 3 * 2 * 4 * 9, index + 9423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 9, product* 8 * 8 * 4 * 3 * 2 * 4 * 9, index + 9423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 9, product* 4 * 4 * 7 * 3 * 2 * 4 * 9, index + 9423744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 9, product* 2 * 7 * 8 * 3 * 2 * 4 * 9, index + 9423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 9, product* 4 * 8 * 3 * 4 * 2 * 4 * 9, index + 9424384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 9, product* 2 * 3 * 4 * 6 * 2 * 4 * 9, index + 9426432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 9, product* 8 * 2 * 3 * 7 * 2 * 4 * 9, index + 9427328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 9, product* 4 * 2 * 2 * 8 * 2 * 4 * 9, index + 9428224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4 + 9, product* 6 * 3 * 7 * 8 * 2 * 4 * 9, index + 9428736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4 + 9, product* 8 * 4 * 2 * 9 * 2 * 4 * 9, index + 9429248);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 9, product* 8 * 4 * 4 * 2 * 3 * 4 * 9, index + 9432448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 9, product* 2 * 3 * 8 * 2 * 3 * 4 * 9, index + 9432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 9, product* 4 * 4 * 3 * 3 * 3 * 4 * 9, index + 9433344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 9, product* 2 * 7 * 4 * 3 * 3 * 4 * 9, index + 9433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 9, product* 8 * 2 * 7 * 3 * 3 * 4 * 9, index + 9433728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 9, product* 4 * 8 * 9 * 3 * 3 * 4 * 9, index + 9433984);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4 + 9, product* 8 * 6 * 3 * 4 * 3 * 4 * 9, index + 9434368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 9, product* 4 * 2 * 6 * 4 * 3 * 4 * 9, index + 9434624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 4 + 9, product* 2 * 7 * 6 * 6 * 3 * 4 * 9, index + 9436672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 4 + 9, product* 8 * 2 * 9 * 6 * 3 * 4 * 9, index + 9436928);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 9, product* 6 * 3 * 3 * 8 * 3 * 4 * 9, index + 9438336);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 4 + 9, product* 4 * 6 * 4 * 8 * 3 * 4 * 9, index + 9438464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 9, product* 2 * 3 * 2 * 9 * 3 * 4 * 9, index + 9439232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 9, product* 2 * 3 * 4 * 2 * 4 * 4 * 9, index + 9442432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 9, product* 8 * 2 * 3 * 3 * 4 * 4 * 9, index + 9443328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 9, product* 4 * 2 * 2 * 4 * 4 * 4 * 9, index + 9444224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 4 + 9, product* 4 * 6 * 8 * 4 * 4 * 4 * 9, index + 9444864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 9, product* 4 * 2 * 4 * 7 * 4 * 4 * 9, index + 9447424);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 9, product* 4 * 4 * 3 * 9 * 4 * 4 * 9, index + 9449344);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 4 + 9, product* 8 * 2 * 7 * 9 * 4 * 4 * 9, index + 9449728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 9, product* 2 * 7 * 2 * 2 * 6 * 4 * 9, index + 9462272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 9, product* 4 * 2 * 4 * 3 * 6 * 4 * 9, index + 9463424);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 9, product* 2 * 3 * 8 * 4 * 6 * 4 * 9, index + 9464832);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 9, product* 4 * 6 * 2 * 7 * 6 * 4 * 9, index + 9467264);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 4 + 9, product* 8 * 4 * 6 * 7 * 6 * 4 * 9, index + 9467648);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 9, product* 4 * 8 * 3 * 2 * 7 * 4 * 9, index + 9472384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 4 + 9, product* 8 * 6 * 7 * 2 * 7 * 4 * 9, index + 9472768);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 9, product* 2 * 3 * 4 * 4 * 7 * 4 * 9, index + 9474432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 9, product* 4 * 2 * 2 * 6 * 7 * 4 * 9, index + 9476224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 4 + 9, product* 6 * 3 * 7 * 6 * 7 * 4 * 9, index + 9476736);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 9, product* 2 * 3 * 6 * 7 * 7 * 4 * 9, index + 9477632);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4 + 9, product* 8 * 6 * 3 * 2 * 8 * 4 * 9, index + 9482368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 4 + 9, product* 6 * 9 * 4 * 2 * 8 * 4 * 9, index + 9482496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 9, product* 4 * 2 * 6 * 2 * 8 * 4 * 9, index + 9482624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 4 + 9, product* 4 * 6 * 2 * 3 * 8 * 4 * 9, index + 9483264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 9, product* 2 * 9 * 3 * 3 * 8 * 4 * 9, index + 9483392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 4 + 9, product* 8 * 4 * 6 * 3 * 8 * 4 * 9, index + 9483648);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 4 + 9, product* 6 * 7 * 7 * 3 * 8 * 4 * 9, index + 9483776);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4 + 9, product* 4 * 6 * 4 * 6 * 8 * 4 * 9, index + 9486464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 9, product* 2 * 3 * 2 * 7 * 8 * 4 * 9, index + 9487232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 4 + 9, product* 4 * 8 * 3 * 8 * 8 * 4 * 9, index + 9488384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 9, product* 4 * 2 * 2 * 2 * 9 * 4 * 9, index + 9492224);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 4 + 9, product* 4 * 6 * 8 * 2 * 9 * 4 * 9, index + 9492864);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 4 + 9, product* 2 * 9 * 9 * 2 * 9 * 4 * 9, index + 9492992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4 + 9, product* 8 * 4 * 2 * 3 * 9 * 4 * 9, index + 9493248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 9, product* 2 * 3 * 6 * 3 * 9 * 4 * 9, index + 9493632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4 + 9, product* 2 * 7 * 2 * 4 * 9 * 4 * 9, index + 9494272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4 + 9, product* 2 * 3 * 8 * 6 * 9 * 4 * 9, index + 9496832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 4 + 9, product* 4 * 4 * 3 * 7 * 9 * 4 * 9, index + 9497344);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9 + 4 + 9, product* 8 * 4 * 6 * 9 * 9 * 4 * 9, index + 9499648);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 9, product* 2 * 7 * 2 * 2 * 2 * 6 * 9, index + 9622272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6 + 9, product* 4 * 8 * 7 * 2 * 2 * 6 * 9, index + 9622784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 9, product* 6 * 9 * 2 * 3 * 2 * 6 * 9, index + 9623296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 9, product* 4 * 2 * 4 * 3 * 2 * 6 * 9, index + 9623424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 9, product* 8 * 4 * 4 * 4 * 2 * 6 * 9, index + 9624448);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 9, product* 2 * 3 * 8 * 4 * 2 * 6 * 9, index + 9624832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 9, product* 4 * 2 * 6 * 6 * 2 * 6 * 9, index + 9626624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 9, product* 2 * 9 * 3 * 7 * 2 * 6 * 9, index + 9627392);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 6 + 9, product* 6 * 7 * 7 * 7 * 2 * 6 * 9, index + 9627776);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 6 + 9, product* 2 * 7 * 6 * 8 * 2 * 6 * 9, index + 9628672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 6 + 9, product* 8 * 2 * 9 * 8 * 2 * 6 * 9, index + 9628928);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 9, product* 4 * 8 * 3 * 2 * 3 * 6 * 9, index + 9632384);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 6 + 9, product* 8 * 6 * 7 * 2 * 3 * 6 * 9, index + 9632768);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 9, product* 2 * 3 * 4 * 4 * 3 * 6 * 9, index + 9634432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 9, product* 4 * 2 * 2 * 6 * 3 * 6 * 9, index + 9636224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 6 + 9, product* 8 * 4 * 2 * 7 * 3 * 6 * 9, index + 9637248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 9, product* 2 * 7 * 2 * 8 * 3 * 6 * 9, index + 9638272);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 9, product* 4 * 2 * 4 * 9 * 3 * 6 * 9, index + 9639424);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 9, product* 4 * 2 * 6 * 2 * 4 * 6 * 9, index + 9642624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 9, product* 4 * 6 * 2 * 3 * 4 * 6 * 9, index + 9643264);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 9, product* 2 * 7 * 6 * 4 * 4 * 6 * 9, index + 9644672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 9, product* 6 * 3 * 3 * 6 * 4 * 6 * 9, index + 9646336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 9, product* 2 * 3 * 2 * 7 * 4 * 6 * 9, index + 9647232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 6 + 9, product* 4 * 8 * 3 * 8 * 4 * 6 * 9, index + 9648384);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 6 + 9, product* 8 * 6 * 7 * 8 * 4 * 6 * 9, index + 9648768);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 9, product* 6 * 3 * 3 * 2 * 6 * 6 * 9, index + 9662336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 9, product* 4 * 6 * 4 * 2 * 6 * 6 * 9, index + 9662464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 9, product* 2 * 3 * 2 * 3 * 6 * 6 * 9, index + 9663232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 9, product* 4 * 4 * 7 * 3 * 6 * 6 * 9, index + 9663744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 6 + 9, product* 8 * 2 * 3 * 7 * 6 * 6 * 9, index + 9667328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 9, product* 8 * 4 * 4 * 2 * 7 * 6 * 9, index + 9672448);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 9, product* 2 * 3 * 8 * 2 * 7 * 6 * 9, index + 9672832);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 6 + 9, product* 8 * 2 * 7 * 3 * 7 * 6 * 9, index + 9673728);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 9, product* 4 * 2 * 6 * 4 * 7 * 6 * 9, index + 9674624);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6 + 9, product* 6 * 3 * 3 * 8 * 7 * 6 * 9, index + 9678336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 9, product* 2 * 3 * 2 * 9 * 7 * 6 * 9, index + 9679232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 9, product* 2 * 3 * 4 * 2 * 8 * 6 * 9, index + 9682432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 6 + 9, product* 4 * 4 * 9 * 2 * 8 * 6 * 9, index + 9682944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 9, product* 4 * 2 * 2 * 4 * 8 * 6 * 9, index + 9684224);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 6 + 9, product* 4 * 6 * 8 * 4 * 8 * 6 * 9, index + 9684864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 9, product* 2 * 7 * 2 * 6 * 8 * 6 * 9, index + 9686272);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 6 + 9, product* 8 * 4 * 4 * 8 * 8 * 6 * 9, index + 9688448);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 9, product* 8 * 6 * 3 * 2 * 2 * 7 * 9, index + 9722368);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 9, product* 6 * 9 * 4 * 2 * 2 * 7 * 9, index + 9722496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 9, product* 4 * 2 * 6 * 2 * 2 * 7 * 9, index + 9722624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 9, product* 4 * 6 * 2 * 3 * 2 * 7 * 9, index + 9723264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 9, product* 2 * 9 * 3 * 3 * 2 * 7 * 9, index + 9723392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 7 + 9, product* 8 * 4 * 6 * 3 * 2 * 7 * 9, index + 9723648);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 9, product* 8 * 8 * 2 * 4 * 2 * 7 * 9, index + 9724288);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7 + 9, product* 2 * 7 * 6 * 4 * 2 * 7 * 9, index + 9724672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 7 + 9, product* 8 * 2 * 9 * 4 * 2 * 7 * 9, index + 9724928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7 + 9, product* 6 * 3 * 3 * 6 * 2 * 7 * 9, index + 9726336);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 7 + 9, product* 6 * 7 * 9 * 6 * 2 * 7 * 9, index + 9726976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 9, product* 2 * 3 * 2 * 7 * 2 * 7 * 9, index + 9727232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 9, product* 6 * 9 * 2 * 7 * 2 * 7 * 9, index + 9727296);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 9, product* 4 * 2 * 2 * 2 * 3 * 7 * 9, index + 9732224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 9, product* 8 * 4 * 2 * 3 * 3 * 7 * 9, index + 9733248);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 7 + 9, product* 6 * 7 * 3 * 3 * 3 * 7 * 9, index + 9733376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 9, product* 2 * 3 * 6 * 3 * 3 * 7 * 9, index + 9733632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 9, product* 2 * 7 * 2 * 4 * 3 * 7 * 9, index + 9734272);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 7 + 9, product* 8 * 4 * 4 * 6 * 3 * 7 * 9, index + 9736448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 9, product* 2 * 7 * 4 * 7 * 3 * 7 * 9, index + 9737472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 7 + 9, product* 8 * 2 * 7 * 7 * 3 * 7 * 9, index + 9737728);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 7 + 9, product* 8 * 6 * 3 * 8 * 3 * 7 * 9, index + 9738368);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 9, product* 6 * 3 * 3 * 2 * 4 * 7 * 9, index + 9742336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 9, product* 4 * 6 * 4 * 2 * 4 * 7 * 9, index + 9742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 9, product* 2 * 3 * 2 * 3 * 4 * 7 * 9, index + 9743232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 7 + 9, product* 8 * 8 * 4 * 3 * 4 * 7 * 9, index + 9743488);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 9, product* 4 * 2 * 2 * 8 * 4 * 7 * 9, index + 9748224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 7 + 9, product* 8 * 4 * 2 * 9 * 4 * 7 * 9, index + 9749248);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 9, product* 2 * 3 * 4 * 2 * 6 * 7 * 9, index + 9762432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7 + 9, product* 4 * 4 * 9 * 2 * 6 * 7 * 9, index + 9762944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 9, product* 4 * 2 * 2 * 4 * 6 * 7 * 9, index + 9764224);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 7 + 9, product* 6 * 3 * 9 * 7 * 6 * 7 * 9, index + 9767936);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 7 + 9, product* 8 * 8 * 2 * 2 * 7 * 7 * 9, index + 9772288);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 7 + 9, product* 6 * 3 * 9 * 9 * 7 * 7 * 9, index + 9779936);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 9, product* 2 * 7 * 2 * 2 * 8 * 7 * 9, index + 9782272);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 9, product* 2 * 3 * 4 * 4 * 9 * 7 * 9, index + 9794432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7 + 9, product* 4 * 2 * 2 * 6 * 9 * 7 * 9, index + 9796224);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 7 + 9, product* 2 * 3 * 6 * 7 * 9 * 7 * 9, index + 9797632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 7 + 9, product* 4 * 2 * 4 * 9 * 9 * 7 * 9, index + 9799424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 9, product* 6 * 3 * 3 * 2 * 2 * 8 * 9, index + 9822336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 9, product* 4 * 6 * 4 * 2 * 2 * 8 * 9, index + 9822464);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 8 + 9, product* 8 * 4 * 8 * 2 * 2 * 8 * 9, index + 9822848);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 8 + 9, product* 6 * 7 * 9 * 2 * 2 * 8 * 9, index + 9822976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 9, product* 2 * 3 * 2 * 3 * 2 * 8 * 9, index + 9823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 9, product* 4 * 4 * 7 * 3 * 2 * 8 * 9, index + 9823744);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 9, product* 2 * 7 * 8 * 3 * 2 * 8 * 9, index + 9823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 9, product* 4 * 8 * 3 * 4 * 2 * 8 * 9, index + 9824384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8 + 9, product* 6 * 9 * 8 * 4 * 2 * 8 * 9, index + 9824896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 9, product* 2 * 3 * 4 * 6 * 2 * 8 * 9, index + 9826432);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8 + 9, product* 8 * 2 * 3 * 7 * 2 * 8 * 9, index + 9827328);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 9, product* 4 * 2 * 2 * 8 * 2 * 8 * 9, index + 9828224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 9, product* 8 * 4 * 2 * 9 * 2 * 8 * 9, index + 9829248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 9, product* 2 * 3 * 8 * 2 * 3 * 8 * 9, index + 9832832);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 9, product* 2 * 7 * 4 * 3 * 3 * 8 * 9, index + 9833472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 9, product* 8 * 2 * 7 * 3 * 3 * 8 * 9, index + 9833728);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 9, product* 4 * 2 * 6 * 4 * 3 * 8 * 9, index + 9834624);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 8 + 9, product* 8 * 8 * 2 * 6 * 3 * 8 * 9, index + 9836288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 9, product* 4 * 2 * 8 * 7 * 3 * 8 * 9, index + 9837824);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 9, product* 2 * 3 * 2 * 9 * 3 * 8 * 9, index + 9839232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 9, product* 2 * 3 * 4 * 2 * 4 * 8 * 9, index + 9842432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 9, product* 4 * 4 * 9 * 2 * 4 * 8 * 9, index + 9842944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 9, product* 4 * 2 * 2 * 4 * 4 * 8 * 9, index + 9844224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 9, product* 2 * 7 * 2 * 6 * 4 * 8 * 9, index + 9846272);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 9, product* 2 * 7 * 2 * 2 * 6 * 8 * 9, index + 9862272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 9, product* 4 * 2 * 4 * 3 * 6 * 8 * 9, index + 9863424);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8 + 9, product* 2 * 3 * 8 * 4 * 6 * 8 * 9, index + 9864832);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 8 + 9, product* 8 * 6 * 7 * 2 * 7 * 8 * 9, index + 9872768);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 9, product* 4 * 2 * 2 * 6 * 7 * 8 * 9, index + 9876224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 8 + 9, product* 2 * 7 * 2 * 8 * 7 * 8 * 9, index + 9878272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 8 + 9, product* 4 * 8 * 7 * 8 * 7 * 8 * 9, index + 9878784);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 8 + 9, product* 8 * 6 * 3 * 2 * 8 * 8 * 9, index + 9882368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 8 + 9, product* 4 * 2 * 6 * 2 * 8 * 8 * 9, index + 9882624);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 9, product* 4 * 6 * 2 * 3 * 8 * 8 * 9, index + 9883264);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 9, product* 2 * 3 * 2 * 7 * 8 * 8 * 9, index + 9887232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 9, product* 4 * 2 * 2 * 2 * 9 * 8 * 9, index + 9892224);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 9, product* 2 * 3 * 4 * 2 * 2 * 9 * 9, index + 9922432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 9, product* 8 * 2 * 3 * 3 * 2 * 9 * 9, index + 9923328);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 9, product* 4 * 2 * 2 * 4 * 2 * 9 * 9, index + 9924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 9, product* 6 * 3 * 7 * 4 * 2 * 9 * 9, index + 9924736);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 9 + 9, product* 4 * 6 * 8 * 4 * 2 * 9 * 9, index + 9924864);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 9, product* 2 * 7 * 2 * 6 * 2 * 9 * 9, index + 9926272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9 + 9, product* 6 * 9 * 2 * 7 * 2 * 9 * 9, index + 9927296);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 9, product* 4 * 2 * 4 * 7 * 2 * 9 * 9, index + 9927424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 9 + 9, product* 6 * 3 * 9 * 7 * 2 * 9 * 9, index + 9927936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 9 + 9, product* 8 * 4 * 4 * 8 * 2 * 9 * 9, index + 9928448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9 + 9, product* 2 * 7 * 4 * 9 * 2 * 9 * 9, index + 9929472);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 9, product* 2 * 7 * 6 * 2 * 3 * 9 * 9, index + 9932672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 9 + 9, product* 8 * 2 * 9 * 2 * 3 * 9 * 9, index + 9932928);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 9, product* 4 * 2 * 8 * 3 * 3 * 9 * 9, index + 9933824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 9, product* 6 * 3 * 3 * 4 * 3 * 9 * 9, index + 9934336);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 9 + 9, product* 6 * 7 * 9 * 4 * 3 * 9 * 9, index + 9934976);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 9, product* 2 * 3 * 4 * 8 * 3 * 9 * 9, index + 9938432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 9, product* 2 * 7 * 2 * 2 * 4 * 9 * 9, index + 9942272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 9, product* 2 * 3 * 8 * 4 * 4 * 9 * 9, index + 9944832);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 9 + 9, product* 8 * 4 * 6 * 7 * 4 * 9 * 9, index + 9947648);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 9 + 9, product* 8 * 4 * 6 * 3 * 6 * 9 * 9, index + 9963648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 9, product* 2 * 3 * 2 * 7 * 6 * 9 * 9, index + 9967232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 9, product* 4 * 2 * 2 * 2 * 7 * 9 * 9, index + 9972224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 9 + 9, product* 6 * 3 * 7 * 2 * 7 * 9 * 9, index + 9972736);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 9, product* 2 * 7 * 2 * 4 * 7 * 9 * 9, index + 9974272);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 9 + 9, product* 6 * 7 * 9 * 4 * 7 * 9 * 9, index + 9974976);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 9 + 9, product* 4 * 4 * 3 * 7 * 7 * 9 * 9, index + 9977344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 9 + 9, product* 2 * 9 * 3 * 9 * 7 * 9 * 9, index + 9979392);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 9, product* 2 * 3 * 2 * 3 * 8 * 9 * 9, index + 9983232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 9 + 9, product* 8 * 4 * 4 * 2 * 9 * 9 * 9, index + 9992448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 9 + 9, product* 2 * 7 * 4 * 3 * 9 * 9 * 9, index + 9993472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 9 + 9, product* 8 * 2 * 7 * 3 * 9 * 9 * 9, index + 9993728);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 9 + 9, product* 4 * 6 * 4 * 8 * 9 * 9 * 9, index + 9998464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 9 + 9, product* 2 * 3 * 2 * 9 * 9 * 9 * 9, index + 9999232);
@@ -1,6893 +0,0 @@
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 2 + 2, product* 6 * 3 * 3 * 2 * 2 * 2 * 2 * 2, index + 22222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 2 + 2, product* 8 * 4 * 8 * 2 * 2 * 2 * 2 * 2, index + 22222848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 2 + 2, product* 2 * 3 * 2 * 3 * 2 * 2 * 2 * 2, index + 22223232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 2 + 2, product* 2 * 7 * 8 * 3 * 2 * 2 * 2 * 2, index + 22223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 2 + 2, product* 4 * 8 * 3 * 4 * 2 * 2 * 2 * 2, index + 22224384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 2 + 2, product* 6 * 9 * 8 * 4 * 2 * 2 * 2 * 2, index + 22224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 2 + 2, product* 2 * 3 * 4 * 6 * 2 * 2 * 2 * 2, index + 22226432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 2 + 2 + 2, product* 8 * 8 * 6 * 6 * 2 * 2 * 2 * 2, index + 22226688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 2 + 2, product* 4 * 4 * 9 * 6 * 2 * 2 * 2 * 2, index + 22226944);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 2 + 2 + 2, product* 8 * 6 * 9 * 7 * 2 * 2 * 2 * 2, index + 22227968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 2 + 2, product* 4 * 2 * 2 * 8 * 2 * 2 * 2 * 2, index + 22228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 2 + 2, product* 6 * 3 * 7 * 8 * 2 * 2 * 2 * 2, index + 22228736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 2 + 2, product* 2 * 9 * 9 * 8 * 2 * 2 * 2 * 2, index + 22228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 2 + 2, product* 8 * 4 * 2 * 9 * 2 * 2 * 2 * 2, index + 22229248);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 2 + 2, product* 6 * 7 * 3 * 9 * 2 * 2 * 2 * 2, index + 22229376);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 2 + 2, product* 2 * 3 * 8 * 2 * 3 * 2 * 2 * 2, index + 22232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 2 + 2, product* 4 * 4 * 3 * 3 * 3 * 2 * 2 * 2, index + 22233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 2 + 2, product* 8 * 6 * 3 * 4 * 3 * 2 * 2 * 2, index + 22234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 2 + 2, product* 4 * 2 * 6 * 4 * 3 * 2 * 2 * 2, index + 22234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 2 + 2, product* 2 * 7 * 6 * 6 * 3 * 2 * 2 * 2, index + 22236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 2 + 2, product* 8 * 2 * 9 * 6 * 3 * 2 * 2 * 2, index + 22236928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 2 + 2, product* 6 * 9 * 6 * 7 * 3 * 2 * 2 * 2, index + 22237696);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 2 + 2, product* 4 * 6 * 4 * 8 * 3 * 2 * 2 * 2, index + 22238464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2 + 2 + 2, product* 6 * 7 * 9 * 8 * 3 * 2 * 2 * 2, index + 22238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 2 + 2, product* 2 * 3 * 2 * 9 * 3 * 2 * 2 * 2, index + 22239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 2 + 2, product* 8 * 8 * 4 * 9 * 3 * 2 * 2 * 2, index + 22239488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2 + 2 + 2, product* 4 * 4 * 7 * 9 * 3 * 2 * 2 * 2, index + 22239744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 2 + 2, product* 8 * 2 * 3 * 3 * 4 * 2 * 2 * 2, index + 22243328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 2 + 2, product* 4 * 6 * 8 * 4 * 4 * 2 * 2 * 2, index + 22244864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 2 + 2, product* 4 * 2 * 4 * 7 * 4 * 2 * 2 * 2, index + 22247424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 2 + 2, product* 6 * 3 * 9 * 7 * 4 * 2 * 2 * 2, index + 22247936);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 2 + 2, product* 2 * 7 * 4 * 9 * 4 * 2 * 2 * 2, index + 22249472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 2 + 2, product* 8 * 2 * 7 * 9 * 4 * 2 * 2 * 2, index + 22249728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 2 + 2 + 2, product* 4 * 8 * 9 * 9 * 4 * 2 * 2 * 2, index + 22249984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 2 + 2, product* 2 * 7 * 2 * 2 * 6 * 2 * 2 * 2, index + 22262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 2 + 2, product* 4 * 8 * 7 * 2 * 6 * 2 * 2 * 2, index + 22262784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 2 + 2, product* 6 * 9 * 2 * 3 * 6 * 2 * 2 * 2, index + 22263296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 2 + 2, product* 2 * 3 * 8 * 4 * 6 * 2 * 2 * 2, index + 22264832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 2 + 2 + 2, product* 8 * 6 * 3 * 6 * 6 * 2 * 2 * 2, index + 22266368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 2 + 2, product* 4 * 2 * 6 * 6 * 6 * 2 * 2 * 2, index + 22266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 2 + 2, product* 2 * 9 * 3 * 7 * 6 * 2 * 2 * 2, index + 22267392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 2 + 2, product* 2 * 7 * 6 * 8 * 6 * 2 * 2 * 2, index + 22268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 2 + 2, product* 8 * 2 * 9 * 8 * 6 * 2 * 2 * 2, index + 22268928);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 2 + 2, product* 2 * 9 * 7 * 3 * 7 * 2 * 2 * 2, index + 22273792);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 2 + 2 + 2, product* 6 * 7 * 3 * 7 * 7 * 2 * 2 * 2, index + 22277376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 2 + 2, product* 2 * 3 * 6 * 7 * 7 * 2 * 2 * 2, index + 22277632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 2 + 2, product* 4 * 2 * 4 * 9 * 7 * 2 * 2 * 2, index + 22279424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 2 + 2 + 2, product* 6 * 3 * 9 * 9 * 7 * 2 * 2 * 2, index + 22279936);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 2 + 2, product* 4 * 6 * 2 * 3 * 8 * 2 * 2 * 2, index + 22283264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 2 + 2 + 2, product* 6 * 7 * 7 * 3 * 8 * 2 * 2 * 2, index + 22283776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 2 + 2, product* 8 * 8 * 2 * 4 * 8 * 2 * 2 * 2, index + 22284288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 2 + 2, product* 6 * 3 * 3 * 6 * 8 * 2 * 2 * 2, index + 22286336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 2 + 2 + 2, product* 8 * 4 * 8 * 6 * 8 * 2 * 2 * 2, index + 22286848);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2 + 2 + 2, product* 4 * 8 * 3 * 8 * 8 * 2 * 2 * 2, index + 22288384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 2 + 2, product* 4 * 2 * 2 * 2 * 9 * 2 * 2 * 2, index + 22292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 2 + 2, product* 6 * 3 * 7 * 2 * 9 * 2 * 2 * 2, index + 22292736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 2 + 2, product* 2 * 9 * 9 * 2 * 9 * 2 * 2 * 2, index + 22292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 2 + 2, product* 8 * 4 * 2 * 3 * 9 * 2 * 2 * 2, index + 22293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 2 + 2, product* 2 * 7 * 2 * 4 * 9 * 2 * 2 * 2, index + 22294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 2 + 2, product* 4 * 8 * 7 * 4 * 9 * 2 * 2 * 2, index + 22294784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 2 + 2, product* 2 * 3 * 8 * 6 * 9 * 2 * 2 * 2, index + 22296832);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2 + 2 + 2, product* 8 * 6 * 3 * 8 * 9 * 2 * 2 * 2, index + 22298368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2 + 2 + 2, product* 4 * 2 * 6 * 8 * 9 * 2 * 2 * 2, index + 22298624);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 2 + 2, product* 2 * 3 * 4 * 2 * 2 * 3 * 2 * 2, index + 22322432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3 + 2 + 2, product* 8 * 8 * 6 * 2 * 2 * 3 * 2 * 2, index + 22322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 2 + 2, product* 4 * 4 * 9 * 2 * 2 * 3 * 2 * 2, index + 22322944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3 + 2 + 2, product* 8 * 6 * 9 * 3 * 2 * 3 * 2 * 2, index + 22323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 2 + 2, product* 4 * 2 * 2 * 4 * 2 * 3 * 2 * 2, index + 22324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 2 + 2, product* 6 * 3 * 7 * 4 * 2 * 3 * 2 * 2, index + 22324736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 2 + 2, product* 2 * 9 * 9 * 4 * 2 * 3 * 2 * 2, index + 22324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 2 + 2, product* 2 * 7 * 2 * 6 * 2 * 3 * 2 * 2, index + 22326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 2 + 2, product* 4 * 8 * 7 * 6 * 2 * 3 * 2 * 2, index + 22326784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 2 + 2, product* 6 * 9 * 2 * 7 * 2 * 3 * 2 * 2, index + 22327296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 2 + 2, product* 2 * 3 * 8 * 8 * 2 * 3 * 2 * 2, index + 22328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 2 + 2, product* 4 * 4 * 3 * 9 * 2 * 3 * 2 * 2, index + 22329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 2 + 2, product* 2 * 7 * 6 * 2 * 3 * 3 * 2 * 2, index + 22332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 2 + 2, product* 8 * 2 * 9 * 2 * 3 * 3 * 2 * 2, index + 22332928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 2 + 2, product* 4 * 6 * 4 * 4 * 3 * 3 * 2 * 2, index + 22334464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 2 + 2, product* 2 * 9 * 7 * 7 * 3 * 3 * 2 * 2, index + 22337792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 2 + 2, product* 8 * 2 * 3 * 9 * 3 * 3 * 2 * 2, index + 22339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 2 + 2, product* 4 * 2 * 4 * 3 * 4 * 3 * 2 * 2, index + 22343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 2 + 2, product* 6 * 3 * 9 * 3 * 4 * 3 * 2 * 2, index + 22343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 2 + 2, product* 8 * 4 * 4 * 4 * 4 * 3 * 2 * 2, index + 22344448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 2 + 2, product* 4 * 6 * 2 * 7 * 4 * 3 * 2 * 2, index + 22347264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4 + 3 + 2 + 2, product* 6 * 7 * 7 * 7 * 4 * 3 * 2 * 2, index + 22347776);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3 + 2 + 2, product* 4 * 2 * 8 * 9 * 4 * 3 * 2 * 2, index + 22349824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3 + 2 + 2, product* 8 * 6 * 3 * 2 * 6 * 3 * 2 * 2, index + 22362368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 2 + 2, product* 4 * 2 * 6 * 2 * 6 * 3 * 2 * 2, index + 22362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 2 + 2, product* 2 * 9 * 3 * 3 * 6 * 3 * 2 * 2, index + 22363392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3 + 2 + 2, product* 8 * 4 * 6 * 3 * 6 * 3 * 2 * 2, index + 22363648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 2 + 2, product* 2 * 7 * 6 * 4 * 6 * 3 * 2 * 2, index + 22364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 2 + 2, product* 8 * 2 * 9 * 4 * 6 * 3 * 2 * 2, index + 22364928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 2 + 2, product* 4 * 6 * 4 * 6 * 6 * 3 * 2 * 2, index + 22366464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 2 + 2, product* 2 * 3 * 2 * 7 * 6 * 3 * 2 * 2, index + 22367232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 6 + 3 + 2 + 2, product* 4 * 4 * 7 * 7 * 6 * 3 * 2 * 2, index + 22367744);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 6 + 3 + 2 + 2, product* 2 * 9 * 7 * 9 * 6 * 3 * 2 * 2, index + 22369792);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 2 + 2, product* 4 * 6 * 8 * 2 * 7 * 3 * 2 * 2, index + 22372864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 2 + 2, product* 6 * 7 * 3 * 3 * 7 * 3 * 2 * 2, index + 22373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 2 + 2, product* 2 * 3 * 6 * 3 * 7 * 3 * 2 * 2, index + 22373632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 7 + 3 + 2 + 2, product* 8 * 8 * 8 * 3 * 7 * 3 * 2 * 2, index + 22373888);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 2 + 2, product* 8 * 4 * 4 * 6 * 7 * 3 * 2 * 2, index + 22376448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 2 + 2, product* 2 * 7 * 4 * 7 * 7 * 3 * 2 * 2, index + 22377472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 2 + 2, product* 8 * 2 * 7 * 7 * 7 * 3 * 2 * 2, index + 22377728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 3 + 2 + 2, product* 4 * 8 * 9 * 7 * 7 * 3 * 2 * 2, index + 22377984);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3 + 2 + 2, product* 6 * 9 * 4 * 8 * 7 * 3 * 2 * 2, index + 22378496);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 2 + 2, product* 4 * 6 * 2 * 9 * 7 * 3 * 2 * 2, index + 22379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 2 + 2, product* 6 * 3 * 3 * 2 * 8 * 3 * 2 * 2, index + 22382336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3 + 2 + 2, product* 8 * 4 * 8 * 2 * 8 * 3 * 2 * 2, index + 22382848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 2 + 2, product* 2 * 7 * 8 * 3 * 8 * 3 * 2 * 2, index + 22383872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 2 + 2, product* 4 * 8 * 3 * 4 * 8 * 3 * 2 * 2, index + 22384384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 8 + 3 + 2 + 2, product* 6 * 9 * 8 * 4 * 8 * 3 * 2 * 2, index + 22384896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 2 + 2, product* 2 * 3 * 4 * 6 * 8 * 3 * 2 * 2, index + 22386432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3 + 2 + 2, product* 4 * 4 * 9 * 6 * 8 * 3 * 2 * 2, index + 22386944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 2 + 2, product* 4 * 2 * 2 * 8 * 8 * 3 * 2 * 2, index + 22388224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 2 + 2, product* 2 * 3 * 8 * 2 * 9 * 3 * 2 * 2, index + 22392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 2 + 2, product* 4 * 4 * 3 * 3 * 9 * 3 * 2 * 2, index + 22393344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 2 + 2, product* 4 * 2 * 6 * 4 * 9 * 3 * 2 * 2, index + 22394624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 2 + 2, product* 2 * 7 * 6 * 6 * 9 * 3 * 2 * 2, index + 22396672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 3 + 2 + 2, product* 8 * 2 * 9 * 6 * 9 * 3 * 2 * 2, index + 22396928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 3 + 2 + 2, product* 4 * 6 * 4 * 8 * 9 * 3 * 2 * 2, index + 22398464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 2 + 2, product* 2 * 3 * 2 * 9 * 9 * 3 * 2 * 2, index + 22399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 2 + 2, product* 2 * 7 * 2 * 2 * 2 * 4 * 2 * 2, index + 22422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 2 + 2, product* 4 * 8 * 7 * 2 * 2 * 4 * 2 * 2, index + 22422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 2 + 2, product* 6 * 9 * 2 * 3 * 2 * 4 * 2 * 2, index + 22423296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 2 + 2, product* 2 * 3 * 8 * 4 * 2 * 4 * 2 * 2, index + 22424832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 2 + 2, product* 4 * 2 * 6 * 6 * 2 * 4 * 2 * 2, index + 22426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 2 + 2, product* 2 * 9 * 3 * 7 * 2 * 4 * 2 * 2, index + 22427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 2 + 2, product* 8 * 4 * 6 * 7 * 2 * 4 * 2 * 2, index + 22427648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 2 + 2, product* 2 * 7 * 6 * 8 * 2 * 4 * 2 * 2, index + 22428672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 4 + 2 + 2, product* 8 * 2 * 9 * 8 * 2 * 4 * 2 * 2, index + 22428928);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 4 + 2 + 2, product* 6 * 9 * 6 * 9 * 2 * 4 * 2 * 2, index + 22429696);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 2 + 2, product* 8 * 6 * 7 * 2 * 3 * 4 * 2 * 2, index + 22432768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 2 + 2, product* 2 * 9 * 7 * 3 * 3 * 4 * 2 * 2, index + 22433792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 2 + 2, product* 4 * 6 * 8 * 6 * 3 * 4 * 2 * 2, index + 22436864);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 4 + 2 + 2, product* 6 * 7 * 3 * 7 * 3 * 4 * 2 * 2, index + 22437376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 2 + 2, product* 2 * 3 * 6 * 7 * 3 * 4 * 2 * 2, index + 22437632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 2 + 2, product* 4 * 2 * 4 * 9 * 3 * 4 * 2 * 2, index + 22439424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 4 + 2 + 2, product* 6 * 3 * 9 * 9 * 3 * 4 * 2 * 2, index + 22439936);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 4 + 2 + 2, product* 6 * 9 * 4 * 2 * 4 * 4 * 2 * 2, index + 22442496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 2 + 2, product* 4 * 6 * 2 * 3 * 4 * 4 * 2 * 2, index + 22443264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 2 + 2, product* 6 * 7 * 7 * 3 * 4 * 4 * 2 * 2, index + 22443776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 2 + 2, product* 8 * 8 * 2 * 4 * 4 * 4 * 2 * 2, index + 22444288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 2 + 2, product* 6 * 3 * 3 * 6 * 4 * 4 * 2 * 2, index + 22446336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 4 + 2 + 2, product* 2 * 7 * 8 * 7 * 4 * 4 * 2 * 2, index + 22447872);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 2 + 2, product* 4 * 6 * 6 * 9 * 4 * 4 * 2 * 2, index + 22449664);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 2 + 2, product* 4 * 6 * 4 * 2 * 6 * 4 * 2 * 2, index + 22462464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 4 + 2 + 2, product* 6 * 7 * 9 * 2 * 6 * 4 * 2 * 2, index + 22462976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 2 + 2, product* 2 * 3 * 2 * 3 * 6 * 4 * 2 * 2, index + 22463232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 4 + 2 + 2, product* 8 * 2 * 3 * 7 * 6 * 4 * 2 * 2, index + 22467328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 2 + 2, product* 2 * 3 * 6 * 9 * 6 * 4 * 2 * 2, index + 22469632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 2 + 2, product* 2 * 7 * 4 * 3 * 7 * 4 * 2 * 2, index + 22473472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 4 + 2 + 2, product* 4 * 8 * 9 * 3 * 7 * 4 * 2 * 2, index + 22473984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 4 + 2 + 2, product* 8 * 8 * 2 * 6 * 7 * 4 * 2 * 2, index + 22476288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 2 + 2, product* 6 * 3 * 3 * 8 * 7 * 4 * 2 * 2, index + 22478336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 2 + 2, product* 2 * 3 * 4 * 2 * 8 * 4 * 2 * 2, index + 22482432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 4 + 2 + 2, product* 4 * 4 * 9 * 2 * 8 * 4 * 2 * 2, index + 22482944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 2 + 2, product* 4 * 2 * 2 * 4 * 8 * 4 * 2 * 2, index + 22484224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 4 + 2 + 2, product* 6 * 3 * 7 * 4 * 8 * 4 * 2 * 2, index + 22484736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 4 + 2 + 2, product* 2 * 9 * 9 * 4 * 8 * 4 * 2 * 2, index + 22484992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 2 + 2, product* 2 * 7 * 2 * 6 * 8 * 4 * 2 * 2, index + 22486272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 4 + 2 + 2, product* 4 * 4 * 3 * 9 * 8 * 4 * 2 * 2, index + 22489344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 2 + 2, product* 2 * 7 * 6 * 2 * 9 * 4 * 2 * 2, index + 22492672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 2 + 2, product* 8 * 2 * 9 * 2 * 9 * 4 * 2 * 2, index + 22492928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 4 + 2 + 2, product* 4 * 6 * 4 * 4 * 9 * 4 * 2 * 2, index + 22494464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 4 + 2 + 2, product* 2 * 9 * 7 * 7 * 9 * 4 * 2 * 2, index + 22497792);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 2 + 2, product* 4 * 6 * 4 * 2 * 2 * 6 * 2 * 2, index + 22622464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 2 + 2, product* 6 * 7 * 9 * 2 * 2 * 6 * 2 * 2, index + 22622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 2 + 2, product* 2 * 3 * 2 * 3 * 2 * 6 * 2 * 2, index + 22623232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 6 + 2 + 2, product* 8 * 8 * 4 * 3 * 2 * 6 * 2 * 2, index + 22623488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 2 + 2, product* 4 * 4 * 7 * 3 * 2 * 6 * 2 * 2, index + 22623744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 2 + 2, product* 8 * 2 * 3 * 7 * 2 * 6 * 2 * 2, index + 22627328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 6 + 2 + 2, product* 4 * 6 * 8 * 8 * 2 * 6 * 2 * 2, index + 22628864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 2 + 2, product* 6 * 7 * 3 * 9 * 2 * 6 * 2 * 2, index + 22629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 2 + 2, product* 2 * 3 * 6 * 9 * 2 * 6 * 2 * 2, index + 22629632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 2 + 2, product* 8 * 4 * 4 * 2 * 3 * 6 * 2 * 2, index + 22632448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 2 + 2, product* 2 * 7 * 4 * 3 * 3 * 6 * 2 * 2, index + 22633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 2 + 2, product* 8 * 2 * 7 * 3 * 3 * 6 * 2 * 2, index + 22633728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 6 + 2 + 2, product* 2 * 9 * 7 * 3 * 3 * 6 * 2 * 2, index + 22633792);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 2 + 2, product* 4 * 8 * 9 * 3 * 3 * 6 * 2 * 2, index + 22633984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 2 + 2, product* 6 * 9 * 4 * 4 * 3 * 6 * 2 * 2, index + 22634496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 2 + 2, product* 8 * 8 * 2 * 6 * 3 * 6 * 2 * 2, index + 22636288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 2 + 2, product* 4 * 2 * 8 * 7 * 3 * 6 * 2 * 2, index + 22637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 2 + 2, product* 6 * 3 * 3 * 8 * 3 * 6 * 2 * 2, index + 22638336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 6 + 2 + 2, product* 2 * 7 * 8 * 9 * 3 * 6 * 2 * 2, index + 22639872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 2 + 2, product* 2 * 3 * 4 * 2 * 4 * 6 * 2 * 2, index + 22642432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 2 + 2, product* 4 * 4 * 9 * 2 * 4 * 6 * 2 * 2, index + 22642944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 2 + 2, product* 4 * 2 * 2 * 4 * 4 * 6 * 2 * 2, index + 22644224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 6 + 2 + 2, product* 6 * 3 * 7 * 4 * 4 * 6 * 2 * 2, index + 22644736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 6 + 2 + 2, product* 2 * 9 * 9 * 4 * 4 * 6 * 2 * 2, index + 22644992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 2 + 2, product* 2 * 7 * 2 * 6 * 4 * 6 * 2 * 2, index + 22646272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 6 + 2 + 2, product* 4 * 8 * 7 * 6 * 4 * 6 * 2 * 2, index + 22646784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 2 + 2, product* 6 * 9 * 2 * 7 * 4 * 6 * 2 * 2, index + 22647296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 2 + 2, product* 2 * 3 * 8 * 8 * 4 * 6 * 2 * 2, index + 22648832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 6 + 2 + 2, product* 4 * 4 * 3 * 9 * 4 * 6 * 2 * 2, index + 22649344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 2 + 2, product* 4 * 2 * 4 * 3 * 6 * 6 * 2 * 2, index + 22663424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 2 + 2, product* 8 * 4 * 4 * 4 * 6 * 6 * 2 * 2, index + 22664448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 6 + 2 + 2, product* 6 * 9 * 4 * 6 * 6 * 6 * 2 * 2, index + 22666496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 6 + 2 + 2, product* 4 * 6 * 2 * 7 * 6 * 6 * 2 * 2, index + 22667264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 6 + 2 + 2, product* 4 * 2 * 8 * 9 * 6 * 6 * 2 * 2, index + 22669824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 2 + 2, product* 4 * 8 * 3 * 2 * 7 * 6 * 2 * 2, index + 22672384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 6 + 2 + 2, product* 6 * 9 * 8 * 2 * 7 * 6 * 2 * 2, index + 22672896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 6 + 2 + 2, product* 4 * 6 * 6 * 3 * 7 * 6 * 2 * 2, index + 22673664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 2 + 2, product* 2 * 3 * 4 * 4 * 7 * 6 * 2 * 2, index + 22674432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 6 + 2 + 2, product* 4 * 4 * 9 * 4 * 7 * 6 * 2 * 2, index + 22674944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 2 + 2, product* 4 * 2 * 2 * 6 * 7 * 6 * 2 * 2, index + 22676224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 6 + 2 + 2, product* 2 * 9 * 9 * 6 * 7 * 6 * 2 * 2, index + 22676992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6 + 2 + 2, product* 8 * 4 * 2 * 7 * 7 * 6 * 2 * 2, index + 22677248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 2 + 2, product* 2 * 7 * 2 * 8 * 7 * 6 * 2 * 2, index + 22678272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 6 + 2 + 2, product* 6 * 9 * 2 * 9 * 7 * 6 * 2 * 2, index + 22679296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 2 + 2, product* 4 * 2 * 6 * 2 * 8 * 6 * 2 * 2, index + 22682624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 2 + 2, product* 2 * 9 * 3 * 3 * 8 * 6 * 2 * 2, index + 22683392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 2 + 2, product* 2 * 3 * 2 * 7 * 8 * 6 * 2 * 2, index + 22687232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 6 + 2 + 2, product* 4 * 4 * 7 * 7 * 8 * 6 * 2 * 2, index + 22687744);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 6 + 2 + 2, product* 2 * 9 * 7 * 9 * 8 * 6 * 2 * 2, index + 22689792);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6 + 2 + 2, product* 6 * 7 * 3 * 3 * 9 * 6 * 2 * 2, index + 22693376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 2 + 2, product* 2 * 3 * 6 * 3 * 9 * 6 * 2 * 2, index + 22693632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6 + 2 + 2, product* 2 * 7 * 4 * 7 * 9 * 6 * 2 * 2, index + 22697472);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 6 + 2 + 2, product* 4 * 6 * 2 * 9 * 9 * 6 * 2 * 2, index + 22699264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 2 + 2, product* 8 * 2 * 3 * 3 * 2 * 7 * 2 * 2, index + 22723328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 2 + 2, product* 4 * 6 * 8 * 4 * 2 * 7 * 2 * 2, index + 22724864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 2 + 2, product* 4 * 2 * 4 * 7 * 2 * 7 * 2 * 2, index + 22727424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 7 + 2 + 2, product* 6 * 3 * 9 * 7 * 2 * 7 * 2 * 2, index + 22727936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 2 + 2, product* 8 * 4 * 4 * 8 * 2 * 7 * 2 * 2, index + 22728448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 2 + 2, product* 2 * 7 * 4 * 9 * 2 * 7 * 2 * 2, index + 22729472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 2 + 2, product* 8 * 2 * 7 * 9 * 2 * 7 * 2 * 2, index + 22729728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 7 + 2 + 2, product* 4 * 8 * 9 * 9 * 2 * 7 * 2 * 2, index + 22729984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7 + 2 + 2, product* 8 * 8 * 2 * 2 * 3 * 7 * 2 * 2, index + 22732288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 2 + 2, product* 4 * 2 * 8 * 3 * 3 * 7 * 2 * 2, index + 22733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 2 + 2, product* 6 * 3 * 3 * 4 * 3 * 7 * 2 * 2, index + 22734336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 2 + 2, product* 4 * 8 * 3 * 6 * 3 * 7 * 2 * 2, index + 22736384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7 + 2 + 2, product* 4 * 6 * 6 * 7 * 3 * 7 * 2 * 2, index + 22737664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 2 + 2, product* 2 * 3 * 4 * 8 * 3 * 7 * 2 * 2, index + 22738432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 7 + 2 + 2, product* 4 * 4 * 9 * 8 * 3 * 7 * 2 * 2, index + 22738944);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 7 + 2 + 2, product* 2 * 9 * 3 * 9 * 3 * 7 * 2 * 2, index + 22739392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 2 + 2, product* 2 * 7 * 2 * 2 * 4 * 7 * 2 * 2, index + 22742272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7 + 2 + 2, product* 4 * 8 * 7 * 2 * 4 * 7 * 2 * 2, index + 22742784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 2 + 2, product* 2 * 3 * 8 * 4 * 4 * 7 * 2 * 2, index + 22744832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 7 + 2 + 2, product* 8 * 6 * 3 * 6 * 4 * 7 * 2 * 2, index + 22746368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 2 + 2, product* 4 * 2 * 6 * 6 * 4 * 7 * 2 * 2, index + 22746624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 2 + 2, product* 2 * 9 * 3 * 7 * 4 * 7 * 2 * 2, index + 22747392);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 7 + 2 + 2, product* 6 * 9 * 4 * 2 * 6 * 7 * 2 * 2, index + 22762496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 2 + 2, product* 4 * 6 * 2 * 3 * 6 * 7 * 2 * 2, index + 22763264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 7 + 2 + 2, product* 8 * 8 * 2 * 4 * 6 * 7 * 2 * 2, index + 22764288);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 2 + 2, product* 4 * 2 * 2 * 2 * 7 * 7 * 2 * 2, index + 22772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 2 + 2, product* 6 * 3 * 7 * 2 * 7 * 7 * 2 * 2, index + 22772736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 7 + 2 + 2, product* 2 * 9 * 9 * 2 * 7 * 7 * 2 * 2, index + 22772992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 2 + 2, product* 8 * 4 * 2 * 3 * 7 * 7 * 2 * 2, index + 22773248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 2 + 2, product* 2 * 7 * 2 * 4 * 7 * 7 * 2 * 2, index + 22774272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 2 + 2, product* 2 * 3 * 8 * 6 * 7 * 7 * 2 * 2, index + 22776832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 7 + 2 + 2, product* 4 * 4 * 3 * 7 * 7 * 7 * 2 * 2, index + 22777344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 7 + 2 + 2, product* 8 * 6 * 3 * 8 * 7 * 7 * 2 * 2, index + 22778368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 7 + 2 + 2, product* 2 * 9 * 3 * 9 * 7 * 7 * 2 * 2, index + 22779392);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 2 + 2, product* 2 * 3 * 2 * 3 * 8 * 7 * 2 * 2, index + 22783232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 2 + 2, product* 8 * 2 * 3 * 7 * 8 * 7 * 2 * 2, index + 22787328);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 7 + 2 + 2, product* 8 * 2 * 7 * 3 * 9 * 7 * 2 * 2, index + 22793728);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 7 + 2 + 2, product* 8 * 8 * 2 * 6 * 9 * 7 * 2 * 2, index + 22796288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 7 + 2 + 2, product* 4 * 2 * 8 * 7 * 9 * 7 * 2 * 2, index + 22797824);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 2 + 2, product* 4 * 2 * 4 * 3 * 2 * 8 * 2 * 2, index + 22823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 2 + 2, product* 6 * 3 * 9 * 3 * 2 * 8 * 2 * 2, index + 22823936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 2 + 2, product* 8 * 4 * 4 * 4 * 2 * 8 * 2 * 2, index + 22824448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 8 + 2 + 2, product* 6 * 9 * 4 * 6 * 2 * 8 * 2 * 2, index + 22826496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 2 + 2, product* 4 * 6 * 2 * 7 * 2 * 8 * 2 * 2, index + 22827264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 2 + 2, product* 4 * 2 * 8 * 9 * 2 * 8 * 2 * 2, index + 22829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 2 + 2, product* 4 * 8 * 3 * 2 * 3 * 8 * 2 * 2, index + 22832384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8 + 2 + 2, product* 4 * 6 * 6 * 3 * 3 * 8 * 2 * 2, index + 22833664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 2 + 2, product* 2 * 3 * 4 * 4 * 3 * 8 * 2 * 2, index + 22834432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 8 + 2 + 2, product* 4 * 4 * 9 * 4 * 3 * 8 * 2 * 2, index + 22834944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 2 + 2, product* 4 * 2 * 2 * 6 * 3 * 8 * 2 * 2, index + 22836224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8 + 2 + 2, product* 6 * 3 * 7 * 6 * 3 * 8 * 2 * 2, index + 22836736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 8 + 2 + 2, product* 8 * 4 * 2 * 7 * 3 * 8 * 2 * 2, index + 22837248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 2 + 2, product* 2 * 7 * 2 * 8 * 3 * 8 * 2 * 2, index + 22838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 2 + 2, product* 6 * 9 * 2 * 9 * 3 * 8 * 2 * 2, index + 22839296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 8 + 2 + 2, product* 8 * 6 * 3 * 2 * 4 * 8 * 2 * 2, index + 22842368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 2 + 2, product* 4 * 2 * 6 * 2 * 4 * 8 * 2 * 2, index + 22842624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 2 + 2, product* 2 * 9 * 3 * 3 * 4 * 8 * 2 * 2, index + 22843392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 8 + 2 + 2, product* 8 * 4 * 6 * 3 * 4 * 8 * 2 * 2, index + 22843648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 2 + 2, product* 2 * 7 * 6 * 4 * 4 * 8 * 2 * 2, index + 22844672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 8 + 2 + 2, product* 8 * 2 * 9 * 4 * 4 * 8 * 2 * 2, index + 22844928);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 8 + 2 + 2, product* 6 * 7 * 9 * 6 * 4 * 8 * 2 * 2, index + 22846976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 2 + 2, product* 2 * 3 * 2 * 7 * 4 * 8 * 2 * 2, index + 22847232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8 + 2 + 2, product* 4 * 4 * 7 * 7 * 4 * 8 * 2 * 2, index + 22847744);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 2 + 2, product* 6 * 3 * 3 * 2 * 6 * 8 * 2 * 2, index + 22862336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 8 + 2 + 2, product* 8 * 4 * 8 * 2 * 6 * 8 * 2 * 2, index + 22862848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 8 + 2 + 2, product* 4 * 8 * 3 * 4 * 6 * 8 * 2 * 2, index + 22864384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6 + 8 + 2 + 2, product* 6 * 9 * 8 * 4 * 6 * 8 * 2 * 2, index + 22864896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 2 + 2, product* 2 * 3 * 4 * 6 * 6 * 8 * 2 * 2, index + 22866432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 2 + 2, product* 4 * 2 * 2 * 8 * 6 * 8 * 2 * 2, index + 22868224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 8 + 2 + 2, product* 8 * 4 * 2 * 9 * 6 * 8 * 2 * 2, index + 22869248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 2 + 2, product* 2 * 3 * 8 * 2 * 7 * 8 * 2 * 2, index + 22872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 2 + 2, product* 4 * 4 * 3 * 3 * 7 * 8 * 2 * 2, index + 22873344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 2 + 2, product* 4 * 2 * 6 * 4 * 7 * 8 * 2 * 2, index + 22874624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 8 + 2 + 2, product* 2 * 7 * 6 * 6 * 7 * 8 * 2 * 2, index + 22876672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 8 + 2 + 2, product* 4 * 6 * 4 * 8 * 7 * 8 * 2 * 2, index + 22878464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 2 + 2, product* 2 * 3 * 2 * 9 * 7 * 8 * 2 * 2, index + 22879232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 8 + 2 + 2, product* 4 * 4 * 7 * 9 * 7 * 8 * 2 * 2, index + 22879744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 2 + 2, product* 8 * 2 * 3 * 3 * 8 * 8 * 2 * 2, index + 22883328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 8 + 2 + 2, product* 4 * 2 * 4 * 7 * 8 * 8 * 2 * 2, index + 22887424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8 + 8 + 2 + 2, product* 6 * 3 * 9 * 7 * 8 * 8 * 2 * 2, index + 22887936);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 2 + 2, product* 4 * 2 * 8 * 3 * 9 * 8 * 2 * 2, index + 22893824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 8 + 2 + 2, product* 4 * 8 * 3 * 6 * 9 * 8 * 2 * 2, index + 22896384);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 2 + 2, product* 6 * 9 * 4 * 2 * 2 * 9 * 2 * 2, index + 22922496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 2 + 2, product* 4 * 6 * 2 * 3 * 2 * 9 * 2 * 2, index + 22923264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 9 + 2 + 2, product* 6 * 7 * 7 * 3 * 2 * 9 * 2 * 2, index + 22923776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9 + 2 + 2, product* 8 * 8 * 2 * 4 * 2 * 9 * 2 * 2, index + 22924288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 2 + 2, product* 6 * 3 * 3 * 6 * 2 * 9 * 2 * 2, index + 22926336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 9 + 2 + 2, product* 2 * 7 * 8 * 7 * 2 * 9 * 2 * 2, index + 22927872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9 + 2 + 2, product* 4 * 8 * 3 * 8 * 2 * 9 * 2 * 2, index + 22928384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 2 + 2, product* 4 * 2 * 2 * 2 * 3 * 9 * 2 * 2, index + 22932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 2 + 2, product* 6 * 3 * 7 * 2 * 3 * 9 * 2 * 2, index + 22932736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 2 + 2, product* 2 * 9 * 9 * 2 * 3 * 9 * 2 * 2, index + 22932992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 2 + 2, product* 8 * 4 * 2 * 3 * 3 * 9 * 2 * 2, index + 22933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 2 + 2, product* 2 * 7 * 2 * 4 * 3 * 9 * 2 * 2, index + 22934272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 9 + 2 + 2, product* 4 * 8 * 7 * 4 * 3 * 9 * 2 * 2, index + 22934784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 2 + 2, product* 2 * 3 * 8 * 6 * 3 * 9 * 2 * 2, index + 22936832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9 + 2 + 2, product* 4 * 4 * 3 * 7 * 3 * 9 * 2 * 2, index + 22937344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 9 + 2 + 2, product* 4 * 2 * 6 * 8 * 3 * 9 * 2 * 2, index + 22938624);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 9 + 2 + 2, product* 6 * 7 * 9 * 2 * 4 * 9 * 2 * 2, index + 22942976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 2 + 2, product* 2 * 3 * 2 * 3 * 4 * 9 * 2 * 2, index + 22943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 2 + 2, product* 4 * 4 * 7 * 3 * 4 * 9 * 2 * 2, index + 22943744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 2 + 2, product* 8 * 2 * 3 * 7 * 4 * 9 * 2 * 2, index + 22947328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 9 + 2 + 2, product* 4 * 6 * 8 * 8 * 4 * 9 * 2 * 2, index + 22948864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4 + 9 + 2 + 2, product* 6 * 7 * 3 * 9 * 4 * 9 * 2 * 2, index + 22949376);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 2 + 2, product* 2 * 3 * 4 * 2 * 6 * 9 * 2 * 2, index + 22962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 2 + 2, product* 4 * 2 * 2 * 4 * 6 * 9 * 2 * 2, index + 22964224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 9 + 2 + 2, product* 6 * 3 * 7 * 4 * 6 * 9 * 2 * 2, index + 22964736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6 + 9 + 2 + 2, product* 2 * 9 * 9 * 4 * 6 * 9 * 2 * 2, index + 22964992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 9 + 2 + 2, product* 2 * 7 * 2 * 6 * 6 * 9 * 2 * 2, index + 22966272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 9 + 2 + 2, product* 4 * 8 * 7 * 6 * 6 * 9 * 2 * 2, index + 22966784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 9 + 2 + 2, product* 6 * 9 * 2 * 7 * 6 * 9 * 2 * 2, index + 22967296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 9 + 2 + 2, product* 2 * 3 * 8 * 8 * 6 * 9 * 2 * 2, index + 22968832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 9 + 2 + 2, product* 4 * 4 * 3 * 9 * 6 * 9 * 2 * 2, index + 22969344);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 9 + 2 + 2, product* 8 * 2 * 9 * 2 * 7 * 9 * 2 * 2, index + 22972928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 9 + 2 + 2, product* 2 * 9 * 9 * 2 * 7 * 9 * 2 * 2, index + 22972992);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 9 + 2 + 2, product* 4 * 6 * 4 * 4 * 7 * 9 * 2 * 2, index + 22974464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 9 + 2 + 2, product* 6 * 7 * 9 * 4 * 7 * 9 * 2 * 2, index + 22974976);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 2 + 2, product* 4 * 2 * 4 * 3 * 8 * 9 * 2 * 2, index + 22983424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 9 + 2 + 2, product* 4 * 6 * 2 * 7 * 8 * 9 * 2 * 2, index + 22987264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 9 + 2 + 2, product* 4 * 2 * 8 * 9 * 8 * 9 * 2 * 2, index + 22989824);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9 + 2 + 2, product* 2 * 3 * 4 * 4 * 9 * 9 * 2 * 2, index + 22994432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 9 + 2 + 2, product* 4 * 2 * 2 * 6 * 9 * 9 * 2 * 2, index + 22996224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9 + 9 + 2 + 2, product* 2 * 7 * 2 * 8 * 9 * 9 * 2 * 2, index + 22998272);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 3 + 2, product* 2 * 7 * 2 * 2 * 2 * 2 * 3 * 2, index + 23222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 3 + 2, product* 4 * 8 * 7 * 2 * 2 * 2 * 3 * 2, index + 23222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 3 + 2, product* 6 * 9 * 2 * 3 * 2 * 2 * 3 * 2, index + 23223296);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 3 + 2, product* 6 * 3 * 9 * 3 * 2 * 2 * 3 * 2, index + 23223936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 3 + 2, product* 2 * 3 * 8 * 4 * 2 * 2 * 3 * 2, index + 23224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 3 + 2, product* 8 * 6 * 3 * 6 * 2 * 2 * 3 * 2, index + 23226368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 3 + 2, product* 4 * 2 * 6 * 6 * 2 * 2 * 3 * 2, index + 23226624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 3 + 2, product* 2 * 9 * 3 * 7 * 2 * 2 * 3 * 2, index + 23227392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2 + 3 + 2, product* 8 * 4 * 6 * 7 * 2 * 2 * 3 * 2, index + 23227648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2 + 3 + 2, product* 2 * 7 * 6 * 8 * 2 * 2 * 3 * 2, index + 23228672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 3 + 2, product* 8 * 2 * 9 * 8 * 2 * 2 * 3 * 2, index + 23228928);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 3 + 2, product* 8 * 6 * 7 * 2 * 3 * 2 * 3 * 2, index + 23232768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 3 + 2, product* 2 * 9 * 7 * 3 * 3 * 2 * 3 * 2, index + 23233792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 3 + 2, product* 4 * 6 * 8 * 6 * 3 * 2 * 3 * 2, index + 23236864);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 3 + 2, product* 6 * 7 * 3 * 7 * 3 * 2 * 3 * 2, index + 23237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 3 + 2, product* 2 * 3 * 6 * 7 * 3 * 2 * 3 * 2, index + 23237632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 3 + 2, product* 4 * 2 * 4 * 9 * 3 * 2 * 3 * 2, index + 23239424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 3 + 2, product* 6 * 9 * 4 * 2 * 4 * 2 * 3 * 2, index + 23242496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 3 + 2, product* 4 * 6 * 2 * 3 * 4 * 2 * 3 * 2, index + 23243264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 3 + 2, product* 6 * 7 * 7 * 3 * 4 * 2 * 3 * 2, index + 23243776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 3 + 2, product* 8 * 8 * 2 * 4 * 4 * 2 * 3 * 2, index + 23244288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 3 + 2, product* 6 * 3 * 3 * 6 * 4 * 2 * 3 * 2, index + 23246336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 2 + 3 + 2, product* 8 * 4 * 8 * 6 * 4 * 2 * 3 * 2, index + 23246848);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 2 + 3 + 2, product* 2 * 7 * 8 * 7 * 4 * 2 * 3 * 2, index + 23247872);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 3 + 2, product* 4 * 6 * 4 * 2 * 6 * 2 * 3 * 2, index + 23262464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 2 + 3 + 2, product* 6 * 7 * 9 * 2 * 6 * 2 * 3 * 2, index + 23262976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 3 + 2, product* 2 * 3 * 2 * 3 * 6 * 2 * 3 * 2, index + 23263232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 3 + 2, product* 8 * 8 * 4 * 3 * 6 * 2 * 3 * 2, index + 23263488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 2 + 3 + 2, product* 4 * 4 * 7 * 3 * 6 * 2 * 3 * 2, index + 23263744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 2 + 3 + 2, product* 8 * 6 * 7 * 4 * 6 * 2 * 3 * 2, index + 23264768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 3 + 2, product* 8 * 2 * 3 * 7 * 6 * 2 * 3 * 2, index + 23267328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 2 + 3 + 2, product* 4 * 6 * 8 * 8 * 6 * 2 * 3 * 2, index + 23268864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 2 + 3 + 2, product* 6 * 7 * 3 * 9 * 6 * 2 * 3 * 2, index + 23269376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2 + 3 + 2, product* 2 * 3 * 6 * 9 * 6 * 2 * 3 * 2, index + 23269632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 3 + 2, product* 8 * 4 * 4 * 2 * 7 * 2 * 3 * 2, index + 23272448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 3 + 2, product* 2 * 7 * 4 * 3 * 7 * 2 * 3 * 2, index + 23273472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 3 + 2, product* 4 * 8 * 9 * 3 * 7 * 2 * 3 * 2, index + 23273984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2 + 3 + 2, product* 6 * 9 * 4 * 4 * 7 * 2 * 3 * 2, index + 23274496);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 3 + 2, product* 4 * 2 * 8 * 7 * 7 * 2 * 3 * 2, index + 23277824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2 + 3 + 2, product* 6 * 3 * 3 * 8 * 7 * 2 * 3 * 2, index + 23278336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 3 + 2, product* 2 * 3 * 2 * 9 * 7 * 2 * 3 * 2, index + 23279232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 3 + 2, product* 2 * 3 * 4 * 2 * 8 * 2 * 3 * 2, index + 23282432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 2 + 3 + 2, product* 8 * 8 * 6 * 2 * 8 * 2 * 3 * 2, index + 23282688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 3 + 2, product* 4 * 4 * 9 * 2 * 8 * 2 * 3 * 2, index + 23282944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 3 + 2, product* 4 * 2 * 2 * 4 * 8 * 2 * 3 * 2, index + 23284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 3 + 2, product* 6 * 3 * 7 * 4 * 8 * 2 * 3 * 2, index + 23284736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 2 + 3 + 2, product* 2 * 9 * 9 * 4 * 8 * 2 * 3 * 2, index + 23284992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 3 + 2, product* 2 * 7 * 2 * 6 * 8 * 2 * 3 * 2, index + 23286272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 8 + 2 + 3 + 2, product* 4 * 8 * 7 * 6 * 8 * 2 * 3 * 2, index + 23286784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 2 + 3 + 2, product* 6 * 9 * 2 * 7 * 8 * 2 * 3 * 2, index + 23287296);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 2 + 3 + 2, product* 4 * 4 * 3 * 9 * 8 * 2 * 3 * 2, index + 23289344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 3 + 2, product* 2 * 7 * 6 * 2 * 9 * 2 * 3 * 2, index + 23292672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 2 + 3 + 2, product* 8 * 2 * 9 * 2 * 9 * 2 * 3 * 2, index + 23292928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 3 + 2, product* 4 * 6 * 4 * 4 * 9 * 2 * 3 * 2, index + 23294464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 2 + 3 + 2, product* 2 * 9 * 7 * 7 * 9 * 2 * 3 * 2, index + 23297792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 2 + 3 + 2, product* 8 * 2 * 3 * 9 * 9 * 2 * 3 * 2, index + 23299328);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 3 + 2, product* 8 * 6 * 3 * 2 * 2 * 3 * 3 * 2, index + 23322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 3 + 2, product* 4 * 2 * 6 * 2 * 2 * 3 * 3 * 2, index + 23322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 3 + 2, product* 2 * 9 * 3 * 3 * 2 * 3 * 3 * 2, index + 23323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 3 + 2, product* 8 * 4 * 6 * 3 * 2 * 3 * 3 * 2, index + 23323648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 3 + 2, product* 2 * 7 * 6 * 4 * 2 * 3 * 3 * 2, index + 23324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 3 + 2, product* 8 * 2 * 9 * 4 * 2 * 3 * 3 * 2, index + 23324928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 3 + 2, product* 4 * 6 * 4 * 6 * 2 * 3 * 3 * 2, index + 23326464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 3 + 2, product* 2 * 3 * 2 * 7 * 2 * 3 * 3 * 2, index + 23327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 3 + 2, product* 8 * 8 * 4 * 7 * 2 * 3 * 3 * 2, index + 23327488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 3 + 2, product* 4 * 4 * 7 * 7 * 2 * 3 * 3 * 2, index + 23327744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3 + 3 + 2, product* 8 * 6 * 7 * 8 * 2 * 3 * 3 * 2, index + 23328768);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 3 + 2, product* 2 * 9 * 7 * 9 * 2 * 3 * 3 * 2, index + 23329792);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 3 + 2, product* 4 * 6 * 8 * 2 * 3 * 3 * 3 * 2, index + 23332864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 3 + 2, product* 6 * 7 * 3 * 3 * 3 * 3 * 3 * 2, index + 23333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 3 + 2, product* 2 * 3 * 6 * 3 * 3 * 3 * 3 * 2, index + 23333632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 3 + 3 + 2, product* 8 * 8 * 8 * 3 * 3 * 3 * 3 * 2, index + 23333888);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 3 + 3 + 2, product* 8 * 4 * 4 * 6 * 3 * 3 * 3 * 2, index + 23336448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 3 + 2, product* 2 * 7 * 4 * 7 * 3 * 3 * 3 * 2, index + 23337472);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3 + 3 + 3 + 2, product* 4 * 8 * 9 * 7 * 3 * 3 * 3 * 2, index + 23337984);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 3 + 3 + 2, product* 2 * 3 * 2 * 9 * 3 * 3 * 3 * 2, index + 23339232);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 3 + 2, product* 4 * 6 * 2 * 9 * 3 * 3 * 3 * 2, index + 23339264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 3 + 2, product* 6 * 3 * 3 * 2 * 4 * 3 * 3 * 2, index + 23342336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 3 + 2, product* 2 * 3 * 2 * 3 * 4 * 3 * 3 * 2, index + 23343232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 3 + 2, product* 2 * 7 * 8 * 3 * 4 * 3 * 3 * 2, index + 23343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 3 + 2, product* 4 * 8 * 3 * 4 * 4 * 3 * 3 * 2, index + 23344384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 3 + 2, product* 2 * 3 * 4 * 6 * 4 * 3 * 3 * 2, index + 23346432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 3 + 3 + 2, product* 8 * 8 * 6 * 6 * 4 * 3 * 3 * 2, index + 23346688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 3 + 3 + 2, product* 4 * 4 * 9 * 6 * 4 * 3 * 3 * 2, index + 23346944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 3 + 2, product* 4 * 2 * 2 * 8 * 4 * 3 * 3 * 2, index + 23348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 3 + 2, product* 6 * 3 * 7 * 8 * 4 * 3 * 3 * 2, index + 23348736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 3 + 2, product* 8 * 4 * 2 * 9 * 4 * 3 * 3 * 2, index + 23349248);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 3 + 2, product* 8 * 2 * 3 * 3 * 6 * 3 * 3 * 2, index + 23363328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 3 + 3 + 2, product* 4 * 6 * 8 * 4 * 6 * 3 * 3 * 2, index + 23364864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 3 + 2, product* 4 * 2 * 4 * 7 * 6 * 3 * 3 * 2, index + 23367424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 3 + 2, product* 8 * 4 * 4 * 8 * 6 * 3 * 3 * 2, index + 23368448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 3 + 3 + 2, product* 2 * 7 * 4 * 9 * 6 * 3 * 3 * 2, index + 23369472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 3 + 3 + 2, product* 8 * 2 * 7 * 9 * 6 * 3 * 3 * 2, index + 23369728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 6 + 3 + 3 + 2, product* 4 * 8 * 9 * 9 * 6 * 3 * 3 * 2, index + 23369984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3 + 3 + 2, product* 8 * 8 * 2 * 2 * 7 * 3 * 3 * 2, index + 23372288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 3 + 2, product* 4 * 2 * 8 * 3 * 7 * 3 * 3 * 2, index + 23373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 3 + 2, product* 6 * 3 * 3 * 4 * 7 * 3 * 3 * 2, index + 23374336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 3 + 3 + 2, product* 4 * 8 * 3 * 6 * 7 * 3 * 3 * 2, index + 23376384);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 7 + 3 + 3 + 2, product* 6 * 9 * 8 * 6 * 7 * 3 * 3 * 2, index + 23376896);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 3 + 2, product* 2 * 7 * 4 * 7 * 7 * 3 * 3 * 2, index + 23377472);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 3 + 2, product* 2 * 3 * 4 * 8 * 7 * 3 * 3 * 2, index + 23378432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 3 + 2, product* 2 * 7 * 2 * 2 * 8 * 3 * 3 * 2, index + 23382272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 3 + 2, product* 6 * 9 * 2 * 3 * 8 * 3 * 3 * 2, index + 23383296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 3 + 2, product* 2 * 3 * 8 * 4 * 8 * 3 * 3 * 2, index + 23384832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 3 + 3 + 2, product* 4 * 2 * 6 * 6 * 8 * 3 * 3 * 2, index + 23386624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 3 + 3 + 2, product* 2 * 9 * 3 * 7 * 8 * 3 * 3 * 2, index + 23387392);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 3 + 3 + 2, product* 8 * 6 * 7 * 2 * 9 * 3 * 3 * 2, index + 23392768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3 + 3 + 2, product* 2 * 9 * 7 * 3 * 9 * 3 * 3 * 2, index + 23393792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 9 + 3 + 3 + 2, product* 4 * 6 * 8 * 6 * 9 * 3 * 3 * 2, index + 23396864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3 + 3 + 2, product* 2 * 3 * 6 * 7 * 9 * 3 * 3 * 2, index + 23397632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 3 + 2, product* 4 * 2 * 4 * 9 * 9 * 3 * 3 * 2, index + 23399424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 3 + 2, product* 4 * 6 * 4 * 2 * 2 * 4 * 3 * 2, index + 23422464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 3 + 2, product* 6 * 7 * 9 * 2 * 2 * 4 * 3 * 2, index + 23422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 3 + 2, product* 2 * 3 * 2 * 3 * 2 * 4 * 3 * 2, index + 23423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 3 + 2, product* 8 * 8 * 4 * 3 * 2 * 4 * 3 * 2, index + 23423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 3 + 2, product* 4 * 4 * 7 * 3 * 2 * 4 * 3 * 2, index + 23423744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 3 + 2, product* 8 * 2 * 3 * 7 * 2 * 4 * 3 * 2, index + 23427328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 4 + 3 + 2, product* 4 * 6 * 8 * 8 * 2 * 4 * 3 * 2, index + 23428864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 3 + 2, product* 2 * 3 * 6 * 9 * 2 * 4 * 3 * 2, index + 23429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 3 + 2, product* 8 * 4 * 4 * 2 * 3 * 4 * 3 * 2, index + 23432448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 3 + 2, product* 2 * 7 * 4 * 3 * 3 * 4 * 3 * 2, index + 23433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 3 + 2, product* 8 * 2 * 7 * 3 * 3 * 4 * 3 * 2, index + 23433728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 4 + 3 + 2, product* 6 * 9 * 4 * 4 * 3 * 4 * 3 * 2, index + 23434496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4 + 3 + 2, product* 8 * 8 * 2 * 6 * 3 * 4 * 3 * 2, index + 23436288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4 + 3 + 2, product* 4 * 2 * 8 * 7 * 3 * 4 * 3 * 2, index + 23437824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 3 + 2, product* 6 * 3 * 3 * 8 * 3 * 4 * 3 * 2, index + 23438336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 4 + 3 + 2, product* 2 * 7 * 8 * 9 * 3 * 4 * 3 * 2, index + 23439872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 3 + 2, product* 2 * 3 * 4 * 2 * 4 * 4 * 3 * 2, index + 23442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 3 + 2, product* 4 * 4 * 9 * 2 * 4 * 4 * 3 * 2, index + 23442944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 3 + 2, product* 4 * 2 * 2 * 4 * 4 * 4 * 3 * 2, index + 23444224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 4 + 3 + 2, product* 6 * 3 * 7 * 4 * 4 * 4 * 3 * 2, index + 23444736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 4 + 3 + 2, product* 2 * 9 * 9 * 4 * 4 * 4 * 3 * 2, index + 23444992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 3 + 2, product* 2 * 7 * 2 * 6 * 4 * 4 * 3 * 2, index + 23446272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 4 + 3 + 2, product* 2 * 3 * 8 * 8 * 4 * 4 * 3 * 2, index + 23448832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 3 + 2, product* 4 * 4 * 3 * 9 * 4 * 4 * 3 * 2, index + 23449344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 3 + 2, product* 4 * 2 * 4 * 3 * 6 * 4 * 3 * 2, index + 23463424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 4 + 3 + 2, product* 8 * 4 * 4 * 4 * 6 * 4 * 3 * 2, index + 23464448);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 3 + 2, product* 4 * 8 * 3 * 2 * 7 * 4 * 3 * 2, index + 23472384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 4 + 3 + 2, product* 4 * 6 * 6 * 3 * 7 * 4 * 3 * 2, index + 23473664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 3 + 2, product* 2 * 3 * 4 * 4 * 7 * 4 * 3 * 2, index + 23474432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 3 + 2, product* 4 * 2 * 2 * 6 * 7 * 4 * 3 * 2, index + 23476224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 4 + 3 + 2, product* 6 * 3 * 7 * 6 * 7 * 4 * 3 * 2, index + 23476736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 4 + 3 + 2, product* 8 * 4 * 2 * 7 * 7 * 4 * 3 * 2, index + 23477248);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 3 + 2, product* 2 * 3 * 6 * 7 * 7 * 4 * 3 * 2, index + 23477632);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 3 + 2, product* 2 * 7 * 2 * 8 * 7 * 4 * 3 * 2, index + 23478272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 4 + 3 + 2, product* 6 * 9 * 2 * 9 * 7 * 4 * 3 * 2, index + 23479296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 3 + 2, product* 4 * 2 * 6 * 2 * 8 * 4 * 3 * 2, index + 23482624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 3 + 2, product* 2 * 9 * 3 * 3 * 8 * 4 * 3 * 2, index + 23483392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 4 + 3 + 2, product* 8 * 4 * 6 * 3 * 8 * 4 * 3 * 2, index + 23483648);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4 + 3 + 2, product* 4 * 6 * 4 * 6 * 8 * 4 * 3 * 2, index + 23486464);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 4 + 3 + 2, product* 2 * 9 * 7 * 9 * 8 * 4 * 3 * 2, index + 23489792);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 3 + 2, product* 2 * 3 * 6 * 3 * 9 * 4 * 3 * 2, index + 23493632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 4 + 3 + 2, product* 8 * 8 * 8 * 3 * 9 * 4 * 3 * 2, index + 23493888);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9 + 4 + 3 + 2, product* 4 * 8 * 9 * 7 * 9 * 4 * 3 * 2, index + 23497984);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 4 + 3 + 2, product* 4 * 6 * 2 * 9 * 9 * 4 * 3 * 2, index + 23499264);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 3 + 2, product* 4 * 2 * 4 * 3 * 2 * 6 * 3 * 2, index + 23623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 3 + 2, product* 6 * 3 * 9 * 3 * 2 * 6 * 3 * 2, index + 23623936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 6 + 3 + 2, product* 6 * 9 * 4 * 6 * 2 * 6 * 3 * 2, index + 23626496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 3 + 2, product* 4 * 6 * 2 * 7 * 2 * 6 * 3 * 2, index + 23627264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 6 + 3 + 2, product* 8 * 8 * 2 * 8 * 2 * 6 * 3 * 2, index + 23628288);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6 + 3 + 2, product* 4 * 6 * 6 * 3 * 3 * 6 * 3 * 2, index + 23633664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 3 + 2, product* 2 * 3 * 4 * 4 * 3 * 6 * 3 * 2, index + 23634432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 6 + 3 + 2, product* 4 * 4 * 9 * 4 * 3 * 6 * 3 * 2, index + 23634944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 3 + 2, product* 4 * 2 * 2 * 6 * 3 * 6 * 3 * 2, index + 23636224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 6 + 3 + 2, product* 8 * 4 * 2 * 7 * 3 * 6 * 3 * 2, index + 23637248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 3 + 2, product* 2 * 7 * 2 * 8 * 3 * 6 * 3 * 2, index + 23638272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 6 + 3 + 2, product* 8 * 6 * 3 * 2 * 4 * 6 * 3 * 2, index + 23642368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 3 + 2, product* 4 * 2 * 6 * 2 * 4 * 6 * 3 * 2, index + 23642624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 6 + 3 + 2, product* 2 * 9 * 3 * 3 * 4 * 6 * 3 * 2, index + 23643392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 6 + 3 + 2, product* 8 * 4 * 6 * 3 * 4 * 6 * 3 * 2, index + 23643648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 3 + 2, product* 2 * 7 * 6 * 4 * 4 * 6 * 3 * 2, index + 23644672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 6 + 3 + 2, product* 8 * 2 * 9 * 4 * 4 * 6 * 3 * 2, index + 23644928);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 6 + 3 + 2, product* 6 * 7 * 9 * 6 * 4 * 6 * 3 * 2, index + 23646976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 3 + 2, product* 2 * 3 * 2 * 7 * 4 * 6 * 3 * 2, index + 23647232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 6 + 3 + 2, product* 4 * 4 * 7 * 7 * 4 * 6 * 3 * 2, index + 23647744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 6 + 3 + 2, product* 8 * 6 * 7 * 8 * 4 * 6 * 3 * 2, index + 23648768);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 6 + 3 + 2, product* 2 * 9 * 7 * 9 * 4 * 6 * 3 * 2, index + 23649792);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 3 + 2, product* 6 * 3 * 3 * 2 * 6 * 6 * 3 * 2, index + 23662336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6 + 3 + 2, product* 8 * 4 * 8 * 2 * 6 * 6 * 3 * 2, index + 23662848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 6 + 3 + 2, product* 2 * 7 * 8 * 3 * 6 * 6 * 3 * 2, index + 23663872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 3 + 2, product* 2 * 3 * 4 * 6 * 6 * 6 * 3 * 2, index + 23666432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 3 + 2, product* 4 * 2 * 2 * 8 * 6 * 6 * 3 * 2, index + 23668224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 3 + 2, product* 2 * 3 * 8 * 2 * 7 * 6 * 3 * 2, index + 23672832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 6 + 3 + 2, product* 4 * 4 * 3 * 3 * 7 * 6 * 3 * 2, index + 23673344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 3 + 2, product* 4 * 2 * 6 * 4 * 7 * 6 * 3 * 2, index + 23674624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 6 + 3 + 2, product* 2 * 7 * 6 * 6 * 7 * 6 * 3 * 2, index + 23676672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 6 + 3 + 2, product* 4 * 6 * 4 * 8 * 7 * 6 * 3 * 2, index + 23678464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 3 + 2, product* 2 * 3 * 2 * 9 * 7 * 6 * 3 * 2, index + 23679232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6 + 3 + 2, product* 8 * 2 * 3 * 3 * 8 * 6 * 3 * 2, index + 23683328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 6 + 3 + 2, product* 4 * 2 * 4 * 7 * 8 * 6 * 3 * 2, index + 23687424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 6 + 3 + 2, product* 8 * 4 * 4 * 8 * 8 * 6 * 3 * 2, index + 23688448);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 6 + 3 + 2, product* 4 * 2 * 8 * 3 * 9 * 6 * 3 * 2, index + 23693824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 6 + 3 + 2, product* 6 * 3 * 3 * 4 * 9 * 6 * 3 * 2, index + 23694336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 6 + 3 + 2, product* 4 * 8 * 3 * 6 * 9 * 6 * 3 * 2, index + 23696384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 6 + 3 + 2, product* 2 * 3 * 4 * 8 * 9 * 6 * 3 * 2, index + 23698432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 3 + 2, product* 6 * 9 * 4 * 2 * 2 * 7 * 3 * 2, index + 23722496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 3 + 2, product* 4 * 6 * 2 * 3 * 2 * 7 * 3 * 2, index + 23723264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 3 + 2, product* 2 * 9 * 3 * 3 * 2 * 7 * 3 * 2, index + 23723392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 3 + 2, product* 8 * 8 * 2 * 4 * 2 * 7 * 3 * 2, index + 23724288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7 + 3 + 2, product* 6 * 3 * 3 * 6 * 2 * 7 * 3 * 2, index + 23726336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 7 + 3 + 2, product* 8 * 4 * 8 * 6 * 2 * 7 * 3 * 2, index + 23726848);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 7 + 3 + 2, product* 4 * 6 * 6 * 9 * 2 * 7 * 3 * 2, index + 23729664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 3 + 2, product* 4 * 2 * 2 * 2 * 3 * 7 * 3 * 2, index + 23732224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 3 + 2, product* 6 * 3 * 7 * 2 * 3 * 7 * 3 * 2, index + 23732736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 3 + 2, product* 2 * 9 * 9 * 2 * 3 * 7 * 3 * 2, index + 23732992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 3 + 2, product* 8 * 4 * 2 * 3 * 3 * 7 * 3 * 2, index + 23733248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 3 + 2, product* 2 * 7 * 2 * 4 * 3 * 7 * 3 * 2, index + 23734272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 7 + 3 + 2, product* 4 * 8 * 7 * 4 * 3 * 7 * 3 * 2, index + 23734784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7 + 3 + 2, product* 2 * 3 * 8 * 6 * 3 * 7 * 3 * 2, index + 23736832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 7 + 3 + 2, product* 4 * 4 * 3 * 7 * 3 * 7 * 3 * 2, index + 23737344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 7 + 3 + 2, product* 8 * 6 * 3 * 8 * 3 * 7 * 3 * 2, index + 23738368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 3 + 2, product* 4 * 2 * 6 * 8 * 3 * 7 * 3 * 2, index + 23738624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 3 + 2, product* 4 * 6 * 4 * 2 * 4 * 7 * 3 * 2, index + 23742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 3 + 2, product* 2 * 3 * 2 * 3 * 4 * 7 * 3 * 2, index + 23743232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 7 + 3 + 2, product* 8 * 2 * 3 * 7 * 4 * 7 * 3 * 2, index + 23747328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 4 + 7 + 3 + 2, product* 6 * 7 * 3 * 9 * 4 * 7 * 3 * 2, index + 23749376);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 3 + 2, product* 2 * 3 * 4 * 2 * 6 * 7 * 3 * 2, index + 23762432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7 + 3 + 2, product* 4 * 4 * 9 * 2 * 6 * 7 * 3 * 2, index + 23762944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 3 + 2, product* 4 * 2 * 2 * 4 * 6 * 7 * 3 * 2, index + 23764224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 7 + 3 + 2, product* 6 * 3 * 7 * 4 * 6 * 7 * 3 * 2, index + 23764736);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 7 + 3 + 2, product* 4 * 8 * 7 * 6 * 6 * 7 * 3 * 2, index + 23766784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 7 + 3 + 2, product* 2 * 3 * 8 * 8 * 6 * 7 * 3 * 2, index + 23768832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 7 + 3 + 2, product* 4 * 4 * 3 * 9 * 6 * 7 * 3 * 2, index + 23769344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 7 + 3 + 2, product* 2 * 7 * 6 * 2 * 7 * 7 * 3 * 2, index + 23772672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 7 + 3 + 2, product* 4 * 6 * 4 * 4 * 7 * 7 * 3 * 2, index + 23774464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 7 + 3 + 2, product* 6 * 7 * 9 * 4 * 7 * 7 * 3 * 2, index + 23774976);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7 + 3 + 2, product* 8 * 2 * 3 * 9 * 7 * 7 * 3 * 2, index + 23779328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7 + 3 + 2, product* 4 * 2 * 4 * 3 * 8 * 7 * 3 * 2, index + 23783424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 7 + 3 + 2, product* 6 * 3 * 9 * 3 * 8 * 7 * 3 * 2, index + 23783936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8 + 7 + 3 + 2, product* 6 * 9 * 4 * 6 * 8 * 7 * 3 * 2, index + 23786496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 7 + 3 + 2, product* 4 * 6 * 2 * 7 * 8 * 7 * 3 * 2, index + 23787264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 7 + 3 + 2, product* 4 * 2 * 8 * 9 * 8 * 7 * 3 * 2, index + 23789824);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 7 + 3 + 2, product* 4 * 6 * 6 * 3 * 9 * 7 * 3 * 2, index + 23793664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 3 + 2, product* 2 * 3 * 4 * 4 * 9 * 7 * 3 * 2, index + 23794432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7 + 3 + 2, product* 4 * 2 * 2 * 6 * 9 * 7 * 3 * 2, index + 23796224);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 3 + 2, product* 6 * 3 * 3 * 2 * 2 * 8 * 3 * 2, index + 23822336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 3 + 2, product* 2 * 7 * 8 * 3 * 2 * 8 * 3 * 2, index + 23823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 3 + 2, product* 4 * 8 * 3 * 4 * 2 * 8 * 3 * 2, index + 23824384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8 + 3 + 2, product* 6 * 9 * 8 * 4 * 2 * 8 * 3 * 2, index + 23824896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 3 + 2, product* 2 * 3 * 4 * 6 * 2 * 8 * 3 * 2, index + 23826432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 8 + 3 + 2, product* 4 * 4 * 9 * 6 * 2 * 8 * 3 * 2, index + 23826944);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 8 + 3 + 2, product* 8 * 6 * 9 * 7 * 2 * 8 * 3 * 2, index + 23827968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 3 + 2, product* 4 * 2 * 2 * 8 * 2 * 8 * 3 * 2, index + 23828224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 8 + 3 + 2, product* 6 * 3 * 7 * 8 * 2 * 8 * 3 * 2, index + 23828736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 3 + 2, product* 8 * 4 * 2 * 9 * 2 * 8 * 3 * 2, index + 23829248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 3 + 2, product* 2 * 3 * 8 * 2 * 3 * 8 * 3 * 2, index + 23832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 3 + 2, product* 4 * 4 * 3 * 3 * 3 * 8 * 3 * 2, index + 23833344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 8 + 3 + 2, product* 8 * 6 * 3 * 4 * 3 * 8 * 3 * 2, index + 23834368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 3 + 2, product* 4 * 2 * 6 * 4 * 3 * 8 * 3 * 2, index + 23834624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 8 + 3 + 2, product* 2 * 7 * 6 * 6 * 3 * 8 * 3 * 2, index + 23836672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 8 + 3 + 2, product* 8 * 2 * 9 * 6 * 3 * 8 * 3 * 2, index + 23836928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 3 + 2, product* 2 * 3 * 2 * 9 * 3 * 8 * 3 * 2, index + 23839232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 8 + 3 + 2, product* 8 * 2 * 3 * 3 * 4 * 8 * 3 * 2, index + 23843328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 8 + 3 + 2, product* 4 * 2 * 4 * 7 * 4 * 8 * 3 * 2, index + 23847424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 8 + 3 + 2, product* 2 * 7 * 4 * 9 * 4 * 8 * 3 * 2, index + 23849472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 8 + 3 + 2, product* 4 * 8 * 9 * 9 * 4 * 8 * 3 * 2, index + 23849984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 3 + 2, product* 2 * 7 * 2 * 2 * 6 * 8 * 3 * 2, index + 23862272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 8 + 3 + 2, product* 6 * 9 * 2 * 3 * 6 * 8 * 3 * 2, index + 23863296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8 + 3 + 2, product* 2 * 3 * 8 * 4 * 6 * 8 * 3 * 2, index + 23864832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 8 + 3 + 2, product* 2 * 9 * 3 * 7 * 6 * 8 * 3 * 2, index + 23867392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 8 + 3 + 2, product* 8 * 4 * 6 * 7 * 6 * 8 * 3 * 2, index + 23867648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 8 + 3 + 2, product* 2 * 7 * 6 * 8 * 6 * 8 * 3 * 2, index + 23868672);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 8 + 3 + 2, product* 6 * 7 * 3 * 7 * 7 * 8 * 3 * 2, index + 23877376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 8 + 3 + 2, product* 2 * 3 * 6 * 7 * 7 * 8 * 3 * 2, index + 23877632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 3 + 2, product* 4 * 6 * 2 * 3 * 8 * 8 * 3 * 2, index + 23883264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 8 + 3 + 2, product* 6 * 7 * 7 * 3 * 8 * 8 * 3 * 2, index + 23883776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 8 + 3 + 2, product* 8 * 8 * 2 * 4 * 8 * 8 * 3 * 2, index + 23884288);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 8 + 3 + 2, product* 8 * 4 * 8 * 6 * 8 * 8 * 3 * 2, index + 23886848);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 3 + 2, product* 4 * 2 * 2 * 2 * 9 * 8 * 3 * 2, index + 23892224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 8 + 3 + 2, product* 2 * 9 * 9 * 2 * 9 * 8 * 3 * 2, index + 23892992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 8 + 3 + 2, product* 8 * 4 * 2 * 3 * 9 * 8 * 3 * 2, index + 23893248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 8 + 3 + 2, product* 2 * 7 * 2 * 4 * 9 * 8 * 3 * 2, index + 23894272);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 8 + 3 + 2, product* 2 * 9 * 3 * 9 * 9 * 8 * 3 * 2, index + 23899392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 3 + 2, product* 2 * 3 * 4 * 2 * 2 * 9 * 3 * 2, index + 23922432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 3 + 2, product* 4 * 4 * 9 * 2 * 2 * 9 * 3 * 2, index + 23922944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 3 + 2, product* 4 * 2 * 2 * 4 * 2 * 9 * 3 * 2, index + 23924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 3 + 2, product* 6 * 3 * 7 * 4 * 2 * 9 * 3 * 2, index + 23924736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 9 + 3 + 2, product* 2 * 9 * 9 * 4 * 2 * 9 * 3 * 2, index + 23924992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 3 + 2, product* 2 * 7 * 2 * 6 * 2 * 9 * 3 * 2, index + 23926272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9 + 3 + 2, product* 6 * 9 * 2 * 7 * 2 * 9 * 3 * 2, index + 23927296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 9 + 3 + 2, product* 2 * 3 * 8 * 8 * 2 * 9 * 3 * 2, index + 23928832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 9 + 3 + 2, product* 4 * 4 * 3 * 9 * 2 * 9 * 3 * 2, index + 23929344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 3 + 2, product* 2 * 7 * 6 * 2 * 3 * 9 * 3 * 2, index + 23932672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 9 + 3 + 2, product* 4 * 6 * 4 * 4 * 3 * 9 * 3 * 2, index + 23934464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 9 + 3 + 2, product* 2 * 9 * 7 * 7 * 3 * 9 * 3 * 2, index + 23937792);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3 + 9 + 3 + 2, product* 8 * 6 * 9 * 9 * 3 * 9 * 3 * 2, index + 23939968);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9 + 3 + 2, product* 4 * 2 * 4 * 3 * 4 * 9 * 3 * 2, index + 23943424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 9 + 3 + 2, product* 8 * 4 * 4 * 4 * 4 * 9 * 3 * 2, index + 23944448);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 9 + 3 + 2, product* 8 * 8 * 2 * 8 * 4 * 9 * 3 * 2, index + 23948288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 9 + 3 + 2, product* 4 * 2 * 8 * 9 * 4 * 9 * 3 * 2, index + 23949824);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 3 + 2, product* 4 * 2 * 6 * 2 * 6 * 9 * 3 * 2, index + 23962624);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 9 + 3 + 2, product* 8 * 2 * 9 * 4 * 6 * 9 * 3 * 2, index + 23964928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 3 + 2, product* 2 * 3 * 2 * 7 * 6 * 9 * 3 * 2, index + 23967232);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 9 + 3 + 2, product* 6 * 3 * 7 * 2 * 7 * 9 * 3 * 2, index + 23972736);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9 + 3 + 2, product* 2 * 3 * 6 * 3 * 7 * 9 * 3 * 2, index + 23973632);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 9 + 3 + 2, product* 6 * 9 * 4 * 8 * 7 * 9 * 3 * 2, index + 23978496);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 9 + 3 + 2, product* 6 * 3 * 3 * 2 * 8 * 9 * 3 * 2, index + 23982336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 9 + 3 + 2, product* 4 * 2 * 2 * 8 * 8 * 9 * 3 * 2, index + 23988224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 9 + 3 + 2, product* 8 * 4 * 2 * 9 * 8 * 9 * 3 * 2, index + 23989248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9 + 3 + 2, product* 2 * 3 * 8 * 2 * 9 * 9 * 3 * 2, index + 23992832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 9 + 3 + 2, product* 4 * 2 * 6 * 4 * 9 * 9 * 3 * 2, index + 23994624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 4 + 2, product* 4 * 6 * 4 * 2 * 2 * 2 * 4 * 2, index + 24222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 4 + 2, product* 6 * 7 * 9 * 2 * 2 * 2 * 4 * 2, index + 24222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 4 + 2, product* 2 * 3 * 2 * 3 * 2 * 2 * 4 * 2, index + 24223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 4 + 2, product* 8 * 8 * 4 * 3 * 2 * 2 * 4 * 2, index + 24223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 4 + 2, product* 4 * 4 * 7 * 3 * 2 * 2 * 4 * 2, index + 24223744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 4 + 2, product* 8 * 6 * 7 * 4 * 2 * 2 * 4 * 2, index + 24224768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 4 + 2, product* 8 * 2 * 3 * 7 * 2 * 2 * 4 * 2, index + 24227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 4 + 2, product* 4 * 6 * 8 * 8 * 2 * 2 * 4 * 2, index + 24228864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 4 + 2, product* 6 * 7 * 3 * 9 * 2 * 2 * 4 * 2, index + 24229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 4 + 2, product* 2 * 3 * 6 * 9 * 2 * 2 * 4 * 2, index + 24229632);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 2 + 2 + 4 + 2, product* 8 * 8 * 8 * 9 * 2 * 2 * 4 * 2, index + 24229888);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 4 + 2, product* 8 * 4 * 4 * 2 * 3 * 2 * 4 * 2, index + 24232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 4 + 2, product* 2 * 7 * 4 * 3 * 3 * 2 * 4 * 2, index + 24233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 4 + 2, product* 8 * 2 * 7 * 3 * 3 * 2 * 4 * 2, index + 24233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 4 + 2, product* 4 * 8 * 9 * 3 * 3 * 2 * 4 * 2, index + 24233984);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 4 + 2, product* 4 * 2 * 8 * 7 * 3 * 2 * 4 * 2, index + 24237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 4 + 2, product* 6 * 3 * 3 * 8 * 3 * 2 * 4 * 2, index + 24238336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 4 + 2, product* 2 * 7 * 8 * 9 * 3 * 2 * 4 * 2, index + 24239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 4 + 2, product* 2 * 3 * 4 * 2 * 4 * 2 * 4 * 2, index + 24242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 4 + 2, product* 8 * 8 * 6 * 2 * 4 * 2 * 4 * 2, index + 24242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 4 + 2, product* 4 * 4 * 9 * 2 * 4 * 2 * 4 * 2, index + 24242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 4 + 2, product* 4 * 2 * 2 * 4 * 4 * 2 * 4 * 2, index + 24244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 4 + 2, product* 6 * 3 * 7 * 4 * 4 * 2 * 4 * 2, index + 24244736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 4 + 2, product* 2 * 7 * 2 * 6 * 4 * 2 * 4 * 2, index + 24246272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 4 + 2, product* 6 * 9 * 2 * 7 * 4 * 2 * 4 * 2, index + 24247296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 4 + 2, product* 2 * 3 * 8 * 8 * 4 * 2 * 4 * 2, index + 24248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 4 + 2, product* 4 * 4 * 3 * 9 * 4 * 2 * 4 * 2, index + 24249344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 4 + 2, product* 4 * 2 * 4 * 3 * 6 * 2 * 4 * 2, index + 24263424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 4 + 2, product* 8 * 4 * 4 * 4 * 6 * 2 * 4 * 2, index + 24264448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 4 + 2, product* 4 * 6 * 2 * 7 * 6 * 2 * 4 * 2, index + 24267264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 2 + 4 + 2, product* 8 * 8 * 2 * 8 * 6 * 2 * 4 * 2, index + 24268288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 4 + 2, product* 4 * 2 * 8 * 9 * 6 * 2 * 4 * 2, index + 24269824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 4 + 2, product* 4 * 8 * 3 * 2 * 7 * 2 * 4 * 2, index + 24272384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 4 + 2, product* 6 * 9 * 8 * 2 * 7 * 2 * 4 * 2, index + 24272896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 4 + 2, product* 2 * 3 * 4 * 4 * 7 * 2 * 4 * 2, index + 24274432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 4 + 2, product* 4 * 2 * 2 * 6 * 7 * 2 * 4 * 2, index + 24276224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 2 + 4 + 2, product* 6 * 3 * 7 * 6 * 7 * 2 * 4 * 2, index + 24276736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 4 + 2, product* 8 * 4 * 2 * 7 * 7 * 2 * 4 * 2, index + 24277248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 4 + 2, product* 2 * 7 * 2 * 8 * 7 * 2 * 4 * 2, index + 24278272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 2 + 4 + 2, product* 6 * 9 * 2 * 9 * 7 * 2 * 4 * 2, index + 24279296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 4 + 2, product* 8 * 6 * 3 * 2 * 8 * 2 * 4 * 2, index + 24282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 4 + 2, product* 4 * 2 * 6 * 2 * 8 * 2 * 4 * 2, index + 24282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 4 + 2, product* 2 * 9 * 3 * 3 * 8 * 2 * 4 * 2, index + 24283392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 4 + 2, product* 2 * 7 * 6 * 4 * 8 * 2 * 4 * 2, index + 24284672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 4 + 2, product* 4 * 6 * 4 * 6 * 8 * 2 * 4 * 2, index + 24286464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 4 + 2, product* 2 * 3 * 2 * 7 * 8 * 2 * 4 * 2, index + 24287232);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8 + 2 + 4 + 2, product* 8 * 6 * 7 * 8 * 8 * 2 * 4 * 2, index + 24288768);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 4 + 2, product* 4 * 6 * 8 * 2 * 9 * 2 * 4 * 2, index + 24292864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 4 + 2, product* 6 * 7 * 3 * 3 * 9 * 2 * 4 * 2, index + 24293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 4 + 2, product* 2 * 3 * 6 * 3 * 9 * 2 * 4 * 2, index + 24293632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9 + 2 + 4 + 2, product* 8 * 4 * 4 * 6 * 9 * 2 * 4 * 2, index + 24296448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 4 + 2, product* 2 * 7 * 4 * 7 * 9 * 2 * 4 * 2, index + 24297472);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 4 + 2, product* 8 * 2 * 3 * 3 * 2 * 3 * 4 * 2, index + 24323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 4 + 2, product* 4 * 2 * 4 * 7 * 2 * 3 * 4 * 2, index + 24327424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 4 + 2, product* 8 * 4 * 4 * 8 * 2 * 3 * 4 * 2, index + 24328448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 4 + 2, product* 2 * 7 * 4 * 9 * 2 * 3 * 4 * 2, index + 24329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 4 + 2, product* 8 * 2 * 7 * 9 * 2 * 3 * 4 * 2, index + 24329728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 4 + 2, product* 8 * 8 * 2 * 2 * 3 * 3 * 4 * 2, index + 24332288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 4 + 2, product* 4 * 2 * 8 * 3 * 3 * 3 * 4 * 2, index + 24333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 4 + 2, product* 6 * 3 * 3 * 4 * 3 * 3 * 4 * 2, index + 24334336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 4 + 2, product* 4 * 8 * 3 * 6 * 3 * 3 * 4 * 2, index + 24336384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 4 + 2, product* 2 * 3 * 4 * 8 * 3 * 3 * 4 * 2, index + 24338432);
-body<0>(stream, sum+ 8 + 6 + 9 + 9 + 3 + 3 + 4 + 2, product* 8 * 6 * 9 * 9 * 3 * 3 * 4 * 2, index + 24339968);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 4 + 2, product* 2 * 7 * 2 * 2 * 4 * 3 * 4 * 2, index + 24342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 4 + 2, product* 4 * 8 * 7 * 2 * 4 * 3 * 4 * 2, index + 24342784);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 4 + 2, product* 8 * 6 * 3 * 6 * 4 * 3 * 4 * 2, index + 24346368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 4 + 2, product* 4 * 2 * 6 * 6 * 4 * 3 * 4 * 2, index + 24346624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 4 + 2, product* 2 * 9 * 3 * 7 * 4 * 3 * 4 * 2, index + 24347392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 3 + 4 + 2, product* 8 * 4 * 6 * 7 * 4 * 3 * 4 * 2, index + 24347648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 3 + 4 + 2, product* 2 * 7 * 6 * 8 * 4 * 3 * 4 * 2, index + 24348672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 4 + 2, product* 8 * 2 * 9 * 8 * 4 * 3 * 4 * 2, index + 24348928);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 4 + 2, product* 4 * 6 * 2 * 3 * 6 * 3 * 4 * 2, index + 24363264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 4 + 2, product* 6 * 3 * 3 * 6 * 6 * 3 * 4 * 2, index + 24366336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6 + 3 + 4 + 2, product* 2 * 7 * 8 * 7 * 6 * 3 * 4 * 2, index + 24367872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3 + 4 + 2, product* 4 * 8 * 3 * 8 * 6 * 3 * 4 * 2, index + 24368384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6 + 3 + 4 + 2, product* 4 * 6 * 6 * 9 * 6 * 3 * 4 * 2, index + 24369664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 4 + 2, product* 4 * 2 * 2 * 2 * 7 * 3 * 4 * 2, index + 24372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 4 + 2, product* 6 * 3 * 7 * 2 * 7 * 3 * 4 * 2, index + 24372736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 4 + 2, product* 2 * 9 * 9 * 2 * 7 * 3 * 4 * 2, index + 24372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 4 + 2, product* 8 * 4 * 2 * 3 * 7 * 3 * 4 * 2, index + 24373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 4 + 2, product* 2 * 7 * 2 * 4 * 7 * 3 * 4 * 2, index + 24374272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3 + 4 + 2, product* 2 * 3 * 8 * 6 * 7 * 3 * 4 * 2, index + 24376832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 4 + 2, product* 4 * 4 * 3 * 7 * 7 * 3 * 4 * 2, index + 24377344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 3 + 4 + 2, product* 8 * 6 * 3 * 8 * 7 * 3 * 4 * 2, index + 24378368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 4 + 2, product* 2 * 9 * 3 * 9 * 7 * 3 * 4 * 2, index + 24379392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 4 + 2, product* 4 * 6 * 4 * 2 * 8 * 3 * 4 * 2, index + 24382464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 8 + 3 + 4 + 2, product* 6 * 7 * 9 * 2 * 8 * 3 * 4 * 2, index + 24382976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 4 + 2, product* 2 * 3 * 2 * 3 * 8 * 3 * 4 * 2, index + 24383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 4 + 2, product* 8 * 8 * 4 * 3 * 8 * 3 * 4 * 2, index + 24383488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 3 + 4 + 2, product* 4 * 4 * 7 * 3 * 8 * 3 * 4 * 2, index + 24383744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3 + 4 + 2, product* 2 * 3 * 6 * 9 * 8 * 3 * 4 * 2, index + 24389632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 4 + 2, product* 8 * 4 * 4 * 2 * 9 * 3 * 4 * 2, index + 24392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 4 + 2, product* 2 * 7 * 4 * 3 * 9 * 3 * 4 * 2, index + 24393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 4 + 2, product* 8 * 2 * 7 * 3 * 9 * 3 * 4 * 2, index + 24393728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 3 + 4 + 2, product* 6 * 9 * 4 * 4 * 9 * 3 * 4 * 2, index + 24394496);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 4 + 2, product* 4 * 2 * 8 * 7 * 9 * 3 * 4 * 2, index + 24397824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3 + 4 + 2, product* 6 * 3 * 3 * 8 * 9 * 3 * 4 * 2, index + 24398336);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 4 + 2, product* 4 * 2 * 4 * 3 * 2 * 4 * 4 * 2, index + 24423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 4 + 2, product* 6 * 3 * 9 * 3 * 2 * 4 * 4 * 2, index + 24423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 4 + 2, product* 8 * 4 * 4 * 4 * 2 * 4 * 4 * 2, index + 24424448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 4 + 2, product* 4 * 6 * 2 * 7 * 2 * 4 * 4 * 2, index + 24427264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 4 + 2, product* 8 * 8 * 2 * 8 * 2 * 4 * 4 * 2, index + 24428288);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 4 + 2, product* 6 * 9 * 8 * 2 * 3 * 4 * 4 * 2, index + 24432896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 4 + 2, product* 4 * 6 * 6 * 3 * 3 * 4 * 4 * 2, index + 24433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 4 + 2, product* 2 * 3 * 4 * 4 * 3 * 4 * 4 * 2, index + 24434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 4 + 2, product* 4 * 2 * 2 * 6 * 3 * 4 * 4 * 2, index + 24436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 4 + 2, product* 6 * 3 * 7 * 6 * 3 * 4 * 4 * 2, index + 24436736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 4 + 2, product* 8 * 4 * 2 * 7 * 3 * 4 * 4 * 2, index + 24437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 4 + 2, product* 2 * 7 * 2 * 8 * 3 * 4 * 4 * 2, index + 24438272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 4 + 4 + 2, product* 6 * 9 * 2 * 9 * 3 * 4 * 4 * 2, index + 24439296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 4 + 2, product* 8 * 6 * 3 * 2 * 4 * 4 * 4 * 2, index + 24442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 4 + 2, product* 4 * 2 * 6 * 2 * 4 * 4 * 4 * 2, index + 24442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 4 + 2, product* 2 * 9 * 3 * 3 * 4 * 4 * 4 * 2, index + 24443392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 4 + 2, product* 4 * 6 * 4 * 6 * 4 * 4 * 4 * 2, index + 24446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 4 + 2, product* 2 * 3 * 2 * 7 * 4 * 4 * 4 * 2, index + 24447232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 4 + 4 + 2, product* 8 * 8 * 4 * 7 * 4 * 4 * 4 * 2, index + 24447488);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 4 + 2, product* 6 * 3 * 3 * 2 * 6 * 4 * 4 * 2, index + 24462336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 4 + 2, product* 8 * 4 * 8 * 2 * 6 * 4 * 4 * 2, index + 24462848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 4 + 2, product* 2 * 7 * 8 * 3 * 6 * 4 * 4 * 2, index + 24463872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 4 + 2, product* 2 * 3 * 4 * 6 * 6 * 4 * 4 * 2, index + 24466432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 4 + 2, product* 4 * 2 * 2 * 8 * 6 * 4 * 4 * 2, index + 24468224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 4 + 4 + 2, product* 2 * 9 * 9 * 8 * 6 * 4 * 4 * 2, index + 24468992);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 4 + 2, product* 2 * 3 * 8 * 2 * 7 * 4 * 4 * 2, index + 24472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 4 + 2, product* 4 * 4 * 3 * 3 * 7 * 4 * 4 * 2, index + 24473344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 4 + 2, product* 4 * 2 * 6 * 4 * 7 * 4 * 4 * 2, index + 24474624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 4 + 2, product* 2 * 7 * 6 * 6 * 7 * 4 * 4 * 2, index + 24476672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 4 + 4 + 2, product* 8 * 2 * 9 * 6 * 7 * 4 * 4 * 2, index + 24476928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 4 + 2, product* 2 * 3 * 2 * 9 * 7 * 4 * 4 * 2, index + 24479232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 4 + 2, product* 8 * 2 * 3 * 3 * 8 * 4 * 4 * 2, index + 24483328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 4 + 2, product* 4 * 2 * 4 * 7 * 8 * 4 * 4 * 2, index + 24487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 4 + 2, product* 2 * 7 * 4 * 9 * 8 * 4 * 4 * 2, index + 24489472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4 + 4 + 2, product* 8 * 8 * 2 * 2 * 9 * 4 * 4 * 2, index + 24492288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 4 + 2, product* 4 * 2 * 8 * 3 * 9 * 4 * 4 * 2, index + 24493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 4 + 2, product* 6 * 3 * 3 * 4 * 9 * 4 * 4 * 2, index + 24494336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 4 + 4 + 2, product* 4 * 8 * 3 * 6 * 9 * 4 * 4 * 2, index + 24496384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 4 + 4 + 2, product* 4 * 6 * 6 * 7 * 9 * 4 * 4 * 2, index + 24497664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 4 + 4 + 2, product* 2 * 3 * 4 * 8 * 9 * 4 * 4 * 2, index + 24498432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 4 + 2, product* 6 * 3 * 3 * 2 * 2 * 6 * 4 * 2, index + 24622336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 4 + 2, product* 2 * 7 * 8 * 3 * 2 * 6 * 4 * 2, index + 24623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 4 + 2, product* 4 * 8 * 3 * 4 * 2 * 6 * 4 * 2, index + 24624384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 4 + 2, product* 2 * 3 * 4 * 6 * 2 * 6 * 4 * 2, index + 24626432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 4 + 2, product* 4 * 2 * 2 * 8 * 2 * 6 * 4 * 2, index + 24628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 4 + 2, product* 6 * 3 * 7 * 8 * 2 * 6 * 4 * 2, index + 24628736);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 4 + 2, product* 2 * 3 * 8 * 2 * 3 * 6 * 4 * 2, index + 24632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 4 + 2, product* 4 * 4 * 3 * 3 * 3 * 6 * 4 * 2, index + 24633344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 6 + 4 + 2, product* 8 * 6 * 3 * 4 * 3 * 6 * 4 * 2, index + 24634368);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 4 + 2, product* 2 * 7 * 6 * 6 * 3 * 6 * 4 * 2, index + 24636672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 6 + 4 + 2, product* 8 * 2 * 9 * 6 * 3 * 6 * 4 * 2, index + 24636928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 4 + 2, product* 2 * 3 * 2 * 9 * 3 * 6 * 4 * 2, index + 24639232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 6 + 4 + 2, product* 8 * 8 * 4 * 9 * 3 * 6 * 4 * 2, index + 24639488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 4 + 2, product* 8 * 2 * 3 * 3 * 4 * 6 * 4 * 2, index + 24643328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 6 + 4 + 2, product* 4 * 6 * 8 * 4 * 4 * 6 * 4 * 2, index + 24644864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 4 + 2, product* 4 * 2 * 4 * 7 * 4 * 6 * 4 * 2, index + 24647424);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 6 + 4 + 2, product* 8 * 2 * 7 * 9 * 4 * 6 * 4 * 2, index + 24649728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 4 + 2, product* 2 * 7 * 2 * 2 * 6 * 6 * 4 * 2, index + 24662272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 4 + 2, product* 6 * 9 * 2 * 3 * 6 * 6 * 4 * 2, index + 24663296);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 6 + 4 + 2, product* 8 * 6 * 3 * 6 * 6 * 6 * 4 * 2, index + 24666368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 4 + 2, product* 4 * 2 * 6 * 6 * 6 * 6 * 4 * 2, index + 24666624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 4 + 2, product* 2 * 9 * 3 * 7 * 6 * 6 * 4 * 2, index + 24667392);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 4 + 2, product* 2 * 3 * 6 * 7 * 7 * 6 * 4 * 2, index + 24677632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 4 + 2, product* 4 * 2 * 4 * 9 * 7 * 6 * 4 * 2, index + 24679424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6 + 4 + 2, product* 6 * 9 * 4 * 2 * 8 * 6 * 4 * 2, index + 24682496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 4 + 2, product* 4 * 6 * 2 * 3 * 8 * 6 * 4 * 2, index + 24683264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 6 + 4 + 2, product* 6 * 3 * 3 * 6 * 8 * 6 * 4 * 2, index + 24686336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 6 + 4 + 2, product* 4 * 8 * 3 * 8 * 8 * 6 * 4 * 2, index + 24688384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 4 + 2, product* 4 * 2 * 2 * 2 * 9 * 6 * 4 * 2, index + 24692224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 4 + 2, product* 8 * 4 * 2 * 3 * 9 * 6 * 4 * 2, index + 24693248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 4 + 2, product* 2 * 7 * 2 * 4 * 9 * 6 * 4 * 2, index + 24694272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 4 + 2, product* 2 * 3 * 4 * 2 * 2 * 7 * 4 * 2, index + 24722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 4 + 2, product* 4 * 4 * 9 * 2 * 2 * 7 * 4 * 2, index + 24722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 4 + 2, product* 4 * 2 * 2 * 4 * 2 * 7 * 4 * 2, index + 24724224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 4 + 2, product* 2 * 7 * 2 * 6 * 2 * 7 * 4 * 2, index + 24726272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7 + 4 + 2, product* 4 * 8 * 7 * 6 * 2 * 7 * 4 * 2, index + 24726784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 4 + 2, product* 6 * 9 * 2 * 7 * 2 * 7 * 4 * 2, index + 24727296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 4 + 2, product* 2 * 3 * 8 * 8 * 2 * 7 * 4 * 2, index + 24728832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 4 + 2, product* 4 * 4 * 3 * 9 * 2 * 7 * 4 * 2, index + 24729344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 4 + 2, product* 2 * 7 * 6 * 2 * 3 * 7 * 4 * 2, index + 24732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 4 + 2, product* 8 * 2 * 9 * 2 * 3 * 7 * 4 * 2, index + 24732928);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 4 + 2, product* 8 * 2 * 3 * 9 * 3 * 7 * 4 * 2, index + 24739328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 4 + 2, product* 4 * 2 * 4 * 3 * 4 * 7 * 4 * 2, index + 24743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 4 + 2, product* 6 * 3 * 9 * 3 * 4 * 7 * 4 * 2, index + 24743936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 7 + 4 + 2, product* 6 * 9 * 4 * 6 * 4 * 7 * 4 * 2, index + 24746496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 4 + 2, product* 4 * 6 * 2 * 7 * 4 * 7 * 4 * 2, index + 24747264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 4 + 7 + 4 + 2, product* 6 * 7 * 7 * 7 * 4 * 7 * 4 * 2, index + 24747776);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 4 + 2, product* 4 * 2 * 6 * 2 * 6 * 7 * 4 * 2, index + 24762624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 4 + 2, product* 2 * 9 * 3 * 3 * 6 * 7 * 4 * 2, index + 24763392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 7 + 4 + 2, product* 8 * 2 * 9 * 4 * 6 * 7 * 4 * 2, index + 24764928);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 7 + 4 + 2, product* 4 * 6 * 8 * 2 * 7 * 7 * 4 * 2, index + 24772864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 4 + 2, product* 2 * 3 * 6 * 3 * 7 * 7 * 4 * 2, index + 24773632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7 + 4 + 2, product* 8 * 4 * 4 * 6 * 7 * 7 * 4 * 2, index + 24776448);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 4 + 2, product* 6 * 3 * 3 * 2 * 8 * 7 * 4 * 2, index + 24782336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 7 + 4 + 2, product* 2 * 7 * 8 * 3 * 8 * 7 * 4 * 2, index + 24783872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 4 + 2, product* 2 * 3 * 4 * 6 * 8 * 7 * 4 * 2, index + 24786432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 7 + 4 + 2, product* 4 * 2 * 6 * 4 * 9 * 7 * 4 * 2, index + 24794624);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 4 + 2, product* 2 * 7 * 2 * 2 * 2 * 8 * 4 * 2, index + 24822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 4 + 2, product* 4 * 8 * 7 * 2 * 2 * 8 * 4 * 2, index + 24822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 4 + 2, product* 6 * 9 * 2 * 3 * 2 * 8 * 4 * 2, index + 24823296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 4 + 2, product* 2 * 3 * 8 * 4 * 2 * 8 * 4 * 2, index + 24824832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 8 + 4 + 2, product* 8 * 6 * 3 * 6 * 2 * 8 * 4 * 2, index + 24826368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 8 + 4 + 2, product* 4 * 2 * 6 * 6 * 2 * 8 * 4 * 2, index + 24826624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 4 + 2, product* 2 * 9 * 3 * 7 * 2 * 8 * 4 * 2, index + 24827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 4 + 2, product* 8 * 4 * 6 * 7 * 2 * 8 * 4 * 2, index + 24827648);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 4 + 2, product* 2 * 3 * 6 * 7 * 3 * 8 * 4 * 2, index + 24837632);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 8 + 4 + 2, product* 6 * 9 * 4 * 2 * 4 * 8 * 4 * 2, index + 24842496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 4 + 2, product* 4 * 6 * 2 * 3 * 4 * 8 * 4 * 2, index + 24843264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 4 + 2, product* 8 * 8 * 2 * 4 * 4 * 8 * 4 * 2, index + 24844288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 4 + 2, product* 6 * 3 * 3 * 6 * 4 * 8 * 4 * 2, index + 24846336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 8 + 4 + 2, product* 4 * 8 * 3 * 8 * 4 * 8 * 4 * 2, index + 24848384);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 4 + 2, product* 4 * 6 * 4 * 2 * 6 * 8 * 4 * 2, index + 24862464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 4 + 2, product* 2 * 3 * 2 * 3 * 6 * 8 * 4 * 2, index + 24863232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8 + 4 + 2, product* 4 * 4 * 7 * 3 * 6 * 8 * 4 * 2, index + 24863744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 4 + 2, product* 2 * 3 * 6 * 9 * 6 * 8 * 4 * 2, index + 24869632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 8 + 4 + 2, product* 2 * 7 * 4 * 3 * 7 * 8 * 4 * 2, index + 24873472);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 4 + 2, product* 4 * 2 * 2 * 4 * 8 * 8 * 4 * 2, index + 24884224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 8 + 4 + 2, product* 2 * 9 * 9 * 4 * 8 * 8 * 4 * 2, index + 24884992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 8 + 4 + 2, product* 2 * 7 * 2 * 6 * 8 * 8 * 4 * 2, index + 24886272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 8 + 4 + 2, product* 6 * 9 * 2 * 7 * 8 * 8 * 4 * 2, index + 24887296);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 8 + 4 + 2, product* 2 * 7 * 6 * 2 * 9 * 8 * 4 * 2, index + 24892672);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 8 + 4 + 2, product* 6 * 7 * 9 * 4 * 9 * 8 * 4 * 2, index + 24894976);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 4 + 2, product* 8 * 6 * 3 * 2 * 2 * 9 * 4 * 2, index + 24922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 4 + 2, product* 4 * 2 * 6 * 2 * 2 * 9 * 4 * 2, index + 24922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 4 + 2, product* 2 * 9 * 3 * 3 * 2 * 9 * 4 * 2, index + 24923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9 + 4 + 2, product* 8 * 4 * 6 * 3 * 2 * 9 * 4 * 2, index + 24923648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 4 + 2, product* 2 * 7 * 6 * 4 * 2 * 9 * 4 * 2, index + 24924672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 9 + 4 + 2, product* 4 * 6 * 4 * 6 * 2 * 9 * 4 * 2, index + 24926464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 4 + 2, product* 2 * 3 * 2 * 7 * 2 * 9 * 4 * 2, index + 24927232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 9 + 4 + 2, product* 8 * 8 * 4 * 7 * 2 * 9 * 4 * 2, index + 24927488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 9 + 4 + 2, product* 4 * 4 * 7 * 7 * 2 * 9 * 4 * 2, index + 24927744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 9 + 4 + 2, product* 8 * 6 * 7 * 8 * 2 * 9 * 4 * 2, index + 24928768);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 9 + 4 + 2, product* 6 * 7 * 3 * 3 * 3 * 9 * 4 * 2, index + 24933376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 4 + 2, product* 2 * 3 * 6 * 3 * 3 * 9 * 4 * 2, index + 24933632);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 9 + 4 + 2, product* 4 * 6 * 2 * 9 * 3 * 9 * 4 * 2, index + 24939264);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 9 + 4 + 2, product* 4 * 4 * 9 * 6 * 4 * 9 * 4 * 2, index + 24946944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 4 + 2, product* 4 * 2 * 2 * 8 * 4 * 9 * 4 * 2, index + 24948224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 9 + 4 + 2, product* 8 * 4 * 2 * 9 * 4 * 9 * 4 * 2, index + 24949248);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9 + 4 + 2, product* 8 * 2 * 3 * 3 * 6 * 9 * 4 * 2, index + 24963328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 9 + 4 + 2, product* 4 * 2 * 4 * 7 * 6 * 9 * 4 * 2, index + 24967424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 9 + 4 + 2, product* 4 * 2 * 8 * 3 * 7 * 9 * 4 * 2, index + 24973824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 4 + 2, product* 2 * 3 * 4 * 8 * 7 * 9 * 4 * 2, index + 24978432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 4 + 2, product* 2 * 7 * 2 * 2 * 8 * 9 * 4 * 2, index + 24982272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 9 + 4 + 2, product* 6 * 9 * 2 * 3 * 8 * 9 * 4 * 2, index + 24983296);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9 + 9 + 4 + 2, product* 6 * 7 * 3 * 7 * 9 * 9 * 4 * 2, index + 24997376);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 6 + 2, product* 6 * 3 * 3 * 2 * 2 * 2 * 6 * 2, index + 26222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 6 + 2, product* 8 * 4 * 8 * 2 * 2 * 2 * 6 * 2, index + 26222848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 6 + 2, product* 2 * 3 * 2 * 3 * 2 * 2 * 6 * 2, index + 26223232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 6 + 2, product* 2 * 7 * 8 * 3 * 2 * 2 * 6 * 2, index + 26223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 6 + 2, product* 4 * 8 * 3 * 4 * 2 * 2 * 6 * 2, index + 26224384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 6 + 2, product* 6 * 9 * 8 * 4 * 2 * 2 * 6 * 2, index + 26224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 6 + 2, product* 2 * 3 * 4 * 6 * 2 * 2 * 6 * 2, index + 26226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 6 + 2, product* 4 * 4 * 9 * 6 * 2 * 2 * 6 * 2, index + 26226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 6 + 2, product* 4 * 2 * 2 * 8 * 2 * 2 * 6 * 2, index + 26228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 6 + 2, product* 6 * 3 * 7 * 8 * 2 * 2 * 6 * 2, index + 26228736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 6 + 2, product* 2 * 9 * 9 * 8 * 2 * 2 * 6 * 2, index + 26228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 6 + 2, product* 8 * 4 * 2 * 9 * 2 * 2 * 6 * 2, index + 26229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 6 + 2, product* 2 * 3 * 8 * 2 * 3 * 2 * 6 * 2, index + 26232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 6 + 2, product* 4 * 4 * 3 * 3 * 3 * 2 * 6 * 2, index + 26233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 6 + 2, product* 8 * 6 * 3 * 4 * 3 * 2 * 6 * 2, index + 26234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 6 + 2, product* 4 * 2 * 6 * 4 * 3 * 2 * 6 * 2, index + 26234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 6 + 2, product* 2 * 7 * 6 * 6 * 3 * 2 * 6 * 2, index + 26236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 6 + 2, product* 8 * 2 * 9 * 6 * 3 * 2 * 6 * 2, index + 26236928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 6 + 2, product* 4 * 6 * 4 * 8 * 3 * 2 * 6 * 2, index + 26238464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 6 + 2, product* 2 * 3 * 2 * 9 * 3 * 2 * 6 * 2, index + 26239232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2 + 6 + 2, product* 4 * 4 * 7 * 9 * 3 * 2 * 6 * 2, index + 26239744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 6 + 2, product* 8 * 2 * 3 * 3 * 4 * 2 * 6 * 2, index + 26243328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 6 + 2, product* 4 * 2 * 4 * 7 * 4 * 2 * 6 * 2, index + 26247424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 2 + 6 + 2, product* 8 * 4 * 4 * 8 * 4 * 2 * 6 * 2, index + 26248448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 6 + 2, product* 2 * 7 * 4 * 9 * 4 * 2 * 6 * 2, index + 26249472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 6 + 2, product* 8 * 2 * 7 * 9 * 4 * 2 * 6 * 2, index + 26249728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 6 + 2, product* 2 * 7 * 2 * 2 * 6 * 2 * 6 * 2, index + 26262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 6 + 2, product* 4 * 8 * 7 * 2 * 6 * 2 * 6 * 2, index + 26262784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 6 + 2, product* 6 * 9 * 2 * 3 * 6 * 2 * 6 * 2, index + 26263296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 6 + 2, product* 2 * 3 * 8 * 4 * 6 * 2 * 6 * 2, index + 26264832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 6 + 2, product* 4 * 2 * 6 * 6 * 6 * 2 * 6 * 2, index + 26266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 6 + 2, product* 2 * 9 * 3 * 7 * 6 * 2 * 6 * 2, index + 26267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 6 + 2, product* 8 * 4 * 6 * 7 * 6 * 2 * 6 * 2, index + 26267648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 6 + 2, product* 2 * 7 * 6 * 8 * 6 * 2 * 6 * 2, index + 26268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 6 + 2, product* 8 * 2 * 9 * 8 * 6 * 2 * 6 * 2, index + 26268928);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 6 + 2, product* 8 * 6 * 7 * 2 * 7 * 2 * 6 * 2, index + 26272768);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 2 + 6 + 2, product* 6 * 7 * 3 * 7 * 7 * 2 * 6 * 2, index + 26277376);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2 + 6 + 2, product* 6 * 9 * 4 * 2 * 8 * 2 * 6 * 2, index + 26282496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 6 + 2, product* 4 * 6 * 2 * 3 * 8 * 2 * 6 * 2, index + 26283264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 6 + 2, product* 8 * 8 * 2 * 4 * 8 * 2 * 6 * 2, index + 26284288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 6 + 2, product* 6 * 3 * 3 * 6 * 8 * 2 * 6 * 2, index + 26286336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2 + 6 + 2, product* 4 * 8 * 3 * 8 * 8 * 2 * 6 * 2, index + 26288384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 6 + 2, product* 4 * 2 * 2 * 2 * 9 * 2 * 6 * 2, index + 26292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 6 + 2, product* 6 * 3 * 7 * 2 * 9 * 2 * 6 * 2, index + 26292736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 6 + 2, product* 8 * 4 * 2 * 3 * 9 * 2 * 6 * 2, index + 26293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 6 + 2, product* 2 * 7 * 2 * 4 * 9 * 2 * 6 * 2, index + 26294272);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2 + 6 + 2, product* 8 * 6 * 3 * 8 * 9 * 2 * 6 * 2, index + 26298368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 6 + 2, product* 2 * 9 * 3 * 9 * 9 * 2 * 6 * 2, index + 26299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 6 + 2, product* 2 * 3 * 4 * 2 * 2 * 3 * 6 * 2, index + 26322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 6 + 2, product* 4 * 4 * 9 * 2 * 2 * 3 * 6 * 2, index + 26322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 6 + 2, product* 4 * 2 * 2 * 4 * 2 * 3 * 6 * 2, index + 26324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 6 + 2, product* 6 * 3 * 7 * 4 * 2 * 3 * 6 * 2, index + 26324736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 6 + 2, product* 2 * 9 * 9 * 4 * 2 * 3 * 6 * 2, index + 26324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 6 + 2, product* 2 * 7 * 2 * 6 * 2 * 3 * 6 * 2, index + 26326272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 6 + 2, product* 6 * 9 * 2 * 7 * 2 * 3 * 6 * 2, index + 26327296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 6 + 2, product* 2 * 3 * 8 * 8 * 2 * 3 * 6 * 2, index + 26328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 6 + 2, product* 4 * 4 * 3 * 9 * 2 * 3 * 6 * 2, index + 26329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 6 + 2, product* 2 * 7 * 6 * 2 * 3 * 3 * 6 * 2, index + 26332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 6 + 2, product* 8 * 2 * 9 * 2 * 3 * 3 * 6 * 2, index + 26332928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 6 + 2, product* 4 * 6 * 4 * 4 * 3 * 3 * 6 * 2, index + 26334464);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 6 + 2, product* 8 * 2 * 3 * 9 * 3 * 3 * 6 * 2, index + 26339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 6 + 2, product* 4 * 2 * 4 * 3 * 4 * 3 * 6 * 2, index + 26343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 6 + 2, product* 6 * 3 * 9 * 3 * 4 * 3 * 6 * 2, index + 26343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 6 + 2, product* 8 * 4 * 4 * 4 * 4 * 3 * 6 * 2, index + 26344448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3 + 6 + 2, product* 6 * 9 * 4 * 6 * 4 * 3 * 6 * 2, index + 26346496);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 3 + 6 + 2, product* 8 * 8 * 2 * 8 * 4 * 3 * 6 * 2, index + 26348288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3 + 6 + 2, product* 4 * 2 * 8 * 9 * 4 * 3 * 6 * 2, index + 26349824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3 + 6 + 2, product* 8 * 6 * 3 * 2 * 6 * 3 * 6 * 2, index + 26362368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 6 + 2, product* 4 * 2 * 6 * 2 * 6 * 3 * 6 * 2, index + 26362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 6 + 2, product* 2 * 9 * 3 * 3 * 6 * 3 * 6 * 2, index + 26363392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 6 + 2, product* 2 * 7 * 6 * 4 * 6 * 3 * 6 * 2, index + 26364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 6 + 2, product* 8 * 2 * 9 * 4 * 6 * 3 * 6 * 2, index + 26364928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 6 + 2, product* 2 * 3 * 2 * 7 * 6 * 3 * 6 * 2, index + 26367232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3 + 6 + 2, product* 8 * 8 * 4 * 7 * 6 * 3 * 6 * 2, index + 26367488);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 6 + 3 + 6 + 2, product* 2 * 9 * 7 * 9 * 6 * 3 * 6 * 2, index + 26369792);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 6 + 2, product* 6 * 3 * 7 * 2 * 7 * 3 * 6 * 2, index + 26372736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 6 + 2, product* 2 * 9 * 9 * 2 * 7 * 3 * 6 * 2, index + 26372992);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 6 + 2, product* 2 * 3 * 6 * 3 * 7 * 3 * 6 * 2, index + 26373632);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 6 + 2, product* 8 * 2 * 7 * 7 * 7 * 3 * 6 * 2, index + 26377728);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 6 + 2, product* 6 * 3 * 3 * 2 * 8 * 3 * 6 * 2, index + 26382336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3 + 6 + 2, product* 8 * 4 * 8 * 2 * 8 * 3 * 6 * 2, index + 26382848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 6 + 2, product* 2 * 7 * 8 * 3 * 8 * 3 * 6 * 2, index + 26383872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 6 + 2, product* 4 * 8 * 3 * 4 * 8 * 3 * 6 * 2, index + 26384384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 6 + 2, product* 2 * 3 * 4 * 6 * 8 * 3 * 6 * 2, index + 26386432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3 + 6 + 2, product* 4 * 4 * 9 * 6 * 8 * 3 * 6 * 2, index + 26386944);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 3 + 6 + 2, product* 8 * 4 * 2 * 9 * 8 * 3 * 6 * 2, index + 26389248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 6 + 2, product* 2 * 3 * 8 * 2 * 9 * 3 * 6 * 2, index + 26392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 6 + 2, product* 4 * 4 * 3 * 3 * 9 * 3 * 6 * 2, index + 26393344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9 + 3 + 6 + 2, product* 8 * 6 * 3 * 4 * 9 * 3 * 6 * 2, index + 26394368);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 6 + 2, product* 2 * 3 * 2 * 9 * 9 * 3 * 6 * 2, index + 26399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 6 + 2, product* 2 * 7 * 2 * 2 * 2 * 4 * 6 * 2, index + 26422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 6 + 2, product* 4 * 8 * 7 * 2 * 2 * 4 * 6 * 2, index + 26422784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 6 + 2, product* 2 * 3 * 8 * 4 * 2 * 4 * 6 * 2, index + 26424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 6 + 2, product* 8 * 6 * 3 * 6 * 2 * 4 * 6 * 2, index + 26426368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 6 + 2, product* 4 * 2 * 6 * 6 * 2 * 4 * 6 * 2, index + 26426624);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 6 + 2, product* 8 * 4 * 6 * 7 * 2 * 4 * 6 * 2, index + 26427648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 6 + 2, product* 2 * 7 * 6 * 8 * 2 * 4 * 6 * 2, index + 26428672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 4 + 6 + 2, product* 8 * 2 * 9 * 8 * 2 * 4 * 6 * 2, index + 26428928);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 6 + 2, product* 2 * 9 * 7 * 3 * 3 * 4 * 6 * 2, index + 26433792);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 6 + 2, product* 2 * 3 * 6 * 7 * 3 * 4 * 6 * 2, index + 26437632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 6 + 2, product* 4 * 2 * 4 * 9 * 3 * 4 * 6 * 2, index + 26439424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 4 + 6 + 2, product* 6 * 9 * 4 * 2 * 4 * 4 * 6 * 2, index + 26442496);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 6 + 2, product* 6 * 7 * 7 * 3 * 4 * 4 * 6 * 2, index + 26443776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 6 + 2, product* 8 * 8 * 2 * 4 * 4 * 4 * 6 * 2, index + 26444288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 6 + 2, product* 6 * 3 * 3 * 6 * 4 * 4 * 6 * 2, index + 26446336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 4 + 6 + 2, product* 4 * 8 * 3 * 8 * 4 * 4 * 6 * 2, index + 26448384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 6 + 2, product* 4 * 6 * 6 * 9 * 4 * 4 * 6 * 2, index + 26449664);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 6 + 2, product* 2 * 3 * 2 * 3 * 6 * 4 * 6 * 2, index + 26463232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 6 + 2, product* 8 * 4 * 4 * 2 * 7 * 4 * 6 * 2, index + 26472448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 6 + 2, product* 2 * 7 * 4 * 3 * 7 * 4 * 6 * 2, index + 26473472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 6 + 2, product* 8 * 2 * 7 * 3 * 7 * 4 * 6 * 2, index + 26473728);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 6 + 2, product* 6 * 3 * 3 * 8 * 7 * 4 * 6 * 2, index + 26478336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 6 + 2, product* 2 * 3 * 4 * 2 * 8 * 4 * 6 * 2, index + 26482432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 4 + 6 + 2, product* 8 * 8 * 6 * 2 * 8 * 4 * 6 * 2, index + 26482688);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 6 + 2, product* 4 * 2 * 2 * 4 * 8 * 4 * 6 * 2, index + 26484224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 4 + 6 + 2, product* 6 * 3 * 7 * 4 * 8 * 4 * 6 * 2, index + 26484736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 6 + 2, product* 2 * 7 * 2 * 6 * 8 * 4 * 6 * 2, index + 26486272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 4 + 6 + 2, product* 2 * 3 * 8 * 8 * 8 * 4 * 6 * 2, index + 26488832);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 6 + 2, product* 4 * 6 * 4 * 2 * 2 * 6 * 6 * 2, index + 26622464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 6 + 2, product* 6 * 7 * 9 * 2 * 2 * 6 * 6 * 2, index + 26622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 6 + 2, product* 2 * 3 * 2 * 3 * 2 * 6 * 6 * 2, index + 26623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 6 + 2, product* 4 * 4 * 7 * 3 * 2 * 6 * 6 * 2, index + 26623744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 6 + 2, product* 2 * 3 * 6 * 9 * 2 * 6 * 6 * 2, index + 26629632);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 6 + 2, product* 4 * 2 * 8 * 7 * 3 * 6 * 6 * 2, index + 26637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 6 + 2, product* 6 * 3 * 3 * 8 * 3 * 6 * 6 * 2, index + 26638336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 6 + 2, product* 2 * 3 * 4 * 2 * 4 * 6 * 6 * 2, index + 26642432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 6 + 2, product* 4 * 4 * 9 * 2 * 4 * 6 * 6 * 2, index + 26642944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 6 + 2, product* 4 * 2 * 2 * 4 * 4 * 6 * 6 * 2, index + 26644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 6 + 2, product* 2 * 7 * 2 * 6 * 4 * 6 * 6 * 2, index + 26646272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 6 + 2, product* 2 * 3 * 8 * 8 * 4 * 6 * 6 * 2, index + 26648832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 6 + 2, product* 4 * 2 * 4 * 3 * 6 * 6 * 6 * 2, index + 26663424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 6 + 6 + 2, product* 4 * 6 * 2 * 7 * 6 * 6 * 6 * 2, index + 26667264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 6 + 2, product* 4 * 8 * 3 * 2 * 7 * 6 * 6 * 2, index + 26672384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 6 + 2, product* 2 * 3 * 4 * 4 * 7 * 6 * 6 * 2, index + 26674432);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 6 + 2, product* 2 * 7 * 2 * 8 * 7 * 6 * 6 * 2, index + 26678272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 6 + 6 + 2, product* 4 * 8 * 7 * 8 * 7 * 6 * 6 * 2, index + 26678784);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6 + 6 + 2, product* 6 * 7 * 3 * 3 * 9 * 6 * 6 * 2, index + 26693376);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 9 + 6 + 6 + 2, product* 8 * 4 * 4 * 6 * 9 * 6 * 6 * 2, index + 26696448);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 6 + 2, product* 8 * 2 * 3 * 3 * 2 * 7 * 6 * 2, index + 26723328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 6 + 2, product* 4 * 2 * 4 * 7 * 2 * 7 * 6 * 2, index + 26727424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 6 + 2, product* 8 * 4 * 4 * 8 * 2 * 7 * 6 * 2, index + 26728448);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 6 + 2, product* 8 * 2 * 7 * 9 * 2 * 7 * 6 * 2, index + 26729728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7 + 6 + 2, product* 8 * 8 * 2 * 2 * 3 * 7 * 6 * 2, index + 26732288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 6 + 2, product* 4 * 2 * 8 * 3 * 3 * 7 * 6 * 2, index + 26733824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 6 + 2, product* 4 * 8 * 3 * 6 * 3 * 7 * 6 * 2, index + 26736384);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 7 + 6 + 2, product* 6 * 9 * 8 * 6 * 3 * 7 * 6 * 2, index + 26736896);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 7 + 6 + 2, product* 8 * 8 * 6 * 8 * 3 * 7 * 6 * 2, index + 26738688);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 6 + 2, product* 2 * 7 * 2 * 2 * 4 * 7 * 6 * 2, index + 26742272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7 + 6 + 2, product* 4 * 8 * 7 * 2 * 4 * 7 * 6 * 2, index + 26742784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7 + 6 + 2, product* 6 * 9 * 2 * 3 * 4 * 7 * 6 * 2, index + 26743296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 6 + 2, product* 2 * 3 * 8 * 4 * 4 * 7 * 6 * 2, index + 26744832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 6 + 2, product* 4 * 2 * 6 * 6 * 4 * 7 * 6 * 2, index + 26746624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 6 + 2, product* 2 * 9 * 3 * 7 * 4 * 7 * 6 * 2, index + 26747392);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 6 + 2, product* 4 * 6 * 2 * 3 * 6 * 7 * 6 * 2, index + 26763264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 7 + 6 + 2, product* 6 * 7 * 7 * 3 * 6 * 7 * 6 * 2, index + 26763776);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 6 + 2, product* 6 * 3 * 3 * 6 * 6 * 7 * 6 * 2, index + 26766336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 6 + 2, product* 4 * 2 * 2 * 2 * 7 * 7 * 6 * 2, index + 26772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 6 + 2, product* 6 * 3 * 7 * 2 * 7 * 7 * 6 * 2, index + 26772736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 7 + 6 + 2, product* 2 * 9 * 9 * 2 * 7 * 7 * 6 * 2, index + 26772992);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 6 + 2, product* 2 * 3 * 8 * 6 * 7 * 7 * 6 * 2, index + 26776832);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 7 + 6 + 2, product* 4 * 2 * 6 * 8 * 7 * 7 * 6 * 2, index + 26778624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 6 + 2, product* 2 * 3 * 2 * 3 * 8 * 7 * 6 * 2, index + 26783232);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 7 + 6 + 2, product* 4 * 6 * 8 * 8 * 8 * 7 * 6 * 2, index + 26788864);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 6 + 2, product* 2 * 7 * 4 * 3 * 9 * 7 * 6 * 2, index + 26793472);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 6 + 2, product* 2 * 3 * 2 * 9 * 9 * 7 * 6 * 2, index + 26799232);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 6 + 2, product* 4 * 2 * 4 * 3 * 2 * 8 * 6 * 2, index + 26823424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 6 + 2, product* 4 * 6 * 2 * 7 * 2 * 8 * 6 * 2, index + 26827264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 6 + 2, product* 4 * 8 * 3 * 2 * 3 * 8 * 6 * 2, index + 26832384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 8 + 6 + 2, product* 6 * 9 * 8 * 2 * 3 * 8 * 6 * 2, index + 26832896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8 + 6 + 2, product* 4 * 6 * 6 * 3 * 3 * 8 * 6 * 2, index + 26833664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 6 + 2, product* 2 * 3 * 4 * 4 * 3 * 8 * 6 * 2, index + 26834432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 6 + 2, product* 4 * 2 * 2 * 6 * 3 * 8 * 6 * 2, index + 26836224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 6 + 2, product* 2 * 7 * 2 * 8 * 3 * 8 * 6 * 2, index + 26838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 6 + 2, product* 6 * 9 * 2 * 9 * 3 * 8 * 6 * 2, index + 26839296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 6 + 2, product* 4 * 2 * 6 * 2 * 4 * 8 * 6 * 2, index + 26842624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 6 + 2, product* 2 * 9 * 3 * 3 * 4 * 8 * 6 * 2, index + 26843392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 6 + 2, product* 2 * 3 * 2 * 7 * 4 * 8 * 6 * 2, index + 26847232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8 + 6 + 2, product* 4 * 4 * 7 * 7 * 4 * 8 * 6 * 2, index + 26847744);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 6 + 2, product* 6 * 3 * 3 * 2 * 6 * 8 * 6 * 2, index + 26862336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 6 + 2, product* 2 * 7 * 8 * 3 * 6 * 8 * 6 * 2, index + 26863872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 6 + 2, product* 4 * 2 * 2 * 8 * 6 * 8 * 6 * 2, index + 26868224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 6 + 2, product* 2 * 3 * 8 * 2 * 7 * 8 * 6 * 2, index + 26872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 6 + 2, product* 4 * 4 * 3 * 3 * 7 * 8 * 6 * 2, index + 26873344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 6 + 2, product* 4 * 2 * 6 * 4 * 7 * 8 * 6 * 2, index + 26874624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 8 + 6 + 2, product* 2 * 7 * 6 * 6 * 7 * 8 * 6 * 2, index + 26876672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 8 + 6 + 2, product* 8 * 2 * 9 * 6 * 7 * 8 * 6 * 2, index + 26876928);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 6 + 2, product* 8 * 2 * 3 * 3 * 8 * 8 * 6 * 2, index + 26883328);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 6 + 2, product* 6 * 9 * 4 * 2 * 2 * 9 * 6 * 2, index + 26922496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 6 + 2, product* 4 * 6 * 2 * 3 * 2 * 9 * 6 * 2, index + 26923264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9 + 6 + 2, product* 8 * 8 * 2 * 4 * 2 * 9 * 6 * 2, index + 26924288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 6 + 2, product* 6 * 3 * 3 * 6 * 2 * 9 * 6 * 2, index + 26926336);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 9 + 6 + 2, product* 4 * 6 * 6 * 9 * 2 * 9 * 6 * 2, index + 26929664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 6 + 2, product* 4 * 2 * 2 * 2 * 3 * 9 * 6 * 2, index + 26932224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 6 + 2, product* 8 * 4 * 2 * 3 * 3 * 9 * 6 * 2, index + 26933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 6 + 2, product* 2 * 7 * 2 * 4 * 3 * 9 * 6 * 2, index + 26934272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 6 + 2, product* 2 * 3 * 8 * 6 * 3 * 9 * 6 * 2, index + 26936832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9 + 6 + 2, product* 4 * 4 * 3 * 7 * 3 * 9 * 6 * 2, index + 26937344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 9 + 6 + 2, product* 8 * 6 * 3 * 8 * 3 * 9 * 6 * 2, index + 26938368);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 9 + 6 + 2, product* 4 * 2 * 6 * 8 * 3 * 9 * 6 * 2, index + 26938624);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 9 + 6 + 2, product* 8 * 4 * 6 * 9 * 3 * 9 * 6 * 2, index + 26939648);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 6 + 2, product* 4 * 6 * 4 * 2 * 4 * 9 * 6 * 2, index + 26942464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 6 + 2, product* 2 * 3 * 2 * 3 * 4 * 9 * 6 * 2, index + 26943232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 6 + 2, product* 2 * 3 * 6 * 9 * 4 * 9 * 6 * 2, index + 26949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 6 + 2, product* 2 * 3 * 4 * 2 * 6 * 9 * 6 * 2, index + 26962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 6 + 2, product* 4 * 2 * 2 * 4 * 6 * 9 * 6 * 2, index + 26964224);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 6 + 2, product* 4 * 8 * 3 * 2 * 9 * 9 * 6 * 2, index + 26992384);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9 + 9 + 6 + 2, product* 4 * 4 * 9 * 4 * 9 * 9 * 6 * 2, index + 26994944);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9 + 9 + 6 + 2, product* 8 * 4 * 2 * 7 * 9 * 9 * 6 * 2, index + 26997248);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 7 + 2, product* 2 * 7 * 2 * 2 * 2 * 2 * 7 * 2, index + 27222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 7 + 2, product* 4 * 8 * 7 * 2 * 2 * 2 * 7 * 2, index + 27222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 7 + 2, product* 6 * 9 * 2 * 3 * 2 * 2 * 7 * 2, index + 27223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 7 + 2, product* 2 * 3 * 8 * 4 * 2 * 2 * 7 * 2, index + 27224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 7 + 2, product* 8 * 6 * 3 * 6 * 2 * 2 * 7 * 2, index + 27226368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 7 + 2, product* 4 * 2 * 6 * 6 * 2 * 2 * 7 * 2, index + 27226624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 7 + 2, product* 2 * 9 * 3 * 7 * 2 * 2 * 7 * 2, index + 27227392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2 + 7 + 2, product* 8 * 4 * 6 * 7 * 2 * 2 * 7 * 2, index + 27227648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2 + 7 + 2, product* 2 * 7 * 6 * 8 * 2 * 2 * 7 * 2, index + 27228672);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 7 + 2, product* 8 * 6 * 7 * 2 * 3 * 2 * 7 * 2, index + 27232768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 7 + 2, product* 2 * 9 * 7 * 3 * 3 * 2 * 7 * 2, index + 27233792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 7 + 2, product* 4 * 6 * 8 * 6 * 3 * 2 * 7 * 2, index + 27236864);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 7 + 2, product* 6 * 7 * 3 * 7 * 3 * 2 * 7 * 2, index + 27237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 7 + 2, product* 2 * 3 * 6 * 7 * 3 * 2 * 7 * 2, index + 27237632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 7 + 2, product* 4 * 2 * 4 * 9 * 3 * 2 * 7 * 2, index + 27239424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 7 + 2, product* 6 * 3 * 9 * 9 * 3 * 2 * 7 * 2, index + 27239936);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 7 + 2, product* 6 * 9 * 4 * 2 * 4 * 2 * 7 * 2, index + 27242496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 7 + 2, product* 4 * 6 * 2 * 3 * 4 * 2 * 7 * 2, index + 27243264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 7 + 2, product* 6 * 7 * 7 * 3 * 4 * 2 * 7 * 2, index + 27243776);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 2 + 7 + 2, product* 8 * 4 * 8 * 6 * 4 * 2 * 7 * 2, index + 27246848);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 2 + 7 + 2, product* 4 * 6 * 6 * 9 * 4 * 2 * 7 * 2, index + 27249664);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 7 + 2, product* 4 * 6 * 4 * 2 * 6 * 2 * 7 * 2, index + 27262464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 7 + 2, product* 2 * 3 * 2 * 3 * 6 * 2 * 7 * 2, index + 27263232);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 2 + 7 + 2, product* 2 * 9 * 3 * 3 * 6 * 2 * 7 * 2, index + 27263392);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 7 + 2, product* 8 * 8 * 4 * 3 * 6 * 2 * 7 * 2, index + 27263488);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 7 + 2, product* 8 * 2 * 3 * 7 * 6 * 2 * 7 * 2, index + 27267328);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 7 + 2, product* 2 * 7 * 4 * 3 * 7 * 2 * 7 * 2, index + 27273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 7 + 2, product* 8 * 2 * 7 * 3 * 7 * 2 * 7 * 2, index + 27273728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 7 + 2, product* 4 * 8 * 9 * 3 * 7 * 2 * 7 * 2, index + 27273984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2 + 7 + 2, product* 6 * 9 * 4 * 4 * 7 * 2 * 7 * 2, index + 27274496);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 7 + 2, product* 4 * 2 * 8 * 7 * 7 * 2 * 7 * 2, index + 27277824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 7 + 2, product* 2 * 3 * 4 * 2 * 8 * 2 * 7 * 2, index + 27282432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 7 + 2, product* 4 * 4 * 9 * 2 * 8 * 2 * 7 * 2, index + 27282944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 2 + 7 + 2, product* 8 * 6 * 9 * 3 * 8 * 2 * 7 * 2, index + 27283968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 7 + 2, product* 4 * 2 * 2 * 4 * 8 * 2 * 7 * 2, index + 27284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 7 + 2, product* 6 * 3 * 7 * 4 * 8 * 2 * 7 * 2, index + 27284736);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 7 + 2, product* 2 * 7 * 6 * 2 * 9 * 2 * 7 * 2, index + 27292672);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 2 + 7 + 2, product* 6 * 9 * 6 * 3 * 9 * 2 * 7 * 2, index + 27293696);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 7 + 2, product* 4 * 6 * 4 * 4 * 9 * 2 * 7 * 2, index + 27294464);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 9 + 2 + 7 + 2, product* 8 * 6 * 7 * 6 * 9 * 2 * 7 * 2, index + 27296768);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 2 + 7 + 2, product* 8 * 2 * 3 * 9 * 9 * 2 * 7 * 2, index + 27299328);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 7 + 2, product* 8 * 6 * 3 * 2 * 2 * 3 * 7 * 2, index + 27322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 7 + 2, product* 4 * 2 * 6 * 2 * 2 * 3 * 7 * 2, index + 27322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 7 + 2, product* 2 * 9 * 3 * 3 * 2 * 3 * 7 * 2, index + 27323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 7 + 2, product* 8 * 4 * 6 * 3 * 2 * 3 * 7 * 2, index + 27323648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 7 + 2, product* 2 * 7 * 6 * 4 * 2 * 3 * 7 * 2, index + 27324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 7 + 2, product* 8 * 2 * 9 * 4 * 2 * 3 * 7 * 2, index + 27324928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 7 + 2, product* 4 * 6 * 4 * 6 * 2 * 3 * 7 * 2, index + 27326464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 3 + 7 + 2, product* 6 * 7 * 9 * 6 * 2 * 3 * 7 * 2, index + 27326976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 7 + 2, product* 2 * 3 * 2 * 7 * 2 * 3 * 7 * 2, index + 27327232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 7 + 2, product* 4 * 4 * 7 * 7 * 2 * 3 * 7 * 2, index + 27327744);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 7 + 2, product* 2 * 9 * 7 * 9 * 2 * 3 * 7 * 2, index + 27329792);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 7 + 2, product* 2 * 3 * 6 * 3 * 3 * 3 * 7 * 2, index + 27333632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 7 + 2, product* 2 * 7 * 4 * 7 * 3 * 3 * 7 * 2, index + 27337472);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 7 + 2, product* 4 * 6 * 2 * 9 * 3 * 3 * 7 * 2, index + 27339264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 7 + 2, product* 6 * 3 * 3 * 2 * 4 * 3 * 7 * 2, index + 27342336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 7 + 2, product* 8 * 4 * 8 * 2 * 4 * 3 * 7 * 2, index + 27342848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 7 + 2, product* 2 * 7 * 8 * 3 * 4 * 3 * 7 * 2, index + 27343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 7 + 2, product* 4 * 8 * 3 * 4 * 4 * 3 * 7 * 2, index + 27344384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 4 + 3 + 7 + 2, product* 6 * 9 * 8 * 4 * 4 * 3 * 7 * 2, index + 27344896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 7 + 2, product* 2 * 3 * 4 * 6 * 4 * 3 * 7 * 2, index + 27346432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 7 + 2, product* 4 * 2 * 2 * 8 * 4 * 3 * 7 * 2, index + 27348224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 7 + 2, product* 8 * 4 * 2 * 9 * 4 * 3 * 7 * 2, index + 27349248);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 7 + 2, product* 8 * 2 * 3 * 3 * 6 * 3 * 7 * 2, index + 27363328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 3 + 7 + 2, product* 4 * 6 * 8 * 4 * 6 * 3 * 7 * 2, index + 27364864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 7 + 2, product* 4 * 2 * 4 * 7 * 6 * 3 * 7 * 2, index + 27367424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 7 + 2, product* 8 * 4 * 4 * 8 * 6 * 3 * 7 * 2, index + 27368448);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3 + 7 + 2, product* 8 * 8 * 2 * 2 * 7 * 3 * 7 * 2, index + 27372288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 7 + 2, product* 4 * 2 * 8 * 3 * 7 * 3 * 7 * 2, index + 27373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 7 + 2, product* 6 * 3 * 3 * 4 * 7 * 3 * 7 * 2, index + 27374336);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 3 + 7 + 2, product* 4 * 4 * 9 * 8 * 7 * 3 * 7 * 2, index + 27378944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 7 + 2, product* 2 * 7 * 2 * 2 * 8 * 3 * 7 * 2, index + 27382272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3 + 7 + 2, product* 4 * 8 * 7 * 2 * 8 * 3 * 7 * 2, index + 27382784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 7 + 2, product* 6 * 9 * 2 * 3 * 8 * 3 * 7 * 2, index + 27383296);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 3 + 7 + 2, product* 4 * 2 * 6 * 6 * 8 * 3 * 7 * 2, index + 27386624);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 7 + 2, product* 4 * 2 * 4 * 9 * 9 * 3 * 7 * 2, index + 27399424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 7 + 2, product* 4 * 6 * 4 * 2 * 2 * 4 * 7 * 2, index + 27422464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 7 + 2, product* 6 * 7 * 9 * 2 * 2 * 4 * 7 * 2, index + 27422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 7 + 2, product* 2 * 3 * 2 * 3 * 2 * 4 * 7 * 2, index + 27423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 7 + 2, product* 8 * 8 * 4 * 3 * 2 * 4 * 7 * 2, index + 27423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 7 + 2, product* 4 * 4 * 7 * 3 * 2 * 4 * 7 * 2, index + 27423744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 7 + 2, product* 8 * 2 * 3 * 7 * 2 * 4 * 7 * 2, index + 27427328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 4 + 7 + 2, product* 4 * 6 * 8 * 8 * 2 * 4 * 7 * 2, index + 27428864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 4 + 7 + 2, product* 6 * 7 * 3 * 9 * 2 * 4 * 7 * 2, index + 27429376);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 7 + 2, product* 8 * 4 * 4 * 2 * 3 * 4 * 7 * 2, index + 27432448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 7 + 2, product* 2 * 7 * 4 * 3 * 3 * 4 * 7 * 2, index + 27433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 7 + 2, product* 8 * 2 * 7 * 3 * 3 * 4 * 7 * 2, index + 27433728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 7 + 2, product* 4 * 8 * 9 * 3 * 3 * 4 * 7 * 2, index + 27433984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4 + 7 + 2, product* 8 * 8 * 2 * 6 * 3 * 4 * 7 * 2, index + 27436288);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 7 + 2, product* 2 * 3 * 4 * 2 * 4 * 4 * 7 * 2, index + 27442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 7 + 2, product* 4 * 4 * 9 * 2 * 4 * 4 * 7 * 2, index + 27442944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 7 + 2, product* 4 * 2 * 2 * 4 * 4 * 4 * 7 * 2, index + 27444224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 4 + 7 + 2, product* 6 * 3 * 7 * 4 * 4 * 4 * 7 * 2, index + 27444736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 7 + 2, product* 2 * 7 * 2 * 6 * 4 * 4 * 7 * 2, index + 27446272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 4 + 7 + 2, product* 4 * 8 * 7 * 6 * 4 * 4 * 7 * 2, index + 27446784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 4 + 7 + 2, product* 2 * 3 * 8 * 8 * 4 * 4 * 7 * 2, index + 27448832);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 7 + 2, product* 4 * 6 * 2 * 7 * 6 * 4 * 7 * 2, index + 27467264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 4 + 7 + 2, product* 6 * 7 * 7 * 7 * 6 * 4 * 7 * 2, index + 27467776);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 4 + 7 + 2, product* 4 * 2 * 8 * 9 * 6 * 4 * 7 * 2, index + 27469824);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 4 + 7 + 2, product* 6 * 9 * 8 * 2 * 7 * 4 * 7 * 2, index + 27472896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 7 + 2, product* 2 * 3 * 4 * 4 * 7 * 4 * 7 * 2, index + 27474432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 7 + 2, product* 4 * 2 * 2 * 6 * 7 * 4 * 7 * 2, index + 27476224);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 4 + 7 + 2, product* 6 * 3 * 9 * 9 * 7 * 4 * 7 * 2, index + 27479936);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4 + 7 + 2, product* 8 * 6 * 3 * 2 * 8 * 4 * 7 * 2, index + 27482368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 7 + 2, product* 4 * 2 * 6 * 2 * 8 * 4 * 7 * 2, index + 27482624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 7 + 2, product* 2 * 9 * 3 * 3 * 8 * 4 * 7 * 2, index + 27483392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 4 + 7 + 2, product* 2 * 7 * 6 * 4 * 8 * 4 * 7 * 2, index + 27484672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4 + 7 + 2, product* 4 * 6 * 4 * 6 * 8 * 4 * 7 * 2, index + 27486464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 7 + 2, product* 2 * 3 * 2 * 7 * 8 * 4 * 7 * 2, index + 27487232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 4 + 7 + 2, product* 4 * 4 * 7 * 7 * 8 * 4 * 7 * 2, index + 27487744);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 4 + 7 + 2, product* 6 * 7 * 3 * 3 * 9 * 4 * 7 * 2, index + 27493376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 7 + 2, product* 2 * 3 * 6 * 3 * 9 * 4 * 7 * 2, index + 27493632);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 4 + 7 + 2, product* 8 * 2 * 7 * 7 * 9 * 4 * 7 * 2, index + 27497728);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 7 + 2, product* 4 * 2 * 4 * 3 * 2 * 6 * 7 * 2, index + 27623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 7 + 2, product* 6 * 3 * 9 * 3 * 2 * 6 * 7 * 2, index + 27623936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 7 + 2, product* 8 * 4 * 4 * 4 * 2 * 6 * 7 * 2, index + 27624448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 6 + 7 + 2, product* 6 * 9 * 4 * 6 * 2 * 6 * 7 * 2, index + 27626496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 7 + 2, product* 4 * 6 * 2 * 7 * 2 * 6 * 7 * 2, index + 27627264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 7 + 2, product* 4 * 8 * 3 * 2 * 3 * 6 * 7 * 2, index + 27632384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6 + 7 + 2, product* 4 * 6 * 6 * 3 * 3 * 6 * 7 * 2, index + 27633664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 7 + 2, product* 2 * 3 * 4 * 4 * 3 * 6 * 7 * 2, index + 27634432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 7 + 2, product* 4 * 2 * 2 * 6 * 3 * 6 * 7 * 2, index + 27636224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 7 + 2, product* 2 * 7 * 2 * 8 * 3 * 6 * 7 * 2, index + 27638272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 6 + 7 + 2, product* 8 * 6 * 3 * 2 * 4 * 6 * 7 * 2, index + 27642368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 6 + 7 + 2, product* 2 * 9 * 3 * 3 * 4 * 6 * 7 * 2, index + 27643392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 6 + 7 + 2, product* 4 * 6 * 4 * 6 * 4 * 6 * 7 * 2, index + 27646464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 7 + 2, product* 2 * 3 * 2 * 7 * 4 * 6 * 7 * 2, index + 27647232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 7 + 2, product* 6 * 3 * 3 * 2 * 6 * 6 * 7 * 2, index + 27662336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6 + 7 + 2, product* 8 * 4 * 8 * 2 * 6 * 6 * 7 * 2, index + 27662848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 6 + 7 + 2, product* 2 * 7 * 8 * 3 * 6 * 6 * 7 * 2, index + 27663872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 7 + 2, product* 2 * 3 * 4 * 6 * 6 * 6 * 7 * 2, index + 27666432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 6 + 7 + 2, product* 4 * 4 * 9 * 6 * 6 * 6 * 7 * 2, index + 27666944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 7 + 2, product* 4 * 2 * 2 * 8 * 6 * 6 * 7 * 2, index + 27668224);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 7 + 2, product* 4 * 2 * 6 * 4 * 7 * 6 * 7 * 2, index + 27674624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 7 + 2, product* 2 * 3 * 2 * 9 * 7 * 6 * 7 * 2, index + 27679232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6 + 7 + 2, product* 8 * 2 * 3 * 3 * 8 * 6 * 7 * 2, index + 27683328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 6 + 7 + 2, product* 4 * 6 * 8 * 4 * 8 * 6 * 7 * 2, index + 27684864);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 6 + 7 + 2, product* 8 * 8 * 2 * 2 * 9 * 6 * 7 * 2, index + 27692288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 6 + 7 + 2, product* 4 * 2 * 8 * 3 * 9 * 6 * 7 * 2, index + 27693824);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 7 + 2, product* 4 * 6 * 2 * 3 * 2 * 7 * 7 * 2, index + 27723264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 7 + 2, product* 8 * 8 * 2 * 4 * 2 * 7 * 7 * 2, index + 27724288);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 7 + 2, product* 4 * 2 * 2 * 2 * 3 * 7 * 7 * 2, index + 27732224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 7 + 2, product* 2 * 9 * 9 * 2 * 3 * 7 * 7 * 2, index + 27732992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 7 + 2, product* 2 * 7 * 2 * 4 * 3 * 7 * 7 * 2, index + 27734272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7 + 7 + 2, product* 2 * 3 * 8 * 6 * 3 * 7 * 7 * 2, index + 27736832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 7 + 7 + 2, product* 4 * 4 * 3 * 7 * 3 * 7 * 7 * 2, index + 27737344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 7 + 7 + 2, product* 2 * 9 * 3 * 9 * 3 * 7 * 7 * 2, index + 27739392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 7 + 2, product* 4 * 6 * 4 * 2 * 4 * 7 * 7 * 2, index + 27742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 7 + 2, product* 2 * 3 * 2 * 3 * 4 * 7 * 7 * 2, index + 27743232);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 7 + 7 + 2, product* 8 * 6 * 7 * 4 * 4 * 7 * 7 * 2, index + 27744768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 7 + 7 + 2, product* 8 * 2 * 3 * 7 * 4 * 7 * 7 * 2, index + 27747328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 7 + 2, product* 2 * 3 * 4 * 2 * 6 * 7 * 7 * 2, index + 27762432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 7 + 2, product* 4 * 2 * 2 * 4 * 6 * 7 * 7 * 2, index + 27764224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 7 + 7 + 2, product* 2 * 7 * 2 * 6 * 6 * 7 * 7 * 2, index + 27766272);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 7 + 7 + 2, product* 2 * 7 * 6 * 2 * 7 * 7 * 7 * 2, index + 27772672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 7 + 7 + 2, product* 4 * 6 * 4 * 4 * 7 * 7 * 7 * 2, index + 27774464);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7 + 7 + 2, product* 8 * 2 * 3 * 9 * 7 * 7 * 7 * 2, index + 27779328);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 7 + 7 + 2, product* 4 * 8 * 3 * 2 * 9 * 7 * 7 * 2, index + 27792384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 7 + 7 + 2, product* 4 * 6 * 6 * 3 * 9 * 7 * 7 * 2, index + 27793664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 7 + 2, product* 2 * 3 * 4 * 4 * 9 * 7 * 7 * 2, index + 27794432);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 9 + 7 + 7 + 2, product* 8 * 4 * 2 * 7 * 9 * 7 * 7 * 2, index + 27797248);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 7 + 2, product* 6 * 3 * 3 * 2 * 2 * 8 * 7 * 2, index + 27822336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 7 + 2, product* 4 * 8 * 3 * 4 * 2 * 8 * 7 * 2, index + 27824384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 7 + 2, product* 2 * 3 * 4 * 6 * 2 * 8 * 7 * 2, index + 27826432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 7 + 2, product* 4 * 2 * 2 * 8 * 2 * 8 * 7 * 2, index + 27828224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 7 + 2, product* 8 * 4 * 2 * 9 * 2 * 8 * 7 * 2, index + 27829248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 7 + 2, product* 2 * 3 * 8 * 2 * 3 * 8 * 7 * 2, index + 27832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 7 + 2, product* 4 * 4 * 3 * 3 * 3 * 8 * 7 * 2, index + 27833344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 7 + 2, product* 4 * 2 * 6 * 4 * 3 * 8 * 7 * 2, index + 27834624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 8 + 7 + 2, product* 8 * 2 * 9 * 6 * 3 * 8 * 7 * 2, index + 27836928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 8 + 7 + 2, product* 4 * 6 * 4 * 8 * 3 * 8 * 7 * 2, index + 27838464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 7 + 2, product* 2 * 3 * 2 * 9 * 3 * 8 * 7 * 2, index + 27839232);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 8 + 7 + 2, product* 4 * 6 * 8 * 4 * 4 * 8 * 7 * 2, index + 27844864);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8 + 7 + 2, product* 2 * 3 * 8 * 4 * 6 * 8 * 7 * 2, index + 27864832);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 8 + 7 + 2, product* 2 * 9 * 7 * 3 * 7 * 8 * 7 * 2, index + 27873792);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 7 + 2, product* 4 * 6 * 2 * 3 * 8 * 8 * 7 * 2, index + 27883264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 7 + 2, product* 4 * 2 * 2 * 2 * 9 * 8 * 7 * 2, index + 27892224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 8 + 7 + 2, product* 2 * 9 * 9 * 2 * 9 * 8 * 7 * 2, index + 27892992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 8 + 7 + 2, product* 2 * 7 * 2 * 4 * 9 * 8 * 7 * 2, index + 27894272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 7 + 2, product* 2 * 3 * 4 * 2 * 2 * 9 * 7 * 2, index + 27922432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 7 + 2, product* 4 * 4 * 9 * 2 * 2 * 9 * 7 * 2, index + 27922944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 9 + 7 + 2, product* 8 * 6 * 9 * 3 * 2 * 9 * 7 * 2, index + 27923968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 7 + 2, product* 4 * 2 * 2 * 4 * 2 * 9 * 7 * 2, index + 27924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 7 + 2, product* 6 * 3 * 7 * 4 * 2 * 9 * 7 * 2, index + 27924736);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9 + 7 + 2, product* 6 * 9 * 2 * 7 * 2 * 9 * 7 * 2, index + 27927296);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 7 + 2, product* 2 * 7 * 6 * 2 * 3 * 9 * 7 * 2, index + 27932672);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 9 + 7 + 2, product* 2 * 9 * 7 * 7 * 3 * 9 * 7 * 2, index + 27937792);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 9 + 7 + 2, product* 8 * 4 * 4 * 4 * 4 * 9 * 7 * 2, index + 27944448);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 7 + 2, product* 4 * 2 * 6 * 2 * 6 * 9 * 7 * 2, index + 27962624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 9 + 7 + 2, product* 2 * 9 * 3 * 3 * 6 * 9 * 7 * 2, index + 27963392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 7 + 2, product* 2 * 3 * 2 * 7 * 6 * 9 * 7 * 2, index + 27967232);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 9 + 7 + 2, product* 8 * 2 * 7 * 7 * 7 * 9 * 7 * 2, index + 27977728);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 9 + 7 + 2, product* 2 * 3 * 4 * 6 * 8 * 9 * 7 * 2, index + 27986432);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 9 + 7 + 2, product* 8 * 4 * 2 * 9 * 8 * 9 * 7 * 2, index + 27989248);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 9 + 7 + 2, product* 4 * 2 * 6 * 4 * 9 * 9 * 7 * 2, index + 27994624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 8 + 2, product* 4 * 6 * 4 * 2 * 2 * 2 * 8 * 2, index + 28222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 8 + 2, product* 6 * 7 * 9 * 2 * 2 * 2 * 8 * 2, index + 28222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 8 + 2, product* 2 * 3 * 2 * 3 * 2 * 2 * 8 * 2, index + 28223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 8 + 2, product* 8 * 8 * 4 * 3 * 2 * 2 * 8 * 2, index + 28223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 8 + 2, product* 4 * 4 * 7 * 3 * 2 * 2 * 8 * 2, index + 28223744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 8 + 2, product* 2 * 3 * 6 * 9 * 2 * 2 * 8 * 2, index + 28229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 8 + 2, product* 8 * 4 * 4 * 2 * 3 * 2 * 8 * 2, index + 28232448);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 8 + 2, product* 8 * 2 * 7 * 3 * 3 * 2 * 8 * 2, index + 28233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 8 + 2, product* 4 * 8 * 9 * 3 * 3 * 2 * 8 * 2, index + 28233984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 8 + 2, product* 6 * 9 * 4 * 4 * 3 * 2 * 8 * 2, index + 28234496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 8 + 2, product* 8 * 8 * 2 * 6 * 3 * 2 * 8 * 2, index + 28236288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 8 + 2, product* 6 * 3 * 3 * 8 * 3 * 2 * 8 * 2, index + 28238336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 8 + 2, product* 2 * 3 * 4 * 2 * 4 * 2 * 8 * 2, index + 28242432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 8 + 2, product* 4 * 4 * 9 * 2 * 4 * 2 * 8 * 2, index + 28242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 8 + 2, product* 4 * 2 * 2 * 4 * 4 * 2 * 8 * 2, index + 28244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 8 + 2, product* 6 * 3 * 7 * 4 * 4 * 2 * 8 * 2, index + 28244736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 8 + 2, product* 2 * 7 * 2 * 6 * 4 * 2 * 8 * 2, index + 28246272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 8 + 2, product* 2 * 3 * 8 * 8 * 4 * 2 * 8 * 2, index + 28248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 8 + 2, product* 4 * 4 * 3 * 9 * 4 * 2 * 8 * 2, index + 28249344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 8 + 2, product* 4 * 2 * 4 * 3 * 6 * 2 * 8 * 2, index + 28263424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2 + 8 + 2, product* 6 * 3 * 9 * 3 * 6 * 2 * 8 * 2, index + 28263936);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 8 + 2, product* 4 * 6 * 6 * 3 * 7 * 2 * 8 * 2, index + 28273664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 8 + 2, product* 2 * 3 * 4 * 4 * 7 * 2 * 8 * 2, index + 28274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 8 + 2, product* 4 * 4 * 9 * 4 * 7 * 2 * 8 * 2, index + 28274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 8 + 2, product* 4 * 2 * 2 * 6 * 7 * 2 * 8 * 2, index + 28276224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 8 + 2, product* 8 * 4 * 2 * 7 * 7 * 2 * 8 * 2, index + 28277248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 8 + 2, product* 2 * 7 * 2 * 8 * 7 * 2 * 8 * 2, index + 28278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 8 + 2, product* 8 * 6 * 3 * 2 * 8 * 2 * 8 * 2, index + 28282368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 8 + 2, product* 2 * 9 * 3 * 3 * 8 * 2 * 8 * 2, index + 28283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 8 + 2, product* 8 * 4 * 6 * 3 * 8 * 2 * 8 * 2, index + 28283648);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 8 + 2, product* 8 * 2 * 9 * 4 * 8 * 2 * 8 * 2, index + 28284928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 8 + 2, product* 4 * 6 * 4 * 6 * 8 * 2 * 8 * 2, index + 28286464);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 8 + 2, product* 6 * 7 * 3 * 3 * 9 * 2 * 8 * 2, index + 28293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 8 + 2, product* 2 * 3 * 6 * 3 * 9 * 2 * 8 * 2, index + 28293632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2 + 8 + 2, product* 8 * 8 * 8 * 3 * 9 * 2 * 8 * 2, index + 28293888);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 8 + 2, product* 2 * 7 * 4 * 7 * 9 * 2 * 8 * 2, index + 28297472);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 2 + 8 + 2, product* 4 * 6 * 2 * 9 * 9 * 2 * 8 * 2, index + 28299264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 8 + 2, product* 8 * 2 * 3 * 3 * 2 * 3 * 8 * 2, index + 28323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 8 + 2, product* 4 * 2 * 4 * 7 * 2 * 3 * 8 * 2, index + 28327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 8 + 2, product* 6 * 3 * 9 * 7 * 2 * 3 * 8 * 2, index + 28327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 8 + 2, product* 8 * 4 * 4 * 8 * 2 * 3 * 8 * 2, index + 28328448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 8 + 2, product* 2 * 7 * 4 * 9 * 2 * 3 * 8 * 2, index + 28329472);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 8 + 2, product* 4 * 2 * 8 * 3 * 3 * 3 * 8 * 2, index + 28333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 8 + 2, product* 6 * 3 * 3 * 4 * 3 * 3 * 8 * 2, index + 28334336);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 3 + 8 + 2, product* 6 * 9 * 8 * 6 * 3 * 3 * 8 * 2, index + 28336896);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 8 + 2, product* 2 * 3 * 4 * 8 * 3 * 3 * 8 * 2, index + 28338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 8 + 2, product* 2 * 7 * 2 * 2 * 4 * 3 * 8 * 2, index + 28342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 8 + 2, product* 4 * 8 * 7 * 2 * 4 * 3 * 8 * 2, index + 28342784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 8 + 2, product* 2 * 3 * 8 * 4 * 4 * 3 * 8 * 2, index + 28344832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 8 + 2, product* 8 * 6 * 3 * 6 * 4 * 3 * 8 * 2, index + 28346368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 8 + 2, product* 4 * 2 * 6 * 6 * 4 * 3 * 8 * 2, index + 28346624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 8 + 2, product* 2 * 9 * 3 * 7 * 4 * 3 * 8 * 2, index + 28347392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 8 + 2, product* 8 * 2 * 9 * 8 * 4 * 3 * 8 * 2, index + 28348928);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 8 + 2, product* 4 * 6 * 2 * 3 * 6 * 3 * 8 * 2, index + 28363264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 8 + 2, product* 2 * 9 * 3 * 3 * 6 * 3 * 8 * 2, index + 28363392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 8 + 2, product* 8 * 8 * 2 * 4 * 6 * 3 * 8 * 2, index + 28364288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 8 + 2, product* 6 * 3 * 3 * 6 * 6 * 3 * 8 * 2, index + 28366336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 8 + 2, product* 4 * 2 * 2 * 2 * 7 * 3 * 8 * 2, index + 28372224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 8 + 2, product* 2 * 9 * 9 * 2 * 7 * 3 * 8 * 2, index + 28372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 8 + 2, product* 8 * 4 * 2 * 3 * 7 * 3 * 8 * 2, index + 28373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 8 + 2, product* 2 * 7 * 2 * 4 * 7 * 3 * 8 * 2, index + 28374272);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3 + 8 + 2, product* 4 * 2 * 6 * 8 * 7 * 3 * 8 * 2, index + 28378624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 8 + 2, product* 2 * 3 * 2 * 3 * 8 * 3 * 8 * 2, index + 28383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 8 + 2, product* 8 * 8 * 4 * 3 * 8 * 3 * 8 * 2, index + 28383488);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 8 + 2, product* 8 * 4 * 4 * 2 * 9 * 3 * 8 * 2, index + 28392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 8 + 2, product* 2 * 7 * 4 * 3 * 9 * 3 * 8 * 2, index + 28393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 8 + 2, product* 8 * 2 * 7 * 3 * 9 * 3 * 8 * 2, index + 28393728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 8 + 2, product* 4 * 2 * 8 * 7 * 9 * 3 * 8 * 2, index + 28397824);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 8 + 2, product* 4 * 2 * 4 * 3 * 2 * 4 * 8 * 2, index + 28423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 8 + 2, product* 6 * 3 * 9 * 3 * 2 * 4 * 8 * 2, index + 28423936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 8 + 2, product* 4 * 6 * 2 * 7 * 2 * 4 * 8 * 2, index + 28427264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 8 + 2, product* 8 * 8 * 2 * 8 * 2 * 4 * 8 * 2, index + 28428288);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 8 + 2, product* 4 * 8 * 3 * 2 * 3 * 4 * 8 * 2, index + 28432384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 8 + 2, product* 6 * 9 * 8 * 2 * 3 * 4 * 8 * 2, index + 28432896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 8 + 2, product* 2 * 3 * 4 * 4 * 3 * 4 * 8 * 2, index + 28434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 8 + 2, product* 4 * 2 * 2 * 6 * 3 * 4 * 8 * 2, index + 28436224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 8 + 2, product* 2 * 7 * 2 * 8 * 3 * 4 * 8 * 2, index + 28438272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 8 + 2, product* 8 * 6 * 3 * 2 * 4 * 4 * 8 * 2, index + 28442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 8 + 2, product* 4 * 2 * 6 * 2 * 4 * 4 * 8 * 2, index + 28442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 8 + 2, product* 2 * 9 * 3 * 3 * 4 * 4 * 8 * 2, index + 28443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 8 + 2, product* 8 * 4 * 6 * 3 * 4 * 4 * 8 * 2, index + 28443648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 8 + 2, product* 2 * 7 * 6 * 4 * 4 * 4 * 8 * 2, index + 28444672);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 4 + 8 + 2, product* 6 * 7 * 9 * 6 * 4 * 4 * 8 * 2, index + 28446976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 8 + 2, product* 2 * 3 * 2 * 7 * 4 * 4 * 8 * 2, index + 28447232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 8 + 2, product* 6 * 3 * 3 * 2 * 6 * 4 * 8 * 2, index + 28462336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 8 + 2, product* 8 * 4 * 8 * 2 * 6 * 4 * 8 * 2, index + 28462848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 8 + 2, product* 2 * 7 * 8 * 3 * 6 * 4 * 8 * 2, index + 28463872);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 4 + 8 + 2, product* 4 * 4 * 9 * 6 * 6 * 4 * 8 * 2, index + 28466944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 8 + 2, product* 4 * 2 * 2 * 8 * 6 * 4 * 8 * 2, index + 28468224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 8 + 2, product* 8 * 4 * 2 * 9 * 6 * 4 * 8 * 2, index + 28469248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 8 + 2, product* 2 * 3 * 8 * 2 * 7 * 4 * 8 * 2, index + 28472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 8 + 2, product* 4 * 4 * 3 * 3 * 7 * 4 * 8 * 2, index + 28473344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 8 + 2, product* 4 * 2 * 6 * 4 * 7 * 4 * 8 * 2, index + 28474624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 4 + 8 + 2, product* 8 * 2 * 9 * 6 * 7 * 4 * 8 * 2, index + 28476928);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 4 + 8 + 2, product* 4 * 6 * 8 * 4 * 8 * 4 * 8 * 2, index + 28484864);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 4 + 8 + 2, product* 8 * 4 * 4 * 8 * 8 * 4 * 8 * 2, index + 28488448);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 4 + 8 + 2, product* 8 * 2 * 7 * 9 * 8 * 4 * 8 * 2, index + 28489728);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 8 + 2, product* 4 * 2 * 8 * 3 * 9 * 4 * 8 * 2, index + 28493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 8 + 2, product* 6 * 3 * 3 * 2 * 2 * 6 * 8 * 2, index + 28622336);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 8 + 2, product* 6 * 9 * 8 * 4 * 2 * 6 * 8 * 2, index + 28624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 8 + 2, product* 2 * 3 * 4 * 6 * 2 * 6 * 8 * 2, index + 28626432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 8 + 2, product* 4 * 2 * 2 * 8 * 2 * 6 * 8 * 2, index + 28628224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 6 + 8 + 2, product* 8 * 4 * 2 * 9 * 2 * 6 * 8 * 2, index + 28629248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 8 + 2, product* 2 * 3 * 8 * 2 * 3 * 6 * 8 * 2, index + 28632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 8 + 2, product* 4 * 4 * 3 * 3 * 3 * 6 * 8 * 2, index + 28633344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 8 + 2, product* 4 * 2 * 6 * 4 * 3 * 6 * 8 * 2, index + 28634624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 8 + 2, product* 2 * 7 * 6 * 6 * 3 * 6 * 8 * 2, index + 28636672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 8 + 2, product* 2 * 3 * 2 * 9 * 3 * 6 * 8 * 2, index + 28639232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 8 + 2, product* 2 * 7 * 2 * 2 * 6 * 6 * 8 * 2, index + 28662272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 8 + 2, product* 2 * 3 * 8 * 4 * 6 * 6 * 8 * 2, index + 28664832);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 8 + 2, product* 4 * 2 * 4 * 9 * 7 * 6 * 8 * 2, index + 28679424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6 + 8 + 2, product* 6 * 9 * 4 * 2 * 8 * 6 * 8 * 2, index + 28682496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 8 + 2, product* 4 * 6 * 2 * 3 * 8 * 6 * 8 * 2, index + 28683264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 6 + 8 + 2, product* 6 * 3 * 3 * 6 * 8 * 6 * 8 * 2, index + 28686336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 6 + 8 + 2, product* 2 * 7 * 8 * 7 * 8 * 6 * 8 * 2, index + 28687872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 8 + 2, product* 4 * 2 * 2 * 2 * 9 * 6 * 8 * 2, index + 28692224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 6 + 8 + 2, product* 6 * 3 * 7 * 2 * 9 * 6 * 8 * 2, index + 28692736);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 8 + 2, product* 2 * 3 * 8 * 6 * 9 * 6 * 8 * 2, index + 28696832);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 6 + 8 + 2, product* 8 * 6 * 3 * 8 * 9 * 6 * 8 * 2, index + 28698368);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 8 + 2, product* 2 * 3 * 4 * 2 * 2 * 7 * 8 * 2, index + 28722432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 7 + 8 + 2, product* 8 * 8 * 6 * 2 * 2 * 7 * 8 * 2, index + 28722688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 8 + 2, product* 4 * 4 * 9 * 2 * 2 * 7 * 8 * 2, index + 28722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 8 + 2, product* 4 * 2 * 2 * 4 * 2 * 7 * 8 * 2, index + 28724224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 8 + 2, product* 2 * 9 * 9 * 4 * 2 * 7 * 8 * 2, index + 28724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 8 + 2, product* 2 * 7 * 2 * 6 * 2 * 7 * 8 * 2, index + 28726272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 8 + 2, product* 6 * 9 * 2 * 7 * 2 * 7 * 8 * 2, index + 28727296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 8 + 2, product* 2 * 3 * 8 * 8 * 2 * 7 * 8 * 2, index + 28728832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 8 + 2, product* 2 * 7 * 6 * 2 * 3 * 7 * 8 * 2, index + 28732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 8 + 2, product* 8 * 2 * 9 * 2 * 3 * 7 * 8 * 2, index + 28732928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 7 + 8 + 2, product* 6 * 9 * 6 * 3 * 3 * 7 * 8 * 2, index + 28733696);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 8 + 2, product* 4 * 6 * 4 * 4 * 3 * 7 * 8 * 2, index + 28734464);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 8 + 2, product* 8 * 2 * 3 * 9 * 3 * 7 * 8 * 2, index + 28739328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 8 + 2, product* 4 * 2 * 4 * 3 * 4 * 7 * 8 * 2, index + 28743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 8 + 2, product* 6 * 3 * 9 * 3 * 4 * 7 * 8 * 2, index + 28743936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 7 + 8 + 2, product* 8 * 4 * 4 * 4 * 4 * 7 * 8 * 2, index + 28744448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 7 + 8 + 2, product* 6 * 9 * 4 * 6 * 4 * 7 * 8 * 2, index + 28746496);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7 + 8 + 2, product* 8 * 6 * 3 * 2 * 6 * 7 * 8 * 2, index + 28762368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 8 + 2, product* 4 * 2 * 6 * 2 * 6 * 7 * 8 * 2, index + 28762624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 8 + 2, product* 2 * 9 * 3 * 3 * 6 * 7 * 8 * 2, index + 28763392);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 7 + 8 + 2, product* 4 * 6 * 8 * 2 * 7 * 7 * 8 * 2, index + 28772864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 7 + 8 + 2, product* 6 * 7 * 3 * 3 * 7 * 7 * 8 * 2, index + 28773376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 8 + 2, product* 2 * 3 * 6 * 3 * 7 * 7 * 8 * 2, index + 28773632);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 8 + 2, product* 6 * 3 * 3 * 2 * 8 * 7 * 8 * 2, index + 28782336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 8 + 2, product* 2 * 3 * 4 * 6 * 8 * 7 * 8 * 2, index + 28786432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 8 + 2, product* 2 * 3 * 8 * 2 * 9 * 7 * 8 * 2, index + 28792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 8 + 2, product* 4 * 4 * 3 * 3 * 9 * 7 * 8 * 2, index + 28793344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 8 + 2, product* 2 * 7 * 2 * 2 * 2 * 8 * 8 * 2, index + 28822272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 8 + 2, product* 6 * 9 * 2 * 3 * 2 * 8 * 8 * 2, index + 28823296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 8 + 2, product* 2 * 3 * 8 * 4 * 2 * 8 * 8 * 2, index + 28824832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 8 + 8 + 2, product* 4 * 2 * 6 * 6 * 2 * 8 * 8 * 2, index + 28826624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 8 + 2, product* 2 * 9 * 3 * 7 * 2 * 8 * 8 * 2, index + 28827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 8 + 2, product* 8 * 4 * 6 * 7 * 2 * 8 * 8 * 2, index + 28827648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 8 + 8 + 2, product* 2 * 7 * 6 * 8 * 2 * 8 * 8 * 2, index + 28828672);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 8 + 2, product* 2 * 9 * 7 * 3 * 3 * 8 * 8 * 2, index + 28833792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 8 + 8 + 2, product* 4 * 6 * 8 * 6 * 3 * 8 * 8 * 2, index + 28836864);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8 + 8 + 2, product* 4 * 2 * 4 * 9 * 3 * 8 * 8 * 2, index + 28839424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 8 + 2, product* 4 * 6 * 2 * 3 * 4 * 8 * 8 * 2, index + 28843264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 8 + 2, product* 6 * 3 * 3 * 6 * 4 * 8 * 8 * 2, index + 28846336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 8 + 2, product* 2 * 3 * 2 * 3 * 6 * 8 * 8 * 2, index + 28863232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 8 + 8 + 2, product* 8 * 2 * 3 * 7 * 6 * 8 * 8 * 2, index + 28867328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 8 + 2, product* 2 * 3 * 6 * 9 * 6 * 8 * 8 * 2, index + 28869632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 8 + 2, product* 2 * 3 * 4 * 2 * 8 * 8 * 8 * 2, index + 28882432);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 8 + 8 + 2, product* 8 * 6 * 9 * 3 * 8 * 8 * 8 * 2, index + 28883968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 8 + 2, product* 4 * 2 * 2 * 4 * 8 * 8 * 8 * 2, index + 28884224);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 8 + 8 + 2, product* 8 * 2 * 9 * 2 * 9 * 8 * 8 * 2, index + 28892928);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 8 + 2, product* 8 * 6 * 3 * 2 * 2 * 9 * 8 * 2, index + 28922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 8 + 2, product* 4 * 2 * 6 * 2 * 2 * 9 * 8 * 2, index + 28922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 8 + 2, product* 2 * 9 * 3 * 3 * 2 * 9 * 8 * 2, index + 28923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9 + 8 + 2, product* 8 * 4 * 6 * 3 * 2 * 9 * 8 * 2, index + 28923648);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9 + 8 + 2, product* 8 * 2 * 9 * 4 * 2 * 9 * 8 * 2, index + 28924928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 8 + 2, product* 2 * 3 * 2 * 7 * 2 * 9 * 8 * 2, index + 28927232);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 8 + 2, product* 8 * 2 * 7 * 7 * 3 * 9 * 8 * 2, index + 28937728);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 8 + 2, product* 6 * 3 * 3 * 2 * 4 * 9 * 8 * 2, index + 28942336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 8 + 2, product* 2 * 7 * 8 * 3 * 4 * 9 * 8 * 2, index + 28943872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 8 + 2, product* 4 * 8 * 3 * 4 * 4 * 9 * 8 * 2, index + 28944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 8 + 2, product* 2 * 3 * 4 * 6 * 4 * 9 * 8 * 2, index + 28946432);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 9 + 8 + 2, product* 4 * 2 * 4 * 7 * 6 * 9 * 8 * 2, index + 28967424);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 8 + 2, product* 2 * 3 * 4 * 8 * 7 * 9 * 8 * 2, index + 28978432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 8 + 2, product* 2 * 7 * 2 * 2 * 8 * 9 * 8 * 2, index + 28982272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 9 + 2, product* 6 * 3 * 3 * 2 * 2 * 2 * 9 * 2, index + 29222336);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 9 + 2, product* 4 * 2 * 4 * 3 * 2 * 2 * 9 * 2, index + 29223424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 9 + 2, product* 6 * 3 * 9 * 3 * 2 * 2 * 9 * 2, index + 29223936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 9 + 2, product* 8 * 4 * 4 * 4 * 2 * 2 * 9 * 2, index + 29224448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 9 + 2, product* 4 * 6 * 2 * 7 * 2 * 2 * 9 * 2, index + 29227264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2 + 9 + 2, product* 4 * 2 * 8 * 9 * 2 * 2 * 9 * 2, index + 29229824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 9 + 2, product* 4 * 8 * 3 * 2 * 3 * 2 * 9 * 2, index + 29232384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 9 + 2, product* 4 * 6 * 6 * 3 * 3 * 2 * 9 * 2, index + 29233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 9 + 2, product* 2 * 3 * 4 * 4 * 3 * 2 * 9 * 2, index + 29234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 9 + 2, product* 4 * 4 * 9 * 4 * 3 * 2 * 9 * 2, index + 29234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 9 + 2, product* 4 * 2 * 2 * 6 * 3 * 2 * 9 * 2, index + 29236224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 2 + 9 + 2, product* 6 * 3 * 7 * 6 * 3 * 2 * 9 * 2, index + 29236736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 9 + 2, product* 8 * 4 * 2 * 7 * 3 * 2 * 9 * 2, index + 29237248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 9 + 2, product* 2 * 7 * 2 * 8 * 3 * 2 * 9 * 2, index + 29238272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 2 + 9 + 2, product* 6 * 9 * 2 * 9 * 3 * 2 * 9 * 2, index + 29239296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 9 + 2, product* 8 * 6 * 3 * 2 * 4 * 2 * 9 * 2, index + 29242368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 9 + 2, product* 4 * 2 * 6 * 2 * 4 * 2 * 9 * 2, index + 29242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 9 + 2, product* 2 * 9 * 3 * 3 * 4 * 2 * 9 * 2, index + 29243392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 9 + 2, product* 2 * 7 * 6 * 4 * 4 * 2 * 9 * 2, index + 29244672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 9 + 2, product* 2 * 3 * 2 * 7 * 4 * 2 * 9 * 2, index + 29247232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 9 + 2, product* 6 * 3 * 3 * 2 * 6 * 2 * 9 * 2, index + 29262336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 9 + 2, product* 8 * 4 * 8 * 2 * 6 * 2 * 9 * 2, index + 29262848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 9 + 2, product* 2 * 7 * 8 * 3 * 6 * 2 * 9 * 2, index + 29263872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 9 + 2, product* 4 * 8 * 3 * 4 * 6 * 2 * 9 * 2, index + 29264384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 9 + 2, product* 2 * 3 * 4 * 6 * 6 * 2 * 9 * 2, index + 29266432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 2 + 9 + 2, product* 4 * 4 * 9 * 6 * 6 * 2 * 9 * 2, index + 29266944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 9 + 2, product* 4 * 2 * 2 * 8 * 6 * 2 * 9 * 2, index + 29268224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 2 + 9 + 2, product* 2 * 9 * 9 * 8 * 6 * 2 * 9 * 2, index + 29268992);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 9 + 2, product* 2 * 3 * 8 * 2 * 7 * 2 * 9 * 2, index + 29272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 9 + 2, product* 4 * 4 * 3 * 3 * 7 * 2 * 9 * 2, index + 29273344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 9 + 2, product* 2 * 7 * 4 * 3 * 7 * 2 * 9 * 2, index + 29273472);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 9 + 2, product* 8 * 6 * 3 * 4 * 7 * 2 * 9 * 2, index + 29274368);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 9 + 2, product* 2 * 7 * 6 * 6 * 7 * 2 * 9 * 2, index + 29276672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 9 + 2, product* 2 * 3 * 2 * 9 * 7 * 2 * 9 * 2, index + 29279232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 2 + 9 + 2, product* 4 * 4 * 7 * 9 * 7 * 2 * 9 * 2, index + 29279744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 9 + 2, product* 8 * 2 * 3 * 3 * 8 * 2 * 9 * 2, index + 29283328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2 + 9 + 2, product* 4 * 2 * 4 * 7 * 8 * 2 * 9 * 2, index + 29287424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 8 + 2 + 9 + 2, product* 6 * 3 * 9 * 7 * 8 * 2 * 9 * 2, index + 29287936);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 2 + 9 + 2, product* 2 * 7 * 4 * 9 * 8 * 2 * 9 * 2, index + 29289472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 2 + 9 + 2, product* 8 * 2 * 7 * 9 * 8 * 2 * 9 * 2, index + 29289728);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 9 + 2, product* 4 * 2 * 8 * 3 * 9 * 2 * 9 * 2, index + 29293824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 2 + 9 + 2, product* 6 * 3 * 3 * 4 * 9 * 2 * 9 * 2, index + 29294336);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 2 + 9 + 2, product* 4 * 6 * 6 * 7 * 9 * 2 * 9 * 2, index + 29297664);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 9 + 2, product* 4 * 6 * 2 * 3 * 2 * 3 * 9 * 2, index + 29323264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 9 + 2, product* 6 * 7 * 7 * 3 * 2 * 3 * 9 * 2, index + 29323776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 9 + 2, product* 8 * 8 * 2 * 4 * 2 * 3 * 9 * 2, index + 29324288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 9 + 2, product* 6 * 3 * 3 * 6 * 2 * 3 * 9 * 2, index + 29326336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 3 + 9 + 2, product* 8 * 4 * 8 * 6 * 2 * 3 * 9 * 2, index + 29326848);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 9 + 2, product* 4 * 8 * 3 * 8 * 2 * 3 * 9 * 2, index + 29328384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 3 + 9 + 2, product* 4 * 6 * 6 * 9 * 2 * 3 * 9 * 2, index + 29329664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 9 + 2, product* 4 * 2 * 2 * 2 * 3 * 3 * 9 * 2, index + 29332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 9 + 2, product* 6 * 3 * 7 * 2 * 3 * 3 * 9 * 2, index + 29332736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 9 + 2, product* 2 * 9 * 9 * 2 * 3 * 3 * 9 * 2, index + 29332992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 9 + 2, product* 2 * 7 * 2 * 4 * 3 * 3 * 9 * 2, index + 29334272);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 9 + 2, product* 4 * 2 * 6 * 8 * 3 * 3 * 9 * 2, index + 29338624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 9 + 2, product* 2 * 9 * 3 * 9 * 3 * 3 * 9 * 2, index + 29339392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 9 + 2, product* 4 * 6 * 4 * 2 * 4 * 3 * 9 * 2, index + 29342464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 9 + 2, product* 2 * 3 * 2 * 3 * 4 * 3 * 9 * 2, index + 29343232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3 + 9 + 2, product* 8 * 8 * 4 * 3 * 4 * 3 * 9 * 2, index + 29343488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 9 + 2, product* 4 * 4 * 7 * 3 * 4 * 3 * 9 * 2, index + 29343744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 9 + 2, product* 8 * 2 * 3 * 7 * 4 * 3 * 9 * 2, index + 29347328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 9 + 2, product* 2 * 3 * 4 * 2 * 6 * 3 * 9 * 2, index + 29362432);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 9 + 2, product* 8 * 6 * 9 * 3 * 6 * 3 * 9 * 2, index + 29363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 9 + 2, product* 4 * 2 * 2 * 4 * 6 * 3 * 9 * 2, index + 29364224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 3 + 9 + 2, product* 6 * 3 * 7 * 4 * 6 * 3 * 9 * 2, index + 29364736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 6 + 3 + 9 + 2, product* 2 * 9 * 9 * 4 * 6 * 3 * 9 * 2, index + 29364992);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 3 + 9 + 2, product* 2 * 3 * 8 * 8 * 6 * 3 * 9 * 2, index + 29368832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 9 + 2, product* 2 * 7 * 6 * 2 * 7 * 3 * 9 * 2, index + 29372672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 9 + 2, product* 6 * 3 * 7 * 2 * 7 * 3 * 9 * 2, index + 29372736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3 + 9 + 2, product* 8 * 2 * 9 * 2 * 7 * 3 * 9 * 2, index + 29372928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 7 + 3 + 9 + 2, product* 6 * 9 * 6 * 3 * 7 * 3 * 9 * 2, index + 29373696);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 9 + 2, product* 4 * 2 * 4 * 3 * 8 * 3 * 9 * 2, index + 29383424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 3 + 9 + 2, product* 6 * 3 * 9 * 3 * 8 * 3 * 9 * 2, index + 29383936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 3 + 9 + 2, product* 8 * 4 * 4 * 4 * 8 * 3 * 9 * 2, index + 29384448);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 9 + 2, product* 4 * 8 * 3 * 2 * 9 * 3 * 9 * 2, index + 29392384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 9 + 2, product* 2 * 3 * 4 * 4 * 9 * 3 * 9 * 2, index + 29394432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 9 + 2, product* 6 * 3 * 3 * 2 * 2 * 4 * 9 * 2, index + 29422336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 9 + 2, product* 2 * 7 * 8 * 3 * 2 * 4 * 9 * 2, index + 29423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 9 + 2, product* 4 * 8 * 3 * 4 * 2 * 4 * 9 * 2, index + 29424384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 9 + 2, product* 2 * 3 * 4 * 6 * 2 * 4 * 9 * 2, index + 29426432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 9 + 2, product* 4 * 2 * 2 * 8 * 2 * 4 * 9 * 2, index + 29428224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4 + 9 + 2, product* 6 * 3 * 7 * 8 * 2 * 4 * 9 * 2, index + 29428736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4 + 9 + 2, product* 8 * 4 * 2 * 9 * 2 * 4 * 9 * 2, index + 29429248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 9 + 2, product* 2 * 3 * 8 * 2 * 3 * 4 * 9 * 2, index + 29432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 9 + 2, product* 4 * 4 * 3 * 3 * 3 * 4 * 9 * 2, index + 29433344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 9 + 2, product* 4 * 2 * 6 * 4 * 3 * 4 * 9 * 2, index + 29434624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 4 + 9 + 2, product* 2 * 7 * 6 * 6 * 3 * 4 * 9 * 2, index + 29436672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 9 + 2, product* 2 * 3 * 2 * 9 * 3 * 4 * 9 * 2, index + 29439232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 9 + 2, product* 8 * 2 * 3 * 3 * 4 * 4 * 9 * 2, index + 29443328);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 4 + 9 + 2, product* 8 * 2 * 7 * 9 * 4 * 4 * 9 * 2, index + 29449728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 9 + 2, product* 2 * 7 * 2 * 2 * 6 * 4 * 9 * 2, index + 29462272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 9 + 2, product* 2 * 3 * 8 * 4 * 6 * 4 * 9 * 2, index + 29464832);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 4 + 9 + 2, product* 6 * 9 * 4 * 2 * 8 * 4 * 9 * 2, index + 29482496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 4 + 9 + 2, product* 4 * 6 * 2 * 3 * 8 * 4 * 9 * 2, index + 29483264);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 4 + 9 + 2, product* 4 * 8 * 3 * 8 * 8 * 4 * 9 * 2, index + 29488384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 9 + 2, product* 4 * 2 * 2 * 2 * 9 * 4 * 9 * 2, index + 29492224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 4 + 9 + 2, product* 2 * 9 * 9 * 2 * 9 * 4 * 9 * 2, index + 29492992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4 + 9 + 2, product* 8 * 4 * 2 * 3 * 9 * 4 * 9 * 2, index + 29493248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4 + 9 + 2, product* 2 * 7 * 2 * 4 * 9 * 4 * 9 * 2, index + 29494272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 4 + 9 + 2, product* 4 * 4 * 3 * 7 * 9 * 4 * 9 * 2, index + 29497344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 9 + 2, product* 2 * 7 * 2 * 2 * 2 * 6 * 9 * 2, index + 29622272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 9 + 2, product* 6 * 9 * 2 * 3 * 2 * 6 * 9 * 2, index + 29623296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 9 + 2, product* 2 * 3 * 8 * 4 * 2 * 6 * 9 * 2, index + 29624832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 9 + 2, product* 4 * 2 * 6 * 6 * 2 * 6 * 9 * 2, index + 29626624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 9 + 2, product* 2 * 9 * 3 * 7 * 2 * 6 * 9 * 2, index + 29627392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 6 + 9 + 2, product* 8 * 2 * 9 * 8 * 2 * 6 * 9 * 2, index + 29628928);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 9 + 2, product* 4 * 2 * 4 * 9 * 3 * 6 * 9 * 2, index + 29639424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 9 + 2, product* 4 * 6 * 2 * 3 * 4 * 6 * 9 * 2, index + 29643264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 9 + 2, product* 6 * 3 * 3 * 6 * 4 * 6 * 9 * 2, index + 29646336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 6 + 9 + 2, product* 4 * 8 * 3 * 8 * 4 * 6 * 9 * 2, index + 29648384);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 9 + 2, product* 2 * 3 * 2 * 3 * 6 * 6 * 9 * 2, index + 29663232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 9 + 2, product* 4 * 4 * 7 * 3 * 6 * 6 * 9 * 2, index + 29663744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 6 + 9 + 2, product* 8 * 2 * 3 * 7 * 6 * 6 * 9 * 2, index + 29667328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 9 + 2, product* 8 * 4 * 4 * 2 * 7 * 6 * 9 * 2, index + 29672448);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 9 + 2, product* 2 * 3 * 4 * 2 * 8 * 6 * 9 * 2, index + 29682432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 9 + 2, product* 4 * 2 * 2 * 4 * 8 * 6 * 9 * 2, index + 29684224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 9 + 2, product* 2 * 7 * 2 * 6 * 8 * 6 * 9 * 2, index + 29686272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 9 + 2, product* 4 * 2 * 6 * 2 * 2 * 7 * 9 * 2, index + 29722624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 9 + 2, product* 2 * 9 * 3 * 3 * 2 * 7 * 9 * 2, index + 29723392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 7 + 9 + 2, product* 8 * 4 * 6 * 3 * 2 * 7 * 9 * 2, index + 29723648);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 7 + 9 + 2, product* 6 * 7 * 9 * 6 * 2 * 7 * 9 * 2, index + 29726976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 9 + 2, product* 2 * 3 * 2 * 7 * 2 * 7 * 9 * 2, index + 29727232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 9 + 2, product* 6 * 9 * 2 * 7 * 2 * 7 * 9 * 2, index + 29727296);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 7 + 9 + 2, product* 6 * 7 * 3 * 3 * 3 * 7 * 9 * 2, index + 29733376);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 7 + 9 + 2, product* 8 * 4 * 4 * 6 * 3 * 7 * 9 * 2, index + 29736448);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 9 + 2, product* 6 * 3 * 3 * 2 * 4 * 7 * 9 * 2, index + 29742336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 9 + 2, product* 4 * 2 * 2 * 8 * 4 * 7 * 9 * 2, index + 29748224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 7 + 9 + 2, product* 8 * 4 * 2 * 9 * 4 * 7 * 9 * 2, index + 29749248);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 7 + 9 + 2, product* 6 * 3 * 9 * 7 * 6 * 7 * 9 * 2, index + 29767936);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 7 + 9 + 2, product* 8 * 8 * 2 * 2 * 7 * 7 * 9 * 2, index + 29772288);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 9 + 2, product* 2 * 7 * 2 * 2 * 8 * 7 * 9 * 2, index + 29782272);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 7 + 9 + 2, product* 2 * 3 * 6 * 7 * 9 * 7 * 9 * 2, index + 29797632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 7 + 9 + 2, product* 4 * 2 * 4 * 9 * 9 * 7 * 9 * 2, index + 29799424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 9 + 2, product* 4 * 6 * 4 * 2 * 2 * 8 * 9 * 2, index + 29822464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 8 + 9 + 2, product* 6 * 7 * 9 * 2 * 2 * 8 * 9 * 2, index + 29822976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 9 + 2, product* 2 * 3 * 2 * 3 * 2 * 8 * 9 * 2, index + 29823232);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 9 + 2, product* 8 * 2 * 7 * 3 * 3 * 8 * 9 * 2, index + 29833728);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 8 + 9 + 2, product* 8 * 8 * 2 * 6 * 3 * 8 * 9 * 2, index + 29836288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 9 + 2, product* 4 * 2 * 8 * 7 * 3 * 8 * 9 * 2, index + 29837824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 9 + 2, product* 2 * 3 * 4 * 2 * 4 * 8 * 9 * 2, index + 29842432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 9 + 2, product* 4 * 4 * 9 * 2 * 4 * 8 * 9 * 2, index + 29842944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 9 + 2, product* 4 * 2 * 2 * 4 * 4 * 8 * 9 * 2, index + 29844224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 9 + 2, product* 4 * 2 * 4 * 3 * 6 * 8 * 9 * 2, index + 29863424);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 9 + 2, product* 4 * 2 * 2 * 6 * 7 * 8 * 9 * 2, index + 29876224);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 8 + 9 + 2, product* 4 * 8 * 7 * 8 * 7 * 8 * 9 * 2, index + 29878784);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 8 + 9 + 2, product* 8 * 6 * 3 * 2 * 8 * 8 * 9 * 2, index + 29882368);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 9 + 2, product* 2 * 3 * 2 * 7 * 8 * 8 * 9 * 2, index + 29887232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 9 + 2, product* 8 * 2 * 3 * 3 * 2 * 9 * 9 * 2, index + 29923328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 9 + 9 + 2, product* 4 * 6 * 8 * 4 * 2 * 9 * 9 * 2, index + 29924864);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 9 + 9 + 2, product* 6 * 3 * 9 * 7 * 2 * 9 * 9 * 2, index + 29927936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 9 + 9 + 2, product* 8 * 4 * 4 * 8 * 2 * 9 * 9 * 2, index + 29928448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9 + 9 + 2, product* 2 * 7 * 4 * 9 * 2 * 9 * 9 * 2, index + 29929472);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 9 + 2, product* 4 * 2 * 8 * 3 * 3 * 9 * 9 * 2, index + 29933824);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 9 + 2, product* 2 * 7 * 2 * 2 * 4 * 9 * 9 * 2, index + 29942272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 9 + 2, product* 2 * 3 * 8 * 4 * 4 * 9 * 9 * 2, index + 29944832);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 9 + 9 + 2, product* 6 * 3 * 7 * 2 * 7 * 9 * 9 * 2, index + 29972736);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 9 + 9 + 2, product* 4 * 4 * 3 * 7 * 7 * 9 * 9 * 2, index + 29977344);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 9 + 9 + 2, product* 2 * 7 * 4 * 3 * 9 * 9 * 9 * 2, index + 29993472);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 2 + 3, product* 4 * 6 * 4 * 2 * 2 * 2 * 2 * 3, index + 32222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 2 + 3, product* 6 * 7 * 9 * 2 * 2 * 2 * 2 * 3, index + 32222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 2 + 3, product* 2 * 3 * 2 * 3 * 2 * 2 * 2 * 3, index + 32223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 2 + 3, product* 8 * 8 * 4 * 3 * 2 * 2 * 2 * 3, index + 32223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 2 + 3, product* 4 * 4 * 7 * 3 * 2 * 2 * 2 * 3, index + 32223744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 2 + 3, product* 8 * 6 * 7 * 4 * 2 * 2 * 2 * 3, index + 32224768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 2 + 3, product* 8 * 2 * 3 * 7 * 2 * 2 * 2 * 3, index + 32227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 2 + 3, product* 4 * 6 * 8 * 8 * 2 * 2 * 2 * 3, index + 32228864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 2 + 3, product* 6 * 7 * 3 * 9 * 2 * 2 * 2 * 3, index + 32229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 2 + 3, product* 2 * 3 * 6 * 9 * 2 * 2 * 2 * 3, index + 32229632);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 2 + 2 + 2 + 3, product* 8 * 8 * 8 * 9 * 2 * 2 * 2 * 3, index + 32229888);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 2 + 3, product* 8 * 4 * 4 * 2 * 3 * 2 * 2 * 3, index + 32232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 2 + 3, product* 2 * 7 * 4 * 3 * 3 * 2 * 2 * 3, index + 32233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 2 + 3, product* 8 * 2 * 7 * 3 * 3 * 2 * 2 * 3, index + 32233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 2 + 3, product* 4 * 8 * 9 * 3 * 3 * 2 * 2 * 3, index + 32233984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 2 + 3, product* 8 * 8 * 2 * 6 * 3 * 2 * 2 * 3, index + 32236288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 2 + 3, product* 4 * 2 * 8 * 7 * 3 * 2 * 2 * 3, index + 32237824);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 2 + 2 + 3, product* 8 * 4 * 8 * 8 * 3 * 2 * 2 * 3, index + 32238848);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 2 + 3, product* 2 * 7 * 8 * 9 * 3 * 2 * 2 * 3, index + 32239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 2 + 3, product* 2 * 3 * 4 * 2 * 4 * 2 * 2 * 3, index + 32242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 2 + 3, product* 8 * 8 * 6 * 2 * 4 * 2 * 2 * 3, index + 32242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 2 + 3, product* 4 * 4 * 9 * 2 * 4 * 2 * 2 * 3, index + 32242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 2 + 3, product* 4 * 2 * 2 * 4 * 4 * 2 * 2 * 3, index + 32244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 2 + 3, product* 6 * 3 * 7 * 4 * 4 * 2 * 2 * 3, index + 32244736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 2 + 3, product* 2 * 9 * 9 * 4 * 4 * 2 * 2 * 3, index + 32244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 2 + 3, product* 2 * 7 * 2 * 6 * 4 * 2 * 2 * 3, index + 32246272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 2 + 2 + 3, product* 4 * 8 * 7 * 6 * 4 * 2 * 2 * 3, index + 32246784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 2 + 3, product* 2 * 3 * 8 * 8 * 4 * 2 * 2 * 3, index + 32248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 2 + 3, product* 4 * 4 * 3 * 9 * 4 * 2 * 2 * 3, index + 32249344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 2 + 3, product* 2 * 7 * 2 * 2 * 6 * 2 * 2 * 3, index + 32262272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 2 + 3, product* 4 * 2 * 4 * 3 * 6 * 2 * 2 * 3, index + 32263424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2 + 2 + 3, product* 6 * 3 * 9 * 3 * 6 * 2 * 2 * 3, index + 32263936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 2 + 3, product* 8 * 4 * 4 * 4 * 6 * 2 * 2 * 3, index + 32264448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 2 + 3, product* 4 * 6 * 2 * 7 * 6 * 2 * 2 * 3, index + 32267264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 2 + 2 + 3, product* 6 * 7 * 7 * 7 * 6 * 2 * 2 * 3, index + 32267776);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 2 + 3, product* 4 * 2 * 8 * 9 * 6 * 2 * 2 * 3, index + 32269824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 2 + 3, product* 4 * 8 * 3 * 2 * 7 * 2 * 2 * 3, index + 32272384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 2 + 3, product* 6 * 9 * 8 * 2 * 7 * 2 * 2 * 3, index + 32272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 2 + 3, product* 4 * 6 * 6 * 3 * 7 * 2 * 2 * 3, index + 32273664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 2 + 3, product* 2 * 3 * 4 * 4 * 7 * 2 * 2 * 3, index + 32274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 2 + 3, product* 4 * 4 * 9 * 4 * 7 * 2 * 2 * 3, index + 32274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 2 + 3, product* 4 * 2 * 2 * 6 * 7 * 2 * 2 * 3, index + 32276224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 2 + 2 + 3, product* 2 * 9 * 9 * 6 * 7 * 2 * 2 * 3, index + 32276992);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 2 + 3, product* 2 * 7 * 2 * 8 * 7 * 2 * 2 * 3, index + 32278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 2 + 3, product* 8 * 6 * 3 * 2 * 8 * 2 * 2 * 3, index + 32282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 2 + 3, product* 4 * 2 * 6 * 2 * 8 * 2 * 2 * 3, index + 32282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 2 + 3, product* 2 * 9 * 3 * 3 * 8 * 2 * 2 * 3, index + 32283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 2 + 3, product* 8 * 4 * 6 * 3 * 8 * 2 * 2 * 3, index + 32283648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 2 + 3, product* 2 * 7 * 6 * 4 * 8 * 2 * 2 * 3, index + 32284672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 2 + 3, product* 8 * 2 * 9 * 4 * 8 * 2 * 2 * 3, index + 32284928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 2 + 3, product* 4 * 6 * 4 * 6 * 8 * 2 * 2 * 3, index + 32286464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 8 + 2 + 2 + 3, product* 6 * 7 * 9 * 6 * 8 * 2 * 2 * 3, index + 32286976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 2 + 3, product* 2 * 3 * 2 * 7 * 8 * 2 * 2 * 3, index + 32287232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 2 + 2 + 3, product* 4 * 4 * 7 * 7 * 8 * 2 * 2 * 3, index + 32287744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8 + 2 + 2 + 3, product* 8 * 6 * 7 * 8 * 8 * 2 * 2 * 3, index + 32288768);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 2 + 3, product* 4 * 6 * 8 * 2 * 9 * 2 * 2 * 3, index + 32292864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 2 + 3, product* 6 * 7 * 3 * 3 * 9 * 2 * 2 * 3, index + 32293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 2 + 3, product* 2 * 3 * 6 * 3 * 9 * 2 * 2 * 3, index + 32293632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 2 + 3, product* 2 * 7 * 4 * 7 * 9 * 2 * 2 * 3, index + 32297472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 2 + 2 + 3, product* 8 * 2 * 7 * 7 * 9 * 2 * 2 * 3, index + 32297728);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 2 + 2 + 3, product* 6 * 9 * 4 * 8 * 9 * 2 * 2 * 3, index + 32298496);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 2 + 2 + 3, product* 4 * 6 * 2 * 9 * 9 * 2 * 2 * 3, index + 32299264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 2 + 3, product* 8 * 2 * 3 * 3 * 2 * 3 * 2 * 3, index + 32323328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 2 + 3, product* 4 * 6 * 8 * 4 * 2 * 3 * 2 * 3, index + 32324864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 2 + 3, product* 4 * 2 * 4 * 7 * 2 * 3 * 2 * 3, index + 32327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 2 + 3, product* 6 * 3 * 9 * 7 * 2 * 3 * 2 * 3, index + 32327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 2 + 3, product* 8 * 4 * 4 * 8 * 2 * 3 * 2 * 3, index + 32328448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 2 + 3, product* 2 * 7 * 4 * 9 * 2 * 3 * 2 * 3, index + 32329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 2 + 3, product* 8 * 2 * 7 * 9 * 2 * 3 * 2 * 3, index + 32329728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 3 + 2 + 3, product* 4 * 8 * 9 * 9 * 2 * 3 * 2 * 3, index + 32329984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 2 + 3, product* 8 * 8 * 2 * 2 * 3 * 3 * 2 * 3, index + 32332288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 2 + 3, product* 4 * 2 * 8 * 3 * 3 * 3 * 2 * 3, index + 32333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 2 + 3, product* 6 * 3 * 3 * 4 * 3 * 3 * 2 * 3, index + 32334336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 2 + 3, product* 4 * 8 * 3 * 6 * 3 * 3 * 2 * 3, index + 32336384);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 3 + 3 + 2 + 3, product* 6 * 9 * 8 * 6 * 3 * 3 * 2 * 3, index + 32336896);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 2 + 3, product* 2 * 3 * 4 * 8 * 3 * 3 * 2 * 3, index + 32338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 2 + 3, product* 2 * 7 * 2 * 2 * 4 * 3 * 2 * 3, index + 32342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 2 + 3, product* 4 * 8 * 7 * 2 * 4 * 3 * 2 * 3, index + 32342784);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 2 + 3, product* 2 * 3 * 2 * 3 * 4 * 3 * 2 * 3, index + 32343232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 2 + 3, product* 6 * 9 * 2 * 3 * 4 * 3 * 2 * 3, index + 32343296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 2 + 3, product* 2 * 3 * 8 * 4 * 4 * 3 * 2 * 3, index + 32344832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 2 + 3, product* 4 * 2 * 6 * 6 * 4 * 3 * 2 * 3, index + 32346624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 2 + 3, product* 2 * 9 * 3 * 7 * 4 * 3 * 2 * 3, index + 32347392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 3 + 2 + 3, product* 2 * 7 * 6 * 8 * 4 * 3 * 2 * 3, index + 32348672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 2 + 3, product* 8 * 2 * 9 * 8 * 4 * 3 * 2 * 3, index + 32348928);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 2 + 3, product* 6 * 9 * 4 * 2 * 6 * 3 * 2 * 3, index + 32362496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 2 + 3, product* 4 * 6 * 2 * 3 * 6 * 3 * 2 * 3, index + 32363264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 2 + 3, product* 8 * 8 * 2 * 4 * 6 * 3 * 2 * 3, index + 32364288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 2 + 3, product* 6 * 3 * 3 * 6 * 6 * 3 * 2 * 3, index + 32366336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3 + 2 + 3, product* 4 * 8 * 3 * 8 * 6 * 3 * 2 * 3, index + 32368384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 6 + 3 + 2 + 3, product* 6 * 9 * 8 * 8 * 6 * 3 * 2 * 3, index + 32368896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 2 + 3, product* 4 * 2 * 2 * 2 * 7 * 3 * 2 * 3, index + 32372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 2 + 3, product* 6 * 3 * 7 * 2 * 7 * 3 * 2 * 3, index + 32372736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 2 + 3, product* 2 * 9 * 9 * 2 * 7 * 3 * 2 * 3, index + 32372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 2 + 3, product* 8 * 4 * 2 * 3 * 7 * 3 * 2 * 3, index + 32373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 2 + 3, product* 2 * 7 * 2 * 4 * 7 * 3 * 2 * 3, index + 32374272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3 + 2 + 3, product* 2 * 3 * 8 * 6 * 7 * 3 * 2 * 3, index + 32376832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 2 + 3, product* 4 * 4 * 3 * 7 * 7 * 3 * 2 * 3, index + 32377344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 2 + 3, product* 2 * 9 * 3 * 9 * 7 * 3 * 2 * 3, index + 32379392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 2 + 3, product* 4 * 6 * 4 * 2 * 8 * 3 * 2 * 3, index + 32382464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 2 + 3, product* 2 * 3 * 2 * 3 * 8 * 3 * 2 * 3, index + 32383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 2 + 3, product* 8 * 8 * 4 * 3 * 8 * 3 * 2 * 3, index + 32383488);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 8 + 3 + 2 + 3, product* 8 * 6 * 7 * 4 * 8 * 3 * 2 * 3, index + 32384768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 2 + 3, product* 8 * 2 * 3 * 7 * 8 * 3 * 2 * 3, index + 32387328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3 + 2 + 3, product* 2 * 3 * 6 * 9 * 8 * 3 * 2 * 3, index + 32389632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 2 + 3, product* 8 * 4 * 4 * 2 * 9 * 3 * 2 * 3, index + 32392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 2 + 3, product* 2 * 7 * 4 * 3 * 9 * 3 * 2 * 3, index + 32393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 2 + 3, product* 8 * 2 * 7 * 3 * 9 * 3 * 2 * 3, index + 32393728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 2 + 3, product* 4 * 2 * 8 * 7 * 9 * 3 * 2 * 3, index + 32397824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3 + 2 + 3, product* 6 * 3 * 3 * 8 * 9 * 3 * 2 * 3, index + 32398336);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 2 + 3, product* 4 * 2 * 4 * 3 * 2 * 4 * 2 * 3, index + 32423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 2 + 3, product* 6 * 3 * 9 * 3 * 2 * 4 * 2 * 3, index + 32423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 2 + 3, product* 8 * 4 * 4 * 4 * 2 * 4 * 2 * 3, index + 32424448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 4 + 2 + 3, product* 6 * 9 * 4 * 6 * 2 * 4 * 2 * 3, index + 32426496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 2 + 3, product* 4 * 6 * 2 * 7 * 2 * 4 * 2 * 3, index + 32427264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 4 + 2 + 3, product* 6 * 7 * 7 * 7 * 2 * 4 * 2 * 3, index + 32427776);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 2 + 3, product* 8 * 8 * 2 * 8 * 2 * 4 * 2 * 3, index + 32428288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 2 + 3, product* 4 * 2 * 8 * 9 * 2 * 4 * 2 * 3, index + 32429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 2 + 3, product* 4 * 8 * 3 * 2 * 3 * 4 * 2 * 3, index + 32432384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 2 + 3, product* 4 * 6 * 6 * 3 * 3 * 4 * 2 * 3, index + 32433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 2 + 3, product* 2 * 3 * 4 * 4 * 3 * 4 * 2 * 3, index + 32434432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 4 + 2 + 3, product* 8 * 8 * 6 * 4 * 3 * 4 * 2 * 3, index + 32434688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 4 + 2 + 3, product* 4 * 4 * 9 * 4 * 3 * 4 * 2 * 3, index + 32434944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 2 + 3, product* 4 * 2 * 2 * 6 * 3 * 4 * 2 * 3, index + 32436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 2 + 3, product* 6 * 3 * 7 * 6 * 3 * 4 * 2 * 3, index + 32436736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 2 + 3, product* 8 * 4 * 2 * 7 * 3 * 4 * 2 * 3, index + 32437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 2 + 3, product* 2 * 7 * 2 * 8 * 3 * 4 * 2 * 3, index + 32438272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 4 + 2 + 3, product* 6 * 9 * 2 * 9 * 3 * 4 * 2 * 3, index + 32439296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 2 + 3, product* 8 * 6 * 3 * 2 * 4 * 4 * 2 * 3, index + 32442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 2 + 3, product* 4 * 2 * 6 * 2 * 4 * 4 * 2 * 3, index + 32442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 2 + 3, product* 2 * 9 * 3 * 3 * 4 * 4 * 2 * 3, index + 32443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 2 + 3, product* 8 * 4 * 6 * 3 * 4 * 4 * 2 * 3, index + 32443648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 2 + 3, product* 2 * 7 * 6 * 4 * 4 * 4 * 2 * 3, index + 32444672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 2 + 3, product* 4 * 6 * 4 * 6 * 4 * 4 * 2 * 3, index + 32446464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 4 + 2 + 3, product* 6 * 7 * 9 * 6 * 4 * 4 * 2 * 3, index + 32446976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 2 + 3, product* 2 * 3 * 2 * 7 * 4 * 4 * 2 * 3, index + 32447232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 4 + 2 + 3, product* 4 * 4 * 7 * 7 * 4 * 4 * 2 * 3, index + 32447744);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 2 + 3, product* 6 * 3 * 3 * 2 * 6 * 4 * 2 * 3, index + 32462336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 2 + 3, product* 2 * 7 * 8 * 3 * 6 * 4 * 2 * 3, index + 32463872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 2 + 3, product* 4 * 8 * 3 * 4 * 6 * 4 * 2 * 3, index + 32464384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 2 + 3, product* 2 * 3 * 4 * 6 * 6 * 4 * 2 * 3, index + 32466432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 2 + 3, product* 4 * 2 * 2 * 8 * 6 * 4 * 2 * 3, index + 32468224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 2 + 3, product* 8 * 4 * 2 * 9 * 6 * 4 * 2 * 3, index + 32469248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 2 + 3, product* 2 * 3 * 8 * 2 * 7 * 4 * 2 * 3, index + 32472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 2 + 3, product* 4 * 4 * 3 * 3 * 7 * 4 * 2 * 3, index + 32473344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 4 + 2 + 3, product* 8 * 6 * 3 * 4 * 7 * 4 * 2 * 3, index + 32474368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 2 + 3, product* 4 * 2 * 6 * 4 * 7 * 4 * 2 * 3, index + 32474624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 2 + 3, product* 2 * 7 * 6 * 6 * 7 * 4 * 2 * 3, index + 32476672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 2 + 3, product* 2 * 3 * 2 * 9 * 7 * 4 * 2 * 3, index + 32479232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 4 + 2 + 3, product* 4 * 4 * 7 * 9 * 7 * 4 * 2 * 3, index + 32479744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 2 + 3, product* 8 * 2 * 3 * 3 * 8 * 4 * 2 * 3, index + 32483328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 2 + 3, product* 4 * 2 * 4 * 7 * 8 * 4 * 2 * 3, index + 32487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 2 + 3, product* 2 * 7 * 4 * 9 * 8 * 4 * 2 * 3, index + 32489472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4 + 2 + 3, product* 8 * 8 * 2 * 2 * 9 * 4 * 2 * 3, index + 32492288);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 4 + 2 + 3, product* 4 * 8 * 3 * 6 * 9 * 4 * 2 * 3, index + 32496384);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 2 + 3, product* 6 * 3 * 3 * 2 * 2 * 6 * 2 * 3, index + 32622336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 2 + 3, product* 2 * 3 * 2 * 3 * 2 * 6 * 2 * 3, index + 32623232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 2 + 3, product* 2 * 7 * 8 * 3 * 2 * 6 * 2 * 3, index + 32623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 2 + 3, product* 4 * 8 * 3 * 4 * 2 * 6 * 2 * 3, index + 32624384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 2 + 3, product* 6 * 9 * 8 * 4 * 2 * 6 * 2 * 3, index + 32624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 2 + 3, product* 2 * 3 * 4 * 6 * 2 * 6 * 2 * 3, index + 32626432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 2 + 3, product* 4 * 2 * 2 * 8 * 2 * 6 * 2 * 3, index + 32628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 2 + 3, product* 6 * 3 * 7 * 8 * 2 * 6 * 2 * 3, index + 32628736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 6 + 2 + 3, product* 8 * 4 * 2 * 9 * 2 * 6 * 2 * 3, index + 32629248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 2 + 3, product* 2 * 3 * 8 * 2 * 3 * 6 * 2 * 3, index + 32632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 2 + 3, product* 4 * 4 * 3 * 3 * 3 * 6 * 2 * 3, index + 32633344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 6 + 2 + 3, product* 8 * 6 * 3 * 4 * 3 * 6 * 2 * 3, index + 32634368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 2 + 3, product* 4 * 2 * 6 * 4 * 3 * 6 * 2 * 3, index + 32634624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 2 + 3, product* 2 * 7 * 6 * 6 * 3 * 6 * 2 * 3, index + 32636672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6 + 2 + 3, product* 4 * 6 * 4 * 8 * 3 * 6 * 2 * 3, index + 32638464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 2 + 3, product* 2 * 3 * 2 * 9 * 3 * 6 * 2 * 3, index + 32639232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 2 + 3, product* 8 * 2 * 3 * 3 * 4 * 6 * 2 * 3, index + 32643328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 6 + 2 + 3, product* 4 * 6 * 8 * 4 * 4 * 6 * 2 * 3, index + 32644864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 2 + 3, product* 4 * 2 * 4 * 7 * 4 * 6 * 2 * 3, index + 32647424);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 6 + 2 + 3, product* 4 * 8 * 9 * 9 * 4 * 6 * 2 * 3, index + 32649984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 2 + 3, product* 2 * 7 * 2 * 2 * 6 * 6 * 2 * 3, index + 32662272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 2 + 3, product* 6 * 9 * 2 * 3 * 6 * 6 * 2 * 3, index + 32663296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 2 + 3, product* 2 * 3 * 8 * 4 * 6 * 6 * 2 * 3, index + 32664832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 2 + 3, product* 4 * 2 * 6 * 6 * 6 * 6 * 2 * 3, index + 32666624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 2 + 3, product* 2 * 9 * 3 * 7 * 6 * 6 * 2 * 3, index + 32667392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 6 + 2 + 3, product* 8 * 4 * 6 * 7 * 6 * 6 * 2 * 3, index + 32667648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 6 + 2 + 3, product* 2 * 7 * 6 * 8 * 6 * 6 * 2 * 3, index + 32668672);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 6 + 2 + 3, product* 4 * 6 * 8 * 6 * 7 * 6 * 2 * 3, index + 32676864);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 2 + 3, product* 4 * 6 * 2 * 3 * 8 * 6 * 2 * 3, index + 32683264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 2 + 3, product* 4 * 2 * 2 * 2 * 9 * 6 * 2 * 3, index + 32692224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 2 + 3, product* 8 * 4 * 2 * 3 * 9 * 6 * 2 * 3, index + 32693248);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 2 + 3, product* 2 * 3 * 8 * 6 * 9 * 6 * 2 * 3, index + 32696832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 6 + 2 + 3, product* 4 * 4 * 3 * 7 * 9 * 6 * 2 * 3, index + 32697344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 6 + 2 + 3, product* 4 * 2 * 6 * 8 * 9 * 6 * 2 * 3, index + 32698624);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 2 + 3, product* 2 * 3 * 4 * 2 * 2 * 7 * 2 * 3, index + 32722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 2 + 3, product* 4 * 4 * 9 * 2 * 2 * 7 * 2 * 3, index + 32722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 2 + 3, product* 4 * 2 * 2 * 4 * 2 * 7 * 2 * 3, index + 32724224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7 + 2 + 3, product* 6 * 3 * 7 * 4 * 2 * 7 * 2 * 3, index + 32724736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 2 + 3, product* 2 * 9 * 9 * 4 * 2 * 7 * 2 * 3, index + 32724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 2 + 3, product* 2 * 7 * 2 * 6 * 2 * 7 * 2 * 3, index + 32726272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7 + 2 + 3, product* 4 * 8 * 7 * 6 * 2 * 7 * 2 * 3, index + 32726784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 7 + 2 + 3, product* 6 * 9 * 2 * 7 * 2 * 7 * 2 * 3, index + 32727296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 2 + 3, product* 2 * 3 * 8 * 8 * 2 * 7 * 2 * 3, index + 32728832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 2 + 3, product* 4 * 4 * 3 * 9 * 2 * 7 * 2 * 3, index + 32729344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 2 + 3, product* 2 * 7 * 6 * 2 * 3 * 7 * 2 * 3, index + 32732672);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 2 + 3, product* 6 * 3 * 7 * 2 * 3 * 7 * 2 * 3, index + 32732736);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 2 + 3, product* 8 * 2 * 9 * 2 * 3 * 7 * 2 * 3, index + 32732928);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 2 + 3, product* 2 * 9 * 9 * 2 * 3 * 7 * 2 * 3, index + 32732992);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 7 + 2 + 3, product* 6 * 9 * 6 * 3 * 3 * 7 * 2 * 3, index + 32733696);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 2 + 3, product* 8 * 2 * 3 * 9 * 3 * 7 * 2 * 3, index + 32739328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 2 + 3, product* 4 * 2 * 4 * 3 * 4 * 7 * 2 * 3, index + 32743424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 7 + 2 + 3, product* 8 * 4 * 4 * 4 * 4 * 7 * 2 * 3, index + 32744448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 2 + 3, product* 4 * 6 * 2 * 7 * 4 * 7 * 2 * 3, index + 32747264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 2 + 3, product* 2 * 9 * 3 * 3 * 6 * 7 * 2 * 3, index + 32763392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 7 + 2 + 3, product* 2 * 7 * 6 * 4 * 6 * 7 * 2 * 3, index + 32764672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 7 + 2 + 3, product* 4 * 6 * 4 * 6 * 6 * 7 * 2 * 3, index + 32766464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 2 + 3, product* 2 * 3 * 2 * 7 * 6 * 7 * 2 * 3, index + 32767232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 2 + 3, product* 2 * 3 * 6 * 3 * 7 * 7 * 2 * 3, index + 32773632);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 7 + 2 + 3, product* 4 * 8 * 9 * 7 * 7 * 7 * 2 * 3, index + 32777984);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 7 + 7 + 2 + 3, product* 6 * 7 * 7 * 9 * 7 * 7 * 2 * 3, index + 32779776);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 2 + 3, product* 6 * 3 * 3 * 2 * 8 * 7 * 2 * 3, index + 32782336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 7 + 2 + 3, product* 4 * 8 * 3 * 4 * 8 * 7 * 2 * 3, index + 32784384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 2 + 3, product* 2 * 3 * 4 * 6 * 8 * 7 * 2 * 3, index + 32786432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 2 + 3, product* 4 * 2 * 2 * 8 * 8 * 7 * 2 * 3, index + 32788224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 2 + 3, product* 2 * 3 * 8 * 2 * 9 * 7 * 2 * 3, index + 32792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 2 + 3, product* 4 * 4 * 3 * 3 * 9 * 7 * 2 * 3, index + 32793344);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 9 + 7 + 2 + 3, product* 2 * 9 * 3 * 3 * 9 * 7 * 2 * 3, index + 32793392);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 9 + 7 + 2 + 3, product* 8 * 6 * 3 * 4 * 9 * 7 * 2 * 3, index + 32794368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 7 + 2 + 3, product* 4 * 2 * 6 * 4 * 9 * 7 * 2 * 3, index + 32794624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 7 + 2 + 3, product* 8 * 2 * 9 * 6 * 9 * 7 * 2 * 3, index + 32796928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 2 + 3, product* 2 * 3 * 2 * 9 * 9 * 7 * 2 * 3, index + 32799232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 2 + 3, product* 2 * 7 * 2 * 2 * 2 * 8 * 2 * 3, index + 32822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 2 + 3, product* 4 * 8 * 7 * 2 * 2 * 8 * 2 * 3, index + 32822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 2 + 3, product* 6 * 9 * 2 * 3 * 2 * 8 * 2 * 3, index + 32823296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 2 + 3, product* 2 * 3 * 8 * 4 * 2 * 8 * 2 * 3, index + 32824832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 2 + 3, product* 2 * 9 * 3 * 7 * 2 * 8 * 2 * 3, index + 32827392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 2 + 3, product* 8 * 4 * 6 * 7 * 2 * 8 * 2 * 3, index + 32827648);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 8 + 2 + 3, product* 8 * 6 * 7 * 2 * 3 * 8 * 2 * 3, index + 32832768);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 8 + 2 + 3, product* 4 * 6 * 8 * 6 * 3 * 8 * 2 * 3, index + 32836864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 2 + 3, product* 2 * 3 * 6 * 7 * 3 * 8 * 2 * 3, index + 32837632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8 + 2 + 3, product* 4 * 2 * 4 * 9 * 3 * 8 * 2 * 3, index + 32839424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 2 + 3, product* 4 * 6 * 2 * 3 * 4 * 8 * 2 * 3, index + 32843264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 2 + 3, product* 8 * 8 * 2 * 4 * 4 * 8 * 2 * 3, index + 32844288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 2 + 3, product* 6 * 3 * 3 * 6 * 4 * 8 * 2 * 3, index + 32846336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 8 + 2 + 3, product* 2 * 7 * 8 * 7 * 4 * 8 * 2 * 3, index + 32847872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 8 + 2 + 3, product* 4 * 8 * 3 * 8 * 4 * 8 * 2 * 3, index + 32848384);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 2 + 3, product* 4 * 6 * 4 * 2 * 6 * 8 * 2 * 3, index + 32862464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 2 + 3, product* 2 * 3 * 2 * 3 * 6 * 8 * 2 * 3, index + 32863232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8 + 2 + 3, product* 4 * 4 * 7 * 3 * 6 * 8 * 2 * 3, index + 32863744);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 8 + 2 + 3, product* 4 * 6 * 8 * 8 * 6 * 8 * 2 * 3, index + 32868864);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 8 + 2 + 3, product* 8 * 4 * 4 * 2 * 7 * 8 * 2 * 3, index + 32872448);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 8 + 2 + 3, product* 8 * 2 * 7 * 3 * 7 * 8 * 2 * 3, index + 32873728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 8 + 2 + 3, product* 4 * 8 * 9 * 3 * 7 * 8 * 2 * 3, index + 32873984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 8 + 2 + 3, product* 6 * 9 * 4 * 4 * 7 * 8 * 2 * 3, index + 32874496);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 8 + 2 + 3, product* 6 * 3 * 3 * 8 * 7 * 8 * 2 * 3, index + 32878336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 2 + 3, product* 2 * 3 * 4 * 2 * 8 * 8 * 2 * 3, index + 32882432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 2 + 3, product* 4 * 2 * 2 * 4 * 8 * 8 * 2 * 3, index + 32884224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 8 + 2 + 3, product* 6 * 3 * 7 * 4 * 8 * 8 * 2 * 3, index + 32884736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 8 + 2 + 3, product* 2 * 7 * 2 * 6 * 8 * 8 * 2 * 3, index + 32886272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 8 + 2 + 3, product* 4 * 4 * 3 * 9 * 8 * 8 * 2 * 3, index + 32889344);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 8 + 2 + 3, product* 4 * 6 * 4 * 4 * 9 * 8 * 2 * 3, index + 32894464);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 2 + 3, product* 8 * 6 * 3 * 2 * 2 * 9 * 2 * 3, index + 32922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 2 + 3, product* 4 * 2 * 6 * 2 * 2 * 9 * 2 * 3, index + 32922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 2 + 3, product* 2 * 9 * 3 * 3 * 2 * 9 * 2 * 3, index + 32923392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 9 + 2 + 3, product* 8 * 4 * 6 * 3 * 2 * 9 * 2 * 3, index + 32923648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 2 + 3, product* 2 * 7 * 6 * 4 * 2 * 9 * 2 * 3, index + 32924672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9 + 2 + 3, product* 8 * 2 * 9 * 4 * 2 * 9 * 2 * 3, index + 32924928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 2 + 3, product* 2 * 3 * 2 * 7 * 2 * 9 * 2 * 3, index + 32927232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 9 + 2 + 3, product* 4 * 6 * 8 * 2 * 3 * 9 * 2 * 3, index + 32932864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 9 + 2 + 3, product* 6 * 7 * 3 * 3 * 3 * 9 * 2 * 3, index + 32933376);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 9 + 2 + 3, product* 2 * 7 * 4 * 7 * 3 * 9 * 2 * 3, index + 32937472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 2 + 3, product* 8 * 2 * 7 * 7 * 3 * 9 * 2 * 3, index + 32937728);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3 + 9 + 2 + 3, product* 6 * 9 * 4 * 8 * 3 * 9 * 2 * 3, index + 32938496);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 2 + 3, product* 6 * 3 * 3 * 2 * 4 * 9 * 2 * 3, index + 32942336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 2 + 3, product* 4 * 8 * 3 * 4 * 4 * 9 * 2 * 3, index + 32944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 2 + 3, product* 2 * 3 * 4 * 6 * 4 * 9 * 2 * 3, index + 32946432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 2 + 3, product* 4 * 2 * 2 * 8 * 4 * 9 * 2 * 3, index + 32948224);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9 + 2 + 3, product* 8 * 2 * 3 * 3 * 6 * 9 * 2 * 3, index + 32963328);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 9 + 2 + 3, product* 8 * 2 * 7 * 9 * 6 * 9 * 2 * 3, index + 32969728);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 9 + 2 + 3, product* 4 * 2 * 8 * 3 * 7 * 9 * 2 * 3, index + 32973824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 2 + 3, product* 2 * 3 * 4 * 8 * 7 * 9 * 2 * 3, index + 32978432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 2 + 3, product* 2 * 7 * 2 * 2 * 8 * 9 * 2 * 3, index + 32982272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 9 + 2 + 3, product* 4 * 2 * 6 * 6 * 8 * 9 * 2 * 3, index + 32986624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 9 + 2 + 3, product* 2 * 9 * 3 * 7 * 8 * 9 * 2 * 3, index + 32987392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 9 + 2 + 3, product* 2 * 7 * 6 * 8 * 8 * 9 * 2 * 3, index + 32988672);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 9 + 2 + 3, product* 8 * 6 * 7 * 2 * 9 * 9 * 2 * 3, index + 32992768);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 9 + 9 + 2 + 3, product* 6 * 3 * 9 * 9 * 9 * 9 * 2 * 3, index + 32999936);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 3 + 3, product* 2 * 7 * 2 * 2 * 2 * 2 * 3 * 3, index + 33222272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 3 + 3, product* 4 * 2 * 4 * 3 * 2 * 2 * 3 * 3, index + 33223424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 3 + 3, product* 6 * 3 * 9 * 3 * 2 * 2 * 3 * 3, index + 33223936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 3 + 3, product* 8 * 4 * 4 * 4 * 2 * 2 * 3 * 3, index + 33224448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 2 + 3 + 3, product* 6 * 9 * 4 * 6 * 2 * 2 * 3 * 3, index + 33226496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 3 + 3, product* 4 * 6 * 2 * 7 * 2 * 2 * 3 * 3, index + 33227264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 2 + 3 + 3, product* 6 * 7 * 7 * 7 * 2 * 2 * 3 * 3, index + 33227776);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2 + 3 + 3, product* 8 * 8 * 2 * 8 * 2 * 2 * 3 * 3, index + 33228288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2 + 3 + 3, product* 4 * 2 * 8 * 9 * 2 * 2 * 3 * 3, index + 33229824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 3 + 3, product* 4 * 8 * 3 * 2 * 3 * 2 * 3 * 3, index + 33232384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 2 + 3 + 3, product* 6 * 9 * 8 * 2 * 3 * 2 * 3 * 3, index + 33232896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 3 + 3, product* 4 * 6 * 6 * 3 * 3 * 2 * 3 * 3, index + 33233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 3 + 3, product* 2 * 3 * 4 * 4 * 3 * 2 * 3 * 3, index + 33234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 3 + 3, product* 4 * 4 * 9 * 4 * 3 * 2 * 3 * 3, index + 33234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 3 + 3, product* 4 * 2 * 2 * 6 * 3 * 2 * 3 * 3, index + 33236224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 2 + 3 + 3, product* 6 * 3 * 7 * 6 * 3 * 2 * 3 * 3, index + 33236736);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 2 + 3 + 3, product* 2 * 9 * 9 * 6 * 3 * 2 * 3 * 3, index + 33236992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 3 + 3, product* 8 * 4 * 2 * 7 * 3 * 2 * 3 * 3, index + 33237248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 3 + 3, product* 2 * 7 * 2 * 8 * 3 * 2 * 3 * 3, index + 33238272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 2 + 3 + 3, product* 4 * 8 * 7 * 8 * 3 * 2 * 3 * 3, index + 33238784);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 3 + 3, product* 2 * 3 * 2 * 9 * 3 * 2 * 3 * 3, index + 33239232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 2 + 3 + 3, product* 6 * 9 * 2 * 9 * 3 * 2 * 3 * 3, index + 33239296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 3 + 3, product* 8 * 6 * 3 * 2 * 4 * 2 * 3 * 3, index + 33242368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 3 + 3, product* 4 * 2 * 6 * 2 * 4 * 2 * 3 * 3, index + 33242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 3 + 3, product* 2 * 9 * 3 * 3 * 4 * 2 * 3 * 3, index + 33243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 3 + 3, product* 8 * 4 * 6 * 3 * 4 * 2 * 3 * 3, index + 33243648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 3 + 3, product* 2 * 7 * 6 * 4 * 4 * 2 * 3 * 3, index + 33244672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 2 + 3 + 3, product* 4 * 6 * 4 * 6 * 4 * 2 * 3 * 3, index + 33246464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 3 + 3, product* 2 * 3 * 2 * 7 * 4 * 2 * 3 * 3, index + 33247232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 2 + 3 + 3, product* 8 * 8 * 4 * 7 * 4 * 2 * 3 * 3, index + 33247488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 2 + 3 + 3, product* 4 * 4 * 7 * 7 * 4 * 2 * 3 * 3, index + 33247744);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 2 + 3 + 3, product* 2 * 9 * 7 * 9 * 4 * 2 * 3 * 3, index + 33249792);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 3 + 3, product* 6 * 3 * 3 * 2 * 6 * 2 * 3 * 3, index + 33262336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 3 + 3, product* 8 * 4 * 8 * 2 * 6 * 2 * 3 * 3, index + 33262848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 3 + 3, product* 2 * 7 * 8 * 3 * 6 * 2 * 3 * 3, index + 33263872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 3 + 3, product* 4 * 8 * 3 * 4 * 6 * 2 * 3 * 3, index + 33264384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 3 + 3, product* 2 * 3 * 4 * 6 * 6 * 2 * 3 * 3, index + 33266432);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 6 + 2 + 3 + 3, product* 8 * 6 * 9 * 7 * 6 * 2 * 3 * 3, index + 33267968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 3 + 3, product* 4 * 2 * 2 * 8 * 6 * 2 * 3 * 3, index + 33268224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 2 + 3 + 3, product* 6 * 3 * 7 * 8 * 6 * 2 * 3 * 3, index + 33268736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 2 + 3 + 3, product* 2 * 9 * 9 * 8 * 6 * 2 * 3 * 3, index + 33268992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 2 + 3 + 3, product* 8 * 4 * 2 * 9 * 6 * 2 * 3 * 3, index + 33269248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 3 + 3, product* 2 * 3 * 8 * 2 * 7 * 2 * 3 * 3, index + 33272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 3 + 3, product* 4 * 4 * 3 * 3 * 7 * 2 * 3 * 3, index + 33273344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 3 + 3, product* 8 * 6 * 3 * 4 * 7 * 2 * 3 * 3, index + 33274368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 3 + 3, product* 4 * 2 * 6 * 4 * 7 * 2 * 3 * 3, index + 33274624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 2 + 3 + 3, product* 8 * 2 * 9 * 6 * 7 * 2 * 3 * 3, index + 33276928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 2 + 3 + 3, product* 4 * 6 * 4 * 8 * 7 * 2 * 3 * 3, index + 33278464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 3 + 3, product* 2 * 3 * 2 * 9 * 7 * 2 * 3 * 3, index + 33279232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7 + 2 + 3 + 3, product* 8 * 8 * 4 * 9 * 7 * 2 * 3 * 3, index + 33279488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 3 + 3, product* 8 * 2 * 3 * 3 * 8 * 2 * 3 * 3, index + 33283328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 2 + 3 + 3, product* 4 * 6 * 8 * 4 * 8 * 2 * 3 * 3, index + 33284864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2 + 3 + 3, product* 4 * 2 * 4 * 7 * 8 * 2 * 3 * 3, index + 33287424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 2 + 3 + 3, product* 8 * 4 * 4 * 8 * 8 * 2 * 3 * 3, index + 33288448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 2 + 3 + 3, product* 2 * 7 * 4 * 9 * 8 * 2 * 3 * 3, index + 33289472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 3 + 3, product* 8 * 8 * 2 * 2 * 9 * 2 * 3 * 3, index + 33292288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 3 + 3, product* 4 * 2 * 8 * 3 * 9 * 2 * 3 * 3, index + 33293824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 2 + 3 + 3, product* 6 * 3 * 3 * 4 * 9 * 2 * 3 * 3, index + 33294336);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 2 + 3 + 3, product* 8 * 4 * 8 * 4 * 9 * 2 * 3 * 3, index + 33294848);
-body<0>(stream, sum+ 6 + 9 + 8 + 6 + 9 + 2 + 3 + 3, product* 6 * 9 * 8 * 6 * 9 * 2 * 3 * 3, index + 33296896);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 2 + 3 + 3, product* 4 * 6 * 6 * 7 * 9 * 2 * 3 * 3, index + 33297664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 3 + 3, product* 2 * 3 * 4 * 8 * 9 * 2 * 3 * 3, index + 33298432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 2 + 3 + 3, product* 4 * 4 * 9 * 8 * 9 * 2 * 3 * 3, index + 33298944);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 3 + 3, product* 6 * 9 * 4 * 2 * 2 * 3 * 3 * 3, index + 33322496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 3 + 3, product* 4 * 6 * 2 * 3 * 2 * 3 * 3 * 3, index + 33323264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 3 + 3, product* 2 * 9 * 3 * 3 * 2 * 3 * 3 * 3, index + 33323392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 3 + 3, product* 8 * 8 * 2 * 4 * 2 * 3 * 3 * 3, index + 33324288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 3 + 3, product* 6 * 3 * 3 * 6 * 2 * 3 * 3 * 3, index + 33326336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 3 + 3 + 3, product* 8 * 4 * 8 * 6 * 2 * 3 * 3 * 3, index + 33326848);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 3 + 3, product* 2 * 3 * 2 * 7 * 2 * 3 * 3 * 3, index + 33327232);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 3 + 3, product* 4 * 8 * 3 * 8 * 2 * 3 * 3 * 3, index + 33328384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 3 + 3 + 3, product* 4 * 6 * 6 * 9 * 2 * 3 * 3 * 3, index + 33329664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 3 + 3, product* 4 * 2 * 2 * 2 * 3 * 3 * 3 * 3, index + 33332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 3 + 3, product* 6 * 3 * 7 * 2 * 3 * 3 * 3 * 3, index + 33332736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 3 + 3, product* 2 * 9 * 9 * 2 * 3 * 3 * 3 * 3, index + 33332992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 3 + 3, product* 8 * 4 * 2 * 3 * 3 * 3 * 3 * 3, index + 33333248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 3 + 3, product* 2 * 3 * 6 * 3 * 3 * 3 * 3 * 3, index + 33333632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 3 + 3, product* 2 * 7 * 2 * 4 * 3 * 3 * 3 * 3, index + 33334272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 3 + 3 + 3, product* 4 * 8 * 7 * 4 * 3 * 3 * 3 * 3, index + 33334784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 3 + 3, product* 2 * 3 * 8 * 6 * 3 * 3 * 3 * 3, index + 33336832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 3 + 3, product* 4 * 4 * 3 * 7 * 3 * 3 * 3 * 3, index + 33337344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 3 + 3, product* 4 * 2 * 6 * 8 * 3 * 3 * 3 * 3, index + 33338624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 3 + 3, product* 2 * 9 * 3 * 9 * 3 * 3 * 3 * 3, index + 33339392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 3 + 3, product* 4 * 6 * 4 * 2 * 4 * 3 * 3 * 3, index + 33342464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 3 + 3 + 3, product* 6 * 7 * 9 * 2 * 4 * 3 * 3 * 3, index + 33342976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 3 + 3, product* 2 * 3 * 2 * 3 * 4 * 3 * 3 * 3, index + 33343232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3 + 3 + 3, product* 8 * 8 * 4 * 3 * 4 * 3 * 3 * 3, index + 33343488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 3 + 3, product* 4 * 4 * 7 * 3 * 4 * 3 * 3 * 3, index + 33343744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3 + 3 + 3, product* 8 * 6 * 7 * 4 * 4 * 3 * 3 * 3, index + 33344768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 3 + 3, product* 8 * 2 * 3 * 7 * 4 * 3 * 3 * 3, index + 33347328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 3 + 3, product* 2 * 3 * 6 * 9 * 4 * 3 * 3 * 3, index + 33349632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 3 + 3, product* 2 * 3 * 4 * 2 * 6 * 3 * 3 * 3, index + 33362432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 3 + 3, product* 4 * 4 * 9 * 2 * 6 * 3 * 3 * 3, index + 33362944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 3 + 3, product* 8 * 6 * 9 * 3 * 6 * 3 * 3 * 3, index + 33363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 3 + 3, product* 4 * 2 * 2 * 4 * 6 * 3 * 3 * 3, index + 33364224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3 + 3 + 3, product* 2 * 7 * 2 * 6 * 6 * 3 * 3 * 3, index + 33366272);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 6 + 3 + 3 + 3, product* 8 * 2 * 7 * 9 * 6 * 3 * 3 * 3, index + 33369728);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 3 + 3, product* 2 * 7 * 6 * 2 * 7 * 3 * 3 * 3, index + 33372672);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 3 + 3 + 3, product* 6 * 7 * 9 * 4 * 7 * 3 * 3 * 3, index + 33374976);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 7 + 3 + 3 + 3, product* 8 * 6 * 7 * 6 * 7 * 3 * 3 * 3, index + 33376768);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 3 + 3 + 3, product* 8 * 2 * 3 * 9 * 7 * 3 * 3 * 3, index + 33379328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 3 + 3, product* 4 * 2 * 4 * 3 * 8 * 3 * 3 * 3, index + 33383424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 3 + 3 + 3, product* 8 * 4 * 4 * 4 * 8 * 3 * 3 * 3, index + 33384448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 8 + 3 + 3 + 3, product* 6 * 9 * 4 * 6 * 8 * 3 * 3 * 3, index + 33386496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 3 + 3 + 3, product* 4 * 6 * 2 * 7 * 8 * 3 * 3 * 3, index + 33387264);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 3 + 3 + 3, product* 4 * 6 * 6 * 3 * 9 * 3 * 3 * 3, index + 33393664);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9 + 3 + 3 + 3, product* 8 * 8 * 6 * 4 * 9 * 3 * 3 * 3, index + 33394688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 3 + 3 + 3, product* 4 * 2 * 2 * 6 * 9 * 3 * 3 * 3, index + 33396224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9 + 3 + 3 + 3, product* 6 * 3 * 7 * 6 * 9 * 3 * 3 * 3, index + 33396736);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3 + 3 + 3, product* 2 * 3 * 6 * 7 * 9 * 3 * 3 * 3, index + 33397632);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 3 + 3, product* 6 * 3 * 3 * 2 * 2 * 4 * 3 * 3, index + 33422336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4 + 3 + 3, product* 8 * 4 * 8 * 2 * 2 * 4 * 3 * 3, index + 33422848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 3 + 3, product* 2 * 7 * 8 * 3 * 2 * 4 * 3 * 3, index + 33423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 3 + 3, product* 4 * 8 * 3 * 4 * 2 * 4 * 3 * 3, index + 33424384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 4 + 3 + 3, product* 6 * 9 * 8 * 4 * 2 * 4 * 3 * 3, index + 33424896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 3 + 3, product* 2 * 3 * 4 * 6 * 2 * 4 * 3 * 3, index + 33426432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 4 + 3 + 3, product* 8 * 8 * 6 * 6 * 2 * 4 * 3 * 3, index + 33426688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 4 + 3 + 3, product* 4 * 4 * 9 * 6 * 2 * 4 * 3 * 3, index + 33426944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 3 + 3, product* 4 * 2 * 2 * 8 * 2 * 4 * 3 * 3, index + 33428224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4 + 3 + 3, product* 6 * 3 * 7 * 8 * 2 * 4 * 3 * 3, index + 33428736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4 + 3 + 3, product* 8 * 4 * 2 * 9 * 2 * 4 * 3 * 3, index + 33429248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 3 + 3, product* 2 * 3 * 8 * 2 * 3 * 4 * 3 * 3, index + 33432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 3 + 3, product* 4 * 4 * 3 * 3 * 3 * 4 * 3 * 3, index + 33433344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 3 + 3, product* 4 * 2 * 6 * 4 * 3 * 4 * 3 * 3, index + 33434624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 4 + 3 + 3, product* 2 * 7 * 6 * 6 * 3 * 4 * 3 * 3, index + 33436672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 4 + 3 + 3, product* 8 * 2 * 9 * 6 * 3 * 4 * 3 * 3, index + 33436928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 4 + 3 + 3, product* 6 * 9 * 6 * 7 * 3 * 4 * 3 * 3, index + 33437696);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 3 + 3, product* 2 * 3 * 2 * 9 * 3 * 4 * 3 * 3, index + 33439232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 4 + 3 + 3, product* 8 * 8 * 4 * 9 * 3 * 4 * 3 * 3, index + 33439488);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 4 + 3 + 3, product* 4 * 4 * 7 * 9 * 3 * 4 * 3 * 3, index + 33439744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 3 + 3, product* 8 * 2 * 3 * 3 * 4 * 4 * 3 * 3, index + 33443328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 4 + 3 + 3, product* 4 * 6 * 8 * 4 * 4 * 4 * 3 * 3, index + 33444864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 3 + 3, product* 4 * 2 * 4 * 7 * 4 * 4 * 3 * 3, index + 33447424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 4 + 3 + 3, product* 8 * 4 * 4 * 8 * 4 * 4 * 3 * 3, index + 33448448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 4 + 3 + 3, product* 2 * 7 * 4 * 9 * 4 * 4 * 3 * 3, index + 33449472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 3 + 3, product* 2 * 7 * 2 * 2 * 6 * 4 * 3 * 3, index + 33462272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 4 + 3 + 3, product* 4 * 8 * 7 * 2 * 6 * 4 * 3 * 3, index + 33462784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 3 + 3, product* 2 * 3 * 8 * 4 * 6 * 4 * 3 * 3, index + 33464832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 4 + 3 + 3, product* 8 * 6 * 3 * 6 * 6 * 4 * 3 * 3, index + 33466368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 4 + 3 + 3, product* 4 * 2 * 6 * 6 * 6 * 4 * 3 * 3, index + 33466624);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 4 + 3 + 3, product* 8 * 2 * 9 * 8 * 6 * 4 * 3 * 3, index + 33468928);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 4 + 3 + 3, product* 4 * 2 * 4 * 9 * 7 * 4 * 3 * 3, index + 33479424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 4 + 3 + 3, product* 4 * 6 * 2 * 3 * 8 * 4 * 3 * 3, index + 33483264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 4 + 3 + 3, product* 6 * 7 * 7 * 3 * 8 * 4 * 3 * 3, index + 33483776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 4 + 3 + 3, product* 8 * 8 * 2 * 4 * 8 * 4 * 3 * 3, index + 33484288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 4 + 3 + 3, product* 6 * 3 * 3 * 6 * 8 * 4 * 3 * 3, index + 33486336);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 4 + 3 + 3, product* 4 * 6 * 6 * 9 * 8 * 4 * 3 * 3, index + 33489664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 3 + 3, product* 4 * 2 * 2 * 2 * 9 * 4 * 3 * 3, index + 33492224);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 4 + 3 + 3, product* 4 * 4 * 3 * 7 * 9 * 4 * 3 * 3, index + 33497344);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 4 + 3 + 3, product* 2 * 7 * 4 * 7 * 9 * 4 * 3 * 3, index + 33497472);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 4 + 3 + 3, product* 2 * 9 * 3 * 9 * 9 * 4 * 3 * 3, index + 33499392);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 3 + 3, product* 2 * 7 * 2 * 2 * 2 * 6 * 3 * 3, index + 33622272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6 + 3 + 3, product* 4 * 8 * 7 * 2 * 2 * 6 * 3 * 3, index + 33622784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 3 + 3, product* 6 * 9 * 2 * 3 * 2 * 6 * 3 * 3, index + 33623296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 3 + 3, product* 2 * 3 * 8 * 4 * 2 * 6 * 3 * 3, index + 33624832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 3 + 3, product* 4 * 2 * 6 * 6 * 2 * 6 * 3 * 3, index + 33626624);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 6 + 3 + 3, product* 8 * 4 * 6 * 7 * 2 * 6 * 3 * 3, index + 33627648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 6 + 3 + 3, product* 2 * 7 * 6 * 8 * 2 * 6 * 3 * 3, index + 33628672);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 6 + 3 + 3, product* 2 * 9 * 7 * 3 * 3 * 6 * 3 * 3, index + 33633792);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 6 + 3 + 3, product* 6 * 7 * 3 * 7 * 3 * 6 * 3 * 3, index + 33637376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 6 + 3 + 3, product* 2 * 3 * 6 * 7 * 3 * 6 * 3 * 3, index + 33637632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 3 + 3, product* 4 * 2 * 4 * 9 * 3 * 6 * 3 * 3, index + 33639424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 6 + 3 + 3, product* 6 * 9 * 4 * 2 * 4 * 6 * 3 * 3, index + 33642496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 3 + 3, product* 4 * 6 * 2 * 3 * 4 * 6 * 3 * 3, index + 33643264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 6 + 3 + 3, product* 8 * 8 * 2 * 4 * 4 * 6 * 3 * 3, index + 33644288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 3 + 3, product* 6 * 3 * 3 * 6 * 4 * 6 * 3 * 3, index + 33646336);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 6 + 3 + 3, product* 6 * 3 * 9 * 7 * 4 * 6 * 3 * 3, index + 33647936);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 3 + 3, product* 4 * 6 * 4 * 2 * 6 * 6 * 3 * 3, index + 33662464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 3 + 3, product* 2 * 3 * 2 * 3 * 6 * 6 * 3 * 3, index + 33663232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 6 + 3 + 3, product* 8 * 8 * 4 * 3 * 6 * 6 * 3 * 3, index + 33663488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 3 + 3, product* 4 * 4 * 7 * 3 * 6 * 6 * 3 * 3, index + 33663744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 6 + 3 + 3, product* 2 * 3 * 6 * 9 * 6 * 6 * 3 * 3, index + 33669632);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 6 + 3 + 3, product* 8 * 2 * 7 * 3 * 7 * 6 * 3 * 3, index + 33673728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 6 + 3 + 3, product* 4 * 2 * 8 * 7 * 7 * 6 * 3 * 3, index + 33677824);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7 + 6 + 3 + 3, product* 2 * 7 * 8 * 9 * 7 * 6 * 3 * 3, index + 33679872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 3 + 3, product* 2 * 3 * 4 * 2 * 8 * 6 * 3 * 3, index + 33682432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 3 + 3, product* 4 * 2 * 2 * 4 * 8 * 6 * 3 * 3, index + 33684224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 3 + 3, product* 2 * 7 * 2 * 6 * 8 * 6 * 3 * 3, index + 33686272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 3 + 3, product* 8 * 6 * 3 * 2 * 2 * 7 * 3 * 3, index + 33722368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 3 + 3, product* 4 * 2 * 6 * 2 * 2 * 7 * 3 * 3, index + 33722624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 3 + 3, product* 2 * 9 * 3 * 3 * 2 * 7 * 3 * 3, index + 33723392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7 + 3 + 3, product* 2 * 7 * 6 * 4 * 2 * 7 * 3 * 3, index + 33724672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 7 + 3 + 3, product* 8 * 2 * 9 * 4 * 2 * 7 * 3 * 3, index + 33724928);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7 + 3 + 3, product* 6 * 3 * 3 * 6 * 2 * 7 * 3 * 3, index + 33726336);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 7 + 3 + 3, product* 6 * 7 * 9 * 6 * 2 * 7 * 3 * 3, index + 33726976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 3 + 3, product* 2 * 3 * 2 * 7 * 2 * 7 * 3 * 3, index + 33727232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 7 + 3 + 3, product* 4 * 4 * 7 * 7 * 2 * 7 * 3 * 3, index + 33727744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 7 + 3 + 3, product* 8 * 6 * 7 * 8 * 2 * 7 * 3 * 3, index + 33728768);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 3 + 3, product* 2 * 3 * 6 * 3 * 3 * 7 * 3 * 3, index + 33733632);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 7 + 3 + 3, product* 4 * 6 * 2 * 9 * 3 * 7 * 3 * 3, index + 33739264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 3 + 3, product* 6 * 3 * 3 * 2 * 4 * 7 * 3 * 3, index + 33742336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 7 + 3 + 3, product* 2 * 3 * 4 * 6 * 4 * 7 * 3 * 3, index + 33746432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 7 + 3 + 3, product* 4 * 4 * 9 * 6 * 4 * 7 * 3 * 3, index + 33746944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 3 + 3, product* 4 * 2 * 2 * 8 * 4 * 7 * 3 * 3, index + 33748224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 7 + 3 + 3, product* 2 * 9 * 9 * 8 * 4 * 7 * 3 * 3, index + 33748992);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 7 + 3 + 3, product* 8 * 4 * 4 * 8 * 6 * 7 * 3 * 3, index + 33768448);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 3 + 3, product* 6 * 3 * 7 * 2 * 7 * 7 * 3 * 3, index + 33772736);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 7 + 3 + 3, product* 4 * 2 * 8 * 3 * 7 * 7 * 3 * 3, index + 33773824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 7 + 3 + 3, product* 6 * 3 * 3 * 4 * 7 * 7 * 3 * 3, index + 33774336);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 3 + 3, product* 2 * 7 * 2 * 2 * 8 * 7 * 3 * 3, index + 33782272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 7 + 3 + 3, product* 4 * 2 * 6 * 6 * 8 * 7 * 3 * 3, index + 33786624);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 7 + 3 + 3, product* 2 * 3 * 6 * 7 * 9 * 7 * 3 * 3, index + 33797632);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 3 + 3, product* 4 * 6 * 4 * 2 * 2 * 8 * 3 * 3, index + 33822464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 3 + 3, product* 2 * 3 * 2 * 3 * 2 * 8 * 3 * 3, index + 33823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 3 + 3, product* 4 * 4 * 7 * 3 * 2 * 8 * 3 * 3, index + 33823744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8 + 3 + 3, product* 8 * 2 * 3 * 7 * 2 * 8 * 3 * 3, index + 33827328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8 + 3 + 3, product* 2 * 3 * 6 * 9 * 2 * 8 * 3 * 3, index + 33829632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 8 + 3 + 3, product* 8 * 4 * 4 * 2 * 3 * 8 * 3 * 3, index + 33832448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 3 + 3, product* 2 * 7 * 4 * 3 * 3 * 8 * 3 * 3, index + 33833472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 3 + 3, product* 8 * 2 * 7 * 3 * 3 * 8 * 3 * 3, index + 33833728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 8 + 3 + 3, product* 4 * 8 * 9 * 3 * 3 * 8 * 3 * 3, index + 33833984);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 3 + 3, product* 4 * 2 * 8 * 7 * 3 * 8 * 3 * 3, index + 33837824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 3 + 3, product* 2 * 3 * 4 * 2 * 4 * 8 * 3 * 3, index + 33842432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 8 + 3 + 3, product* 8 * 8 * 6 * 2 * 4 * 8 * 3 * 3, index + 33842688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 3 + 3, product* 4 * 4 * 9 * 2 * 4 * 8 * 3 * 3, index + 33842944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 3 + 3, product* 4 * 2 * 2 * 4 * 4 * 8 * 3 * 3, index + 33844224);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 8 + 3 + 3, product* 4 * 8 * 7 * 6 * 4 * 8 * 3 * 3, index + 33846784);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 3 + 3, product* 4 * 2 * 4 * 3 * 6 * 8 * 3 * 3, index + 33863424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 8 + 3 + 3, product* 4 * 8 * 3 * 2 * 7 * 8 * 3 * 3, index + 33872384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 8 + 3 + 3, product* 2 * 3 * 4 * 4 * 7 * 8 * 3 * 3, index + 33874432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 3 + 3, product* 4 * 2 * 2 * 6 * 7 * 8 * 3 * 3, index + 33876224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 8 + 3 + 3, product* 8 * 4 * 2 * 7 * 7 * 8 * 3 * 3, index + 33877248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 8 + 3 + 3, product* 2 * 7 * 2 * 8 * 7 * 8 * 3 * 3, index + 33878272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 8 + 3 + 3, product* 4 * 2 * 6 * 2 * 8 * 8 * 3 * 3, index + 33882624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 8 + 3 + 3, product* 2 * 9 * 3 * 3 * 8 * 8 * 3 * 3, index + 33883392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 8 + 3 + 3, product* 4 * 6 * 4 * 6 * 8 * 8 * 3 * 3, index + 33886464);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 8 + 3 + 3, product* 6 * 7 * 3 * 3 * 9 * 8 * 3 * 3, index + 33893376);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 3 + 3, product* 8 * 2 * 3 * 3 * 2 * 9 * 3 * 3, index + 33923328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 9 + 3 + 3, product* 4 * 6 * 8 * 4 * 2 * 9 * 3 * 3, index + 33924864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 3 + 3, product* 4 * 2 * 4 * 7 * 2 * 9 * 3 * 3, index + 33927424);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 9 + 3 + 3, product* 8 * 2 * 7 * 9 * 2 * 9 * 3 * 3, index + 33929728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 9 + 3 + 3, product* 8 * 8 * 2 * 2 * 3 * 9 * 3 * 3, index + 33932288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 3 + 3, product* 4 * 2 * 8 * 3 * 3 * 9 * 3 * 3, index + 33933824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 3 + 3, product* 6 * 3 * 3 * 4 * 3 * 9 * 3 * 3, index + 33934336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 3 + 3, product* 2 * 3 * 4 * 8 * 3 * 9 * 3 * 3, index + 33938432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 3 + 3, product* 2 * 7 * 2 * 2 * 4 * 9 * 3 * 3, index + 33942272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 3 + 3, product* 2 * 3 * 8 * 4 * 4 * 9 * 3 * 3, index + 33944832);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 9 + 3 + 3, product* 4 * 6 * 2 * 3 * 6 * 9 * 3 * 3, index + 33963264);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 9 + 3 + 3, product* 4 * 8 * 3 * 8 * 6 * 9 * 3 * 3, index + 33968384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 3 + 3, product* 4 * 2 * 2 * 2 * 7 * 9 * 3 * 3, index + 33972224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 9 + 3 + 3, product* 8 * 4 * 2 * 3 * 7 * 9 * 3 * 3, index + 33973248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 3 + 3, product* 2 * 7 * 2 * 4 * 7 * 9 * 3 * 3, index + 33974272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 9 + 3 + 3, product* 4 * 8 * 7 * 4 * 7 * 9 * 3 * 3, index + 33974784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 9 + 3 + 3, product* 2 * 3 * 8 * 6 * 7 * 9 * 3 * 3, index + 33976832);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 9 + 3 + 3, product* 4 * 6 * 4 * 2 * 8 * 9 * 3 * 3, index + 33982464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 3 + 3, product* 2 * 3 * 2 * 3 * 8 * 9 * 3 * 3, index + 33983232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 4 + 3, product* 6 * 3 * 3 * 2 * 2 * 2 * 4 * 3, index + 34222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 4 + 3, product* 8 * 4 * 8 * 2 * 2 * 2 * 4 * 3, index + 34222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 4 + 3, product* 2 * 7 * 8 * 3 * 2 * 2 * 4 * 3, index + 34223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 4 + 3, product* 4 * 8 * 3 * 4 * 2 * 2 * 4 * 3, index + 34224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 4 + 3, product* 2 * 3 * 4 * 6 * 2 * 2 * 4 * 3, index + 34226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 4 + 3, product* 4 * 4 * 9 * 6 * 2 * 2 * 4 * 3, index + 34226944);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 2 + 4 + 3, product* 8 * 6 * 9 * 7 * 2 * 2 * 4 * 3, index + 34227968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 4 + 3, product* 4 * 2 * 2 * 8 * 2 * 2 * 4 * 3, index + 34228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 4 + 3, product* 6 * 3 * 7 * 8 * 2 * 2 * 4 * 3, index + 34228736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 4 + 3, product* 8 * 4 * 2 * 9 * 2 * 2 * 4 * 3, index + 34229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 4 + 3, product* 2 * 3 * 8 * 2 * 3 * 2 * 4 * 3, index + 34232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 4 + 3, product* 4 * 4 * 3 * 3 * 3 * 2 * 4 * 3, index + 34233344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 4 + 3, product* 4 * 2 * 6 * 4 * 3 * 2 * 4 * 3, index + 34234624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 4 + 3, product* 8 * 2 * 9 * 6 * 3 * 2 * 4 * 3, index + 34236928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 4 + 3, product* 6 * 9 * 6 * 7 * 3 * 2 * 4 * 3, index + 34237696);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 4 + 3, product* 2 * 3 * 2 * 9 * 3 * 2 * 4 * 3, index + 34239232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 2 + 4 + 3, product* 4 * 4 * 7 * 9 * 3 * 2 * 4 * 3, index + 34239744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 4 + 3, product* 8 * 2 * 3 * 3 * 4 * 2 * 4 * 3, index + 34243328);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 2 + 4 + 3, product* 8 * 4 * 4 * 8 * 4 * 2 * 4 * 3, index + 34248448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 4 + 3, product* 2 * 7 * 4 * 9 * 4 * 2 * 4 * 3, index + 34249472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 4 + 3, product* 2 * 7 * 2 * 2 * 6 * 2 * 4 * 3, index + 34262272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 4 + 3, product* 6 * 9 * 2 * 3 * 6 * 2 * 4 * 3, index + 34263296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 4 + 3, product* 2 * 3 * 8 * 4 * 6 * 2 * 4 * 3, index + 34264832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 4 + 3, product* 4 * 2 * 6 * 6 * 6 * 2 * 4 * 3, index + 34266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 4 + 3, product* 2 * 9 * 3 * 7 * 6 * 2 * 4 * 3, index + 34267392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 4 + 3, product* 2 * 7 * 6 * 8 * 6 * 2 * 4 * 3, index + 34268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 4 + 3, product* 8 * 2 * 9 * 8 * 6 * 2 * 4 * 3, index + 34268928);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 4 + 3, product* 8 * 6 * 7 * 2 * 7 * 2 * 4 * 3, index + 34272768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 4 + 3, product* 2 * 9 * 7 * 3 * 7 * 2 * 4 * 3, index + 34273792);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 4 + 3, product* 2 * 3 * 6 * 7 * 7 * 2 * 4 * 3, index + 34277632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 4 + 3, product* 4 * 2 * 4 * 9 * 7 * 2 * 4 * 3, index + 34279424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2 + 4 + 3, product* 6 * 9 * 4 * 2 * 8 * 2 * 4 * 3, index + 34282496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 4 + 3, product* 4 * 6 * 2 * 3 * 8 * 2 * 4 * 3, index + 34283264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 4 + 3, product* 8 * 8 * 2 * 4 * 8 * 2 * 4 * 3, index + 34284288);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 4 + 3, product* 4 * 6 * 6 * 9 * 8 * 2 * 4 * 3, index + 34289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 4 + 3, product* 4 * 2 * 2 * 2 * 9 * 2 * 4 * 3, index + 34292224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 4 + 3, product* 2 * 9 * 9 * 2 * 9 * 2 * 4 * 3, index + 34292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 4 + 3, product* 8 * 4 * 2 * 3 * 9 * 2 * 4 * 3, index + 34293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 4 + 3, product* 2 * 7 * 2 * 4 * 9 * 2 * 4 * 3, index + 34294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 4 + 3, product* 4 * 8 * 7 * 4 * 9 * 2 * 4 * 3, index + 34294784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 4 + 3, product* 2 * 3 * 8 * 6 * 9 * 2 * 4 * 3, index + 34296832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 4 + 3, product* 4 * 4 * 3 * 7 * 9 * 2 * 4 * 3, index + 34297344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 9 + 2 + 4 + 3, product* 8 * 6 * 3 * 8 * 9 * 2 * 4 * 3, index + 34298368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 4 + 3, product* 2 * 9 * 3 * 9 * 9 * 2 * 4 * 3, index + 34299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 4 + 3, product* 2 * 3 * 4 * 2 * 2 * 3 * 4 * 3, index + 34322432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3 + 4 + 3, product* 8 * 8 * 6 * 2 * 2 * 3 * 4 * 3, index + 34322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 4 + 3, product* 4 * 4 * 9 * 2 * 2 * 3 * 4 * 3, index + 34322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 4 + 3, product* 4 * 2 * 2 * 4 * 2 * 3 * 4 * 3, index + 34324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 4 + 3, product* 6 * 3 * 7 * 4 * 2 * 3 * 4 * 3, index + 34324736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 4 + 3, product* 2 * 9 * 9 * 4 * 2 * 3 * 4 * 3, index + 34324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 4 + 3, product* 2 * 7 * 2 * 6 * 2 * 3 * 4 * 3, index + 34326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 4 + 3, product* 4 * 8 * 7 * 6 * 2 * 3 * 4 * 3, index + 34326784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 4 + 3, product* 6 * 9 * 2 * 7 * 2 * 3 * 4 * 3, index + 34327296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 4 + 3, product* 2 * 3 * 8 * 8 * 2 * 3 * 4 * 3, index + 34328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 4 + 3, product* 4 * 4 * 3 * 9 * 2 * 3 * 4 * 3, index + 34329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 4 + 3, product* 2 * 7 * 6 * 2 * 3 * 3 * 4 * 3, index + 34332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 4 + 3, product* 8 * 2 * 9 * 2 * 3 * 3 * 4 * 3, index + 34332928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 3 + 4 + 3, product* 6 * 9 * 6 * 3 * 3 * 3 * 4 * 3, index + 34333696);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 4 + 3, product* 8 * 2 * 3 * 9 * 3 * 3 * 4 * 3, index + 34339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 4 + 3, product* 4 * 2 * 4 * 3 * 4 * 3 * 4 * 3, index + 34343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 4 + 3, product* 6 * 3 * 9 * 3 * 4 * 3 * 4 * 3, index + 34343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 4 + 3, product* 8 * 4 * 4 * 4 * 4 * 3 * 4 * 3, index + 34344448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 4 + 3, product* 4 * 6 * 2 * 7 * 4 * 3 * 4 * 3, index + 34347264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 4 + 3 + 4 + 3, product* 8 * 8 * 2 * 8 * 4 * 3 * 4 * 3, index + 34348288);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 4 + 3, product* 2 * 9 * 3 * 3 * 6 * 3 * 4 * 3, index + 34363392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 4 + 3, product* 2 * 7 * 6 * 4 * 6 * 3 * 4 * 3, index + 34364672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 4 + 3, product* 4 * 6 * 4 * 6 * 6 * 3 * 4 * 3, index + 34366464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 4 + 3, product* 2 * 3 * 2 * 7 * 6 * 3 * 4 * 3, index + 34367232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 4 + 3, product* 4 * 6 * 8 * 2 * 7 * 3 * 4 * 3, index + 34372864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 4 + 3, product* 2 * 3 * 6 * 3 * 7 * 3 * 4 * 3, index + 34373632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 4 + 3, product* 8 * 4 * 4 * 6 * 7 * 3 * 4 * 3, index + 34376448);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 7 + 3 + 4 + 3, product* 4 * 8 * 9 * 7 * 7 * 3 * 4 * 3, index + 34377984);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 4 + 3, product* 4 * 6 * 2 * 9 * 7 * 3 * 4 * 3, index + 34379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 4 + 3, product* 6 * 3 * 3 * 2 * 8 * 3 * 4 * 3, index + 34382336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 4 + 3, product* 2 * 7 * 8 * 3 * 8 * 3 * 4 * 3, index + 34383872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 4 + 3, product* 2 * 3 * 4 * 6 * 8 * 3 * 4 * 3, index + 34386432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 4 + 3, product* 4 * 2 * 2 * 8 * 8 * 3 * 4 * 3, index + 34388224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 8 + 3 + 4 + 3, product* 6 * 3 * 7 * 8 * 8 * 3 * 4 * 3, index + 34388736);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 4 + 3, product* 4 * 2 * 6 * 4 * 9 * 3 * 4 * 3, index + 34394624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 4 + 3, product* 2 * 7 * 6 * 6 * 9 * 3 * 4 * 3, index + 34396672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 4 + 3, product* 2 * 3 * 2 * 9 * 9 * 3 * 4 * 3, index + 34399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 4 + 3, product* 2 * 7 * 2 * 2 * 2 * 4 * 4 * 3, index + 34422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 4 + 3, product* 4 * 8 * 7 * 2 * 2 * 4 * 4 * 3, index + 34422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 4 + 3, product* 6 * 9 * 2 * 3 * 2 * 4 * 4 * 3, index + 34423296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 4 + 3, product* 2 * 3 * 8 * 4 * 2 * 4 * 4 * 3, index + 34424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 4 + 3, product* 8 * 6 * 3 * 6 * 2 * 4 * 4 * 3, index + 34426368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 4 + 3, product* 4 * 2 * 6 * 6 * 2 * 4 * 4 * 3, index + 34426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 4 + 3, product* 2 * 9 * 3 * 7 * 2 * 4 * 4 * 3, index + 34427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 4 + 3, product* 8 * 4 * 6 * 7 * 2 * 4 * 4 * 3, index + 34427648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 4 + 3, product* 2 * 7 * 6 * 8 * 2 * 4 * 4 * 3, index + 34428672);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 4 + 3, product* 8 * 6 * 7 * 2 * 3 * 4 * 4 * 3, index + 34432768);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 4 + 3, product* 2 * 3 * 6 * 7 * 3 * 4 * 4 * 3, index + 34437632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 4 + 3, product* 4 * 2 * 4 * 9 * 3 * 4 * 4 * 3, index + 34439424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 4 + 3, product* 4 * 6 * 2 * 3 * 4 * 4 * 4 * 3, index + 34443264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 4 + 3, product* 6 * 7 * 7 * 3 * 4 * 4 * 4 * 3, index + 34443776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 4 + 3, product* 8 * 8 * 2 * 4 * 4 * 4 * 4 * 3, index + 34444288);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 4 + 3, product* 4 * 6 * 4 * 2 * 6 * 4 * 4 * 3, index + 34462464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 4 + 3, product* 2 * 3 * 2 * 3 * 6 * 4 * 4 * 3, index + 34463232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 4 + 3, product* 4 * 4 * 7 * 3 * 6 * 4 * 4 * 3, index + 34463744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 4 + 4 + 3, product* 8 * 6 * 7 * 4 * 6 * 4 * 4 * 3, index + 34464768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 4 + 4 + 3, product* 8 * 2 * 3 * 7 * 6 * 4 * 4 * 3, index + 34467328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 4 + 3, product* 8 * 4 * 4 * 2 * 7 * 4 * 4 * 3, index + 34472448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 4 + 3, product* 2 * 7 * 4 * 3 * 7 * 4 * 4 * 3, index + 34473472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 4 + 3, product* 8 * 2 * 7 * 3 * 7 * 4 * 4 * 3, index + 34473728);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 4 + 3, product* 6 * 3 * 3 * 8 * 7 * 4 * 4 * 3, index + 34478336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 4 + 3, product* 2 * 3 * 4 * 2 * 8 * 4 * 4 * 3, index + 34482432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 4 + 4 + 3, product* 4 * 4 * 9 * 2 * 8 * 4 * 4 * 3, index + 34482944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 4 + 3, product* 4 * 2 * 2 * 4 * 8 * 4 * 4 * 3, index + 34484224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 4 + 3, product* 2 * 7 * 2 * 6 * 8 * 4 * 4 * 3, index + 34486272);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 4 + 3, product* 2 * 7 * 6 * 2 * 9 * 4 * 4 * 3, index + 34492672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 4 + 3, product* 8 * 2 * 9 * 2 * 9 * 4 * 4 * 3, index + 34492928);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 4 + 3, product* 4 * 6 * 4 * 2 * 2 * 6 * 4 * 3, index + 34622464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 4 + 3, product* 6 * 7 * 9 * 2 * 2 * 6 * 4 * 3, index + 34622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 4 + 3, product* 2 * 3 * 2 * 3 * 2 * 6 * 4 * 3, index + 34623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 4 + 3, product* 4 * 4 * 7 * 3 * 2 * 6 * 4 * 3, index + 34623744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 6 + 4 + 3, product* 8 * 6 * 7 * 4 * 2 * 6 * 4 * 3, index + 34624768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 4 + 3, product* 8 * 2 * 3 * 7 * 2 * 6 * 4 * 3, index + 34627328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 4 + 3, product* 6 * 7 * 3 * 9 * 2 * 6 * 4 * 3, index + 34629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 4 + 3, product* 2 * 3 * 6 * 9 * 2 * 6 * 4 * 3, index + 34629632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 4 + 3, product* 8 * 4 * 4 * 2 * 3 * 6 * 4 * 3, index + 34632448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 4 + 3, product* 2 * 7 * 4 * 3 * 3 * 6 * 4 * 3, index + 34633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 4 + 3, product* 8 * 2 * 7 * 3 * 3 * 6 * 4 * 3, index + 34633728);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 4 + 3, product* 8 * 8 * 2 * 6 * 3 * 6 * 4 * 3, index + 34636288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 4 + 3, product* 6 * 3 * 3 * 8 * 3 * 6 * 4 * 3, index + 34638336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 4 + 3, product* 2 * 3 * 4 * 2 * 4 * 6 * 4 * 3, index + 34642432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 4 + 3, product* 4 * 2 * 2 * 4 * 4 * 6 * 4 * 3, index + 34644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 4 + 3, product* 2 * 7 * 2 * 6 * 4 * 6 * 4 * 3, index + 34646272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 4 + 3, product* 2 * 3 * 8 * 8 * 4 * 6 * 4 * 3, index + 34648832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 4 + 3, product* 4 * 2 * 4 * 3 * 6 * 6 * 4 * 3, index + 34663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 4 + 3, product* 6 * 3 * 9 * 3 * 6 * 6 * 4 * 3, index + 34663936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 6 + 4 + 3, product* 6 * 9 * 4 * 6 * 6 * 6 * 4 * 3, index + 34666496);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 4 + 3, product* 2 * 3 * 4 * 4 * 7 * 6 * 4 * 3, index + 34674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 4 + 3, product* 4 * 2 * 2 * 6 * 7 * 6 * 4 * 3, index + 34676224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6 + 4 + 3, product* 8 * 4 * 2 * 7 * 7 * 6 * 4 * 3, index + 34677248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 4 + 3, product* 2 * 7 * 2 * 8 * 7 * 6 * 4 * 3, index + 34678272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 6 + 4 + 3, product* 8 * 6 * 3 * 2 * 8 * 6 * 4 * 3, index + 34682368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 4 + 3, product* 4 * 2 * 6 * 2 * 8 * 6 * 4 * 3, index + 34682624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 4 + 3, product* 2 * 9 * 3 * 3 * 8 * 6 * 4 * 3, index + 34683392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 4 + 3, product* 2 * 3 * 2 * 7 * 8 * 6 * 4 * 3, index + 34687232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 6 + 4 + 3, product* 4 * 4 * 7 * 7 * 8 * 6 * 4 * 3, index + 34687744);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 4 + 3, product* 2 * 3 * 6 * 3 * 9 * 6 * 4 * 3, index + 34693632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6 + 4 + 3, product* 2 * 7 * 4 * 7 * 9 * 6 * 4 * 3, index + 34697472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 6 + 4 + 3, product* 8 * 2 * 7 * 7 * 9 * 6 * 4 * 3, index + 34697728);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 4 + 3, product* 8 * 2 * 3 * 3 * 2 * 7 * 4 * 3, index + 34723328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 4 + 3, product* 4 * 2 * 4 * 7 * 2 * 7 * 4 * 3, index + 34727424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 4 + 3, product* 8 * 4 * 4 * 8 * 2 * 7 * 4 * 3, index + 34728448);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 7 + 4 + 3, product* 4 * 8 * 9 * 9 * 2 * 7 * 4 * 3, index + 34729984);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 4 + 3, product* 4 * 2 * 8 * 3 * 3 * 7 * 4 * 3, index + 34733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 4 + 3, product* 6 * 3 * 3 * 4 * 3 * 7 * 4 * 3, index + 34734336);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7 + 4 + 3, product* 4 * 6 * 6 * 7 * 3 * 7 * 4 * 3, index + 34737664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 4 + 3, product* 2 * 3 * 4 * 8 * 3 * 7 * 4 * 3, index + 34738432);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 7 + 4 + 3, product* 8 * 8 * 6 * 8 * 3 * 7 * 4 * 3, index + 34738688);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 4 + 3, product* 2 * 7 * 2 * 2 * 4 * 7 * 4 * 3, index + 34742272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 4 + 3, product* 2 * 3 * 8 * 4 * 4 * 7 * 4 * 3, index + 34744832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 4 + 3, product* 2 * 7 * 6 * 8 * 4 * 7 * 4 * 3, index + 34748672);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 7 + 4 + 3, product* 6 * 9 * 4 * 2 * 6 * 7 * 4 * 3, index + 34762496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 4 + 3, product* 4 * 6 * 2 * 3 * 6 * 7 * 4 * 3, index + 34763264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 7 + 4 + 3, product* 6 * 7 * 7 * 3 * 6 * 7 * 4 * 3, index + 34763776);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 4 + 3, product* 4 * 2 * 2 * 2 * 7 * 7 * 4 * 3, index + 34772224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 4 + 3, product* 8 * 4 * 2 * 3 * 7 * 7 * 4 * 3, index + 34773248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 4 + 3, product* 2 * 7 * 2 * 4 * 7 * 7 * 4 * 3, index + 34774272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 7 + 4 + 3, product* 4 * 4 * 3 * 7 * 7 * 7 * 4 * 3, index + 34777344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 4 + 3, product* 2 * 3 * 2 * 3 * 8 * 7 * 4 * 3, index + 34783232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7 + 4 + 3, product* 8 * 4 * 4 * 2 * 9 * 7 * 4 * 3, index + 34792448);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 4 + 3, product* 4 * 2 * 4 * 3 * 2 * 8 * 4 * 3, index + 34823424);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 4 + 3, product* 4 * 2 * 8 * 9 * 2 * 8 * 4 * 3, index + 34829824);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 4 + 3, product* 2 * 3 * 4 * 4 * 3 * 8 * 4 * 3, index + 34834432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 8 + 4 + 3, product* 8 * 8 * 6 * 4 * 3 * 8 * 4 * 3, index + 34834688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 4 + 3, product* 4 * 2 * 2 * 6 * 3 * 8 * 4 * 3, index + 34836224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8 + 4 + 3, product* 6 * 3 * 7 * 6 * 3 * 8 * 4 * 3, index + 34836736);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 4 + 3, product* 6 * 9 * 2 * 9 * 3 * 8 * 4 * 3, index + 34839296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 4 + 3, product* 4 * 2 * 6 * 2 * 4 * 8 * 4 * 3, index + 34842624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 4 + 3, product* 2 * 9 * 3 * 3 * 4 * 8 * 4 * 3, index + 34843392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 4 + 3, product* 2 * 7 * 6 * 4 * 4 * 8 * 4 * 3, index + 34844672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 4 + 3, product* 2 * 3 * 2 * 7 * 4 * 8 * 4 * 3, index + 34847232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 4 + 3, product* 6 * 3 * 3 * 2 * 6 * 8 * 4 * 3, index + 34862336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 4 + 3, product* 2 * 3 * 4 * 6 * 6 * 8 * 4 * 3, index + 34866432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 4 + 3, product* 4 * 2 * 2 * 8 * 6 * 8 * 4 * 3, index + 34868224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 4 + 3, product* 2 * 3 * 8 * 2 * 7 * 8 * 4 * 3, index + 34872832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 4 + 3, product* 4 * 4 * 3 * 3 * 7 * 8 * 4 * 3, index + 34873344);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 8 + 4 + 3, product* 4 * 6 * 4 * 8 * 7 * 8 * 4 * 3, index + 34878464);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 8 + 4 + 3, product* 4 * 2 * 4 * 7 * 8 * 8 * 4 * 3, index + 34887424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 8 + 4 + 3, product* 2 * 7 * 4 * 9 * 8 * 8 * 4 * 3, index + 34889472);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 4 + 3, product* 6 * 9 * 4 * 2 * 2 * 9 * 4 * 3, index + 34922496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 4 + 3, product* 4 * 6 * 2 * 3 * 2 * 9 * 4 * 3, index + 34923264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 9 + 4 + 3, product* 6 * 7 * 7 * 3 * 2 * 9 * 4 * 3, index + 34923776);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9 + 4 + 3, product* 4 * 8 * 3 * 8 * 2 * 9 * 4 * 3, index + 34928384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 4 + 3, product* 4 * 2 * 2 * 2 * 3 * 9 * 4 * 3, index + 34932224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 4 + 3, product* 2 * 7 * 2 * 4 * 3 * 9 * 4 * 3, index + 34934272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 4 + 3, product* 2 * 3 * 8 * 6 * 3 * 9 * 4 * 3, index + 34936832);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 4 + 3, product* 4 * 6 * 4 * 2 * 4 * 9 * 4 * 3, index + 34942464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 9 + 4 + 3, product* 6 * 7 * 9 * 2 * 4 * 9 * 4 * 3, index + 34942976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 4 + 3, product* 2 * 3 * 2 * 3 * 4 * 9 * 4 * 3, index + 34943232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 4 + 3, product* 8 * 2 * 3 * 7 * 4 * 9 * 4 * 3, index + 34947328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 4 + 3, product* 2 * 3 * 4 * 2 * 6 * 9 * 4 * 3, index + 34962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 4 + 3, product* 4 * 2 * 2 * 4 * 6 * 9 * 4 * 3, index + 34964224);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 9 + 4 + 3, product* 8 * 2 * 3 * 9 * 7 * 9 * 4 * 3, index + 34979328);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 9 + 4 + 3, product* 8 * 4 * 4 * 4 * 8 * 9 * 4 * 3, index + 34984448);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 4 + 3, product* 4 * 8 * 3 * 2 * 9 * 9 * 4 * 3, index + 34992384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9 + 4 + 3, product* 2 * 3 * 4 * 4 * 9 * 9 * 4 * 3, index + 34994432);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 6 + 3, product* 4 * 6 * 4 * 2 * 2 * 2 * 6 * 3, index + 36222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 6 + 3, product* 6 * 7 * 9 * 2 * 2 * 2 * 6 * 3, index + 36222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 6 + 3, product* 2 * 3 * 2 * 3 * 2 * 2 * 6 * 3, index + 36223232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 6 + 3, product* 4 * 4 * 7 * 3 * 2 * 2 * 6 * 3, index + 36223744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 6 + 3, product* 8 * 6 * 7 * 4 * 2 * 2 * 6 * 3, index + 36224768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 6 + 3, product* 8 * 2 * 3 * 7 * 2 * 2 * 6 * 3, index + 36227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 6 + 3, product* 4 * 6 * 8 * 8 * 2 * 2 * 6 * 3, index + 36228864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 6 + 3, product* 2 * 3 * 6 * 9 * 2 * 2 * 6 * 3, index + 36229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 6 + 3, product* 8 * 4 * 4 * 2 * 3 * 2 * 6 * 3, index + 36232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 6 + 3, product* 2 * 7 * 4 * 3 * 3 * 2 * 6 * 3, index + 36233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 6 + 3, product* 8 * 2 * 7 * 3 * 3 * 2 * 6 * 3, index + 36233728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 6 + 3, product* 4 * 2 * 8 * 7 * 3 * 2 * 6 * 3, index + 36237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 6 + 3, product* 6 * 3 * 3 * 8 * 3 * 2 * 6 * 3, index + 36238336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 6 + 3, product* 2 * 7 * 8 * 9 * 3 * 2 * 6 * 3, index + 36239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 6 + 3, product* 2 * 3 * 4 * 2 * 4 * 2 * 6 * 3, index + 36242432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 6 + 3, product* 4 * 4 * 9 * 2 * 4 * 2 * 6 * 3, index + 36242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 6 + 3, product* 4 * 2 * 2 * 4 * 4 * 2 * 6 * 3, index + 36244224);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 2 + 6 + 3, product* 4 * 8 * 7 * 6 * 4 * 2 * 6 * 3, index + 36246784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 6 + 3, product* 6 * 9 * 2 * 7 * 4 * 2 * 6 * 3, index + 36247296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 6 + 3, product* 2 * 3 * 8 * 8 * 4 * 2 * 6 * 3, index + 36248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 6 + 3, product* 4 * 4 * 3 * 9 * 4 * 2 * 6 * 3, index + 36249344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 6 + 3, product* 4 * 2 * 4 * 3 * 6 * 2 * 6 * 3, index + 36263424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 6 + 3, product* 8 * 4 * 4 * 4 * 6 * 2 * 6 * 3, index + 36264448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 6 + 3, product* 4 * 6 * 2 * 7 * 6 * 2 * 6 * 3, index + 36267264);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 6 + 3, product* 4 * 6 * 6 * 3 * 7 * 2 * 6 * 3, index + 36273664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 6 + 3, product* 2 * 3 * 4 * 4 * 7 * 2 * 6 * 3, index + 36274432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 2 + 6 + 3, product* 8 * 8 * 6 * 4 * 7 * 2 * 6 * 3, index + 36274688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 6 + 3, product* 4 * 4 * 9 * 4 * 7 * 2 * 6 * 3, index + 36274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 6 + 3, product* 4 * 2 * 2 * 6 * 7 * 2 * 6 * 3, index + 36276224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 2 + 6 + 3, product* 6 * 3 * 7 * 6 * 7 * 2 * 6 * 3, index + 36276736);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 6 + 3, product* 2 * 7 * 2 * 8 * 7 * 2 * 6 * 3, index + 36278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 6 + 3, product* 8 * 6 * 3 * 2 * 8 * 2 * 6 * 3, index + 36282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 6 + 3, product* 4 * 2 * 6 * 2 * 8 * 2 * 6 * 3, index + 36282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 6 + 3, product* 2 * 9 * 3 * 3 * 8 * 2 * 6 * 3, index + 36283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 6 + 3, product* 8 * 4 * 6 * 3 * 8 * 2 * 6 * 3, index + 36283648);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 2 + 6 + 3, product* 2 * 9 * 7 * 9 * 8 * 2 * 6 * 3, index + 36289792);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 6 + 3, product* 2 * 3 * 6 * 3 * 9 * 2 * 6 * 3, index + 36293632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 6 + 3, product* 2 * 7 * 4 * 7 * 9 * 2 * 6 * 3, index + 36297472);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 6 + 3, product* 8 * 2 * 3 * 3 * 2 * 3 * 6 * 3, index + 36323328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 6 + 3, product* 4 * 6 * 8 * 4 * 2 * 3 * 6 * 3, index + 36324864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 6 + 3, product* 4 * 2 * 4 * 7 * 2 * 3 * 6 * 3, index + 36327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 6 + 3, product* 6 * 3 * 9 * 7 * 2 * 3 * 6 * 3, index + 36327936);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 6 + 3, product* 2 * 7 * 4 * 9 * 2 * 3 * 6 * 3, index + 36329472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 6 + 3, product* 8 * 8 * 2 * 2 * 3 * 3 * 6 * 3, index + 36332288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 6 + 3, product* 4 * 2 * 8 * 3 * 3 * 3 * 6 * 3, index + 36333824);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3 + 6 + 3, product* 4 * 6 * 6 * 7 * 3 * 3 * 6 * 3, index + 36337664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 6 + 3, product* 2 * 3 * 4 * 8 * 3 * 3 * 6 * 3, index + 36338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 6 + 3, product* 2 * 7 * 2 * 2 * 4 * 3 * 6 * 3, index + 36342272);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 6 + 3, product* 8 * 6 * 3 * 6 * 4 * 3 * 6 * 3, index + 36346368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 6 + 3, product* 4 * 2 * 6 * 6 * 4 * 3 * 6 * 3, index + 36346624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 6 + 3, product* 2 * 9 * 3 * 7 * 4 * 3 * 6 * 3, index + 36347392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 3 + 6 + 3, product* 8 * 2 * 9 * 8 * 4 * 3 * 6 * 3, index + 36348928);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 6 + 3, product* 6 * 9 * 4 * 2 * 6 * 3 * 6 * 3, index + 36362496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 6 + 3, product* 4 * 6 * 2 * 3 * 6 * 3 * 6 * 3, index + 36363264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 6 + 3, product* 8 * 8 * 2 * 4 * 6 * 3 * 6 * 3, index + 36364288);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 3 + 6 + 3, product* 8 * 4 * 8 * 6 * 6 * 3 * 6 * 3, index + 36366848);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 6 + 3, product* 4 * 2 * 2 * 2 * 7 * 3 * 6 * 3, index + 36372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 6 + 3, product* 6 * 3 * 7 * 2 * 7 * 3 * 6 * 3, index + 36372736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 6 + 3, product* 8 * 4 * 2 * 3 * 7 * 3 * 6 * 3, index + 36373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 6 + 3, product* 2 * 7 * 2 * 4 * 7 * 3 * 6 * 3, index + 36374272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 3 + 6 + 3, product* 4 * 8 * 7 * 4 * 7 * 3 * 6 * 3, index + 36374784);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 6 + 3, product* 2 * 3 * 2 * 3 * 8 * 3 * 6 * 3, index + 36383232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 6 + 3, product* 8 * 4 * 4 * 2 * 9 * 3 * 6 * 3, index + 36392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 6 + 3, product* 2 * 7 * 4 * 3 * 9 * 3 * 6 * 3, index + 36393472);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 6 + 3, product* 4 * 2 * 4 * 3 * 2 * 4 * 6 * 3, index + 36423424);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 6 + 3, product* 8 * 8 * 2 * 8 * 2 * 4 * 6 * 3, index + 36428288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 6 + 3, product* 4 * 2 * 8 * 9 * 2 * 4 * 6 * 3, index + 36429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 6 + 3, product* 4 * 8 * 3 * 2 * 3 * 4 * 6 * 3, index + 36432384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 6 + 3, product* 4 * 6 * 6 * 3 * 3 * 4 * 6 * 3, index + 36433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 6 + 3, product* 2 * 3 * 4 * 4 * 3 * 4 * 6 * 3, index + 36434432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 4 + 6 + 3, product* 8 * 8 * 6 * 4 * 3 * 4 * 6 * 3, index + 36434688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 6 + 3, product* 4 * 2 * 2 * 6 * 3 * 4 * 6 * 3, index + 36436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 6 + 3, product* 6 * 3 * 7 * 6 * 3 * 4 * 6 * 3, index + 36436736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 6 + 3, product* 8 * 4 * 2 * 7 * 3 * 4 * 6 * 3, index + 36437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 6 + 3, product* 2 * 7 * 2 * 8 * 3 * 4 * 6 * 3, index + 36438272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 6 + 3, product* 8 * 6 * 3 * 2 * 4 * 4 * 6 * 3, index + 36442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 6 + 3, product* 4 * 2 * 6 * 2 * 4 * 4 * 6 * 3, index + 36442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 6 + 3, product* 2 * 9 * 3 * 3 * 4 * 4 * 6 * 3, index + 36443392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 6 + 3, product* 2 * 7 * 6 * 4 * 4 * 4 * 6 * 3, index + 36444672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 6 + 3, product* 2 * 3 * 2 * 7 * 4 * 4 * 6 * 3, index + 36447232);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 6 + 3, product* 2 * 3 * 4 * 6 * 6 * 4 * 6 * 3, index + 36466432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 6 + 3, product* 2 * 3 * 8 * 2 * 7 * 4 * 6 * 3, index + 36472832);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 4 + 6 + 3, product* 6 * 9 * 6 * 7 * 7 * 4 * 6 * 3, index + 36477696);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 6 + 3, product* 8 * 2 * 3 * 3 * 8 * 4 * 6 * 3, index + 36483328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 6 + 3, product* 4 * 2 * 4 * 7 * 8 * 4 * 6 * 3, index + 36487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 6 + 3, product* 2 * 7 * 4 * 9 * 8 * 4 * 6 * 3, index + 36489472);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 4 + 6 + 3, product* 2 * 3 * 4 * 8 * 9 * 4 * 6 * 3, index + 36498432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 6 + 3, product* 6 * 3 * 3 * 2 * 2 * 6 * 6 * 3, index + 36622336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 6 + 3, product* 2 * 7 * 8 * 3 * 2 * 6 * 6 * 3, index + 36623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 6 + 3, product* 4 * 8 * 3 * 4 * 2 * 6 * 6 * 3, index + 36624384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 6 + 3, product* 6 * 9 * 8 * 4 * 2 * 6 * 6 * 3, index + 36624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 6 + 3, product* 2 * 3 * 4 * 6 * 2 * 6 * 6 * 3, index + 36626432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 6 + 3, product* 4 * 2 * 2 * 8 * 2 * 6 * 6 * 3, index + 36628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 6 + 3, product* 6 * 3 * 7 * 8 * 2 * 6 * 6 * 3, index + 36628736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 6 + 6 + 3, product* 2 * 9 * 9 * 8 * 2 * 6 * 6 * 3, index + 36628992);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 6 + 3, product* 4 * 4 * 3 * 3 * 3 * 6 * 6 * 3, index + 36633344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 6 + 3, product* 4 * 2 * 6 * 4 * 3 * 6 * 6 * 3, index + 36634624);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 6 + 3, product* 8 * 2 * 3 * 3 * 4 * 6 * 6 * 3, index + 36643328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 6 + 3, product* 4 * 2 * 4 * 7 * 4 * 6 * 6 * 3, index + 36647424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 6 + 3, product* 2 * 7 * 4 * 9 * 4 * 6 * 6 * 3, index + 36649472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 6 + 3, product* 2 * 7 * 2 * 2 * 6 * 6 * 6 * 3, index + 36662272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 6 + 3, product* 2 * 3 * 8 * 4 * 6 * 6 * 6 * 3, index + 36664832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 6 + 3, product* 4 * 2 * 6 * 6 * 6 * 6 * 6 * 3, index + 36666624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 6 + 3, product* 2 * 9 * 3 * 7 * 6 * 6 * 6 * 3, index + 36667392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 6 + 6 + 3, product* 2 * 7 * 6 * 8 * 6 * 6 * 6 * 3, index + 36668672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 6 + 6 + 3, product* 8 * 2 * 9 * 8 * 6 * 6 * 6 * 3, index + 36668928);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 6 + 6 + 3, product* 2 * 9 * 7 * 3 * 7 * 6 * 6 * 3, index + 36673792);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 6 + 3, product* 2 * 3 * 6 * 7 * 7 * 6 * 6 * 3, index + 36677632);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 6 + 6 + 3, product* 8 * 8 * 2 * 4 * 8 * 6 * 6 * 3, index + 36684288);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 6 + 6 + 3, product* 4 * 6 * 6 * 9 * 8 * 6 * 6 * 3, index + 36689664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 6 + 3, product* 4 * 2 * 2 * 2 * 9 * 6 * 6 * 3, index + 36692224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 6 + 6 + 3, product* 6 * 3 * 7 * 2 * 9 * 6 * 6 * 3, index + 36692736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 6 + 3, product* 8 * 4 * 2 * 3 * 9 * 6 * 6 * 3, index + 36693248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 6 + 3, product* 2 * 3 * 6 * 3 * 9 * 6 * 6 * 3, index + 36693632);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 6 + 3, product* 2 * 7 * 2 * 4 * 9 * 6 * 6 * 3, index + 36694272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 6 + 3, product* 2 * 3 * 8 * 6 * 9 * 6 * 6 * 3, index + 36696832);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 6 + 3, product* 2 * 3 * 4 * 2 * 2 * 7 * 6 * 3, index + 36722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 6 + 3, product* 4 * 4 * 9 * 2 * 2 * 7 * 6 * 3, index + 36722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 6 + 3, product* 4 * 2 * 2 * 4 * 2 * 7 * 6 * 3, index + 36724224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7 + 6 + 3, product* 6 * 3 * 7 * 4 * 2 * 7 * 6 * 3, index + 36724736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 6 + 3, product* 2 * 7 * 2 * 6 * 2 * 7 * 6 * 3, index + 36726272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 6 + 3, product* 2 * 3 * 8 * 8 * 2 * 7 * 6 * 3, index + 36728832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 6 + 3, product* 4 * 2 * 4 * 3 * 4 * 7 * 6 * 3, index + 36743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 6 + 3, product* 6 * 3 * 9 * 3 * 4 * 7 * 6 * 3, index + 36743936);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 7 + 6 + 3, product* 4 * 2 * 8 * 9 * 4 * 7 * 6 * 3, index + 36749824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7 + 6 + 3, product* 8 * 6 * 3 * 2 * 6 * 7 * 6 * 3, index + 36762368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 6 + 3, product* 2 * 9 * 3 * 3 * 6 * 7 * 6 * 3, index + 36763392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 6 + 3, product* 2 * 3 * 2 * 7 * 6 * 7 * 6 * 3, index + 36767232);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 6 + 3, product* 4 * 2 * 2 * 2 * 7 * 7 * 6 * 3, index + 36772224);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7 + 6 + 3, product* 8 * 4 * 4 * 6 * 7 * 7 * 6 * 3, index + 36776448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 7 + 6 + 3, product* 2 * 7 * 4 * 7 * 7 * 7 * 6 * 3, index + 36777472);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 6 + 3, product* 4 * 2 * 2 * 8 * 8 * 7 * 6 * 3, index + 36788224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 6 + 3, product* 2 * 3 * 8 * 2 * 9 * 7 * 6 * 3, index + 36792832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 6 + 3, product* 2 * 3 * 2 * 9 * 9 * 7 * 6 * 3, index + 36799232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 7 + 6 + 3, product* 4 * 4 * 7 * 9 * 9 * 7 * 6 * 3, index + 36799744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 6 + 3, product* 2 * 7 * 2 * 2 * 2 * 8 * 6 * 3, index + 36822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 6 + 3, product* 4 * 8 * 7 * 2 * 2 * 8 * 6 * 3, index + 36822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 6 + 3, product* 6 * 9 * 2 * 3 * 2 * 8 * 6 * 3, index + 36823296);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 6 + 3, product* 2 * 9 * 3 * 7 * 2 * 8 * 6 * 3, index + 36827392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 8 + 6 + 3, product* 2 * 7 * 6 * 8 * 2 * 8 * 6 * 3, index + 36828672);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 6 + 3, product* 2 * 9 * 7 * 3 * 3 * 8 * 6 * 3, index + 36833792);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 6 + 3, product* 4 * 6 * 2 * 3 * 4 * 8 * 6 * 3, index + 36843264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 6 + 3, product* 8 * 8 * 2 * 4 * 4 * 8 * 6 * 3, index + 36844288);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 8 + 6 + 3, product* 4 * 6 * 6 * 9 * 4 * 8 * 6 * 3, index + 36849664);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 6 + 3, product* 4 * 6 * 4 * 2 * 6 * 8 * 6 * 3, index + 36862464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 6 + 3, product* 2 * 3 * 2 * 3 * 6 * 8 * 6 * 3, index + 36863232);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 8 + 6 + 3, product* 6 * 7 * 3 * 9 * 6 * 8 * 6 * 3, index + 36869376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 6 + 3, product* 2 * 3 * 6 * 9 * 6 * 8 * 6 * 3, index + 36869632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 6 + 3, product* 2 * 3 * 4 * 2 * 8 * 8 * 6 * 3, index + 36882432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 6 + 3, product* 4 * 2 * 2 * 4 * 8 * 8 * 6 * 3, index + 36884224);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 8 + 6 + 3, product* 2 * 7 * 6 * 2 * 9 * 8 * 6 * 3, index + 36892672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 8 + 6 + 3, product* 4 * 6 * 4 * 4 * 9 * 8 * 6 * 3, index + 36894464);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 6 + 3, product* 8 * 6 * 3 * 2 * 2 * 9 * 6 * 3, index + 36922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 6 + 3, product* 4 * 2 * 6 * 2 * 2 * 9 * 6 * 3, index + 36922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 6 + 3, product* 2 * 9 * 3 * 3 * 2 * 9 * 6 * 3, index + 36923392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 9 + 6 + 3, product* 8 * 2 * 9 * 4 * 2 * 9 * 6 * 3, index + 36924928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 6 + 3, product* 2 * 3 * 2 * 7 * 2 * 9 * 6 * 3, index + 36927232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 6 + 3, product* 2 * 3 * 6 * 3 * 3 * 9 * 6 * 3, index + 36933632);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 6 + 3, product* 6 * 3 * 3 * 2 * 4 * 9 * 6 * 3, index + 36942336);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 9 + 6 + 3, product* 8 * 2 * 3 * 3 * 6 * 9 * 6 * 3, index + 36963328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 6 + 9 + 6 + 3, product* 4 * 6 * 8 * 4 * 6 * 9 * 6 * 3, index + 36964864);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 9 + 6 + 3, product* 2 * 7 * 4 * 9 * 6 * 9 * 6 * 3, index + 36969472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 6 + 3, product* 2 * 7 * 2 * 2 * 8 * 9 * 6 * 3, index + 36982272);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 9 + 6 + 3, product* 2 * 7 * 6 * 8 * 8 * 9 * 6 * 3, index + 36988672);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 7 + 3, product* 4 * 2 * 4 * 3 * 2 * 2 * 7 * 3, index + 37223424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 7 + 3, product* 8 * 4 * 4 * 4 * 2 * 2 * 7 * 3, index + 37224448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 7 + 3, product* 4 * 6 * 2 * 7 * 2 * 2 * 7 * 3, index + 37227264);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 2 + 7 + 3, product* 6 * 9 * 6 * 9 * 2 * 2 * 7 * 3, index + 37229696);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 7 + 3, product* 4 * 8 * 3 * 2 * 3 * 2 * 7 * 3, index + 37232384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 7 + 3, product* 4 * 6 * 6 * 3 * 3 * 2 * 7 * 3, index + 37233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 7 + 3, product* 2 * 3 * 4 * 4 * 3 * 2 * 7 * 3, index + 37234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 7 + 3, product* 4 * 4 * 9 * 4 * 3 * 2 * 7 * 3, index + 37234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 7 + 3, product* 4 * 2 * 2 * 6 * 3 * 2 * 7 * 3, index + 37236224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 7 + 3, product* 8 * 4 * 2 * 7 * 3 * 2 * 7 * 3, index + 37237248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 7 + 3, product* 2 * 7 * 2 * 8 * 3 * 2 * 7 * 3, index + 37238272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 7 + 3, product* 8 * 6 * 3 * 2 * 4 * 2 * 7 * 3, index + 37242368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 7 + 3, product* 4 * 2 * 6 * 2 * 4 * 2 * 7 * 3, index + 37242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 7 + 3, product* 2 * 9 * 3 * 3 * 4 * 2 * 7 * 3, index + 37243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 7 + 3, product* 8 * 4 * 6 * 3 * 4 * 2 * 7 * 3, index + 37243648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 7 + 3, product* 2 * 3 * 2 * 7 * 4 * 2 * 7 * 3, index + 37247232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 7 + 3, product* 6 * 3 * 3 * 2 * 6 * 2 * 7 * 3, index + 37262336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 7 + 3, product* 8 * 4 * 8 * 2 * 6 * 2 * 7 * 3, index + 37262848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 7 + 3, product* 4 * 8 * 3 * 4 * 6 * 2 * 7 * 3, index + 37264384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 6 + 2 + 7 + 3, product* 6 * 9 * 8 * 4 * 6 * 2 * 7 * 3, index + 37264896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 7 + 3, product* 2 * 3 * 4 * 6 * 6 * 2 * 7 * 3, index + 37266432);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 6 + 2 + 7 + 3, product* 8 * 6 * 9 * 7 * 6 * 2 * 7 * 3, index + 37267968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 7 + 3, product* 4 * 2 * 2 * 8 * 6 * 2 * 7 * 3, index + 37268224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 7 + 3, product* 2 * 3 * 8 * 2 * 7 * 2 * 7 * 3, index + 37272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 7 + 3, product* 4 * 4 * 3 * 3 * 7 * 2 * 7 * 3, index + 37273344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 7 + 3, product* 4 * 2 * 6 * 4 * 7 * 2 * 7 * 3, index + 37274624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 7 + 3, product* 2 * 7 * 6 * 6 * 7 * 2 * 7 * 3, index + 37276672);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 2 + 7 + 3, product* 6 * 9 * 6 * 7 * 7 * 2 * 7 * 3, index + 37277696);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 2 + 7 + 3, product* 4 * 6 * 4 * 8 * 7 * 2 * 7 * 3, index + 37278464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 2 + 7 + 3, product* 6 * 7 * 9 * 8 * 7 * 2 * 7 * 3, index + 37278976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 7 + 3, product* 2 * 3 * 2 * 9 * 7 * 2 * 7 * 3, index + 37279232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 7 + 3, product* 8 * 2 * 3 * 3 * 8 * 2 * 7 * 3, index + 37283328);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 7 + 3, product* 8 * 8 * 2 * 2 * 9 * 2 * 7 * 3, index + 37292288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 7 + 3, product* 4 * 2 * 8 * 3 * 9 * 2 * 7 * 3, index + 37293824);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 7 + 3, product* 4 * 6 * 2 * 3 * 2 * 3 * 7 * 3, index + 37323264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 7 + 3, product* 6 * 7 * 7 * 3 * 2 * 3 * 7 * 3, index + 37323776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 7 + 3, product* 8 * 8 * 2 * 4 * 2 * 3 * 7 * 3, index + 37324288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 7 + 3, product* 6 * 3 * 3 * 6 * 2 * 3 * 7 * 3, index + 37326336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 7 + 3, product* 2 * 7 * 8 * 7 * 2 * 3 * 7 * 3, index + 37327872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 7 + 3, product* 4 * 8 * 3 * 8 * 2 * 3 * 7 * 3, index + 37328384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 7 + 3, product* 4 * 2 * 2 * 2 * 3 * 3 * 7 * 3, index + 37332224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 7 + 3, product* 2 * 9 * 9 * 2 * 3 * 3 * 7 * 3, index + 37332992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 7 + 3, product* 8 * 4 * 2 * 3 * 3 * 3 * 7 * 3, index + 37333248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 7 + 3, product* 2 * 7 * 2 * 4 * 3 * 3 * 7 * 3, index + 37334272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 7 + 3, product* 4 * 4 * 3 * 7 * 3 * 3 * 7 * 3, index + 37337344);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 3 + 7 + 3, product* 8 * 6 * 3 * 8 * 3 * 3 * 7 * 3, index + 37338368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 7 + 3, product* 2 * 9 * 3 * 9 * 3 * 3 * 7 * 3, index + 37339392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 7 + 3, product* 4 * 6 * 4 * 2 * 4 * 3 * 7 * 3, index + 37342464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 7 + 3, product* 2 * 3 * 2 * 3 * 4 * 3 * 7 * 3, index + 37343232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 7 + 3, product* 4 * 4 * 7 * 3 * 4 * 3 * 7 * 3, index + 37343744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3 + 7 + 3, product* 8 * 6 * 7 * 4 * 4 * 3 * 7 * 3, index + 37344768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 7 + 3, product* 8 * 2 * 3 * 7 * 4 * 3 * 7 * 3, index + 37347328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 7 + 3, product* 2 * 3 * 4 * 2 * 6 * 3 * 7 * 3, index + 37362432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 7 + 3, product* 4 * 4 * 9 * 2 * 6 * 3 * 7 * 3, index + 37362944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 7 + 3, product* 4 * 2 * 2 * 4 * 6 * 3 * 7 * 3, index + 37364224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3 + 7 + 3, product* 2 * 7 * 2 * 6 * 6 * 3 * 7 * 3, index + 37366272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 3 + 7 + 3, product* 4 * 8 * 7 * 6 * 6 * 3 * 7 * 3, index + 37366784);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 7 + 3, product* 2 * 3 * 2 * 7 * 6 * 3 * 7 * 3, index + 37367232);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 3 + 7 + 3, product* 6 * 9 * 2 * 7 * 6 * 3 * 7 * 3, index + 37367296);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 7 + 3, product* 2 * 7 * 6 * 2 * 7 * 3 * 7 * 3, index + 37372672);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 7 + 3, product* 4 * 2 * 4 * 3 * 8 * 3 * 7 * 3, index + 37383424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 7 + 3, product* 4 * 8 * 3 * 2 * 9 * 3 * 7 * 3, index + 37392384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 3 + 7 + 3, product* 4 * 6 * 6 * 3 * 9 * 3 * 7 * 3, index + 37393664);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 7 + 3, product* 6 * 3 * 3 * 2 * 2 * 4 * 7 * 3, index + 37422336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4 + 7 + 3, product* 8 * 4 * 8 * 2 * 2 * 4 * 7 * 3, index + 37422848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 7 + 3, product* 2 * 7 * 8 * 3 * 2 * 4 * 7 * 3, index + 37423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 7 + 3, product* 4 * 8 * 3 * 4 * 2 * 4 * 7 * 3, index + 37424384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 4 + 7 + 3, product* 6 * 9 * 8 * 4 * 2 * 4 * 7 * 3, index + 37424896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 7 + 3, product* 2 * 3 * 4 * 6 * 2 * 4 * 7 * 3, index + 37426432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 7 + 3, product* 4 * 2 * 2 * 8 * 2 * 4 * 7 * 3, index + 37428224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 4 + 7 + 3, product* 6 * 3 * 7 * 8 * 2 * 4 * 7 * 3, index + 37428736);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 7 + 3, product* 2 * 3 * 8 * 2 * 3 * 4 * 7 * 3, index + 37432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 7 + 3, product* 4 * 4 * 3 * 3 * 3 * 4 * 7 * 3, index + 37433344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 7 + 3, product* 4 * 2 * 6 * 4 * 3 * 4 * 7 * 3, index + 37434624);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 4 + 7 + 3, product* 6 * 7 * 9 * 8 * 3 * 4 * 7 * 3, index + 37438976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 7 + 3, product* 2 * 3 * 2 * 9 * 3 * 4 * 7 * 3, index + 37439232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 4 + 7 + 3, product* 8 * 8 * 4 * 9 * 3 * 4 * 7 * 3, index + 37439488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 7 + 3, product* 8 * 2 * 3 * 3 * 4 * 4 * 7 * 3, index + 37443328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 7 + 3, product* 4 * 2 * 4 * 7 * 4 * 4 * 7 * 3, index + 37447424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 4 + 7 + 3, product* 6 * 3 * 9 * 7 * 4 * 4 * 7 * 3, index + 37447936);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 4 + 7 + 3, product* 4 * 8 * 7 * 2 * 6 * 4 * 7 * 3, index + 37462784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 7 + 3, product* 2 * 3 * 8 * 4 * 6 * 4 * 7 * 3, index + 37464832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 4 + 7 + 3, product* 4 * 2 * 6 * 6 * 6 * 4 * 7 * 3, index + 37466624);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 7 + 3, product* 2 * 3 * 6 * 7 * 7 * 4 * 7 * 3, index + 37477632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 4 + 7 + 3, product* 4 * 2 * 4 * 9 * 7 * 4 * 7 * 3, index + 37479424);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 7 + 3, product* 4 * 2 * 2 * 2 * 9 * 4 * 7 * 3, index + 37492224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4 + 7 + 3, product* 8 * 4 * 2 * 3 * 9 * 4 * 7 * 3, index + 37493248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4 + 7 + 3, product* 2 * 7 * 2 * 4 * 9 * 4 * 7 * 3, index + 37494272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4 + 7 + 3, product* 2 * 3 * 8 * 6 * 9 * 4 * 7 * 3, index + 37496832);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 7 + 3, product* 2 * 7 * 2 * 2 * 2 * 6 * 7 * 3, index + 37622272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6 + 7 + 3, product* 4 * 8 * 7 * 2 * 2 * 6 * 7 * 3, index + 37622784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 7 + 3, product* 6 * 9 * 2 * 3 * 2 * 6 * 7 * 3, index + 37623296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 7 + 3, product* 2 * 3 * 8 * 4 * 2 * 6 * 7 * 3, index + 37624832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 7 + 3, product* 4 * 2 * 6 * 6 * 2 * 6 * 7 * 3, index + 37626624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 7 + 3, product* 2 * 9 * 3 * 7 * 2 * 6 * 7 * 3, index + 37627392);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 7 + 3, product* 4 * 2 * 4 * 9 * 3 * 6 * 7 * 3, index + 37639424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 7 + 3, product* 4 * 6 * 2 * 3 * 4 * 6 * 7 * 3, index + 37643264);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 6 + 7 + 3, product* 6 * 3 * 9 * 3 * 4 * 6 * 7 * 3, index + 37643936);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 7 + 3, product* 2 * 3 * 2 * 3 * 6 * 6 * 7 * 3, index + 37663232);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 6 + 7 + 3, product* 8 * 6 * 7 * 4 * 6 * 6 * 7 * 3, index + 37664768);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 6 + 7 + 3, product* 6 * 7 * 3 * 9 * 6 * 6 * 7 * 3, index + 37669376);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 7 + 3, product* 8 * 4 * 4 * 2 * 7 * 6 * 7 * 3, index + 37672448);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 7 + 3, product* 4 * 2 * 2 * 4 * 8 * 6 * 7 * 3, index + 37684224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 7 + 3, product* 2 * 7 * 2 * 6 * 8 * 6 * 7 * 3, index + 37686272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 6 + 7 + 3, product* 4 * 4 * 3 * 9 * 8 * 6 * 7 * 3, index + 37689344);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 7 + 3, product* 8 * 6 * 3 * 2 * 2 * 7 * 7 * 3, index + 37722368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 7 + 3, product* 4 * 2 * 6 * 2 * 2 * 7 * 7 * 3, index + 37722624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7 + 7 + 3, product* 2 * 7 * 6 * 4 * 2 * 7 * 7 * 3, index + 37724672);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 7 + 7 + 3, product* 4 * 6 * 8 * 2 * 3 * 7 * 7 * 3, index + 37732864);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 7 + 7 + 3, product* 8 * 8 * 8 * 3 * 3 * 7 * 7 * 3, index + 37733888);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 7 + 3, product* 2 * 7 * 4 * 7 * 3 * 7 * 7 * 3, index + 37737472);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 7 + 7 + 3, product* 2 * 3 * 4 * 6 * 4 * 7 * 7 * 3, index + 37746432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 7 + 7 + 3, product* 8 * 8 * 6 * 6 * 4 * 7 * 7 * 3, index + 37746688);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 7 + 3, product* 4 * 2 * 2 * 8 * 4 * 7 * 7 * 3, index + 37748224);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 7 + 7 + 3, product* 4 * 2 * 8 * 3 * 7 * 7 * 7 * 3, index + 37773824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 7 + 7 + 3, product* 2 * 3 * 4 * 8 * 7 * 7 * 7 * 3, index + 37778432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 7 + 3, product* 2 * 7 * 2 * 2 * 8 * 7 * 7 * 3, index + 37782272);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8 + 7 + 7 + 3, product* 8 * 4 * 6 * 7 * 8 * 7 * 7 * 3, index + 37787648);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 8 + 7 + 7 + 3, product* 6 * 9 * 6 * 9 * 8 * 7 * 7 * 3, index + 37789696);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 7 + 7 + 3, product* 4 * 2 * 4 * 9 * 9 * 7 * 7 * 3, index + 37799424);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 7 + 3, product* 2 * 3 * 2 * 3 * 2 * 8 * 7 * 3, index + 37823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 7 + 3, product* 4 * 4 * 7 * 3 * 2 * 8 * 7 * 3, index + 37823744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 8 + 7 + 3, product* 8 * 6 * 7 * 4 * 2 * 8 * 7 * 3, index + 37824768);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8 + 7 + 3, product* 2 * 3 * 6 * 9 * 2 * 8 * 7 * 3, index + 37829632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 7 + 3, product* 2 * 7 * 4 * 3 * 3 * 8 * 7 * 3, index + 37833472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 7 + 3, product* 8 * 2 * 7 * 3 * 3 * 8 * 7 * 3, index + 37833728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 7 + 3, product* 4 * 2 * 8 * 7 * 3 * 8 * 7 * 3, index + 37837824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 7 + 3, product* 2 * 3 * 4 * 2 * 4 * 8 * 7 * 3, index + 37842432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 7 + 3, product* 4 * 4 * 9 * 2 * 4 * 8 * 7 * 3, index + 37842944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 7 + 3, product* 4 * 2 * 2 * 4 * 4 * 8 * 7 * 3, index + 37844224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 7 + 3, product* 2 * 7 * 2 * 6 * 4 * 8 * 7 * 3, index + 37846272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 7 + 3, product* 4 * 2 * 4 * 3 * 6 * 8 * 7 * 3, index + 37863424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 8 + 7 + 3, product* 8 * 4 * 4 * 4 * 6 * 8 * 7 * 3, index + 37864448);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 8 + 7 + 3, product* 4 * 2 * 8 * 9 * 6 * 8 * 7 * 3, index + 37869824);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 8 + 7 + 3, product* 4 * 6 * 6 * 3 * 7 * 8 * 7 * 3, index + 37873664);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 7 + 3, product* 4 * 2 * 2 * 6 * 7 * 8 * 7 * 3, index + 37876224);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 8 + 7 + 3, product* 8 * 6 * 3 * 2 * 8 * 8 * 7 * 3, index + 37882368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 8 + 7 + 3, product* 2 * 9 * 3 * 3 * 8 * 8 * 7 * 3, index + 37883392);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 8 + 7 + 3, product* 4 * 4 * 7 * 7 * 8 * 8 * 7 * 3, index + 37887744);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 7 + 3, product* 4 * 2 * 4 * 7 * 2 * 9 * 7 * 3, index + 37927424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9 + 7 + 3, product* 2 * 7 * 4 * 9 * 2 * 9 * 7 * 3, index + 37929472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 9 + 7 + 3, product* 8 * 8 * 2 * 2 * 3 * 9 * 7 * 3, index + 37932288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 7 + 3, product* 4 * 2 * 8 * 3 * 3 * 9 * 7 * 3, index + 37933824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 7 + 3, product* 2 * 3 * 4 * 8 * 3 * 9 * 7 * 3, index + 37938432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 7 + 3, product* 2 * 7 * 2 * 2 * 4 * 9 * 7 * 3, index + 37942272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 7 + 3, product* 2 * 3 * 8 * 4 * 4 * 9 * 7 * 3, index + 37944832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 9 + 7 + 3, product* 4 * 2 * 6 * 6 * 4 * 9 * 7 * 3, index + 37946624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 9 + 7 + 3, product* 2 * 9 * 3 * 7 * 4 * 9 * 7 * 3, index + 37947392);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 7 + 3, product* 4 * 2 * 2 * 2 * 7 * 9 * 7 * 3, index + 37972224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 7 + 3, product* 2 * 7 * 2 * 4 * 7 * 9 * 7 * 3, index + 37974272);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 9 + 7 + 3, product* 4 * 6 * 4 * 2 * 8 * 9 * 7 * 3, index + 37982464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 7 + 3, product* 2 * 3 * 2 * 3 * 8 * 9 * 7 * 3, index + 37983232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 9 + 7 + 3, product* 8 * 4 * 4 * 2 * 9 * 9 * 7 * 3, index + 37992448);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 8 + 3, product* 6 * 3 * 3 * 2 * 2 * 2 * 8 * 3, index + 38222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 8 + 3, product* 8 * 4 * 8 * 2 * 2 * 2 * 8 * 3, index + 38222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 8 + 3, product* 2 * 7 * 8 * 3 * 2 * 2 * 8 * 3, index + 38223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 8 + 3, product* 4 * 8 * 3 * 4 * 2 * 2 * 8 * 3, index + 38224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 8 + 3, product* 2 * 3 * 4 * 6 * 2 * 2 * 8 * 3, index + 38226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 8 + 3, product* 4 * 4 * 9 * 6 * 2 * 2 * 8 * 3, index + 38226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 8 + 3, product* 4 * 2 * 2 * 8 * 2 * 2 * 8 * 3, index + 38228224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 8 + 3, product* 2 * 3 * 8 * 2 * 3 * 2 * 8 * 3, index + 38232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 8 + 3, product* 4 * 4 * 3 * 3 * 3 * 2 * 8 * 3, index + 38233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 8 + 3, product* 8 * 6 * 3 * 4 * 3 * 2 * 8 * 3, index + 38234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 8 + 3, product* 4 * 2 * 6 * 4 * 3 * 2 * 8 * 3, index + 38234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 8 + 3, product* 2 * 7 * 6 * 6 * 3 * 2 * 8 * 3, index + 38236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 8 + 3, product* 8 * 2 * 9 * 6 * 3 * 2 * 8 * 3, index + 38236928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 8 + 3, product* 4 * 6 * 4 * 8 * 3 * 2 * 8 * 3, index + 38238464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 8 + 3, product* 2 * 3 * 2 * 9 * 3 * 2 * 8 * 3, index + 38239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 8 + 3, product* 8 * 8 * 4 * 9 * 3 * 2 * 8 * 3, index + 38239488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 8 + 3, product* 8 * 2 * 3 * 3 * 4 * 2 * 8 * 3, index + 38243328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 8 + 3, product* 4 * 6 * 8 * 4 * 4 * 2 * 8 * 3, index + 38244864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 8 + 3, product* 4 * 2 * 4 * 7 * 4 * 2 * 8 * 3, index + 38247424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 8 + 3, product* 2 * 7 * 2 * 2 * 6 * 2 * 8 * 3, index + 38262272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 8 + 3, product* 6 * 9 * 2 * 3 * 6 * 2 * 8 * 3, index + 38263296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 8 + 3, product* 2 * 3 * 8 * 4 * 6 * 2 * 8 * 3, index + 38264832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 6 + 2 + 8 + 3, product* 8 * 6 * 3 * 6 * 6 * 2 * 8 * 3, index + 38266368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 8 + 3, product* 4 * 2 * 6 * 6 * 6 * 2 * 8 * 3, index + 38266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 8 + 3, product* 2 * 9 * 3 * 7 * 6 * 2 * 8 * 3, index + 38267392);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 8 + 3, product* 8 * 6 * 7 * 2 * 7 * 2 * 8 * 3, index + 38272768);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 8 + 3, product* 2 * 3 * 6 * 7 * 7 * 2 * 8 * 3, index + 38277632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 8 + 3, product* 4 * 6 * 2 * 3 * 8 * 2 * 8 * 3, index + 38283264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 2 + 8 + 3, product* 6 * 7 * 7 * 3 * 8 * 2 * 8 * 3, index + 38283776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 8 + 3, product* 8 * 8 * 2 * 4 * 8 * 2 * 8 * 3, index + 38284288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 8 + 3, product* 6 * 3 * 3 * 6 * 8 * 2 * 8 * 3, index + 38286336);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 8 + 3, product* 2 * 9 * 9 * 2 * 9 * 2 * 8 * 3, index + 38292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 8 + 3, product* 8 * 4 * 2 * 3 * 9 * 2 * 8 * 3, index + 38293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 8 + 3, product* 2 * 7 * 2 * 4 * 9 * 2 * 8 * 3, index + 38294272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 8 + 3, product* 4 * 4 * 3 * 7 * 9 * 2 * 8 * 3, index + 38297344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2 + 8 + 3, product* 4 * 2 * 6 * 8 * 9 * 2 * 8 * 3, index + 38298624);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 8 + 3, product* 2 * 3 * 4 * 2 * 2 * 3 * 8 * 3, index + 38322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 8 + 3, product* 4 * 4 * 9 * 2 * 2 * 3 * 8 * 3, index + 38322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 8 + 3, product* 4 * 2 * 2 * 4 * 2 * 3 * 8 * 3, index + 38324224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 8 + 3, product* 2 * 7 * 2 * 6 * 2 * 3 * 8 * 3, index + 38326272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 8 + 3, product* 4 * 4 * 3 * 9 * 2 * 3 * 8 * 3, index + 38329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 8 + 3, product* 2 * 7 * 6 * 2 * 3 * 3 * 8 * 3, index + 38332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 8 + 3, product* 8 * 2 * 9 * 2 * 3 * 3 * 8 * 3, index + 38332928);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3 + 8 + 3, product* 6 * 7 * 9 * 4 * 3 * 3 * 8 * 3, index + 38334976);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 8 + 3, product* 8 * 2 * 3 * 9 * 3 * 3 * 8 * 3, index + 38339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 8 + 3, product* 4 * 2 * 4 * 3 * 4 * 3 * 8 * 3, index + 38343424);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3 + 8 + 3, product* 6 * 9 * 4 * 6 * 4 * 3 * 8 * 3, index + 38346496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 8 + 3, product* 4 * 6 * 2 * 7 * 4 * 3 * 8 * 3, index + 38347264);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 8 + 3, product* 4 * 2 * 6 * 2 * 6 * 3 * 8 * 3, index + 38362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 8 + 3, product* 2 * 9 * 3 * 3 * 6 * 3 * 8 * 3, index + 38363392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 8 + 3, product* 4 * 6 * 4 * 6 * 6 * 3 * 8 * 3, index + 38366464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 8 + 3, product* 2 * 3 * 2 * 7 * 6 * 3 * 8 * 3, index + 38367232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 8 + 3, product* 2 * 3 * 6 * 3 * 7 * 3 * 8 * 3, index + 38373632);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 8 + 3, product* 4 * 6 * 2 * 9 * 7 * 3 * 8 * 3, index + 38379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 8 + 3, product* 6 * 3 * 3 * 2 * 8 * 3 * 8 * 3, index + 38382336);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 8 + 3, product* 2 * 3 * 8 * 2 * 9 * 3 * 8 * 3, index + 38392832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 8 + 3, product* 2 * 3 * 2 * 9 * 9 * 3 * 8 * 3, index + 38399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 8 + 3, product* 2 * 7 * 2 * 2 * 2 * 4 * 8 * 3, index + 38422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 8 + 3, product* 4 * 8 * 7 * 2 * 2 * 4 * 8 * 3, index + 38422784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 8 + 3, product* 2 * 3 * 8 * 4 * 2 * 4 * 8 * 3, index + 38424832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 8 + 3, product* 2 * 9 * 3 * 7 * 2 * 4 * 8 * 3, index + 38427392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 4 + 8 + 3, product* 8 * 4 * 6 * 7 * 2 * 4 * 8 * 3, index + 38427648);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 8 + 3, product* 4 * 6 * 2 * 3 * 4 * 4 * 8 * 3, index + 38443264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 8 + 3, product* 6 * 3 * 3 * 6 * 4 * 4 * 8 * 3, index + 38446336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 8 + 3, product* 4 * 6 * 4 * 2 * 6 * 4 * 8 * 3, index + 38462464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 8 + 3, product* 2 * 3 * 2 * 3 * 6 * 4 * 8 * 3, index + 38463232);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 8 + 3, product* 6 * 3 * 3 * 8 * 7 * 4 * 8 * 3, index + 38478336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 8 + 3, product* 2 * 3 * 4 * 2 * 8 * 4 * 8 * 3, index + 38482432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 8 + 3, product* 4 * 2 * 2 * 4 * 8 * 4 * 8 * 3, index + 38484224);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 4 + 8 + 3, product* 4 * 6 * 4 * 4 * 9 * 4 * 8 * 3, index + 38494464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 4 + 8 + 3, product* 6 * 7 * 9 * 4 * 9 * 4 * 8 * 3, index + 38494976);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 8 + 3, product* 4 * 6 * 4 * 2 * 2 * 6 * 8 * 3, index + 38622464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 8 + 3, product* 2 * 3 * 2 * 3 * 2 * 6 * 8 * 3, index + 38623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 8 + 3, product* 4 * 4 * 7 * 3 * 2 * 6 * 8 * 3, index + 38623744);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 8 + 3, product* 6 * 7 * 3 * 9 * 2 * 6 * 8 * 3, index + 38629376);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 8 + 3, product* 2 * 7 * 4 * 3 * 3 * 6 * 8 * 3, index + 38633472);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 8 + 3, product* 4 * 2 * 2 * 4 * 4 * 6 * 8 * 3, index + 38644224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 6 + 8 + 3, product* 6 * 3 * 7 * 4 * 4 * 6 * 8 * 3, index + 38644736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 8 + 3, product* 2 * 7 * 2 * 6 * 4 * 6 * 8 * 3, index + 38646272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 8 + 3, product* 6 * 9 * 2 * 7 * 4 * 6 * 8 * 3, index + 38647296);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 6 + 8 + 3, product* 4 * 4 * 3 * 9 * 4 * 6 * 8 * 3, index + 38649344);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 8 + 3, product* 2 * 3 * 2 * 7 * 8 * 6 * 8 * 3, index + 38687232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6 + 8 + 3, product* 4 * 6 * 8 * 2 * 9 * 6 * 8 * 3, index + 38692864);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 6 + 8 + 3, product* 4 * 6 * 2 * 9 * 9 * 6 * 8 * 3, index + 38699264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 8 + 3, product* 8 * 2 * 3 * 3 * 2 * 7 * 8 * 3, index + 38723328);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 8 + 3, product* 8 * 4 * 4 * 8 * 2 * 7 * 8 * 3, index + 38728448);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 8 + 3, product* 4 * 8 * 3 * 6 * 3 * 7 * 8 * 3, index + 38736384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 8 + 3, product* 2 * 3 * 4 * 8 * 3 * 7 * 8 * 3, index + 38738432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 8 + 3, product* 2 * 7 * 2 * 2 * 4 * 7 * 8 * 3, index + 38742272);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 7 + 8 + 3, product* 8 * 4 * 8 * 6 * 6 * 7 * 8 * 3, index + 38766848);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 8 + 3, product* 4 * 2 * 2 * 2 * 7 * 7 * 8 * 3, index + 38772224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 8 + 3, product* 2 * 7 * 2 * 4 * 7 * 7 * 8 * 3, index + 38774272);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 7 + 8 + 3, product* 2 * 9 * 3 * 9 * 7 * 7 * 8 * 3, index + 38779392);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 8 + 3, product* 2 * 3 * 2 * 3 * 8 * 7 * 8 * 3, index + 38783232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7 + 8 + 3, product* 4 * 4 * 7 * 3 * 8 * 7 * 8 * 3, index + 38783744);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 8 + 3, product* 4 * 2 * 4 * 3 * 2 * 8 * 8 * 3, index + 38823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 8 + 3, product* 6 * 3 * 9 * 3 * 2 * 8 * 8 * 3, index + 38823936);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 8 + 8 + 3, product* 4 * 6 * 6 * 3 * 3 * 8 * 8 * 3, index + 38833664);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 8 + 3, product* 4 * 2 * 2 * 6 * 3 * 8 * 8 * 3, index + 38836224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 8 + 3, product* 2 * 7 * 2 * 8 * 3 * 8 * 8 * 3, index + 38838272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 8 + 3, product* 4 * 2 * 6 * 2 * 4 * 8 * 8 * 3, index + 38842624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 8 + 3, product* 2 * 9 * 3 * 3 * 4 * 8 * 8 * 3, index + 38843392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8 + 8 + 3, product* 4 * 6 * 4 * 6 * 4 * 8 * 8 * 3, index + 38846464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 8 + 3, product* 2 * 3 * 2 * 7 * 4 * 8 * 8 * 3, index + 38847232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 8 + 3, product* 6 * 3 * 3 * 2 * 6 * 8 * 8 * 3, index + 38862336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 8 + 3, product* 2 * 7 * 8 * 3 * 6 * 8 * 8 * 3, index + 38863872);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 8 + 3, product* 2 * 3 * 8 * 2 * 7 * 8 * 8 * 3, index + 38872832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 8 + 3, product* 4 * 2 * 6 * 4 * 7 * 8 * 8 * 3, index + 38874624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 8 + 3, product* 2 * 3 * 2 * 9 * 7 * 8 * 8 * 3, index + 38879232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 8 + 3, product* 8 * 2 * 3 * 3 * 8 * 8 * 8 * 3, index + 38883328);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 8 + 3, product* 4 * 2 * 8 * 3 * 9 * 8 * 8 * 3, index + 38893824);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 8 + 3, product* 4 * 6 * 2 * 3 * 2 * 9 * 8 * 3, index + 38923264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 8 + 3, product* 6 * 3 * 3 * 6 * 2 * 9 * 8 * 3, index + 38926336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 9 + 8 + 3, product* 2 * 7 * 8 * 7 * 2 * 9 * 8 * 3, index + 38927872);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 9 + 8 + 3, product* 6 * 9 * 8 * 8 * 2 * 9 * 8 * 3, index + 38928896);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 8 + 3, product* 6 * 3 * 7 * 2 * 3 * 9 * 8 * 3, index + 38932736);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 8 + 3, product* 2 * 7 * 2 * 4 * 3 * 9 * 8 * 3, index + 38934272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 9 + 8 + 3, product* 4 * 8 * 7 * 4 * 3 * 9 * 8 * 3, index + 38934784);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 8 + 3, product* 2 * 3 * 2 * 3 * 4 * 9 * 8 * 3, index + 38943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 8 + 3, product* 4 * 4 * 7 * 3 * 4 * 9 * 8 * 3, index + 38943744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 8 + 3, product* 8 * 2 * 3 * 7 * 4 * 9 * 8 * 3, index + 38947328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 8 + 3, product* 2 * 3 * 4 * 2 * 6 * 9 * 8 * 3, index + 38962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 8 + 3, product* 4 * 2 * 2 * 4 * 6 * 9 * 8 * 3, index + 38964224);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 9 + 8 + 3, product* 2 * 7 * 6 * 2 * 7 * 9 * 8 * 3, index + 38972672);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 9 + 3, product* 2 * 7 * 2 * 2 * 2 * 2 * 9 * 3, index + 39222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 9 + 3, product* 4 * 8 * 7 * 2 * 2 * 2 * 9 * 3, index + 39222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 9 + 3, product* 6 * 9 * 2 * 3 * 2 * 2 * 9 * 3, index + 39223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 9 + 3, product* 2 * 3 * 8 * 4 * 2 * 2 * 9 * 3, index + 39224832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 9 + 3, product* 4 * 2 * 6 * 6 * 2 * 2 * 9 * 3, index + 39226624);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 9 + 3, product* 8 * 2 * 9 * 8 * 2 * 2 * 9 * 3, index + 39228928);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 9 + 3, product* 2 * 9 * 7 * 3 * 3 * 2 * 9 * 3, index + 39233792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 9 + 3, product* 4 * 6 * 8 * 6 * 3 * 2 * 9 * 3, index + 39236864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 9 + 3, product* 2 * 3 * 6 * 7 * 3 * 2 * 9 * 3, index + 39237632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 9 + 3, product* 4 * 2 * 4 * 9 * 3 * 2 * 9 * 3, index + 39239424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 9 + 3, product* 4 * 6 * 2 * 3 * 4 * 2 * 9 * 3, index + 39243264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 9 + 3, product* 8 * 8 * 2 * 4 * 4 * 2 * 9 * 3, index + 39244288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 9 + 3, product* 6 * 3 * 3 * 6 * 4 * 2 * 9 * 3, index + 39246336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 9 + 3, product* 4 * 8 * 3 * 8 * 4 * 2 * 9 * 3, index + 39248384);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 9 + 3, product* 2 * 3 * 2 * 3 * 6 * 2 * 9 * 3, index + 39263232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 9 + 3, product* 8 * 2 * 3 * 7 * 6 * 2 * 9 * 3, index + 39267328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 9 + 3, product* 8 * 4 * 4 * 2 * 7 * 2 * 9 * 3, index + 39272448);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 9 + 3, product* 4 * 2 * 8 * 7 * 7 * 2 * 9 * 3, index + 39277824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 9 + 3, product* 2 * 3 * 4 * 2 * 8 * 2 * 9 * 3, index + 39282432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 9 + 3, product* 4 * 4 * 9 * 2 * 8 * 2 * 9 * 3, index + 39282944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 9 + 3, product* 4 * 2 * 2 * 4 * 8 * 2 * 9 * 3, index + 39284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 9 + 3, product* 6 * 3 * 7 * 4 * 8 * 2 * 9 * 3, index + 39284736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 9 + 3, product* 2 * 7 * 2 * 6 * 8 * 2 * 9 * 3, index + 39286272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 2 + 9 + 3, product* 4 * 4 * 3 * 9 * 8 * 2 * 9 * 3, index + 39289344);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 9 + 3, product* 4 * 6 * 4 * 4 * 9 * 2 * 9 * 3, index + 39294464);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 9 + 3, product* 4 * 2 * 6 * 2 * 2 * 3 * 9 * 3, index + 39322624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 9 + 3, product* 8 * 4 * 6 * 3 * 2 * 3 * 9 * 3, index + 39323648);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 9 + 3, product* 8 * 2 * 9 * 4 * 2 * 3 * 9 * 3, index + 39324928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 9 + 3, product* 4 * 6 * 4 * 6 * 2 * 3 * 9 * 3, index + 39326464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 9 + 3, product* 2 * 3 * 2 * 7 * 2 * 3 * 9 * 3, index + 39327232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 9 + 3, product* 4 * 4 * 7 * 7 * 2 * 3 * 9 * 3, index + 39327744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3 + 9 + 3, product* 8 * 6 * 7 * 8 * 2 * 3 * 9 * 3, index + 39328768);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 9 + 3, product* 2 * 9 * 7 * 9 * 2 * 3 * 9 * 3, index + 39329792);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 9 + 3, product* 6 * 7 * 3 * 3 * 3 * 3 * 9 * 3, index + 39333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 9 + 3, product* 2 * 3 * 6 * 3 * 3 * 3 * 9 * 3, index + 39333632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 9 + 3, product* 2 * 7 * 4 * 7 * 3 * 3 * 9 * 3, index + 39337472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 3 + 9 + 3, product* 8 * 2 * 7 * 7 * 3 * 3 * 9 * 3, index + 39337728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3 + 3 + 9 + 3, product* 4 * 8 * 9 * 7 * 3 * 3 * 9 * 3, index + 39337984);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 9 + 3, product* 4 * 6 * 2 * 9 * 3 * 3 * 9 * 3, index + 39339264);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 9 + 3, product* 8 * 4 * 8 * 2 * 4 * 3 * 9 * 3, index + 39342848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 9 + 3, product* 2 * 7 * 8 * 3 * 4 * 3 * 9 * 3, index + 39343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 9 + 3, product* 4 * 8 * 3 * 4 * 4 * 3 * 9 * 3, index + 39344384);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 9 + 3, product* 4 * 2 * 2 * 8 * 4 * 3 * 9 * 3, index + 39348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 9 + 3, product* 6 * 3 * 7 * 8 * 4 * 3 * 9 * 3, index + 39348736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 9 + 3, product* 8 * 4 * 2 * 9 * 4 * 3 * 9 * 3, index + 39349248);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 9 + 3, product* 4 * 2 * 4 * 7 * 6 * 3 * 9 * 3, index + 39367424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 9 + 3, product* 4 * 2 * 8 * 3 * 7 * 3 * 9 * 3, index + 39373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 9 + 3, product* 6 * 3 * 3 * 4 * 7 * 3 * 9 * 3, index + 39374336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 9 + 3, product* 2 * 3 * 4 * 8 * 7 * 3 * 9 * 3, index + 39378432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 9 + 3, product* 2 * 7 * 2 * 2 * 8 * 3 * 9 * 3, index + 39382272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 9 + 3, product* 2 * 3 * 8 * 4 * 8 * 3 * 9 * 3, index + 39384832);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 9 + 3 + 9 + 3, product* 8 * 6 * 7 * 2 * 9 * 3 * 9 * 3, index + 39392768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3 + 9 + 3, product* 2 * 9 * 7 * 3 * 9 * 3 * 9 * 3, index + 39393792);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 9 + 3, product* 6 * 7 * 9 * 2 * 2 * 4 * 9 * 3, index + 39422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 9 + 3, product* 2 * 3 * 2 * 3 * 2 * 4 * 9 * 3, index + 39423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 9 + 3, product* 8 * 8 * 4 * 3 * 2 * 4 * 9 * 3, index + 39423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 9 + 3, product* 4 * 4 * 7 * 3 * 2 * 4 * 9 * 3, index + 39423744);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 9 + 3, product* 2 * 7 * 4 * 3 * 3 * 4 * 9 * 3, index + 39433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 9 + 3, product* 8 * 2 * 7 * 3 * 3 * 4 * 9 * 3, index + 39433728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 9 + 3, product* 4 * 8 * 9 * 3 * 3 * 4 * 9 * 3, index + 39433984);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 9 + 3, product* 6 * 3 * 3 * 8 * 3 * 4 * 9 * 3, index + 39438336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 9 + 3, product* 2 * 3 * 2 * 9 * 3 * 4 * 9 * 3, index + 39439232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 9 + 3, product* 2 * 3 * 4 * 2 * 4 * 4 * 9 * 3, index + 39442432);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 9 + 3, product* 4 * 4 * 3 * 9 * 4 * 4 * 9 * 3, index + 39449344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 9 + 3, product* 4 * 2 * 4 * 3 * 6 * 4 * 9 * 3, index + 39463424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 9 + 3, product* 4 * 6 * 2 * 7 * 6 * 4 * 9 * 3, index + 39467264);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 9 + 3, product* 2 * 3 * 4 * 4 * 7 * 4 * 9 * 3, index + 39474432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 9 + 3, product* 4 * 2 * 6 * 2 * 8 * 4 * 9 * 3, index + 39482624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 9 + 3, product* 2 * 9 * 3 * 3 * 8 * 4 * 9 * 3, index + 39483392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 4 + 9 + 3, product* 8 * 4 * 6 * 3 * 8 * 4 * 9 * 3, index + 39483648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 9 + 3, product* 2 * 3 * 2 * 7 * 8 * 4 * 9 * 3, index + 39487232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 4 + 9 + 3, product* 4 * 6 * 8 * 2 * 9 * 4 * 9 * 3, index + 39492864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 9 + 3, product* 2 * 3 * 6 * 3 * 9 * 4 * 9 * 3, index + 39493632);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 9 + 3, product* 8 * 4 * 4 * 4 * 2 * 6 * 9 * 3, index + 39624448);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 9 + 3, product* 2 * 3 * 4 * 4 * 3 * 6 * 9 * 3, index + 39634432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 9 + 3, product* 4 * 2 * 2 * 6 * 3 * 6 * 9 * 3, index + 39636224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 6 + 9 + 3, product* 8 * 4 * 2 * 7 * 3 * 6 * 9 * 3, index + 39637248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 9 + 3, product* 2 * 7 * 2 * 8 * 3 * 6 * 9 * 3, index + 39638272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 9 + 3, product* 4 * 2 * 6 * 2 * 4 * 6 * 9 * 3, index + 39642624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 9 + 3, product* 2 * 7 * 6 * 4 * 4 * 6 * 9 * 3, index + 39644672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 9 + 3, product* 2 * 3 * 2 * 7 * 4 * 6 * 9 * 3, index + 39647232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 9 + 3, product* 6 * 3 * 3 * 2 * 6 * 6 * 9 * 3, index + 39662336);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 9 + 3, product* 2 * 3 * 8 * 2 * 7 * 6 * 9 * 3, index + 39672832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 9 + 3, product* 4 * 2 * 6 * 4 * 7 * 6 * 9 * 3, index + 39674624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 9 + 3, product* 2 * 3 * 2 * 9 * 7 * 6 * 9 * 3, index + 39679232);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 8 + 6 + 9 + 3, product* 4 * 6 * 8 * 4 * 8 * 6 * 9 * 3, index + 39684864);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 8 + 6 + 9 + 3, product* 8 * 4 * 4 * 8 * 8 * 6 * 9 * 3, index + 39688448);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 9 + 3, product* 4 * 6 * 2 * 3 * 2 * 7 * 9 * 3, index + 39723264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 9 + 3, product* 8 * 8 * 2 * 4 * 2 * 7 * 9 * 3, index + 39724288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7 + 9 + 3, product* 6 * 3 * 3 * 6 * 2 * 7 * 9 * 3, index + 39726336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 9 + 3, product* 4 * 2 * 2 * 2 * 3 * 7 * 9 * 3, index + 39732224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 9 + 3, product* 2 * 7 * 2 * 4 * 3 * 7 * 9 * 3, index + 39734272);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 9 + 3, product* 2 * 3 * 2 * 3 * 4 * 7 * 9 * 3, index + 39743232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 7 + 9 + 3, product* 8 * 8 * 4 * 3 * 4 * 7 * 9 * 3, index + 39743488);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 9 + 3, product* 2 * 3 * 4 * 2 * 6 * 7 * 9 * 3, index + 39762432);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 9 + 3, product* 2 * 3 * 4 * 4 * 9 * 7 * 9 * 3, index + 39794432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7 + 9 + 3, product* 4 * 2 * 2 * 6 * 9 * 7 * 9 * 3, index + 39796224);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 9 + 3, product* 6 * 3 * 3 * 2 * 2 * 8 * 9 * 3, index + 39822336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 8 + 9 + 3, product* 8 * 4 * 8 * 2 * 2 * 8 * 9 * 3, index + 39822848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 9 + 3, product* 2 * 7 * 8 * 3 * 2 * 8 * 9 * 3, index + 39823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 9 + 3, product* 4 * 8 * 3 * 4 * 2 * 8 * 9 * 3, index + 39824384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 9 + 3, product* 2 * 3 * 4 * 6 * 2 * 8 * 9 * 3, index + 39826432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 9 + 3, product* 4 * 2 * 2 * 8 * 2 * 8 * 9 * 3, index + 39828224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 9 + 3, product* 8 * 4 * 2 * 9 * 2 * 8 * 9 * 3, index + 39829248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 9 + 3, product* 2 * 3 * 8 * 2 * 3 * 8 * 9 * 3, index + 39832832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 9 + 3, product* 2 * 3 * 2 * 9 * 3 * 8 * 9 * 3, index + 39839232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 9 + 3, product* 2 * 7 * 2 * 2 * 6 * 8 * 9 * 3, index + 39862272);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 9 + 3, product* 4 * 6 * 2 * 3 * 8 * 8 * 9 * 3, index + 39883264);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 9 + 3, product* 2 * 3 * 4 * 2 * 2 * 9 * 9 * 3, index + 39922432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 9 + 3, product* 4 * 2 * 2 * 4 * 2 * 9 * 9 * 3, index + 39924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 9 + 3, product* 6 * 3 * 7 * 4 * 2 * 9 * 9 * 3, index + 39924736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 9 + 3, product* 2 * 7 * 2 * 6 * 2 * 9 * 9 * 3, index + 39926272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 9 + 9 + 3, product* 6 * 9 * 2 * 7 * 2 * 9 * 9 * 3, index + 39927296);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 9 + 3, product* 2 * 7 * 6 * 2 * 3 * 9 * 9 * 3, index + 39932672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 9 + 9 + 3, product* 8 * 2 * 9 * 2 * 3 * 9 * 9 * 3, index + 39932928);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 9 + 9 + 3, product* 6 * 7 * 9 * 4 * 3 * 9 * 9 * 3, index + 39934976);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 9 + 9 + 3, product* 8 * 4 * 6 * 3 * 6 * 9 * 9 * 3, index + 39963648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 9 + 3, product* 2 * 3 * 2 * 7 * 6 * 9 * 9 * 3, index + 39967232);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 9 + 9 + 3, product* 6 * 7 * 9 * 4 * 7 * 9 * 9 * 3, index + 39974976);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 9 + 9 + 3, product* 4 * 6 * 4 * 8 * 9 * 9 * 9 * 3, index + 39998464);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 2 + 4, product* 6 * 3 * 3 * 2 * 2 * 2 * 2 * 4, index + 42222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 2 + 4, product* 8 * 4 * 8 * 2 * 2 * 2 * 2 * 4, index + 42222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 2 + 4, product* 2 * 7 * 8 * 3 * 2 * 2 * 2 * 4, index + 42223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 2 + 4, product* 4 * 8 * 3 * 4 * 2 * 2 * 2 * 4, index + 42224384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 2 + 4, product* 6 * 9 * 8 * 4 * 2 * 2 * 2 * 4, index + 42224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 2 + 4, product* 2 * 3 * 4 * 6 * 2 * 2 * 2 * 4, index + 42226432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 2 + 2 + 4, product* 8 * 8 * 6 * 6 * 2 * 2 * 2 * 4, index + 42226688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 2 + 4, product* 4 * 4 * 9 * 6 * 2 * 2 * 2 * 4, index + 42226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 2 + 4, product* 4 * 2 * 2 * 8 * 2 * 2 * 2 * 4, index + 42228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 2 + 4, product* 6 * 3 * 7 * 8 * 2 * 2 * 2 * 4, index + 42228736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 2 + 4, product* 2 * 9 * 9 * 8 * 2 * 2 * 2 * 4, index + 42228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 2 + 4, product* 8 * 4 * 2 * 9 * 2 * 2 * 2 * 4, index + 42229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 2 + 4, product* 2 * 3 * 8 * 2 * 3 * 2 * 2 * 4, index + 42232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 2 + 4, product* 4 * 4 * 3 * 3 * 3 * 2 * 2 * 4, index + 42233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 2 + 4, product* 8 * 6 * 3 * 4 * 3 * 2 * 2 * 4, index + 42234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 2 + 4, product* 4 * 2 * 6 * 4 * 3 * 2 * 2 * 4, index + 42234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 2 + 4, product* 2 * 7 * 6 * 6 * 3 * 2 * 2 * 4, index + 42236672);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 2 + 4, product* 6 * 9 * 6 * 7 * 3 * 2 * 2 * 4, index + 42237696);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 2 + 4, product* 4 * 6 * 4 * 8 * 3 * 2 * 2 * 4, index + 42238464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 2 + 4, product* 2 * 3 * 2 * 9 * 3 * 2 * 2 * 4, index + 42239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 2 + 4, product* 8 * 8 * 4 * 9 * 3 * 2 * 2 * 4, index + 42239488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 2 + 4, product* 8 * 2 * 3 * 3 * 4 * 2 * 2 * 4, index + 42243328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 2 + 4, product* 4 * 6 * 8 * 4 * 4 * 2 * 2 * 4, index + 42244864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 2 + 4, product* 4 * 2 * 4 * 7 * 4 * 2 * 2 * 4, index + 42247424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 2 + 4, product* 6 * 3 * 9 * 7 * 4 * 2 * 2 * 4, index + 42247936);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 2 + 4, product* 2 * 7 * 4 * 9 * 4 * 2 * 2 * 4, index + 42249472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 2 + 4, product* 8 * 2 * 7 * 9 * 4 * 2 * 2 * 4, index + 42249728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 2 + 4, product* 2 * 7 * 2 * 2 * 6 * 2 * 2 * 4, index + 42262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 2 + 4, product* 4 * 8 * 7 * 2 * 6 * 2 * 2 * 4, index + 42262784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 2 + 4, product* 6 * 9 * 2 * 3 * 6 * 2 * 2 * 4, index + 42263296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 2 + 4, product* 2 * 3 * 8 * 4 * 6 * 2 * 2 * 4, index + 42264832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 2 + 4, product* 4 * 2 * 6 * 6 * 6 * 2 * 2 * 4, index + 42266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 2 + 4, product* 2 * 9 * 3 * 7 * 6 * 2 * 2 * 4, index + 42267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 2 + 4, product* 8 * 4 * 6 * 7 * 6 * 2 * 2 * 4, index + 42267648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 2 + 4, product* 2 * 7 * 6 * 8 * 6 * 2 * 2 * 4, index + 42268672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 2 + 4, product* 8 * 2 * 9 * 8 * 6 * 2 * 2 * 4, index + 42268928);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 2 + 4, product* 8 * 6 * 7 * 2 * 7 * 2 * 2 * 4, index + 42272768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 2 + 4, product* 2 * 9 * 7 * 3 * 7 * 2 * 2 * 4, index + 42273792);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 7 + 2 + 2 + 4, product* 6 * 7 * 3 * 7 * 7 * 2 * 2 * 4, index + 42277376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 2 + 4, product* 2 * 3 * 6 * 7 * 7 * 2 * 2 * 4, index + 42277632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 2 + 4, product* 4 * 2 * 4 * 9 * 7 * 2 * 2 * 4, index + 42279424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 2 + 2 + 4, product* 6 * 9 * 4 * 2 * 8 * 2 * 2 * 4, index + 42282496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 2 + 4, product* 4 * 6 * 2 * 3 * 8 * 2 * 2 * 4, index + 42283264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 2 + 4, product* 6 * 3 * 3 * 6 * 8 * 2 * 2 * 4, index + 42286336);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 2 + 2 + 4, product* 8 * 4 * 8 * 6 * 8 * 2 * 2 * 4, index + 42286848);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2 + 2 + 4, product* 4 * 8 * 3 * 8 * 8 * 2 * 2 * 4, index + 42288384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8 + 2 + 2 + 4, product* 6 * 9 * 8 * 8 * 8 * 2 * 2 * 4, index + 42288896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 2 + 4, product* 4 * 6 * 6 * 9 * 8 * 2 * 2 * 4, index + 42289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 2 + 4, product* 4 * 2 * 2 * 2 * 9 * 2 * 2 * 4, index + 42292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 2 + 4, product* 6 * 3 * 7 * 2 * 9 * 2 * 2 * 4, index + 42292736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 2 + 4, product* 8 * 4 * 2 * 3 * 9 * 2 * 2 * 4, index + 42293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 2 + 4, product* 2 * 7 * 2 * 4 * 9 * 2 * 2 * 4, index + 42294272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 2 + 4, product* 2 * 3 * 8 * 6 * 9 * 2 * 2 * 4, index + 42296832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 2 + 4, product* 4 * 4 * 3 * 7 * 9 * 2 * 2 * 4, index + 42297344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 2 + 4, product* 2 * 9 * 3 * 9 * 9 * 2 * 2 * 4, index + 42299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 2 + 4, product* 2 * 3 * 4 * 2 * 2 * 3 * 2 * 4, index + 42322432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3 + 2 + 4, product* 8 * 8 * 6 * 2 * 2 * 3 * 2 * 4, index + 42322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 2 + 4, product* 4 * 4 * 9 * 2 * 2 * 3 * 2 * 4, index + 42322944);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 2 + 4, product* 2 * 9 * 3 * 3 * 2 * 3 * 2 * 4, index + 42323392);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3 + 2 + 4, product* 8 * 6 * 9 * 3 * 2 * 3 * 2 * 4, index + 42323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 2 + 4, product* 4 * 2 * 2 * 4 * 2 * 3 * 2 * 4, index + 42324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 2 + 4, product* 6 * 3 * 7 * 4 * 2 * 3 * 2 * 4, index + 42324736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 2 + 4, product* 2 * 9 * 9 * 4 * 2 * 3 * 2 * 4, index + 42324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 2 + 4, product* 2 * 7 * 2 * 6 * 2 * 3 * 2 * 4, index + 42326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 2 + 4, product* 4 * 8 * 7 * 6 * 2 * 3 * 2 * 4, index + 42326784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 2 + 4, product* 2 * 3 * 8 * 8 * 2 * 3 * 2 * 4, index + 42328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 2 + 4, product* 4 * 4 * 3 * 9 * 2 * 3 * 2 * 4, index + 42329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 2 + 4, product* 2 * 7 * 6 * 2 * 3 * 3 * 2 * 4, index + 42332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 2 + 4, product* 8 * 2 * 9 * 2 * 3 * 3 * 2 * 4, index + 42332928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 3 + 2 + 4, product* 6 * 9 * 6 * 3 * 3 * 3 * 2 * 4, index + 42333696);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 2 + 4, product* 4 * 6 * 4 * 4 * 3 * 3 * 2 * 4, index + 42334464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 2 + 4, product* 2 * 9 * 7 * 7 * 3 * 3 * 2 * 4, index + 42337792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 2 + 4, product* 8 * 2 * 3 * 9 * 3 * 3 * 2 * 4, index + 42339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 2 + 4, product* 4 * 2 * 4 * 3 * 4 * 3 * 2 * 4, index + 42343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 2 + 4, product* 6 * 3 * 9 * 3 * 4 * 3 * 2 * 4, index + 42343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 2 + 4, product* 8 * 4 * 4 * 4 * 4 * 3 * 2 * 4, index + 42344448);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3 + 2 + 4, product* 8 * 6 * 3 * 2 * 6 * 3 * 2 * 4, index + 42362368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 2 + 4, product* 4 * 2 * 6 * 2 * 6 * 3 * 2 * 4, index + 42362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 2 + 4, product* 2 * 9 * 3 * 3 * 6 * 3 * 2 * 4, index + 42363392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3 + 2 + 4, product* 8 * 4 * 6 * 3 * 6 * 3 * 2 * 4, index + 42363648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 2 + 4, product* 2 * 7 * 6 * 4 * 6 * 3 * 2 * 4, index + 42364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 2 + 4, product* 8 * 2 * 9 * 4 * 6 * 3 * 2 * 4, index + 42364928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 2 + 4, product* 4 * 6 * 4 * 6 * 6 * 3 * 2 * 4, index + 42366464);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6 + 3 + 2 + 4, product* 6 * 7 * 9 * 6 * 6 * 3 * 2 * 4, index + 42366976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 2 + 4, product* 2 * 3 * 2 * 7 * 6 * 3 * 2 * 4, index + 42367232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3 + 2 + 4, product* 8 * 8 * 4 * 7 * 6 * 3 * 2 * 4, index + 42367488);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 2 + 4, product* 6 * 7 * 3 * 3 * 7 * 3 * 2 * 4, index + 42373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 2 + 4, product* 2 * 3 * 6 * 3 * 7 * 3 * 2 * 4, index + 42373632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 2 + 4, product* 8 * 4 * 4 * 6 * 7 * 3 * 2 * 4, index + 42376448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 2 + 4, product* 2 * 7 * 4 * 7 * 7 * 3 * 2 * 4, index + 42377472);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 2 + 4, product* 6 * 3 * 3 * 2 * 8 * 3 * 2 * 4, index + 42382336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 2 + 4, product* 2 * 7 * 8 * 3 * 8 * 3 * 2 * 4, index + 42383872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 2 + 4, product* 4 * 8 * 3 * 4 * 8 * 3 * 2 * 4, index + 42384384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 2 + 4, product* 2 * 3 * 4 * 6 * 8 * 3 * 2 * 4, index + 42386432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3 + 2 + 4, product* 4 * 4 * 9 * 6 * 8 * 3 * 2 * 4, index + 42386944);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 2 + 4, product* 2 * 3 * 8 * 2 * 9 * 3 * 2 * 4, index + 42392832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 2 + 4, product* 4 * 2 * 6 * 4 * 9 * 3 * 2 * 4, index + 42394624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 9 + 3 + 2 + 4, product* 8 * 2 * 9 * 6 * 9 * 3 * 2 * 4, index + 42396928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 3 + 2 + 4, product* 4 * 6 * 4 * 8 * 9 * 3 * 2 * 4, index + 42398464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 2 + 4, product* 2 * 3 * 2 * 9 * 9 * 3 * 2 * 4, index + 42399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 2 + 4, product* 2 * 7 * 2 * 2 * 2 * 4 * 2 * 4, index + 42422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 2 + 4, product* 4 * 8 * 7 * 2 * 2 * 4 * 2 * 4, index + 42422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 2 + 4, product* 6 * 9 * 2 * 3 * 2 * 4 * 2 * 4, index + 42423296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 2 + 4, product* 2 * 3 * 8 * 4 * 2 * 4 * 2 * 4, index + 42424832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 2 + 4, product* 4 * 2 * 6 * 6 * 2 * 4 * 2 * 4, index + 42426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 2 + 4, product* 2 * 9 * 3 * 7 * 2 * 4 * 2 * 4, index + 42427392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 2 + 4, product* 2 * 7 * 6 * 8 * 2 * 4 * 2 * 4, index + 42428672);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 2 + 4, product* 8 * 6 * 7 * 2 * 3 * 4 * 2 * 4, index + 42432768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 2 + 4, product* 2 * 9 * 7 * 3 * 3 * 4 * 2 * 4, index + 42433792);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 4 + 2 + 4, product* 6 * 7 * 3 * 7 * 3 * 4 * 2 * 4, index + 42437376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 2 + 4, product* 2 * 3 * 6 * 7 * 3 * 4 * 2 * 4, index + 42437632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 2 + 4, product* 4 * 2 * 4 * 9 * 3 * 4 * 2 * 4, index + 42439424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 4 + 2 + 4, product* 6 * 9 * 4 * 2 * 4 * 4 * 2 * 4, index + 42442496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 2 + 4, product* 4 * 6 * 2 * 3 * 4 * 4 * 2 * 4, index + 42443264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 2 + 4, product* 8 * 8 * 2 * 4 * 4 * 4 * 2 * 4, index + 42444288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 4 + 2 + 4, product* 6 * 3 * 3 * 6 * 4 * 4 * 2 * 4, index + 42446336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 4 + 2 + 4, product* 2 * 7 * 8 * 7 * 4 * 4 * 2 * 4, index + 42447872);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4 + 4 + 2 + 4, product* 6 * 9 * 8 * 8 * 4 * 4 * 2 * 4, index + 42448896);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 2 + 4, product* 4 * 6 * 4 * 2 * 6 * 4 * 2 * 4, index + 42462464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 2 + 4, product* 2 * 3 * 2 * 3 * 6 * 4 * 2 * 4, index + 42463232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 2 + 4, product* 4 * 4 * 7 * 3 * 6 * 4 * 2 * 4, index + 42463744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 4 + 2 + 4, product* 8 * 2 * 3 * 7 * 6 * 4 * 2 * 4, index + 42467328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 2 + 4, product* 8 * 4 * 4 * 2 * 7 * 4 * 2 * 4, index + 42472448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 2 + 4, product* 2 * 7 * 4 * 3 * 7 * 4 * 2 * 4, index + 42473472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 2 + 4, product* 8 * 2 * 7 * 3 * 7 * 4 * 2 * 4, index + 42473728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 4 + 2 + 4, product* 4 * 8 * 9 * 3 * 7 * 4 * 2 * 4, index + 42473984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 4 + 2 + 4, product* 6 * 9 * 4 * 4 * 7 * 4 * 2 * 4, index + 42474496);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 2 + 4, product* 2 * 3 * 4 * 2 * 8 * 4 * 2 * 4, index + 42482432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 2 + 4, product* 4 * 2 * 2 * 4 * 8 * 4 * 2 * 4, index + 42484224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 2 + 4, product* 2 * 7 * 2 * 6 * 8 * 4 * 2 * 4, index + 42486272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 4 + 2 + 4, product* 6 * 9 * 2 * 7 * 8 * 4 * 2 * 4, index + 42487296);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 8 + 4 + 2 + 4, product* 4 * 4 * 3 * 9 * 8 * 4 * 2 * 4, index + 42489344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 2 + 4, product* 2 * 7 * 6 * 2 * 9 * 4 * 2 * 4, index + 42492672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 2 + 4, product* 8 * 2 * 9 * 2 * 9 * 4 * 2 * 4, index + 42492928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 4 + 2 + 4, product* 6 * 9 * 6 * 3 * 9 * 4 * 2 * 4, index + 42493696);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 2 + 4, product* 4 * 6 * 4 * 2 * 2 * 6 * 2 * 4, index + 42622464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 2 + 4, product* 2 * 3 * 2 * 3 * 2 * 6 * 2 * 4, index + 42623232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 6 + 2 + 4, product* 8 * 8 * 4 * 3 * 2 * 6 * 2 * 4, index + 42623488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 2 + 4, product* 4 * 4 * 7 * 3 * 2 * 6 * 2 * 4, index + 42623744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 6 + 2 + 4, product* 8 * 6 * 7 * 4 * 2 * 6 * 2 * 4, index + 42624768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 2 + 4, product* 8 * 2 * 3 * 7 * 2 * 6 * 2 * 4, index + 42627328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 2 + 4, product* 6 * 7 * 3 * 9 * 2 * 6 * 2 * 4, index + 42629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 2 + 4, product* 2 * 3 * 6 * 9 * 2 * 6 * 2 * 4, index + 42629632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 2 + 4, product* 2 * 7 * 4 * 3 * 3 * 6 * 2 * 4, index + 42633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 2 + 4, product* 8 * 2 * 7 * 3 * 3 * 6 * 2 * 4, index + 42633728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 2 + 4, product* 4 * 8 * 9 * 3 * 3 * 6 * 2 * 4, index + 42633984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 2 + 4, product* 6 * 9 * 4 * 4 * 3 * 6 * 2 * 4, index + 42634496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 2 + 4, product* 8 * 8 * 2 * 6 * 3 * 6 * 2 * 4, index + 42636288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 2 + 4, product* 6 * 3 * 3 * 8 * 3 * 6 * 2 * 4, index + 42638336);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 6 + 2 + 4, product* 8 * 4 * 8 * 8 * 3 * 6 * 2 * 4, index + 42638848);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 6 + 2 + 4, product* 2 * 7 * 8 * 9 * 3 * 6 * 2 * 4, index + 42639872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 2 + 4, product* 2 * 3 * 4 * 2 * 4 * 6 * 2 * 4, index + 42642432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 6 + 2 + 4, product* 8 * 8 * 6 * 2 * 4 * 6 * 2 * 4, index + 42642688);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 6 + 2 + 4, product* 8 * 6 * 9 * 3 * 4 * 6 * 2 * 4, index + 42643968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 2 + 4, product* 4 * 2 * 2 * 4 * 4 * 6 * 2 * 4, index + 42644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 2 + 4, product* 2 * 7 * 2 * 6 * 4 * 6 * 2 * 4, index + 42646272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 2 + 4, product* 6 * 9 * 2 * 7 * 4 * 6 * 2 * 4, index + 42647296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 2 + 4, product* 4 * 2 * 4 * 3 * 6 * 6 * 2 * 4, index + 42663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 2 + 4, product* 6 * 3 * 9 * 3 * 6 * 6 * 2 * 4, index + 42663936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 2 + 4, product* 8 * 4 * 4 * 4 * 6 * 6 * 2 * 4, index + 42664448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 6 + 2 + 4, product* 6 * 9 * 4 * 6 * 6 * 6 * 2 * 4, index + 42666496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 6 + 2 + 4, product* 4 * 6 * 2 * 7 * 6 * 6 * 2 * 4, index + 42667264);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 6 + 2 + 4, product* 4 * 6 * 6 * 3 * 7 * 6 * 2 * 4, index + 42673664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 2 + 4, product* 2 * 3 * 4 * 4 * 7 * 6 * 2 * 4, index + 42674432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 6 + 2 + 4, product* 4 * 4 * 9 * 4 * 7 * 6 * 2 * 4, index + 42674944);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 6 + 2 + 4, product* 6 * 3 * 7 * 6 * 7 * 6 * 2 * 4, index + 42676736);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 2 + 4, product* 2 * 7 * 2 * 8 * 7 * 6 * 2 * 4, index + 42678272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 6 + 2 + 4, product* 8 * 6 * 3 * 2 * 8 * 6 * 2 * 4, index + 42682368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 2 + 4, product* 2 * 9 * 3 * 3 * 8 * 6 * 2 * 4, index + 42683392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 6 + 2 + 4, product* 2 * 7 * 6 * 4 * 8 * 6 * 2 * 4, index + 42684672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 6 + 2 + 4, product* 8 * 2 * 9 * 4 * 8 * 6 * 2 * 4, index + 42684928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 2 + 4, product* 2 * 3 * 2 * 7 * 8 * 6 * 2 * 4, index + 42687232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6 + 2 + 4, product* 4 * 6 * 8 * 2 * 9 * 6 * 2 * 4, index + 42692864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 2 + 4, product* 2 * 3 * 6 * 3 * 9 * 6 * 2 * 4, index + 42693632);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 2 + 4, product* 8 * 2 * 3 * 3 * 2 * 7 * 2 * 4, index + 42723328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 2 + 4, product* 4 * 2 * 4 * 7 * 2 * 7 * 2 * 4, index + 42727424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 2 + 4, product* 2 * 7 * 4 * 9 * 2 * 7 * 2 * 4, index + 42729472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 2 + 7 + 2 + 4, product* 4 * 8 * 9 * 9 * 2 * 7 * 2 * 4, index + 42729984);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7 + 2 + 4, product* 8 * 8 * 2 * 2 * 3 * 7 * 2 * 4, index + 42732288);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 2 + 4, product* 2 * 3 * 6 * 3 * 3 * 7 * 2 * 4, index + 42733632);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 2 + 4, product* 4 * 2 * 8 * 3 * 3 * 7 * 2 * 4, index + 42733824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 2 + 4, product* 4 * 8 * 3 * 6 * 3 * 7 * 2 * 4, index + 42736384);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7 + 2 + 4, product* 4 * 6 * 6 * 7 * 3 * 7 * 2 * 4, index + 42737664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 2 + 4, product* 2 * 3 * 4 * 8 * 3 * 7 * 2 * 4, index + 42738432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 2 + 4, product* 2 * 7 * 2 * 2 * 4 * 7 * 2 * 4, index + 42742272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7 + 2 + 4, product* 4 * 8 * 7 * 2 * 4 * 7 * 2 * 4, index + 42742784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7 + 2 + 4, product* 6 * 9 * 2 * 3 * 4 * 7 * 2 * 4, index + 42743296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 2 + 4, product* 2 * 3 * 8 * 4 * 4 * 7 * 2 * 4, index + 42744832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 2 + 4, product* 2 * 9 * 3 * 7 * 4 * 7 * 2 * 4, index + 42747392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 7 + 2 + 4, product* 8 * 2 * 9 * 8 * 4 * 7 * 2 * 4, index + 42748928);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 2 + 4, product* 4 * 6 * 2 * 3 * 6 * 7 * 2 * 4, index + 42763264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 2 + 4, product* 6 * 3 * 3 * 6 * 6 * 7 * 2 * 4, index + 42766336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 7 + 2 + 4, product* 4 * 8 * 3 * 8 * 6 * 7 * 2 * 4, index + 42768384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 2 + 4, product* 4 * 2 * 2 * 2 * 7 * 7 * 2 * 4, index + 42772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 2 + 4, product* 6 * 3 * 7 * 2 * 7 * 7 * 2 * 4, index + 42772736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 7 + 2 + 4, product* 2 * 9 * 9 * 2 * 7 * 7 * 2 * 4, index + 42772992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 2 + 4, product* 2 * 7 * 2 * 4 * 7 * 7 * 2 * 4, index + 42774272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 2 + 4, product* 2 * 3 * 8 * 6 * 7 * 7 * 2 * 4, index + 42776832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 7 + 2 + 4, product* 2 * 9 * 3 * 9 * 7 * 7 * 2 * 4, index + 42779392);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 2 + 4, product* 2 * 3 * 2 * 3 * 8 * 7 * 2 * 4, index + 42783232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7 + 2 + 4, product* 8 * 4 * 4 * 2 * 9 * 7 * 2 * 4, index + 42792448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 2 + 4, product* 2 * 7 * 4 * 3 * 9 * 7 * 2 * 4, index + 42793472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 7 + 2 + 4, product* 4 * 8 * 9 * 3 * 9 * 7 * 2 * 4, index + 42793984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 7 + 2 + 4, product* 8 * 8 * 2 * 6 * 9 * 7 * 2 * 4, index + 42796288);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 9 + 7 + 2 + 4, product* 8 * 4 * 8 * 8 * 9 * 7 * 2 * 4, index + 42798848);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 9 + 7 + 2 + 4, product* 2 * 7 * 8 * 9 * 9 * 7 * 2 * 4, index + 42799872);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 2 + 4, product* 4 * 2 * 4 * 3 * 2 * 8 * 2 * 4, index + 42823424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 2 + 4, product* 8 * 4 * 4 * 4 * 2 * 8 * 2 * 4, index + 42824448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 2 + 4, product* 4 * 6 * 2 * 7 * 2 * 8 * 2 * 4, index + 42827264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 2 + 4, product* 4 * 8 * 3 * 2 * 3 * 8 * 2 * 4, index + 42832384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 8 + 2 + 4, product* 6 * 9 * 8 * 2 * 3 * 8 * 2 * 4, index + 42832896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 2 + 4, product* 2 * 3 * 4 * 4 * 3 * 8 * 2 * 4, index + 42834432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 2 + 4, product* 4 * 2 * 2 * 6 * 3 * 8 * 2 * 4, index + 42836224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 2 + 4, product* 2 * 7 * 2 * 8 * 3 * 8 * 2 * 4, index + 42838272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 2 + 4, product* 4 * 2 * 6 * 2 * 4 * 8 * 2 * 4, index + 42842624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 2 + 4, product* 2 * 9 * 3 * 3 * 4 * 8 * 2 * 4, index + 42843392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 2 + 4, product* 2 * 7 * 6 * 4 * 4 * 8 * 2 * 4, index + 42844672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 8 + 2 + 4, product* 8 * 2 * 9 * 4 * 4 * 8 * 2 * 4, index + 42844928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 2 + 4, product* 2 * 3 * 2 * 7 * 4 * 8 * 2 * 4, index + 42847232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 4 + 8 + 2 + 4, product* 8 * 8 * 4 * 7 * 4 * 8 * 2 * 4, index + 42847488);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8 + 2 + 4, product* 4 * 4 * 7 * 7 * 4 * 8 * 2 * 4, index + 42847744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 8 + 2 + 4, product* 8 * 6 * 7 * 8 * 4 * 8 * 2 * 4, index + 42848768);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 2 + 4, product* 6 * 3 * 3 * 2 * 6 * 8 * 2 * 4, index + 42862336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 2 + 4, product* 2 * 7 * 8 * 3 * 6 * 8 * 2 * 4, index + 42863872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 2 + 4, product* 2 * 3 * 4 * 6 * 6 * 8 * 2 * 4, index + 42866432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 2 + 4, product* 4 * 2 * 2 * 8 * 6 * 8 * 2 * 4, index + 42868224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 2 + 4, product* 4 * 4 * 3 * 3 * 7 * 8 * 2 * 4, index + 42873344);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 8 + 2 + 4, product* 8 * 2 * 9 * 6 * 7 * 8 * 2 * 4, index + 42876928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 2 + 4, product* 2 * 3 * 2 * 9 * 7 * 8 * 2 * 4, index + 42879232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 2 + 4, product* 8 * 2 * 3 * 3 * 8 * 8 * 2 * 4, index + 42883328);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 2 + 4, product* 4 * 2 * 8 * 3 * 9 * 8 * 2 * 4, index + 42893824);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 2 + 4, product* 6 * 9 * 4 * 2 * 2 * 9 * 2 * 4, index + 42922496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 2 + 4, product* 4 * 6 * 2 * 3 * 2 * 9 * 2 * 4, index + 42923264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 2 + 4, product* 6 * 3 * 3 * 6 * 2 * 9 * 2 * 4, index + 42926336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 2 + 4, product* 4 * 2 * 2 * 2 * 3 * 9 * 2 * 4, index + 42932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 2 + 4, product* 6 * 3 * 7 * 2 * 3 * 9 * 2 * 4, index + 42932736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 2 + 4, product* 2 * 9 * 9 * 2 * 3 * 9 * 2 * 4, index + 42932992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 2 + 4, product* 8 * 4 * 2 * 3 * 3 * 9 * 2 * 4, index + 42933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 2 + 4, product* 2 * 7 * 2 * 4 * 3 * 9 * 2 * 4, index + 42934272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 9 + 2 + 4, product* 4 * 8 * 7 * 4 * 3 * 9 * 2 * 4, index + 42934784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 2 + 4, product* 2 * 3 * 8 * 6 * 3 * 9 * 2 * 4, index + 42936832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9 + 2 + 4, product* 4 * 4 * 3 * 7 * 3 * 9 * 2 * 4, index + 42937344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 9 + 2 + 4, product* 2 * 9 * 3 * 9 * 3 * 9 * 2 * 4, index + 42939392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 2 + 4, product* 4 * 6 * 4 * 2 * 4 * 9 * 2 * 4, index + 42942464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 2 + 4, product* 2 * 3 * 2 * 3 * 4 * 9 * 2 * 4, index + 42943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 2 + 4, product* 4 * 4 * 7 * 3 * 4 * 9 * 2 * 4, index + 42943744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 2 + 4, product* 2 * 3 * 6 * 9 * 4 * 9 * 2 * 4, index + 42949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 2 + 4, product* 2 * 3 * 4 * 2 * 6 * 9 * 2 * 4, index + 42962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 2 + 4, product* 4 * 2 * 2 * 4 * 6 * 9 * 2 * 4, index + 42964224);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 9 + 2 + 4, product* 2 * 7 * 6 * 2 * 7 * 9 * 2 * 4, index + 42972672);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 9 + 2 + 4, product* 8 * 2 * 3 * 9 * 7 * 9 * 2 * 4, index + 42979328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 2 + 4, product* 4 * 2 * 4 * 3 * 8 * 9 * 2 * 4, index + 42983424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 9 + 2 + 4, product* 8 * 4 * 4 * 4 * 8 * 9 * 2 * 4, index + 42984448);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 9 + 2 + 4, product* 4 * 6 * 6 * 3 * 9 * 9 * 2 * 4, index + 42993664);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 9 + 9 + 2 + 4, product* 8 * 8 * 6 * 4 * 9 * 9 * 2 * 4, index + 42994688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 9 + 2 + 4, product* 4 * 2 * 2 * 6 * 9 * 9 * 2 * 4, index + 42996224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 3 + 4, product* 2 * 7 * 2 * 2 * 2 * 2 * 3 * 4, index + 43222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 3 + 4, product* 4 * 8 * 7 * 2 * 2 * 2 * 3 * 4, index + 43222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 3 + 4, product* 6 * 9 * 2 * 3 * 2 * 2 * 3 * 4, index + 43223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 3 + 4, product* 2 * 3 * 8 * 4 * 2 * 2 * 3 * 4, index + 43224832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 3 + 4, product* 4 * 2 * 6 * 6 * 2 * 2 * 3 * 4, index + 43226624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 3 + 4, product* 2 * 9 * 3 * 7 * 2 * 2 * 3 * 4, index + 43227392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2 + 3 + 4, product* 8 * 4 * 6 * 7 * 2 * 2 * 3 * 4, index + 43227648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2 + 3 + 4, product* 2 * 7 * 6 * 8 * 2 * 2 * 3 * 4, index + 43228672);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 2 + 3 + 4, product* 6 * 9 * 6 * 9 * 2 * 2 * 3 * 4, index + 43229696);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 3 + 4, product* 8 * 6 * 7 * 2 * 3 * 2 * 3 * 4, index + 43232768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 3 + 4, product* 2 * 9 * 7 * 3 * 3 * 2 * 3 * 4, index + 43233792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 2 + 3 + 4, product* 4 * 6 * 8 * 6 * 3 * 2 * 3 * 4, index + 43236864);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 3 + 4, product* 6 * 7 * 3 * 7 * 3 * 2 * 3 * 4, index + 43237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 3 + 4, product* 2 * 3 * 6 * 7 * 3 * 2 * 3 * 4, index + 43237632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 3 + 4, product* 4 * 2 * 4 * 9 * 3 * 2 * 3 * 4, index + 43239424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 3 + 4, product* 6 * 3 * 9 * 9 * 3 * 2 * 3 * 4, index + 43239936);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 3 + 4, product* 6 * 9 * 4 * 2 * 4 * 2 * 3 * 4, index + 43242496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 3 + 4, product* 4 * 6 * 2 * 3 * 4 * 2 * 3 * 4, index + 43243264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 3 + 4, product* 6 * 7 * 7 * 3 * 4 * 2 * 3 * 4, index + 43243776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 3 + 4, product* 8 * 8 * 2 * 4 * 4 * 2 * 3 * 4, index + 43244288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 3 + 4, product* 4 * 8 * 3 * 8 * 4 * 2 * 3 * 4, index + 43248384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 2 + 3 + 4, product* 4 * 6 * 6 * 9 * 4 * 2 * 3 * 4, index + 43249664);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 3 + 4, product* 4 * 6 * 4 * 2 * 6 * 2 * 3 * 4, index + 43262464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 2 + 3 + 4, product* 6 * 7 * 9 * 2 * 6 * 2 * 3 * 4, index + 43262976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 3 + 4, product* 2 * 3 * 2 * 3 * 6 * 2 * 3 * 4, index + 43263232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 3 + 4, product* 8 * 8 * 4 * 3 * 6 * 2 * 3 * 4, index + 43263488);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 3 + 4, product* 8 * 2 * 3 * 7 * 6 * 2 * 3 * 4, index + 43267328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 6 + 2 + 3 + 4, product* 6 * 7 * 3 * 9 * 6 * 2 * 3 * 4, index + 43269376);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 3 + 4, product* 8 * 4 * 4 * 2 * 7 * 2 * 3 * 4, index + 43272448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 3 + 4, product* 2 * 7 * 4 * 3 * 7 * 2 * 3 * 4, index + 43273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 3 + 4, product* 8 * 2 * 7 * 3 * 7 * 2 * 3 * 4, index + 43273728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2 + 3 + 4, product* 6 * 9 * 4 * 4 * 7 * 2 * 3 * 4, index + 43274496);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 3 + 4, product* 4 * 2 * 8 * 7 * 7 * 2 * 3 * 4, index + 43277824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2 + 3 + 4, product* 6 * 3 * 3 * 8 * 7 * 2 * 3 * 4, index + 43278336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 3 + 4, product* 2 * 3 * 2 * 9 * 7 * 2 * 3 * 4, index + 43279232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 3 + 4, product* 2 * 3 * 4 * 2 * 8 * 2 * 3 * 4, index + 43282432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 3 + 4, product* 4 * 4 * 9 * 2 * 8 * 2 * 3 * 4, index + 43282944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 2 + 3 + 4, product* 8 * 6 * 9 * 3 * 8 * 2 * 3 * 4, index + 43283968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 3 + 4, product* 4 * 2 * 2 * 4 * 8 * 2 * 3 * 4, index + 43284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 3 + 4, product* 6 * 3 * 7 * 4 * 8 * 2 * 3 * 4, index + 43284736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 3 + 4, product* 2 * 7 * 2 * 6 * 8 * 2 * 3 * 4, index + 43286272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 2 + 3 + 4, product* 6 * 9 * 2 * 7 * 8 * 2 * 3 * 4, index + 43287296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2 + 3 + 4, product* 2 * 3 * 8 * 8 * 8 * 2 * 3 * 4, index + 43288832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 3 + 4, product* 2 * 7 * 6 * 2 * 9 * 2 * 3 * 4, index + 43292672);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 9 + 2 + 3 + 4, product* 6 * 9 * 6 * 3 * 9 * 2 * 3 * 4, index + 43293696);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 3 + 4, product* 4 * 2 * 6 * 2 * 2 * 3 * 3 * 4, index + 43322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 3 + 4, product* 2 * 9 * 3 * 3 * 2 * 3 * 3 * 4, index + 43323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 3 + 4, product* 8 * 4 * 6 * 3 * 2 * 3 * 3 * 4, index + 43323648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 3 + 4, product* 2 * 7 * 6 * 4 * 2 * 3 * 3 * 4, index + 43324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 3 + 4, product* 8 * 2 * 9 * 4 * 2 * 3 * 3 * 4, index + 43324928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 3 + 4, product* 4 * 6 * 4 * 6 * 2 * 3 * 3 * 4, index + 43326464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 3 + 4, product* 2 * 3 * 2 * 7 * 2 * 3 * 3 * 4, index + 43327232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 3 + 4, product* 4 * 4 * 7 * 7 * 2 * 3 * 3 * 4, index + 43327744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3 + 3 + 4, product* 8 * 6 * 7 * 8 * 2 * 3 * 3 * 4, index + 43328768);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 3 + 4, product* 2 * 9 * 7 * 9 * 2 * 3 * 3 * 4, index + 43329792);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 3 + 4, product* 4 * 6 * 8 * 2 * 3 * 3 * 3 * 4, index + 43332864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 3 + 4, product* 2 * 3 * 6 * 3 * 3 * 3 * 3 * 4, index + 43333632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 3 + 3 + 4, product* 8 * 4 * 4 * 6 * 3 * 3 * 3 * 4, index + 43336448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 3 + 4, product* 2 * 7 * 4 * 7 * 3 * 3 * 3 * 4, index + 43337472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 3 + 3 + 4, product* 8 * 2 * 7 * 7 * 3 * 3 * 3 * 4, index + 43337728);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 3 + 3 + 3 + 4, product* 4 * 8 * 9 * 7 * 3 * 3 * 3 * 4, index + 43337984);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 3 + 4, product* 6 * 3 * 3 * 2 * 4 * 3 * 3 * 4, index + 43342336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 3 + 4, product* 8 * 4 * 8 * 2 * 4 * 3 * 3 * 4, index + 43342848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 3 + 4, product* 2 * 7 * 8 * 3 * 4 * 3 * 3 * 4, index + 43343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 3 + 4, product* 4 * 8 * 3 * 4 * 4 * 3 * 3 * 4, index + 43344384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 3 + 4, product* 2 * 3 * 4 * 6 * 4 * 3 * 3 * 4, index + 43346432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 4 + 3 + 3 + 4, product* 8 * 8 * 6 * 6 * 4 * 3 * 3 * 4, index + 43346688);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 3 + 4, product* 4 * 2 * 2 * 8 * 4 * 3 * 3 * 4, index + 43348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 3 + 4, product* 6 * 3 * 7 * 8 * 4 * 3 * 3 * 4, index + 43348736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 3 + 3 + 4, product* 2 * 9 * 9 * 8 * 4 * 3 * 3 * 4, index + 43348992);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 3 + 4, product* 8 * 2 * 3 * 3 * 6 * 3 * 3 * 4, index + 43363328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 3 + 4, product* 4 * 2 * 4 * 7 * 6 * 3 * 3 * 4, index + 43367424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 3 + 3 + 4, product* 6 * 3 * 9 * 7 * 6 * 3 * 3 * 4, index + 43367936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 3 + 4, product* 8 * 4 * 4 * 8 * 6 * 3 * 3 * 4, index + 43368448);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3 + 3 + 4, product* 8 * 8 * 2 * 2 * 7 * 3 * 3 * 4, index + 43372288);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 7 + 3 + 3 + 4, product* 4 * 6 * 6 * 7 * 7 * 3 * 3 * 4, index + 43377664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 3 + 4, product* 2 * 3 * 4 * 8 * 7 * 3 * 3 * 4, index + 43378432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 3 + 3 + 4, product* 4 * 4 * 9 * 8 * 7 * 3 * 3 * 4, index + 43378944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 3 + 4, product* 2 * 7 * 2 * 2 * 8 * 3 * 3 * 4, index + 43382272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 3 + 4, product* 6 * 9 * 2 * 3 * 8 * 3 * 3 * 4, index + 43383296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 3 + 4, product* 2 * 3 * 8 * 4 * 8 * 3 * 3 * 4, index + 43384832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 3 + 3 + 4, product* 4 * 2 * 6 * 6 * 8 * 3 * 3 * 4, index + 43386624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 3 + 3 + 4, product* 2 * 9 * 3 * 7 * 8 * 3 * 3 * 4, index + 43387392);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3 + 3 + 4, product* 2 * 3 * 6 * 7 * 9 * 3 * 3 * 4, index + 43397632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 3 + 4, product* 4 * 2 * 4 * 9 * 9 * 3 * 3 * 4, index + 43399424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 3 + 4, product* 4 * 6 * 4 * 2 * 2 * 4 * 3 * 4, index + 43422464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 3 + 4, product* 6 * 7 * 9 * 2 * 2 * 4 * 3 * 4, index + 43422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 3 + 4, product* 2 * 3 * 2 * 3 * 2 * 4 * 3 * 4, index + 43423232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 3 + 4, product* 4 * 4 * 7 * 3 * 2 * 4 * 3 * 4, index + 43423744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 4 + 3 + 4, product* 8 * 6 * 7 * 4 * 2 * 4 * 3 * 4, index + 43424768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 3 + 4, product* 8 * 2 * 3 * 7 * 2 * 4 * 3 * 4, index + 43427328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 3 + 4, product* 2 * 3 * 6 * 9 * 2 * 4 * 3 * 4, index + 43429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 3 + 4, product* 8 * 4 * 4 * 2 * 3 * 4 * 3 * 4, index + 43432448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 3 + 4, product* 2 * 7 * 4 * 3 * 3 * 4 * 3 * 4, index + 43433472);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4 + 3 + 4, product* 8 * 8 * 2 * 6 * 3 * 4 * 3 * 4, index + 43436288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 3 + 4, product* 6 * 3 * 3 * 8 * 3 * 4 * 3 * 4, index + 43438336);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 3 + 4 + 3 + 4, product* 8 * 4 * 8 * 8 * 3 * 4 * 3 * 4, index + 43438848);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 3 + 4, product* 2 * 3 * 4 * 2 * 4 * 4 * 3 * 4, index + 43442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 3 + 4, product* 4 * 4 * 9 * 2 * 4 * 4 * 3 * 4, index + 43442944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 3 + 4, product* 4 * 2 * 2 * 4 * 4 * 4 * 3 * 4, index + 43444224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 4 + 3 + 4, product* 6 * 3 * 7 * 4 * 4 * 4 * 3 * 4, index + 43444736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 4 + 3 + 4, product* 2 * 9 * 9 * 4 * 4 * 4 * 3 * 4, index + 43444992);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 4 + 3 + 4, product* 4 * 8 * 7 * 6 * 4 * 4 * 3 * 4, index + 43446784);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 3 + 4, product* 4 * 4 * 3 * 9 * 4 * 4 * 3 * 4, index + 43449344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 3 + 4, product* 4 * 2 * 4 * 3 * 6 * 4 * 3 * 4, index + 43463424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 4 + 3 + 4, product* 8 * 4 * 4 * 4 * 6 * 4 * 3 * 4, index + 43464448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 3 + 4, product* 4 * 6 * 2 * 7 * 6 * 4 * 3 * 4, index + 43467264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 4 + 3 + 4, product* 4 * 2 * 8 * 9 * 6 * 4 * 3 * 4, index + 43469824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 3 + 4, product* 4 * 8 * 3 * 2 * 7 * 4 * 3 * 4, index + 43472384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 3 + 4, product* 2 * 3 * 4 * 4 * 7 * 4 * 3 * 4, index + 43474432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 3 + 4, product* 4 * 2 * 2 * 6 * 7 * 4 * 3 * 4, index + 43476224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 4 + 3 + 4, product* 2 * 9 * 9 * 6 * 7 * 4 * 3 * 4, index + 43476992);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 3 + 4, product* 2 * 7 * 2 * 8 * 7 * 4 * 3 * 4, index + 43478272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 3 + 4, product* 4 * 2 * 6 * 2 * 8 * 4 * 3 * 4, index + 43482624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 3 + 4, product* 2 * 9 * 3 * 3 * 8 * 4 * 3 * 4, index + 43483392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 4 + 3 + 4, product* 8 * 4 * 6 * 3 * 8 * 4 * 3 * 4, index + 43483648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 4 + 3 + 4, product* 2 * 7 * 6 * 4 * 8 * 4 * 3 * 4, index + 43484672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 3 + 4, product* 2 * 3 * 2 * 7 * 8 * 4 * 3 * 4, index + 43487232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 4 + 3 + 4, product* 4 * 4 * 7 * 7 * 8 * 4 * 3 * 4, index + 43487744);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 4 + 3 + 4, product* 2 * 9 * 7 * 9 * 8 * 4 * 3 * 4, index + 43489792);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 3 + 4, product* 2 * 3 * 6 * 3 * 9 * 4 * 3 * 4, index + 43493632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 4 + 3 + 4, product* 2 * 7 * 4 * 7 * 9 * 4 * 3 * 4, index + 43497472);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 4 + 3 + 4, product* 6 * 9 * 4 * 8 * 9 * 4 * 3 * 4, index + 43498496);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 4 + 3 + 4, product* 4 * 6 * 2 * 9 * 9 * 4 * 3 * 4, index + 43499264);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 3 + 4, product* 4 * 2 * 4 * 3 * 2 * 6 * 3 * 4, index + 43623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 3 + 4, product* 6 * 3 * 9 * 3 * 2 * 6 * 3 * 4, index + 43623936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 3 + 4, product* 8 * 4 * 4 * 4 * 2 * 6 * 3 * 4, index + 43624448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 3 + 4, product* 4 * 6 * 2 * 7 * 2 * 6 * 3 * 4, index + 43627264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 3 + 4, product* 4 * 8 * 3 * 2 * 3 * 6 * 3 * 4, index + 43632384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6 + 3 + 4, product* 4 * 6 * 6 * 3 * 3 * 6 * 3 * 4, index + 43633664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 3 + 4, product* 2 * 3 * 4 * 4 * 3 * 6 * 3 * 4, index + 43634432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 6 + 3 + 4, product* 4 * 4 * 9 * 4 * 3 * 6 * 3 * 4, index + 43634944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 3 + 4, product* 4 * 2 * 2 * 6 * 3 * 6 * 3 * 4, index + 43636224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 6 + 3 + 4, product* 6 * 3 * 7 * 6 * 3 * 6 * 3 * 4, index + 43636736);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 6 + 3 + 4, product* 2 * 9 * 9 * 6 * 3 * 6 * 3 * 4, index + 43636992);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 3 + 4, product* 2 * 7 * 2 * 8 * 3 * 6 * 3 * 4, index + 43638272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 6 + 3 + 4, product* 4 * 8 * 7 * 8 * 3 * 6 * 3 * 4, index + 43638784);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 6 + 3 + 4, product* 6 * 9 * 2 * 9 * 3 * 6 * 3 * 4, index + 43639296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 3 + 4, product* 4 * 2 * 6 * 2 * 4 * 6 * 3 * 4, index + 43642624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 3 + 4, product* 2 * 7 * 6 * 4 * 4 * 6 * 3 * 4, index + 43644672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 3 + 4, product* 2 * 3 * 2 * 7 * 4 * 6 * 3 * 4, index + 43647232);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6 + 3 + 4, product* 8 * 4 * 8 * 2 * 6 * 6 * 3 * 4, index + 43662848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 6 + 3 + 4, product* 4 * 8 * 3 * 4 * 6 * 6 * 3 * 4, index + 43664384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 3 + 4, product* 2 * 3 * 4 * 6 * 6 * 6 * 3 * 4, index + 43666432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 6 + 3 + 4, product* 4 * 4 * 9 * 6 * 6 * 6 * 3 * 4, index + 43666944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 3 + 4, product* 4 * 2 * 2 * 8 * 6 * 6 * 3 * 4, index + 43668224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 6 + 3 + 4, product* 4 * 4 * 3 * 3 * 7 * 6 * 3 * 4, index + 43673344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 6 + 3 + 4, product* 2 * 7 * 6 * 6 * 7 * 6 * 3 * 4, index + 43676672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 3 + 4, product* 2 * 3 * 2 * 9 * 7 * 6 * 3 * 4, index + 43679232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6 + 3 + 4, product* 8 * 2 * 3 * 3 * 8 * 6 * 3 * 4, index + 43683328);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 6 + 3 + 4, product* 8 * 8 * 2 * 2 * 9 * 6 * 3 * 4, index + 43692288);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 6 + 3 + 4, product* 6 * 3 * 3 * 4 * 9 * 6 * 3 * 4, index + 43694336);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 6 + 3 + 4, product* 8 * 4 * 8 * 4 * 9 * 6 * 3 * 4, index + 43694848);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 3 + 4, product* 4 * 6 * 2 * 3 * 2 * 7 * 3 * 4, index + 43723264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 7 + 3 + 4, product* 6 * 7 * 7 * 3 * 2 * 7 * 3 * 4, index + 43723776);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 7 + 3 + 4, product* 8 * 4 * 8 * 6 * 2 * 7 * 3 * 4, index + 43726848);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 7 + 3 + 4, product* 4 * 8 * 3 * 8 * 2 * 7 * 3 * 4, index + 43728384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 7 + 3 + 4, product* 6 * 9 * 8 * 8 * 2 * 7 * 3 * 4, index + 43728896);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 2 + 7 + 3 + 4, product* 4 * 6 * 6 * 9 * 2 * 7 * 3 * 4, index + 43729664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 3 + 4, product* 4 * 2 * 2 * 2 * 3 * 7 * 3 * 4, index + 43732224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 7 + 3 + 4, product* 2 * 9 * 9 * 2 * 3 * 7 * 3 * 4, index + 43732992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 3 + 4, product* 8 * 4 * 2 * 3 * 3 * 7 * 3 * 4, index + 43733248);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7 + 3 + 4, product* 2 * 3 * 8 * 6 * 3 * 7 * 3 * 4, index + 43736832);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 3 + 4, product* 4 * 2 * 6 * 8 * 3 * 7 * 3 * 4, index + 43738624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 3 + 4, product* 4 * 6 * 4 * 2 * 4 * 7 * 3 * 4, index + 43742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 3 + 4, product* 2 * 3 * 2 * 3 * 4 * 7 * 3 * 4, index + 43743232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 7 + 3 + 4, product* 4 * 4 * 7 * 3 * 4 * 7 * 3 * 4, index + 43743744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 7 + 3 + 4, product* 8 * 2 * 3 * 7 * 4 * 7 * 3 * 4, index + 43747328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 7 + 3 + 4, product* 4 * 6 * 8 * 8 * 4 * 7 * 3 * 4, index + 43748864);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 3 + 4, product* 2 * 3 * 4 * 2 * 6 * 7 * 3 * 4, index + 43762432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 7 + 3 + 4, product* 8 * 8 * 6 * 2 * 6 * 7 * 3 * 4, index + 43762688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7 + 3 + 4, product* 4 * 4 * 9 * 2 * 6 * 7 * 3 * 4, index + 43762944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 3 + 4, product* 4 * 2 * 2 * 4 * 6 * 7 * 3 * 4, index + 43764224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7 + 3 + 4, product* 4 * 2 * 4 * 3 * 8 * 7 * 3 * 4, index + 43783424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 7 + 3 + 4, product* 4 * 6 * 2 * 7 * 8 * 7 * 3 * 4, index + 43787264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 7 + 3 + 4, product* 4 * 8 * 3 * 2 * 9 * 7 * 3 * 4, index + 43792384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 3 + 4, product* 2 * 3 * 4 * 4 * 9 * 7 * 3 * 4, index + 43794432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 9 + 7 + 3 + 4, product* 4 * 4 * 9 * 4 * 9 * 7 * 3 * 4, index + 43794944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7 + 3 + 4, product* 4 * 2 * 2 * 6 * 9 * 7 * 3 * 4, index + 43796224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 9 + 7 + 3 + 4, product* 6 * 3 * 7 * 6 * 9 * 7 * 3 * 4, index + 43796736);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 3 + 4, product* 6 * 3 * 3 * 2 * 2 * 8 * 3 * 4, index + 43822336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 3 + 4, product* 4 * 8 * 3 * 4 * 2 * 8 * 3 * 4, index + 43824384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 3 + 4, product* 2 * 3 * 4 * 6 * 2 * 8 * 3 * 4, index + 43826432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 8 + 3 + 4, product* 4 * 4 * 9 * 6 * 2 * 8 * 3 * 4, index + 43826944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 3 + 4, product* 4 * 2 * 2 * 8 * 2 * 8 * 3 * 4, index + 43828224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 8 + 3 + 4, product* 8 * 4 * 2 * 9 * 2 * 8 * 3 * 4, index + 43829248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 3 + 4, product* 2 * 3 * 8 * 2 * 3 * 8 * 3 * 4, index + 43832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 3 + 4, product* 4 * 4 * 3 * 3 * 3 * 8 * 3 * 4, index + 43833344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 8 + 3 + 4, product* 8 * 6 * 3 * 4 * 3 * 8 * 3 * 4, index + 43834368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 3 + 4, product* 4 * 2 * 6 * 4 * 3 * 8 * 3 * 4, index + 43834624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 3 + 4, product* 2 * 3 * 2 * 9 * 3 * 8 * 3 * 4, index + 43839232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 8 + 3 + 4, product* 4 * 4 * 7 * 9 * 3 * 8 * 3 * 4, index + 43839744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 3 + 4, product* 2 * 7 * 2 * 2 * 6 * 8 * 3 * 4, index + 43862272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 8 + 3 + 4, product* 4 * 2 * 6 * 6 * 6 * 8 * 3 * 4, index + 43866624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 8 + 3 + 4, product* 2 * 9 * 3 * 7 * 6 * 8 * 3 * 4, index + 43867392);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 8 + 3 + 4, product* 8 * 6 * 7 * 2 * 7 * 8 * 3 * 4, index + 43872768);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 8 + 3 + 4, product* 4 * 6 * 8 * 6 * 7 * 8 * 3 * 4, index + 43876864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 8 + 3 + 4, product* 2 * 3 * 6 * 7 * 7 * 8 * 3 * 4, index + 43877632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 8 + 3 + 4, product* 4 * 2 * 4 * 9 * 7 * 8 * 3 * 4, index + 43879424);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 8 + 3 + 4, product* 6 * 3 * 9 * 9 * 7 * 8 * 3 * 4, index + 43879936);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 8 + 3 + 4, product* 4 * 6 * 2 * 3 * 8 * 8 * 3 * 4, index + 43883264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 3 + 4, product* 4 * 2 * 2 * 2 * 9 * 8 * 3 * 4, index + 43892224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 8 + 3 + 4, product* 6 * 3 * 7 * 2 * 9 * 8 * 3 * 4, index + 43892736);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 8 + 3 + 4, product* 2 * 3 * 8 * 6 * 9 * 8 * 3 * 4, index + 43896832);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 3 + 4, product* 2 * 3 * 4 * 2 * 2 * 9 * 3 * 4, index + 43922432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 3 + 4, product* 4 * 4 * 9 * 2 * 2 * 9 * 3 * 4, index + 43922944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 3 + 4, product* 4 * 2 * 2 * 4 * 2 * 9 * 3 * 4, index + 43924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 3 + 4, product* 6 * 3 * 7 * 4 * 2 * 9 * 3 * 4, index + 43924736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 9 + 3 + 4, product* 2 * 9 * 9 * 4 * 2 * 9 * 3 * 4, index + 43924992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 3 + 4, product* 2 * 7 * 2 * 6 * 2 * 9 * 3 * 4, index + 43926272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 9 + 3 + 4, product* 2 * 3 * 8 * 8 * 2 * 9 * 3 * 4, index + 43928832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 9 + 3 + 4, product* 4 * 4 * 3 * 9 * 2 * 9 * 3 * 4, index + 43929344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 3 + 4, product* 2 * 7 * 6 * 2 * 3 * 9 * 3 * 4, index + 43932672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 9 + 3 + 4, product* 4 * 6 * 4 * 4 * 3 * 9 * 3 * 4, index + 43934464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 9 + 3 + 4, product* 6 * 7 * 9 * 4 * 3 * 9 * 3 * 4, index + 43934976);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 9 + 3 + 4, product* 8 * 2 * 3 * 9 * 3 * 9 * 3 * 4, index + 43939328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9 + 3 + 4, product* 4 * 2 * 4 * 3 * 4 * 9 * 3 * 4, index + 43943424);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 9 + 3 + 4, product* 8 * 6 * 3 * 2 * 6 * 9 * 3 * 4, index + 43962368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 3 + 4, product* 4 * 2 * 6 * 2 * 6 * 9 * 3 * 4, index + 43962624);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 9 + 3 + 4, product* 8 * 2 * 9 * 4 * 6 * 9 * 3 * 4, index + 43964928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 9 + 3 + 4, product* 4 * 6 * 4 * 6 * 6 * 9 * 3 * 4, index + 43966464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 3 + 4, product* 2 * 3 * 2 * 7 * 6 * 9 * 3 * 4, index + 43967232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9 + 3 + 4, product* 2 * 3 * 6 * 3 * 7 * 9 * 3 * 4, index + 43973632);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 9 + 3 + 4, product* 8 * 2 * 7 * 7 * 7 * 9 * 3 * 4, index + 43977728);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 9 + 3 + 4, product* 6 * 3 * 3 * 2 * 8 * 9 * 3 * 4, index + 43982336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 9 + 3 + 4, product* 8 * 4 * 8 * 2 * 8 * 9 * 3 * 4, index + 43982848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 9 + 3 + 4, product* 4 * 8 * 3 * 4 * 8 * 9 * 3 * 4, index + 43984384);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 9 + 3 + 4, product* 4 * 2 * 2 * 8 * 8 * 9 * 3 * 4, index + 43988224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9 + 3 + 4, product* 2 * 3 * 8 * 2 * 9 * 9 * 3 * 4, index + 43992832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 9 + 3 + 4, product* 2 * 3 * 2 * 9 * 9 * 9 * 3 * 4, index + 43999232);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 4 + 4, product* 4 * 6 * 4 * 2 * 2 * 2 * 4 * 4, index + 44222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 4 + 4, product* 6 * 7 * 9 * 2 * 2 * 2 * 4 * 4, index + 44222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 4 + 4, product* 2 * 3 * 2 * 3 * 2 * 2 * 4 * 4, index + 44223232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 4 + 4, product* 4 * 4 * 7 * 3 * 2 * 2 * 4 * 4, index + 44223744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 4 + 4, product* 8 * 6 * 7 * 4 * 2 * 2 * 4 * 4, index + 44224768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 4 + 4, product* 8 * 2 * 3 * 7 * 2 * 2 * 4 * 4, index + 44227328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 4 + 4, product* 6 * 7 * 3 * 9 * 2 * 2 * 4 * 4, index + 44229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 4 + 4, product* 2 * 3 * 6 * 9 * 2 * 2 * 4 * 4, index + 44229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 4 + 4, product* 8 * 4 * 4 * 2 * 3 * 2 * 4 * 4, index + 44232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 4 + 4, product* 2 * 7 * 4 * 3 * 3 * 2 * 4 * 4, index + 44233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 4 + 4, product* 8 * 2 * 7 * 3 * 3 * 2 * 4 * 4, index + 44233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 4 + 4, product* 4 * 8 * 9 * 3 * 3 * 2 * 4 * 4, index + 44233984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 4 + 4, product* 8 * 8 * 2 * 6 * 3 * 2 * 4 * 4, index + 44236288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 4 + 4, product* 4 * 2 * 8 * 7 * 3 * 2 * 4 * 4, index + 44237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 4 + 4, product* 6 * 3 * 3 * 8 * 3 * 2 * 4 * 4, index + 44238336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 4 + 4, product* 2 * 7 * 8 * 9 * 3 * 2 * 4 * 4, index + 44239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 4 + 4, product* 2 * 3 * 4 * 2 * 4 * 2 * 4 * 4, index + 44242432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 4 + 4, product* 4 * 4 * 9 * 2 * 4 * 2 * 4 * 4, index + 44242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 4 + 4, product* 4 * 2 * 2 * 4 * 4 * 2 * 4 * 4, index + 44244224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 4 + 4, product* 2 * 7 * 2 * 6 * 4 * 2 * 4 * 4, index + 44246272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 4 + 4, product* 2 * 3 * 8 * 8 * 4 * 2 * 4 * 4, index + 44248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 4 + 4, product* 4 * 4 * 3 * 9 * 4 * 2 * 4 * 4, index + 44249344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 4 + 4, product* 4 * 2 * 4 * 3 * 6 * 2 * 4 * 4, index + 44263424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 2 + 4 + 4, product* 6 * 3 * 9 * 3 * 6 * 2 * 4 * 4, index + 44263936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 4 + 4, product* 4 * 6 * 2 * 7 * 6 * 2 * 4 * 4, index + 44267264);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 4 + 4, product* 6 * 9 * 8 * 2 * 7 * 2 * 4 * 4, index + 44272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 4 + 4, product* 4 * 6 * 6 * 3 * 7 * 2 * 4 * 4, index + 44273664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 4 + 4, product* 2 * 3 * 4 * 4 * 7 * 2 * 4 * 4, index + 44274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 4 + 4, product* 4 * 4 * 9 * 4 * 7 * 2 * 4 * 4, index + 44274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 4 + 4, product* 4 * 2 * 2 * 6 * 7 * 2 * 4 * 4, index + 44276224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 4 + 4, product* 8 * 4 * 2 * 7 * 7 * 2 * 4 * 4, index + 44277248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 4 + 4, product* 2 * 7 * 2 * 8 * 7 * 2 * 4 * 4, index + 44278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 4 + 4, product* 8 * 6 * 3 * 2 * 8 * 2 * 4 * 4, index + 44282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 4 + 4, product* 4 * 2 * 6 * 2 * 8 * 2 * 4 * 4, index + 44282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 4 + 4, product* 2 * 9 * 3 * 3 * 8 * 2 * 4 * 4, index + 44283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 4 + 4, product* 8 * 4 * 6 * 3 * 8 * 2 * 4 * 4, index + 44283648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 4 + 4, product* 2 * 7 * 6 * 4 * 8 * 2 * 4 * 4, index + 44284672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 4 + 4, product* 2 * 3 * 2 * 7 * 8 * 2 * 4 * 4, index + 44287232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 8 + 2 + 4 + 4, product* 8 * 8 * 4 * 7 * 8 * 2 * 4 * 4, index + 44287488);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 4 + 4, product* 4 * 6 * 8 * 2 * 9 * 2 * 4 * 4, index + 44292864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 4 + 4, product* 6 * 7 * 3 * 3 * 9 * 2 * 4 * 4, index + 44293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 4 + 4, product* 2 * 3 * 6 * 3 * 9 * 2 * 4 * 4, index + 44293632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 4 + 4, product* 2 * 7 * 4 * 7 * 9 * 2 * 4 * 4, index + 44297472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 2 + 4 + 4, product* 8 * 2 * 7 * 7 * 9 * 2 * 4 * 4, index + 44297728);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 4 + 4, product* 8 * 2 * 3 * 3 * 2 * 3 * 4 * 4, index + 44323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 4 + 4, product* 4 * 2 * 4 * 7 * 2 * 3 * 4 * 4, index + 44327424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 4 + 4, product* 8 * 4 * 4 * 8 * 2 * 3 * 4 * 4, index + 44328448);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 4 + 4, product* 2 * 9 * 7 * 9 * 2 * 3 * 4 * 4, index + 44329792);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 4 + 4, product* 8 * 8 * 2 * 2 * 3 * 3 * 4 * 4, index + 44332288);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 4 + 4, product* 6 * 3 * 3 * 4 * 3 * 3 * 4 * 4, index + 44334336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 4 + 4, product* 4 * 8 * 3 * 6 * 3 * 3 * 4 * 4, index + 44336384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 4 + 4, product* 2 * 3 * 4 * 8 * 3 * 3 * 4 * 4, index + 44338432);
-body<0>(stream, sum+ 8 + 8 + 6 + 8 + 3 + 3 + 4 + 4, product* 8 * 8 * 6 * 8 * 3 * 3 * 4 * 4, index + 44338688);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 4 + 4, product* 2 * 7 * 2 * 2 * 4 * 3 * 4 * 4, index + 44342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 4 + 4, product* 4 * 8 * 7 * 2 * 4 * 3 * 4 * 4, index + 44342784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 4 + 4, product* 6 * 9 * 2 * 3 * 4 * 3 * 4 * 4, index + 44343296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 4 + 4, product* 2 * 3 * 8 * 4 * 4 * 3 * 4 * 4, index + 44344832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 4 + 4, product* 8 * 6 * 3 * 6 * 4 * 3 * 4 * 4, index + 44346368);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 4 + 4, product* 2 * 9 * 3 * 7 * 4 * 3 * 4 * 4, index + 44347392);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 4 + 4, product* 4 * 6 * 2 * 3 * 6 * 3 * 4 * 4, index + 44363264);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6 + 3 + 4 + 4, product* 2 * 7 * 8 * 7 * 6 * 3 * 4 * 4, index + 44367872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 4 + 4, product* 4 * 2 * 2 * 2 * 7 * 3 * 4 * 4, index + 44372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 4 + 4, product* 6 * 3 * 7 * 2 * 7 * 3 * 4 * 4, index + 44372736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 4 + 4, product* 8 * 4 * 2 * 3 * 7 * 3 * 4 * 4, index + 44373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 4 + 4, product* 2 * 7 * 2 * 4 * 7 * 3 * 4 * 4, index + 44374272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 4 + 4, product* 4 * 4 * 3 * 7 * 7 * 3 * 4 * 4, index + 44377344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 4 + 4, product* 2 * 3 * 2 * 3 * 8 * 3 * 4 * 4, index + 44383232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 4 + 4, product* 8 * 2 * 3 * 7 * 8 * 3 * 4 * 4, index + 44387328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 4 + 4, product* 8 * 4 * 4 * 2 * 9 * 3 * 4 * 4, index + 44392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 4 + 4, product* 2 * 7 * 4 * 3 * 9 * 3 * 4 * 4, index + 44393472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 3 + 4 + 4, product* 4 * 8 * 9 * 3 * 9 * 3 * 4 * 4, index + 44393984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 9 + 3 + 4 + 4, product* 8 * 8 * 2 * 6 * 9 * 3 * 4 * 4, index + 44396288);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 4 + 4, product* 4 * 2 * 4 * 3 * 2 * 4 * 4 * 4, index + 44423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 4 + 4, product* 6 * 3 * 9 * 3 * 2 * 4 * 4 * 4, index + 44423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 4 + 4, product* 8 * 4 * 4 * 4 * 2 * 4 * 4 * 4, index + 44424448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 4 + 4, product* 4 * 6 * 2 * 7 * 2 * 4 * 4 * 4, index + 44427264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 4 + 4 + 4, product* 6 * 7 * 7 * 7 * 2 * 4 * 4 * 4, index + 44427776);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 4 + 4, product* 4 * 2 * 8 * 9 * 2 * 4 * 4 * 4, index + 44429824);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 4 + 4, product* 6 * 9 * 8 * 2 * 3 * 4 * 4 * 4, index + 44432896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 4 + 4, product* 2 * 3 * 4 * 4 * 3 * 4 * 4 * 4, index + 44434432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 4 + 4 + 4, product* 4 * 4 * 9 * 4 * 3 * 4 * 4 * 4, index + 44434944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 4 + 4, product* 4 * 2 * 2 * 6 * 3 * 4 * 4 * 4, index + 44436224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 4 + 4 + 4, product* 6 * 3 * 7 * 6 * 3 * 4 * 4 * 4, index + 44436736);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 4 + 4, product* 2 * 7 * 2 * 8 * 3 * 4 * 4 * 4, index + 44438272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 4 + 4, product* 8 * 6 * 3 * 2 * 4 * 4 * 4 * 4, index + 44442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 4 + 4, product* 4 * 2 * 6 * 2 * 4 * 4 * 4 * 4, index + 44442624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 4 + 4, product* 8 * 4 * 6 * 3 * 4 * 4 * 4 * 4, index + 44443648);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 4 + 4, product* 4 * 6 * 4 * 6 * 4 * 4 * 4 * 4, index + 44446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 4 + 4, product* 2 * 3 * 2 * 7 * 4 * 4 * 4 * 4, index + 44447232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 4 + 4, product* 6 * 3 * 3 * 2 * 6 * 4 * 4 * 4, index + 44462336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 4 + 4, product* 4 * 8 * 3 * 4 * 6 * 4 * 4 * 4, index + 44464384);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 4 + 4, product* 4 * 2 * 2 * 8 * 6 * 4 * 4 * 4, index + 44468224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 4 + 4, product* 2 * 3 * 8 * 2 * 7 * 4 * 4 * 4, index + 44472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 4 + 4, product* 4 * 4 * 3 * 3 * 7 * 4 * 4 * 4, index + 44473344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 4 + 4 + 4, product* 8 * 6 * 3 * 4 * 7 * 4 * 4 * 4, index + 44474368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 4 + 4, product* 4 * 2 * 6 * 4 * 7 * 4 * 4 * 4, index + 44474624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 4 + 4, product* 2 * 7 * 6 * 6 * 7 * 4 * 4 * 4, index + 44476672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 4 + 4, product* 2 * 3 * 2 * 9 * 7 * 4 * 4 * 4, index + 44479232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 4 + 4, product* 8 * 2 * 3 * 3 * 8 * 4 * 4 * 4, index + 44483328);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 4 + 4, product* 2 * 7 * 4 * 9 * 8 * 4 * 4 * 4, index + 44489472);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 4 + 4, product* 6 * 3 * 3 * 2 * 2 * 6 * 4 * 4, index + 44622336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 4 + 4, product* 8 * 4 * 8 * 2 * 2 * 6 * 4 * 4, index + 44622848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 4 + 4, product* 2 * 7 * 8 * 3 * 2 * 6 * 4 * 4, index + 44623872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 4 + 4, product* 4 * 8 * 3 * 4 * 2 * 6 * 4 * 4, index + 44624384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 4 + 4, product* 2 * 3 * 4 * 6 * 2 * 6 * 4 * 4, index + 44626432);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 6 + 4 + 4, product* 8 * 6 * 9 * 7 * 2 * 6 * 4 * 4, index + 44627968);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 6 + 4 + 4, product* 8 * 6 * 3 * 4 * 3 * 6 * 4 * 4, index + 44634368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 4 + 4, product* 4 * 2 * 6 * 4 * 3 * 6 * 4 * 4, index + 44634624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 4 + 4, product* 2 * 7 * 6 * 6 * 3 * 6 * 4 * 4, index + 44636672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6 + 4 + 4, product* 4 * 6 * 4 * 8 * 3 * 6 * 4 * 4, index + 44638464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 4 + 4, product* 2 * 3 * 2 * 9 * 3 * 6 * 4 * 4, index + 44639232);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 6 + 4 + 4, product* 4 * 6 * 8 * 4 * 4 * 6 * 4 * 4, index + 44644864);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 4 + 4, product* 2 * 7 * 4 * 9 * 4 * 6 * 4 * 4, index + 44649472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 4 + 4, product* 2 * 7 * 2 * 2 * 6 * 6 * 4 * 4, index + 44662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 4 + 4, product* 4 * 8 * 7 * 2 * 6 * 6 * 4 * 4, index + 44662784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 4 + 4, product* 2 * 3 * 8 * 4 * 6 * 6 * 4 * 4, index + 44664832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 4 + 4, product* 2 * 9 * 3 * 7 * 6 * 6 * 4 * 4, index + 44667392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 6 + 4 + 4, product* 8 * 2 * 9 * 8 * 6 * 6 * 4 * 4, index + 44668928);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 4 + 4, product* 2 * 3 * 6 * 7 * 7 * 6 * 4 * 4, index + 44677632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 4 + 4, product* 4 * 6 * 2 * 3 * 8 * 6 * 4 * 4, index + 44683264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 4 + 4, product* 4 * 2 * 2 * 2 * 9 * 6 * 4 * 4, index + 44692224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 6 + 4 + 4, product* 2 * 9 * 9 * 2 * 9 * 6 * 4 * 4, index + 44692992);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 4 + 4, product* 2 * 3 * 4 * 2 * 2 * 7 * 4 * 4, index + 44722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 4 + 4, product* 4 * 4 * 9 * 2 * 2 * 7 * 4 * 4, index + 44722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 4 + 4, product* 4 * 2 * 2 * 4 * 2 * 7 * 4 * 4, index + 44724224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 4 + 4, product* 2 * 9 * 9 * 4 * 2 * 7 * 4 * 4, index + 44724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 4 + 4, product* 2 * 7 * 2 * 6 * 2 * 7 * 4 * 4, index + 44726272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 4 + 4, product* 2 * 3 * 8 * 8 * 2 * 7 * 4 * 4, index + 44728832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 4 + 4, product* 2 * 7 * 6 * 2 * 3 * 7 * 4 * 4, index + 44732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 4 + 4, product* 8 * 2 * 9 * 2 * 3 * 7 * 4 * 4, index + 44732928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 4 + 4, product* 4 * 6 * 4 * 4 * 3 * 7 * 4 * 4, index + 44734464);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 4 + 4, product* 4 * 2 * 4 * 3 * 4 * 7 * 4 * 4, index + 44743424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 4 + 4, product* 4 * 6 * 2 * 7 * 4 * 7 * 4 * 4, index + 44747264);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 4 + 4, product* 4 * 2 * 6 * 2 * 6 * 7 * 4 * 4, index + 44762624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 4 + 4, product* 2 * 3 * 2 * 7 * 6 * 7 * 4 * 4, index + 44767232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 4 + 4, product* 2 * 3 * 6 * 3 * 7 * 7 * 4 * 4, index + 44773632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7 + 4 + 4, product* 8 * 4 * 4 * 6 * 7 * 7 * 4 * 4, index + 44776448);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 4 + 4, product* 6 * 3 * 3 * 2 * 8 * 7 * 4 * 4, index + 44782336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 4 + 4, product* 2 * 3 * 4 * 6 * 8 * 7 * 4 * 4, index + 44786432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 4 + 4, product* 4 * 2 * 2 * 8 * 8 * 7 * 4 * 4, index + 44788224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 7 + 4 + 4, product* 2 * 9 * 9 * 8 * 8 * 7 * 4 * 4, index + 44788992);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 4 + 4, product* 2 * 3 * 8 * 2 * 9 * 7 * 4 * 4, index + 44792832);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 4 + 4, product* 2 * 7 * 2 * 2 * 2 * 8 * 4 * 4, index + 44822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 4 + 4, product* 4 * 8 * 7 * 2 * 2 * 8 * 4 * 4, index + 44822784);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 8 + 4 + 4, product* 8 * 6 * 7 * 2 * 3 * 8 * 4 * 4, index + 44832768);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 8 + 4 + 4, product* 6 * 7 * 7 * 3 * 4 * 8 * 4 * 4, index + 44843776);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 8 + 4 + 4, product* 4 * 6 * 6 * 9 * 4 * 8 * 4 * 4, index + 44849664);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 4 + 4, product* 4 * 6 * 4 * 2 * 6 * 8 * 4 * 4, index + 44862464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 4 + 4, product* 2 * 3 * 2 * 3 * 6 * 8 * 4 * 4, index + 44863232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 8 + 4 + 4, product* 2 * 3 * 6 * 9 * 6 * 8 * 4 * 4, index + 44869632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 4 + 4, product* 2 * 3 * 4 * 2 * 8 * 8 * 4 * 4, index + 44882432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 4 + 4, product* 4 * 2 * 2 * 4 * 8 * 8 * 4 * 4, index + 44884224);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 4 + 4, product* 8 * 6 * 3 * 2 * 2 * 9 * 4 * 4, index + 44922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 4 + 4, product* 4 * 2 * 6 * 2 * 2 * 9 * 4 * 4, index + 44922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 4 + 4, product* 2 * 9 * 3 * 3 * 2 * 9 * 4 * 4, index + 44923392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 9 + 4 + 4, product* 4 * 6 * 4 * 6 * 2 * 9 * 4 * 4, index + 44926464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 4 + 4, product* 2 * 3 * 2 * 7 * 2 * 9 * 4 * 4, index + 44927232);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 4 + 4, product* 8 * 2 * 7 * 7 * 3 * 9 * 4 * 4, index + 44937728);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 9 + 4 + 4, product* 4 * 6 * 2 * 9 * 3 * 9 * 4 * 4, index + 44939264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 4 + 4, product* 6 * 3 * 3 * 2 * 4 * 9 * 4 * 4, index + 44942336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 4 + 4, product* 4 * 8 * 3 * 4 * 4 * 9 * 4 * 4, index + 44944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 4 + 4, product* 2 * 3 * 4 * 6 * 4 * 9 * 4 * 4, index + 44946432);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 9 + 4 + 4, product* 4 * 8 * 3 * 6 * 7 * 9 * 4 * 4, index + 44976384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 4 + 4, product* 2 * 3 * 4 * 8 * 7 * 9 * 4 * 4, index + 44978432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 4 + 4, product* 2 * 7 * 2 * 2 * 8 * 9 * 4 * 4, index + 44982272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 9 + 4 + 4, product* 4 * 8 * 7 * 2 * 8 * 9 * 4 * 4, index + 44982784);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 9 + 4 + 4, product* 4 * 2 * 6 * 6 * 8 * 9 * 4 * 4, index + 44986624);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 6 + 4, product* 6 * 3 * 3 * 2 * 2 * 2 * 6 * 4, index + 46222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 6 + 4, product* 8 * 4 * 8 * 2 * 2 * 2 * 6 * 4, index + 46222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 6 + 4, product* 2 * 7 * 8 * 3 * 2 * 2 * 6 * 4, index + 46223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 6 + 4, product* 4 * 8 * 3 * 4 * 2 * 2 * 6 * 4, index + 46224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 6 + 4, product* 2 * 3 * 4 * 6 * 2 * 2 * 6 * 4, index + 46226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 6 + 4, product* 4 * 4 * 9 * 6 * 2 * 2 * 6 * 4, index + 46226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 6 + 4, product* 4 * 2 * 2 * 8 * 2 * 2 * 6 * 4, index + 46228224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 6 + 4, product* 8 * 4 * 2 * 9 * 2 * 2 * 6 * 4, index + 46229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 6 + 4, product* 2 * 3 * 8 * 2 * 3 * 2 * 6 * 4, index + 46232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 6 + 4, product* 4 * 4 * 3 * 3 * 3 * 2 * 6 * 4, index + 46233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 6 + 4, product* 8 * 6 * 3 * 4 * 3 * 2 * 6 * 4, index + 46234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 6 + 4, product* 4 * 2 * 6 * 4 * 3 * 2 * 6 * 4, index + 46234624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 6 + 4, product* 2 * 3 * 2 * 9 * 3 * 2 * 6 * 4, index + 46239232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 3 + 2 + 6 + 4, product* 8 * 8 * 4 * 9 * 3 * 2 * 6 * 4, index + 46239488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 6 + 4, product* 8 * 2 * 3 * 3 * 4 * 2 * 6 * 4, index + 46243328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 6 + 4, product* 4 * 6 * 8 * 4 * 4 * 2 * 6 * 4, index + 46244864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 6 + 4, product* 4 * 2 * 4 * 7 * 4 * 2 * 6 * 4, index + 46247424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 6 + 4, product* 6 * 3 * 9 * 7 * 4 * 2 * 6 * 4, index + 46247936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 2 + 6 + 4, product* 8 * 4 * 4 * 8 * 4 * 2 * 6 * 4, index + 46248448);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 6 + 4, product* 8 * 2 * 7 * 9 * 4 * 2 * 6 * 4, index + 46249728);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 4 + 2 + 6 + 4, product* 4 * 8 * 9 * 9 * 4 * 2 * 6 * 4, index + 46249984);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 6 + 4, product* 2 * 7 * 2 * 2 * 6 * 2 * 6 * 4, index + 46262272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 6 + 4, product* 6 * 9 * 2 * 3 * 6 * 2 * 6 * 4, index + 46263296);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 6 + 4, product* 4 * 2 * 6 * 6 * 6 * 2 * 6 * 4, index + 46266624);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 6 + 4, product* 2 * 3 * 6 * 7 * 7 * 2 * 6 * 4, index + 46277632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 6 + 4, product* 4 * 6 * 2 * 3 * 8 * 2 * 6 * 4, index + 46283264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 2 + 6 + 4, product* 8 * 8 * 2 * 4 * 8 * 2 * 6 * 4, index + 46284288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 6 + 4, product* 6 * 3 * 3 * 6 * 8 * 2 * 6 * 4, index + 46286336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 6 + 4, product* 4 * 2 * 2 * 2 * 9 * 2 * 6 * 4, index + 46292224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 6 + 4, product* 8 * 4 * 2 * 3 * 9 * 2 * 6 * 4, index + 46293248);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 6 + 4, product* 2 * 3 * 8 * 6 * 9 * 2 * 6 * 4, index + 46296832);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 6 + 4, product* 2 * 3 * 4 * 2 * 2 * 3 * 6 * 4, index + 46322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 6 + 4, product* 4 * 4 * 9 * 2 * 2 * 3 * 6 * 4, index + 46322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 6 + 4, product* 4 * 2 * 2 * 4 * 2 * 3 * 6 * 4, index + 46324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 6 + 4, product* 6 * 3 * 7 * 4 * 2 * 3 * 6 * 4, index + 46324736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 6 + 4, product* 2 * 9 * 9 * 4 * 2 * 3 * 6 * 4, index + 46324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 6 + 4, product* 2 * 7 * 2 * 6 * 2 * 3 * 6 * 4, index + 46326272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 6 + 4, product* 6 * 9 * 2 * 7 * 2 * 3 * 6 * 4, index + 46327296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 6 + 4, product* 2 * 3 * 8 * 8 * 2 * 3 * 6 * 4, index + 46328832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 6 + 4, product* 2 * 7 * 6 * 2 * 3 * 3 * 6 * 4, index + 46332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 6 + 4, product* 8 * 2 * 9 * 2 * 3 * 3 * 6 * 4, index + 46332928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 6 + 4, product* 4 * 6 * 4 * 4 * 3 * 3 * 6 * 4, index + 46334464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3 + 6 + 4, product* 6 * 7 * 9 * 4 * 3 * 3 * 6 * 4, index + 46334976);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 6 + 4, product* 4 * 2 * 4 * 3 * 4 * 3 * 6 * 4, index + 46343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 6 + 4, product* 6 * 3 * 9 * 3 * 4 * 3 * 6 * 4, index + 46343936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 6 + 4, product* 8 * 4 * 4 * 4 * 4 * 3 * 6 * 4, index + 46344448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 6 + 4, product* 4 * 6 * 2 * 7 * 4 * 3 * 6 * 4, index + 46347264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3 + 6 + 4, product* 4 * 2 * 8 * 9 * 4 * 3 * 6 * 4, index + 46349824);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 6 + 4, product* 4 * 2 * 6 * 2 * 6 * 3 * 6 * 4, index + 46362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 6 + 4, product* 2 * 9 * 3 * 3 * 6 * 3 * 6 * 4, index + 46363392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 3 + 6 + 4, product* 4 * 6 * 4 * 6 * 6 * 3 * 6 * 4, index + 46366464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 6 + 4, product* 2 * 3 * 2 * 7 * 6 * 3 * 6 * 4, index + 46367232);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 6 + 4, product* 6 * 7 * 3 * 3 * 7 * 3 * 6 * 4, index + 46373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 6 + 4, product* 2 * 3 * 6 * 3 * 7 * 3 * 6 * 4, index + 46373632);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3 + 6 + 4, product* 6 * 9 * 4 * 8 * 7 * 3 * 6 * 4, index + 46378496);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3 + 6 + 4, product* 8 * 4 * 8 * 2 * 8 * 3 * 6 * 4, index + 46382848);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 6 + 4, product* 2 * 3 * 4 * 6 * 8 * 3 * 6 * 4, index + 46386432);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 8 + 3 + 6 + 4, product* 6 * 3 * 7 * 8 * 8 * 3 * 6 * 4, index + 46388736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 8 + 3 + 6 + 4, product* 8 * 4 * 2 * 9 * 8 * 3 * 6 * 4, index + 46389248);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 6 + 4, product* 2 * 3 * 2 * 9 * 9 * 3 * 6 * 4, index + 46399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 6 + 4, product* 2 * 7 * 2 * 2 * 2 * 4 * 6 * 4, index + 46422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 6 + 4, product* 4 * 8 * 7 * 2 * 2 * 4 * 6 * 4, index + 46422784);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 6 + 4, product* 4 * 2 * 6 * 6 * 2 * 4 * 6 * 4, index + 46426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 6 + 4, product* 2 * 9 * 3 * 7 * 2 * 4 * 6 * 4, index + 46427392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 6 + 4, product* 2 * 7 * 6 * 8 * 2 * 4 * 6 * 4, index + 46428672);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 6 + 4, product* 8 * 6 * 7 * 2 * 3 * 4 * 6 * 4, index + 46432768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 6 + 4, product* 2 * 9 * 7 * 3 * 3 * 4 * 6 * 4, index + 46433792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 6 + 4, product* 4 * 6 * 8 * 6 * 3 * 4 * 6 * 4, index + 46436864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 6 + 4, product* 2 * 3 * 6 * 7 * 3 * 4 * 6 * 4, index + 46437632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 6 + 4, product* 4 * 6 * 2 * 3 * 4 * 4 * 6 * 4, index + 46443264);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 6 + 4, product* 4 * 6 * 4 * 2 * 6 * 4 * 6 * 4, index + 46462464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 4 + 6 + 4, product* 6 * 7 * 9 * 2 * 6 * 4 * 6 * 4, index + 46462976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 6 + 4, product* 2 * 3 * 2 * 3 * 6 * 4 * 6 * 4, index + 46463232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 4 + 6 + 4, product* 8 * 8 * 4 * 3 * 6 * 4 * 6 * 4, index + 46463488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 6 + 4, product* 4 * 4 * 7 * 3 * 6 * 4 * 6 * 4, index + 46463744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 4 + 6 + 4, product* 8 * 6 * 7 * 4 * 6 * 4 * 6 * 4, index + 46464768);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 6 + 4, product* 2 * 3 * 6 * 9 * 6 * 4 * 6 * 4, index + 46469632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 6 + 4, product* 2 * 7 * 4 * 3 * 7 * 4 * 6 * 4, index + 46473472);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 6 + 4, product* 4 * 2 * 8 * 7 * 7 * 4 * 6 * 4, index + 46477824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 6 + 4, product* 2 * 3 * 4 * 2 * 8 * 4 * 6 * 4, index + 46482432);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 6 + 4, product* 2 * 7 * 6 * 2 * 9 * 4 * 6 * 4, index + 46492672);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 9 + 4 + 6 + 4, product* 8 * 2 * 3 * 9 * 9 * 4 * 6 * 4, index + 46499328);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 6 + 4, product* 2 * 3 * 2 * 3 * 2 * 6 * 6 * 4, index + 46623232);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 6 + 6 + 4, product* 4 * 6 * 8 * 8 * 2 * 6 * 6 * 4, index + 46628864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 6 + 4, product* 6 * 7 * 3 * 9 * 2 * 6 * 6 * 4, index + 46629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 6 + 4, product* 2 * 3 * 6 * 9 * 2 * 6 * 6 * 4, index + 46629632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 6 + 4, product* 2 * 7 * 4 * 3 * 3 * 6 * 6 * 4, index + 46633472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 6 + 4, product* 4 * 8 * 9 * 3 * 3 * 6 * 6 * 4, index + 46633984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 6 + 4, product* 6 * 9 * 4 * 4 * 3 * 6 * 6 * 4, index + 46634496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 6 + 4, product* 8 * 8 * 2 * 6 * 3 * 6 * 6 * 4, index + 46636288);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 6 + 4, product* 2 * 3 * 4 * 2 * 4 * 6 * 6 * 4, index + 46642432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 6 + 4, product* 4 * 2 * 2 * 4 * 4 * 6 * 6 * 4, index + 46644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 6 + 4, product* 2 * 7 * 2 * 6 * 4 * 6 * 6 * 4, index + 46646272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 6 + 4, product* 2 * 3 * 8 * 8 * 4 * 6 * 6 * 4, index + 46648832);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 6 + 4, product* 4 * 8 * 3 * 2 * 7 * 6 * 6 * 4, index + 46672384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 6 + 4, product* 2 * 3 * 4 * 4 * 7 * 6 * 6 * 4, index + 46674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 6 + 4, product* 4 * 2 * 2 * 6 * 7 * 6 * 6 * 4, index + 46676224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 6 + 6 + 4, product* 8 * 4 * 2 * 7 * 7 * 6 * 6 * 4, index + 46677248);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 6 + 4, product* 4 * 2 * 6 * 2 * 8 * 6 * 6 * 4, index + 46682624);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 6 + 4, product* 2 * 3 * 6 * 3 * 9 * 6 * 6 * 4, index + 46693632);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 6 + 4, product* 8 * 2 * 3 * 3 * 2 * 7 * 6 * 4, index + 46723328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 6 + 4, product* 4 * 6 * 8 * 4 * 2 * 7 * 6 * 4, index + 46724864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 6 + 4, product* 4 * 2 * 4 * 7 * 2 * 7 * 6 * 4, index + 46727424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 6 + 4, product* 2 * 7 * 4 * 9 * 2 * 7 * 6 * 4, index + 46729472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 6 + 4, product* 8 * 2 * 7 * 9 * 2 * 7 * 6 * 4, index + 46729728);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 6 + 4, product* 4 * 2 * 8 * 3 * 3 * 7 * 6 * 4, index + 46733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 6 + 4, product* 6 * 3 * 3 * 4 * 3 * 7 * 6 * 4, index + 46734336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 6 + 4, product* 4 * 8 * 3 * 6 * 3 * 7 * 6 * 4, index + 46736384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 6 + 4, product* 2 * 3 * 4 * 8 * 3 * 7 * 6 * 4, index + 46738432);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 6 + 4, product* 2 * 3 * 8 * 4 * 4 * 7 * 6 * 4, index + 46744832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 6 + 4, product* 2 * 7 * 6 * 8 * 4 * 7 * 6 * 4, index + 46748672);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 6 + 4, product* 4 * 2 * 2 * 2 * 7 * 7 * 6 * 4, index + 46772224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 6 + 4, product* 8 * 4 * 2 * 3 * 7 * 7 * 6 * 4, index + 46773248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 6 + 4, product* 2 * 7 * 2 * 4 * 7 * 7 * 6 * 4, index + 46774272);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 7 + 7 + 6 + 4, product* 8 * 4 * 6 * 9 * 7 * 7 * 6 * 4, index + 46779648);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7 + 6 + 4, product* 4 * 6 * 4 * 2 * 8 * 7 * 6 * 4, index + 46782464);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 7 + 6 + 4, product* 8 * 2 * 7 * 3 * 9 * 7 * 6 * 4, index + 46793728);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 6 + 4, product* 4 * 2 * 4 * 3 * 2 * 8 * 6 * 4, index + 46823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 6 + 4, product* 6 * 3 * 9 * 3 * 2 * 8 * 6 * 4, index + 46823936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 6 + 4, product* 8 * 4 * 4 * 4 * 2 * 8 * 6 * 4, index + 46824448);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 6 + 4, product* 4 * 8 * 3 * 2 * 3 * 8 * 6 * 4, index + 46832384);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 6 + 4, product* 4 * 2 * 2 * 6 * 3 * 8 * 6 * 4, index + 46836224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 8 + 6 + 4, product* 6 * 3 * 7 * 6 * 3 * 8 * 6 * 4, index + 46836736);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 6 + 4, product* 6 * 9 * 2 * 9 * 3 * 8 * 6 * 4, index + 46839296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 6 + 4, product* 4 * 2 * 6 * 2 * 4 * 8 * 6 * 4, index + 46842624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 6 + 4, product* 2 * 9 * 3 * 3 * 4 * 8 * 6 * 4, index + 46843392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 8 + 6 + 4, product* 8 * 2 * 9 * 4 * 4 * 8 * 6 * 4, index + 46844928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8 + 6 + 4, product* 4 * 6 * 4 * 6 * 4 * 8 * 6 * 4, index + 46846464);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 6 + 4, product* 6 * 3 * 3 * 2 * 6 * 8 * 6 * 4, index + 46862336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 6 + 4, product* 2 * 7 * 8 * 3 * 6 * 8 * 6 * 4, index + 46863872);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 6 + 4, product* 2 * 3 * 8 * 2 * 7 * 8 * 6 * 4, index + 46872832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 6 + 4, product* 2 * 3 * 2 * 9 * 7 * 8 * 6 * 4, index + 46879232);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 8 + 6 + 4, product* 2 * 7 * 4 * 9 * 8 * 8 * 6 * 4, index + 46889472);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 6 + 4, product* 2 * 9 * 3 * 3 * 2 * 9 * 6 * 4, index + 46923392);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9 + 6 + 4, product* 8 * 8 * 2 * 4 * 2 * 9 * 6 * 4, index + 46924288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 6 + 4, product* 6 * 3 * 3 * 6 * 2 * 9 * 6 * 4, index + 46926336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 6 + 4, product* 4 * 2 * 2 * 2 * 3 * 9 * 6 * 4, index + 46932224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 6 + 4, product* 2 * 7 * 2 * 4 * 3 * 9 * 6 * 4, index + 46934272);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 6 + 4, product* 2 * 3 * 2 * 3 * 4 * 9 * 6 * 4, index + 46943232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 6 + 4, product* 4 * 4 * 7 * 3 * 4 * 9 * 6 * 4, index + 46943744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 6 + 4, product* 8 * 2 * 3 * 7 * 4 * 9 * 6 * 4, index + 46947328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 6 + 4, product* 2 * 3 * 6 * 9 * 4 * 9 * 6 * 4, index + 46949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 6 + 4, product* 2 * 3 * 4 * 2 * 6 * 9 * 6 * 4, index + 46962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 6 + 4, product* 4 * 2 * 2 * 4 * 6 * 9 * 6 * 4, index + 46964224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 6 + 4, product* 4 * 2 * 4 * 3 * 8 * 9 * 6 * 4, index + 46983424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 7 + 4, product* 2 * 7 * 2 * 2 * 2 * 2 * 7 * 4, index + 47222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 7 + 4, product* 4 * 8 * 7 * 2 * 2 * 2 * 7 * 4, index + 47222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 7 + 4, product* 6 * 9 * 2 * 3 * 2 * 2 * 7 * 4, index + 47223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 7 + 4, product* 2 * 3 * 8 * 4 * 2 * 2 * 7 * 4, index + 47224832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 7 + 4, product* 4 * 2 * 6 * 6 * 2 * 2 * 7 * 4, index + 47226624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 7 + 4, product* 2 * 9 * 3 * 7 * 2 * 2 * 7 * 4, index + 47227392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 7 + 4, product* 8 * 2 * 9 * 8 * 2 * 2 * 7 * 4, index + 47228928);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 7 + 4, product* 2 * 3 * 6 * 7 * 3 * 2 * 7 * 4, index + 47237632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 7 + 4, product* 4 * 2 * 4 * 9 * 3 * 2 * 7 * 4, index + 47239424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 7 + 4, product* 4 * 6 * 2 * 3 * 4 * 2 * 7 * 4, index + 47243264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 7 + 4, product* 6 * 7 * 7 * 3 * 4 * 2 * 7 * 4, index + 47243776);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 7 + 4, product* 4 * 6 * 4 * 2 * 6 * 2 * 7 * 4, index + 47262464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 7 + 4, product* 2 * 3 * 2 * 3 * 6 * 2 * 7 * 4, index + 47263232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 2 + 7 + 4, product* 4 * 4 * 7 * 3 * 6 * 2 * 7 * 4, index + 47263744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 6 + 2 + 7 + 4, product* 8 * 2 * 3 * 7 * 6 * 2 * 7 * 4, index + 47267328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2 + 7 + 4, product* 2 * 3 * 6 * 9 * 6 * 2 * 7 * 4, index + 47269632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 7 + 4, product* 8 * 4 * 4 * 2 * 7 * 2 * 7 * 4, index + 47272448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 7 + 4, product* 2 * 7 * 4 * 3 * 7 * 2 * 7 * 4, index + 47273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 7 + 4, product* 8 * 2 * 7 * 3 * 7 * 2 * 7 * 4, index + 47273728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 7 + 4, product* 4 * 8 * 9 * 3 * 7 * 2 * 7 * 4, index + 47273984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 7 + 2 + 7 + 4, product* 6 * 9 * 4 * 4 * 7 * 2 * 7 * 4, index + 47274496);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 7 + 4, product* 2 * 7 * 6 * 6 * 7 * 2 * 7 * 4, index + 47276672);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 7 + 4, product* 4 * 2 * 8 * 7 * 7 * 2 * 7 * 4, index + 47277824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 7 + 4, product* 2 * 3 * 4 * 2 * 8 * 2 * 7 * 4, index + 47282432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 7 + 4, product* 4 * 2 * 2 * 4 * 8 * 2 * 7 * 4, index + 47284224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 2 + 7 + 4, product* 2 * 9 * 9 * 4 * 8 * 2 * 7 * 4, index + 47284992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 7 + 4, product* 2 * 7 * 2 * 6 * 8 * 2 * 7 * 4, index + 47286272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2 + 7 + 4, product* 2 * 3 * 8 * 8 * 8 * 2 * 7 * 4, index + 47288832);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 7 + 4, product* 8 * 6 * 3 * 2 * 2 * 3 * 7 * 4, index + 47322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 7 + 4, product* 4 * 2 * 6 * 2 * 2 * 3 * 7 * 4, index + 47322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 7 + 4, product* 2 * 9 * 3 * 3 * 2 * 3 * 7 * 4, index + 47323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 7 + 4, product* 8 * 4 * 6 * 3 * 2 * 3 * 7 * 4, index + 47323648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 7 + 4, product* 2 * 7 * 6 * 4 * 2 * 3 * 7 * 4, index + 47324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 7 + 4, product* 8 * 2 * 9 * 4 * 2 * 3 * 7 * 4, index + 47324928);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 2 + 3 + 7 + 4, product* 6 * 7 * 9 * 6 * 2 * 3 * 7 * 4, index + 47326976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 7 + 4, product* 2 * 3 * 2 * 7 * 2 * 3 * 7 * 4, index + 47327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 7 + 4, product* 8 * 8 * 4 * 7 * 2 * 3 * 7 * 4, index + 47327488);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 7 + 4, product* 4 * 6 * 8 * 2 * 3 * 3 * 7 * 4, index + 47332864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 7 + 4, product* 2 * 3 * 6 * 3 * 3 * 3 * 7 * 4, index + 47333632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 7 + 4, product* 2 * 7 * 4 * 7 * 3 * 3 * 7 * 4, index + 47337472);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 7 + 4, product* 6 * 3 * 3 * 2 * 4 * 3 * 7 * 4, index + 47342336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 7 + 4, product* 2 * 7 * 8 * 3 * 4 * 3 * 7 * 4, index + 47343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 7 + 4, product* 4 * 8 * 3 * 4 * 4 * 3 * 7 * 4, index + 47344384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 7 + 4, product* 2 * 3 * 4 * 6 * 4 * 3 * 7 * 4, index + 47346432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 7 + 4, product* 4 * 2 * 2 * 8 * 4 * 3 * 7 * 4, index + 47348224);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 7 + 4, product* 8 * 4 * 4 * 8 * 6 * 3 * 7 * 4, index + 47368448);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 3 + 7 + 4, product* 8 * 8 * 2 * 2 * 7 * 3 * 7 * 4, index + 47372288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 7 + 4, product* 4 * 2 * 8 * 3 * 7 * 3 * 7 * 4, index + 47373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 7 + 4, product* 6 * 3 * 3 * 4 * 7 * 3 * 7 * 4, index + 47374336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 3 + 7 + 4, product* 4 * 8 * 3 * 6 * 7 * 3 * 7 * 4, index + 47376384);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 7 + 4, product* 2 * 7 * 2 * 2 * 8 * 3 * 7 * 4, index + 47382272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3 + 7 + 4, product* 4 * 8 * 7 * 2 * 8 * 3 * 7 * 4, index + 47382784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 7 + 4, product* 6 * 9 * 2 * 3 * 8 * 3 * 7 * 4, index + 47383296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 7 + 4, product* 2 * 3 * 8 * 4 * 8 * 3 * 7 * 4, index + 47384832);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 7 + 4, product* 6 * 7 * 9 * 2 * 2 * 4 * 7 * 4, index + 47422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 7 + 4, product* 2 * 3 * 2 * 3 * 2 * 4 * 7 * 4, index + 47423232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 7 + 4, product* 2 * 3 * 6 * 9 * 2 * 4 * 7 * 4, index + 47429632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 7 + 4, product* 2 * 7 * 4 * 3 * 3 * 4 * 7 * 4, index + 47433472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 7 + 4, product* 4 * 8 * 9 * 3 * 3 * 4 * 7 * 4, index + 47433984);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4 + 7 + 4, product* 4 * 2 * 8 * 7 * 3 * 4 * 7 * 4, index + 47437824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 7 + 4, product* 6 * 3 * 3 * 8 * 3 * 4 * 7 * 4, index + 47438336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 4 + 7 + 4, product* 2 * 7 * 8 * 9 * 3 * 4 * 7 * 4, index + 47439872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 7 + 4, product* 2 * 3 * 4 * 2 * 4 * 4 * 7 * 4, index + 47442432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 7 + 4, product* 4 * 2 * 2 * 4 * 4 * 4 * 7 * 4, index + 47444224);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 7 + 4, product* 4 * 4 * 3 * 9 * 4 * 4 * 7 * 4, index + 47449344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 7 + 4, product* 4 * 2 * 4 * 3 * 6 * 4 * 7 * 4, index + 47463424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 4 + 7 + 4, product* 6 * 3 * 9 * 3 * 6 * 4 * 7 * 4, index + 47463936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 4 + 7 + 4, product* 6 * 9 * 4 * 6 * 6 * 4 * 7 * 4, index + 47466496);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 4 + 7 + 4, product* 2 * 9 * 3 * 7 * 6 * 4 * 7 * 4, index + 47467392);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 7 + 4, product* 2 * 3 * 4 * 4 * 7 * 4 * 7 * 4, index + 47474432);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 4 + 7 + 4, product* 2 * 9 * 9 * 6 * 7 * 4 * 7 * 4, index + 47476992);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 7 + 4, product* 2 * 7 * 2 * 8 * 7 * 4 * 7 * 4, index + 47478272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 7 + 4 + 7 + 4, product* 6 * 9 * 2 * 9 * 7 * 4 * 7 * 4, index + 47479296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 7 + 4, product* 4 * 2 * 6 * 2 * 8 * 4 * 7 * 4, index + 47482624);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 7 + 4, product* 2 * 3 * 6 * 3 * 9 * 4 * 7 * 4, index + 47493632);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 7 + 4, product* 2 * 7 * 2 * 2 * 2 * 6 * 7 * 4, index + 47622272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 7 + 4, product* 4 * 2 * 4 * 3 * 2 * 6 * 7 * 4, index + 47623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 7 + 4, product* 6 * 3 * 9 * 3 * 2 * 6 * 7 * 4, index + 47623936);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 6 + 7 + 4, product* 6 * 9 * 4 * 6 * 2 * 6 * 7 * 4, index + 47626496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 7 + 4, product* 4 * 6 * 2 * 7 * 2 * 6 * 7 * 4, index + 47627264);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 7 + 4, product* 2 * 3 * 4 * 4 * 3 * 6 * 7 * 4, index + 47634432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 7 + 4, product* 4 * 2 * 2 * 6 * 3 * 6 * 7 * 4, index + 47636224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 7 + 4, product* 4 * 2 * 6 * 2 * 4 * 6 * 7 * 4, index + 47642624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 7 + 4, product* 2 * 3 * 2 * 7 * 4 * 6 * 7 * 4, index + 47647232);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 7 + 4, product* 2 * 3 * 4 * 6 * 6 * 6 * 7 * 4, index + 47666432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 7 + 4, product* 4 * 2 * 2 * 8 * 6 * 6 * 7 * 4, index + 47668224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 7 + 4, product* 2 * 3 * 8 * 2 * 7 * 6 * 7 * 4, index + 47672832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 6 + 7 + 4, product* 4 * 4 * 3 * 3 * 7 * 6 * 7 * 4, index + 47673344);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 7 + 4, product* 2 * 3 * 2 * 9 * 7 * 6 * 7 * 4, index + 47679232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 6 + 7 + 4, product* 8 * 2 * 3 * 3 * 8 * 6 * 7 * 4, index + 47683328);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 7 + 4, product* 6 * 9 * 4 * 2 * 2 * 7 * 7 * 4, index + 47722496);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 7 + 7 + 4, product* 2 * 7 * 8 * 7 * 2 * 7 * 7 * 4, index + 47727872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 7 + 4, product* 4 * 2 * 2 * 2 * 3 * 7 * 7 * 4, index + 47732224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 7 + 4, product* 8 * 4 * 2 * 3 * 3 * 7 * 7 * 4, index + 47733248);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 7 + 7 + 4, product* 6 * 7 * 9 * 2 * 4 * 7 * 7 * 4, index + 47742976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 7 + 4, product* 2 * 3 * 2 * 3 * 4 * 7 * 7 * 4, index + 47743232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 7 + 7 + 4, product* 2 * 3 * 6 * 9 * 4 * 7 * 7 * 4, index + 47749632);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 7 + 4, product* 4 * 2 * 2 * 4 * 6 * 7 * 7 * 4, index + 47764224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 7 + 7 + 4, product* 6 * 3 * 7 * 4 * 6 * 7 * 7 * 4, index + 47764736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 7 + 7 + 4, product* 2 * 7 * 2 * 6 * 6 * 7 * 7 * 4, index + 47766272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 7 + 7 + 4, product* 6 * 9 * 2 * 7 * 6 * 7 * 7 * 4, index + 47767296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 7 + 7 + 4, product* 2 * 3 * 8 * 8 * 6 * 7 * 7 * 4, index + 47768832);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7 + 7 + 4, product* 8 * 2 * 3 * 9 * 7 * 7 * 7 * 4, index + 47779328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7 + 7 + 4, product* 4 * 2 * 4 * 3 * 8 * 7 * 7 * 4, index + 47783424);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 7 + 4, product* 2 * 3 * 4 * 4 * 9 * 7 * 7 * 4, index + 47794432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 7 + 4, product* 6 * 3 * 3 * 2 * 2 * 8 * 7 * 4, index + 47822336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 7 + 4, product* 4 * 8 * 3 * 4 * 2 * 8 * 7 * 4, index + 47824384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 7 + 4, product* 2 * 3 * 4 * 6 * 2 * 8 * 7 * 4, index + 47826432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 7 + 4, product* 2 * 3 * 8 * 2 * 3 * 8 * 7 * 4, index + 47832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 7 + 4, product* 4 * 4 * 3 * 3 * 3 * 8 * 7 * 4, index + 47833344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 7 + 4, product* 4 * 2 * 6 * 4 * 3 * 8 * 7 * 4, index + 47834624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 7 + 4, product* 2 * 3 * 2 * 9 * 3 * 8 * 7 * 4, index + 47839232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 8 + 7 + 4, product* 8 * 2 * 3 * 3 * 4 * 8 * 7 * 4, index + 47843328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 7 + 4, product* 2 * 7 * 2 * 2 * 6 * 8 * 7 * 4, index + 47862272);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 8 + 7 + 4, product* 8 * 8 * 2 * 4 * 8 * 8 * 7 * 4, index + 47884288);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 8 + 8 + 7 + 4, product* 6 * 9 * 8 * 8 * 8 * 8 * 7 * 4, index + 47888896);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 8 + 7 + 4, product* 2 * 9 * 9 * 2 * 9 * 8 * 7 * 4, index + 47892992);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 7 + 4, product* 2 * 3 * 4 * 2 * 2 * 9 * 7 * 4, index + 47922432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 9 + 7 + 4, product* 8 * 8 * 6 * 2 * 2 * 9 * 7 * 4, index + 47922688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 7 + 4, product* 4 * 4 * 9 * 2 * 2 * 9 * 7 * 4, index + 47922944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 7 + 4, product* 4 * 2 * 2 * 4 * 2 * 9 * 7 * 4, index + 47924224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 7 + 4, product* 2 * 7 * 2 * 6 * 2 * 9 * 7 * 4, index + 47926272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 9 + 7 + 4, product* 4 * 8 * 7 * 6 * 2 * 9 * 7 * 4, index + 47926784);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 9 + 7 + 4, product* 6 * 9 * 6 * 3 * 3 * 9 * 7 * 4, index + 47933696);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 9 + 7 + 4, product* 4 * 6 * 4 * 4 * 3 * 9 * 7 * 4, index + 47934464);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9 + 7 + 4, product* 4 * 2 * 4 * 3 * 4 * 9 * 7 * 4, index + 47943424);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 7 + 4, product* 4 * 2 * 6 * 2 * 6 * 9 * 7 * 4, index + 47962624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 7 + 4, product* 2 * 3 * 2 * 7 * 6 * 9 * 7 * 4, index + 47967232);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 9 + 7 + 4, product* 4 * 6 * 4 * 8 * 9 * 9 * 7 * 4, index + 47998464);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 8 + 4, product* 4 * 6 * 4 * 2 * 2 * 2 * 8 * 4, index + 48222464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 8 + 4, product* 2 * 3 * 2 * 3 * 2 * 2 * 8 * 4, index + 48223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 8 + 4, product* 8 * 8 * 4 * 3 * 2 * 2 * 8 * 4, index + 48223488);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 8 + 4, product* 8 * 2 * 3 * 7 * 2 * 2 * 8 * 4, index + 48227328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 8 + 4, product* 2 * 3 * 6 * 9 * 2 * 2 * 8 * 4, index + 48229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 8 + 4, product* 8 * 4 * 4 * 2 * 3 * 2 * 8 * 4, index + 48232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 8 + 4, product* 2 * 7 * 4 * 3 * 3 * 2 * 8 * 4, index + 48233472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 8 + 4, product* 4 * 8 * 9 * 3 * 3 * 2 * 8 * 4, index + 48233984);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 8 + 4, product* 8 * 8 * 2 * 6 * 3 * 2 * 8 * 4, index + 48236288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 8 + 4, product* 4 * 2 * 8 * 7 * 3 * 2 * 8 * 4, index + 48237824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 8 + 4, product* 2 * 3 * 4 * 2 * 4 * 2 * 8 * 4, index + 48242432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 8 + 4, product* 4 * 2 * 2 * 4 * 4 * 2 * 8 * 4, index + 48244224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 8 + 4, product* 2 * 9 * 9 * 4 * 4 * 2 * 8 * 4, index + 48244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 8 + 4, product* 2 * 7 * 2 * 6 * 4 * 2 * 8 * 4, index + 48246272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 8 + 4, product* 4 * 2 * 4 * 3 * 6 * 2 * 8 * 4, index + 48263424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 8 + 4, product* 4 * 6 * 2 * 7 * 6 * 2 * 8 * 4, index + 48267264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 8 + 4, product* 4 * 8 * 3 * 2 * 7 * 2 * 8 * 4, index + 48272384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 8 + 4, product* 4 * 6 * 6 * 3 * 7 * 2 * 8 * 4, index + 48273664);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 8 + 4, product* 4 * 4 * 9 * 4 * 7 * 2 * 8 * 4, index + 48274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 8 + 4, product* 4 * 2 * 2 * 6 * 7 * 2 * 8 * 4, index + 48276224);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 8 + 4, product* 8 * 6 * 3 * 2 * 8 * 2 * 8 * 4, index + 48282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 8 + 4, product* 4 * 2 * 6 * 2 * 8 * 2 * 8 * 4, index + 48282624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 8 + 4, product* 2 * 7 * 6 * 4 * 8 * 2 * 8 * 4, index + 48284672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 8 + 4, product* 2 * 3 * 2 * 7 * 8 * 2 * 8 * 4, index + 48287232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 8 + 4, product* 2 * 3 * 6 * 3 * 9 * 2 * 8 * 4, index + 48293632);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 8 + 4, product* 8 * 2 * 3 * 3 * 2 * 3 * 8 * 4, index + 48323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 8 + 4, product* 4 * 2 * 4 * 7 * 2 * 3 * 8 * 4, index + 48327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 8 + 4, product* 6 * 3 * 9 * 7 * 2 * 3 * 8 * 4, index + 48327936);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 8 + 4, product* 8 * 8 * 2 * 2 * 3 * 3 * 8 * 4, index + 48332288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 8 + 4, product* 4 * 2 * 8 * 3 * 3 * 3 * 8 * 4, index + 48333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 8 + 4, product* 6 * 3 * 3 * 4 * 3 * 3 * 8 * 4, index + 48334336);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 8 + 4, product* 2 * 7 * 2 * 2 * 4 * 3 * 8 * 4, index + 48342272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 8 + 4, product* 4 * 2 * 6 * 6 * 4 * 3 * 8 * 4, index + 48346624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 8 + 4, product* 2 * 9 * 3 * 7 * 4 * 3 * 8 * 4, index + 48347392);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 8 + 4, product* 4 * 6 * 2 * 3 * 6 * 3 * 8 * 4, index + 48363264);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 6 + 3 + 8 + 4, product* 8 * 4 * 8 * 6 * 6 * 3 * 8 * 4, index + 48366848);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 6 + 3 + 8 + 4, product* 2 * 7 * 8 * 7 * 6 * 3 * 8 * 4, index + 48367872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 8 + 4, product* 4 * 2 * 2 * 2 * 7 * 3 * 8 * 4, index + 48372224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 8 + 4, product* 2 * 7 * 2 * 4 * 7 * 3 * 8 * 4, index + 48374272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 8 + 4, product* 4 * 4 * 3 * 7 * 7 * 3 * 8 * 4, index + 48377344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 8 + 4, product* 2 * 9 * 3 * 9 * 7 * 3 * 8 * 4, index + 48379392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 8 + 4, product* 4 * 6 * 4 * 2 * 8 * 3 * 8 * 4, index + 48382464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 8 + 4, product* 2 * 3 * 2 * 3 * 8 * 3 * 8 * 4, index + 48383232);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 8 + 4, product* 8 * 2 * 7 * 3 * 9 * 3 * 8 * 4, index + 48393728);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 8 + 4, product* 4 * 2 * 4 * 3 * 2 * 4 * 8 * 4, index + 48423424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 8 + 4, product* 8 * 4 * 4 * 4 * 2 * 4 * 8 * 4, index + 48424448);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 8 + 4, product* 4 * 8 * 3 * 2 * 3 * 4 * 8 * 4, index + 48432384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 8 + 4, product* 4 * 6 * 6 * 3 * 3 * 4 * 8 * 4, index + 48433664);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 8 + 4, product* 4 * 2 * 2 * 6 * 3 * 4 * 8 * 4, index + 48436224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 8 + 4, product* 8 * 4 * 2 * 7 * 3 * 4 * 8 * 4, index + 48437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 8 + 4, product* 2 * 7 * 2 * 8 * 3 * 4 * 8 * 4, index + 48438272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 8 + 4, product* 8 * 6 * 3 * 2 * 4 * 4 * 8 * 4, index + 48442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 8 + 4, product* 4 * 2 * 6 * 2 * 4 * 4 * 8 * 4, index + 48442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 8 + 4, product* 2 * 9 * 3 * 3 * 4 * 4 * 8 * 4, index + 48443392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 8 + 4, product* 8 * 2 * 9 * 4 * 4 * 4 * 8 * 4, index + 48444928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 8 + 4, product* 2 * 3 * 2 * 7 * 4 * 4 * 8 * 4, index + 48447232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 8 + 4, product* 6 * 3 * 3 * 2 * 6 * 4 * 8 * 4, index + 48462336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 8 + 4, product* 2 * 7 * 8 * 3 * 6 * 4 * 8 * 4, index + 48463872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 8 + 4, product* 4 * 8 * 3 * 4 * 6 * 4 * 8 * 4, index + 48464384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 8 + 4, product* 2 * 3 * 4 * 6 * 6 * 4 * 8 * 4, index + 48466432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 8 + 4, product* 2 * 3 * 8 * 2 * 7 * 4 * 8 * 4, index + 48472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 8 + 4, product* 4 * 4 * 3 * 3 * 7 * 4 * 8 * 4, index + 48473344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 8 + 4, product* 4 * 2 * 6 * 4 * 7 * 4 * 8 * 4, index + 48474624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 4 + 8 + 4, product* 2 * 7 * 6 * 6 * 7 * 4 * 8 * 4, index + 48476672);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 4 + 8 + 4, product* 4 * 4 * 7 * 9 * 7 * 4 * 8 * 4, index + 48479744);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 8 + 4, product* 4 * 2 * 4 * 7 * 8 * 4 * 8 * 4, index + 48487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 8 + 4, product* 2 * 7 * 4 * 9 * 8 * 4 * 8 * 4, index + 48489472);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 8 + 4, product* 6 * 3 * 3 * 4 * 9 * 4 * 8 * 4, index + 48494336);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 8 + 4, product* 6 * 3 * 3 * 2 * 2 * 6 * 8 * 4, index + 48622336);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 8 + 4, product* 6 * 9 * 8 * 4 * 2 * 6 * 8 * 4, index + 48624896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 8 + 4, product* 2 * 3 * 4 * 6 * 2 * 6 * 8 * 4, index + 48626432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 8 + 4, product* 4 * 2 * 2 * 8 * 2 * 6 * 8 * 4, index + 48628224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 6 + 8 + 4, product* 8 * 4 * 2 * 9 * 2 * 6 * 8 * 4, index + 48629248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 8 + 4, product* 2 * 3 * 8 * 2 * 3 * 6 * 8 * 4, index + 48632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 8 + 4, product* 4 * 4 * 3 * 3 * 3 * 6 * 8 * 4, index + 48633344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 8 + 4, product* 2 * 7 * 6 * 6 * 3 * 6 * 8 * 4, index + 48636672);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 8 + 4, product* 4 * 2 * 4 * 7 * 4 * 6 * 8 * 4, index + 48647424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 8 + 4, product* 2 * 7 * 2 * 2 * 6 * 6 * 8 * 4, index + 48662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 8 + 4, product* 4 * 8 * 7 * 2 * 6 * 6 * 8 * 4, index + 48662784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 8 + 4, product* 2 * 3 * 8 * 4 * 6 * 6 * 8 * 4, index + 48664832);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 8 + 4, product* 4 * 2 * 2 * 2 * 9 * 6 * 8 * 4, index + 48692224);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 8 + 4, product* 2 * 3 * 4 * 2 * 2 * 7 * 8 * 4, index + 48722432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 8 + 4, product* 4 * 2 * 2 * 4 * 2 * 7 * 8 * 4, index + 48724224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 8 + 4, product* 2 * 7 * 2 * 6 * 2 * 7 * 8 * 4, index + 48726272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 8 + 4, product* 4 * 4 * 3 * 9 * 2 * 7 * 8 * 4, index + 48729344);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 8 + 4, product* 4 * 2 * 6 * 2 * 6 * 7 * 8 * 4, index + 48762624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 8 + 4, product* 2 * 3 * 2 * 7 * 6 * 7 * 8 * 4, index + 48767232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 7 + 8 + 4, product* 4 * 6 * 8 * 2 * 7 * 7 * 8 * 4, index + 48772864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 7 + 8 + 4, product* 6 * 7 * 3 * 3 * 7 * 7 * 8 * 4, index + 48773376);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 7 + 8 + 4, product* 2 * 3 * 2 * 9 * 9 * 7 * 8 * 4, index + 48799232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 8 + 4, product* 2 * 7 * 2 * 2 * 2 * 8 * 8 * 4, index + 48822272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 8 + 4, product* 2 * 3 * 8 * 4 * 2 * 8 * 8 * 4, index + 48824832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 8 + 8 + 4, product* 4 * 2 * 6 * 6 * 2 * 8 * 8 * 4, index + 48826624);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 8 + 8 + 4, product* 6 * 9 * 4 * 2 * 4 * 8 * 8 * 4, index + 48842496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 8 + 4, product* 4 * 6 * 2 * 3 * 4 * 8 * 8 * 4, index + 48843264);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 8 + 4, product* 2 * 3 * 2 * 3 * 6 * 8 * 8 * 4, index + 48863232);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 8 + 4, product* 4 * 2 * 6 * 2 * 2 * 9 * 8 * 4, index + 48922624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 8 + 4, product* 2 * 7 * 6 * 4 * 2 * 9 * 8 * 4, index + 48924672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 8 + 4, product* 2 * 3 * 2 * 7 * 2 * 9 * 8 * 4, index + 48927232);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 8 + 4, product* 4 * 8 * 3 * 4 * 4 * 9 * 8 * 4, index + 48944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 8 + 4, product* 2 * 3 * 4 * 6 * 4 * 9 * 8 * 4, index + 48946432);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 9 + 8 + 4, product* 8 * 8 * 2 * 2 * 7 * 9 * 8 * 4, index + 48972288);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 9 + 4, product* 4 * 2 * 4 * 3 * 2 * 2 * 9 * 4, index + 49223424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 9 + 4, product* 4 * 6 * 2 * 7 * 2 * 2 * 9 * 4, index + 49227264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2 + 9 + 4, product* 8 * 8 * 2 * 8 * 2 * 2 * 9 * 4, index + 49228288);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 9 + 4, product* 4 * 6 * 6 * 3 * 3 * 2 * 9 * 4, index + 49233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 9 + 4, product* 2 * 3 * 4 * 4 * 3 * 2 * 9 * 4, index + 49234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 9 + 4, product* 4 * 4 * 9 * 4 * 3 * 2 * 9 * 4, index + 49234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 9 + 4, product* 4 * 2 * 2 * 6 * 3 * 2 * 9 * 4, index + 49236224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 3 + 2 + 9 + 4, product* 6 * 3 * 7 * 6 * 3 * 2 * 9 * 4, index + 49236736);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 9 + 4, product* 8 * 4 * 2 * 7 * 3 * 2 * 9 * 4, index + 49237248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 9 + 4, product* 2 * 7 * 2 * 8 * 3 * 2 * 9 * 4, index + 49238272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 9 + 4, product* 4 * 2 * 6 * 2 * 4 * 2 * 9 * 4, index + 49242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 9 + 4, product* 2 * 9 * 3 * 3 * 4 * 2 * 9 * 4, index + 49243392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 9 + 4, product* 2 * 7 * 6 * 4 * 4 * 2 * 9 * 4, index + 49244672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 9 + 4, product* 2 * 3 * 2 * 7 * 4 * 2 * 9 * 4, index + 49247232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 2 + 9 + 4, product* 4 * 4 * 7 * 7 * 4 * 2 * 9 * 4, index + 49247744);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 9 + 4, product* 4 * 8 * 3 * 4 * 6 * 2 * 9 * 4, index + 49264384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 9 + 4, product* 2 * 3 * 4 * 6 * 6 * 2 * 9 * 4, index + 49266432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 9 + 4, product* 4 * 2 * 2 * 8 * 6 * 2 * 9 * 4, index + 49268224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 2 + 9 + 4, product* 8 * 4 * 2 * 9 * 6 * 2 * 9 * 4, index + 49269248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 9 + 4, product* 2 * 3 * 8 * 2 * 7 * 2 * 9 * 4, index + 49272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 9 + 4, product* 4 * 4 * 3 * 3 * 7 * 2 * 9 * 4, index + 49273344);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 2 + 9 + 4, product* 8 * 2 * 9 * 6 * 7 * 2 * 9 * 4, index + 49276928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 9 + 4, product* 2 * 3 * 2 * 9 * 7 * 2 * 9 * 4, index + 49279232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2 + 9 + 4, product* 4 * 2 * 4 * 7 * 8 * 2 * 9 * 4, index + 49287424);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 9 + 4, product* 8 * 8 * 2 * 2 * 9 * 2 * 9 * 4, index + 49292288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 9 + 4, product* 4 * 2 * 8 * 3 * 9 * 2 * 9 * 4, index + 49293824);
-body<0>(stream, sum+ 8 + 4 + 8 + 4 + 9 + 2 + 9 + 4, product* 8 * 4 * 8 * 4 * 9 * 2 * 9 * 4, index + 49294848);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 2 + 9 + 4, product* 4 * 4 * 9 * 8 * 9 * 2 * 9 * 4, index + 49298944);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 9 + 4, product* 4 * 6 * 2 * 3 * 2 * 3 * 9 * 4, index + 49323264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 9 + 4, product* 6 * 3 * 3 * 6 * 2 * 3 * 9 * 4, index + 49326336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 9 + 4, product* 4 * 8 * 3 * 8 * 2 * 3 * 9 * 4, index + 49328384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 9 + 4, product* 4 * 2 * 2 * 2 * 3 * 3 * 9 * 4, index + 49332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 9 + 4, product* 6 * 3 * 7 * 2 * 3 * 3 * 9 * 4, index + 49332736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 9 + 4, product* 2 * 9 * 9 * 2 * 3 * 3 * 9 * 4, index + 49332992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 9 + 4, product* 2 * 7 * 2 * 4 * 3 * 3 * 9 * 4, index + 49334272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 9 + 4, product* 2 * 3 * 8 * 6 * 3 * 3 * 9 * 4, index + 49336832);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 9 + 4, product* 4 * 2 * 6 * 8 * 3 * 3 * 9 * 4, index + 49338624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 9 + 4, product* 2 * 9 * 3 * 9 * 3 * 3 * 9 * 4, index + 49339392);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 4 + 3 + 9 + 4, product* 6 * 7 * 9 * 2 * 4 * 3 * 9 * 4, index + 49342976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 9 + 4, product* 2 * 3 * 2 * 3 * 4 * 3 * 9 * 4, index + 49343232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3 + 9 + 4, product* 8 * 8 * 4 * 3 * 4 * 3 * 9 * 4, index + 49343488);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 4 + 3 + 9 + 4, product* 8 * 6 * 7 * 4 * 4 * 3 * 9 * 4, index + 49344768);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 9 + 4, product* 2 * 3 * 4 * 2 * 6 * 3 * 9 * 4, index + 49362432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 9 + 4, product* 4 * 4 * 9 * 2 * 6 * 3 * 9 * 4, index + 49362944);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 9 + 4, product* 2 * 7 * 6 * 2 * 7 * 3 * 9 * 4, index + 49372672);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 9 + 4, product* 4 * 2 * 4 * 3 * 8 * 3 * 9 * 4, index + 49383424);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 9 + 3 + 9 + 4, product* 2 * 7 * 2 * 8 * 9 * 3 * 9 * 4, index + 49398272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 9 + 4, product* 6 * 3 * 3 * 2 * 2 * 4 * 9 * 4, index + 49422336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 9 + 4, product* 2 * 3 * 4 * 6 * 2 * 4 * 9 * 4, index + 49426432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 9 + 4, product* 4 * 2 * 2 * 8 * 2 * 4 * 9 * 4, index + 49428224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4 + 9 + 4, product* 8 * 4 * 2 * 9 * 2 * 4 * 9 * 4, index + 49429248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 9 + 4, product* 2 * 3 * 8 * 2 * 3 * 4 * 9 * 4, index + 49432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 9 + 4, product* 4 * 4 * 3 * 3 * 3 * 4 * 9 * 4, index + 49433344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 9 + 4, product* 4 * 2 * 6 * 4 * 3 * 4 * 9 * 4, index + 49434624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 9 + 4, product* 2 * 3 * 2 * 9 * 3 * 4 * 9 * 4, index + 49439232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 9 + 4, product* 4 * 2 * 4 * 7 * 4 * 4 * 9 * 4, index + 49447424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 9 + 4, product* 2 * 7 * 2 * 2 * 6 * 4 * 9 * 4, index + 49462272);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 9 + 4, product* 2 * 3 * 6 * 7 * 7 * 4 * 9 * 4, index + 49477632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 4 + 9 + 4, product* 4 * 6 * 2 * 3 * 8 * 4 * 9 * 4, index + 49483264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 4 + 9 + 4, product* 6 * 7 * 7 * 3 * 8 * 4 * 9 * 4, index + 49483776);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 9 + 4, product* 4 * 2 * 2 * 2 * 9 * 4 * 9 * 4, index + 49492224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4 + 9 + 4, product* 8 * 4 * 2 * 3 * 9 * 4 * 9 * 4, index + 49493248);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9 + 4 + 9 + 4, product* 8 * 4 * 6 * 9 * 9 * 4 * 9 * 4, index + 49499648);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 9 + 4, product* 2 * 7 * 2 * 2 * 2 * 6 * 9 * 4, index + 49622272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 9 + 4, product* 6 * 9 * 2 * 3 * 2 * 6 * 9 * 4, index + 49623296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 9 + 4, product* 2 * 3 * 8 * 4 * 2 * 6 * 9 * 4, index + 49624832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 6 + 9 + 4, product* 4 * 2 * 6 * 6 * 2 * 6 * 9 * 4, index + 49626624);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 6 + 9 + 4, product* 2 * 7 * 6 * 8 * 2 * 6 * 9 * 4, index + 49628672);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 6 + 9 + 4, product* 8 * 6 * 7 * 2 * 3 * 6 * 9 * 4, index + 49632768);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 9 + 4, product* 2 * 3 * 2 * 3 * 6 * 6 * 9 * 4, index + 49663232);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 6 + 9 + 4, product* 8 * 2 * 7 * 3 * 7 * 6 * 9 * 4, index + 49673728);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6 + 9 + 4, product* 6 * 3 * 3 * 8 * 7 * 6 * 9 * 4, index + 49678336);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 6 + 9 + 4, product* 4 * 4 * 9 * 2 * 8 * 6 * 9 * 4, index + 49682944);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 9 + 4, product* 4 * 2 * 6 * 2 * 2 * 7 * 9 * 4, index + 49722624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 9 + 4, product* 2 * 9 * 3 * 3 * 2 * 7 * 9 * 4, index + 49723392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 7 + 9 + 4, product* 2 * 7 * 6 * 4 * 2 * 7 * 9 * 4, index + 49724672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 7 + 9 + 4, product* 8 * 2 * 9 * 4 * 2 * 7 * 9 * 4, index + 49724928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 9 + 4, product* 2 * 3 * 2 * 7 * 2 * 7 * 9 * 4, index + 49727232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 9 + 4, product* 2 * 3 * 6 * 3 * 3 * 7 * 9 * 4, index + 49733632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 9 + 4, product* 2 * 7 * 4 * 7 * 3 * 7 * 9 * 4, index + 49737472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 7 + 9 + 4, product* 8 * 2 * 7 * 7 * 3 * 7 * 9 * 4, index + 49737728);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 7 + 9 + 4, product* 6 * 3 * 9 * 7 * 6 * 7 * 9 * 4, index + 49767936);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 9 + 4, product* 2 * 3 * 2 * 3 * 2 * 8 * 9 * 4, index + 49823232);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 9 + 4, product* 4 * 2 * 2 * 4 * 4 * 8 * 9 * 4, index + 49844224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 8 + 9 + 4, product* 4 * 2 * 6 * 2 * 8 * 8 * 9 * 4, index + 49882624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 9 + 4, product* 2 * 3 * 2 * 7 * 8 * 8 * 9 * 4, index + 49887232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 9 + 4, product* 8 * 2 * 3 * 3 * 2 * 9 * 9 * 4, index + 49923328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 9 + 4, product* 4 * 2 * 4 * 7 * 2 * 9 * 9 * 4, index + 49927424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9 + 9 + 4, product* 2 * 7 * 4 * 9 * 2 * 9 * 9 * 4, index + 49929472);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 9 + 4, product* 4 * 2 * 8 * 3 * 3 * 9 * 9 * 4, index + 49933824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 9 + 4, product* 2 * 3 * 4 * 8 * 3 * 9 * 9 * 4, index + 49938432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 9 + 4, product* 2 * 7 * 2 * 2 * 4 * 9 * 9 * 4, index + 49942272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 9 + 4, product* 2 * 3 * 8 * 4 * 4 * 9 * 9 * 4, index + 49944832);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 9 + 4, product* 4 * 2 * 2 * 2 * 7 * 9 * 9 * 4, index + 49972224);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 9 + 9 + 4, product* 4 * 4 * 3 * 7 * 7 * 9 * 9 * 4, index + 49977344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 9 + 9 + 4, product* 2 * 9 * 3 * 9 * 7 * 9 * 9 * 4, index + 49979392);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 9 + 9 + 4, product* 8 * 4 * 4 * 2 * 9 * 9 * 9 * 4, index + 49992448);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 9 + 9 + 4, product* 2 * 3 * 2 * 9 * 9 * 9 * 9 * 4, index + 49999232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 2 + 6, product* 6 * 3 * 3 * 2 * 2 * 2 * 2 * 6, index + 62222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 2 + 6, product* 8 * 4 * 8 * 2 * 2 * 2 * 2 * 6, index + 62222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 2 + 6, product* 2 * 7 * 8 * 3 * 2 * 2 * 2 * 6, index + 62223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 2 + 6, product* 4 * 8 * 3 * 4 * 2 * 2 * 2 * 6, index + 62224384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 2 + 6, product* 6 * 9 * 8 * 4 * 2 * 2 * 2 * 6, index + 62224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 2 + 6, product* 2 * 3 * 4 * 6 * 2 * 2 * 2 * 6, index + 62226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 2 + 6, product* 4 * 4 * 9 * 6 * 2 * 2 * 2 * 6, index + 62226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 2 + 6, product* 4 * 2 * 2 * 8 * 2 * 2 * 2 * 6, index + 62228224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 2 + 6, product* 2 * 9 * 9 * 8 * 2 * 2 * 2 * 6, index + 62228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 2 + 6, product* 8 * 4 * 2 * 9 * 2 * 2 * 2 * 6, index + 62229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 2 + 6, product* 2 * 3 * 8 * 2 * 3 * 2 * 2 * 6, index + 62232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 2 + 6, product* 4 * 4 * 3 * 3 * 3 * 2 * 2 * 6, index + 62233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 2 + 6, product* 8 * 6 * 3 * 4 * 3 * 2 * 2 * 6, index + 62234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 2 + 6, product* 4 * 2 * 6 * 4 * 3 * 2 * 2 * 6, index + 62234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 2 + 6, product* 2 * 7 * 6 * 6 * 3 * 2 * 2 * 6, index + 62236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 2 + 6, product* 8 * 2 * 9 * 6 * 3 * 2 * 2 * 6, index + 62236928);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2 + 2 + 6, product* 6 * 7 * 9 * 8 * 3 * 2 * 2 * 6, index + 62238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 2 + 6, product* 2 * 3 * 2 * 9 * 3 * 2 * 2 * 6, index + 62239232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 2 + 6, product* 8 * 2 * 3 * 3 * 4 * 2 * 2 * 6, index + 62243328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 2 + 6, product* 4 * 6 * 8 * 4 * 4 * 2 * 2 * 6, index + 62244864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 2 + 6, product* 4 * 2 * 4 * 7 * 4 * 2 * 2 * 6, index + 62247424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 2 + 6, product* 2 * 7 * 2 * 2 * 6 * 2 * 2 * 6, index + 62262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 2 + 6, product* 4 * 8 * 7 * 2 * 6 * 2 * 2 * 6, index + 62262784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 2 + 6, product* 2 * 3 * 8 * 4 * 6 * 2 * 2 * 6, index + 62264832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 2 + 6, product* 4 * 2 * 6 * 6 * 6 * 2 * 2 * 6, index + 62266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 2 + 6, product* 2 * 9 * 3 * 7 * 6 * 2 * 2 * 6, index + 62267392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 2 + 6, product* 8 * 4 * 6 * 7 * 6 * 2 * 2 * 6, index + 62267648);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 2 + 6, product* 8 * 6 * 7 * 2 * 7 * 2 * 2 * 6, index + 62272768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 2 + 6, product* 2 * 9 * 7 * 3 * 7 * 2 * 2 * 6, index + 62273792);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 2 + 6, product* 2 * 3 * 6 * 7 * 7 * 2 * 2 * 6, index + 62277632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 2 + 6, product* 4 * 2 * 4 * 9 * 7 * 2 * 2 * 6, index + 62279424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 2 + 6, product* 4 * 6 * 2 * 3 * 8 * 2 * 2 * 6, index + 62283264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 2 + 2 + 6, product* 6 * 7 * 7 * 3 * 8 * 2 * 2 * 6, index + 62283776);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 2 + 6, product* 6 * 3 * 3 * 6 * 8 * 2 * 2 * 6, index + 62286336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 2 + 2 + 6, product* 2 * 7 * 8 * 7 * 8 * 2 * 2 * 6, index + 62287872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 8 + 2 + 2 + 6, product* 4 * 8 * 3 * 8 * 8 * 2 * 2 * 6, index + 62288384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 2 + 6, product* 4 * 2 * 2 * 2 * 9 * 2 * 2 * 6, index + 62292224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 2 + 6, product* 2 * 9 * 9 * 2 * 9 * 2 * 2 * 6, index + 62292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 2 + 6, product* 8 * 4 * 2 * 3 * 9 * 2 * 2 * 6, index + 62293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 2 + 6, product* 2 * 7 * 2 * 4 * 9 * 2 * 2 * 6, index + 62294272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 2 + 6, product* 2 * 3 * 8 * 6 * 9 * 2 * 2 * 6, index + 62296832);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2 + 2 + 6, product* 4 * 2 * 6 * 8 * 9 * 2 * 2 * 6, index + 62298624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 2 + 6, product* 2 * 9 * 3 * 9 * 9 * 2 * 2 * 6, index + 62299392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 9 + 2 + 2 + 6, product* 8 * 4 * 6 * 9 * 9 * 2 * 2 * 6, index + 62299648);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 2 + 6, product* 2 * 3 * 4 * 2 * 2 * 3 * 2 * 6, index + 62322432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 2 + 3 + 2 + 6, product* 8 * 8 * 6 * 2 * 2 * 3 * 2 * 6, index + 62322688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 2 + 6, product* 4 * 4 * 9 * 2 * 2 * 3 * 2 * 6, index + 62322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 2 + 6, product* 4 * 2 * 2 * 4 * 2 * 3 * 2 * 6, index + 62324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 2 + 6, product* 6 * 3 * 7 * 4 * 2 * 3 * 2 * 6, index + 62324736);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 2 + 6, product* 2 * 9 * 9 * 4 * 2 * 3 * 2 * 6, index + 62324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 2 + 6, product* 2 * 7 * 2 * 6 * 2 * 3 * 2 * 6, index + 62326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 2 + 6, product* 4 * 8 * 7 * 6 * 2 * 3 * 2 * 6, index + 62326784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 2 + 6, product* 6 * 9 * 2 * 7 * 2 * 3 * 2 * 6, index + 62327296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 2 + 6, product* 2 * 3 * 8 * 8 * 2 * 3 * 2 * 6, index + 62328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 2 + 6, product* 4 * 4 * 3 * 9 * 2 * 3 * 2 * 6, index + 62329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 2 + 6, product* 2 * 7 * 6 * 2 * 3 * 3 * 2 * 6, index + 62332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 2 + 6, product* 8 * 2 * 9 * 2 * 3 * 3 * 2 * 6, index + 62332928);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 3 + 3 + 2 + 6, product* 6 * 9 * 6 * 3 * 3 * 3 * 2 * 6, index + 62333696);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 2 + 6, product* 4 * 6 * 4 * 4 * 3 * 3 * 2 * 6, index + 62334464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 3 + 2 + 6, product* 6 * 7 * 9 * 4 * 3 * 3 * 2 * 6, index + 62334976);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 2 + 6, product* 2 * 9 * 7 * 7 * 3 * 3 * 2 * 6, index + 62337792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 2 + 6, product* 8 * 2 * 3 * 9 * 3 * 3 * 2 * 6, index + 62339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 2 + 6, product* 4 * 2 * 4 * 3 * 4 * 3 * 2 * 6, index + 62343424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 2 + 6, product* 6 * 3 * 9 * 3 * 4 * 3 * 2 * 6, index + 62343936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 2 + 6, product* 4 * 6 * 2 * 7 * 4 * 3 * 2 * 6, index + 62347264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 4 + 3 + 2 + 6, product* 4 * 2 * 8 * 9 * 4 * 3 * 2 * 6, index + 62349824);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 3 + 2 + 6, product* 8 * 6 * 3 * 2 * 6 * 3 * 2 * 6, index + 62362368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 2 + 6, product* 4 * 2 * 6 * 2 * 6 * 3 * 2 * 6, index + 62362624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 2 + 6, product* 2 * 3 * 2 * 7 * 6 * 3 * 2 * 6, index + 62367232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 6 + 3 + 2 + 6, product* 4 * 4 * 7 * 7 * 6 * 3 * 2 * 6, index + 62367744);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 2 + 6, product* 4 * 6 * 8 * 2 * 7 * 3 * 2 * 6, index + 62372864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 2 + 6, product* 6 * 7 * 3 * 3 * 7 * 3 * 2 * 6, index + 62373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 2 + 6, product* 2 * 3 * 6 * 3 * 7 * 3 * 2 * 6, index + 62373632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 2 + 6, product* 8 * 4 * 4 * 6 * 7 * 3 * 2 * 6, index + 62376448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 2 + 6, product* 2 * 7 * 4 * 7 * 7 * 3 * 2 * 6, index + 62377472);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3 + 2 + 6, product* 6 * 9 * 4 * 8 * 7 * 3 * 2 * 6, index + 62378496);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 2 + 6, product* 6 * 3 * 3 * 2 * 8 * 3 * 2 * 6, index + 62382336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 2 + 6, product* 2 * 7 * 8 * 3 * 8 * 3 * 2 * 6, index + 62383872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 2 + 6, product* 4 * 2 * 2 * 8 * 8 * 3 * 2 * 6, index + 62388224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 3 + 2 + 6, product* 2 * 9 * 9 * 8 * 8 * 3 * 2 * 6, index + 62388992);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 2 + 6, product* 2 * 3 * 8 * 2 * 9 * 3 * 2 * 6, index + 62392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 2 + 6, product* 4 * 4 * 3 * 3 * 9 * 3 * 2 * 6, index + 62393344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 2 + 6, product* 4 * 2 * 6 * 4 * 9 * 3 * 2 * 6, index + 62394624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 2 + 6, product* 2 * 7 * 6 * 6 * 9 * 3 * 2 * 6, index + 62396672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 3 + 2 + 6, product* 4 * 6 * 4 * 8 * 9 * 3 * 2 * 6, index + 62398464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 2 + 6, product* 2 * 3 * 2 * 9 * 9 * 3 * 2 * 6, index + 62399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 2 + 6, product* 2 * 7 * 2 * 2 * 2 * 4 * 2 * 6, index + 62422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 2 + 6, product* 4 * 8 * 7 * 2 * 2 * 4 * 2 * 6, index + 62422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 2 + 6, product* 6 * 9 * 2 * 3 * 2 * 4 * 2 * 6, index + 62423296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 2 + 6, product* 2 * 3 * 8 * 4 * 2 * 4 * 2 * 6, index + 62424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 2 + 6, product* 8 * 6 * 3 * 6 * 2 * 4 * 2 * 6, index + 62426368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 2 + 6, product* 4 * 2 * 6 * 6 * 2 * 4 * 2 * 6, index + 62426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 2 + 6, product* 2 * 9 * 3 * 7 * 2 * 4 * 2 * 6, index + 62427392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 2 + 6, product* 2 * 7 * 6 * 8 * 2 * 4 * 2 * 6, index + 62428672);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 2 + 6, product* 4 * 6 * 8 * 6 * 3 * 4 * 2 * 6, index + 62436864);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 4 + 2 + 6, product* 6 * 7 * 3 * 7 * 3 * 4 * 2 * 6, index + 62437376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 2 + 6, product* 2 * 3 * 6 * 7 * 3 * 4 * 2 * 6, index + 62437632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 2 + 6, product* 4 * 2 * 4 * 9 * 3 * 4 * 2 * 6, index + 62439424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 2 + 6, product* 4 * 6 * 2 * 3 * 4 * 4 * 2 * 6, index + 62443264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 2 + 6, product* 8 * 8 * 2 * 4 * 4 * 4 * 2 * 6, index + 62444288);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 2 + 6, product* 4 * 6 * 4 * 2 * 6 * 4 * 2 * 6, index + 62462464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 2 + 6, product* 2 * 3 * 2 * 3 * 6 * 4 * 2 * 6, index + 62463232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 4 + 2 + 6, product* 8 * 8 * 4 * 3 * 6 * 4 * 2 * 6, index + 62463488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 2 + 6, product* 4 * 4 * 7 * 3 * 6 * 4 * 2 * 6, index + 62463744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 2 + 6, product* 2 * 3 * 6 * 9 * 6 * 4 * 2 * 6, index + 62469632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 2 + 6, product* 2 * 7 * 4 * 3 * 7 * 4 * 2 * 6, index + 62473472);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 4 + 2 + 6, product* 8 * 8 * 2 * 6 * 7 * 4 * 2 * 6, index + 62476288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 2 + 6, product* 4 * 2 * 8 * 7 * 7 * 4 * 2 * 6, index + 62477824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 2 + 6, product* 2 * 3 * 4 * 2 * 8 * 4 * 2 * 6, index + 62482432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 4 + 2 + 6, product* 8 * 8 * 6 * 2 * 8 * 4 * 2 * 6, index + 62482688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 4 + 2 + 6, product* 4 * 4 * 9 * 2 * 8 * 4 * 2 * 6, index + 62482944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 2 + 6, product* 4 * 2 * 2 * 4 * 8 * 4 * 2 * 6, index + 62484224);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 4 + 2 + 6, product* 2 * 3 * 8 * 8 * 8 * 4 * 2 * 6, index + 62488832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 2 + 6, product* 2 * 7 * 6 * 2 * 9 * 4 * 2 * 6, index + 62492672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 2 + 6, product* 8 * 2 * 9 * 2 * 9 * 4 * 2 * 6, index + 62492928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 4 + 2 + 6, product* 4 * 6 * 4 * 4 * 9 * 4 * 2 * 6, index + 62494464);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 2 + 6, product* 4 * 6 * 4 * 2 * 2 * 6 * 2 * 6, index + 62622464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 2 + 6, product* 2 * 3 * 2 * 3 * 2 * 6 * 2 * 6, index + 62623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 2 + 6, product* 4 * 4 * 7 * 3 * 2 * 6 * 2 * 6, index + 62623744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 2 + 6, product* 8 * 2 * 3 * 7 * 2 * 6 * 2 * 6, index + 62627328);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 2 + 6, product* 2 * 7 * 4 * 3 * 3 * 6 * 2 * 6, index + 62633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 2 + 6, product* 8 * 2 * 7 * 3 * 3 * 6 * 2 * 6, index + 62633728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 2 + 6, product* 4 * 8 * 9 * 3 * 3 * 6 * 2 * 6, index + 62633984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 2 + 6, product* 6 * 9 * 4 * 4 * 3 * 6 * 2 * 6, index + 62634496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 6 + 2 + 6, product* 8 * 8 * 2 * 6 * 3 * 6 * 2 * 6, index + 62636288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 2 + 6, product* 4 * 2 * 8 * 7 * 3 * 6 * 2 * 6, index + 62637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 2 + 6, product* 6 * 3 * 3 * 8 * 3 * 6 * 2 * 6, index + 62638336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 2 + 6, product* 2 * 3 * 4 * 2 * 4 * 6 * 2 * 6, index + 62642432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 6 + 2 + 6, product* 8 * 8 * 6 * 2 * 4 * 6 * 2 * 6, index + 62642688);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 6 + 2 + 6, product* 8 * 6 * 9 * 3 * 4 * 6 * 2 * 6, index + 62643968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 2 + 6, product* 4 * 2 * 2 * 4 * 4 * 6 * 2 * 6, index + 62644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 2 + 6, product* 2 * 7 * 2 * 6 * 4 * 6 * 2 * 6, index + 62646272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 4 + 6 + 2 + 6, product* 4 * 8 * 7 * 6 * 4 * 6 * 2 * 6, index + 62646784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 2 + 6, product* 2 * 3 * 8 * 8 * 4 * 6 * 2 * 6, index + 62648832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 2 + 6, product* 4 * 2 * 4 * 3 * 6 * 6 * 2 * 6, index + 62663424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 2 + 6, product* 8 * 4 * 4 * 4 * 6 * 6 * 2 * 6, index + 62664448);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 2 + 6, product* 2 * 3 * 4 * 4 * 7 * 6 * 2 * 6, index + 62674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 2 + 6, product* 4 * 2 * 2 * 6 * 7 * 6 * 2 * 6, index + 62676224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 6 + 2 + 6, product* 4 * 2 * 6 * 2 * 8 * 6 * 2 * 6, index + 62682624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 2 + 6, product* 2 * 9 * 3 * 3 * 8 * 6 * 2 * 6, index + 62683392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 6 + 2 + 6, product* 2 * 3 * 2 * 7 * 8 * 6 * 2 * 6, index + 62687232);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 8 + 6 + 2 + 6, product* 2 * 9 * 7 * 9 * 8 * 6 * 2 * 6, index + 62689792);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6 + 2 + 6, product* 6 * 7 * 3 * 3 * 9 * 6 * 2 * 6, index + 62693376);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6 + 2 + 6, product* 2 * 7 * 4 * 7 * 9 * 6 * 2 * 6, index + 62697472);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 2 + 6, product* 8 * 2 * 3 * 3 * 2 * 7 * 2 * 6, index + 62723328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 2 + 6, product* 4 * 2 * 4 * 7 * 2 * 7 * 2 * 6, index + 62727424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 2 + 6, product* 2 * 7 * 4 * 9 * 2 * 7 * 2 * 6, index + 62729472);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 7 + 2 + 6, product* 8 * 8 * 2 * 2 * 3 * 7 * 2 * 6, index + 62732288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 2 + 6, product* 4 * 2 * 8 * 3 * 3 * 7 * 2 * 6, index + 62733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 2 + 6, product* 6 * 3 * 3 * 4 * 3 * 7 * 2 * 6, index + 62734336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 2 + 6, product* 4 * 8 * 3 * 6 * 3 * 7 * 2 * 6, index + 62736384);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 2 + 6, product* 2 * 7 * 2 * 2 * 4 * 7 * 2 * 6, index + 62742272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 7 + 2 + 6, product* 4 * 8 * 7 * 2 * 4 * 7 * 2 * 6, index + 62742784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 2 + 6, product* 2 * 3 * 8 * 4 * 4 * 7 * 2 * 6, index + 62744832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 2 + 6, product* 2 * 7 * 6 * 8 * 4 * 7 * 2 * 6, index + 62748672);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 2 + 6, product* 4 * 6 * 2 * 3 * 6 * 7 * 2 * 6, index + 62763264);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 7 + 2 + 6, product* 4 * 8 * 3 * 8 * 6 * 7 * 2 * 6, index + 62768384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 2 + 6, product* 4 * 2 * 2 * 2 * 7 * 7 * 2 * 6, index + 62772224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 2 + 6, product* 6 * 3 * 7 * 2 * 7 * 7 * 2 * 6, index + 62772736);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 2 + 6, product* 2 * 7 * 2 * 4 * 7 * 7 * 2 * 6, index + 62774272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 7 + 2 + 6, product* 4 * 8 * 7 * 4 * 7 * 7 * 2 * 6, index + 62774784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 2 + 6, product* 2 * 3 * 8 * 6 * 7 * 7 * 2 * 6, index + 62776832);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7 + 2 + 6, product* 4 * 6 * 4 * 2 * 8 * 7 * 2 * 6, index + 62782464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 2 + 6, product* 2 * 3 * 2 * 3 * 8 * 7 * 2 * 6, index + 62783232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7 + 2 + 6, product* 4 * 4 * 7 * 3 * 8 * 7 * 2 * 6, index + 62783744);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 7 + 2 + 6, product* 4 * 6 * 8 * 8 * 8 * 7 * 2 * 6, index + 62788864);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 2 + 6, product* 4 * 2 * 4 * 3 * 2 * 8 * 2 * 6, index + 62823424);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 8 + 2 + 6, product* 6 * 9 * 4 * 6 * 2 * 8 * 2 * 6, index + 62826496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 2 + 6, product* 4 * 6 * 2 * 7 * 2 * 8 * 2 * 6, index + 62827264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 2 + 6, product* 4 * 2 * 8 * 9 * 2 * 8 * 2 * 6, index + 62829824);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 2 + 6, product* 2 * 3 * 4 * 4 * 3 * 8 * 2 * 6, index + 62834432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 2 + 6, product* 4 * 2 * 2 * 6 * 3 * 8 * 2 * 6, index + 62836224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 8 + 2 + 6, product* 2 * 9 * 9 * 6 * 3 * 8 * 2 * 6, index + 62836992);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 2 + 6, product* 2 * 7 * 2 * 8 * 3 * 8 * 2 * 6, index + 62838272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 8 + 2 + 6, product* 8 * 6 * 3 * 2 * 4 * 8 * 2 * 6, index + 62842368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 2 + 6, product* 4 * 2 * 6 * 2 * 4 * 8 * 2 * 6, index + 62842624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 2 + 6, product* 2 * 3 * 2 * 7 * 4 * 8 * 2 * 6, index + 62847232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 8 + 2 + 6, product* 6 * 3 * 3 * 2 * 6 * 8 * 2 * 6, index + 62862336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 8 + 2 + 6, product* 2 * 7 * 8 * 3 * 6 * 8 * 2 * 6, index + 62863872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 2 + 6, product* 4 * 2 * 2 * 8 * 6 * 8 * 2 * 6, index + 62868224);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 8 + 2 + 6, product* 4 * 2 * 6 * 4 * 7 * 8 * 2 * 6, index + 62874624);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 8 + 2 + 6, product* 6 * 7 * 9 * 8 * 7 * 8 * 2 * 6, index + 62878976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 2 + 6, product* 2 * 3 * 2 * 9 * 7 * 8 * 2 * 6, index + 62879232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 8 + 2 + 6, product* 4 * 2 * 4 * 7 * 8 * 8 * 2 * 6, index + 62887424);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 8 + 2 + 6, product* 4 * 6 * 6 * 7 * 9 * 8 * 2 * 6, index + 62897664);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 2 + 6, product* 4 * 6 * 2 * 3 * 2 * 9 * 2 * 6, index + 62923264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 9 + 2 + 6, product* 8 * 8 * 2 * 4 * 2 * 9 * 2 * 6, index + 62924288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 2 + 6, product* 6 * 3 * 3 * 6 * 2 * 9 * 2 * 6, index + 62926336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9 + 2 + 6, product* 4 * 8 * 3 * 8 * 2 * 9 * 2 * 6, index + 62928384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 9 + 2 + 6, product* 6 * 9 * 8 * 8 * 2 * 9 * 2 * 6, index + 62928896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 2 + 6, product* 4 * 2 * 2 * 2 * 3 * 9 * 2 * 6, index + 62932224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 2 + 6, product* 2 * 9 * 9 * 2 * 3 * 9 * 2 * 6, index + 62932992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 2 + 6, product* 8 * 4 * 2 * 3 * 3 * 9 * 2 * 6, index + 62933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 2 + 6, product* 2 * 7 * 2 * 4 * 3 * 9 * 2 * 6, index + 62934272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 2 + 6, product* 2 * 3 * 8 * 6 * 3 * 9 * 2 * 6, index + 62936832);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 2 + 6, product* 4 * 6 * 4 * 2 * 4 * 9 * 2 * 6, index + 62942464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 2 + 6, product* 2 * 3 * 2 * 3 * 4 * 9 * 2 * 6, index + 62943232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 9 + 2 + 6, product* 8 * 2 * 3 * 7 * 4 * 9 * 2 * 6, index + 62947328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 9 + 2 + 6, product* 4 * 6 * 8 * 8 * 4 * 9 * 2 * 6, index + 62948864);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 2 + 6, product* 4 * 2 * 2 * 4 * 6 * 9 * 2 * 6, index + 62964224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 9 + 2 + 6, product* 2 * 7 * 2 * 6 * 6 * 9 * 2 * 6, index + 62966272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 6 + 9 + 2 + 6, product* 2 * 3 * 8 * 8 * 6 * 9 * 2 * 6, index + 62968832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 9 + 2 + 6, product* 4 * 4 * 3 * 9 * 6 * 9 * 2 * 6, index + 62969344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 9 + 2 + 6, product* 2 * 7 * 6 * 2 * 7 * 9 * 2 * 6, index + 62972672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 9 + 2 + 6, product* 8 * 2 * 9 * 2 * 7 * 9 * 2 * 6, index + 62972928);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 9 + 2 + 6, product* 6 * 3 * 3 * 4 * 7 * 9 * 2 * 6, index + 62974336);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 8 + 9 + 2 + 6, product* 6 * 7 * 7 * 7 * 8 * 9 * 2 * 6, index + 62987776);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 9 + 2 + 6, product* 4 * 2 * 8 * 9 * 8 * 9 * 2 * 6, index + 62989824);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 3 + 6, product* 2 * 7 * 2 * 2 * 2 * 2 * 3 * 6, index + 63222272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 3 + 6, product* 6 * 9 * 2 * 3 * 2 * 2 * 3 * 6, index + 63223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 3 + 6, product* 2 * 3 * 8 * 4 * 2 * 2 * 3 * 6, index + 63224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 3 + 6, product* 8 * 6 * 3 * 6 * 2 * 2 * 3 * 6, index + 63226368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 3 + 6, product* 4 * 2 * 6 * 6 * 2 * 2 * 3 * 6, index + 63226624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 3 + 6, product* 2 * 9 * 3 * 7 * 2 * 2 * 3 * 6, index + 63227392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 3 + 6, product* 8 * 2 * 9 * 8 * 2 * 2 * 3 * 6, index + 63228928);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 3 + 6, product* 8 * 6 * 7 * 2 * 3 * 2 * 3 * 6, index + 63232768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 3 + 6, product* 2 * 9 * 7 * 3 * 3 * 2 * 3 * 6, index + 63233792);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 3 + 6, product* 6 * 7 * 3 * 7 * 3 * 2 * 3 * 6, index + 63237376);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 2 + 3 + 6, product* 2 * 3 * 6 * 7 * 3 * 2 * 3 * 6, index + 63237632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 3 + 6, product* 4 * 2 * 4 * 9 * 3 * 2 * 3 * 6, index + 63239424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 3 + 6, product* 6 * 9 * 4 * 2 * 4 * 2 * 3 * 6, index + 63242496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 3 + 6, product* 4 * 6 * 2 * 3 * 4 * 2 * 3 * 6, index + 63243264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 3 + 6, product* 8 * 8 * 2 * 4 * 4 * 2 * 3 * 6, index + 63244288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 3 + 6, product* 6 * 3 * 3 * 6 * 4 * 2 * 3 * 6, index + 63246336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 3 + 6, product* 4 * 8 * 3 * 8 * 4 * 2 * 3 * 6, index + 63248384);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 3 + 6, product* 4 * 6 * 4 * 2 * 6 * 2 * 3 * 6, index + 63262464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 3 + 6, product* 2 * 3 * 2 * 3 * 6 * 2 * 3 * 6, index + 63263232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 3 + 6, product* 8 * 8 * 4 * 3 * 6 * 2 * 3 * 6, index + 63263488);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2 + 3 + 6, product* 2 * 3 * 6 * 9 * 6 * 2 * 3 * 6, index + 63269632);
-body<0>(stream, sum+ 8 + 8 + 8 + 9 + 6 + 2 + 3 + 6, product* 8 * 8 * 8 * 9 * 6 * 2 * 3 * 6, index + 63269888);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 3 + 6, product* 8 * 4 * 4 * 2 * 7 * 2 * 3 * 6, index + 63272448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 3 + 6, product* 2 * 7 * 4 * 3 * 7 * 2 * 3 * 6, index + 63273472);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 2 + 3 + 6, product* 4 * 2 * 8 * 7 * 7 * 2 * 3 * 6, index + 63277824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 3 + 6, product* 2 * 3 * 4 * 2 * 8 * 2 * 3 * 6, index + 63282432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 8 + 2 + 3 + 6, product* 4 * 4 * 9 * 2 * 8 * 2 * 3 * 6, index + 63282944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 3 + 6, product* 4 * 2 * 2 * 4 * 8 * 2 * 3 * 6, index + 63284224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 2 + 3 + 6, product* 6 * 3 * 7 * 4 * 8 * 2 * 3 * 6, index + 63284736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 3 + 6, product* 2 * 7 * 2 * 6 * 8 * 2 * 3 * 6, index + 63286272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 8 + 2 + 3 + 6, product* 4 * 8 * 7 * 6 * 8 * 2 * 3 * 6, index + 63286784);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 3 + 6, product* 2 * 7 * 6 * 2 * 9 * 2 * 3 * 6, index + 63292672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 9 + 2 + 3 + 6, product* 4 * 6 * 4 * 4 * 9 * 2 * 3 * 6, index + 63294464);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 3 + 6, product* 8 * 6 * 3 * 2 * 2 * 3 * 3 * 6, index + 63322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 3 + 6, product* 4 * 2 * 6 * 2 * 2 * 3 * 3 * 6, index + 63322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 3 + 6, product* 2 * 9 * 3 * 3 * 2 * 3 * 3 * 6, index + 63323392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 3 + 6, product* 8 * 4 * 6 * 3 * 2 * 3 * 3 * 6, index + 63323648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 3 + 3 + 6, product* 2 * 7 * 6 * 4 * 2 * 3 * 3 * 6, index + 63324672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 3 + 6, product* 8 * 2 * 9 * 4 * 2 * 3 * 3 * 6, index + 63324928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 3 + 3 + 6, product* 4 * 6 * 4 * 6 * 2 * 3 * 3 * 6, index + 63326464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 3 + 6, product* 2 * 3 * 2 * 7 * 2 * 3 * 3 * 6, index + 63327232);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 3 + 6, product* 2 * 9 * 7 * 9 * 2 * 3 * 3 * 6, index + 63329792);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 3 + 6, product* 6 * 7 * 3 * 3 * 3 * 3 * 3 * 6, index + 63333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 3 + 6, product* 2 * 3 * 6 * 3 * 3 * 3 * 3 * 6, index + 63333632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 3 + 3 + 6, product* 8 * 8 * 8 * 3 * 3 * 3 * 3 * 6, index + 63333888);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 3 + 6, product* 6 * 3 * 3 * 2 * 4 * 3 * 3 * 6, index + 63342336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 3 + 6, product* 2 * 7 * 8 * 3 * 4 * 3 * 3 * 6, index + 63343872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 3 + 6, product* 4 * 2 * 2 * 8 * 4 * 3 * 3 * 6, index + 63348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 3 + 6, product* 6 * 3 * 7 * 8 * 4 * 3 * 3 * 6, index + 63348736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 4 + 3 + 3 + 6, product* 2 * 9 * 9 * 8 * 4 * 3 * 3 * 6, index + 63348992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 3 + 6, product* 8 * 4 * 2 * 9 * 4 * 3 * 3 * 6, index + 63349248);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 3 + 6, product* 8 * 2 * 3 * 3 * 6 * 3 * 3 * 6, index + 63363328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 3 + 6, product* 4 * 2 * 4 * 7 * 6 * 3 * 3 * 6, index + 63367424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 3 + 6, product* 4 * 2 * 8 * 3 * 7 * 3 * 3 * 6, index + 63373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 3 + 6, product* 6 * 3 * 3 * 4 * 7 * 3 * 3 * 6, index + 63374336);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 7 + 3 + 3 + 6, product* 4 * 6 * 6 * 7 * 7 * 3 * 3 * 6, index + 63377664);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 3 + 6, product* 2 * 7 * 2 * 2 * 8 * 3 * 3 * 6, index + 63382272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 3 + 6, product* 2 * 3 * 8 * 4 * 8 * 3 * 3 * 6, index + 63384832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 8 + 3 + 3 + 6, product* 2 * 9 * 3 * 7 * 8 * 3 * 3 * 6, index + 63387392);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 3 + 6, product* 4 * 2 * 4 * 9 * 9 * 3 * 3 * 6, index + 63399424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 3 + 6, product* 4 * 6 * 4 * 2 * 2 * 4 * 3 * 6, index + 63422464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 3 + 6, product* 6 * 7 * 9 * 2 * 2 * 4 * 3 * 6, index + 63422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 3 + 6, product* 2 * 3 * 2 * 3 * 2 * 4 * 3 * 6, index + 63423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 3 + 6, product* 8 * 8 * 4 * 3 * 2 * 4 * 3 * 6, index + 63423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 3 + 6, product* 4 * 4 * 7 * 3 * 2 * 4 * 3 * 6, index + 63423744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 3 + 6, product* 8 * 2 * 3 * 7 * 2 * 4 * 3 * 6, index + 63427328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 3 + 6, product* 2 * 3 * 6 * 9 * 2 * 4 * 3 * 6, index + 63429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 3 + 6, product* 8 * 4 * 4 * 2 * 3 * 4 * 3 * 6, index + 63432448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 3 + 6, product* 2 * 7 * 4 * 3 * 3 * 4 * 3 * 6, index + 63433472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 4 + 3 + 6, product* 4 * 8 * 9 * 3 * 3 * 4 * 3 * 6, index + 63433984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 4 + 3 + 6, product* 6 * 9 * 4 * 4 * 3 * 4 * 3 * 6, index + 63434496);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 3 + 6, product* 6 * 3 * 3 * 8 * 3 * 4 * 3 * 6, index + 63438336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 3 + 6, product* 2 * 3 * 4 * 2 * 4 * 4 * 3 * 6, index + 63442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 3 + 6, product* 4 * 4 * 9 * 2 * 4 * 4 * 3 * 6, index + 63442944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 3 + 6, product* 4 * 2 * 2 * 4 * 4 * 4 * 3 * 6, index + 63444224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 4 + 3 + 6, product* 2 * 9 * 9 * 4 * 4 * 4 * 3 * 6, index + 63444992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 3 + 6, product* 2 * 7 * 2 * 6 * 4 * 4 * 3 * 6, index + 63446272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 3 + 6, product* 4 * 2 * 4 * 3 * 6 * 4 * 3 * 6, index + 63463424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 4 + 3 + 6, product* 6 * 3 * 9 * 3 * 6 * 4 * 3 * 6, index + 63463936);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 4 + 3 + 6, product* 6 * 7 * 7 * 7 * 6 * 4 * 3 * 6, index + 63467776);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 4 + 3 + 6, product* 4 * 6 * 6 * 3 * 7 * 4 * 3 * 6, index + 63473664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 3 + 6, product* 2 * 3 * 4 * 4 * 7 * 4 * 3 * 6, index + 63474432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 4 + 3 + 6, product* 4 * 4 * 9 * 4 * 7 * 4 * 3 * 6, index + 63474944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 3 + 6, product* 4 * 2 * 2 * 6 * 7 * 4 * 3 * 6, index + 63476224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 3 + 6, product* 2 * 7 * 2 * 8 * 7 * 4 * 3 * 6, index + 63478272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4 + 3 + 6, product* 8 * 6 * 3 * 2 * 8 * 4 * 3 * 6, index + 63482368);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 3 + 6, product* 2 * 3 * 2 * 7 * 8 * 4 * 3 * 6, index + 63487232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 3 + 6, product* 2 * 3 * 6 * 3 * 9 * 4 * 3 * 6, index + 63493632);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 3 + 6, product* 4 * 2 * 4 * 3 * 2 * 6 * 3 * 6, index + 63623424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 6 + 3 + 6, product* 8 * 4 * 4 * 4 * 2 * 6 * 3 * 6, index + 63624448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 3 + 6, product* 4 * 6 * 2 * 7 * 2 * 6 * 3 * 6, index + 63627264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 6 + 3 + 6, product* 4 * 2 * 8 * 9 * 2 * 6 * 3 * 6, index + 63629824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 3 + 6, product* 4 * 8 * 3 * 2 * 3 * 6 * 3 * 6, index + 63632384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 6 + 3 + 6, product* 6 * 9 * 8 * 2 * 3 * 6 * 3 * 6, index + 63632896);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 3 + 6, product* 4 * 2 * 2 * 6 * 3 * 6 * 3 * 6, index + 63636224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 6 + 3 + 6, product* 8 * 4 * 2 * 7 * 3 * 6 * 3 * 6, index + 63637248);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 6 + 3 + 6, product* 8 * 6 * 3 * 2 * 4 * 6 * 3 * 6, index + 63642368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 3 + 6, product* 4 * 2 * 6 * 2 * 4 * 6 * 3 * 6, index + 63642624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 3 + 6, product* 2 * 3 * 2 * 7 * 4 * 6 * 3 * 6, index + 63647232);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 6 + 3 + 6, product* 8 * 4 * 8 * 2 * 6 * 6 * 3 * 6, index + 63662848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 6 + 3 + 6, product* 4 * 8 * 3 * 4 * 6 * 6 * 3 * 6, index + 63664384);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 6 + 3 + 6, product* 4 * 2 * 2 * 8 * 6 * 6 * 3 * 6, index + 63668224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 6 + 3 + 6, product* 8 * 4 * 2 * 9 * 6 * 6 * 3 * 6, index + 63669248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 3 + 6, product* 2 * 3 * 8 * 2 * 7 * 6 * 3 * 6, index + 63672832);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 6 + 3 + 6, product* 4 * 2 * 4 * 7 * 8 * 6 * 3 * 6, index + 63687424);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 9 + 6 + 3 + 6, product* 4 * 4 * 9 * 8 * 9 * 6 * 3 * 6, index + 63698944);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 3 + 6, product* 6 * 9 * 4 * 2 * 2 * 7 * 3 * 6, index + 63722496);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 3 + 6, product* 4 * 2 * 2 * 2 * 3 * 7 * 3 * 6, index + 63732224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 3 + 6, product* 6 * 3 * 7 * 2 * 3 * 7 * 3 * 6, index + 63732736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 3 + 6, product* 8 * 4 * 2 * 3 * 3 * 7 * 3 * 6, index + 63733248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 3 + 6, product* 2 * 7 * 2 * 4 * 3 * 7 * 3 * 6, index + 63734272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 7 + 3 + 6, product* 2 * 3 * 8 * 6 * 3 * 7 * 3 * 6, index + 63736832);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 3 + 6, product* 4 * 2 * 6 * 8 * 3 * 7 * 3 * 6, index + 63738624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 3 + 6, product* 4 * 6 * 4 * 2 * 4 * 7 * 3 * 6, index + 63742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 3 + 6, product* 2 * 3 * 2 * 3 * 4 * 7 * 3 * 6, index + 63743232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 3 + 6, product* 2 * 3 * 4 * 2 * 6 * 7 * 3 * 6, index + 63762432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7 + 3 + 6, product* 4 * 4 * 9 * 2 * 6 * 7 * 3 * 6, index + 63762944);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 6 + 7 + 3 + 6, product* 6 * 9 * 2 * 7 * 6 * 7 * 3 * 6, index + 63767296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 7 + 3 + 6, product* 4 * 2 * 4 * 3 * 8 * 7 * 3 * 6, index + 63783424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 7 + 3 + 6, product* 6 * 3 * 9 * 3 * 8 * 7 * 3 * 6, index + 63783936);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 9 + 7 + 3 + 6, product* 4 * 6 * 6 * 3 * 9 * 7 * 3 * 6, index + 63793664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 3 + 6, product* 2 * 3 * 4 * 4 * 9 * 7 * 3 * 6, index + 63794432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 7 + 3 + 6, product* 4 * 2 * 2 * 6 * 9 * 7 * 3 * 6, index + 63796224);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 3 + 6, product* 6 * 3 * 3 * 2 * 2 * 8 * 3 * 6, index + 63822336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 3 + 6, product* 2 * 7 * 8 * 3 * 2 * 8 * 3 * 6, index + 63823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 3 + 6, product* 4 * 8 * 3 * 4 * 2 * 8 * 3 * 6, index + 63824384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 3 + 6, product* 2 * 3 * 4 * 6 * 2 * 8 * 3 * 6, index + 63826432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 3 + 6, product* 4 * 2 * 2 * 8 * 2 * 8 * 3 * 6, index + 63828224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 3 + 6, product* 4 * 4 * 3 * 3 * 3 * 8 * 3 * 6, index + 63833344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 8 + 3 + 6, product* 2 * 7 * 6 * 6 * 3 * 8 * 3 * 6, index + 63836672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 8 + 3 + 6, product* 4 * 6 * 4 * 8 * 3 * 8 * 3 * 6, index + 63838464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 3 + 6, product* 2 * 3 * 2 * 9 * 3 * 8 * 3 * 6, index + 63839232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 8 + 3 + 6, product* 8 * 2 * 3 * 3 * 4 * 8 * 3 * 6, index + 63843328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 8 + 3 + 6, product* 4 * 2 * 4 * 7 * 4 * 8 * 3 * 6, index + 63847424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 3 + 6, product* 2 * 7 * 2 * 2 * 6 * 8 * 3 * 6, index + 63862272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 8 + 3 + 6, product* 4 * 8 * 7 * 2 * 6 * 8 * 3 * 6, index + 63862784);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 8 + 3 + 6, product* 2 * 9 * 3 * 7 * 6 * 8 * 3 * 6, index + 63867392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 8 + 3 + 6, product* 2 * 7 * 6 * 8 * 6 * 8 * 3 * 6, index + 63868672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 8 + 3 + 6, product* 8 * 2 * 9 * 8 * 6 * 8 * 3 * 6, index + 63868928);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 8 + 3 + 6, product* 2 * 3 * 6 * 7 * 7 * 8 * 3 * 6, index + 63877632);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 8 + 8 + 3 + 6, product* 6 * 7 * 7 * 3 * 8 * 8 * 3 * 6, index + 63883776);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 8 + 8 + 3 + 6, product* 8 * 4 * 8 * 6 * 8 * 8 * 3 * 6, index + 63886848);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 3 + 6, product* 4 * 2 * 2 * 2 * 9 * 8 * 3 * 6, index + 63892224);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 8 + 3 + 6, product* 4 * 2 * 6 * 8 * 9 * 8 * 3 * 6, index + 63898624);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 3 + 6, product* 2 * 3 * 4 * 2 * 2 * 9 * 3 * 6, index + 63922432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 3 + 6, product* 4 * 4 * 9 * 2 * 2 * 9 * 3 * 6, index + 63922944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 3 + 6, product* 4 * 2 * 2 * 4 * 2 * 9 * 3 * 6, index + 63924224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 3 + 6, product* 2 * 7 * 2 * 6 * 2 * 9 * 3 * 6, index + 63926272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 9 + 3 + 6, product* 4 * 2 * 4 * 3 * 4 * 9 * 3 * 6, index + 63943424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 9 + 3 + 6, product* 4 * 6 * 2 * 7 * 4 * 9 * 3 * 6, index + 63947264);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 9 + 3 + 6, product* 2 * 7 * 6 * 4 * 6 * 9 * 3 * 6, index + 63964672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 3 + 6, product* 2 * 3 * 2 * 7 * 6 * 9 * 3 * 6, index + 63967232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9 + 3 + 6, product* 2 * 3 * 6 * 3 * 7 * 9 * 3 * 6, index + 63973632);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9 + 3 + 6, product* 2 * 3 * 8 * 2 * 9 * 9 * 3 * 6, index + 63992832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 9 + 3 + 6, product* 4 * 4 * 3 * 3 * 9 * 9 * 3 * 6, index + 63993344);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 9 + 3 + 6, product* 2 * 3 * 2 * 9 * 9 * 9 * 3 * 6, index + 63999232);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 4 + 6, product* 4 * 6 * 4 * 2 * 2 * 2 * 4 * 6, index + 64222464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 4 + 6, product* 2 * 3 * 2 * 3 * 2 * 2 * 4 * 6, index + 64223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 4 + 6, product* 8 * 8 * 4 * 3 * 2 * 2 * 4 * 6, index + 64223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 4 + 6, product* 4 * 4 * 7 * 3 * 2 * 2 * 4 * 6, index + 64223744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 4 + 6, product* 8 * 6 * 7 * 4 * 2 * 2 * 4 * 6, index + 64224768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 4 + 6, product* 8 * 2 * 3 * 7 * 2 * 2 * 4 * 6, index + 64227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 4 + 6, product* 4 * 6 * 8 * 8 * 2 * 2 * 4 * 6, index + 64228864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 4 + 6, product* 6 * 7 * 3 * 9 * 2 * 2 * 4 * 6, index + 64229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 4 + 6, product* 2 * 3 * 6 * 9 * 2 * 2 * 4 * 6, index + 64229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 4 + 6, product* 8 * 4 * 4 * 2 * 3 * 2 * 4 * 6, index + 64232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 4 + 6, product* 2 * 7 * 4 * 3 * 3 * 2 * 4 * 6, index + 64233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 4 + 6, product* 8 * 2 * 7 * 3 * 3 * 2 * 4 * 6, index + 64233728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 4 + 6, product* 6 * 9 * 4 * 4 * 3 * 2 * 4 * 6, index + 64234496);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 4 + 6, product* 2 * 3 * 4 * 2 * 4 * 2 * 4 * 6, index + 64242432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 4 + 6, product* 4 * 4 * 9 * 2 * 4 * 2 * 4 * 6, index + 64242944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 2 + 4 + 6, product* 8 * 6 * 9 * 3 * 4 * 2 * 4 * 6, index + 64243968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 4 + 6, product* 4 * 2 * 2 * 4 * 4 * 2 * 4 * 6, index + 64244224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 4 + 6, product* 2 * 7 * 2 * 6 * 4 * 2 * 4 * 6, index + 64246272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 4 + 6, product* 6 * 9 * 2 * 7 * 4 * 2 * 4 * 6, index + 64247296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 4 + 6, product* 2 * 3 * 8 * 8 * 4 * 2 * 4 * 6, index + 64248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 4 + 6, product* 4 * 4 * 3 * 9 * 4 * 2 * 4 * 6, index + 64249344);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 4 + 6, product* 4 * 6 * 2 * 7 * 6 * 2 * 4 * 6, index + 64267264);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 4 + 6, product* 6 * 9 * 8 * 2 * 7 * 2 * 4 * 6, index + 64272896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 4 + 6, product* 2 * 3 * 4 * 4 * 7 * 2 * 4 * 6, index + 64274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 4 + 6, product* 4 * 4 * 9 * 4 * 7 * 2 * 4 * 6, index + 64274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 4 + 6, product* 4 * 2 * 2 * 6 * 7 * 2 * 4 * 6, index + 64276224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 4 + 6, product* 2 * 7 * 2 * 8 * 7 * 2 * 4 * 6, index + 64278272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 4 + 6, product* 4 * 2 * 6 * 2 * 8 * 2 * 4 * 6, index + 64282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 4 + 6, product* 2 * 9 * 3 * 3 * 8 * 2 * 4 * 6, index + 64283392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 4 + 6, product* 8 * 2 * 9 * 4 * 8 * 2 * 4 * 6, index + 64284928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 4 + 6, product* 2 * 3 * 2 * 7 * 8 * 2 * 4 * 6, index + 64287232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 2 + 4 + 6, product* 4 * 4 * 7 * 7 * 8 * 2 * 4 * 6, index + 64287744);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 4 + 6, product* 4 * 6 * 8 * 2 * 9 * 2 * 4 * 6, index + 64292864);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 4 + 6, product* 8 * 2 * 3 * 3 * 2 * 3 * 4 * 6, index + 64323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 4 + 6, product* 4 * 2 * 4 * 7 * 2 * 3 * 4 * 6, index + 64327424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 4 + 6, product* 8 * 4 * 4 * 8 * 2 * 3 * 4 * 6, index + 64328448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 4 + 6, product* 2 * 7 * 4 * 9 * 2 * 3 * 4 * 6, index + 64329472);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 4 + 6, product* 6 * 3 * 3 * 4 * 3 * 3 * 4 * 6, index + 64334336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 4 + 6, product* 4 * 8 * 3 * 6 * 3 * 3 * 4 * 6, index + 64336384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 4 + 6, product* 2 * 3 * 4 * 8 * 3 * 3 * 4 * 6, index + 64338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 4 + 6, product* 2 * 7 * 2 * 2 * 4 * 3 * 4 * 6, index + 64342272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 4 + 6, product* 6 * 9 * 2 * 3 * 4 * 3 * 4 * 6, index + 64343296);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 4 + 6, product* 8 * 6 * 3 * 6 * 4 * 3 * 4 * 6, index + 64346368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 3 + 4 + 6, product* 4 * 2 * 6 * 6 * 4 * 3 * 4 * 6, index + 64346624);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 4 + 6, product* 6 * 9 * 4 * 2 * 6 * 3 * 4 * 6, index + 64362496);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 6 + 3 + 4 + 6, product* 6 * 9 * 8 * 8 * 6 * 3 * 4 * 6, index + 64368896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 4 + 6, product* 4 * 2 * 2 * 2 * 7 * 3 * 4 * 6, index + 64372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 4 + 6, product* 6 * 3 * 7 * 2 * 7 * 3 * 4 * 6, index + 64372736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 4 + 6, product* 2 * 9 * 9 * 2 * 7 * 3 * 4 * 6, index + 64372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 4 + 6, product* 8 * 4 * 2 * 3 * 7 * 3 * 4 * 6, index + 64373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 4 + 6, product* 2 * 7 * 2 * 4 * 7 * 3 * 4 * 6, index + 64374272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3 + 4 + 6, product* 2 * 3 * 8 * 6 * 7 * 3 * 4 * 6, index + 64376832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 4 + 6, product* 2 * 9 * 3 * 9 * 7 * 3 * 4 * 6, index + 64379392);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 4 + 6, product* 2 * 3 * 2 * 3 * 8 * 3 * 4 * 6, index + 64383232);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 8 + 3 + 4 + 6, product* 8 * 6 * 7 * 4 * 8 * 3 * 4 * 6, index + 64384768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 4 + 6, product* 8 * 2 * 3 * 7 * 8 * 3 * 4 * 6, index + 64387328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 4 + 6, product* 8 * 4 * 4 * 2 * 9 * 3 * 4 * 6, index + 64392448);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 4 + 6, product* 8 * 2 * 7 * 3 * 9 * 3 * 4 * 6, index + 64393728);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3 + 4 + 6, product* 6 * 3 * 3 * 8 * 9 * 3 * 4 * 6, index + 64398336);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 4 + 6, product* 4 * 2 * 4 * 3 * 2 * 4 * 4 * 6, index + 64423424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 4 + 6, product* 8 * 4 * 4 * 4 * 2 * 4 * 4 * 6, index + 64424448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 4 + 4 + 6, product* 6 * 9 * 4 * 6 * 2 * 4 * 4 * 6, index + 64426496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 4 + 6, product* 4 * 6 * 2 * 7 * 2 * 4 * 4 * 6, index + 64427264);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 4 + 4 + 6, product* 6 * 7 * 7 * 7 * 2 * 4 * 4 * 6, index + 64427776);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 4 + 6, product* 4 * 8 * 3 * 2 * 3 * 4 * 4 * 6, index + 64432384);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 4 + 6, product* 4 * 2 * 2 * 6 * 3 * 4 * 4 * 6, index + 64436224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 4 + 6, product* 8 * 4 * 2 * 7 * 3 * 4 * 4 * 6, index + 64437248);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 4 + 6, product* 8 * 6 * 3 * 2 * 4 * 4 * 4 * 6, index + 64442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 4 + 6, product* 4 * 2 * 6 * 2 * 4 * 4 * 4 * 6, index + 64442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 4 + 6, product* 2 * 9 * 3 * 3 * 4 * 4 * 4 * 6, index + 64443392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 4 + 6, product* 8 * 2 * 9 * 4 * 4 * 4 * 4 * 6, index + 64444928);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 4 + 6, product* 6 * 3 * 3 * 2 * 6 * 4 * 4 * 6, index + 64462336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 4 + 6, product* 2 * 3 * 4 * 6 * 6 * 4 * 4 * 6, index + 64466432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 4 + 4 + 6, product* 8 * 8 * 6 * 6 * 6 * 4 * 4 * 6, index + 64466688);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 4 + 4 + 6, product* 2 * 9 * 9 * 8 * 6 * 4 * 4 * 6, index + 64468992);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 4 + 6, product* 2 * 3 * 8 * 2 * 7 * 4 * 4 * 6, index + 64472832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 4 + 6, product* 2 * 3 * 2 * 9 * 7 * 4 * 4 * 6, index + 64479232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 4 + 6, product* 8 * 2 * 3 * 3 * 8 * 4 * 4 * 6, index + 64483328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 4 + 6, product* 4 * 2 * 4 * 7 * 8 * 4 * 4 * 6, index + 64487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 4 + 6, product* 2 * 7 * 4 * 9 * 8 * 4 * 4 * 6, index + 64489472);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 4 + 6, product* 4 * 2 * 8 * 3 * 9 * 4 * 4 * 6, index + 64493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 4 + 6, product* 6 * 3 * 3 * 2 * 2 * 6 * 4 * 6, index + 64622336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 4 + 6, product* 8 * 4 * 8 * 2 * 2 * 6 * 4 * 6, index + 64622848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 4 + 6, product* 2 * 7 * 8 * 3 * 2 * 6 * 4 * 6, index + 64623872);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 6 + 4 + 6, product* 6 * 9 * 8 * 4 * 2 * 6 * 4 * 6, index + 64624896);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 6 + 4 + 6, product* 4 * 4 * 9 * 6 * 2 * 6 * 4 * 6, index + 64626944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 4 + 6, product* 4 * 2 * 2 * 8 * 2 * 6 * 4 * 6, index + 64628224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 4 + 6, product* 2 * 3 * 8 * 2 * 3 * 6 * 4 * 6, index + 64632832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 4 + 6, product* 4 * 2 * 6 * 4 * 3 * 6 * 4 * 6, index + 64634624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 4 + 6, product* 2 * 7 * 6 * 6 * 3 * 6 * 4 * 6, index + 64636672);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 4 + 6, product* 8 * 2 * 3 * 3 * 4 * 6 * 4 * 6, index + 64643328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 4 + 6, product* 4 * 2 * 4 * 7 * 4 * 6 * 4 * 6, index + 64647424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 6 + 4 + 6, product* 8 * 4 * 4 * 8 * 4 * 6 * 4 * 6, index + 64648448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 4 + 6, product* 2 * 7 * 4 * 9 * 4 * 6 * 4 * 6, index + 64649472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 4 + 6, product* 2 * 7 * 2 * 2 * 6 * 6 * 4 * 6, index + 64662272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 4 + 6, product* 2 * 3 * 8 * 4 * 6 * 6 * 4 * 6, index + 64664832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 4 + 6, product* 4 * 2 * 6 * 6 * 6 * 6 * 4 * 6, index + 64666624);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 4 + 6, product* 4 * 2 * 4 * 9 * 7 * 6 * 4 * 6, index + 64679424);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 4 + 6, product* 8 * 4 * 2 * 3 * 9 * 6 * 4 * 6, index + 64693248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 4 + 6, product* 2 * 7 * 2 * 4 * 9 * 6 * 4 * 6, index + 64694272);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 6 + 4 + 6, product* 2 * 9 * 3 * 9 * 9 * 6 * 4 * 6, index + 64699392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 4 + 6, product* 2 * 3 * 4 * 2 * 2 * 7 * 4 * 6, index + 64722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 4 + 6, product* 4 * 4 * 9 * 2 * 2 * 7 * 4 * 6, index + 64722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 4 + 6, product* 4 * 2 * 2 * 4 * 2 * 7 * 4 * 6, index + 64724224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 4 + 6, product* 2 * 9 * 9 * 4 * 2 * 7 * 4 * 6, index + 64724992);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 4 + 6, product* 2 * 3 * 8 * 8 * 2 * 7 * 4 * 6, index + 64728832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 4 + 6, product* 2 * 7 * 6 * 2 * 3 * 7 * 4 * 6, index + 64732672);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 7 + 4 + 6, product* 2 * 9 * 7 * 7 * 3 * 7 * 4 * 6, index + 64737792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 4 + 6, product* 8 * 2 * 3 * 9 * 3 * 7 * 4 * 6, index + 64739328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 4 + 6, product* 4 * 2 * 4 * 3 * 4 * 7 * 4 * 6, index + 64743424);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 4 + 6, product* 2 * 3 * 2 * 7 * 6 * 7 * 4 * 6, index + 64767232);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 7 + 4 + 6, product* 8 * 4 * 4 * 6 * 7 * 7 * 4 * 6, index + 64776448);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 7 + 4 + 6, product* 4 * 6 * 2 * 9 * 7 * 7 * 4 * 6, index + 64779264);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 4 + 6, product* 2 * 7 * 2 * 2 * 2 * 8 * 4 * 6, index + 64822272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 8 + 4 + 6, product* 4 * 8 * 7 * 2 * 2 * 8 * 4 * 6, index + 64822784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 4 + 6, product* 6 * 9 * 2 * 3 * 2 * 8 * 4 * 6, index + 64823296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 4 + 6, product* 2 * 3 * 8 * 4 * 2 * 8 * 4 * 6, index + 64824832);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 4 + 6, product* 2 * 9 * 7 * 3 * 3 * 8 * 4 * 6, index + 64833792);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 4 + 6, product* 4 * 6 * 2 * 3 * 4 * 8 * 4 * 6, index + 64843264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 4 + 6, product* 6 * 3 * 3 * 6 * 4 * 8 * 4 * 6, index + 64846336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 8 + 4 + 6, product* 4 * 6 * 4 * 2 * 6 * 8 * 4 * 6, index + 64862464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 4 + 6, product* 2 * 3 * 2 * 3 * 6 * 8 * 4 * 6, index + 64863232);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 4 + 6, product* 4 * 2 * 2 * 4 * 8 * 8 * 4 * 6, index + 64884224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 8 + 8 + 4 + 6, product* 2 * 9 * 9 * 4 * 8 * 8 * 4 * 6, index + 64884992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 8 + 4 + 6, product* 2 * 7 * 2 * 6 * 8 * 8 * 4 * 6, index + 64886272);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 8 + 4 + 6, product* 2 * 9 * 7 * 7 * 9 * 8 * 4 * 6, index + 64897792);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 4 + 6, product* 8 * 6 * 3 * 2 * 2 * 9 * 4 * 6, index + 64922368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 4 + 6, product* 4 * 2 * 6 * 2 * 2 * 9 * 4 * 6, index + 64922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 4 + 6, product* 2 * 9 * 3 * 3 * 2 * 9 * 4 * 6, index + 64923392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 4 + 6, product* 2 * 3 * 2 * 7 * 2 * 9 * 4 * 6, index + 64927232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 9 + 4 + 6, product* 4 * 4 * 7 * 7 * 2 * 9 * 4 * 6, index + 64927744);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 4 + 6, product* 2 * 3 * 6 * 3 * 3 * 9 * 4 * 6, index + 64933632);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 4 + 6, product* 4 * 2 * 2 * 8 * 4 * 9 * 4 * 6, index + 64948224);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 9 + 4 + 6, product* 4 * 2 * 8 * 3 * 7 * 9 * 4 * 6, index + 64973824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 9 + 4 + 6, product* 4 * 8 * 3 * 6 * 7 * 9 * 4 * 6, index + 64976384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 4 + 6, product* 2 * 3 * 4 * 8 * 7 * 9 * 4 * 6, index + 64978432);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9 + 9 + 4 + 6, product* 6 * 7 * 3 * 7 * 9 * 9 * 4 * 6, index + 64997376);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 6 + 6, product* 6 * 3 * 3 * 2 * 2 * 2 * 6 * 6, index + 66222336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 6 + 6, product* 4 * 8 * 3 * 4 * 2 * 2 * 6 * 6, index + 66224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 6 + 6, product* 2 * 3 * 4 * 6 * 2 * 2 * 6 * 6, index + 66226432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 6 + 6, product* 4 * 2 * 2 * 8 * 2 * 2 * 6 * 6, index + 66228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 6 + 6, product* 6 * 3 * 7 * 8 * 2 * 2 * 6 * 6, index + 66228736);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 6 + 6, product* 2 * 3 * 8 * 2 * 3 * 2 * 6 * 6, index + 66232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 6 + 6, product* 4 * 4 * 3 * 3 * 3 * 2 * 6 * 6, index + 66233344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 2 + 6 + 6, product* 8 * 6 * 3 * 4 * 3 * 2 * 6 * 6, index + 66234368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 6 + 6, product* 4 * 2 * 6 * 4 * 3 * 2 * 6 * 6, index + 66234624);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 6 + 6, product* 8 * 2 * 9 * 6 * 3 * 2 * 6 * 6, index + 66236928);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 3 + 2 + 6 + 6, product* 6 * 9 * 6 * 7 * 3 * 2 * 6 * 6, index + 66237696);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 6 + 6, product* 2 * 3 * 2 * 9 * 3 * 2 * 6 * 6, index + 66239232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 6 + 6, product* 8 * 2 * 3 * 3 * 4 * 2 * 6 * 6, index + 66243328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 6 + 6, product* 4 * 2 * 4 * 7 * 4 * 2 * 6 * 6, index + 66247424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 6 + 6, product* 6 * 3 * 9 * 7 * 4 * 2 * 6 * 6, index + 66247936);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 2 + 6 + 6, product* 8 * 2 * 7 * 9 * 4 * 2 * 6 * 6, index + 66249728);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 6 + 6, product* 6 * 9 * 2 * 3 * 6 * 2 * 6 * 6, index + 66263296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 6 + 6, product* 2 * 3 * 8 * 4 * 6 * 2 * 6 * 6, index + 66264832);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 6 + 6, product* 8 * 4 * 6 * 7 * 6 * 2 * 6 * 6, index + 66267648);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 6 + 6, product* 4 * 2 * 2 * 2 * 9 * 2 * 6 * 6, index + 66292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 6 + 6, product* 6 * 3 * 7 * 2 * 9 * 2 * 6 * 6, index + 66292736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 6 + 6, product* 8 * 4 * 2 * 3 * 9 * 2 * 6 * 6, index + 66293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 6 + 6, product* 2 * 7 * 2 * 4 * 9 * 2 * 6 * 6, index + 66294272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 6 + 6, product* 4 * 4 * 3 * 7 * 9 * 2 * 6 * 6, index + 66297344);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 6 + 6, product* 2 * 3 * 4 * 2 * 2 * 3 * 6 * 6, index + 66322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 6 + 6, product* 4 * 4 * 9 * 2 * 2 * 3 * 6 * 6, index + 66322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 6 + 6, product* 4 * 2 * 2 * 4 * 2 * 3 * 6 * 6, index + 66324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 6 + 6, product* 6 * 3 * 7 * 4 * 2 * 3 * 6 * 6, index + 66324736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 6 + 6, product* 2 * 7 * 2 * 6 * 2 * 3 * 6 * 6, index + 66326272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 6 + 6, product* 2 * 3 * 8 * 8 * 2 * 3 * 6 * 6, index + 66328832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 6 + 6, product* 2 * 7 * 6 * 2 * 3 * 3 * 6 * 6, index + 66332672);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 6 + 6, product* 4 * 6 * 4 * 4 * 3 * 3 * 6 * 6, index + 66334464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 6 + 6, product* 2 * 9 * 7 * 7 * 3 * 3 * 6 * 6, index + 66337792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 6 + 6, product* 8 * 2 * 3 * 9 * 3 * 3 * 6 * 6, index + 66339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 6 + 6, product* 4 * 2 * 4 * 3 * 4 * 3 * 6 * 6, index + 66343424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 6 + 6, product* 8 * 4 * 4 * 4 * 4 * 3 * 6 * 6, index + 66344448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 6 + 6, product* 4 * 6 * 2 * 7 * 4 * 3 * 6 * 6, index + 66347264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 6 + 6, product* 2 * 9 * 3 * 3 * 6 * 3 * 6 * 6, index + 66363392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 6 + 6, product* 2 * 3 * 2 * 7 * 6 * 3 * 6 * 6, index + 66367232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 7 + 3 + 6 + 6, product* 4 * 6 * 8 * 2 * 7 * 3 * 6 * 6, index + 66372864);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 6 + 6, product* 4 * 6 * 2 * 9 * 7 * 3 * 6 * 6, index + 66379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 6 + 6, product* 6 * 3 * 3 * 2 * 8 * 3 * 6 * 6, index + 66382336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 6 + 6, product* 2 * 7 * 8 * 3 * 8 * 3 * 6 * 6, index + 66383872);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 8 + 3 + 6 + 6, product* 2 * 9 * 9 * 8 * 8 * 3 * 6 * 6, index + 66388992);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 6 + 6, product* 2 * 7 * 6 * 6 * 9 * 3 * 6 * 6, index + 66396672);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 6 + 6, product* 2 * 7 * 2 * 2 * 2 * 4 * 6 * 6, index + 66422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 6 + 6, product* 4 * 8 * 7 * 2 * 2 * 4 * 6 * 6, index + 66422784);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 6 + 6, product* 4 * 2 * 6 * 6 * 2 * 4 * 6 * 6, index + 66426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 6 + 6, product* 2 * 9 * 3 * 7 * 2 * 4 * 6 * 6, index + 66427392);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 6 + 6, product* 2 * 3 * 6 * 7 * 3 * 4 * 6 * 6, index + 66437632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 6 + 6, product* 4 * 2 * 4 * 9 * 3 * 4 * 6 * 6, index + 66439424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 6 + 6, product* 4 * 6 * 2 * 3 * 4 * 4 * 6 * 6, index + 66443264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 4 + 6 + 6, product* 8 * 8 * 2 * 4 * 4 * 4 * 6 * 6, index + 66444288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 4 + 6 + 6, product* 4 * 8 * 3 * 8 * 4 * 4 * 6 * 6, index + 66448384);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 6 + 6, product* 2 * 3 * 2 * 3 * 6 * 4 * 6 * 6, index + 66463232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 6 + 6, product* 2 * 3 * 6 * 9 * 6 * 4 * 6 * 6, index + 66469632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 6 + 6, product* 8 * 4 * 4 * 2 * 7 * 4 * 6 * 6, index + 66472448);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 6 + 6, product* 2 * 7 * 2 * 6 * 8 * 4 * 6 * 6, index + 66486272);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 6 + 6, product* 2 * 7 * 6 * 2 * 9 * 4 * 6 * 6, index + 66492672);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 6 + 6, product* 4 * 6 * 4 * 2 * 2 * 6 * 6 * 6, index + 66622464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 6 + 6, product* 6 * 7 * 9 * 2 * 2 * 6 * 6 * 6, index + 66622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 6 + 6, product* 2 * 3 * 2 * 3 * 2 * 6 * 6 * 6, index + 66623232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 6 + 6, product* 8 * 2 * 3 * 7 * 2 * 6 * 6 * 6, index + 66627328);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 6 + 6 + 6, product* 4 * 8 * 9 * 3 * 3 * 6 * 6 * 6, index + 66633984);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 6 + 6, product* 6 * 3 * 3 * 8 * 3 * 6 * 6 * 6, index + 66638336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 6 + 6, product* 2 * 3 * 4 * 2 * 4 * 6 * 6 * 6, index + 66642432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 6 + 6, product* 4 * 2 * 2 * 4 * 4 * 6 * 6 * 6, index + 66644224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 6 + 6, product* 2 * 7 * 2 * 6 * 4 * 6 * 6 * 6, index + 66646272);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 6 + 6, product* 8 * 4 * 4 * 4 * 6 * 6 * 6 * 6, index + 66664448);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 6 + 6, product* 2 * 3 * 4 * 4 * 7 * 6 * 6 * 6, index + 66674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 6 + 6, product* 4 * 2 * 2 * 6 * 7 * 6 * 6 * 6, index + 66676224);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 6 + 6, product* 8 * 2 * 3 * 3 * 2 * 7 * 6 * 6, index + 66723328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 6 + 6, product* 4 * 6 * 8 * 4 * 2 * 7 * 6 * 6, index + 66724864);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 6 + 6, product* 4 * 2 * 8 * 3 * 3 * 7 * 6 * 6, index + 66733824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 7 + 6 + 6, product* 4 * 8 * 3 * 6 * 3 * 7 * 6 * 6, index + 66736384);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 6 + 6, product* 2 * 7 * 2 * 2 * 4 * 7 * 6 * 6, index + 66742272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 6 + 6, product* 2 * 3 * 8 * 4 * 4 * 7 * 6 * 6, index + 66744832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 7 + 6 + 6, product* 8 * 6 * 3 * 6 * 4 * 7 * 6 * 6, index + 66746368);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 7 + 6 + 6, product* 8 * 8 * 2 * 4 * 6 * 7 * 6 * 6, index + 66764288);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7 + 6 + 6, product* 4 * 6 * 4 * 2 * 8 * 7 * 6 * 6, index + 66782464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 6 + 6, product* 2 * 3 * 2 * 3 * 8 * 7 * 6 * 6, index + 66783232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 6 + 6, product* 8 * 2 * 3 * 7 * 8 * 7 * 6 * 6, index + 66787328);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 7 + 6 + 6, product* 4 * 2 * 8 * 7 * 9 * 7 * 6 * 6, index + 66797824);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 6 + 6, product* 4 * 2 * 4 * 3 * 2 * 8 * 6 * 6, index + 66823424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 6 + 6, product* 4 * 6 * 2 * 7 * 2 * 8 * 6 * 6, index + 66827264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 6 + 6, product* 4 * 8 * 3 * 2 * 3 * 8 * 6 * 6, index + 66832384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 8 + 6 + 6, product* 6 * 9 * 8 * 2 * 3 * 8 * 6 * 6, index + 66832896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 6 + 6, product* 2 * 3 * 4 * 4 * 3 * 8 * 6 * 6, index + 66834432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 8 + 6 + 6, product* 4 * 4 * 9 * 4 * 3 * 8 * 6 * 6, index + 66834944);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 8 + 6 + 6, product* 8 * 4 * 2 * 7 * 3 * 8 * 6 * 6, index + 66837248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 6 + 6, product* 2 * 7 * 2 * 8 * 3 * 8 * 6 * 6, index + 66838272);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 6 + 6, product* 2 * 7 * 6 * 4 * 4 * 8 * 6 * 6, index + 66844672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 6 + 6, product* 2 * 3 * 2 * 7 * 4 * 8 * 6 * 6, index + 66847232);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 8 + 6 + 6, product* 8 * 8 * 6 * 6 * 6 * 8 * 6 * 6, index + 66866688);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 6 + 6, product* 2 * 3 * 8 * 2 * 7 * 8 * 6 * 6, index + 66872832);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 8 + 6 + 6, product* 2 * 3 * 4 * 8 * 9 * 8 * 6 * 6, index + 66898432);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 6 + 6, product* 4 * 2 * 2 * 2 * 3 * 9 * 6 * 6, index + 66932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 6 + 6, product* 6 * 3 * 7 * 2 * 3 * 9 * 6 * 6, index + 66932736);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 9 + 6 + 6, product* 8 * 6 * 3 * 8 * 3 * 9 * 6 * 6, index + 66938368);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 6 + 6, product* 2 * 3 * 6 * 9 * 4 * 9 * 6 * 6, index + 66949632);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 6 + 6, product* 4 * 2 * 4 * 3 * 8 * 9 * 6 * 6, index + 66983424);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 9 + 6 + 6, product* 2 * 3 * 4 * 4 * 9 * 9 * 6 * 6, index + 66994432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 7 + 6, product* 2 * 7 * 2 * 2 * 2 * 2 * 7 * 6, index + 67222272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 7 + 6, product* 6 * 9 * 2 * 3 * 2 * 2 * 7 * 6, index + 67223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 7 + 6, product* 2 * 3 * 8 * 4 * 2 * 2 * 7 * 6, index + 67224832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 7 + 6, product* 4 * 2 * 6 * 6 * 2 * 2 * 7 * 6, index + 67226624);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 2 + 7 + 6, product* 8 * 4 * 6 * 7 * 2 * 2 * 7 * 6, index + 67227648);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 7 + 6, product* 8 * 6 * 7 * 2 * 3 * 2 * 7 * 6, index + 67232768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 2 + 7 + 6, product* 2 * 9 * 7 * 3 * 3 * 2 * 7 * 6, index + 67233792);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 7 + 6, product* 6 * 9 * 4 * 2 * 4 * 2 * 7 * 6, index + 67242496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 7 + 6, product* 4 * 6 * 2 * 3 * 4 * 2 * 7 * 6, index + 67243264);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 4 + 2 + 7 + 6, product* 2 * 7 * 8 * 7 * 4 * 2 * 7 * 6, index + 67247872);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 7 + 6, product* 4 * 6 * 4 * 2 * 6 * 2 * 7 * 6, index + 67262464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 7 + 6, product* 2 * 3 * 2 * 3 * 6 * 2 * 7 * 6, index + 67263232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 2 + 7 + 6, product* 4 * 4 * 7 * 3 * 6 * 2 * 7 * 6, index + 67263744);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2 + 7 + 6, product* 6 * 3 * 3 * 8 * 7 * 2 * 7 * 6, index + 67278336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 7 + 6, product* 2 * 3 * 4 * 2 * 8 * 2 * 7 * 6, index + 67282432);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 7 + 6, product* 8 * 6 * 3 * 2 * 2 * 3 * 7 * 6, index + 67322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 7 + 6, product* 4 * 2 * 6 * 2 * 2 * 3 * 7 * 6, index + 67322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 7 + 6, product* 2 * 9 * 3 * 3 * 2 * 3 * 7 * 6, index + 67323392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 7 + 6, product* 8 * 2 * 9 * 4 * 2 * 3 * 7 * 6, index + 67324928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 7 + 6, product* 2 * 3 * 2 * 7 * 2 * 3 * 7 * 6, index + 67327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 7 + 6, product* 8 * 8 * 4 * 7 * 2 * 3 * 7 * 6, index + 67327488);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 7 + 6, product* 6 * 7 * 3 * 3 * 3 * 3 * 7 * 6, index + 67333376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 7 + 6, product* 2 * 3 * 6 * 3 * 3 * 3 * 7 * 6, index + 67333632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 3 + 3 + 7 + 6, product* 8 * 8 * 8 * 3 * 3 * 3 * 7 * 6, index + 67333888);
-body<0>(stream, sum+ 6 + 7 + 7 + 9 + 3 + 3 + 7 + 6, product* 6 * 7 * 7 * 9 * 3 * 3 * 7 * 6, index + 67339776);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 7 + 6, product* 6 * 3 * 3 * 2 * 4 * 3 * 7 * 6, index + 67342336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 7 + 6, product* 8 * 4 * 8 * 2 * 4 * 3 * 7 * 6, index + 67342848);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 7 + 6, product* 4 * 2 * 2 * 8 * 4 * 3 * 7 * 6, index + 67348224);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 7 + 6, product* 8 * 2 * 3 * 3 * 6 * 3 * 7 * 6, index + 67363328);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 7 + 6, product* 6 * 3 * 3 * 4 * 7 * 3 * 7 * 6, index + 67374336);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 7 + 6, product* 2 * 7 * 2 * 2 * 8 * 3 * 7 * 6, index + 67382272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3 + 7 + 6, product* 4 * 8 * 7 * 2 * 8 * 3 * 7 * 6, index + 67382784);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 8 + 3 + 7 + 6, product* 8 * 4 * 6 * 7 * 8 * 3 * 7 * 6, index + 67387648);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 7 + 6, product* 4 * 6 * 4 * 2 * 2 * 4 * 7 * 6, index + 67422464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 7 + 6, product* 2 * 3 * 2 * 3 * 2 * 4 * 7 * 6, index + 67423232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 7 + 6, product* 4 * 4 * 7 * 3 * 2 * 4 * 7 * 6, index + 67423744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 7 + 6, product* 8 * 2 * 3 * 7 * 2 * 4 * 7 * 6, index + 67427328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 4 + 7 + 6, product* 4 * 6 * 8 * 8 * 2 * 4 * 7 * 6, index + 67428864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 7 + 6, product* 2 * 3 * 6 * 9 * 2 * 4 * 7 * 6, index + 67429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 7 + 6, product* 8 * 4 * 4 * 2 * 3 * 4 * 7 * 6, index + 67432448);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 7 + 6, product* 2 * 3 * 4 * 2 * 4 * 4 * 7 * 6, index + 67442432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 4 + 7 + 6, product* 4 * 4 * 9 * 2 * 4 * 4 * 7 * 6, index + 67442944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 7 + 6, product* 4 * 2 * 2 * 4 * 4 * 4 * 7 * 6, index + 67444224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 7 + 6, product* 2 * 7 * 2 * 6 * 4 * 4 * 7 * 6, index + 67446272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 7 + 6, product* 4 * 2 * 4 * 3 * 6 * 4 * 7 * 6, index + 67463424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 4 + 7 + 6, product* 4 * 6 * 2 * 7 * 6 * 4 * 7 * 6, index + 67467264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 7 + 6, product* 4 * 8 * 3 * 2 * 7 * 4 * 7 * 6, index + 67472384);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 4 + 7 + 6, product* 2 * 7 * 2 * 8 * 7 * 4 * 7 * 6, index + 67478272);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 4 + 7 + 6, product* 2 * 9 * 3 * 3 * 8 * 4 * 7 * 6, index + 67483392);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 7 + 6, product* 4 * 2 * 4 * 3 * 2 * 6 * 7 * 6, index + 67623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 7 + 6, product* 6 * 3 * 9 * 3 * 2 * 6 * 7 * 6, index + 67623936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 7 + 6, product* 4 * 6 * 2 * 7 * 2 * 6 * 7 * 6, index + 67627264);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 7 + 6, product* 4 * 2 * 2 * 6 * 3 * 6 * 7 * 6, index + 67636224);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 6 + 7 + 6, product* 8 * 4 * 6 * 3 * 4 * 6 * 7 * 6, index + 67643648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 6 + 7 + 6, product* 2 * 7 * 6 * 4 * 4 * 6 * 7 * 6, index + 67644672);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 6 + 7 + 6, product* 2 * 3 * 4 * 6 * 6 * 6 * 7 * 6, index + 67666432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 7 + 6, product* 4 * 2 * 6 * 4 * 7 * 6 * 7 * 6, index + 67674624);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 6 + 7 + 6, product* 2 * 7 * 4 * 9 * 8 * 6 * 7 * 6, index + 67689472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 8 + 6 + 7 + 6, product* 8 * 2 * 7 * 9 * 8 * 6 * 7 * 6, index + 67689728);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 7 + 6, product* 4 * 6 * 2 * 3 * 2 * 7 * 7 * 6, index + 67723264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 7 + 6, product* 8 * 8 * 2 * 4 * 2 * 7 * 7 * 6, index + 67724288);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 7 + 6, product* 4 * 2 * 2 * 2 * 3 * 7 * 7 * 6, index + 67732224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 7 + 6, product* 6 * 3 * 7 * 2 * 3 * 7 * 7 * 6, index + 67732736);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 7 + 7 + 6, product* 2 * 7 * 2 * 4 * 3 * 7 * 7 * 6, index + 67734272);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 7 + 6, product* 4 * 2 * 6 * 8 * 3 * 7 * 7 * 6, index + 67738624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 7 + 6, product* 2 * 3 * 2 * 3 * 4 * 7 * 7 * 6, index + 67743232);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 4 + 7 + 7 + 6, product* 4 * 6 * 8 * 8 * 4 * 7 * 7 * 6, index + 67748864);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 7 + 6, product* 4 * 2 * 2 * 4 * 6 * 7 * 7 * 6, index + 67764224);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 7 + 7 + 6, product* 2 * 7 * 6 * 2 * 7 * 7 * 7 * 6, index + 67772672);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 7 + 7 + 6, product* 8 * 2 * 3 * 9 * 7 * 7 * 7 * 6, index + 67779328);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 7 + 6, product* 6 * 3 * 3 * 2 * 2 * 8 * 7 * 6, index + 67822336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 7 + 6, product* 2 * 7 * 8 * 3 * 2 * 8 * 7 * 6, index + 67823872);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8 + 7 + 6, product* 6 * 9 * 8 * 4 * 2 * 8 * 7 * 6, index + 67824896);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 7 + 6, product* 4 * 2 * 2 * 8 * 2 * 8 * 7 * 6, index + 67828224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 7 + 6, product* 2 * 3 * 8 * 2 * 3 * 8 * 7 * 6, index + 67832832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 8 + 7 + 6, product* 4 * 4 * 3 * 3 * 3 * 8 * 7 * 6, index + 67833344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 8 + 7 + 6, product* 2 * 7 * 6 * 6 * 3 * 8 * 7 * 6, index + 67836672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 8 + 7 + 6, product* 4 * 6 * 4 * 8 * 3 * 8 * 7 * 6, index + 67838464);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 7 + 6, product* 2 * 7 * 2 * 2 * 6 * 8 * 7 * 6, index + 67862272);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 7 + 6, product* 4 * 2 * 2 * 2 * 9 * 8 * 7 * 6, index + 67892224);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 7 + 6, product* 2 * 3 * 4 * 2 * 2 * 9 * 7 * 6, index + 67922432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 9 + 7 + 6, product* 4 * 4 * 9 * 2 * 2 * 9 * 7 * 6, index + 67922944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 7 + 6, product* 4 * 2 * 2 * 4 * 2 * 9 * 7 * 6, index + 67924224);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 7 + 6, product* 2 * 7 * 6 * 2 * 3 * 9 * 7 * 6, index + 67932672);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 7 + 6, product* 4 * 2 * 6 * 2 * 6 * 9 * 7 * 6, index + 67962624);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 9 + 9 + 7 + 6, product* 6 * 7 * 9 * 8 * 9 * 9 * 7 * 6, index + 67998976);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 8 + 6, product* 4 * 6 * 4 * 2 * 2 * 2 * 8 * 6, index + 68222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 8 + 6, product* 6 * 7 * 9 * 2 * 2 * 2 * 8 * 6, index + 68222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 8 + 6, product* 2 * 3 * 2 * 3 * 2 * 2 * 8 * 6, index + 68223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 8 + 6, product* 8 * 8 * 4 * 3 * 2 * 2 * 8 * 6, index + 68223488);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 8 + 6, product* 6 * 7 * 3 * 9 * 2 * 2 * 8 * 6, index + 68229376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 8 + 6, product* 2 * 3 * 6 * 9 * 2 * 2 * 8 * 6, index + 68229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 8 + 6, product* 8 * 4 * 4 * 2 * 3 * 2 * 8 * 6, index + 68232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 8 + 6, product* 2 * 7 * 4 * 3 * 3 * 2 * 8 * 6, index + 68233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 8 + 6, product* 8 * 2 * 7 * 3 * 3 * 2 * 8 * 6, index + 68233728);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 8 + 6, product* 2 * 3 * 4 * 2 * 4 * 2 * 8 * 6, index + 68242432);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 2 + 8 + 6, product* 8 * 6 * 9 * 3 * 4 * 2 * 8 * 6, index + 68243968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 8 + 6, product* 4 * 2 * 2 * 4 * 4 * 2 * 8 * 6, index + 68244224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 8 + 6, product* 2 * 9 * 9 * 4 * 4 * 2 * 8 * 6, index + 68244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 8 + 6, product* 2 * 7 * 2 * 6 * 4 * 2 * 8 * 6, index + 68246272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 8 + 6, product* 2 * 3 * 8 * 8 * 4 * 2 * 8 * 6, index + 68248832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 8 + 6, product* 4 * 2 * 4 * 3 * 6 * 2 * 8 * 6, index + 68263424);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 8 + 6, product* 4 * 2 * 2 * 6 * 7 * 2 * 8 * 6, index + 68276224);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 8 + 6, product* 8 * 6 * 3 * 2 * 8 * 2 * 8 * 6, index + 68282368);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 8 + 6, product* 4 * 6 * 4 * 6 * 8 * 2 * 8 * 6, index + 68286464);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 8 + 6, product* 2 * 3 * 6 * 3 * 9 * 2 * 8 * 6, index + 68293632);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 8 + 6, product* 8 * 2 * 3 * 3 * 2 * 3 * 8 * 6, index + 68323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 8 + 6, product* 4 * 2 * 4 * 7 * 2 * 3 * 8 * 6, index + 68327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 8 + 6, product* 6 * 3 * 9 * 7 * 2 * 3 * 8 * 6, index + 68327936);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 8 + 6, product* 8 * 2 * 7 * 9 * 2 * 3 * 8 * 6, index + 68329728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 8 + 6, product* 2 * 7 * 2 * 2 * 4 * 3 * 8 * 6, index + 68342272);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 8 + 6, product* 2 * 9 * 3 * 7 * 4 * 3 * 8 * 6, index + 68347392);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 8 + 6, product* 2 * 3 * 2 * 3 * 8 * 3 * 8 * 6, index + 68383232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 8 + 6, product* 8 * 2 * 3 * 7 * 8 * 3 * 8 * 6, index + 68387328);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 8 + 6, product* 4 * 8 * 3 * 2 * 3 * 4 * 8 * 6, index + 68432384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 8 + 6, product* 2 * 3 * 4 * 4 * 3 * 4 * 8 * 6, index + 68434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 8 + 6, product* 4 * 2 * 2 * 6 * 3 * 4 * 8 * 6, index + 68436224);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 8 + 6, product* 2 * 3 * 2 * 7 * 4 * 4 * 8 * 6, index + 68447232);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 8 + 6, product* 2 * 3 * 8 * 2 * 7 * 4 * 8 * 6, index + 68472832);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 7 + 4 + 8 + 6, product* 8 * 2 * 9 * 6 * 7 * 4 * 8 * 6, index + 68476928);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 8 + 6, product* 2 * 3 * 2 * 9 * 7 * 4 * 8 * 6, index + 68479232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 8 + 6, product* 8 * 2 * 3 * 3 * 8 * 4 * 8 * 6, index + 68483328);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 4 + 8 + 6, product* 8 * 8 * 2 * 2 * 9 * 4 * 8 * 6, index + 68492288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 8 + 6, product* 4 * 2 * 8 * 3 * 9 * 4 * 8 * 6, index + 68493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 8 + 6, product* 6 * 3 * 3 * 2 * 2 * 6 * 8 * 6, index + 68622336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 8 + 6, product* 8 * 4 * 8 * 2 * 2 * 6 * 8 * 6, index + 68622848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 8 + 6, product* 2 * 7 * 8 * 3 * 2 * 6 * 8 * 6, index + 68623872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 8 + 6, product* 2 * 3 * 4 * 6 * 2 * 6 * 8 * 6, index + 68626432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 8 + 6, product* 8 * 2 * 3 * 3 * 4 * 6 * 8 * 6, index + 68643328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 8 + 6, product* 2 * 7 * 2 * 2 * 6 * 6 * 8 * 6, index + 68662272);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 6 + 8 + 6, product* 8 * 6 * 7 * 2 * 7 * 6 * 8 * 6, index + 68672768);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 8 + 6, product* 2 * 3 * 4 * 2 * 2 * 7 * 8 * 6, index + 68722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 8 + 6, product* 4 * 4 * 9 * 2 * 2 * 7 * 8 * 6, index + 68722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 8 + 6, product* 4 * 2 * 2 * 4 * 2 * 7 * 8 * 6, index + 68724224);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 8 + 6, product* 4 * 4 * 3 * 9 * 2 * 7 * 8 * 6, index + 68729344);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 8 + 6, product* 8 * 2 * 9 * 2 * 3 * 7 * 8 * 6, index + 68732928);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 8 + 6, product* 4 * 2 * 4 * 3 * 4 * 7 * 8 * 6, index + 68743424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 8 + 6, product* 6 * 3 * 3 * 2 * 8 * 7 * 8 * 6, index + 68782336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 8 + 6, product* 4 * 2 * 2 * 8 * 8 * 7 * 8 * 6, index + 68788224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 8 + 6, product* 2 * 7 * 2 * 2 * 2 * 8 * 8 * 6, index + 68822272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 8 + 6, product* 6 * 9 * 2 * 3 * 2 * 8 * 8 * 6, index + 68823296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 8 + 6, product* 8 * 6 * 3 * 2 * 2 * 9 * 8 * 6, index + 68922368);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 8 + 6, product* 2 * 3 * 4 * 6 * 4 * 9 * 8 * 6, index + 68946432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 8 + 6, product* 4 * 2 * 2 * 8 * 4 * 9 * 8 * 6, index + 68948224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 9 + 6, product* 4 * 2 * 4 * 3 * 2 * 2 * 9 * 6, index + 69223424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 9 + 6, product* 6 * 3 * 9 * 3 * 2 * 2 * 9 * 6, index + 69223936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 9 + 6, product* 8 * 4 * 4 * 4 * 2 * 2 * 9 * 6, index + 69224448);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2 + 9 + 6, product* 8 * 8 * 2 * 8 * 2 * 2 * 9 * 6, index + 69228288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2 + 9 + 6, product* 4 * 2 * 8 * 9 * 2 * 2 * 9 * 6, index + 69229824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 9 + 6, product* 4 * 8 * 3 * 2 * 3 * 2 * 9 * 6, index + 69232384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 9 + 6, product* 4 * 6 * 6 * 3 * 3 * 2 * 9 * 6, index + 69233664);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 9 + 6, product* 4 * 2 * 2 * 6 * 3 * 2 * 9 * 6, index + 69236224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 9 + 6, product* 2 * 7 * 2 * 8 * 3 * 2 * 9 * 6, index + 69238272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 9 + 6, product* 8 * 6 * 3 * 2 * 4 * 2 * 9 * 6, index + 69242368);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 9 + 6, product* 2 * 7 * 6 * 4 * 4 * 2 * 9 * 6, index + 69244672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 9 + 6, product* 2 * 3 * 2 * 7 * 4 * 2 * 9 * 6, index + 69247232);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 2 + 9 + 6, product* 8 * 4 * 8 * 2 * 6 * 2 * 9 * 6, index + 69262848);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 9 + 6, product* 4 * 2 * 2 * 8 * 6 * 2 * 9 * 6, index + 69268224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 9 + 6, product* 4 * 4 * 3 * 3 * 7 * 2 * 9 * 6, index + 69273344);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 9 + 6, product* 2 * 3 * 2 * 9 * 7 * 2 * 9 * 6, index + 69279232);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 9 + 6, product* 2 * 3 * 4 * 8 * 9 * 2 * 9 * 6, index + 69298432);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 9 + 6, product* 4 * 6 * 2 * 3 * 2 * 3 * 9 * 6, index + 69323264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 9 + 6, product* 6 * 3 * 3 * 6 * 2 * 3 * 9 * 6, index + 69326336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 9 + 6, product* 4 * 2 * 2 * 2 * 3 * 3 * 9 * 6, index + 69332224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 9 + 6, product* 8 * 4 * 2 * 3 * 3 * 3 * 9 * 6, index + 69333248);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 9 + 6, product* 2 * 3 * 2 * 3 * 4 * 3 * 9 * 6, index + 69343232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 9 + 6, product* 2 * 3 * 4 * 2 * 6 * 3 * 9 * 6, index + 69362432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 9 + 6, product* 4 * 2 * 2 * 4 * 6 * 3 * 9 * 6, index + 69364224);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 3 + 9 + 6, product* 4 * 4 * 3 * 9 * 6 * 3 * 9 * 6, index + 69369344);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 9 + 6, product* 6 * 3 * 3 * 2 * 2 * 4 * 9 * 6, index + 69422336);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 9 + 6, product* 2 * 3 * 8 * 2 * 3 * 4 * 9 * 6, index + 69432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 9 + 6, product* 4 * 4 * 3 * 3 * 3 * 4 * 9 * 6, index + 69433344);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 4 + 9 + 6, product* 4 * 6 * 4 * 8 * 3 * 4 * 9 * 6, index + 69438464);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 4 + 9 + 6, product* 4 * 6 * 8 * 4 * 4 * 4 * 9 * 6, index + 69444864);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 9 + 6, product* 2 * 7 * 2 * 2 * 6 * 4 * 9 * 6, index + 69462272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 4 + 9 + 6, product* 2 * 3 * 8 * 4 * 6 * 4 * 9 * 6, index + 69464832);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 4 + 9 + 6, product* 8 * 6 * 7 * 2 * 7 * 4 * 9 * 6, index + 69472768);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 4 + 9 + 6, product* 8 * 4 * 2 * 3 * 9 * 4 * 9 * 6, index + 69493248);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4 + 9 + 6, product* 2 * 3 * 8 * 6 * 9 * 4 * 9 * 6, index + 69496832);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 6 + 9 + 6, product* 4 * 8 * 7 * 2 * 2 * 6 * 9 * 6, index + 69622784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 6 + 9 + 6, product* 2 * 3 * 8 * 4 * 2 * 6 * 9 * 6, index + 69624832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 9 + 6, product* 2 * 9 * 3 * 7 * 2 * 6 * 9 * 6, index + 69627392);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 9 + 6, product* 6 * 3 * 3 * 6 * 4 * 6 * 9 * 6, index + 69646336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 9 + 6, product* 4 * 6 * 4 * 2 * 6 * 6 * 9 * 6, index + 69662464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 9 + 6, product* 2 * 3 * 2 * 3 * 6 * 6 * 9 * 6, index + 69663232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 9 + 6, product* 4 * 4 * 7 * 3 * 6 * 6 * 9 * 6, index + 69663744);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 9 + 6, product* 2 * 3 * 4 * 2 * 8 * 6 * 9 * 6, index + 69682432);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 9 + 6, product* 8 * 6 * 3 * 2 * 2 * 7 * 9 * 6, index + 69722368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 9 + 6, product* 4 * 2 * 6 * 2 * 2 * 7 * 9 * 6, index + 69722624);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 7 + 9 + 6, product* 6 * 7 * 3 * 3 * 3 * 7 * 9 * 6, index + 69733376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 9 + 6, product* 2 * 3 * 6 * 3 * 3 * 7 * 9 * 6, index + 69733632);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 9 + 6, product* 6 * 3 * 3 * 2 * 4 * 7 * 9 * 6, index + 69742336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 9 + 6, product* 4 * 6 * 4 * 2 * 2 * 8 * 9 * 6, index + 69822464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 9 + 6, product* 2 * 3 * 2 * 3 * 2 * 8 * 9 * 6, index + 69823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 9 + 6, product* 4 * 4 * 7 * 3 * 2 * 8 * 9 * 6, index + 69823744);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 9 + 6, product* 4 * 2 * 8 * 7 * 3 * 8 * 9 * 6, index + 69837824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 9 + 6, product* 2 * 3 * 4 * 2 * 4 * 8 * 9 * 6, index + 69842432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 9 + 6, product* 4 * 2 * 2 * 4 * 4 * 8 * 9 * 6, index + 69844224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 8 + 9 + 6, product* 2 * 7 * 2 * 8 * 7 * 8 * 9 * 6, index + 69878272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 9 + 9 + 6, product* 2 * 3 * 8 * 4 * 4 * 9 * 9 * 6, index + 69944832);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 9 + 9 + 6, product* 8 * 4 * 6 * 7 * 4 * 9 * 9 * 6, index + 69947648);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 9 + 6, product* 2 * 7 * 2 * 4 * 7 * 9 * 9 * 6, index + 69974272);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 9 + 6, product* 2 * 3 * 2 * 3 * 8 * 9 * 9 * 6, index + 69983232);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 2 + 7, product* 4 * 6 * 4 * 2 * 2 * 2 * 2 * 7, index + 72222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 2 + 7, product* 6 * 7 * 9 * 2 * 2 * 2 * 2 * 7, index + 72222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 2 + 7, product* 2 * 3 * 2 * 3 * 2 * 2 * 2 * 7, index + 72223232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 2 + 7, product* 4 * 4 * 7 * 3 * 2 * 2 * 2 * 7, index + 72223744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 2 + 7, product* 8 * 2 * 3 * 7 * 2 * 2 * 2 * 7, index + 72227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 2 + 7, product* 4 * 6 * 8 * 8 * 2 * 2 * 2 * 7, index + 72228864);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 2 + 2 + 7, product* 6 * 7 * 3 * 9 * 2 * 2 * 2 * 7, index + 72229376);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 2 + 7, product* 8 * 4 * 4 * 2 * 3 * 2 * 2 * 7, index + 72232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 2 + 7, product* 2 * 7 * 4 * 3 * 3 * 2 * 2 * 7, index + 72233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 2 + 7, product* 8 * 2 * 7 * 3 * 3 * 2 * 2 * 7, index + 72233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 2 + 7, product* 4 * 8 * 9 * 3 * 3 * 2 * 2 * 7, index + 72233984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 2 + 7, product* 6 * 9 * 4 * 4 * 3 * 2 * 2 * 7, index + 72234496);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 2 + 2 + 7, product* 8 * 8 * 2 * 6 * 3 * 2 * 2 * 7, index + 72236288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 2 + 7, product* 4 * 2 * 8 * 7 * 3 * 2 * 2 * 7, index + 72237824);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 2 + 7, product* 2 * 7 * 8 * 9 * 3 * 2 * 2 * 7, index + 72239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 2 + 7, product* 2 * 3 * 4 * 2 * 4 * 2 * 2 * 7, index + 72242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 2 + 7, product* 8 * 8 * 6 * 2 * 4 * 2 * 2 * 7, index + 72242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 2 + 7, product* 4 * 4 * 9 * 2 * 4 * 2 * 2 * 7, index + 72242944);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 2 + 7, product* 2 * 9 * 3 * 3 * 4 * 2 * 2 * 7, index + 72243392);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 2 + 7, product* 4 * 2 * 2 * 4 * 4 * 2 * 2 * 7, index + 72244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 2 + 7, product* 6 * 3 * 7 * 4 * 4 * 2 * 2 * 7, index + 72244736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 2 + 7, product* 2 * 7 * 2 * 6 * 4 * 2 * 2 * 7, index + 72246272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 2 + 2 + 7, product* 6 * 9 * 2 * 7 * 4 * 2 * 2 * 7, index + 72247296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 2 + 7, product* 2 * 3 * 8 * 8 * 4 * 2 * 2 * 7, index + 72248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 2 + 7, product* 4 * 4 * 3 * 9 * 4 * 2 * 2 * 7, index + 72249344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 2 + 7, product* 4 * 2 * 4 * 3 * 6 * 2 * 2 * 7, index + 72263424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 2 + 7, product* 4 * 6 * 2 * 7 * 6 * 2 * 2 * 7, index + 72267264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 2 + 2 + 7, product* 8 * 8 * 2 * 8 * 6 * 2 * 2 * 7, index + 72268288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 2 + 7, product* 4 * 2 * 8 * 9 * 6 * 2 * 2 * 7, index + 72269824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 2 + 7, product* 4 * 8 * 3 * 2 * 7 * 2 * 2 * 7, index + 72272384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 2 + 7, product* 6 * 9 * 8 * 2 * 7 * 2 * 2 * 7, index + 72272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 2 + 7, product* 4 * 6 * 6 * 3 * 7 * 2 * 2 * 7, index + 72273664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 2 + 7, product* 2 * 3 * 4 * 4 * 7 * 2 * 2 * 7, index + 72274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 2 + 7, product* 4 * 4 * 9 * 4 * 7 * 2 * 2 * 7, index + 72274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 2 + 7, product* 4 * 2 * 2 * 6 * 7 * 2 * 2 * 7, index + 72276224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 2 + 2 + 7, product* 2 * 9 * 9 * 6 * 7 * 2 * 2 * 7, index + 72276992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 2 + 7, product* 8 * 4 * 2 * 7 * 7 * 2 * 2 * 7, index + 72277248);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 2 + 7, product* 4 * 2 * 6 * 2 * 8 * 2 * 2 * 7, index + 72282624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 2 + 7, product* 8 * 4 * 6 * 3 * 8 * 2 * 2 * 7, index + 72283648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 2 + 7, product* 2 * 3 * 2 * 7 * 8 * 2 * 2 * 7, index + 72287232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 8 + 2 + 2 + 7, product* 4 * 4 * 7 * 7 * 8 * 2 * 2 * 7, index + 72287744);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 8 + 2 + 2 + 7, product* 8 * 6 * 7 * 8 * 8 * 2 * 2 * 7, index + 72288768);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 2 + 7, product* 4 * 6 * 8 * 2 * 9 * 2 * 2 * 7, index + 72292864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 2 + 7, product* 2 * 3 * 6 * 3 * 9 * 2 * 2 * 7, index + 72293632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2 + 2 + 7, product* 8 * 8 * 8 * 3 * 9 * 2 * 2 * 7, index + 72293888);
-body<0>(stream, sum+ 4 + 8 + 9 + 7 + 9 + 2 + 2 + 7, product* 4 * 8 * 9 * 7 * 9 * 2 * 2 * 7, index + 72297984);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 2 + 7, product* 8 * 2 * 3 * 3 * 2 * 3 * 2 * 7, index + 72323328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 2 + 7, product* 4 * 6 * 8 * 4 * 2 * 3 * 2 * 7, index + 72324864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 2 + 7, product* 4 * 2 * 4 * 7 * 2 * 3 * 2 * 7, index + 72327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 2 + 7, product* 6 * 3 * 9 * 7 * 2 * 3 * 2 * 7, index + 72327936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 2 + 7, product* 8 * 4 * 4 * 8 * 2 * 3 * 2 * 7, index + 72328448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 2 + 7, product* 2 * 7 * 4 * 9 * 2 * 3 * 2 * 7, index + 72329472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 2 + 7, product* 8 * 2 * 7 * 9 * 2 * 3 * 2 * 7, index + 72329728);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 2 + 7, product* 8 * 8 * 2 * 2 * 3 * 3 * 2 * 7, index + 72332288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 2 + 7, product* 4 * 2 * 8 * 3 * 3 * 3 * 2 * 7, index + 72333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 2 + 7, product* 6 * 3 * 3 * 4 * 3 * 3 * 2 * 7, index + 72334336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 3 + 2 + 7, product* 4 * 8 * 3 * 6 * 3 * 3 * 2 * 7, index + 72336384);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 2 + 7, product* 2 * 3 * 4 * 8 * 3 * 3 * 2 * 7, index + 72338432);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 3 + 2 + 7, product* 4 * 4 * 9 * 8 * 3 * 3 * 2 * 7, index + 72338944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 2 + 7, product* 2 * 7 * 2 * 2 * 4 * 3 * 2 * 7, index + 72342272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 2 + 7, product* 6 * 9 * 2 * 3 * 4 * 3 * 2 * 7, index + 72343296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 2 + 7, product* 2 * 3 * 8 * 4 * 4 * 3 * 2 * 7, index + 72344832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 2 + 7, product* 2 * 9 * 3 * 7 * 4 * 3 * 2 * 7, index + 72347392);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 2 + 7, product* 6 * 9 * 4 * 2 * 6 * 3 * 2 * 7, index + 72362496);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 2 + 7, product* 8 * 8 * 2 * 4 * 6 * 3 * 2 * 7, index + 72364288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3 + 2 + 7, product* 4 * 8 * 3 * 8 * 6 * 3 * 2 * 7, index + 72368384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 2 + 7, product* 4 * 2 * 2 * 2 * 7 * 3 * 2 * 7, index + 72372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 2 + 7, product* 6 * 3 * 7 * 2 * 7 * 3 * 2 * 7, index + 72372736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 2 + 7, product* 2 * 9 * 9 * 2 * 7 * 3 * 2 * 7, index + 72372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 2 + 7, product* 8 * 4 * 2 * 3 * 7 * 3 * 2 * 7, index + 72373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 2 + 7, product* 2 * 7 * 2 * 4 * 7 * 3 * 2 * 7, index + 72374272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 7 + 3 + 2 + 7, product* 4 * 8 * 7 * 4 * 7 * 3 * 2 * 7, index + 72374784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 3 + 2 + 7, product* 2 * 3 * 8 * 6 * 7 * 3 * 2 * 7, index + 72376832);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 7 + 3 + 2 + 7, product* 8 * 6 * 3 * 8 * 7 * 3 * 2 * 7, index + 72378368);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 7 + 3 + 2 + 7, product* 2 * 9 * 3 * 9 * 7 * 3 * 2 * 7, index + 72379392);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 2 + 7, product* 4 * 6 * 4 * 2 * 8 * 3 * 2 * 7, index + 72382464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 2 + 7, product* 2 * 3 * 2 * 3 * 8 * 3 * 2 * 7, index + 72383232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 8 + 3 + 2 + 7, product* 8 * 8 * 4 * 3 * 8 * 3 * 2 * 7, index + 72383488);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 2 + 7, product* 8 * 2 * 3 * 7 * 8 * 3 * 2 * 7, index + 72387328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 8 + 3 + 2 + 7, product* 6 * 7 * 3 * 9 * 8 * 3 * 2 * 7, index + 72389376);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 2 + 7, product* 2 * 7 * 4 * 3 * 9 * 3 * 2 * 7, index + 72393472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 2 + 7, product* 8 * 2 * 7 * 3 * 9 * 3 * 2 * 7, index + 72393728);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 3 + 2 + 7, product* 2 * 9 * 7 * 3 * 9 * 3 * 2 * 7, index + 72393792);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 2 + 7, product* 4 * 2 * 8 * 7 * 9 * 3 * 2 * 7, index + 72397824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 9 + 3 + 2 + 7, product* 6 * 3 * 3 * 8 * 9 * 3 * 2 * 7, index + 72398336);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 2 + 7, product* 4 * 2 * 4 * 3 * 2 * 4 * 2 * 7, index + 72423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 2 + 7, product* 6 * 3 * 9 * 3 * 2 * 4 * 2 * 7, index + 72423936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 2 + 7, product* 8 * 4 * 4 * 4 * 2 * 4 * 2 * 7, index + 72424448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 2 + 7, product* 4 * 6 * 2 * 7 * 2 * 4 * 2 * 7, index + 72427264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 2 + 7, product* 4 * 2 * 8 * 9 * 2 * 4 * 2 * 7, index + 72429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 2 + 7, product* 4 * 8 * 3 * 2 * 3 * 4 * 2 * 7, index + 72432384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 2 + 7, product* 6 * 9 * 8 * 2 * 3 * 4 * 2 * 7, index + 72432896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 2 + 7, product* 4 * 6 * 6 * 3 * 3 * 4 * 2 * 7, index + 72433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 2 + 7, product* 2 * 3 * 4 * 4 * 3 * 4 * 2 * 7, index + 72434432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 4 + 2 + 7, product* 4 * 4 * 9 * 4 * 3 * 4 * 2 * 7, index + 72434944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 2 + 7, product* 4 * 2 * 2 * 6 * 3 * 4 * 2 * 7, index + 72436224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 2 + 7, product* 8 * 4 * 2 * 7 * 3 * 4 * 2 * 7, index + 72437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 2 + 7, product* 2 * 7 * 2 * 8 * 3 * 4 * 2 * 7, index + 72438272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 4 + 2 + 7, product* 4 * 8 * 7 * 8 * 3 * 4 * 2 * 7, index + 72438784);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 4 + 2 + 7, product* 6 * 9 * 2 * 9 * 3 * 4 * 2 * 7, index + 72439296);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 2 + 7, product* 8 * 6 * 3 * 2 * 4 * 4 * 2 * 7, index + 72442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 2 + 7, product* 4 * 2 * 6 * 2 * 4 * 4 * 2 * 7, index + 72442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 2 + 7, product* 2 * 9 * 3 * 3 * 4 * 4 * 2 * 7, index + 72443392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 2 + 7, product* 8 * 4 * 6 * 3 * 4 * 4 * 2 * 7, index + 72443648);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 2 + 7, product* 8 * 2 * 9 * 4 * 4 * 4 * 2 * 7, index + 72444928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 2 + 7, product* 4 * 6 * 4 * 6 * 4 * 4 * 2 * 7, index + 72446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 2 + 7, product* 2 * 3 * 2 * 7 * 4 * 4 * 2 * 7, index + 72447232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 2 + 7, product* 6 * 3 * 3 * 2 * 6 * 4 * 2 * 7, index + 72462336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 2 + 7, product* 2 * 7 * 8 * 3 * 6 * 4 * 2 * 7, index + 72463872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 4 + 2 + 7, product* 4 * 8 * 3 * 4 * 6 * 4 * 2 * 7, index + 72464384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 2 + 7, product* 2 * 3 * 4 * 6 * 6 * 4 * 2 * 7, index + 72466432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 6 + 4 + 2 + 7, product* 4 * 4 * 9 * 6 * 6 * 4 * 2 * 7, index + 72466944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 2 + 7, product* 4 * 2 * 2 * 8 * 6 * 4 * 2 * 7, index + 72468224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 4 + 2 + 7, product* 6 * 3 * 7 * 8 * 6 * 4 * 2 * 7, index + 72468736);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 4 + 2 + 7, product* 8 * 6 * 3 * 4 * 7 * 4 * 2 * 7, index + 72474368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 2 + 7, product* 4 * 2 * 6 * 4 * 7 * 4 * 2 * 7, index + 72474624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 2 + 7, product* 2 * 3 * 2 * 9 * 7 * 4 * 2 * 7, index + 72479232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 2 + 7, product* 8 * 2 * 3 * 3 * 8 * 4 * 2 * 7, index + 72483328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 2 + 7, product* 4 * 2 * 4 * 7 * 8 * 4 * 2 * 7, index + 72487424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 4 + 2 + 7, product* 2 * 7 * 4 * 9 * 8 * 4 * 2 * 7, index + 72489472);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 2 + 7, product* 4 * 2 * 8 * 3 * 9 * 4 * 2 * 7, index + 72493824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 2 + 7, product* 6 * 3 * 3 * 4 * 9 * 4 * 2 * 7, index + 72494336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 9 + 4 + 2 + 7, product* 4 * 8 * 3 * 6 * 9 * 4 * 2 * 7, index + 72496384);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 2 + 7, product* 6 * 3 * 3 * 2 * 2 * 6 * 2 * 7, index + 72622336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 2 + 7, product* 8 * 4 * 8 * 2 * 2 * 6 * 2 * 7, index + 72622848);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 2 + 7, product* 2 * 3 * 4 * 6 * 2 * 6 * 2 * 7, index + 72626432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 2 + 7, product* 4 * 2 * 2 * 8 * 2 * 6 * 2 * 7, index + 72628224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 6 + 2 + 7, product* 6 * 3 * 7 * 8 * 2 * 6 * 2 * 7, index + 72628736);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 2 + 7, product* 2 * 3 * 8 * 2 * 3 * 6 * 2 * 7, index + 72632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 2 + 7, product* 4 * 4 * 3 * 3 * 3 * 6 * 2 * 7, index + 72633344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 2 + 7, product* 2 * 7 * 6 * 6 * 3 * 6 * 2 * 7, index + 72636672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 6 + 2 + 7, product* 8 * 2 * 9 * 6 * 3 * 6 * 2 * 7, index + 72636928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6 + 2 + 7, product* 4 * 6 * 4 * 8 * 3 * 6 * 2 * 7, index + 72638464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 2 + 7, product* 2 * 3 * 2 * 9 * 3 * 6 * 2 * 7, index + 72639232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 2 + 7, product* 4 * 2 * 4 * 7 * 4 * 6 * 2 * 7, index + 72647424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 6 + 2 + 7, product* 6 * 3 * 9 * 7 * 4 * 6 * 2 * 7, index + 72647936);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 4 + 6 + 2 + 7, product* 8 * 4 * 4 * 8 * 4 * 6 * 2 * 7, index + 72648448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 6 + 2 + 7, product* 2 * 7 * 4 * 9 * 4 * 6 * 2 * 7, index + 72649472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 6 + 2 + 7, product* 8 * 2 * 7 * 9 * 4 * 6 * 2 * 7, index + 72649728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 2 + 7, product* 2 * 7 * 2 * 2 * 6 * 6 * 2 * 7, index + 72662272);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 2 + 7, product* 2 * 3 * 2 * 3 * 6 * 6 * 2 * 7, index + 72663232);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 2 + 7, product* 6 * 9 * 2 * 3 * 6 * 6 * 2 * 7, index + 72663296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 2 + 7, product* 2 * 3 * 8 * 4 * 6 * 6 * 2 * 7, index + 72664832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 2 + 7, product* 4 * 2 * 6 * 6 * 6 * 6 * 2 * 7, index + 72666624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 2 + 7, product* 2 * 9 * 3 * 7 * 6 * 6 * 2 * 7, index + 72667392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 6 + 2 + 7, product* 8 * 4 * 6 * 7 * 6 * 6 * 2 * 7, index + 72667648);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 6 + 6 + 2 + 7, product* 6 * 9 * 6 * 9 * 6 * 6 * 2 * 7, index + 72669696);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 2 + 7, product* 2 * 3 * 6 * 7 * 7 * 6 * 2 * 7, index + 72677632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 2 + 7, product* 4 * 2 * 4 * 9 * 7 * 6 * 2 * 7, index + 72679424);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 2 + 7, product* 4 * 2 * 2 * 2 * 9 * 6 * 2 * 7, index + 72692224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 6 + 2 + 7, product* 2 * 9 * 9 * 2 * 9 * 6 * 2 * 7, index + 72692992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 6 + 2 + 7, product* 8 * 4 * 2 * 3 * 9 * 6 * 2 * 7, index + 72693248);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 6 + 2 + 7, product* 2 * 3 * 8 * 6 * 9 * 6 * 2 * 7, index + 72696832);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 2 + 7, product* 2 * 3 * 4 * 2 * 2 * 7 * 2 * 7, index + 72722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 2 + 7, product* 4 * 4 * 9 * 2 * 2 * 7 * 2 * 7, index + 72722944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 7 + 2 + 7, product* 8 * 6 * 9 * 3 * 2 * 7 * 2 * 7, index + 72723968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 2 + 7, product* 4 * 2 * 2 * 4 * 2 * 7 * 2 * 7, index + 72724224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 7 + 2 + 7, product* 2 * 9 * 9 * 4 * 2 * 7 * 2 * 7, index + 72724992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 2 + 7, product* 2 * 7 * 2 * 6 * 2 * 7 * 2 * 7, index + 72726272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 2 + 7, product* 2 * 3 * 8 * 8 * 2 * 7 * 2 * 7, index + 72728832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 2 + 7, product* 2 * 7 * 6 * 2 * 3 * 7 * 2 * 7, index + 72732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 2 + 7, product* 8 * 2 * 9 * 2 * 3 * 7 * 2 * 7, index + 72732928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 2 + 7, product* 4 * 6 * 4 * 4 * 3 * 7 * 2 * 7, index + 72734464);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 7 + 2 + 7, product* 6 * 7 * 9 * 4 * 3 * 7 * 2 * 7, index + 72734976);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 2 + 7, product* 8 * 2 * 3 * 9 * 3 * 7 * 2 * 7, index + 72739328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 2 + 7, product* 4 * 2 * 4 * 3 * 4 * 7 * 2 * 7, index + 72743424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 7 + 2 + 7, product* 8 * 4 * 4 * 4 * 4 * 7 * 2 * 7, index + 72744448);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 6 + 7 + 2 + 7, product* 8 * 6 * 3 * 2 * 6 * 7 * 2 * 7, index + 72762368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 2 + 7, product* 4 * 2 * 6 * 2 * 6 * 7 * 2 * 7, index + 72762624);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 6 + 7 + 2 + 7, product* 6 * 7 * 9 * 6 * 6 * 7 * 2 * 7, index + 72766976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 2 + 7, product* 2 * 3 * 2 * 7 * 6 * 7 * 2 * 7, index + 72767232);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 7 + 2 + 7, product* 6 * 7 * 3 * 3 * 7 * 7 * 2 * 7, index + 72773376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 2 + 7, product* 2 * 3 * 6 * 3 * 7 * 7 * 2 * 7, index + 72773632);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 7 + 2 + 7, product* 4 * 6 * 2 * 9 * 7 * 7 * 2 * 7, index + 72779264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 7 + 2 + 7, product* 6 * 3 * 3 * 2 * 8 * 7 * 2 * 7, index + 72782336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 7 + 2 + 7, product* 2 * 7 * 8 * 3 * 8 * 7 * 2 * 7, index + 72783872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 7 + 2 + 7, product* 2 * 3 * 4 * 6 * 8 * 7 * 2 * 7, index + 72786432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 2 + 7, product* 2 * 7 * 2 * 2 * 2 * 8 * 2 * 7, index + 72822272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 2 + 7, product* 2 * 3 * 8 * 4 * 2 * 8 * 2 * 7, index + 72824832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 8 + 2 + 7, product* 8 * 6 * 3 * 6 * 2 * 8 * 2 * 7, index + 72826368);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 8 + 2 + 7, product* 2 * 9 * 3 * 7 * 2 * 8 * 2 * 7, index + 72827392);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 8 + 2 + 7, product* 8 * 6 * 7 * 2 * 3 * 8 * 2 * 7, index + 72832768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 2 + 7, product* 2 * 9 * 7 * 3 * 3 * 8 * 2 * 7, index + 72833792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 8 + 2 + 7, product* 4 * 6 * 8 * 6 * 3 * 8 * 2 * 7, index + 72836864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 2 + 7, product* 2 * 3 * 6 * 7 * 3 * 8 * 2 * 7, index + 72837632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 8 + 2 + 7, product* 4 * 6 * 2 * 3 * 4 * 8 * 2 * 7, index + 72843264);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 8 + 2 + 7, product* 6 * 7 * 9 * 2 * 6 * 8 * 2 * 7, index + 72862976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 2 + 7, product* 2 * 3 * 2 * 3 * 6 * 8 * 2 * 7, index + 72863232);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 6 + 8 + 2 + 7, product* 8 * 6 * 7 * 4 * 6 * 8 * 2 * 7, index + 72864768);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 8 + 2 + 7, product* 2 * 7 * 4 * 3 * 7 * 8 * 2 * 7, index + 72873472);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 2 + 7, product* 2 * 3 * 4 * 2 * 8 * 8 * 2 * 7, index + 72882432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 2 + 7, product* 4 * 2 * 6 * 2 * 2 * 9 * 2 * 7, index + 72922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 2 + 7, product* 2 * 9 * 3 * 3 * 2 * 9 * 2 * 7, index + 72923392);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 9 + 2 + 7, product* 6 * 3 * 3 * 6 * 2 * 9 * 2 * 7, index + 72926336);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 2 + 7, product* 2 * 3 * 2 * 7 * 2 * 9 * 2 * 7, index + 72927232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 9 + 2 + 7, product* 2 * 3 * 6 * 3 * 3 * 9 * 2 * 7, index + 72933632);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 9 + 2 + 7, product* 2 * 9 * 3 * 9 * 3 * 9 * 2 * 7, index + 72939392);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 2 + 7, product* 6 * 3 * 3 * 2 * 4 * 9 * 2 * 7, index + 72942336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 2 + 7, product* 2 * 7 * 8 * 3 * 4 * 9 * 2 * 7, index + 72943872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 2 + 7, product* 2 * 3 * 4 * 6 * 4 * 9 * 2 * 7, index + 72946432);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 6 + 9 + 2 + 7, product* 2 * 7 * 4 * 9 * 6 * 9 * 2 * 7, index + 72969472);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 7 + 9 + 2 + 7, product* 4 * 4 * 9 * 8 * 7 * 9 * 2 * 7, index + 72978944);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 9 + 2 + 7, product* 4 * 2 * 4 * 9 * 9 * 9 * 2 * 7, index + 72999424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 3 + 7, product* 6 * 3 * 3 * 2 * 2 * 2 * 3 * 7, index + 73222336);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 3 + 7, product* 4 * 2 * 4 * 3 * 2 * 2 * 3 * 7, index + 73223424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 3 + 7, product* 8 * 4 * 4 * 4 * 2 * 2 * 3 * 7, index + 73224448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 3 + 7, product* 4 * 6 * 2 * 7 * 2 * 2 * 3 * 7, index + 73227264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 2 + 3 + 7, product* 8 * 8 * 2 * 8 * 2 * 2 * 3 * 7, index + 73228288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 2 + 3 + 7, product* 4 * 2 * 8 * 9 * 2 * 2 * 3 * 7, index + 73229824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 3 + 7, product* 4 * 8 * 3 * 2 * 3 * 2 * 3 * 7, index + 73232384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 3 + 7, product* 4 * 6 * 6 * 3 * 3 * 2 * 3 * 7, index + 73233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 3 + 7, product* 2 * 3 * 4 * 4 * 3 * 2 * 3 * 7, index + 73234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 3 + 7, product* 4 * 4 * 9 * 4 * 3 * 2 * 3 * 7, index + 73234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 3 + 7, product* 4 * 2 * 2 * 6 * 3 * 2 * 3 * 7, index + 73236224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 2 + 3 + 7, product* 2 * 9 * 9 * 6 * 3 * 2 * 3 * 7, index + 73236992);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 3 + 7, product* 2 * 3 * 2 * 9 * 3 * 2 * 3 * 7, index + 73239232);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 2 + 3 + 7, product* 6 * 9 * 2 * 9 * 3 * 2 * 3 * 7, index + 73239296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 3 + 7, product* 4 * 2 * 6 * 2 * 4 * 2 * 3 * 7, index + 73242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 3 + 7, product* 2 * 9 * 3 * 3 * 4 * 2 * 3 * 7, index + 73243392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 3 + 7, product* 8 * 4 * 6 * 3 * 4 * 2 * 3 * 7, index + 73243648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 3 + 7, product* 2 * 7 * 6 * 4 * 4 * 2 * 3 * 7, index + 73244672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 2 + 3 + 7, product* 8 * 2 * 9 * 4 * 4 * 2 * 3 * 7, index + 73244928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 3 + 7, product* 2 * 3 * 2 * 7 * 4 * 2 * 3 * 7, index + 73247232);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 2 + 3 + 7, product* 8 * 6 * 7 * 8 * 4 * 2 * 3 * 7, index + 73248768);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 3 + 7, product* 6 * 3 * 3 * 2 * 6 * 2 * 3 * 7, index + 73262336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 3 + 7, product* 2 * 7 * 8 * 3 * 6 * 2 * 3 * 7, index + 73263872);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 6 + 2 + 3 + 7, product* 8 * 8 * 6 * 6 * 6 * 2 * 3 * 7, index + 73266688);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 3 + 7, product* 4 * 2 * 2 * 8 * 6 * 2 * 3 * 7, index + 73268224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 3 + 7, product* 2 * 3 * 8 * 2 * 7 * 2 * 3 * 7, index + 73272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 3 + 7, product* 4 * 4 * 3 * 3 * 7 * 2 * 3 * 7, index + 73273344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 3 + 7, product* 8 * 6 * 3 * 4 * 7 * 2 * 3 * 7, index + 73274368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 3 + 7, product* 4 * 2 * 6 * 4 * 7 * 2 * 3 * 7, index + 73274624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 3 + 7, product* 2 * 3 * 2 * 9 * 7 * 2 * 3 * 7, index + 73279232);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7 + 2 + 3 + 7, product* 8 * 8 * 4 * 9 * 7 * 2 * 3 * 7, index + 73279488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 3 + 7, product* 8 * 2 * 3 * 3 * 8 * 2 * 3 * 7, index + 73283328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 2 + 3 + 7, product* 4 * 2 * 4 * 7 * 8 * 2 * 3 * 7, index + 73287424);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 3 + 7, product* 8 * 8 * 2 * 2 * 9 * 2 * 3 * 7, index + 73292288);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 2 + 3 + 7, product* 6 * 3 * 3 * 4 * 9 * 2 * 3 * 7, index + 73294336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 3 + 7, product* 2 * 3 * 4 * 8 * 9 * 2 * 3 * 7, index + 73298432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 3 + 7, product* 6 * 9 * 4 * 2 * 2 * 3 * 3 * 7, index + 73322496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 3 + 7, product* 4 * 6 * 2 * 3 * 2 * 3 * 3 * 7, index + 73323264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 3 + 7, product* 6 * 7 * 7 * 3 * 2 * 3 * 3 * 7, index + 73323776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 3 + 7, product* 8 * 8 * 2 * 4 * 2 * 3 * 3 * 7, index + 73324288);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 3 + 7, product* 2 * 9 * 9 * 4 * 2 * 3 * 3 * 7, index + 73324992);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 2 + 3 + 3 + 7, product* 8 * 4 * 8 * 6 * 2 * 3 * 3 * 7, index + 73326848);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 3 + 7, product* 4 * 8 * 3 * 8 * 2 * 3 * 3 * 7, index + 73328384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 3 + 7, product* 4 * 2 * 2 * 2 * 3 * 3 * 3 * 7, index + 73332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 3 + 7, product* 6 * 3 * 7 * 2 * 3 * 3 * 3 * 7, index + 73332736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 3 + 7, product* 8 * 4 * 2 * 3 * 3 * 3 * 3 * 7, index + 73333248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 3 + 7, product* 2 * 7 * 2 * 4 * 3 * 3 * 3 * 7, index + 73334272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 3 + 3 + 7, product* 4 * 8 * 7 * 4 * 3 * 3 * 3 * 7, index + 73334784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 3 + 7, product* 2 * 3 * 8 * 6 * 3 * 3 * 3 * 7, index + 73336832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 3 + 7, product* 4 * 4 * 3 * 7 * 3 * 3 * 3 * 7, index + 73337344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 3 + 7, product* 4 * 2 * 6 * 8 * 3 * 3 * 3 * 7, index + 73338624);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 3 + 3 + 7, product* 2 * 9 * 3 * 9 * 3 * 3 * 3 * 7, index + 73339392);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 3 + 3 + 7, product* 8 * 4 * 6 * 9 * 3 * 3 * 3 * 7, index + 73339648);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 3 + 7, product* 2 * 7 * 2 * 2 * 4 * 3 * 3 * 7, index + 73342272);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 3 + 3 + 7, product* 4 * 6 * 4 * 2 * 4 * 3 * 3 * 7, index + 73342464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 3 + 7, product* 2 * 3 * 2 * 3 * 4 * 3 * 3 * 7, index + 73343232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 3 + 3 + 7, product* 8 * 8 * 4 * 3 * 4 * 3 * 3 * 7, index + 73343488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 3 + 7, product* 4 * 4 * 7 * 3 * 4 * 3 * 3 * 7, index + 73343744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 3 + 7, product* 8 * 2 * 3 * 7 * 4 * 3 * 3 * 7, index + 73347328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 3 + 7, product* 2 * 3 * 6 * 9 * 4 * 3 * 3 * 7, index + 73349632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 3 + 7, product* 2 * 3 * 4 * 2 * 6 * 3 * 3 * 7, index + 73362432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 3 + 3 + 7, product* 8 * 8 * 6 * 2 * 6 * 3 * 3 * 7, index + 73362688);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 3 + 7, product* 8 * 6 * 9 * 3 * 6 * 3 * 3 * 7, index + 73363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 3 + 7, product* 4 * 2 * 2 * 4 * 6 * 3 * 3 * 7, index + 73364224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 6 + 3 + 3 + 7, product* 6 * 3 * 7 * 4 * 6 * 3 * 3 * 7, index + 73364736);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 3 + 7, product* 2 * 7 * 6 * 2 * 7 * 3 * 3 * 7, index + 73372672);
-body<0>(stream, sum+ 6 + 9 + 6 + 3 + 7 + 3 + 3 + 7, product* 6 * 9 * 6 * 3 * 7 * 3 * 3 * 7, index + 73373696);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 3 + 3 + 7, product* 4 * 6 * 4 * 4 * 7 * 3 * 3 * 7, index + 73374464);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 7 + 3 + 3 + 7, product* 8 * 2 * 3 * 9 * 7 * 3 * 3 * 7, index + 73379328);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 8 + 3 + 3 + 7, product* 8 * 4 * 4 * 4 * 8 * 3 * 3 * 7, index + 73384448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 8 + 3 + 3 + 7, product* 4 * 6 * 2 * 7 * 8 * 3 * 3 * 7, index + 73387264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 3 + 7, product* 4 * 8 * 3 * 2 * 9 * 3 * 3 * 7, index + 73392384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 3 + 7, product* 2 * 3 * 4 * 4 * 9 * 3 * 3 * 7, index + 73394432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 3 + 3 + 7, product* 4 * 2 * 2 * 6 * 9 * 3 * 3 * 7, index + 73396224);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 3 + 7, product* 6 * 3 * 3 * 2 * 2 * 4 * 3 * 7, index + 73422336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4 + 3 + 7, product* 8 * 4 * 8 * 2 * 2 * 4 * 3 * 7, index + 73422848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 3 + 7, product* 2 * 7 * 8 * 3 * 2 * 4 * 3 * 7, index + 73423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 3 + 7, product* 4 * 8 * 3 * 4 * 2 * 4 * 3 * 7, index + 73424384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 3 + 7, product* 2 * 3 * 4 * 6 * 2 * 4 * 3 * 7, index + 73426432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 4 + 3 + 7, product* 4 * 4 * 9 * 6 * 2 * 4 * 3 * 7, index + 73426944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 3 + 7, product* 4 * 2 * 2 * 8 * 2 * 4 * 3 * 7, index + 73428224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 4 + 3 + 7, product* 8 * 4 * 2 * 9 * 2 * 4 * 3 * 7, index + 73429248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 3 + 7, product* 2 * 3 * 8 * 2 * 3 * 4 * 3 * 7, index + 73432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 3 + 7, product* 4 * 4 * 3 * 3 * 3 * 4 * 3 * 7, index + 73433344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 3 + 7, product* 4 * 2 * 6 * 4 * 3 * 4 * 3 * 7, index + 73434624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 4 + 3 + 7, product* 2 * 7 * 6 * 6 * 3 * 4 * 3 * 7, index + 73436672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 4 + 3 + 7, product* 4 * 6 * 4 * 8 * 3 * 4 * 3 * 7, index + 73438464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 4 + 3 + 7, product* 2 * 3 * 2 * 9 * 3 * 4 * 3 * 7, index + 73439232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 3 + 4 + 3 + 7, product* 4 * 4 * 7 * 9 * 3 * 4 * 3 * 7, index + 73439744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 3 + 7, product* 8 * 2 * 3 * 3 * 4 * 4 * 3 * 7, index + 73443328);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 4 + 3 + 7, product* 2 * 7 * 4 * 9 * 4 * 4 * 3 * 7, index + 73449472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 4 + 3 + 7, product* 8 * 2 * 7 * 9 * 4 * 4 * 3 * 7, index + 73449728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 3 + 7, product* 2 * 7 * 2 * 2 * 6 * 4 * 3 * 7, index + 73462272);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 4 + 3 + 7, product* 2 * 9 * 3 * 7 * 6 * 4 * 3 * 7, index + 73467392);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 4 + 3 + 7, product* 2 * 3 * 6 * 7 * 7 * 4 * 3 * 7, index + 73477632);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 4 + 3 + 7, product* 6 * 3 * 3 * 6 * 8 * 4 * 3 * 7, index + 73486336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 8 + 4 + 3 + 7, product* 2 * 7 * 8 * 7 * 8 * 4 * 3 * 7, index + 73487872);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 4 + 3 + 7, product* 4 * 6 * 6 * 9 * 8 * 4 * 3 * 7, index + 73489664);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 4 + 3 + 7, product* 2 * 3 * 8 * 6 * 9 * 4 * 3 * 7, index + 73496832);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 3 + 7, product* 2 * 7 * 2 * 2 * 2 * 6 * 3 * 7, index + 73622272);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 6 + 3 + 7, product* 8 * 6 * 3 * 6 * 2 * 6 * 3 * 7, index + 73626368);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 3 + 7, product* 2 * 9 * 3 * 7 * 2 * 6 * 3 * 7, index + 73627392);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 6 + 3 + 7, product* 8 * 6 * 7 * 2 * 3 * 6 * 3 * 7, index + 73632768);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 6 + 3 + 7, product* 2 * 9 * 7 * 3 * 3 * 6 * 3 * 7, index + 73633792);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 6 + 3 + 7, product* 2 * 7 * 6 * 6 * 3 * 6 * 3 * 7, index + 73636672);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 6 + 3 + 7, product* 6 * 9 * 4 * 2 * 4 * 6 * 3 * 7, index + 73642496);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 3 + 7, product* 4 * 6 * 4 * 2 * 6 * 6 * 3 * 7, index + 73662464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 3 + 7, product* 2 * 3 * 2 * 3 * 6 * 6 * 3 * 7, index + 73663232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 3 + 7, product* 4 * 4 * 7 * 3 * 6 * 6 * 3 * 7, index + 73663744);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 3 + 7, product* 8 * 4 * 4 * 2 * 7 * 6 * 3 * 7, index + 73672448);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6 + 3 + 7, product* 6 * 3 * 3 * 8 * 7 * 6 * 3 * 7, index + 73678336);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 3 + 7, product* 2 * 3 * 2 * 9 * 7 * 6 * 3 * 7, index + 73679232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 3 + 7, product* 2 * 3 * 4 * 2 * 8 * 6 * 3 * 7, index + 73682432);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 8 + 6 + 3 + 7, product* 6 * 9 * 2 * 7 * 8 * 6 * 3 * 7, index + 73687296);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 3 + 7, product* 4 * 2 * 6 * 2 * 2 * 7 * 3 * 7, index + 73722624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 3 + 7, product* 2 * 9 * 3 * 3 * 2 * 7 * 3 * 7, index + 73723392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 7 + 3 + 7, product* 8 * 2 * 9 * 4 * 2 * 7 * 3 * 7, index + 73724928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 3 + 7, product* 2 * 3 * 2 * 7 * 2 * 7 * 3 * 7, index + 73727232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 7 + 3 + 7, product* 8 * 8 * 4 * 7 * 2 * 7 * 3 * 7, index + 73727488);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 3 + 7, product* 2 * 3 * 6 * 3 * 3 * 7 * 3 * 7, index + 73733632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 3 + 7, product* 2 * 7 * 4 * 7 * 3 * 7 * 3 * 7, index + 73737472);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 7 + 3 + 7, product* 2 * 7 * 8 * 3 * 4 * 7 * 3 * 7, index + 73743872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 7 + 3 + 7, product* 4 * 8 * 3 * 4 * 4 * 7 * 3 * 7, index + 73744384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 7 + 3 + 7, product* 2 * 3 * 4 * 6 * 4 * 7 * 3 * 7, index + 73746432);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 7 + 3 + 7, product* 8 * 4 * 4 * 8 * 6 * 7 * 3 * 7, index + 73768448);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 7 + 3 + 7, product* 6 * 3 * 3 * 4 * 7 * 7 * 3 * 7, index + 73774336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 3 + 7, product* 4 * 6 * 4 * 2 * 2 * 8 * 3 * 7, index + 73822464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 3 + 7, product* 2 * 3 * 2 * 3 * 2 * 8 * 3 * 7, index + 73823232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8 + 3 + 7, product* 8 * 2 * 3 * 7 * 2 * 8 * 3 * 7, index + 73827328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 8 + 3 + 7, product* 6 * 7 * 3 * 9 * 2 * 8 * 3 * 7, index + 73829376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8 + 3 + 7, product* 2 * 3 * 6 * 9 * 2 * 8 * 3 * 7, index + 73829632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 3 + 7, product* 2 * 7 * 4 * 3 * 3 * 8 * 3 * 7, index + 73833472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 8 + 3 + 7, product* 4 * 8 * 9 * 3 * 3 * 8 * 3 * 7, index + 73833984);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 3 + 7, product* 4 * 2 * 8 * 7 * 3 * 8 * 3 * 7, index + 73837824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 8 + 3 + 7, product* 2 * 3 * 4 * 2 * 4 * 8 * 3 * 7, index + 73842432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 3 + 7, product* 4 * 2 * 2 * 4 * 4 * 8 * 3 * 7, index + 73844224);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 8 + 3 + 7, product* 6 * 9 * 4 * 6 * 6 * 8 * 3 * 7, index + 73866496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 8 + 3 + 7, product* 4 * 6 * 2 * 7 * 6 * 8 * 3 * 7, index + 73867264);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 8 + 3 + 7, product* 2 * 3 * 4 * 4 * 7 * 8 * 3 * 7, index + 73874432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 8 + 3 + 7, product* 4 * 2 * 6 * 2 * 8 * 8 * 3 * 7, index + 73882624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 3 + 7, product* 2 * 3 * 2 * 7 * 8 * 8 * 3 * 7, index + 73887232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 3 + 7, product* 8 * 2 * 3 * 3 * 2 * 9 * 3 * 7, index + 73923328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 9 + 3 + 7, product* 4 * 6 * 8 * 4 * 2 * 9 * 3 * 7, index + 73924864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 3 + 7, product* 4 * 2 * 4 * 7 * 2 * 9 * 3 * 7, index + 73927424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 9 + 3 + 7, product* 4 * 2 * 8 * 3 * 3 * 9 * 3 * 7, index + 73933824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 3 + 7, product* 6 * 3 * 3 * 4 * 3 * 9 * 3 * 7, index + 73934336);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 3 + 9 + 3 + 7, product* 4 * 8 * 3 * 6 * 3 * 9 * 3 * 7, index + 73936384);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 3 + 7, product* 2 * 7 * 2 * 2 * 4 * 9 * 3 * 7, index + 73942272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 9 + 3 + 7, product* 6 * 9 * 2 * 3 * 4 * 9 * 3 * 7, index + 73943296);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 9 + 3 + 7, product* 8 * 6 * 3 * 6 * 4 * 9 * 3 * 7, index + 73946368);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 9 + 3 + 7, product* 2 * 7 * 6 * 8 * 4 * 9 * 3 * 7, index + 73948672);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 3 + 7, product* 4 * 2 * 2 * 2 * 7 * 9 * 3 * 7, index + 73972224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 9 + 3 + 7, product* 8 * 4 * 2 * 3 * 7 * 9 * 3 * 7, index + 73973248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 9 + 3 + 7, product* 2 * 7 * 2 * 4 * 7 * 9 * 3 * 7, index + 73974272);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 9 + 3 + 7, product* 4 * 6 * 4 * 2 * 8 * 9 * 3 * 7, index + 73982464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 3 + 7, product* 2 * 3 * 2 * 3 * 8 * 9 * 3 * 7, index + 73983232);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 9 + 3 + 7, product* 8 * 2 * 7 * 3 * 9 * 9 * 3 * 7, index + 73993728);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 4 + 7, product* 6 * 3 * 3 * 2 * 2 * 2 * 4 * 7, index + 74222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 4 + 7, product* 8 * 4 * 8 * 2 * 2 * 2 * 4 * 7, index + 74222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 4 + 7, product* 2 * 7 * 8 * 3 * 2 * 2 * 4 * 7, index + 74223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 4 + 7, product* 4 * 8 * 3 * 4 * 2 * 2 * 4 * 7, index + 74224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 4 + 7, product* 2 * 3 * 4 * 6 * 2 * 2 * 4 * 7, index + 74226432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 4 + 7, product* 4 * 2 * 2 * 8 * 2 * 2 * 4 * 7, index + 74228224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 4 + 7, product* 8 * 4 * 2 * 9 * 2 * 2 * 4 * 7, index + 74229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 4 + 7, product* 2 * 3 * 8 * 2 * 3 * 2 * 4 * 7, index + 74232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 4 + 7, product* 4 * 4 * 3 * 3 * 3 * 2 * 4 * 7, index + 74233344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 4 + 7, product* 2 * 7 * 6 * 6 * 3 * 2 * 4 * 7, index + 74236672);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2 + 4 + 7, product* 6 * 7 * 9 * 8 * 3 * 2 * 4 * 7, index + 74238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 4 + 7, product* 2 * 3 * 2 * 9 * 3 * 2 * 4 * 7, index + 74239232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 4 + 7, product* 8 * 2 * 3 * 3 * 4 * 2 * 4 * 7, index + 74243328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 4 + 7, product* 2 * 7 * 2 * 2 * 6 * 2 * 4 * 7, index + 74262272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 2 + 4 + 7, product* 4 * 8 * 7 * 2 * 6 * 2 * 4 * 7, index + 74262784);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 6 + 2 + 4 + 7, product* 8 * 2 * 9 * 8 * 6 * 2 * 4 * 7, index + 74268928);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 4 + 7, product* 2 * 3 * 6 * 7 * 7 * 2 * 4 * 7, index + 74277632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 4 + 7, product* 4 * 2 * 4 * 9 * 7 * 2 * 4 * 7, index + 74279424);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 4 + 7, product* 4 * 2 * 2 * 2 * 9 * 2 * 4 * 7, index + 74292224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 4 + 7, product* 8 * 4 * 2 * 3 * 9 * 2 * 4 * 7, index + 74293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 4 + 7, product* 2 * 7 * 2 * 4 * 9 * 2 * 4 * 7, index + 74294272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 2 + 4 + 7, product* 4 * 4 * 3 * 7 * 9 * 2 * 4 * 7, index + 74297344);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 4 + 7, product* 2 * 9 * 3 * 9 * 9 * 2 * 4 * 7, index + 74299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 4 + 7, product* 2 * 3 * 4 * 2 * 2 * 3 * 4 * 7, index + 74322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 4 + 7, product* 4 * 4 * 9 * 2 * 2 * 3 * 4 * 7, index + 74322944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 4 + 7, product* 4 * 2 * 2 * 4 * 2 * 3 * 4 * 7, index + 74324224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 2 + 3 + 4 + 7, product* 2 * 9 * 9 * 4 * 2 * 3 * 4 * 7, index + 74324992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 4 + 7, product* 2 * 7 * 2 * 6 * 2 * 3 * 4 * 7, index + 74326272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 4 + 7, product* 2 * 3 * 8 * 8 * 2 * 3 * 4 * 7, index + 74328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 4 + 7, product* 4 * 4 * 3 * 9 * 2 * 3 * 4 * 7, index + 74329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 4 + 7, product* 2 * 7 * 6 * 2 * 3 * 3 * 4 * 7, index + 74332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 4 + 7, product* 8 * 2 * 9 * 2 * 3 * 3 * 4 * 7, index + 74332928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 3 + 4 + 7, product* 4 * 6 * 4 * 4 * 3 * 3 * 4 * 7, index + 74334464);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 4 + 7, product* 2 * 9 * 7 * 7 * 3 * 3 * 4 * 7, index + 74337792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 4 + 7, product* 8 * 2 * 3 * 9 * 3 * 3 * 4 * 7, index + 74339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 4 + 7, product* 4 * 2 * 4 * 3 * 4 * 3 * 4 * 7, index + 74343424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 4 + 7, product* 8 * 4 * 4 * 4 * 4 * 3 * 4 * 7, index + 74344448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 4 + 3 + 4 + 7, product* 6 * 9 * 4 * 6 * 4 * 3 * 4 * 7, index + 74346496);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 4 + 7, product* 4 * 2 * 6 * 2 * 6 * 3 * 4 * 7, index + 74362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 4 + 7, product* 2 * 9 * 3 * 3 * 6 * 3 * 4 * 7, index + 74363392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3 + 4 + 7, product* 8 * 4 * 6 * 3 * 6 * 3 * 4 * 7, index + 74363648);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 4 + 7, product* 8 * 2 * 9 * 4 * 6 * 3 * 4 * 7, index + 74364928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 4 + 7, product* 2 * 3 * 2 * 7 * 6 * 3 * 4 * 7, index + 74367232);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 7 + 3 + 4 + 7, product* 6 * 7 * 3 * 3 * 7 * 3 * 4 * 7, index + 74373376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 4 + 7, product* 2 * 3 * 6 * 3 * 7 * 3 * 4 * 7, index + 74373632);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 4 + 7, product* 8 * 2 * 7 * 7 * 7 * 3 * 4 * 7, index + 74377728);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 4 + 7, product* 4 * 6 * 2 * 9 * 7 * 3 * 4 * 7, index + 74379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 4 + 7, product* 6 * 3 * 3 * 2 * 8 * 3 * 4 * 7, index + 74382336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 4 + 7, product* 4 * 2 * 2 * 8 * 8 * 3 * 4 * 7, index + 74388224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 4 + 7, product* 2 * 3 * 8 * 2 * 9 * 3 * 4 * 7, index + 74392832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 4 + 7, product* 4 * 4 * 3 * 3 * 9 * 3 * 4 * 7, index + 74393344);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 4 + 7, product* 2 * 3 * 2 * 9 * 9 * 3 * 4 * 7, index + 74399232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 3 + 4 + 7, product* 4 * 4 * 7 * 9 * 9 * 3 * 4 * 7, index + 74399744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 4 + 7, product* 2 * 7 * 2 * 2 * 2 * 4 * 4 * 7, index + 74422272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 4 + 7, product* 6 * 9 * 2 * 3 * 2 * 4 * 4 * 7, index + 74423296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 4 + 7, product* 2 * 3 * 8 * 4 * 2 * 4 * 4 * 7, index + 74424832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 4 + 7, product* 2 * 9 * 3 * 7 * 2 * 4 * 4 * 7, index + 74427392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 4 + 7, product* 2 * 7 * 6 * 8 * 2 * 4 * 4 * 7, index + 74428672);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 4 + 7, product* 2 * 9 * 7 * 3 * 3 * 4 * 4 * 7, index + 74433792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 4 + 7, product* 4 * 6 * 8 * 6 * 3 * 4 * 4 * 7, index + 74436864);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 4 + 7, product* 4 * 2 * 4 * 9 * 3 * 4 * 4 * 7, index + 74439424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 4 + 7, product* 4 * 6 * 2 * 3 * 4 * 4 * 4 * 7, index + 74443264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 4 + 7, product* 6 * 7 * 7 * 3 * 4 * 4 * 4 * 7, index + 74443776);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 4 + 7, product* 4 * 6 * 4 * 2 * 6 * 4 * 4 * 7, index + 74462464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 4 + 7, product* 2 * 3 * 2 * 3 * 6 * 4 * 4 * 7, index + 74463232);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 4 + 7, product* 4 * 2 * 8 * 7 * 7 * 4 * 4 * 7, index + 74477824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 4 + 7, product* 2 * 3 * 4 * 2 * 8 * 4 * 4 * 7, index + 74482432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 4 + 7, product* 4 * 2 * 2 * 4 * 8 * 4 * 4 * 7, index + 74484224);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 9 + 4 + 4 + 7, product* 6 * 7 * 9 * 4 * 9 * 4 * 4 * 7, index + 74494976);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 4 + 7, product* 4 * 6 * 4 * 2 * 2 * 6 * 4 * 7, index + 74622464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 6 + 4 + 7, product* 6 * 7 * 9 * 2 * 2 * 6 * 4 * 7, index + 74622976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 4 + 7, product* 2 * 3 * 2 * 3 * 2 * 6 * 4 * 7, index + 74623232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 4 + 7, product* 8 * 2 * 3 * 7 * 2 * 6 * 4 * 7, index + 74627328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 4 + 7, product* 2 * 3 * 6 * 9 * 2 * 6 * 4 * 7, index + 74629632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 4 + 7, product* 8 * 4 * 4 * 2 * 3 * 6 * 4 * 7, index + 74632448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 4 + 7, product* 2 * 7 * 4 * 3 * 3 * 6 * 4 * 7, index + 74633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 4 + 7, product* 8 * 2 * 7 * 3 * 3 * 6 * 4 * 7, index + 74633728);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 4 + 7, product* 2 * 3 * 4 * 2 * 4 * 6 * 4 * 7, index + 74642432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 4 + 7, product* 4 * 4 * 9 * 2 * 4 * 6 * 4 * 7, index + 74642944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 4 + 7, product* 4 * 2 * 2 * 4 * 4 * 6 * 4 * 7, index + 74644224);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 6 + 6 + 4 + 7, product* 8 * 8 * 2 * 8 * 6 * 6 * 4 * 7, index + 74668288);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 4 + 7, product* 4 * 8 * 3 * 2 * 7 * 6 * 4 * 7, index + 74672384);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 4 + 7, product* 4 * 2 * 2 * 6 * 7 * 6 * 4 * 7, index + 74676224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 6 + 4 + 7, product* 6 * 3 * 7 * 6 * 7 * 6 * 4 * 7, index + 74676736);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 6 + 4 + 7, product* 4 * 6 * 4 * 6 * 8 * 6 * 4 * 7, index + 74686464);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 6 + 4 + 7, product* 4 * 6 * 8 * 2 * 9 * 6 * 4 * 7, index + 74692864);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 6 + 4 + 7, product* 8 * 2 * 7 * 7 * 9 * 6 * 4 * 7, index + 74697728);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 4 + 7, product* 8 * 2 * 3 * 3 * 2 * 7 * 4 * 7, index + 74723328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 7 + 4 + 7, product* 4 * 6 * 8 * 4 * 2 * 7 * 4 * 7, index + 74724864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 4 + 7, product* 4 * 2 * 4 * 7 * 2 * 7 * 4 * 7, index + 74727424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 7 + 4 + 7, product* 8 * 4 * 4 * 8 * 2 * 7 * 4 * 7, index + 74728448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 4 + 7, product* 2 * 7 * 4 * 9 * 2 * 7 * 4 * 7, index + 74729472);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 7 + 4 + 7, product* 4 * 6 * 6 * 7 * 3 * 7 * 4 * 7, index + 74737664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 4 + 7, product* 2 * 3 * 4 * 8 * 3 * 7 * 4 * 7, index + 74738432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 4 + 7, product* 2 * 7 * 2 * 2 * 4 * 7 * 4 * 7, index + 74742272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 4 + 7, product* 4 * 2 * 6 * 6 * 4 * 7 * 4 * 7, index + 74746624);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 7 + 4 + 7, product* 6 * 3 * 7 * 2 * 7 * 7 * 4 * 7, index + 74772736);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 4 + 7, product* 2 * 7 * 2 * 4 * 7 * 7 * 4 * 7, index + 74774272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 4 + 7, product* 2 * 3 * 8 * 6 * 7 * 7 * 4 * 7, index + 74776832);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 4 + 7, product* 2 * 3 * 2 * 3 * 8 * 7 * 4 * 7, index + 74783232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 7 + 4 + 7, product* 4 * 4 * 7 * 3 * 8 * 7 * 4 * 7, index + 74783744);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7 + 4 + 7, product* 8 * 4 * 4 * 2 * 9 * 7 * 4 * 7, index + 74792448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 4 + 7, product* 2 * 7 * 4 * 3 * 9 * 7 * 4 * 7, index + 74793472);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 4 + 7, product* 4 * 2 * 4 * 3 * 2 * 8 * 4 * 7, index + 74823424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 4 + 7, product* 4 * 6 * 2 * 7 * 2 * 8 * 4 * 7, index + 74827264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 4 + 7, product* 4 * 2 * 8 * 9 * 2 * 8 * 4 * 7, index + 74829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 4 + 7, product* 4 * 8 * 3 * 2 * 3 * 8 * 4 * 7, index + 74832384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 8 + 4 + 7, product* 2 * 3 * 4 * 4 * 3 * 8 * 4 * 7, index + 74834432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 4 + 7, product* 4 * 2 * 2 * 6 * 3 * 8 * 4 * 7, index + 74836224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 4 + 7, product* 4 * 2 * 6 * 2 * 4 * 8 * 4 * 7, index + 74842624);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 8 + 4 + 7, product* 4 * 2 * 2 * 8 * 6 * 8 * 4 * 7, index + 74868224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 4 + 7, product* 4 * 4 * 3 * 3 * 7 * 8 * 4 * 7, index + 74873344);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 4 + 7, product* 4 * 2 * 8 * 3 * 9 * 8 * 4 * 7, index + 74893824);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 9 + 4 + 7, product* 6 * 9 * 4 * 2 * 2 * 9 * 4 * 7, index + 74922496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 4 + 7, product* 4 * 6 * 2 * 3 * 2 * 9 * 4 * 7, index + 74923264);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 9 + 4 + 7, product* 4 * 8 * 3 * 8 * 2 * 9 * 4 * 7, index + 74928384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 4 + 7, product* 4 * 2 * 2 * 2 * 3 * 9 * 4 * 7, index + 74932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 4 + 7, product* 6 * 3 * 7 * 2 * 3 * 9 * 4 * 7, index + 74932736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 4 + 7, product* 8 * 4 * 2 * 3 * 3 * 9 * 4 * 7, index + 74933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 4 + 7, product* 2 * 7 * 2 * 4 * 3 * 9 * 4 * 7, index + 74934272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 9 + 4 + 7, product* 2 * 3 * 8 * 6 * 3 * 9 * 4 * 7, index + 74936832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 9 + 4 + 7, product* 2 * 9 * 3 * 9 * 3 * 9 * 4 * 7, index + 74939392);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 9 + 4 + 7, product* 4 * 4 * 7 * 3 * 4 * 9 * 4 * 7, index + 74943744);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 4 + 7, product* 2 * 3 * 6 * 9 * 4 * 9 * 4 * 7, index + 74949632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 4 + 7, product* 2 * 3 * 4 * 2 * 6 * 9 * 4 * 7, index + 74962432);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 9 + 4 + 7, product* 4 * 4 * 3 * 9 * 6 * 9 * 4 * 7, index + 74969344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 4 + 7, product* 4 * 2 * 4 * 3 * 8 * 9 * 4 * 7, index + 74983424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 4 + 7, product* 4 * 8 * 3 * 2 * 9 * 9 * 4 * 7, index + 74992384);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 6 + 7, product* 4 * 6 * 4 * 2 * 2 * 2 * 6 * 7, index + 76222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 6 + 7, product* 6 * 7 * 9 * 2 * 2 * 2 * 6 * 7, index + 76222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 6 + 7, product* 2 * 3 * 2 * 3 * 2 * 2 * 6 * 7, index + 76223232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 6 + 7, product* 8 * 2 * 3 * 7 * 2 * 2 * 6 * 7, index + 76227328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 6 + 7, product* 2 * 3 * 6 * 9 * 2 * 2 * 6 * 7, index + 76229632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 6 + 7, product* 2 * 7 * 4 * 3 * 3 * 2 * 6 * 7, index + 76233472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 6 + 7, product* 4 * 8 * 9 * 3 * 3 * 2 * 6 * 7, index + 76233984);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 6 + 7, product* 4 * 2 * 8 * 7 * 3 * 2 * 6 * 7, index + 76237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 6 + 7, product* 6 * 3 * 3 * 8 * 3 * 2 * 6 * 7, index + 76238336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 6 + 7, product* 2 * 7 * 8 * 9 * 3 * 2 * 6 * 7, index + 76239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 6 + 7, product* 2 * 3 * 4 * 2 * 4 * 2 * 6 * 7, index + 76242432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 6 + 7, product* 4 * 4 * 9 * 2 * 4 * 2 * 6 * 7, index + 76242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 6 + 7, product* 4 * 2 * 2 * 4 * 4 * 2 * 6 * 7, index + 76244224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 2 + 6 + 7, product* 2 * 9 * 9 * 4 * 4 * 2 * 6 * 7, index + 76244992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 6 + 7, product* 2 * 7 * 2 * 6 * 4 * 2 * 6 * 7, index + 76246272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 6 + 7, product* 2 * 3 * 8 * 8 * 4 * 2 * 6 * 7, index + 76248832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 6 + 7, product* 4 * 2 * 4 * 3 * 6 * 2 * 6 * 7, index + 76263424);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 2 + 6 + 7, product* 4 * 2 * 8 * 9 * 6 * 2 * 6 * 7, index + 76269824);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 6 + 7, product* 4 * 2 * 2 * 6 * 7 * 2 * 6 * 7, index + 76276224);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 6 + 7, product* 2 * 7 * 6 * 4 * 8 * 2 * 6 * 7, index + 76284672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 6 + 7, product* 4 * 6 * 4 * 6 * 8 * 2 * 6 * 7, index + 76286464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 6 + 7, product* 2 * 3 * 2 * 7 * 8 * 2 * 6 * 7, index + 76287232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 6 + 7, product* 4 * 6 * 8 * 2 * 9 * 2 * 6 * 7, index + 76292864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 6 + 7, product* 2 * 3 * 6 * 3 * 9 * 2 * 6 * 7, index + 76293632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 6 + 7, product* 2 * 7 * 4 * 7 * 9 * 2 * 6 * 7, index + 76297472);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 2 + 6 + 7, product* 6 * 9 * 4 * 8 * 9 * 2 * 6 * 7, index + 76298496);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 6 + 7, product* 8 * 2 * 3 * 3 * 2 * 3 * 6 * 7, index + 76323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 6 + 7, product* 4 * 2 * 4 * 7 * 2 * 3 * 6 * 7, index + 76327424);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 2 + 3 + 6 + 7, product* 8 * 4 * 4 * 8 * 2 * 3 * 6 * 7, index + 76328448);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 6 + 7, product* 2 * 7 * 4 * 9 * 2 * 3 * 6 * 7, index + 76329472);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 2 + 3 + 6 + 7, product* 2 * 9 * 7 * 9 * 2 * 3 * 6 * 7, index + 76329792);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 6 + 7, product* 4 * 2 * 8 * 3 * 3 * 3 * 6 * 7, index + 76333824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 6 + 7, product* 2 * 3 * 4 * 8 * 3 * 3 * 6 * 7, index + 76338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 6 + 7, product* 2 * 7 * 2 * 2 * 4 * 3 * 6 * 7, index + 76342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 6 + 7, product* 4 * 8 * 7 * 2 * 4 * 3 * 6 * 7, index + 76342784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 6 + 7, product* 6 * 9 * 2 * 3 * 4 * 3 * 6 * 7, index + 76343296);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 4 + 3 + 6 + 7, product* 8 * 6 * 3 * 6 * 4 * 3 * 6 * 7, index + 76346368);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 6 + 7, product* 2 * 9 * 3 * 7 * 4 * 3 * 6 * 7, index + 76347392);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 6 + 7, product* 4 * 6 * 2 * 3 * 6 * 3 * 6 * 7, index + 76363264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 6 + 7, product* 8 * 8 * 2 * 4 * 6 * 3 * 6 * 7, index + 76364288);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 6 + 7, product* 4 * 2 * 2 * 2 * 7 * 3 * 6 * 7, index + 76372224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 6 + 7, product* 2 * 7 * 2 * 4 * 7 * 3 * 6 * 7, index + 76374272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 7 + 3 + 6 + 7, product* 4 * 4 * 3 * 7 * 7 * 3 * 6 * 7, index + 76377344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 6 + 7, product* 2 * 3 * 2 * 3 * 8 * 3 * 6 * 7, index + 76383232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 8 + 3 + 6 + 7, product* 4 * 4 * 7 * 3 * 8 * 3 * 6 * 7, index + 76383744);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 6 + 7, product* 8 * 4 * 4 * 2 * 9 * 3 * 6 * 7, index + 76392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 6 + 7, product* 2 * 7 * 4 * 3 * 9 * 3 * 6 * 7, index + 76393472);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 6 + 7, product* 4 * 2 * 4 * 3 * 2 * 4 * 6 * 7, index + 76423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 6 + 7, product* 6 * 3 * 9 * 3 * 2 * 4 * 6 * 7, index + 76423936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 6 + 7, product* 4 * 6 * 2 * 7 * 2 * 4 * 6 * 7, index + 76427264);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 6 + 7, product* 4 * 6 * 6 * 3 * 3 * 4 * 6 * 7, index + 76433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 6 + 7, product* 2 * 3 * 4 * 4 * 3 * 4 * 6 * 7, index + 76434432);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 4 + 6 + 7, product* 8 * 4 * 6 * 3 * 4 * 4 * 6 * 7, index + 76443648);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 6 + 7, product* 4 * 6 * 4 * 6 * 4 * 4 * 6 * 7, index + 76446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 6 + 7, product* 2 * 3 * 2 * 7 * 4 * 4 * 6 * 7, index + 76447232);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 6 + 7, product* 8 * 4 * 8 * 2 * 6 * 4 * 6 * 7, index + 76462848);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 6 + 7, product* 2 * 3 * 4 * 6 * 6 * 4 * 6 * 7, index + 76466432);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 6 + 7, product* 8 * 4 * 2 * 9 * 6 * 4 * 6 * 7, index + 76469248);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 6 + 7, product* 6 * 3 * 3 * 2 * 2 * 6 * 6 * 7, index + 76622336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 6 + 7, product* 2 * 7 * 8 * 3 * 2 * 6 * 6 * 7, index + 76623872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 6 + 7, product* 2 * 3 * 4 * 6 * 2 * 6 * 6 * 7, index + 76626432);
-body<0>(stream, sum+ 8 + 6 + 9 + 7 + 2 + 6 + 6 + 7, product* 8 * 6 * 9 * 7 * 2 * 6 * 6 * 7, index + 76627968);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 6 + 7, product* 4 * 2 * 2 * 8 * 2 * 6 * 6 * 7, index + 76628224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 6 + 7, product* 2 * 3 * 8 * 2 * 3 * 6 * 6 * 7, index + 76632832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 6 + 6 + 7, product* 4 * 4 * 3 * 3 * 3 * 6 * 6 * 7, index + 76633344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 6 + 7, product* 4 * 2 * 6 * 4 * 3 * 6 * 6 * 7, index + 76634624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 6 + 7, product* 2 * 3 * 2 * 9 * 3 * 6 * 6 * 7, index + 76639232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 6 + 7, product* 2 * 7 * 2 * 2 * 6 * 6 * 6 * 7, index + 76662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 6 + 7, product* 4 * 8 * 7 * 2 * 6 * 6 * 6 * 7, index + 76662784);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 6 + 7, product* 6 * 3 * 9 * 3 * 6 * 6 * 6 * 7, index + 76663936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 6 + 7, product* 2 * 3 * 8 * 4 * 6 * 6 * 6 * 7, index + 76664832);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 6 + 7, product* 4 * 6 * 2 * 3 * 8 * 6 * 6 * 7, index + 76683264);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 6 + 6 + 7, product* 2 * 9 * 3 * 9 * 9 * 6 * 6 * 7, index + 76699392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 6 + 7, product* 2 * 3 * 4 * 2 * 2 * 7 * 6 * 7, index + 76722432);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 7 + 6 + 7, product* 4 * 8 * 7 * 6 * 2 * 7 * 6 * 7, index + 76726784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 6 + 7, product* 2 * 3 * 8 * 8 * 2 * 7 * 6 * 7, index + 76728832);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 6 + 7, product* 2 * 7 * 6 * 2 * 3 * 7 * 6 * 7, index + 76732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 6 + 7, product* 8 * 2 * 9 * 2 * 3 * 7 * 6 * 7, index + 76732928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 3 + 7 + 6 + 7, product* 4 * 6 * 4 * 4 * 3 * 7 * 6 * 7, index + 76734464);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 6 + 7, product* 4 * 2 * 4 * 3 * 4 * 7 * 6 * 7, index + 76743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 6 + 7, product* 6 * 3 * 9 * 3 * 4 * 7 * 6 * 7, index + 76743936);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 6 + 7, product* 4 * 2 * 6 * 2 * 6 * 7 * 6 * 7, index + 76762624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 6 + 7, product* 2 * 9 * 3 * 3 * 6 * 7 * 6 * 7, index + 76763392);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 7 + 6 + 7, product* 4 * 8 * 3 * 4 * 8 * 7 * 6 * 7, index + 76784384);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 6 + 7, product* 4 * 4 * 3 * 3 * 9 * 7 * 6 * 7, index + 76793344);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 6 + 7, product* 6 * 9 * 2 * 3 * 2 * 8 * 6 * 7, index + 76823296);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 8 + 6 + 7, product* 8 * 4 * 6 * 7 * 2 * 8 * 6 * 7, index + 76827648);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 8 + 6 + 7, product* 6 * 7 * 9 * 2 * 6 * 8 * 6 * 7, index + 76862976);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 6 + 7, product* 2 * 3 * 4 * 2 * 8 * 8 * 6 * 7, index + 76882432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 6 + 7, product* 4 * 2 * 6 * 2 * 2 * 9 * 6 * 7, index + 76922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 6 + 7, product* 2 * 9 * 3 * 3 * 2 * 9 * 6 * 7, index + 76923392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 2 + 9 + 6 + 7, product* 4 * 6 * 4 * 6 * 2 * 9 * 6 * 7, index + 76926464);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 9 + 6 + 7, product* 8 * 8 * 4 * 7 * 2 * 9 * 6 * 7, index + 76927488);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 6 + 7, product* 6 * 3 * 3 * 2 * 4 * 9 * 6 * 7, index + 76942336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 6 + 7, product* 4 * 8 * 3 * 4 * 4 * 9 * 6 * 7, index + 76944384);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 9 + 6 + 7, product* 2 * 3 * 8 * 4 * 8 * 9 * 6 * 7, index + 76984832);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 9 + 6 + 7, product* 2 * 3 * 6 * 7 * 9 * 9 * 6 * 7, index + 76997632);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 7 + 7, product* 4 * 2 * 4 * 3 * 2 * 2 * 7 * 7, index + 77223424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 7 + 7, product* 8 * 4 * 4 * 4 * 2 * 2 * 7 * 7, index + 77224448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 2 + 7 + 7, product* 6 * 9 * 4 * 6 * 2 * 2 * 7 * 7, index + 77226496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 7 + 7, product* 4 * 6 * 2 * 7 * 2 * 2 * 7 * 7, index + 77227264);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 7 + 7, product* 4 * 6 * 6 * 3 * 3 * 2 * 7 * 7, index + 77233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 7 + 7, product* 2 * 3 * 4 * 4 * 3 * 2 * 7 * 7, index + 77234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 7 + 7, product* 4 * 4 * 9 * 4 * 3 * 2 * 7 * 7, index + 77234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 7 + 7, product* 4 * 2 * 2 * 6 * 3 * 2 * 7 * 7, index + 77236224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 7 + 7, product* 2 * 7 * 2 * 8 * 3 * 2 * 7 * 7, index + 77238272);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 7 + 7, product* 6 * 3 * 9 * 9 * 3 * 2 * 7 * 7, index + 77239936);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 7 + 7, product* 4 * 2 * 6 * 2 * 4 * 2 * 7 * 7, index + 77242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 7 + 7, product* 2 * 9 * 3 * 3 * 4 * 2 * 7 * 7, index + 77243392);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 2 + 7 + 7, product* 4 * 8 * 3 * 4 * 6 * 2 * 7 * 7, index + 77264384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 7 + 7, product* 2 * 3 * 4 * 6 * 6 * 2 * 7 * 7, index + 77266432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 7 + 7, product* 2 * 3 * 8 * 2 * 7 * 2 * 7 * 7, index + 77272832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 7 + 7, product* 4 * 4 * 3 * 3 * 7 * 2 * 7 * 7, index + 77273344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 7 + 7, product* 4 * 2 * 6 * 4 * 7 * 2 * 7 * 7, index + 77274624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 7 + 7, product* 2 * 3 * 2 * 9 * 7 * 2 * 7 * 7, index + 77279232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 7 + 7, product* 8 * 2 * 3 * 3 * 8 * 2 * 7 * 7, index + 77283328);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 7 + 7, product* 6 * 9 * 4 * 2 * 2 * 3 * 7 * 7, index + 77322496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 7 + 7, product* 4 * 6 * 2 * 3 * 2 * 3 * 7 * 7, index + 77323264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 3 + 7 + 7, product* 8 * 8 * 2 * 4 * 2 * 3 * 7 * 7, index + 77324288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 7 + 7, product* 6 * 3 * 3 * 6 * 2 * 3 * 7 * 7, index + 77326336);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 3 + 7 + 7, product* 6 * 9 * 6 * 9 * 2 * 3 * 7 * 7, index + 77329696);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 7 + 7, product* 4 * 2 * 2 * 2 * 3 * 3 * 7 * 7, index + 77332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 7 + 7, product* 6 * 3 * 7 * 2 * 3 * 3 * 7 * 7, index + 77332736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 7 + 7, product* 8 * 4 * 2 * 3 * 3 * 3 * 7 * 7, index + 77333248);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3 + 7 + 7, product* 4 * 6 * 6 * 7 * 3 * 3 * 7 * 7, index + 77337664);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 7 + 7, product* 4 * 2 * 6 * 8 * 3 * 3 * 7 * 7, index + 77338624);
-body<0>(stream, sum+ 8 + 4 + 6 + 9 + 3 + 3 + 7 + 7, product* 8 * 4 * 6 * 9 * 3 * 3 * 7 * 7, index + 77339648);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 7 + 7, product* 2 * 3 * 2 * 3 * 4 * 3 * 7 * 7, index + 77343232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 7 + 7, product* 4 * 4 * 7 * 3 * 4 * 3 * 7 * 7, index + 77343744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 7 + 7, product* 8 * 2 * 3 * 7 * 4 * 3 * 7 * 7, index + 77347328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 7 + 7, product* 2 * 3 * 6 * 9 * 4 * 3 * 7 * 7, index + 77349632);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 3 + 7 + 7, product* 4 * 4 * 9 * 2 * 6 * 3 * 7 * 7, index + 77362944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 7 + 7, product* 4 * 2 * 2 * 4 * 6 * 3 * 7 * 7, index + 77364224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3 + 7 + 7, product* 2 * 7 * 2 * 6 * 6 * 3 * 7 * 7, index + 77366272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 6 + 3 + 7 + 7, product* 4 * 4 * 3 * 9 * 6 * 3 * 7 * 7, index + 77369344);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3 + 7 + 7, product* 8 * 2 * 9 * 2 * 7 * 3 * 7 * 7, index + 77372928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 3 + 7 + 7, product* 4 * 6 * 4 * 4 * 7 * 3 * 7 * 7, index + 77374464);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 7 + 7, product* 2 * 3 * 4 * 4 * 9 * 3 * 7 * 7, index + 77394432);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 7 + 7, product* 2 * 3 * 4 * 6 * 2 * 4 * 7 * 7, index + 77426432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 7 + 7, product* 4 * 2 * 2 * 8 * 2 * 4 * 7 * 7, index + 77428224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 4 + 7 + 7, product* 2 * 3 * 8 * 2 * 3 * 4 * 7 * 7, index + 77432832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 7 + 7, product* 4 * 4 * 3 * 3 * 3 * 4 * 7 * 7, index + 77433344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4 + 7 + 7, product* 8 * 6 * 3 * 4 * 3 * 4 * 7 * 7, index + 77434368);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 7 + 7, product* 4 * 2 * 4 * 7 * 4 * 4 * 7 * 7, index + 77447424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 7 + 7, product* 2 * 7 * 2 * 2 * 6 * 4 * 7 * 7, index + 77462272);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 4 + 7 + 7, product* 2 * 7 * 6 * 8 * 6 * 4 * 7 * 7, index + 77468672);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 4 + 7 + 7, product* 6 * 3 * 3 * 6 * 8 * 4 * 7 * 7, index + 77486336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 7 + 7, product* 4 * 2 * 2 * 2 * 9 * 4 * 7 * 7, index + 77492224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 7 + 7, product* 2 * 7 * 2 * 2 * 2 * 6 * 7 * 7, index + 77622272);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 7 + 7, product* 6 * 3 * 3 * 6 * 4 * 6 * 7 * 7, index + 77646336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 7 + 7, product* 4 * 6 * 4 * 2 * 6 * 6 * 7 * 7, index + 77662464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 7 + 7, product* 2 * 3 * 2 * 3 * 6 * 6 * 7 * 7, index + 77663232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 7 + 7, product* 2 * 3 * 4 * 2 * 8 * 6 * 7 * 7, index + 77682432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 7 + 7, product* 4 * 2 * 6 * 2 * 2 * 7 * 7 * 7, index + 77722624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 7 + 7, product* 2 * 3 * 2 * 7 * 2 * 7 * 7 * 7, index + 77727232);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 7 + 7 + 7, product* 6 * 7 * 3 * 3 * 3 * 7 * 7 * 7, index + 77733376);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 3 + 7 + 7 + 7, product* 2 * 9 * 3 * 9 * 3 * 7 * 7 * 7, index + 77739392);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 7 + 7 + 7, product* 8 * 4 * 8 * 2 * 4 * 7 * 7 * 7, index + 77742848);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 7 + 7 + 7, product* 4 * 8 * 3 * 6 * 7 * 7 * 7 * 7, index + 77776384);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 7 + 7 + 7, product* 2 * 7 * 2 * 2 * 8 * 7 * 7 * 7, index + 77782272);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 7 + 7, product* 2 * 3 * 2 * 3 * 2 * 8 * 7 * 7, index + 77823232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 8 + 7 + 7, product* 2 * 3 * 6 * 9 * 2 * 8 * 7 * 7, index + 77829632);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 8 + 7 + 7, product* 4 * 2 * 8 * 7 * 3 * 8 * 7 * 7, index + 77837824);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 8 + 7 + 7, product* 6 * 3 * 7 * 4 * 4 * 8 * 7 * 7, index + 77844736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 7 + 7, product* 2 * 7 * 2 * 6 * 4 * 8 * 7 * 7, index + 77846272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 7 + 7, product* 4 * 2 * 4 * 3 * 6 * 8 * 7 * 7, index + 77863424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 8 + 7 + 7, product* 4 * 6 * 2 * 7 * 6 * 8 * 7 * 7, index + 77867264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 7 + 7, product* 8 * 2 * 3 * 3 * 2 * 9 * 7 * 7, index + 77923328);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 9 + 7 + 7, product* 2 * 7 * 4 * 9 * 2 * 9 * 7 * 7, index + 77929472);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 9 + 7 + 7, product* 4 * 4 * 9 * 8 * 3 * 9 * 7 * 7, index + 77938944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 7 + 7, product* 2 * 7 * 2 * 2 * 4 * 9 * 7 * 7, index + 77942272);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 9 + 7 + 7, product* 2 * 9 * 9 * 2 * 7 * 9 * 7 * 7, index + 77972992);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 9 + 7 + 7, product* 2 * 7 * 4 * 3 * 9 * 9 * 7 * 7, index + 77993472);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 8 + 7, product* 6 * 3 * 3 * 2 * 2 * 2 * 8 * 7, index + 78222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 8 + 7, product* 8 * 4 * 8 * 2 * 2 * 2 * 8 * 7, index + 78222848);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 8 + 7, product* 2 * 3 * 4 * 6 * 2 * 2 * 8 * 7, index + 78226432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 8 + 7, product* 4 * 2 * 6 * 4 * 3 * 2 * 8 * 7, index + 78234624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 8 + 7, product* 2 * 3 * 2 * 9 * 3 * 2 * 8 * 7, index + 78239232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 8 + 7, product* 8 * 2 * 3 * 3 * 4 * 2 * 8 * 7, index + 78243328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 4 + 2 + 8 + 7, product* 4 * 6 * 8 * 4 * 4 * 2 * 8 * 7, index + 78244864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 8 + 7, product* 4 * 2 * 4 * 7 * 4 * 2 * 8 * 7, index + 78247424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 8 + 7, product* 2 * 7 * 2 * 2 * 6 * 2 * 8 * 7, index + 78262272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 8 + 7, product* 6 * 9 * 2 * 3 * 6 * 2 * 8 * 7, index + 78263296);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 8 + 7, product* 4 * 2 * 6 * 6 * 6 * 2 * 8 * 7, index + 78266624);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 8 + 7, product* 8 * 4 * 6 * 7 * 6 * 2 * 8 * 7, index + 78267648);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 8 + 7, product* 4 * 6 * 2 * 3 * 8 * 2 * 8 * 7, index + 78283264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 8 + 7, product* 4 * 2 * 2 * 2 * 9 * 2 * 8 * 7, index + 78292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 8 + 7, product* 6 * 3 * 7 * 2 * 9 * 2 * 8 * 7, index + 78292736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 8 + 7, product* 8 * 4 * 2 * 3 * 9 * 2 * 8 * 7, index + 78293248);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 2 + 8 + 7, product* 4 * 2 * 6 * 8 * 9 * 2 * 8 * 7, index + 78298624);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 8 + 7, product* 2 * 3 * 4 * 2 * 2 * 3 * 8 * 7, index + 78322432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 3 + 8 + 7, product* 4 * 4 * 9 * 2 * 2 * 3 * 8 * 7, index + 78322944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3 + 8 + 7, product* 8 * 6 * 9 * 3 * 2 * 3 * 8 * 7, index + 78323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 8 + 7, product* 4 * 2 * 2 * 4 * 2 * 3 * 8 * 7, index + 78324224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 8 + 7, product* 2 * 7 * 2 * 6 * 2 * 3 * 8 * 7, index + 78326272);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 3 + 8 + 7, product* 6 * 3 * 9 * 3 * 4 * 3 * 8 * 7, index + 78343936);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 8 + 7, product* 4 * 2 * 6 * 2 * 6 * 3 * 8 * 7, index + 78362624);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 8 + 7, product* 6 * 3 * 3 * 2 * 8 * 3 * 8 * 7, index + 78382336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 8 + 7, product* 2 * 3 * 4 * 6 * 8 * 3 * 8 * 7, index + 78386432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 8 + 7, product* 4 * 2 * 2 * 8 * 8 * 3 * 8 * 7, index + 78388224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 8 + 7, product* 2 * 3 * 8 * 2 * 9 * 3 * 8 * 7, index + 78392832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 8 + 7, product* 2 * 3 * 2 * 9 * 9 * 3 * 8 * 7, index + 78399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 8 + 7, product* 2 * 7 * 2 * 2 * 2 * 4 * 8 * 7, index + 78422272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 4 + 8 + 7, product* 4 * 2 * 6 * 6 * 2 * 4 * 8 * 7, index + 78426624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 8 + 7, product* 2 * 9 * 3 * 7 * 2 * 4 * 8 * 7, index + 78427392);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 8 + 7, product* 2 * 9 * 7 * 3 * 3 * 4 * 8 * 7, index + 78433792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 8 + 7, product* 4 * 6 * 8 * 6 * 3 * 4 * 8 * 7, index + 78436864);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 4 + 8 + 7, product* 4 * 2 * 4 * 9 * 3 * 4 * 8 * 7, index + 78439424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 4 + 8 + 7, product* 4 * 6 * 4 * 2 * 6 * 4 * 8 * 7, index + 78462464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 8 + 7, product* 2 * 3 * 2 * 3 * 6 * 4 * 8 * 7, index + 78463232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 8 + 7, product* 2 * 3 * 4 * 2 * 8 * 4 * 8 * 7, index + 78482432);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 8 + 7, product* 2 * 7 * 2 * 6 * 8 * 4 * 8 * 7, index + 78486272);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 8 + 7, product* 2 * 3 * 2 * 3 * 2 * 6 * 8 * 7, index + 78623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 8 + 7, product* 4 * 4 * 7 * 3 * 2 * 6 * 8 * 7, index + 78623744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 8 + 7, product* 8 * 2 * 3 * 7 * 2 * 6 * 8 * 7, index + 78627328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 8 + 7, product* 8 * 4 * 4 * 2 * 3 * 6 * 8 * 7, index + 78632448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 8 + 7, product* 2 * 7 * 4 * 3 * 3 * 6 * 8 * 7, index + 78633472);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 8 + 7, product* 4 * 2 * 2 * 4 * 4 * 6 * 8 * 7, index + 78644224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 6 + 8 + 7, product* 6 * 3 * 7 * 4 * 4 * 6 * 8 * 7, index + 78644736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 8 + 7, product* 2 * 7 * 2 * 6 * 4 * 6 * 8 * 7, index + 78646272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 8 + 7, product* 4 * 2 * 4 * 3 * 6 * 6 * 8 * 7, index + 78663424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 6 + 6 + 8 + 7, product* 6 * 3 * 9 * 3 * 6 * 6 * 8 * 7, index + 78663936);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 8 + 7, product* 2 * 3 * 4 * 4 * 7 * 6 * 8 * 7, index + 78674432);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 8 + 7, product* 8 * 2 * 3 * 3 * 2 * 7 * 8 * 7, index + 78723328);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 8 + 7, product* 4 * 2 * 8 * 3 * 3 * 7 * 8 * 7, index + 78733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 8 + 7, product* 6 * 3 * 3 * 4 * 3 * 7 * 8 * 7, index + 78734336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 8 + 7, product* 2 * 3 * 4 * 8 * 3 * 7 * 8 * 7, index + 78738432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 8 + 7, product* 2 * 7 * 2 * 2 * 4 * 7 * 8 * 7, index + 78742272);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 7 + 8 + 7, product* 2 * 9 * 3 * 7 * 4 * 7 * 8 * 7, index + 78747392);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 8 + 7, product* 6 * 3 * 3 * 6 * 6 * 7 * 8 * 7, index + 78766336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 8 + 7, product* 4 * 2 * 2 * 2 * 7 * 7 * 8 * 7, index + 78772224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 7 + 8 + 7, product* 8 * 4 * 2 * 3 * 7 * 7 * 8 * 7, index + 78773248);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 7 + 7 + 8 + 7, product* 2 * 3 * 8 * 6 * 7 * 7 * 8 * 7, index + 78776832);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 7 + 8 + 7, product* 6 * 9 * 4 * 4 * 9 * 7 * 8 * 7, index + 78794496);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 8 + 7, product* 4 * 2 * 4 * 3 * 2 * 8 * 8 * 7, index + 78823424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 8 + 8 + 7, product* 6 * 3 * 9 * 3 * 2 * 8 * 8 * 7, index + 78823936);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 8 + 7, product* 4 * 8 * 3 * 2 * 3 * 8 * 8 * 7, index + 78832384);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 8 + 7, product* 4 * 2 * 2 * 6 * 3 * 8 * 8 * 7, index + 78836224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 8 + 7, product* 2 * 7 * 2 * 8 * 3 * 8 * 8 * 7, index + 78838272);
-body<0>(stream, sum+ 6 + 9 + 2 + 9 + 3 + 8 + 8 + 7, product* 6 * 9 * 2 * 9 * 3 * 8 * 8 * 7, index + 78839296);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 8 + 7, product* 2 * 3 * 4 * 6 * 6 * 8 * 8 * 7, index + 78866432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 8 + 8 + 7, product* 2 * 3 * 8 * 2 * 7 * 8 * 8 * 7, index + 78872832);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 8 + 7, product* 4 * 2 * 2 * 2 * 3 * 9 * 8 * 7, index + 78932224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 8 + 7, product* 2 * 9 * 9 * 2 * 3 * 9 * 8 * 7, index + 78932992);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 8 + 7, product* 2 * 3 * 2 * 3 * 4 * 9 * 8 * 7, index + 78943232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 8 + 7, product* 2 * 3 * 4 * 2 * 6 * 9 * 8 * 7, index + 78962432);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 9 + 8 + 7, product* 4 * 2 * 4 * 3 * 8 * 9 * 8 * 7, index + 78983424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 9 + 7, product* 2 * 7 * 2 * 2 * 2 * 2 * 9 * 7, index + 79222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 9 + 7, product* 4 * 8 * 7 * 2 * 2 * 2 * 9 * 7, index + 79222784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 2 + 9 + 7, product* 6 * 9 * 2 * 3 * 2 * 2 * 9 * 7, index + 79223296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 9 + 7, product* 2 * 3 * 8 * 4 * 2 * 2 * 9 * 7, index + 79224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 9 + 7, product* 8 * 6 * 3 * 6 * 2 * 2 * 9 * 7, index + 79226368);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 9 + 7, product* 2 * 9 * 3 * 7 * 2 * 2 * 9 * 7, index + 79227392);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 9 + 7, product* 6 * 7 * 7 * 3 * 4 * 2 * 9 * 7, index + 79243776);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 9 + 7, product* 8 * 8 * 2 * 4 * 4 * 2 * 9 * 7, index + 79244288);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 9 + 7, product* 4 * 6 * 4 * 2 * 6 * 2 * 9 * 7, index + 79262464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 9 + 7, product* 2 * 3 * 2 * 3 * 6 * 2 * 9 * 7, index + 79263232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 9 + 7, product* 8 * 4 * 4 * 2 * 7 * 2 * 9 * 7, index + 79272448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 9 + 7, product* 2 * 7 * 4 * 3 * 7 * 2 * 9 * 7, index + 79273472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 7 + 2 + 9 + 7, product* 4 * 8 * 9 * 3 * 7 * 2 * 9 * 7, index + 79273984);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 9 + 7, product* 2 * 3 * 4 * 2 * 8 * 2 * 9 * 7, index + 79282432);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 8 + 2 + 9 + 7, product* 2 * 3 * 8 * 8 * 8 * 2 * 9 * 7, index + 79288832);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 9 + 7, product* 8 * 6 * 3 * 2 * 2 * 3 * 9 * 7, index + 79322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 9 + 7, product* 4 * 2 * 6 * 2 * 2 * 3 * 9 * 7, index + 79322624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 9 + 7, product* 8 * 4 * 6 * 3 * 2 * 3 * 9 * 7, index + 79323648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 9 + 7, product* 2 * 3 * 2 * 7 * 2 * 3 * 9 * 7, index + 79327232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 2 + 3 + 9 + 7, product* 8 * 8 * 4 * 7 * 2 * 3 * 9 * 7, index + 79327488);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 2 + 3 + 9 + 7, product* 8 * 6 * 7 * 8 * 2 * 3 * 9 * 7, index + 79328768);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 9 + 7, product* 4 * 6 * 8 * 2 * 3 * 3 * 9 * 7, index + 79332864);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 9 + 7, product* 6 * 3 * 3 * 2 * 4 * 3 * 9 * 7, index + 79342336);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 3 + 9 + 7, product* 8 * 4 * 2 * 9 * 4 * 3 * 9 * 7, index + 79349248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 3 + 9 + 7, product* 2 * 3 * 6 * 3 * 7 * 3 * 9 * 7, index + 79373632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 9 + 7, product* 4 * 2 * 4 * 9 * 9 * 3 * 9 * 7, index + 79399424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 9 + 7, product* 4 * 6 * 4 * 2 * 2 * 4 * 9 * 7, index + 79422464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 9 + 7, product* 2 * 3 * 2 * 3 * 2 * 4 * 9 * 7, index + 79423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 9 + 7, product* 8 * 8 * 4 * 3 * 2 * 4 * 9 * 7, index + 79423488);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 9 + 7, product* 8 * 2 * 3 * 7 * 2 * 4 * 9 * 7, index + 79427328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 9 + 7, product* 2 * 3 * 4 * 2 * 4 * 4 * 9 * 7, index + 79442432);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 9 + 7, product* 4 * 2 * 4 * 3 * 6 * 4 * 9 * 7, index + 79463424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 9 + 7, product* 4 * 8 * 3 * 2 * 7 * 4 * 9 * 7, index + 79472384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 9 + 7, product* 2 * 3 * 4 * 4 * 7 * 4 * 9 * 7, index + 79474432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 9 + 7, product* 4 * 2 * 2 * 6 * 7 * 4 * 9 * 7, index + 79476224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 4 + 9 + 7, product* 6 * 3 * 7 * 6 * 7 * 4 * 9 * 7, index + 79476736);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 4 + 9 + 7, product* 8 * 6 * 3 * 2 * 8 * 4 * 9 * 7, index + 79482368);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 4 + 9 + 7, product* 4 * 6 * 4 * 6 * 8 * 4 * 9 * 7, index + 79486464);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 4 + 9 + 7, product* 2 * 3 * 6 * 3 * 9 * 4 * 9 * 7, index + 79493632);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 9 + 7, product* 4 * 2 * 4 * 3 * 2 * 6 * 9 * 7, index + 79623424);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 2 + 6 + 9 + 7, product* 6 * 7 * 7 * 7 * 2 * 6 * 9 * 7, index + 79627776);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 9 + 7, product* 4 * 8 * 3 * 2 * 3 * 6 * 9 * 7, index + 79632384);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 9 + 7, product* 4 * 2 * 6 * 2 * 4 * 6 * 9 * 7, index + 79642624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 9 + 7, product* 2 * 3 * 2 * 3 * 6 * 6 * 9 * 7, index + 79663232);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 6 + 9 + 7, product* 2 * 3 * 8 * 2 * 7 * 6 * 9 * 7, index + 79672832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 9 + 7, product* 4 * 2 * 6 * 4 * 7 * 6 * 9 * 7, index + 79674624);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 7 + 9 + 7, product* 6 * 9 * 4 * 2 * 2 * 7 * 9 * 7, index + 79722496);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 9 + 7, product* 4 * 2 * 2 * 2 * 3 * 7 * 9 * 7, index + 79732224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 9 + 7, product* 8 * 4 * 2 * 3 * 3 * 7 * 9 * 7, index + 79733248);
-body<0>(stream, sum+ 8 + 6 + 3 + 8 + 3 + 7 + 9 + 7, product* 8 * 6 * 3 * 8 * 3 * 7 * 9 * 7, index + 79738368);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 9 + 7, product* 4 * 6 * 4 * 2 * 4 * 7 * 9 * 7, index + 79742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 9 + 7, product* 2 * 3 * 2 * 3 * 4 * 7 * 9 * 7, index + 79743232);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 7 + 9 + 7, product* 4 * 4 * 9 * 2 * 6 * 7 * 9 * 7, index + 79762944);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 7 + 7 + 9 + 7, product* 6 * 3 * 9 * 9 * 7 * 7 * 9 * 7, index + 79779936);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 8 + 9 + 7, product* 6 * 9 * 8 * 4 * 2 * 8 * 9 * 7, index + 79824896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 9 + 7, product* 2 * 3 * 4 * 6 * 2 * 8 * 9 * 7, index + 79826432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 9 + 7, product* 4 * 2 * 6 * 4 * 3 * 8 * 9 * 7, index + 79834624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 9 + 7, product* 2 * 3 * 2 * 9 * 3 * 8 * 9 * 7, index + 79839232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 9 + 7, product* 2 * 7 * 2 * 2 * 6 * 8 * 9 * 7, index + 79862272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 8 + 9 + 7, product* 2 * 3 * 8 * 4 * 6 * 8 * 9 * 7, index + 79864832);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 9 + 7, product* 4 * 2 * 2 * 2 * 9 * 8 * 9 * 7, index + 79892224);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 9 + 7, product* 2 * 3 * 4 * 2 * 2 * 9 * 9 * 7, index + 79922432);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 9 + 9 + 7, product* 2 * 7 * 6 * 2 * 3 * 9 * 9 * 7, index + 79932672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 9 + 7, product* 2 * 3 * 2 * 7 * 6 * 9 * 9 * 7, index + 79967232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 2 + 8, product* 6 * 3 * 3 * 2 * 2 * 2 * 2 * 8, index + 82222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 2 + 8, product* 8 * 4 * 8 * 2 * 2 * 2 * 2 * 8, index + 82222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 2 + 8, product* 2 * 7 * 8 * 3 * 2 * 2 * 2 * 8, index + 82223872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 2 + 8, product* 2 * 3 * 4 * 6 * 2 * 2 * 2 * 8, index + 82226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 2 + 8, product* 4 * 4 * 9 * 6 * 2 * 2 * 2 * 8, index + 82226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 2 + 8, product* 4 * 2 * 2 * 8 * 2 * 2 * 2 * 8, index + 82228224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 2 + 2 + 2 + 8, product* 6 * 3 * 7 * 8 * 2 * 2 * 2 * 8, index + 82228736);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 2 + 8, product* 2 * 9 * 9 * 8 * 2 * 2 * 2 * 8, index + 82228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 2 + 8, product* 8 * 4 * 2 * 9 * 2 * 2 * 2 * 8, index + 82229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 2 + 8, product* 2 * 3 * 8 * 2 * 3 * 2 * 2 * 8, index + 82232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 2 + 8, product* 4 * 4 * 3 * 3 * 3 * 2 * 2 * 8, index + 82233344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 2 + 8, product* 4 * 2 * 6 * 4 * 3 * 2 * 2 * 8, index + 82234624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 2 + 8, product* 2 * 7 * 6 * 6 * 3 * 2 * 2 * 8, index + 82236672);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 2 + 2 + 8, product* 8 * 2 * 9 * 6 * 3 * 2 * 2 * 8, index + 82236928);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 2 + 2 + 8, product* 4 * 6 * 4 * 8 * 3 * 2 * 2 * 8, index + 82238464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 3 + 2 + 2 + 8, product* 6 * 7 * 9 * 8 * 3 * 2 * 2 * 8, index + 82238976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 2 + 8, product* 2 * 3 * 2 * 9 * 3 * 2 * 2 * 8, index + 82239232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 2 + 8, product* 8 * 2 * 3 * 3 * 4 * 2 * 2 * 8, index + 82243328);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 4 + 2 + 2 + 8, product* 6 * 3 * 9 * 7 * 4 * 2 * 2 * 8, index + 82247936);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 2 + 8, product* 2 * 7 * 2 * 2 * 6 * 2 * 2 * 8, index + 82262272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 2 + 2 + 8, product* 6 * 9 * 2 * 3 * 6 * 2 * 2 * 8, index + 82263296);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 2 + 8, product* 4 * 2 * 6 * 6 * 6 * 2 * 2 * 8, index + 82266624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 2 + 2 + 8, product* 2 * 9 * 3 * 7 * 6 * 2 * 2 * 8, index + 82267392);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 2 + 8, product* 2 * 9 * 7 * 3 * 7 * 2 * 2 * 8, index + 82273792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 7 + 2 + 2 + 8, product* 4 * 6 * 8 * 6 * 7 * 2 * 2 * 8, index + 82276864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 2 + 8, product* 2 * 3 * 6 * 7 * 7 * 2 * 2 * 8, index + 82277632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 2 + 2 + 8, product* 4 * 2 * 4 * 9 * 7 * 2 * 2 * 8, index + 82279424);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 2 + 8, product* 4 * 6 * 2 * 3 * 8 * 2 * 2 * 8, index + 82283264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 8 + 2 + 2 + 8, product* 6 * 3 * 3 * 6 * 8 * 2 * 2 * 8, index + 82286336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 2 + 8, product* 4 * 2 * 2 * 2 * 9 * 2 * 2 * 8, index + 82292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 2 + 8, product* 6 * 3 * 7 * 2 * 9 * 2 * 2 * 8, index + 82292736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 2 + 2 + 8, product* 2 * 9 * 9 * 2 * 9 * 2 * 2 * 8, index + 82292992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 2 + 8, product* 8 * 4 * 2 * 3 * 9 * 2 * 2 * 8, index + 82293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 2 + 8, product* 2 * 7 * 2 * 4 * 9 * 2 * 2 * 8, index + 82294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 2 + 8, product* 4 * 8 * 7 * 4 * 9 * 2 * 2 * 8, index + 82294784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 2 + 8, product* 2 * 3 * 8 * 6 * 9 * 2 * 2 * 8, index + 82296832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 2 + 8, product* 2 * 9 * 3 * 9 * 9 * 2 * 2 * 8, index + 82299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 2 + 8, product* 2 * 3 * 4 * 2 * 2 * 3 * 2 * 8, index + 82322432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 2 + 8, product* 4 * 2 * 2 * 4 * 2 * 3 * 2 * 8, index + 82324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 2 + 8, product* 6 * 3 * 7 * 4 * 2 * 3 * 2 * 8, index + 82324736);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 2 + 8, product* 4 * 8 * 7 * 6 * 2 * 3 * 2 * 8, index + 82326784);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 2 + 8, product* 6 * 9 * 2 * 7 * 2 * 3 * 2 * 8, index + 82327296);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 2 + 8, product* 2 * 3 * 8 * 8 * 2 * 3 * 2 * 8, index + 82328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 2 + 8, product* 4 * 4 * 3 * 9 * 2 * 3 * 2 * 8, index + 82329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 2 + 8, product* 2 * 7 * 6 * 2 * 3 * 3 * 2 * 8, index + 82332672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 2 + 8, product* 8 * 2 * 9 * 2 * 3 * 3 * 2 * 8, index + 82332928);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 3 + 3 + 2 + 8, product* 2 * 9 * 7 * 7 * 3 * 3 * 2 * 8, index + 82337792);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 3 + 2 + 8, product* 8 * 2 * 3 * 9 * 3 * 3 * 2 * 8, index + 82339328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 2 + 8, product* 4 * 2 * 4 * 3 * 4 * 3 * 2 * 8, index + 82343424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 3 + 2 + 8, product* 4 * 6 * 2 * 7 * 4 * 3 * 2 * 8, index + 82347264);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 2 + 8, product* 4 * 2 * 6 * 2 * 6 * 3 * 2 * 8, index + 82362624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 6 + 3 + 2 + 8, product* 8 * 4 * 6 * 3 * 6 * 3 * 2 * 8, index + 82363648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 2 + 8, product* 2 * 7 * 6 * 4 * 6 * 3 * 2 * 8, index + 82364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 2 + 8, product* 8 * 2 * 9 * 4 * 6 * 3 * 2 * 8, index + 82364928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 2 + 8, product* 2 * 3 * 2 * 7 * 6 * 3 * 2 * 8, index + 82367232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 6 + 3 + 2 + 8, product* 4 * 4 * 7 * 7 * 6 * 3 * 2 * 8, index + 82367744);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 7 + 3 + 2 + 8, product* 4 * 6 * 2 * 9 * 7 * 3 * 2 * 8, index + 82379264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 2 + 8, product* 6 * 3 * 3 * 2 * 8 * 3 * 2 * 8, index + 82382336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 8 + 3 + 2 + 8, product* 8 * 4 * 8 * 2 * 8 * 3 * 2 * 8, index + 82382848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 8 + 3 + 2 + 8, product* 2 * 7 * 8 * 3 * 8 * 3 * 2 * 8, index + 82383872);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 3 + 2 + 8, product* 4 * 4 * 9 * 6 * 8 * 3 * 2 * 8, index + 82386944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 2 + 8, product* 4 * 2 * 2 * 8 * 8 * 3 * 2 * 8, index + 82388224);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 9 + 3 + 2 + 8, product* 2 * 7 * 6 * 6 * 9 * 3 * 2 * 8, index + 82396672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 2 + 8, product* 2 * 3 * 2 * 9 * 9 * 3 * 2 * 8, index + 82399232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 3 + 2 + 8, product* 4 * 4 * 7 * 9 * 9 * 3 * 2 * 8, index + 82399744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 2 + 8, product* 2 * 7 * 2 * 2 * 2 * 4 * 2 * 8, index + 82422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 2 + 8, product* 4 * 8 * 7 * 2 * 2 * 4 * 2 * 8, index + 82422784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 2 + 8, product* 2 * 3 * 8 * 4 * 2 * 4 * 2 * 8, index + 82424832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 4 + 2 + 8, product* 8 * 6 * 3 * 6 * 2 * 4 * 2 * 8, index + 82426368);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 2 + 8, product* 2 * 9 * 3 * 7 * 2 * 4 * 2 * 8, index + 82427392);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 4 + 2 + 8, product* 8 * 2 * 9 * 8 * 2 * 4 * 2 * 8, index + 82428928);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 2 + 8, product* 2 * 9 * 7 * 3 * 3 * 4 * 2 * 8, index + 82433792);
-body<0>(stream, sum+ 4 + 6 + 8 + 6 + 3 + 4 + 2 + 8, product* 4 * 6 * 8 * 6 * 3 * 4 * 2 * 8, index + 82436864);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 2 + 8, product* 2 * 3 * 6 * 7 * 3 * 4 * 2 * 8, index + 82437632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 2 + 8, product* 4 * 6 * 2 * 3 * 4 * 4 * 2 * 8, index + 82443264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 4 + 2 + 8, product* 6 * 7 * 7 * 3 * 4 * 4 * 2 * 8, index + 82443776);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 2 + 8, product* 2 * 3 * 2 * 3 * 6 * 4 * 2 * 8, index + 82463232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 4 + 2 + 8, product* 4 * 4 * 7 * 3 * 6 * 4 * 2 * 8, index + 82463744);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 6 + 4 + 2 + 8, product* 4 * 6 * 8 * 8 * 6 * 4 * 2 * 8, index + 82468864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 2 + 8, product* 2 * 3 * 6 * 9 * 6 * 4 * 2 * 8, index + 82469632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 4 + 2 + 8, product* 8 * 4 * 4 * 2 * 7 * 4 * 2 * 8, index + 82472448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 4 + 2 + 8, product* 2 * 7 * 4 * 3 * 7 * 4 * 2 * 8, index + 82473472);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 4 + 2 + 8, product* 4 * 2 * 8 * 7 * 7 * 4 * 2 * 8, index + 82477824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 4 + 2 + 8, product* 6 * 3 * 3 * 8 * 7 * 4 * 2 * 8, index + 82478336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 4 + 2 + 8, product* 2 * 3 * 4 * 2 * 8 * 4 * 2 * 8, index + 82482432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 8 + 4 + 2 + 8, product* 8 * 8 * 6 * 2 * 8 * 4 * 2 * 8, index + 82482688);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 8 + 4 + 2 + 8, product* 8 * 6 * 9 * 3 * 8 * 4 * 2 * 8, index + 82483968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 2 + 8, product* 4 * 2 * 2 * 4 * 8 * 4 * 2 * 8, index + 82484224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 8 + 4 + 2 + 8, product* 6 * 3 * 7 * 4 * 8 * 4 * 2 * 8, index + 82484736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 4 + 2 + 8, product* 2 * 7 * 2 * 6 * 8 * 4 * 2 * 8, index + 82486272);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 4 + 2 + 8, product* 2 * 7 * 6 * 2 * 9 * 4 * 2 * 8, index + 82492672);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 2 + 8, product* 4 * 6 * 4 * 2 * 2 * 6 * 2 * 8, index + 82622464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 2 + 8, product* 2 * 3 * 2 * 3 * 2 * 6 * 2 * 8, index + 82623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 2 + 8, product* 4 * 4 * 7 * 3 * 2 * 6 * 2 * 8, index + 82623744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 6 + 2 + 8, product* 8 * 2 * 3 * 7 * 2 * 6 * 2 * 8, index + 82627328);
-body<0>(stream, sum+ 6 + 7 + 3 + 9 + 2 + 6 + 2 + 8, product* 6 * 7 * 3 * 9 * 2 * 6 * 2 * 8, index + 82629376);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 6 + 2 + 8, product* 2 * 3 * 6 * 9 * 2 * 6 * 2 * 8, index + 82629632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 2 + 8, product* 8 * 4 * 4 * 2 * 3 * 6 * 2 * 8, index + 82632448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 2 + 8, product* 2 * 7 * 4 * 3 * 3 * 6 * 2 * 8, index + 82633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 2 + 8, product* 8 * 2 * 7 * 3 * 3 * 6 * 2 * 8, index + 82633728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 2 + 8, product* 4 * 2 * 8 * 7 * 3 * 6 * 2 * 8, index + 82637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 2 + 8, product* 6 * 3 * 3 * 8 * 3 * 6 * 2 * 8, index + 82638336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 2 + 8, product* 2 * 3 * 4 * 2 * 4 * 6 * 2 * 8, index + 82642432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 6 + 2 + 8, product* 8 * 8 * 6 * 2 * 4 * 6 * 2 * 8, index + 82642688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 2 + 8, product* 4 * 4 * 9 * 2 * 4 * 6 * 2 * 8, index + 82642944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 2 + 8, product* 4 * 2 * 2 * 4 * 4 * 6 * 2 * 8, index + 82644224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 2 + 8, product* 4 * 2 * 4 * 3 * 6 * 6 * 2 * 8, index + 82663424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 2 + 8, product* 4 * 8 * 3 * 2 * 7 * 6 * 2 * 8, index + 82672384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 6 + 2 + 8, product* 4 * 6 * 6 * 3 * 7 * 6 * 2 * 8, index + 82673664);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 2 + 8, product* 4 * 2 * 2 * 6 * 7 * 6 * 2 * 8, index + 82676224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 6 + 2 + 8, product* 2 * 7 * 2 * 8 * 7 * 6 * 2 * 8, index + 82678272);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 6 + 2 + 8, product* 2 * 9 * 3 * 3 * 8 * 6 * 2 * 8, index + 82683392);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 2 + 8, product* 2 * 3 * 6 * 3 * 9 * 6 * 2 * 8, index + 82693632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 6 + 2 + 8, product* 2 * 7 * 4 * 7 * 9 * 6 * 2 * 8, index + 82697472);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 9 + 6 + 2 + 8, product* 8 * 2 * 7 * 7 * 9 * 6 * 2 * 8, index + 82697728);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 2 + 8, product* 8 * 2 * 3 * 3 * 2 * 7 * 2 * 8, index + 82723328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 2 + 8, product* 4 * 2 * 4 * 7 * 2 * 7 * 2 * 8, index + 82727424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 7 + 2 + 8, product* 4 * 2 * 8 * 3 * 3 * 7 * 2 * 8, index + 82733824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 2 + 8, product* 6 * 3 * 3 * 4 * 3 * 7 * 2 * 8, index + 82734336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 2 + 8, product* 2 * 3 * 4 * 8 * 3 * 7 * 2 * 8, index + 82738432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 2 + 8, product* 2 * 7 * 2 * 2 * 4 * 7 * 2 * 8, index + 82742272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 2 + 8, product* 2 * 3 * 8 * 4 * 4 * 7 * 2 * 8, index + 82744832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 4 + 7 + 2 + 8, product* 2 * 7 * 6 * 8 * 4 * 7 * 2 * 8, index + 82748672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 4 + 7 + 2 + 8, product* 8 * 2 * 9 * 8 * 4 * 7 * 2 * 8, index + 82748928);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 2 + 8, product* 4 * 6 * 2 * 3 * 6 * 7 * 2 * 8, index + 82763264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 7 + 2 + 8, product* 6 * 3 * 3 * 6 * 6 * 7 * 2 * 8, index + 82766336);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 6 + 7 + 2 + 8, product* 4 * 6 * 6 * 9 * 6 * 7 * 2 * 8, index + 82769664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 2 + 8, product* 4 * 2 * 2 * 2 * 7 * 7 * 2 * 8, index + 82772224);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 7 + 2 + 8, product* 4 * 6 * 4 * 2 * 8 * 7 * 2 * 8, index + 82782464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 2 + 8, product* 2 * 3 * 2 * 3 * 8 * 7 * 2 * 8, index + 82783232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 2 + 8, product* 8 * 2 * 3 * 7 * 8 * 7 * 2 * 8, index + 82787328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 7 + 2 + 8, product* 8 * 4 * 4 * 2 * 9 * 7 * 2 * 8, index + 82792448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 7 + 2 + 8, product* 2 * 7 * 4 * 3 * 9 * 7 * 2 * 8, index + 82793472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 7 + 2 + 8, product* 8 * 2 * 7 * 3 * 9 * 7 * 2 * 8, index + 82793728);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 2 + 8, product* 4 * 2 * 4 * 3 * 2 * 8 * 2 * 8, index + 82823424);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 2 + 8 + 2 + 8, product* 6 * 9 * 4 * 6 * 2 * 8 * 2 * 8, index + 82826496);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 8 + 2 + 8, product* 4 * 6 * 2 * 7 * 2 * 8 * 2 * 8, index + 82827264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 2 + 8, product* 4 * 2 * 8 * 9 * 2 * 8 * 2 * 8, index + 82829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 2 + 8, product* 4 * 8 * 3 * 2 * 3 * 8 * 2 * 8, index + 82832384);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 8 + 2 + 8, product* 8 * 4 * 2 * 7 * 3 * 8 * 2 * 8, index + 82837248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 2 + 8, product* 2 * 7 * 2 * 8 * 3 * 8 * 2 * 8, index + 82838272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 2 + 8, product* 4 * 2 * 6 * 2 * 4 * 8 * 2 * 8, index + 82842624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 2 + 8, product* 2 * 3 * 2 * 7 * 4 * 8 * 2 * 8, index + 82847232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 8 + 2 + 8, product* 4 * 4 * 7 * 7 * 4 * 8 * 2 * 8, index + 82847744);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 6 + 8 + 2 + 8, product* 4 * 8 * 3 * 4 * 6 * 8 * 2 * 8, index + 82864384);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 8 + 2 + 8, product* 4 * 4 * 3 * 3 * 7 * 8 * 2 * 8, index + 82873344);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 8 + 2 + 8, product* 2 * 3 * 2 * 9 * 7 * 8 * 2 * 8, index + 82879232);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 8 + 2 + 8, product* 2 * 3 * 4 * 8 * 9 * 8 * 2 * 8, index + 82898432);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 2 + 8, product* 4 * 6 * 2 * 3 * 2 * 9 * 2 * 8, index + 82923264);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 2 + 9 + 2 + 8, product* 6 * 9 * 8 * 8 * 2 * 9 * 2 * 8, index + 82928896);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 2 + 8, product* 4 * 2 * 2 * 2 * 3 * 9 * 2 * 8, index + 82932224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 2 + 8, product* 8 * 4 * 2 * 3 * 3 * 9 * 2 * 8, index + 82933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 2 + 8, product* 2 * 7 * 2 * 4 * 3 * 9 * 2 * 8, index + 82934272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 9 + 2 + 8, product* 4 * 4 * 3 * 7 * 3 * 9 * 2 * 8, index + 82937344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 2 + 8, product* 2 * 3 * 2 * 3 * 4 * 9 * 2 * 8, index + 82943232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 9 + 2 + 8, product* 2 * 3 * 4 * 2 * 6 * 9 * 2 * 8, index + 82962432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 2 + 8, product* 4 * 2 * 2 * 4 * 6 * 9 * 2 * 8, index + 82964224);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 9 + 2 + 8, product* 4 * 8 * 3 * 2 * 9 * 9 * 2 * 8, index + 82992384);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 3 + 8, product* 2 * 7 * 2 * 2 * 2 * 2 * 3 * 8, index + 83222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 3 + 8, product* 4 * 8 * 7 * 2 * 2 * 2 * 3 * 8, index + 83222784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 3 + 8, product* 2 * 3 * 8 * 4 * 2 * 2 * 3 * 8, index + 83224832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 3 + 8, product* 4 * 2 * 6 * 6 * 2 * 2 * 3 * 8, index + 83226624);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 2 + 3 + 8, product* 2 * 7 * 6 * 8 * 2 * 2 * 3 * 8, index + 83228672);
-body<0>(stream, sum+ 8 + 2 + 9 + 8 + 2 + 2 + 3 + 8, product* 8 * 2 * 9 * 8 * 2 * 2 * 3 * 8, index + 83228928);
-body<0>(stream, sum+ 6 + 9 + 6 + 9 + 2 + 2 + 3 + 8, product* 6 * 9 * 6 * 9 * 2 * 2 * 3 * 8, index + 83229696);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 2 + 3 + 8, product* 8 * 6 * 7 * 2 * 3 * 2 * 3 * 8, index + 83232768);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 3 + 8, product* 6 * 7 * 3 * 7 * 3 * 2 * 3 * 8, index + 83237376);
-body<0>(stream, sum+ 8 + 8 + 8 + 7 + 3 + 2 + 3 + 8, product* 8 * 8 * 8 * 7 * 3 * 2 * 3 * 8, index + 83237888);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 2 + 3 + 8, product* 4 * 2 * 4 * 9 * 3 * 2 * 3 * 8, index + 83239424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 4 + 2 + 3 + 8, product* 6 * 9 * 4 * 2 * 4 * 2 * 3 * 8, index + 83242496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 3 + 8, product* 4 * 6 * 2 * 3 * 4 * 2 * 3 * 8, index + 83243264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 4 + 2 + 3 + 8, product* 6 * 7 * 7 * 3 * 4 * 2 * 3 * 8, index + 83243776);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 3 + 8, product* 4 * 8 * 3 * 8 * 4 * 2 * 3 * 8, index + 83248384);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 2 + 3 + 8, product* 4 * 6 * 6 * 9 * 4 * 2 * 3 * 8, index + 83249664);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 3 + 8, product* 4 * 6 * 4 * 2 * 6 * 2 * 3 * 8, index + 83262464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 6 + 2 + 3 + 8, product* 6 * 7 * 9 * 2 * 6 * 2 * 3 * 8, index + 83262976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 3 + 8, product* 2 * 3 * 2 * 3 * 6 * 2 * 3 * 8, index + 83263232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 6 + 2 + 3 + 8, product* 8 * 8 * 4 * 3 * 6 * 2 * 3 * 8, index + 83263488);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 2 + 3 + 8, product* 2 * 3 * 6 * 9 * 6 * 2 * 3 * 8, index + 83269632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 2 + 3 + 8, product* 8 * 4 * 4 * 2 * 7 * 2 * 3 * 8, index + 83272448);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 7 + 2 + 3 + 8, product* 8 * 8 * 2 * 6 * 7 * 2 * 3 * 8, index + 83276288);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 2 + 3 + 8, product* 6 * 3 * 3 * 8 * 7 * 2 * 3 * 8, index + 83278336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 7 + 2 + 3 + 8, product* 2 * 7 * 8 * 9 * 7 * 2 * 3 * 8, index + 83279872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 3 + 8, product* 2 * 3 * 4 * 2 * 8 * 2 * 3 * 8, index + 83282432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 3 + 8, product* 4 * 2 * 2 * 4 * 8 * 2 * 3 * 8, index + 83284224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 2 + 3 + 8, product* 2 * 7 * 2 * 6 * 8 * 2 * 3 * 8, index + 83286272);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 3 + 8, product* 2 * 7 * 6 * 2 * 9 * 2 * 3 * 8, index + 83292672);
-body<0>(stream, sum+ 2 + 9 + 7 + 7 + 9 + 2 + 3 + 8, product* 2 * 9 * 7 * 7 * 9 * 2 * 3 * 8, index + 83297792);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 3 + 3 + 8, product* 8 * 6 * 3 * 2 * 2 * 3 * 3 * 8, index + 83322368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 3 + 8, product* 4 * 2 * 6 * 2 * 2 * 3 * 3 * 8, index + 83322624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 3 + 3 + 8, product* 2 * 9 * 3 * 3 * 2 * 3 * 3 * 8, index + 83323392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 3 + 8, product* 2 * 3 * 2 * 7 * 2 * 3 * 3 * 8, index + 83327232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 3 + 8, product* 4 * 4 * 7 * 7 * 2 * 3 * 3 * 8, index + 83327744);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 3 + 8, product* 4 * 6 * 8 * 2 * 3 * 3 * 3 * 8, index + 83332864);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 3 + 8, product* 2 * 3 * 6 * 3 * 3 * 3 * 3 * 8, index + 83333632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 3 + 3 + 8, product* 8 * 4 * 4 * 6 * 3 * 3 * 3 * 8, index + 83336448);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 3 + 3 + 3 + 8, product* 6 * 9 * 4 * 8 * 3 * 3 * 3 * 8, index + 83338496);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 3 + 3 + 3 + 8, product* 4 * 6 * 2 * 9 * 3 * 3 * 3 * 8, index + 83339264);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 3 + 3 + 8, product* 6 * 3 * 3 * 2 * 4 * 3 * 3 * 8, index + 83342336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 3 + 8, product* 2 * 7 * 8 * 3 * 4 * 3 * 3 * 8, index + 83343872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 3 + 8, product* 4 * 8 * 3 * 4 * 4 * 3 * 3 * 8, index + 83344384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 3 + 3 + 8, product* 2 * 3 * 4 * 6 * 4 * 3 * 3 * 8, index + 83346432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 4 + 3 + 3 + 8, product* 4 * 4 * 9 * 6 * 4 * 3 * 3 * 8, index + 83346944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 3 + 8, product* 4 * 2 * 2 * 8 * 4 * 3 * 3 * 8, index + 83348224);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 6 + 3 + 3 + 8, product* 8 * 2 * 3 * 3 * 6 * 3 * 3 * 8, index + 83363328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 3 + 3 + 8, product* 4 * 2 * 4 * 7 * 6 * 3 * 3 * 8, index + 83367424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 3 + 3 + 8, product* 2 * 7 * 2 * 2 * 8 * 3 * 3 * 8, index + 83382272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 8 + 3 + 3 + 8, product* 4 * 8 * 7 * 2 * 8 * 3 * 3 * 8, index + 83382784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 3 + 3 + 8, product* 6 * 9 * 2 * 3 * 8 * 3 * 3 * 8, index + 83383296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 3 + 8, product* 2 * 3 * 8 * 4 * 8 * 3 * 3 * 8, index + 83384832);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 3 + 8, product* 4 * 6 * 4 * 2 * 2 * 4 * 3 * 8, index + 83422464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 4 + 3 + 8, product* 6 * 7 * 9 * 2 * 2 * 4 * 3 * 8, index + 83422976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 3 + 8, product* 2 * 3 * 2 * 3 * 2 * 4 * 3 * 8, index + 83423232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 4 + 3 + 8, product* 8 * 8 * 4 * 3 * 2 * 4 * 3 * 8, index + 83423488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 3 + 8, product* 4 * 4 * 7 * 3 * 2 * 4 * 3 * 8, index + 83423744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 4 + 3 + 8, product* 8 * 6 * 7 * 4 * 2 * 4 * 3 * 8, index + 83424768);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 3 + 8, product* 8 * 2 * 3 * 7 * 2 * 4 * 3 * 8, index + 83427328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 4 + 3 + 8, product* 2 * 3 * 6 * 9 * 2 * 4 * 3 * 8, index + 83429632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 3 + 8, product* 8 * 4 * 4 * 2 * 3 * 4 * 3 * 8, index + 83432448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 3 + 8, product* 2 * 7 * 4 * 3 * 3 * 4 * 3 * 8, index + 83433472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 4 + 3 + 8, product* 8 * 2 * 7 * 3 * 3 * 4 * 3 * 8, index + 83433728);
-body<0>(stream, sum+ 8 + 8 + 2 + 6 + 3 + 4 + 3 + 8, product* 8 * 8 * 2 * 6 * 3 * 4 * 3 * 8, index + 83436288);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4 + 3 + 8, product* 4 * 2 * 8 * 7 * 3 * 4 * 3 * 8, index + 83437824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 4 + 3 + 8, product* 6 * 3 * 3 * 8 * 3 * 4 * 3 * 8, index + 83438336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 3 + 8, product* 2 * 3 * 4 * 2 * 4 * 4 * 3 * 8, index + 83442432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 3 + 8, product* 4 * 2 * 2 * 4 * 4 * 4 * 3 * 8, index + 83444224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 4 + 3 + 8, product* 2 * 9 * 9 * 4 * 4 * 4 * 3 * 8, index + 83444992);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 3 + 8, product* 2 * 7 * 2 * 6 * 4 * 4 * 3 * 8, index + 83446272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 4 + 3 + 8, product* 6 * 9 * 2 * 7 * 4 * 4 * 3 * 8, index + 83447296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 4 + 3 + 8, product* 4 * 2 * 4 * 3 * 6 * 4 * 3 * 8, index + 83463424);
-body<0>(stream, sum+ 6 + 7 + 7 + 7 + 6 + 4 + 3 + 8, product* 6 * 7 * 7 * 7 * 6 * 4 * 3 * 8, index + 83467776);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 6 + 4 + 3 + 8, product* 4 * 2 * 8 * 9 * 6 * 4 * 3 * 8, index + 83469824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 4 + 3 + 8, product* 4 * 8 * 3 * 2 * 7 * 4 * 3 * 8, index + 83472384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 4 + 3 + 8, product* 2 * 3 * 4 * 4 * 7 * 4 * 3 * 8, index + 83474432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 4 + 3 + 8, product* 8 * 8 * 6 * 4 * 7 * 4 * 3 * 8, index + 83474688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 3 + 8, product* 4 * 2 * 2 * 6 * 7 * 4 * 3 * 8, index + 83476224);
-body<0>(stream, sum+ 6 + 3 + 7 + 6 + 7 + 4 + 3 + 8, product* 6 * 3 * 7 * 6 * 7 * 4 * 3 * 8, index + 83476736);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 4 + 3 + 8, product* 4 * 2 * 6 * 2 * 8 * 4 * 3 * 8, index + 83482624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 4 + 3 + 8, product* 2 * 7 * 6 * 4 * 8 * 4 * 3 * 8, index + 83484672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 4 + 3 + 8, product* 2 * 3 * 2 * 7 * 8 * 4 * 3 * 8, index + 83487232);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 4 + 3 + 8, product* 6 * 7 * 3 * 3 * 9 * 4 * 3 * 8, index + 83493376);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 4 + 3 + 8, product* 6 * 9 * 4 * 8 * 9 * 4 * 3 * 8, index + 83498496);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 3 + 8, product* 4 * 2 * 4 * 3 * 2 * 6 * 3 * 8, index + 83623424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 6 + 3 + 8, product* 6 * 3 * 9 * 3 * 2 * 6 * 3 * 8, index + 83623936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 3 + 8, product* 4 * 6 * 2 * 7 * 2 * 6 * 3 * 8, index + 83627264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 6 + 3 + 8, product* 8 * 8 * 2 * 8 * 2 * 6 * 3 * 8, index + 83628288);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 6 + 3 + 8, product* 4 * 6 * 6 * 3 * 3 * 6 * 3 * 8, index + 83633664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 3 + 8, product* 2 * 3 * 4 * 4 * 3 * 6 * 3 * 8, index + 83634432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 6 + 3 + 8, product* 4 * 2 * 2 * 6 * 3 * 6 * 3 * 8, index + 83636224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 6 + 3 + 8, product* 2 * 7 * 2 * 8 * 3 * 6 * 3 * 8, index + 83638272);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 6 + 3 + 8, product* 2 * 9 * 3 * 3 * 4 * 6 * 3 * 8, index + 83643392);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 6 + 3 + 8, product* 8 * 2 * 9 * 4 * 4 * 6 * 3 * 8, index + 83644928);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 3 + 8, product* 6 * 3 * 3 * 2 * 6 * 6 * 3 * 8, index + 83662336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 6 + 3 + 8, product* 2 * 7 * 8 * 3 * 6 * 6 * 3 * 8, index + 83663872);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 6 + 3 + 8, product* 4 * 2 * 6 * 4 * 7 * 6 * 3 * 8, index + 83674624);
-body<0>(stream, sum+ 6 + 9 + 6 + 7 + 7 + 6 + 3 + 8, product* 6 * 9 * 6 * 7 * 7 * 6 * 3 * 8, index + 83677696);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 3 + 8, product* 2 * 3 * 2 * 9 * 7 * 6 * 3 * 8, index + 83679232);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 8 + 6 + 3 + 8, product* 2 * 7 * 4 * 9 * 8 * 6 * 3 * 8, index + 83689472);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8 + 6 + 3 + 8, product* 4 * 8 * 9 * 9 * 8 * 6 * 3 * 8, index + 83689984);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 3 + 8, product* 4 * 6 * 2 * 3 * 2 * 7 * 3 * 8, index + 83723264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 2 + 7 + 3 + 8, product* 8 * 8 * 2 * 4 * 2 * 7 * 3 * 8, index + 83724288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 7 + 3 + 8, product* 6 * 3 * 3 * 6 * 2 * 7 * 3 * 8, index + 83726336);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 3 + 8, product* 4 * 2 * 2 * 2 * 3 * 7 * 3 * 8, index + 83732224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 7 + 3 + 8, product* 6 * 3 * 7 * 2 * 3 * 7 * 3 * 8, index + 83732736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 7 + 3 + 8, product* 8 * 4 * 2 * 3 * 3 * 7 * 3 * 8, index + 83733248);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 7 + 3 + 8, product* 4 * 8 * 7 * 4 * 3 * 7 * 3 * 8, index + 83734784);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 7 + 3 + 8, product* 4 * 2 * 6 * 8 * 3 * 7 * 3 * 8, index + 83738624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 7 + 3 + 8, product* 4 * 6 * 4 * 2 * 4 * 7 * 3 * 8, index + 83742464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 3 + 8, product* 2 * 3 * 2 * 3 * 4 * 7 * 3 * 8, index + 83743232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 4 + 7 + 3 + 8, product* 8 * 8 * 4 * 3 * 4 * 7 * 3 * 8, index + 83743488);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 7 + 3 + 8, product* 2 * 9 * 3 * 3 * 6 * 7 * 3 * 8, index + 83763392);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 7 + 3 + 8, product* 2 * 7 * 2 * 6 * 6 * 7 * 3 * 8, index + 83766272);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 7 + 3 + 8, product* 8 * 2 * 9 * 2 * 7 * 7 * 3 * 8, index + 83772928);
-body<0>(stream, sum+ 4 + 6 + 4 + 4 + 7 + 7 + 3 + 8, product* 4 * 6 * 4 * 4 * 7 * 7 * 3 * 8, index + 83774464);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 7 + 3 + 8, product* 4 * 8 * 3 * 2 * 9 * 7 * 3 * 8, index + 83792384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 7 + 3 + 8, product* 2 * 3 * 4 * 4 * 9 * 7 * 3 * 8, index + 83794432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 3 + 8, product* 6 * 3 * 3 * 2 * 2 * 8 * 3 * 8, index + 83822336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 3 + 8, product* 2 * 7 * 8 * 3 * 2 * 8 * 3 * 8, index + 83823872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 3 + 8, product* 4 * 2 * 2 * 8 * 2 * 8 * 3 * 8, index + 83828224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 8 + 3 + 8, product* 2 * 3 * 8 * 2 * 3 * 8 * 3 * 8, index + 83832832);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 8 + 3 + 8, product* 8 * 6 * 3 * 4 * 3 * 8 * 3 * 8, index + 83834368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 8 + 3 + 8, product* 4 * 2 * 6 * 4 * 3 * 8 * 3 * 8, index + 83834624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 8 + 3 + 8, product* 2 * 3 * 2 * 9 * 3 * 8 * 3 * 8, index + 83839232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 8 + 3 + 8, product* 4 * 2 * 4 * 7 * 4 * 8 * 3 * 8, index + 83847424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 3 + 8, product* 2 * 7 * 2 * 2 * 6 * 8 * 3 * 8, index + 83862272);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 8 + 3 + 8, product* 6 * 9 * 4 * 2 * 8 * 8 * 3 * 8, index + 83882496);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 8 + 8 + 3 + 8, product* 8 * 8 * 2 * 4 * 8 * 8 * 3 * 8, index + 83884288);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 8 + 3 + 8, product* 4 * 2 * 2 * 2 * 9 * 8 * 3 * 8, index + 83892224);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 8 + 3 + 8, product* 4 * 4 * 3 * 7 * 9 * 8 * 3 * 8, index + 83897344);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 3 + 8, product* 2 * 3 * 4 * 2 * 2 * 9 * 3 * 8, index + 83922432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 3 + 8, product* 4 * 2 * 2 * 4 * 2 * 9 * 3 * 8, index + 83924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 3 + 8, product* 6 * 3 * 7 * 4 * 2 * 9 * 3 * 8, index + 83924736);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 9 + 3 + 8, product* 2 * 9 * 3 * 3 * 6 * 9 * 3 * 8, index + 83963392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 9 + 3 + 8, product* 2 * 3 * 2 * 7 * 6 * 9 * 3 * 8, index + 83967232);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 9 + 3 + 8, product* 8 * 2 * 7 * 7 * 7 * 9 * 3 * 8, index + 83977728);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 9 + 3 + 8, product* 6 * 3 * 3 * 2 * 8 * 9 * 3 * 8, index + 83982336);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 8 + 9 + 3 + 8, product* 4 * 4 * 9 * 6 * 8 * 9 * 3 * 8, index + 83986944);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 4 + 8, product* 4 * 6 * 4 * 2 * 2 * 2 * 4 * 8, index + 84222464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 4 + 8, product* 2 * 3 * 2 * 3 * 2 * 2 * 4 * 8, index + 84223232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 4 + 8, product* 8 * 2 * 3 * 7 * 2 * 2 * 4 * 8, index + 84227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 4 + 8, product* 4 * 6 * 8 * 8 * 2 * 2 * 4 * 8, index + 84228864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 4 + 8, product* 2 * 3 * 6 * 9 * 2 * 2 * 4 * 8, index + 84229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 4 + 8, product* 8 * 4 * 4 * 2 * 3 * 2 * 4 * 8, index + 84232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 4 + 8, product* 2 * 7 * 4 * 3 * 3 * 2 * 4 * 8, index + 84233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 4 + 8, product* 8 * 2 * 7 * 3 * 3 * 2 * 4 * 8, index + 84233728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 4 + 8, product* 6 * 9 * 4 * 4 * 3 * 2 * 4 * 8, index + 84234496);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 4 + 8, product* 6 * 3 * 3 * 8 * 3 * 2 * 4 * 8, index + 84238336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 4 + 8, product* 2 * 3 * 4 * 2 * 4 * 2 * 4 * 8, index + 84242432);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 2 + 4 + 8, product* 8 * 6 * 9 * 3 * 4 * 2 * 4 * 8, index + 84243968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 4 + 8, product* 4 * 2 * 2 * 4 * 4 * 2 * 4 * 8, index + 84244224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 4 + 8, product* 2 * 7 * 2 * 6 * 4 * 2 * 4 * 8, index + 84246272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 4 + 8, product* 2 * 3 * 8 * 8 * 4 * 2 * 4 * 8, index + 84248832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 4 + 8, product* 4 * 4 * 3 * 9 * 4 * 2 * 4 * 8, index + 84249344);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 4 + 8, product* 4 * 2 * 4 * 3 * 6 * 2 * 4 * 8, index + 84263424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 4 + 8, product* 8 * 4 * 4 * 4 * 6 * 2 * 4 * 8, index + 84264448);
-body<0>(stream, sum+ 6 + 9 + 4 + 6 + 6 + 2 + 4 + 8, product* 6 * 9 * 4 * 6 * 6 * 2 * 4 * 8, index + 84266496);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 4 + 8, product* 6 * 9 * 8 * 2 * 7 * 2 * 4 * 8, index + 84272896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 7 + 2 + 4 + 8, product* 4 * 6 * 6 * 3 * 7 * 2 * 4 * 8, index + 84273664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 4 + 8, product* 2 * 3 * 4 * 4 * 7 * 2 * 4 * 8, index + 84274432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 7 + 2 + 4 + 8, product* 8 * 8 * 6 * 4 * 7 * 2 * 4 * 8, index + 84274688);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 4 + 8, product* 4 * 2 * 2 * 6 * 7 * 2 * 4 * 8, index + 84276224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 4 + 8, product* 8 * 4 * 2 * 7 * 7 * 2 * 4 * 8, index + 84277248);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 4 + 8, product* 4 * 2 * 6 * 2 * 8 * 2 * 4 * 8, index + 84282624);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 8 + 2 + 4 + 8, product* 8 * 2 * 9 * 4 * 8 * 2 * 4 * 8, index + 84284928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 8 + 2 + 4 + 8, product* 4 * 6 * 4 * 6 * 8 * 2 * 4 * 8, index + 84286464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 4 + 8, product* 2 * 3 * 2 * 7 * 8 * 2 * 4 * 8, index + 84287232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 4 + 8, product* 2 * 3 * 6 * 3 * 9 * 2 * 4 * 8, index + 84293632);
-body<0>(stream, sum+ 8 + 8 + 8 + 3 + 9 + 2 + 4 + 8, product* 8 * 8 * 8 * 3 * 9 * 2 * 4 * 8, index + 84293888);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 4 + 8, product* 8 * 2 * 3 * 3 * 2 * 3 * 4 * 8, index + 84323328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 4 + 8, product* 4 * 6 * 8 * 4 * 2 * 3 * 4 * 8, index + 84324864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 4 + 8, product* 4 * 2 * 4 * 7 * 2 * 3 * 4 * 8, index + 84327424);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 2 + 3 + 4 + 8, product* 6 * 3 * 9 * 7 * 2 * 3 * 4 * 8, index + 84327936);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 3 + 4 + 8, product* 2 * 7 * 4 * 9 * 2 * 3 * 4 * 8, index + 84329472);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 4 + 8, product* 6 * 3 * 3 * 4 * 3 * 3 * 4 * 8, index + 84334336);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 3 + 4 + 8, product* 4 * 6 * 6 * 7 * 3 * 3 * 4 * 8, index + 84337664);
-body<0>(stream, sum+ 4 + 4 + 9 + 8 + 3 + 3 + 4 + 8, product* 4 * 4 * 9 * 8 * 3 * 3 * 4 * 8, index + 84338944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 4 + 8, product* 2 * 7 * 2 * 2 * 4 * 3 * 4 * 8, index + 84342272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 4 + 3 + 4 + 8, product* 4 * 8 * 7 * 2 * 4 * 3 * 4 * 8, index + 84342784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 4 + 8, product* 6 * 9 * 2 * 3 * 4 * 3 * 4 * 8, index + 84343296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 4 + 8, product* 2 * 3 * 8 * 4 * 4 * 3 * 4 * 8, index + 84344832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 4 + 3 + 4 + 8, product* 2 * 9 * 3 * 7 * 4 * 3 * 4 * 8, index + 84347392);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 4 + 8, product* 6 * 9 * 4 * 2 * 6 * 3 * 4 * 8, index + 84362496);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 6 + 3 + 4 + 8, product* 6 * 7 * 7 * 3 * 6 * 3 * 4 * 8, index + 84363776);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 4 + 8, product* 4 * 2 * 2 * 2 * 7 * 3 * 4 * 8, index + 84372224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 7 + 3 + 4 + 8, product* 2 * 9 * 9 * 2 * 7 * 3 * 4 * 8, index + 84372992);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 4 + 8, product* 8 * 4 * 2 * 3 * 7 * 3 * 4 * 8, index + 84373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 4 + 8, product* 2 * 7 * 2 * 4 * 7 * 3 * 4 * 8, index + 84374272);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3 + 4 + 8, product* 4 * 2 * 6 * 8 * 7 * 3 * 4 * 8, index + 84378624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 4 + 8, product* 2 * 3 * 2 * 3 * 8 * 3 * 4 * 8, index + 84383232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 3 + 4 + 8, product* 8 * 2 * 3 * 7 * 8 * 3 * 4 * 8, index + 84387328);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 4 + 8, product* 2 * 7 * 4 * 3 * 9 * 3 * 4 * 8, index + 84393472);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 9 + 3 + 4 + 8, product* 4 * 8 * 9 * 3 * 9 * 3 * 4 * 8, index + 84393984);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 4 + 8, product* 4 * 2 * 4 * 3 * 2 * 4 * 4 * 8, index + 84423424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 4 + 4 + 8, product* 6 * 3 * 9 * 3 * 2 * 4 * 4 * 8, index + 84423936);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 4 + 8, product* 4 * 6 * 2 * 7 * 2 * 4 * 4 * 8, index + 84427264);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 4 + 8, product* 4 * 2 * 8 * 9 * 2 * 4 * 4 * 8, index + 84429824);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 4 + 8, product* 2 * 3 * 4 * 4 * 3 * 4 * 4 * 8, index + 84434432);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 4 + 4 + 8, product* 2 * 9 * 9 * 6 * 3 * 4 * 4 * 8, index + 84436992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 4 + 4 + 8, product* 8 * 4 * 2 * 7 * 3 * 4 * 4 * 8, index + 84437248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 4 + 8, product* 2 * 7 * 2 * 8 * 3 * 4 * 4 * 8, index + 84438272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 4 + 8, product* 8 * 6 * 3 * 2 * 4 * 4 * 4 * 8, index + 84442368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 4 + 8, product* 4 * 2 * 6 * 2 * 4 * 4 * 4 * 8, index + 84442624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 4 + 4 + 8, product* 2 * 9 * 3 * 3 * 4 * 4 * 4 * 8, index + 84443392);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 4 + 4 + 8, product* 4 * 6 * 4 * 6 * 4 * 4 * 4 * 8, index + 84446464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 4 + 8, product* 2 * 3 * 2 * 7 * 4 * 4 * 4 * 8, index + 84447232);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 6 + 4 + 4 + 8, product* 8 * 4 * 8 * 2 * 6 * 4 * 4 * 8, index + 84462848);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 4 + 4 + 8, product* 2 * 3 * 4 * 6 * 6 * 4 * 4 * 8, index + 84466432);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 6 + 4 + 4 + 8, product* 2 * 9 * 9 * 8 * 6 * 4 * 4 * 8, index + 84468992);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 4 + 8, product* 2 * 3 * 8 * 2 * 7 * 4 * 4 * 8, index + 84472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 4 + 8, product* 4 * 4 * 3 * 3 * 7 * 4 * 4 * 8, index + 84473344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 4 + 8, product* 4 * 2 * 6 * 4 * 7 * 4 * 4 * 8, index + 84474624);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 4 + 8, product* 8 * 2 * 3 * 3 * 8 * 4 * 4 * 8, index + 84483328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 4 + 8, product* 4 * 2 * 4 * 7 * 8 * 4 * 4 * 8, index + 84487424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 4 + 4 + 8, product* 4 * 2 * 8 * 3 * 9 * 4 * 4 * 8, index + 84493824);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 4 + 4 + 8, product* 2 * 3 * 4 * 8 * 9 * 4 * 4 * 8, index + 84498432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 4 + 8, product* 6 * 3 * 3 * 2 * 2 * 6 * 4 * 8, index + 84622336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 4 + 8, product* 2 * 3 * 4 * 6 * 2 * 6 * 4 * 8, index + 84626432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 6 + 4 + 8, product* 4 * 4 * 9 * 6 * 2 * 6 * 4 * 8, index + 84626944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 6 + 4 + 8, product* 4 * 2 * 2 * 8 * 2 * 6 * 4 * 8, index + 84628224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 6 + 4 + 8, product* 2 * 9 * 9 * 8 * 2 * 6 * 4 * 8, index + 84628992);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 4 + 8, product* 2 * 3 * 2 * 9 * 3 * 6 * 4 * 8, index + 84639232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 4 + 8, product* 2 * 7 * 2 * 2 * 6 * 6 * 4 * 8, index + 84662272);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 4 + 8, product* 2 * 3 * 6 * 7 * 7 * 6 * 4 * 8, index + 84677632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 4 + 8, product* 4 * 2 * 4 * 9 * 7 * 6 * 4 * 8, index + 84679424);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 4 + 8, product* 2 * 7 * 2 * 4 * 9 * 6 * 4 * 8, index + 84694272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 4 + 8, product* 2 * 3 * 4 * 2 * 2 * 7 * 4 * 8, index + 84722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 4 + 8, product* 4 * 4 * 9 * 2 * 2 * 7 * 4 * 8, index + 84722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 4 + 8, product* 4 * 2 * 2 * 4 * 2 * 7 * 4 * 8, index + 84724224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 4 + 8, product* 2 * 7 * 2 * 6 * 2 * 7 * 4 * 8, index + 84726272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 4 + 8, product* 4 * 4 * 3 * 9 * 2 * 7 * 4 * 8, index + 84729344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 4 + 8, product* 2 * 7 * 6 * 2 * 3 * 7 * 4 * 8, index + 84732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 4 + 8, product* 8 * 2 * 9 * 2 * 3 * 7 * 4 * 8, index + 84732928);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 4 + 8, product* 8 * 2 * 3 * 9 * 3 * 7 * 4 * 8, index + 84739328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 4 + 8, product* 4 * 2 * 4 * 3 * 4 * 7 * 4 * 8, index + 84743424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 4 + 8, product* 4 * 6 * 2 * 7 * 4 * 7 * 4 * 8, index + 84747264);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 4 + 8, product* 2 * 3 * 2 * 7 * 6 * 7 * 4 * 8, index + 84767232);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 7 + 4 + 8, product* 2 * 3 * 8 * 2 * 9 * 7 * 4 * 8, index + 84792832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 4 + 8, product* 4 * 4 * 3 * 3 * 9 * 7 * 4 * 8, index + 84793344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 4 + 8, product* 2 * 7 * 2 * 2 * 2 * 8 * 4 * 8, index + 84822272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 4 + 8, product* 2 * 3 * 8 * 4 * 2 * 8 * 4 * 8, index + 84824832);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 8 + 4 + 8, product* 4 * 2 * 4 * 9 * 3 * 8 * 4 * 8, index + 84839424);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 4 + 8, product* 2 * 3 * 4 * 2 * 8 * 8 * 4 * 8, index + 84882432);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 9 + 4 + 8, product* 8 * 6 * 3 * 2 * 2 * 9 * 4 * 8, index + 84922368);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 9 + 4 + 8, product* 6 * 7 * 3 * 3 * 3 * 9 * 4 * 8, index + 84933376);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 9 + 4 + 8, product* 6 * 3 * 3 * 2 * 4 * 9 * 4 * 8, index + 84942336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 4 + 8, product* 2 * 7 * 8 * 3 * 4 * 9 * 4 * 8, index + 84943872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 9 + 4 + 8, product* 4 * 8 * 3 * 4 * 4 * 9 * 4 * 8, index + 84944384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 4 + 9 + 4 + 8, product* 2 * 3 * 4 * 6 * 4 * 9 * 4 * 8, index + 84946432);
-body<0>(stream, sum+ 6 + 3 + 9 + 7 + 6 + 9 + 4 + 8, product* 6 * 3 * 9 * 7 * 6 * 9 * 4 * 8, index + 84967936);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 9 + 4 + 8, product* 8 * 8 * 2 * 2 * 7 * 9 * 4 * 8, index + 84972288);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 4 + 8, product* 2 * 7 * 2 * 2 * 8 * 9 * 4 * 8, index + 84982272);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 6 + 8, product* 6 * 3 * 3 * 2 * 2 * 2 * 6 * 8, index + 86222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 6 + 8, product* 8 * 4 * 8 * 2 * 2 * 2 * 6 * 8, index + 86222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 6 + 8, product* 2 * 7 * 8 * 3 * 2 * 2 * 6 * 8, index + 86223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 6 + 8, product* 4 * 8 * 3 * 4 * 2 * 2 * 6 * 8, index + 86224384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 6 + 8, product* 2 * 3 * 4 * 6 * 2 * 2 * 6 * 8, index + 86226432);
-body<0>(stream, sum+ 8 + 8 + 6 + 6 + 2 + 2 + 6 + 8, product* 8 * 8 * 6 * 6 * 2 * 2 * 6 * 8, index + 86226688);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 6 + 8, product* 4 * 4 * 9 * 6 * 2 * 2 * 6 * 8, index + 86226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 6 + 8, product* 4 * 2 * 2 * 8 * 2 * 2 * 6 * 8, index + 86228224);
-body<0>(stream, sum+ 2 + 9 + 9 + 8 + 2 + 2 + 6 + 8, product* 2 * 9 * 9 * 8 * 2 * 2 * 6 * 8, index + 86228992);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 6 + 8, product* 8 * 4 * 2 * 9 * 2 * 2 * 6 * 8, index + 86229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 6 + 8, product* 2 * 3 * 8 * 2 * 3 * 2 * 6 * 8, index + 86232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 6 + 8, product* 4 * 4 * 3 * 3 * 3 * 2 * 6 * 8, index + 86233344);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 3 + 2 + 6 + 8, product* 2 * 7 * 6 * 6 * 3 * 2 * 6 * 8, index + 86236672);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 6 + 8, product* 2 * 3 * 2 * 9 * 3 * 2 * 6 * 8, index + 86239232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 2 + 6 + 8, product* 8 * 2 * 3 * 3 * 4 * 2 * 6 * 8, index + 86243328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 6 + 8, product* 2 * 7 * 2 * 2 * 6 * 2 * 6 * 8, index + 86262272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 6 + 8, product* 2 * 3 * 8 * 4 * 6 * 2 * 6 * 8, index + 86264832);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 6 + 8, product* 8 * 4 * 6 * 7 * 6 * 2 * 6 * 8, index + 86267648);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 6 + 8, product* 2 * 9 * 7 * 3 * 7 * 2 * 6 * 8, index + 86273792);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 6 + 8, product* 4 * 2 * 2 * 2 * 9 * 2 * 6 * 8, index + 86292224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 6 + 8, product* 8 * 4 * 2 * 3 * 9 * 2 * 6 * 8, index + 86293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 6 + 8, product* 2 * 7 * 2 * 4 * 9 * 2 * 6 * 8, index + 86294272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 9 + 2 + 6 + 8, product* 4 * 8 * 7 * 4 * 9 * 2 * 6 * 8, index + 86294784);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 6 + 8, product* 2 * 3 * 4 * 2 * 2 * 3 * 6 * 8, index + 86322432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 6 + 8, product* 4 * 2 * 2 * 4 * 2 * 3 * 6 * 8, index + 86324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 6 + 8, product* 6 * 3 * 7 * 4 * 2 * 3 * 6 * 8, index + 86324736);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 6 + 8, product* 4 * 4 * 3 * 9 * 2 * 3 * 6 * 8, index + 86329344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 6 + 8, product* 2 * 7 * 6 * 2 * 3 * 3 * 6 * 8, index + 86332672);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 6 + 8, product* 2 * 9 * 3 * 3 * 6 * 3 * 6 * 8, index + 86363392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 6 + 8, product* 2 * 7 * 6 * 4 * 6 * 3 * 6 * 8, index + 86364672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 6 + 8, product* 2 * 3 * 2 * 7 * 6 * 3 * 6 * 8, index + 86367232);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 7 + 3 + 6 + 8, product* 8 * 4 * 4 * 6 * 7 * 3 * 6 * 8, index + 86376448);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 7 + 3 + 6 + 8, product* 2 * 7 * 4 * 7 * 7 * 3 * 6 * 8, index + 86377472);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 7 + 3 + 6 + 8, product* 6 * 9 * 4 * 8 * 7 * 3 * 6 * 8, index + 86378496);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 8 + 3 + 6 + 8, product* 6 * 3 * 3 * 2 * 8 * 3 * 6 * 8, index + 86382336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 6 + 8, product* 2 * 3 * 4 * 6 * 8 * 3 * 6 * 8, index + 86386432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 3 + 6 + 8, product* 2 * 3 * 8 * 2 * 9 * 3 * 6 * 8, index + 86392832);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 9 + 3 + 6 + 8, product* 2 * 3 * 2 * 9 * 9 * 3 * 6 * 8, index + 86399232);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 6 + 8, product* 2 * 7 * 2 * 2 * 2 * 4 * 6 * 8, index + 86422272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 4 + 6 + 8, product* 4 * 8 * 7 * 2 * 2 * 4 * 6 * 8, index + 86422784);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 4 + 6 + 8, product* 6 * 9 * 2 * 3 * 2 * 4 * 6 * 8, index + 86423296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 6 + 8, product* 2 * 3 * 8 * 4 * 2 * 4 * 6 * 8, index + 86424832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 6 + 8, product* 2 * 9 * 3 * 7 * 2 * 4 * 6 * 8, index + 86427392);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 3 + 4 + 6 + 8, product* 8 * 6 * 7 * 2 * 3 * 4 * 6 * 8, index + 86432768);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 4 + 6 + 8, product* 4 * 6 * 2 * 3 * 4 * 4 * 6 * 8, index + 86443264);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 6 + 8, product* 4 * 6 * 6 * 9 * 4 * 4 * 6 * 8, index + 86449664);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 4 + 6 + 8, product* 4 * 2 * 2 * 4 * 8 * 4 * 6 * 8, index + 86484224);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 6 + 8, product* 2 * 3 * 2 * 3 * 2 * 6 * 6 * 8, index + 86623232);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 6 + 8, product* 2 * 7 * 4 * 3 * 3 * 6 * 6 * 8, index + 86633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 6 + 8, product* 8 * 2 * 7 * 3 * 3 * 6 * 6 * 8, index + 86633728);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 6 + 8, product* 2 * 3 * 4 * 2 * 4 * 6 * 6 * 8, index + 86642432);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 6 + 8, product* 2 * 7 * 2 * 6 * 4 * 6 * 6 * 8, index + 86646272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 6 + 6 + 8, product* 2 * 3 * 8 * 8 * 4 * 6 * 6 * 8, index + 86648832);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 6 + 6 + 8, product* 8 * 4 * 4 * 4 * 6 * 6 * 6 * 8, index + 86664448);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 6 + 6 + 8, product* 6 * 7 * 3 * 3 * 9 * 6 * 6 * 8, index + 86693376);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 6 + 8, product* 6 * 3 * 3 * 4 * 3 * 7 * 6 * 8, index + 86734336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 7 + 6 + 8, product* 2 * 3 * 4 * 8 * 3 * 7 * 6 * 8, index + 86738432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 6 + 8, product* 2 * 7 * 2 * 2 * 4 * 7 * 6 * 8, index + 86742272);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 6 + 8, product* 4 * 2 * 2 * 2 * 7 * 7 * 6 * 8, index + 86772224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 7 + 6 + 8, product* 2 * 7 * 2 * 4 * 7 * 7 * 6 * 8, index + 86774272);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 7 + 6 + 8, product* 2 * 3 * 6 * 9 * 8 * 7 * 6 * 8, index + 86789632);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 6 + 8, product* 4 * 2 * 4 * 3 * 2 * 8 * 6 * 8, index + 86823424);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 6 + 8, product* 4 * 2 * 2 * 6 * 3 * 8 * 6 * 8, index + 86836224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 8 + 6 + 8, product* 4 * 2 * 6 * 2 * 4 * 8 * 6 * 8, index + 86842624);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 8 + 6 + 8, product* 2 * 3 * 4 * 6 * 6 * 8 * 6 * 8, index + 86866432);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 6 + 8, product* 4 * 2 * 2 * 2 * 3 * 9 * 6 * 8, index + 86932224);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 9 + 6 + 8, product* 8 * 4 * 2 * 3 * 3 * 9 * 6 * 8, index + 86933248);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 7 + 8, product* 2 * 7 * 2 * 2 * 2 * 2 * 7 * 8, index + 87222272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 2 + 2 + 7 + 8, product* 4 * 8 * 7 * 2 * 2 * 2 * 7 * 8, index + 87222784);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 7 + 8, product* 2 * 3 * 8 * 4 * 2 * 2 * 7 * 8, index + 87224832);
-body<0>(stream, sum+ 8 + 6 + 3 + 6 + 2 + 2 + 7 + 8, product* 8 * 6 * 3 * 6 * 2 * 2 * 7 * 8, index + 87226368);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 2 + 2 + 7 + 8, product* 4 * 2 * 6 * 6 * 2 * 2 * 7 * 8, index + 87226624);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 2 + 7 + 8, product* 2 * 9 * 3 * 7 * 2 * 2 * 7 * 8, index + 87227392);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 7 + 8, product* 6 * 3 * 9 * 9 * 3 * 2 * 7 * 8, index + 87239936);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 2 + 7 + 8, product* 4 * 6 * 2 * 3 * 4 * 2 * 7 * 8, index + 87243264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 2 + 7 + 8, product* 6 * 3 * 3 * 6 * 4 * 2 * 7 * 8, index + 87246336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 7 + 8, product* 4 * 8 * 3 * 8 * 4 * 2 * 7 * 8, index + 87248384);
-body<0>(stream, sum+ 6 + 9 + 8 + 8 + 4 + 2 + 7 + 8, product* 6 * 9 * 8 * 8 * 4 * 2 * 7 * 8, index + 87248896);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 7 + 8, product* 2 * 3 * 2 * 3 * 6 * 2 * 7 * 8, index + 87263232);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 7 + 2 + 7 + 8, product* 2 * 7 * 4 * 3 * 7 * 2 * 7 * 8, index + 87273472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 7 + 8, product* 8 * 2 * 7 * 3 * 7 * 2 * 7 * 8, index + 87273728);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 7 + 8, product* 2 * 3 * 4 * 2 * 8 * 2 * 7 * 8, index + 87282432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 2 + 7 + 8, product* 4 * 2 * 2 * 4 * 8 * 2 * 7 * 8, index + 87284224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 3 + 7 + 8, product* 4 * 2 * 6 * 2 * 2 * 3 * 7 * 8, index + 87322624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 3 + 7 + 8, product* 8 * 4 * 6 * 3 * 2 * 3 * 7 * 8, index + 87323648);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 2 + 3 + 7 + 8, product* 8 * 2 * 9 * 4 * 2 * 3 * 7 * 8, index + 87324928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 7 + 8, product* 2 * 3 * 2 * 7 * 2 * 3 * 7 * 8, index + 87327232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 3 + 7 + 8, product* 4 * 4 * 7 * 7 * 2 * 3 * 7 * 8, index + 87327744);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 3 + 3 + 7 + 8, product* 4 * 6 * 8 * 2 * 3 * 3 * 7 * 8, index + 87332864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 3 + 3 + 7 + 8, product* 6 * 7 * 3 * 3 * 3 * 3 * 7 * 8, index + 87333376);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 3 + 7 + 8, product* 2 * 7 * 4 * 7 * 3 * 3 * 7 * 8, index + 87337472);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 3 + 7 + 8, product* 8 * 4 * 8 * 2 * 4 * 3 * 7 * 8, index + 87342848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 4 + 3 + 7 + 8, product* 4 * 8 * 3 * 4 * 4 * 3 * 7 * 8, index + 87344384);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 3 + 7 + 8, product* 4 * 2 * 2 * 8 * 4 * 3 * 7 * 8, index + 87348224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 3 + 7 + 8, product* 6 * 3 * 7 * 8 * 4 * 3 * 7 * 8, index + 87348736);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 3 + 7 + 8, product* 2 * 3 * 4 * 8 * 7 * 3 * 7 * 8, index + 87378432);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 9 + 3 + 7 + 8, product* 4 * 2 * 4 * 9 * 9 * 3 * 7 * 8, index + 87399424);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 7 + 8, product* 4 * 6 * 4 * 2 * 2 * 4 * 7 * 8, index + 87422464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 7 + 8, product* 2 * 3 * 2 * 3 * 2 * 4 * 7 * 8, index + 87423232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 7 + 8, product* 4 * 4 * 7 * 3 * 2 * 4 * 7 * 8, index + 87423744);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 4 + 7 + 8, product* 4 * 2 * 8 * 7 * 3 * 4 * 7 * 8, index + 87437824);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 4 + 7 + 8, product* 2 * 3 * 4 * 2 * 4 * 4 * 7 * 8, index + 87442432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 7 + 8, product* 4 * 2 * 2 * 4 * 4 * 4 * 7 * 8, index + 87444224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 4 + 7 + 8, product* 2 * 7 * 2 * 6 * 4 * 4 * 7 * 8, index + 87446272);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 4 + 7 + 8, product* 4 * 4 * 9 * 4 * 7 * 4 * 7 * 8, index + 87474944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 4 + 7 + 8, product* 4 * 2 * 2 * 6 * 7 * 4 * 7 * 8, index + 87476224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 6 + 7 + 8, product* 4 * 2 * 4 * 3 * 2 * 6 * 7 * 8, index + 87623424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 6 + 7 + 8, product* 4 * 6 * 2 * 7 * 2 * 6 * 7 * 8, index + 87627264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 6 + 7 + 8, product* 4 * 8 * 3 * 2 * 3 * 6 * 7 * 8, index + 87632384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 6 + 7 + 8, product* 2 * 3 * 4 * 4 * 3 * 6 * 7 * 8, index + 87634432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 6 + 7 + 8, product* 4 * 2 * 6 * 2 * 4 * 6 * 7 * 8, index + 87642624);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 6 + 7 + 8, product* 2 * 3 * 2 * 7 * 4 * 6 * 7 * 8, index + 87647232);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 6 + 7 + 8, product* 2 * 3 * 2 * 9 * 7 * 6 * 7 * 8, index + 87679232);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 7 + 7 + 8, product* 4 * 6 * 2 * 3 * 2 * 7 * 7 * 8, index + 87723264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 7 + 7 + 8, product* 4 * 2 * 2 * 2 * 3 * 7 * 7 * 8, index + 87732224);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 7 + 8, product* 2 * 3 * 2 * 3 * 4 * 7 * 7 * 8, index + 87743232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 7 + 7 + 8, product* 2 * 3 * 4 * 2 * 6 * 7 * 7 * 8, index + 87762432);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 6 + 7 + 7 + 8, product* 4 * 8 * 7 * 6 * 6 * 7 * 7 * 8, index + 87766784);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 8 + 7 + 8, product* 6 * 3 * 3 * 2 * 2 * 8 * 7 * 8, index + 87822336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 8 + 7 + 8, product* 2 * 7 * 8 * 3 * 2 * 8 * 7 * 8, index + 87823872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 8 + 7 + 8, product* 4 * 8 * 3 * 4 * 2 * 8 * 7 * 8, index + 87824384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 8 + 7 + 8, product* 2 * 3 * 4 * 6 * 2 * 8 * 7 * 8, index + 87826432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 8 + 7 + 8, product* 4 * 2 * 2 * 8 * 2 * 8 * 7 * 8, index + 87828224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 8 + 7 + 8, product* 2 * 7 * 2 * 2 * 6 * 8 * 7 * 8, index + 87862272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 9 + 7 + 8, product* 2 * 3 * 4 * 2 * 2 * 9 * 7 * 8, index + 87922432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 7 + 8, product* 4 * 2 * 2 * 4 * 2 * 9 * 7 * 8, index + 87924224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 9 + 7 + 8, product* 6 * 3 * 7 * 4 * 2 * 9 * 7 * 8, index + 87924736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 9 + 7 + 8, product* 2 * 7 * 2 * 6 * 2 * 9 * 7 * 8, index + 87926272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 9 + 7 + 8, product* 4 * 2 * 6 * 2 * 6 * 9 * 7 * 8, index + 87962624);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 9 + 9 + 7 + 8, product* 2 * 3 * 8 * 2 * 9 * 9 * 7 * 8, index + 87992832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 9 + 7 + 8, product* 4 * 4 * 3 * 3 * 9 * 9 * 7 * 8, index + 87993344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 8 + 8, product* 2 * 3 * 2 * 3 * 2 * 2 * 8 * 8, index + 88223232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 8 + 8, product* 4 * 4 * 7 * 3 * 2 * 2 * 8 * 8, index + 88223744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 8 + 8, product* 8 * 2 * 3 * 7 * 2 * 2 * 8 * 8, index + 88227328);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 8 + 8, product* 4 * 6 * 8 * 8 * 2 * 2 * 8 * 8, index + 88228864);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 8 + 8, product* 2 * 3 * 6 * 9 * 2 * 2 * 8 * 8, index + 88229632);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 8 + 8, product* 2 * 7 * 4 * 3 * 3 * 2 * 8 * 8, index + 88233472);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 8 + 8, product* 4 * 4 * 9 * 2 * 4 * 2 * 8 * 8, index + 88242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 8 + 8, product* 4 * 2 * 2 * 4 * 4 * 2 * 8 * 8, index + 88244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 8 + 8, product* 6 * 3 * 7 * 4 * 4 * 2 * 8 * 8, index + 88244736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 8 + 8, product* 2 * 7 * 2 * 6 * 4 * 2 * 8 * 8, index + 88246272);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 2 + 8 + 8, product* 4 * 4 * 3 * 9 * 4 * 2 * 8 * 8, index + 88249344);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 7 + 2 + 8 + 8, product* 6 * 9 * 8 * 2 * 7 * 2 * 8 * 8, index + 88272896);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 8 + 8, product* 2 * 3 * 4 * 4 * 7 * 2 * 8 * 8, index + 88274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 8 + 8, product* 4 * 4 * 9 * 4 * 7 * 2 * 8 * 8, index + 88274944);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 8 + 8, product* 8 * 4 * 2 * 7 * 7 * 2 * 8 * 8, index + 88277248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 8 + 8, product* 2 * 7 * 2 * 8 * 7 * 2 * 8 * 8, index + 88278272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 8 + 2 + 8 + 8, product* 8 * 6 * 3 * 2 * 8 * 2 * 8 * 8, index + 88282368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 8 + 8, product* 4 * 2 * 6 * 2 * 8 * 2 * 8 * 8, index + 88282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 8 + 8, product* 2 * 9 * 3 * 3 * 8 * 2 * 8 * 8, index + 88283392);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 8 + 8, product* 8 * 2 * 3 * 3 * 2 * 3 * 8 * 8, index + 88323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 8 + 8, product* 4 * 2 * 4 * 7 * 2 * 3 * 8 * 8, index + 88327424);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 8 + 8, product* 4 * 2 * 8 * 3 * 3 * 3 * 8 * 8, index + 88333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 8 + 8, product* 6 * 3 * 3 * 4 * 3 * 3 * 8 * 8, index + 88334336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 8 + 8, product* 2 * 3 * 4 * 8 * 3 * 3 * 8 * 8, index + 88338432);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 8 + 8, product* 2 * 3 * 8 * 4 * 4 * 3 * 8 * 8, index + 88344832);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 8 + 8, product* 4 * 2 * 2 * 2 * 7 * 3 * 8 * 8, index + 88372224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 8 + 8, product* 2 * 7 * 2 * 4 * 7 * 3 * 8 * 8, index + 88374272);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 8 + 3 + 8 + 8, product* 2 * 3 * 6 * 9 * 8 * 3 * 8 * 8, index + 88389632);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 3 + 8 + 8, product* 8 * 2 * 7 * 3 * 9 * 3 * 8 * 8, index + 88393728);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 9 + 3 + 8 + 8, product* 4 * 2 * 8 * 7 * 9 * 3 * 8 * 8, index + 88397824);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 8 + 8, product* 4 * 2 * 4 * 3 * 2 * 4 * 8 * 8, index + 88423424);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 8 + 8, product* 2 * 3 * 4 * 4 * 3 * 4 * 8 * 8, index + 88434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 8 + 8, product* 4 * 2 * 2 * 6 * 3 * 4 * 8 * 8, index + 88436224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 4 + 8 + 8, product* 2 * 7 * 2 * 8 * 3 * 4 * 8 * 8, index + 88438272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 4 + 8 + 8, product* 4 * 8 * 7 * 8 * 3 * 4 * 8 * 8, index + 88438784);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 4 + 8 + 8, product* 8 * 6 * 3 * 2 * 4 * 4 * 8 * 8, index + 88442368);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 8 + 8, product* 2 * 3 * 2 * 7 * 4 * 4 * 8 * 8, index + 88447232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 8 + 8, product* 6 * 3 * 3 * 2 * 6 * 4 * 8 * 8, index + 88462336);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 8 + 8, product* 6 * 3 * 3 * 2 * 2 * 6 * 8 * 8, index + 88622336);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 8 + 8, product* 2 * 3 * 8 * 2 * 3 * 6 * 8 * 8, index + 88632832);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 8 + 8, product* 8 * 2 * 3 * 3 * 4 * 6 * 8 * 8, index + 88643328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 6 + 8 + 8, product* 4 * 2 * 4 * 7 * 4 * 6 * 8 * 8, index + 88647424);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 8 + 8, product* 4 * 2 * 2 * 2 * 9 * 6 * 8 * 8, index + 88692224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 8 + 8, product* 2 * 7 * 2 * 4 * 9 * 6 * 8 * 8, index + 88694272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 8 + 8, product* 2 * 3 * 4 * 2 * 2 * 7 * 8 * 8, index + 88722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 8 + 8, product* 4 * 4 * 9 * 2 * 2 * 7 * 8 * 8, index + 88722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 8 + 8, product* 4 * 2 * 2 * 4 * 2 * 7 * 8 * 8, index + 88724224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 7 + 8 + 8, product* 6 * 3 * 7 * 4 * 2 * 7 * 8 * 8, index + 88724736);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 7 + 8 + 8, product* 4 * 2 * 4 * 3 * 4 * 7 * 8 * 8, index + 88743424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 4 + 7 + 8 + 8, product* 6 * 3 * 9 * 3 * 4 * 7 * 8 * 8, index + 88743936);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 8 + 8, product* 2 * 3 * 8 * 4 * 2 * 8 * 8 * 8, index + 88824832);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 8 + 8, product* 2 * 3 * 6 * 7 * 3 * 8 * 8 * 8, index + 88837632);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 8 + 8, product* 2 * 3 * 2 * 3 * 6 * 8 * 8 * 8, index + 88863232);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 8 + 8, product* 4 * 2 * 6 * 2 * 2 * 9 * 8 * 8, index + 88922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 8 + 8, product* 2 * 9 * 3 * 3 * 2 * 9 * 8 * 8, index + 88923392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 8 + 8, product* 2 * 3 * 2 * 7 * 2 * 9 * 8 * 8, index + 88927232);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 9 + 8, product* 4 * 2 * 4 * 3 * 2 * 2 * 9 * 8, index + 89223424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 9 + 8, product* 4 * 6 * 2 * 7 * 2 * 2 * 9 * 8, index + 89227264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 9 + 8, product* 4 * 8 * 3 * 2 * 3 * 2 * 9 * 8, index + 89232384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 9 + 8, product* 2 * 3 * 4 * 4 * 3 * 2 * 9 * 8, index + 89234432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 2 + 9 + 8, product* 8 * 8 * 6 * 4 * 3 * 2 * 9 * 8, index + 89234688);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 9 + 8, product* 4 * 2 * 6 * 2 * 4 * 2 * 9 * 8, index + 89242624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 4 + 2 + 9 + 8, product* 8 * 4 * 6 * 3 * 4 * 2 * 9 * 8, index + 89243648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 9 + 8, product* 2 * 3 * 2 * 7 * 4 * 2 * 9 * 8, index + 89247232);
-body<0>(stream, sum+ 2 + 9 + 7 + 9 + 4 + 2 + 9 + 8, product* 2 * 9 * 7 * 9 * 4 * 2 * 9 * 8, index + 89249792);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 9 + 8, product* 4 * 2 * 2 * 8 * 6 * 2 * 9 * 8, index + 89268224);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 9 + 8, product* 4 * 2 * 6 * 4 * 7 * 2 * 9 * 8, index + 89274624);
-body<0>(stream, sum+ 8 + 8 + 4 + 9 + 7 + 2 + 9 + 8, product* 8 * 8 * 4 * 9 * 7 * 2 * 9 * 8, index + 89279488);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 9 + 8, product* 8 * 2 * 3 * 3 * 8 * 2 * 9 * 8, index + 89283328);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 9 + 8, product* 6 * 3 * 3 * 6 * 2 * 3 * 9 * 8, index + 89326336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 9 + 8, product* 2 * 7 * 8 * 7 * 2 * 3 * 9 * 8, index + 89327872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 9 + 8, product* 4 * 2 * 2 * 2 * 3 * 3 * 9 * 8, index + 89332224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 9 + 8, product* 2 * 7 * 2 * 4 * 3 * 3 * 9 * 8, index + 89334272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 9 + 8, product* 2 * 3 * 8 * 6 * 3 * 3 * 9 * 8, index + 89336832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 9 + 8, product* 4 * 4 * 3 * 7 * 3 * 3 * 9 * 8, index + 89337344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 9 + 8, product* 2 * 3 * 2 * 3 * 4 * 3 * 9 * 8, index + 89343232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 3 + 9 + 8, product* 2 * 3 * 6 * 9 * 4 * 3 * 9 * 8, index + 89349632);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 9 + 8, product* 2 * 3 * 4 * 2 * 6 * 3 * 9 * 8, index + 89362432);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 9 + 8, product* 2 * 3 * 4 * 6 * 2 * 4 * 9 * 8, index + 89426432);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 9 + 8, product* 4 * 4 * 3 * 3 * 3 * 4 * 9 * 8, index + 89433344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4 + 9 + 8, product* 8 * 6 * 3 * 4 * 3 * 4 * 9 * 8, index + 89434368);
-body<0>(stream, sum+ 8 + 2 + 9 + 6 + 3 + 4 + 9 + 8, product* 8 * 2 * 9 * 6 * 3 * 4 * 9 * 8, index + 89436928);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 9 + 8, product* 2 * 7 * 2 * 2 * 6 * 4 * 9 * 8, index + 89462272);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 4 + 9 + 8, product* 8 * 4 * 6 * 7 * 6 * 4 * 9 * 8, index + 89467648);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 9 + 8, product* 4 * 2 * 2 * 2 * 9 * 4 * 9 * 8, index + 89492224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 9 + 8, product* 2 * 7 * 2 * 2 * 2 * 6 * 9 * 8, index + 89622272);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 4 + 6 + 9 + 8, product* 4 * 6 * 2 * 3 * 4 * 6 * 9 * 8, index + 89643264);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 6 + 9 + 8, product* 4 * 4 * 7 * 3 * 6 * 6 * 9 * 8, index + 89663744);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 9 + 8, product* 2 * 3 * 4 * 2 * 8 * 6 * 9 * 8, index + 89682432);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 9 + 8, product* 2 * 7 * 2 * 6 * 8 * 6 * 9 * 8, index + 89686272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 9 + 8, product* 8 * 6 * 3 * 2 * 2 * 7 * 9 * 8, index + 89722368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 7 + 9 + 8, product* 2 * 9 * 3 * 3 * 2 * 7 * 9 * 8, index + 89723392);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 9 + 8, product* 2 * 3 * 6 * 3 * 3 * 7 * 9 * 8, index + 89733632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 3 + 7 + 9 + 8, product* 2 * 7 * 4 * 7 * 3 * 7 * 9 * 8, index + 89737472);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 9 + 8, product* 6 * 3 * 3 * 2 * 4 * 7 * 9 * 8, index + 89742336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 9 + 8, product* 4 * 2 * 2 * 8 * 4 * 7 * 9 * 8, index + 89748224);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 9 + 8, product* 2 * 3 * 2 * 3 * 2 * 8 * 9 * 8, index + 89823232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8 + 9 + 8, product* 8 * 2 * 3 * 7 * 2 * 8 * 9 * 8, index + 89827328);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 8 + 9 + 8, product* 2 * 7 * 4 * 3 * 3 * 8 * 9 * 8, index + 89833472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 8 + 9 + 8, product* 8 * 2 * 7 * 3 * 3 * 8 * 9 * 8, index + 89833728);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 9 + 8, product* 4 * 2 * 2 * 4 * 4 * 8 * 9 * 8, index + 89844224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 9 + 8, product* 2 * 7 * 2 * 6 * 4 * 8 * 9 * 8, index + 89846272);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 9 + 8, product* 6 * 3 * 3 * 4 * 3 * 9 * 9 * 8, index + 89934336);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 9 + 8, product* 2 * 7 * 2 * 2 * 4 * 9 * 9 * 8, index + 89942272);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 9 + 9 + 9 + 8, product* 8 * 2 * 7 * 3 * 9 * 9 * 9 * 8, index + 89993728);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 2 + 2 + 9, product* 4 * 6 * 4 * 2 * 2 * 2 * 2 * 9, index + 92222464);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 2 + 9, product* 6 * 7 * 9 * 2 * 2 * 2 * 2 * 9, index + 92222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 2 + 9, product* 2 * 3 * 2 * 3 * 2 * 2 * 2 * 9, index + 92223232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 2 + 2 + 9, product* 8 * 8 * 4 * 3 * 2 * 2 * 2 * 9, index + 92223488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 2 + 9, product* 4 * 4 * 7 * 3 * 2 * 2 * 2 * 9, index + 92223744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 2 + 2 + 9, product* 8 * 2 * 3 * 7 * 2 * 2 * 2 * 9, index + 92227328);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 2 + 2 + 2 + 9, product* 2 * 3 * 6 * 9 * 2 * 2 * 2 * 9, index + 92229632);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 2 + 2 + 9, product* 8 * 4 * 4 * 2 * 3 * 2 * 2 * 9, index + 92232448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 2 + 9, product* 2 * 7 * 4 * 3 * 3 * 2 * 2 * 9, index + 92233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 2 + 9, product* 8 * 2 * 7 * 3 * 3 * 2 * 2 * 9, index + 92233728);
-body<0>(stream, sum+ 4 + 8 + 9 + 3 + 3 + 2 + 2 + 9, product* 4 * 8 * 9 * 3 * 3 * 2 * 2 * 9, index + 92233984);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 2 + 9, product* 6 * 9 * 4 * 4 * 3 * 2 * 2 * 9, index + 92234496);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 2 + 2 + 9, product* 4 * 2 * 8 * 7 * 3 * 2 * 2 * 9, index + 92237824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 2 + 2 + 9, product* 6 * 3 * 3 * 8 * 3 * 2 * 2 * 9, index + 92238336);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 2 + 2 + 9, product* 2 * 7 * 8 * 9 * 3 * 2 * 2 * 9, index + 92239872);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 2 + 9, product* 2 * 3 * 4 * 2 * 4 * 2 * 2 * 9, index + 92242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 2 + 9, product* 8 * 8 * 6 * 2 * 4 * 2 * 2 * 9, index + 92242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 2 + 9, product* 4 * 4 * 9 * 2 * 4 * 2 * 2 * 9, index + 92242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 2 + 9, product* 4 * 2 * 2 * 4 * 4 * 2 * 2 * 9, index + 92244224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 4 + 2 + 2 + 9, product* 6 * 3 * 7 * 4 * 4 * 2 * 2 * 9, index + 92244736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 2 + 2 + 9, product* 2 * 7 * 2 * 6 * 4 * 2 * 2 * 9, index + 92246272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 2 + 9, product* 4 * 2 * 4 * 3 * 6 * 2 * 2 * 9, index + 92263424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 2 + 9, product* 8 * 4 * 4 * 4 * 6 * 2 * 2 * 9, index + 92264448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 6 + 2 + 2 + 9, product* 4 * 6 * 2 * 7 * 6 * 2 * 2 * 9, index + 92267264);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 2 + 9, product* 2 * 3 * 4 * 4 * 7 * 2 * 2 * 9, index + 92274432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 7 + 2 + 2 + 9, product* 4 * 4 * 9 * 4 * 7 * 2 * 2 * 9, index + 92274944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 2 + 2 + 9, product* 4 * 2 * 2 * 6 * 7 * 2 * 2 * 9, index + 92276224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 7 + 2 + 2 + 9, product* 8 * 4 * 2 * 7 * 7 * 2 * 2 * 9, index + 92277248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 7 + 2 + 2 + 9, product* 2 * 7 * 2 * 8 * 7 * 2 * 2 * 9, index + 92278272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 7 + 2 + 2 + 9, product* 4 * 8 * 7 * 8 * 7 * 2 * 2 * 9, index + 92278784);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 2 + 9, product* 4 * 2 * 6 * 2 * 8 * 2 * 2 * 9, index + 92282624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 8 + 2 + 2 + 9, product* 2 * 9 * 3 * 3 * 8 * 2 * 2 * 9, index + 92283392);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 2 + 9, product* 8 * 4 * 6 * 3 * 8 * 2 * 2 * 9, index + 92283648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 2 + 9, product* 2 * 7 * 6 * 4 * 8 * 2 * 2 * 9, index + 92284672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 2 + 2 + 9, product* 2 * 3 * 2 * 7 * 8 * 2 * 2 * 9, index + 92287232);
-body<0>(stream, sum+ 4 + 6 + 8 + 2 + 9 + 2 + 2 + 9, product* 4 * 6 * 8 * 2 * 9 * 2 * 2 * 9, index + 92292864);
-body<0>(stream, sum+ 6 + 7 + 3 + 3 + 9 + 2 + 2 + 9, product* 6 * 7 * 3 * 3 * 9 * 2 * 2 * 9, index + 92293376);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 2 + 9, product* 2 * 3 * 6 * 3 * 9 * 2 * 2 * 9, index + 92293632);
-body<0>(stream, sum+ 6 + 9 + 4 + 8 + 9 + 2 + 2 + 9, product* 6 * 9 * 4 * 8 * 9 * 2 * 2 * 9, index + 92298496);
-body<0>(stream, sum+ 4 + 6 + 2 + 9 + 9 + 2 + 2 + 9, product* 4 * 6 * 2 * 9 * 9 * 2 * 2 * 9, index + 92299264);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 2 + 9, product* 8 * 2 * 3 * 3 * 2 * 3 * 2 * 9, index + 92323328);
-body<0>(stream, sum+ 4 + 6 + 8 + 4 + 2 + 3 + 2 + 9, product* 4 * 6 * 8 * 4 * 2 * 3 * 2 * 9, index + 92324864);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 2 + 9, product* 4 * 2 * 4 * 7 * 2 * 3 * 2 * 9, index + 92327424);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 3 + 3 + 2 + 9, product* 8 * 8 * 2 * 2 * 3 * 3 * 2 * 9, index + 92332288);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 2 + 9, product* 2 * 7 * 6 * 2 * 3 * 3 * 2 * 9, index + 92332672);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 3 + 3 + 2 + 9, product* 4 * 2 * 8 * 3 * 3 * 3 * 2 * 9, index + 92333824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 3 + 2 + 9, product* 6 * 3 * 3 * 4 * 3 * 3 * 2 * 9, index + 92334336);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 2 + 9, product* 2 * 3 * 4 * 8 * 3 * 3 * 2 * 9, index + 92338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 2 + 9, product* 2 * 7 * 2 * 2 * 4 * 3 * 2 * 9, index + 92342272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 3 + 2 + 9, product* 6 * 9 * 2 * 3 * 4 * 3 * 2 * 9, index + 92343296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 3 + 2 + 9, product* 2 * 3 * 8 * 4 * 4 * 3 * 2 * 9, index + 92344832);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 4 + 3 + 2 + 9, product* 8 * 4 * 6 * 7 * 4 * 3 * 2 * 9, index + 92347648);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 3 + 2 + 9, product* 4 * 6 * 2 * 3 * 6 * 3 * 2 * 9, index + 92363264);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 6 + 3 + 2 + 9, product* 8 * 8 * 2 * 4 * 6 * 3 * 2 * 9, index + 92364288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 6 + 3 + 2 + 9, product* 6 * 3 * 3 * 6 * 6 * 3 * 2 * 9, index + 92366336);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 3 + 2 + 9, product* 4 * 8 * 3 * 8 * 6 * 3 * 2 * 9, index + 92368384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 2 + 9, product* 4 * 2 * 2 * 2 * 7 * 3 * 2 * 9, index + 92372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 2 + 9, product* 6 * 3 * 7 * 2 * 7 * 3 * 2 * 9, index + 92372736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 2 + 9, product* 8 * 4 * 2 * 3 * 7 * 3 * 2 * 9, index + 92373248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 7 + 3 + 2 + 9, product* 2 * 7 * 2 * 4 * 7 * 3 * 2 * 9, index + 92374272);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 7 + 3 + 2 + 9, product* 4 * 2 * 6 * 8 * 7 * 3 * 2 * 9, index + 92378624);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 2 + 9, product* 4 * 6 * 4 * 2 * 8 * 3 * 2 * 9, index + 92382464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 2 + 9, product* 2 * 3 * 2 * 3 * 8 * 3 * 2 * 9, index + 92383232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 9 + 3 + 2 + 9, product* 8 * 4 * 4 * 2 * 9 * 3 * 2 * 9, index + 92392448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 9 + 3 + 2 + 9, product* 2 * 7 * 4 * 3 * 9 * 3 * 2 * 9, index + 92393472);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 2 + 9, product* 4 * 2 * 4 * 3 * 2 * 4 * 2 * 9, index + 92423424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 4 + 2 + 9, product* 4 * 6 * 2 * 7 * 2 * 4 * 2 * 9, index + 92427264);
-body<0>(stream, sum+ 8 + 8 + 2 + 8 + 2 + 4 + 2 + 9, product* 8 * 8 * 2 * 8 * 2 * 4 * 2 * 9, index + 92428288);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 4 + 2 + 9, product* 4 * 2 * 8 * 9 * 2 * 4 * 2 * 9, index + 92429824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 4 + 2 + 9, product* 4 * 8 * 3 * 2 * 3 * 4 * 2 * 9, index + 92432384);
-body<0>(stream, sum+ 6 + 9 + 8 + 2 + 3 + 4 + 2 + 9, product* 6 * 9 * 8 * 2 * 3 * 4 * 2 * 9, index + 92432896);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 2 + 9, product* 4 * 6 * 6 * 3 * 3 * 4 * 2 * 9, index + 92433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 2 + 9, product* 2 * 3 * 4 * 4 * 3 * 4 * 2 * 9, index + 92434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 2 + 9, product* 4 * 2 * 2 * 6 * 3 * 4 * 2 * 9, index + 92436224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 2 + 9, product* 4 * 2 * 6 * 2 * 4 * 4 * 2 * 9, index + 92442624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 4 + 2 + 9, product* 2 * 7 * 6 * 4 * 4 * 4 * 2 * 9, index + 92444672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 4 + 2 + 9, product* 8 * 2 * 9 * 4 * 4 * 4 * 2 * 9, index + 92444928);
-body<0>(stream, sum+ 6 + 7 + 9 + 6 + 4 + 4 + 2 + 9, product* 6 * 7 * 9 * 6 * 4 * 4 * 2 * 9, index + 92446976);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 4 + 2 + 9, product* 2 * 3 * 2 * 7 * 4 * 4 * 2 * 9, index + 92447232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 4 + 2 + 9, product* 4 * 4 * 7 * 7 * 4 * 4 * 2 * 9, index + 92447744);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 2 + 9, product* 6 * 3 * 3 * 2 * 6 * 4 * 2 * 9, index + 92462336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 2 + 9, product* 4 * 2 * 2 * 8 * 6 * 4 * 2 * 9, index + 92468224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 6 + 4 + 2 + 9, product* 8 * 4 * 2 * 9 * 6 * 4 * 2 * 9, index + 92469248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 2 + 9, product* 2 * 3 * 8 * 2 * 7 * 4 * 2 * 9, index + 92472832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 4 + 2 + 9, product* 4 * 4 * 3 * 3 * 7 * 4 * 2 * 9, index + 92473344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 4 + 2 + 9, product* 4 * 2 * 6 * 4 * 7 * 4 * 2 * 9, index + 92474624);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 4 + 2 + 9, product* 4 * 6 * 4 * 8 * 7 * 4 * 2 * 9, index + 92478464);
-body<0>(stream, sum+ 6 + 7 + 9 + 8 + 7 + 4 + 2 + 9, product* 6 * 7 * 9 * 8 * 7 * 4 * 2 * 9, index + 92478976);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 4 + 2 + 9, product* 2 * 3 * 2 * 9 * 7 * 4 * 2 * 9, index + 92479232);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 7 + 4 + 2 + 9, product* 4 * 4 * 7 * 9 * 7 * 4 * 2 * 9, index + 92479744);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 4 + 2 + 9, product* 8 * 2 * 3 * 3 * 8 * 4 * 2 * 9, index + 92483328);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 9 + 4 + 2 + 9, product* 6 * 3 * 3 * 4 * 9 * 4 * 2 * 9, index + 92494336);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 2 + 9, product* 6 * 3 * 3 * 2 * 2 * 6 * 2 * 9, index + 92622336);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 6 + 2 + 9, product* 4 * 8 * 3 * 4 * 2 * 6 * 2 * 9, index + 92624384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 2 + 9, product* 2 * 3 * 4 * 6 * 2 * 6 * 2 * 9, index + 92626432);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 2 + 9, product* 2 * 3 * 8 * 2 * 3 * 6 * 2 * 9, index + 92632832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 2 + 9, product* 4 * 2 * 6 * 4 * 3 * 6 * 2 * 9, index + 92634624);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 6 + 2 + 9, product* 4 * 6 * 4 * 8 * 3 * 6 * 2 * 9, index + 92638464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 6 + 2 + 9, product* 2 * 3 * 2 * 9 * 3 * 6 * 2 * 9, index + 92639232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 6 + 2 + 9, product* 8 * 2 * 3 * 3 * 4 * 6 * 2 * 9, index + 92643328);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 2 + 9, product* 2 * 7 * 2 * 2 * 6 * 6 * 2 * 9, index + 92662272);
-body<0>(stream, sum+ 4 + 8 + 7 + 2 + 6 + 6 + 2 + 9, product* 4 * 8 * 7 * 2 * 6 * 6 * 2 * 9, index + 92662784);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 6 + 6 + 2 + 9, product* 2 * 9 * 3 * 7 * 6 * 6 * 2 * 9, index + 92667392);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 6 + 2 + 9, product* 2 * 3 * 6 * 7 * 7 * 6 * 2 * 9, index + 92677632);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 6 + 2 + 9, product* 4 * 2 * 4 * 9 * 7 * 6 * 2 * 9, index + 92679424);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 8 + 6 + 2 + 9, product* 6 * 9 * 4 * 2 * 8 * 6 * 2 * 9, index + 92682496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 6 + 2 + 9, product* 4 * 6 * 2 * 3 * 8 * 6 * 2 * 9, index + 92683264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 6 + 2 + 9, product* 4 * 2 * 2 * 2 * 9 * 6 * 2 * 9, index + 92692224);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 2 + 9, product* 2 * 3 * 4 * 2 * 2 * 7 * 2 * 9, index + 92722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 2 + 9, product* 4 * 4 * 9 * 2 * 2 * 7 * 2 * 9, index + 92722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 2 + 9, product* 4 * 2 * 2 * 4 * 2 * 7 * 2 * 9, index + 92724224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 2 + 9, product* 2 * 7 * 2 * 6 * 2 * 7 * 2 * 9, index + 92726272);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 7 + 2 + 9, product* 2 * 3 * 8 * 8 * 2 * 7 * 2 * 9, index + 92728832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 7 + 2 + 9, product* 4 * 4 * 3 * 9 * 2 * 7 * 2 * 9, index + 92729344);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 7 + 2 + 9, product* 2 * 7 * 6 * 2 * 3 * 7 * 2 * 9, index + 92732672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 7 + 2 + 9, product* 8 * 2 * 9 * 2 * 3 * 7 * 2 * 9, index + 92732928);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 3 + 7 + 2 + 9, product* 6 * 7 * 9 * 4 * 3 * 7 * 2 * 9, index + 92734976);
-body<0>(stream, sum+ 8 + 2 + 3 + 9 + 3 + 7 + 2 + 9, product* 8 * 2 * 3 * 9 * 3 * 7 * 2 * 9, index + 92739328);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 4 + 7 + 2 + 9, product* 4 * 6 * 2 * 7 * 4 * 7 * 2 * 9, index + 92747264);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 7 + 2 + 9, product* 4 * 2 * 6 * 2 * 6 * 7 * 2 * 9, index + 92762624);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 6 + 7 + 2 + 9, product* 4 * 6 * 4 * 6 * 6 * 7 * 2 * 9, index + 92766464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 7 + 2 + 9, product* 2 * 3 * 2 * 7 * 6 * 7 * 2 * 9, index + 92767232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 7 + 2 + 9, product* 2 * 3 * 6 * 3 * 7 * 7 * 2 * 9, index + 92773632);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 7 + 2 + 9, product* 4 * 2 * 2 * 8 * 8 * 7 * 2 * 9, index + 92788224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 7 + 2 + 9, product* 4 * 4 * 3 * 3 * 9 * 7 * 2 * 9, index + 92793344);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 2 + 9, product* 2 * 7 * 2 * 2 * 2 * 8 * 2 * 9, index + 92822272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 8 + 2 + 9, product* 6 * 9 * 2 * 3 * 2 * 8 * 2 * 9, index + 92823296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 8 + 2 + 9, product* 2 * 3 * 8 * 4 * 2 * 8 * 2 * 9, index + 92824832);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 8 + 2 + 9, product* 2 * 9 * 7 * 3 * 3 * 8 * 2 * 9, index + 92833792);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 8 + 2 + 9, product* 2 * 3 * 6 * 7 * 3 * 8 * 2 * 9, index + 92837632);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 8 + 2 + 9, product* 8 * 8 * 2 * 4 * 4 * 8 * 2 * 9, index + 92844288);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 8 + 2 + 9, product* 6 * 3 * 3 * 6 * 4 * 8 * 2 * 9, index + 92846336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 8 + 2 + 9, product* 2 * 3 * 2 * 3 * 6 * 8 * 2 * 9, index + 92863232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 8 + 2 + 9, product* 2 * 3 * 4 * 2 * 8 * 8 * 2 * 9, index + 92882432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 2 + 9, product* 4 * 2 * 2 * 4 * 8 * 8 * 2 * 9, index + 92884224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 2 + 9, product* 4 * 2 * 6 * 2 * 2 * 9 * 2 * 9, index + 92922624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 2 + 9 + 2 + 9, product* 2 * 7 * 6 * 4 * 2 * 9 * 2 * 9, index + 92924672);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 9 + 2 + 9, product* 4 * 4 * 7 * 7 * 2 * 9 * 2 * 9, index + 92927744);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 9 + 2 + 9, product* 8 * 2 * 7 * 7 * 3 * 9 * 2 * 9, index + 92937728);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 4 + 9 + 2 + 9, product* 8 * 4 * 8 * 2 * 4 * 9 * 2 * 9, index + 92942848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 9 + 2 + 9, product* 2 * 7 * 8 * 3 * 4 * 9 * 2 * 9, index + 92943872);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 9 + 2 + 9, product* 8 * 4 * 2 * 9 * 4 * 9 * 2 * 9, index + 92949248);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 7 + 9 + 2 + 9, product* 2 * 3 * 6 * 3 * 7 * 9 * 2 * 9, index + 92973632);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 7 + 9 + 2 + 9, product* 2 * 3 * 4 * 8 * 7 * 9 * 2 * 9, index + 92978432);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 9 + 9 + 2 + 9, product* 6 * 7 * 3 * 7 * 9 * 9 * 2 * 9, index + 92997376);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 3 + 9, product* 4 * 2 * 4 * 3 * 2 * 2 * 3 * 9, index + 93223424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 2 + 2 + 3 + 9, product* 6 * 3 * 9 * 3 * 2 * 2 * 3 * 9, index + 93223936);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 2 + 3 + 9, product* 8 * 4 * 4 * 4 * 2 * 2 * 3 * 9, index + 93224448);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 3 + 9, product* 4 * 6 * 2 * 7 * 2 * 2 * 3 * 9, index + 93227264);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 2 + 3 + 9, product* 4 * 8 * 3 * 2 * 3 * 2 * 3 * 9, index + 93232384);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 2 + 3 + 9, product* 4 * 6 * 6 * 3 * 3 * 2 * 3 * 9, index + 93233664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 3 + 9, product* 2 * 3 * 4 * 4 * 3 * 2 * 3 * 9, index + 93234432);
-body<0>(stream, sum+ 8 + 8 + 6 + 4 + 3 + 2 + 3 + 9, product* 8 * 8 * 6 * 4 * 3 * 2 * 3 * 9, index + 93234688);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 3 + 9, product* 4 * 4 * 9 * 4 * 3 * 2 * 3 * 9, index + 93234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 3 + 9, product* 4 * 2 * 2 * 6 * 3 * 2 * 3 * 9, index + 93236224);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 3 + 9, product* 8 * 4 * 2 * 7 * 3 * 2 * 3 * 9, index + 93237248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 3 + 9, product* 2 * 7 * 2 * 8 * 3 * 2 * 3 * 9, index + 93238272);
-body<0>(stream, sum+ 4 + 8 + 7 + 8 + 3 + 2 + 3 + 9, product* 4 * 8 * 7 * 8 * 3 * 2 * 3 * 9, index + 93238784);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 2 + 3 + 9, product* 8 * 6 * 3 * 2 * 4 * 2 * 3 * 9, index + 93242368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 3 + 9, product* 4 * 2 * 6 * 2 * 4 * 2 * 3 * 9, index + 93242624);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 2 + 3 + 9, product* 2 * 7 * 6 * 4 * 4 * 2 * 3 * 9, index + 93244672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 4 + 2 + 3 + 9, product* 8 * 2 * 9 * 4 * 4 * 2 * 3 * 9, index + 93244928);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 2 + 3 + 9, product* 4 * 6 * 4 * 6 * 4 * 2 * 3 * 9, index + 93246464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 3 + 9, product* 2 * 3 * 2 * 7 * 4 * 2 * 3 * 9, index + 93247232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 4 + 2 + 3 + 9, product* 4 * 4 * 7 * 7 * 4 * 2 * 3 * 9, index + 93247744);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 3 + 9, product* 6 * 3 * 3 * 2 * 6 * 2 * 3 * 9, index + 93262336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 2 + 3 + 9, product* 2 * 3 * 2 * 3 * 6 * 2 * 3 * 9, index + 93263232);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 3 + 9, product* 2 * 7 * 8 * 3 * 6 * 2 * 3 * 9, index + 93263872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 6 + 2 + 3 + 9, product* 2 * 3 * 4 * 6 * 6 * 2 * 3 * 9, index + 93266432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 3 + 9, product* 4 * 2 * 2 * 8 * 6 * 2 * 3 * 9, index + 93268224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 6 + 2 + 3 + 9, product* 6 * 3 * 7 * 8 * 6 * 2 * 3 * 9, index + 93268736);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 7 + 2 + 3 + 9, product* 4 * 4 * 3 * 3 * 7 * 2 * 3 * 9, index + 93273344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 7 + 2 + 3 + 9, product* 4 * 2 * 6 * 4 * 7 * 2 * 3 * 9, index + 93274624);
-body<0>(stream, sum+ 2 + 7 + 6 + 6 + 7 + 2 + 3 + 9, product* 2 * 7 * 6 * 6 * 7 * 2 * 3 * 9, index + 93276672);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 7 + 2 + 3 + 9, product* 4 * 6 * 4 * 8 * 7 * 2 * 3 * 9, index + 93278464);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 7 + 2 + 3 + 9, product* 2 * 3 * 2 * 9 * 7 * 2 * 3 * 9, index + 93279232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 2 + 3 + 9, product* 8 * 2 * 3 * 3 * 8 * 2 * 3 * 9, index + 93283328);
-body<0>(stream, sum+ 4 + 8 + 9 + 9 + 8 + 2 + 3 + 9, product* 4 * 8 * 9 * 9 * 8 * 2 * 3 * 9, index + 93289984);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 2 + 3 + 9, product* 4 * 2 * 8 * 3 * 9 * 2 * 3 * 9, index + 93293824);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 9 + 2 + 3 + 9, product* 4 * 6 * 6 * 7 * 9 * 2 * 3 * 9, index + 93297664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 3 + 9, product* 2 * 3 * 4 * 8 * 9 * 2 * 3 * 9, index + 93298432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 3 + 9, product* 6 * 9 * 4 * 2 * 2 * 3 * 3 * 9, index + 93322496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 3 + 9, product* 4 * 6 * 2 * 3 * 2 * 3 * 3 * 9, index + 93323264);
-body<0>(stream, sum+ 6 + 7 + 7 + 3 + 2 + 3 + 3 + 9, product* 6 * 7 * 7 * 3 * 2 * 3 * 3 * 9, index + 93323776);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 3 + 9, product* 2 * 7 * 8 * 7 * 2 * 3 * 3 * 9, index + 93327872);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 2 + 3 + 3 + 9, product* 4 * 8 * 3 * 8 * 2 * 3 * 3 * 9, index + 93328384);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 3 + 9, product* 4 * 2 * 2 * 2 * 3 * 3 * 3 * 9, index + 93332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 3 + 9, product* 6 * 3 * 7 * 2 * 3 * 3 * 3 * 9, index + 93332736);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 3 + 3 + 9, product* 2 * 9 * 9 * 2 * 3 * 3 * 3 * 9, index + 93332992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 3 + 9, product* 2 * 7 * 2 * 4 * 3 * 3 * 3 * 9, index + 93334272);
-body<0>(stream, sum+ 4 + 8 + 7 + 4 + 3 + 3 + 3 + 9, product* 4 * 8 * 7 * 4 * 3 * 3 * 3 * 9, index + 93334784);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 3 + 3 + 3 + 9, product* 2 * 3 * 8 * 6 * 3 * 3 * 3 * 9, index + 93336832);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 3 + 9, product* 4 * 4 * 3 * 7 * 3 * 3 * 3 * 9, index + 93337344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 3 + 3 + 3 + 9, product* 4 * 2 * 6 * 8 * 3 * 3 * 3 * 9, index + 93338624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 3 + 9, product* 2 * 3 * 2 * 3 * 4 * 3 * 3 * 9, index + 93343232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 4 + 3 + 3 + 9, product* 4 * 4 * 7 * 3 * 4 * 3 * 3 * 9, index + 93343744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 4 + 3 + 3 + 9, product* 8 * 2 * 3 * 7 * 4 * 3 * 3 * 9, index + 93347328);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 3 + 9, product* 2 * 3 * 4 * 2 * 6 * 3 * 3 * 9, index + 93362432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 6 + 3 + 3 + 9, product* 8 * 8 * 6 * 2 * 6 * 3 * 3 * 9, index + 93362688);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 3 + 9, product* 4 * 2 * 2 * 4 * 6 * 3 * 3 * 9, index + 93364224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 6 + 3 + 3 + 9, product* 2 * 7 * 2 * 6 * 6 * 3 * 3 * 9, index + 93366272);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 7 + 3 + 3 + 9, product* 2 * 7 * 6 * 2 * 7 * 3 * 3 * 9, index + 93372672);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 7 + 3 + 3 + 9, product* 8 * 2 * 9 * 2 * 7 * 3 * 3 * 9, index + 93372928);
-body<0>(stream, sum+ 6 + 7 + 9 + 4 + 7 + 3 + 3 + 9, product* 6 * 7 * 9 * 4 * 7 * 3 * 3 * 9, index + 93374976);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 8 + 3 + 3 + 9, product* 4 * 2 * 8 * 9 * 8 * 3 * 3 * 9, index + 93389824);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 3 + 9, product* 2 * 3 * 4 * 4 * 9 * 3 * 3 * 9, index + 93394432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 9 + 3 + 3 + 9, product* 4 * 2 * 2 * 6 * 9 * 3 * 3 * 9, index + 93396224);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 3 + 9, product* 6 * 3 * 3 * 2 * 2 * 4 * 3 * 9, index + 93422336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 4 + 3 + 9, product* 8 * 4 * 8 * 2 * 2 * 4 * 3 * 9, index + 93422848);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 3 + 9, product* 4 * 8 * 3 * 4 * 2 * 4 * 3 * 9, index + 93424384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 3 + 9, product* 2 * 3 * 4 * 6 * 2 * 4 * 3 * 9, index + 93426432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 4 + 3 + 9, product* 4 * 2 * 2 * 8 * 2 * 4 * 3 * 9, index + 93428224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 4 + 3 + 9, product* 4 * 4 * 3 * 3 * 3 * 4 * 3 * 9, index + 93433344);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 3 + 4 + 3 + 9, product* 8 * 6 * 3 * 4 * 3 * 4 * 3 * 9, index + 93434368);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 3 + 9, product* 4 * 2 * 6 * 4 * 3 * 4 * 3 * 9, index + 93434624);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 3 + 4 + 3 + 9, product* 4 * 6 * 4 * 8 * 3 * 4 * 3 * 9, index + 93438464);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 4 + 4 + 3 + 9, product* 8 * 2 * 3 * 3 * 4 * 4 * 3 * 9, index + 93443328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 3 + 9, product* 4 * 2 * 4 * 7 * 4 * 4 * 3 * 9, index + 93447424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 4 + 3 + 9, product* 2 * 7 * 4 * 9 * 4 * 4 * 3 * 9, index + 93449472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 4 + 4 + 3 + 9, product* 8 * 2 * 7 * 9 * 4 * 4 * 3 * 9, index + 93449728);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 7 + 4 + 3 + 9, product* 4 * 2 * 4 * 9 * 7 * 4 * 3 * 9, index + 93479424);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 4 + 3 + 9, product* 4 * 2 * 2 * 2 * 9 * 4 * 3 * 9, index + 93492224);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 4 + 3 + 9, product* 2 * 9 * 9 * 2 * 9 * 4 * 3 * 9, index + 93492992);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 4 + 3 + 9, product* 2 * 7 * 2 * 4 * 9 * 4 * 3 * 9, index + 93494272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 9 + 4 + 3 + 9, product* 4 * 4 * 3 * 7 * 9 * 4 * 3 * 9, index + 93497344);
-body<0>(stream, sum+ 4 + 2 + 6 + 8 + 9 + 4 + 3 + 9, product* 4 * 2 * 6 * 8 * 9 * 4 * 3 * 9, index + 93498624);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 6 + 3 + 9, product* 2 * 7 * 2 * 2 * 2 * 6 * 3 * 9, index + 93622272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 2 + 6 + 3 + 9, product* 6 * 9 * 2 * 3 * 2 * 6 * 3 * 9, index + 93623296);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 3 + 9, product* 2 * 9 * 3 * 7 * 2 * 6 * 3 * 9, index + 93627392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 6 + 3 + 9, product* 2 * 7 * 6 * 8 * 2 * 6 * 3 * 9, index + 93628672);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 6 + 3 + 9, product* 2 * 3 * 6 * 7 * 3 * 6 * 3 * 9, index + 93637632);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 4 + 6 + 3 + 9, product* 6 * 3 * 3 * 6 * 4 * 6 * 3 * 9, index + 93646336);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 6 + 3 + 9, product* 4 * 6 * 4 * 2 * 6 * 6 * 3 * 9, index + 93662464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 3 + 9, product* 2 * 3 * 2 * 3 * 6 * 6 * 3 * 9, index + 93663232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 6 + 3 + 9, product* 2 * 3 * 4 * 2 * 8 * 6 * 3 * 9, index + 93682432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 6 + 3 + 9, product* 4 * 2 * 2 * 4 * 8 * 6 * 3 * 9, index + 93684224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 8 + 6 + 3 + 9, product* 2 * 7 * 2 * 6 * 8 * 6 * 3 * 9, index + 93686272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 3 + 9, product* 4 * 2 * 6 * 2 * 2 * 7 * 3 * 9, index + 93722624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 2 + 7 + 3 + 9, product* 8 * 4 * 6 * 3 * 2 * 7 * 3 * 9, index + 93723648);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 7 + 3 + 9, product* 2 * 3 * 2 * 7 * 2 * 7 * 3 * 9, index + 93727232);
-body<0>(stream, sum+ 4 + 4 + 7 + 7 + 2 + 7 + 3 + 9, product* 4 * 4 * 7 * 7 * 2 * 7 * 3 * 9, index + 93727744);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 7 + 3 + 9, product* 2 * 3 * 6 * 3 * 3 * 7 * 3 * 9, index + 93733632);
-body<0>(stream, sum+ 8 + 4 + 4 + 6 + 3 + 7 + 3 + 9, product* 8 * 4 * 4 * 6 * 3 * 7 * 3 * 9, index + 93736448);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 3 + 9, product* 6 * 3 * 3 * 2 * 4 * 7 * 3 * 9, index + 93742336);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 7 + 3 + 9, product* 4 * 2 * 2 * 8 * 4 * 7 * 3 * 9, index + 93748224);
-body<0>(stream, sum+ 6 + 3 + 7 + 8 + 4 + 7 + 3 + 9, product* 6 * 3 * 7 * 8 * 4 * 7 * 3 * 9, index + 93748736);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 4 + 7 + 3 + 9, product* 8 * 4 * 2 * 9 * 4 * 7 * 3 * 9, index + 93749248);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 6 + 7 + 3 + 9, product* 4 * 2 * 4 * 7 * 6 * 7 * 3 * 9, index + 93767424);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 7 + 7 + 3 + 9, product* 8 * 8 * 2 * 2 * 7 * 7 * 3 * 9, index + 93772288);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 7 + 3 + 9, product* 4 * 2 * 8 * 3 * 7 * 7 * 3 * 9, index + 93773824);
-body<0>(stream, sum+ 4 + 8 + 3 + 6 + 7 + 7 + 3 + 9, product* 4 * 8 * 3 * 6 * 7 * 7 * 3 * 9, index + 93776384);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 8 + 7 + 3 + 9, product* 6 * 9 * 2 * 3 * 8 * 7 * 3 * 9, index + 93783296);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 8 + 7 + 3 + 9, product* 4 * 2 * 6 * 6 * 8 * 7 * 3 * 9, index + 93786624);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 9 + 7 + 3 + 9, product* 2 * 9 * 9 * 2 * 9 * 7 * 3 * 9, index + 93792992);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 9 + 7 + 3 + 9, product* 2 * 9 * 7 * 3 * 9 * 7 * 3 * 9, index + 93793792);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 8 + 3 + 9, product* 4 * 6 * 4 * 2 * 2 * 8 * 3 * 9, index + 93822464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 3 + 9, product* 2 * 3 * 2 * 3 * 2 * 8 * 3 * 9, index + 93823232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 8 + 3 + 9, product* 4 * 4 * 7 * 3 * 2 * 8 * 3 * 9, index + 93823744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 8 + 3 + 9, product* 8 * 2 * 3 * 7 * 2 * 8 * 3 * 9, index + 93827328);
-body<0>(stream, sum+ 2 + 7 + 8 + 9 + 3 + 8 + 3 + 9, product* 2 * 7 * 8 * 9 * 3 * 8 * 3 * 9, index + 93839872);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 8 + 3 + 9, product* 4 * 4 * 9 * 2 * 4 * 8 * 3 * 9, index + 93842944);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 4 + 8 + 3 + 9, product* 8 * 6 * 9 * 3 * 4 * 8 * 3 * 9, index + 93843968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 3 + 9, product* 4 * 2 * 2 * 4 * 4 * 8 * 3 * 9, index + 93844224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 8 + 3 + 9, product* 2 * 7 * 2 * 6 * 4 * 8 * 3 * 9, index + 93846272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 8 + 3 + 9, product* 4 * 2 * 4 * 3 * 6 * 8 * 3 * 9, index + 93863424);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 8 + 3 + 9, product* 2 * 3 * 4 * 4 * 7 * 8 * 3 * 9, index + 93874432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 8 + 3 + 9, product* 4 * 2 * 2 * 6 * 7 * 8 * 3 * 9, index + 93876224);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 3 + 9, product* 2 * 3 * 2 * 7 * 8 * 8 * 3 * 9, index + 93887232);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 9 + 3 + 9, product* 8 * 2 * 3 * 3 * 2 * 9 * 3 * 9, index + 93923328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 9 + 3 + 9, product* 4 * 2 * 4 * 7 * 2 * 9 * 3 * 9, index + 93927424);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 3 + 9, product* 6 * 3 * 3 * 4 * 3 * 9 * 3 * 9, index + 93934336);
-body<0>(stream, sum+ 4 + 6 + 6 + 7 + 3 + 9 + 3 + 9, product* 4 * 6 * 6 * 7 * 3 * 9 * 3 * 9, index + 93937664);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 9 + 3 + 9, product* 2 * 3 * 4 * 8 * 3 * 9 * 3 * 9, index + 93938432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 9 + 3 + 9, product* 2 * 7 * 2 * 2 * 4 * 9 * 3 * 9, index + 93942272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 9 + 3 + 9, product* 6 * 9 * 2 * 3 * 4 * 9 * 3 * 9, index + 93943296);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 9 + 3 + 9, product* 4 * 6 * 2 * 3 * 6 * 9 * 3 * 9, index + 93963264);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 9 + 3 + 9, product* 2 * 9 * 3 * 3 * 6 * 9 * 3 * 9, index + 93963392);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 9 + 3 + 9, product* 4 * 2 * 2 * 2 * 7 * 9 * 3 * 9, index + 93972224);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 9 + 3 + 9, product* 2 * 3 * 2 * 3 * 8 * 9 * 3 * 9, index + 93983232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 4 + 9, product* 6 * 3 * 3 * 2 * 2 * 2 * 4 * 9, index + 94222336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 2 + 4 + 9, product* 8 * 4 * 8 * 2 * 2 * 2 * 4 * 9, index + 94222848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 2 + 4 + 9, product* 2 * 7 * 8 * 3 * 2 * 2 * 4 * 9, index + 94223872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 2 + 4 + 9, product* 4 * 8 * 3 * 4 * 2 * 2 * 4 * 9, index + 94224384);
-body<0>(stream, sum+ 6 + 9 + 8 + 4 + 2 + 2 + 4 + 9, product* 6 * 9 * 8 * 4 * 2 * 2 * 4 * 9, index + 94224896);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 4 + 9, product* 2 * 3 * 4 * 6 * 2 * 2 * 4 * 9, index + 94226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 4 + 9, product* 4 * 4 * 9 * 6 * 2 * 2 * 4 * 9, index + 94226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 4 + 9, product* 4 * 2 * 2 * 8 * 2 * 2 * 4 * 9, index + 94228224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 4 + 9, product* 2 * 3 * 8 * 2 * 3 * 2 * 4 * 9, index + 94232832);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 3 + 2 + 4 + 9, product* 4 * 4 * 3 * 3 * 3 * 2 * 4 * 9, index + 94233344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 4 + 9, product* 4 * 2 * 6 * 4 * 3 * 2 * 4 * 9, index + 94234624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 4 + 9, product* 2 * 3 * 2 * 9 * 3 * 2 * 4 * 9, index + 94239232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 4 + 9, product* 4 * 2 * 4 * 7 * 4 * 2 * 4 * 9, index + 94247424);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 4 + 2 + 4 + 9, product* 2 * 7 * 4 * 9 * 4 * 2 * 4 * 9, index + 94249472);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 4 + 9, product* 2 * 7 * 2 * 2 * 6 * 2 * 4 * 9, index + 94262272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 2 + 4 + 9, product* 2 * 3 * 8 * 4 * 6 * 2 * 4 * 9, index + 94264832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 2 + 4 + 9, product* 4 * 2 * 6 * 6 * 6 * 2 * 4 * 9, index + 94266624);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 2 + 4 + 9, product* 8 * 6 * 7 * 2 * 7 * 2 * 4 * 9, index + 94272768);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 7 + 2 + 4 + 9, product* 2 * 3 * 6 * 7 * 7 * 2 * 4 * 9, index + 94277632);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 8 + 2 + 4 + 9, product* 4 * 6 * 2 * 3 * 8 * 2 * 4 * 9, index + 94283264);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 4 + 9, product* 4 * 6 * 6 * 9 * 8 * 2 * 4 * 9, index + 94289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 4 + 9, product* 4 * 2 * 2 * 2 * 9 * 2 * 4 * 9, index + 94292224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 9 + 2 + 4 + 9, product* 6 * 3 * 7 * 2 * 9 * 2 * 4 * 9, index + 94292736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 9 + 2 + 4 + 9, product* 8 * 4 * 2 * 3 * 9 * 2 * 4 * 9, index + 94293248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 4 + 9, product* 2 * 7 * 2 * 4 * 9 * 2 * 4 * 9, index + 94294272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 4 + 9, product* 2 * 3 * 4 * 2 * 2 * 3 * 4 * 9, index + 94322432);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 4 + 9, product* 4 * 2 * 2 * 4 * 2 * 3 * 4 * 9, index + 94324224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 4 + 9, product* 2 * 7 * 2 * 6 * 2 * 3 * 4 * 9, index + 94326272);
-body<0>(stream, sum+ 4 + 8 + 7 + 6 + 2 + 3 + 4 + 9, product* 4 * 8 * 7 * 6 * 2 * 3 * 4 * 9, index + 94326784);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 2 + 3 + 4 + 9, product* 2 * 3 * 8 * 8 * 2 * 3 * 4 * 9, index + 94328832);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 2 + 3 + 4 + 9, product* 4 * 4 * 3 * 9 * 2 * 3 * 4 * 9, index + 94329344);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 3 + 3 + 4 + 9, product* 8 * 2 * 9 * 2 * 3 * 3 * 4 * 9, index + 94332928);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 4 + 9, product* 4 * 2 * 4 * 3 * 4 * 3 * 4 * 9, index + 94343424);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 6 + 3 + 4 + 9, product* 4 * 2 * 6 * 2 * 6 * 3 * 4 * 9, index + 94362624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 6 + 3 + 4 + 9, product* 2 * 9 * 3 * 3 * 6 * 3 * 4 * 9, index + 94363392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 6 + 3 + 4 + 9, product* 2 * 7 * 6 * 4 * 6 * 3 * 4 * 9, index + 94364672);
-body<0>(stream, sum+ 8 + 2 + 9 + 4 + 6 + 3 + 4 + 9, product* 8 * 2 * 9 * 4 * 6 * 3 * 4 * 9, index + 94364928);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 6 + 3 + 4 + 9, product* 2 * 3 * 2 * 7 * 6 * 3 * 4 * 9, index + 94367232);
-body<0>(stream, sum+ 8 + 8 + 4 + 7 + 6 + 3 + 4 + 9, product* 8 * 8 * 4 * 7 * 6 * 3 * 4 * 9, index + 94367488);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 8 + 3 + 4 + 9, product* 2 * 3 * 4 * 6 * 8 * 3 * 4 * 9, index + 94386432);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 8 + 3 + 4 + 9, product* 4 * 2 * 2 * 8 * 8 * 3 * 4 * 9, index + 94388224);
-body<0>(stream, sum+ 4 + 4 + 3 + 3 + 9 + 3 + 4 + 9, product* 4 * 4 * 3 * 3 * 9 * 3 * 4 * 9, index + 94393344);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 9 + 3 + 4 + 9, product* 4 * 2 * 6 * 4 * 9 * 3 * 4 * 9, index + 94394624);
-body<0>(stream, sum+ 4 + 4 + 7 + 9 + 9 + 3 + 4 + 9, product* 4 * 4 * 7 * 9 * 9 * 3 * 4 * 9, index + 94399744);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 4 + 4 + 9, product* 2 * 7 * 2 * 2 * 2 * 4 * 4 * 9, index + 94422272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 4 + 9, product* 2 * 3 * 8 * 4 * 2 * 4 * 4 * 9, index + 94424832);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 4 + 4 + 9, product* 2 * 9 * 3 * 7 * 2 * 4 * 4 * 9, index + 94427392);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 2 + 4 + 4 + 9, product* 2 * 7 * 6 * 8 * 2 * 4 * 4 * 9, index + 94428672);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 3 + 4 + 4 + 9, product* 2 * 9 * 7 * 3 * 3 * 4 * 4 * 9, index + 94433792);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 3 + 4 + 4 + 9, product* 2 * 3 * 6 * 7 * 3 * 4 * 4 * 9, index + 94437632);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 4 + 4 + 4 + 9, product* 4 * 6 * 6 * 9 * 4 * 4 * 4 * 9, index + 94449664);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 4 + 9, product* 2 * 3 * 2 * 3 * 6 * 4 * 4 * 9, index + 94463232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 6 + 4 + 4 + 9, product* 2 * 3 * 6 * 9 * 6 * 4 * 4 * 9, index + 94469632);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 4 + 4 + 9, product* 8 * 2 * 7 * 3 * 7 * 4 * 4 * 9, index + 94473728);
-body<0>(stream, sum+ 8 + 4 + 8 + 8 + 7 + 4 + 4 + 9, product* 8 * 4 * 8 * 8 * 7 * 4 * 4 * 9, index + 94478848);
-body<0>(stream, sum+ 8 + 2 + 9 + 2 + 9 + 4 + 4 + 9, product* 8 * 2 * 9 * 2 * 9 * 4 * 4 * 9, index + 94492928);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 4 + 9, product* 4 * 6 * 4 * 2 * 2 * 6 * 4 * 9, index + 94622464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 4 + 9, product* 2 * 3 * 2 * 3 * 2 * 6 * 4 * 9, index + 94623232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 4 + 9, product* 4 * 4 * 7 * 3 * 2 * 6 * 4 * 9, index + 94623744);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 6 + 4 + 9, product* 8 * 4 * 4 * 2 * 3 * 6 * 4 * 9, index + 94632448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 4 + 9, product* 2 * 7 * 4 * 3 * 3 * 6 * 4 * 9, index + 94633472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 6 + 4 + 9, product* 8 * 2 * 7 * 3 * 3 * 6 * 4 * 9, index + 94633728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 6 + 4 + 9, product* 6 * 9 * 4 * 4 * 3 * 6 * 4 * 9, index + 94634496);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 4 + 9, product* 2 * 3 * 4 * 2 * 4 * 6 * 4 * 9, index + 94642432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 6 + 4 + 9, product* 4 * 4 * 9 * 2 * 4 * 6 * 4 * 9, index + 94642944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 6 + 4 + 9, product* 4 * 2 * 2 * 4 * 4 * 6 * 4 * 9, index + 94644224);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 4 + 6 + 4 + 9, product* 6 * 9 * 2 * 7 * 4 * 6 * 4 * 9, index + 94647296);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 4 + 9, product* 4 * 2 * 4 * 3 * 6 * 6 * 4 * 9, index + 94663424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 4 + 9, product* 4 * 8 * 3 * 2 * 7 * 6 * 4 * 9, index + 94672384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 4 + 9, product* 2 * 3 * 4 * 4 * 7 * 6 * 4 * 9, index + 94674432);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 7 + 6 + 4 + 9, product* 2 * 9 * 9 * 6 * 7 * 6 * 4 * 9, index + 94676992);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 4 + 9, product* 8 * 2 * 3 * 3 * 2 * 7 * 4 * 9, index + 94723328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 7 + 4 + 9, product* 4 * 2 * 4 * 7 * 2 * 7 * 4 * 9, index + 94727424);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 7 + 4 + 9, product* 6 * 3 * 3 * 4 * 3 * 7 * 4 * 9, index + 94734336);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 4 + 7 + 4 + 9, product* 6 * 9 * 2 * 3 * 4 * 7 * 4 * 9, index + 94743296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 4 + 7 + 4 + 9, product* 2 * 3 * 8 * 4 * 4 * 7 * 4 * 9, index + 94744832);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 6 + 7 + 4 + 9, product* 4 * 6 * 2 * 3 * 6 * 7 * 4 * 9, index + 94763264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 7 + 4 + 9, product* 4 * 2 * 2 * 2 * 7 * 7 * 4 * 9, index + 94772224);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 7 + 4 + 9, product* 2 * 3 * 2 * 3 * 8 * 7 * 4 * 9, index + 94783232);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 8 + 7 + 4 + 9, product* 8 * 2 * 3 * 7 * 8 * 7 * 4 * 9, index + 94787328);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 4 + 9, product* 4 * 2 * 4 * 3 * 2 * 8 * 4 * 9, index + 94823424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 8 + 4 + 9, product* 8 * 4 * 4 * 4 * 2 * 8 * 4 * 9, index + 94824448);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 8 + 4 + 9, product* 4 * 2 * 2 * 6 * 3 * 8 * 4 * 9, index + 94836224);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 8 + 4 + 9, product* 2 * 7 * 2 * 8 * 3 * 8 * 4 * 9, index + 94838272);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 4 + 8 + 4 + 9, product* 8 * 6 * 3 * 2 * 4 * 8 * 4 * 9, index + 94842368);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 4 + 9, product* 2 * 9 * 3 * 3 * 4 * 8 * 4 * 9, index + 94843392);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 4 + 8 + 4 + 9, product* 2 * 7 * 6 * 4 * 4 * 8 * 4 * 9, index + 94844672);
-body<0>(stream, sum+ 4 + 6 + 4 + 6 + 4 + 8 + 4 + 9, product* 4 * 6 * 4 * 6 * 4 * 8 * 4 * 9, index + 94846464);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 8 + 4 + 9, product* 2 * 3 * 2 * 7 * 4 * 8 * 4 * 9, index + 94847232);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 9 + 8 + 4 + 9, product* 4 * 2 * 8 * 3 * 9 * 8 * 4 * 9, index + 94893824);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 4 + 9, product* 4 * 6 * 2 * 3 * 2 * 9 * 4 * 9, index + 94923264);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 9 + 4 + 9, product* 4 * 2 * 2 * 2 * 3 * 9 * 4 * 9, index + 94932224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 9 + 4 + 9, product* 6 * 3 * 7 * 2 * 3 * 9 * 4 * 9, index + 94932736);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 9 + 4 + 9, product* 2 * 7 * 2 * 4 * 3 * 9 * 4 * 9, index + 94934272);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 4 + 9 + 4 + 9, product* 4 * 6 * 4 * 2 * 4 * 9 * 4 * 9, index + 94942464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 9 + 4 + 9, product* 2 * 3 * 2 * 3 * 4 * 9 * 4 * 9, index + 94943232);
-body<0>(stream, sum+ 2 + 3 + 6 + 9 + 4 + 9 + 4 + 9, product* 2 * 3 * 6 * 9 * 4 * 9 * 4 * 9, index + 94949632);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 9 + 4 + 9, product* 4 * 4 * 9 * 2 * 6 * 9 * 4 * 9, index + 94962944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 9 + 4 + 9, product* 4 * 2 * 2 * 4 * 6 * 9 * 4 * 9, index + 94964224);
-body<0>(stream, sum+ 6 + 7 + 9 + 2 + 2 + 2 + 6 + 9, product* 6 * 7 * 9 * 2 * 2 * 2 * 6 * 9, index + 96222976);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 2 + 6 + 9, product* 2 * 3 * 2 * 3 * 2 * 2 * 6 * 9, index + 96223232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 2 + 6 + 9, product* 4 * 4 * 7 * 3 * 2 * 2 * 6 * 9, index + 96223744);
-body<0>(stream, sum+ 8 + 6 + 7 + 4 + 2 + 2 + 6 + 9, product* 8 * 6 * 7 * 4 * 2 * 2 * 6 * 9, index + 96224768);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 2 + 2 + 6 + 9, product* 4 * 6 * 8 * 8 * 2 * 2 * 6 * 9, index + 96228864);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 2 + 6 + 9, product* 2 * 7 * 4 * 3 * 3 * 2 * 6 * 9, index + 96233472);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 3 + 2 + 6 + 9, product* 8 * 2 * 7 * 3 * 3 * 2 * 6 * 9, index + 96233728);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 3 + 2 + 6 + 9, product* 6 * 9 * 4 * 4 * 3 * 2 * 6 * 9, index + 96234496);
-body<0>(stream, sum+ 6 + 3 + 9 + 9 + 3 + 2 + 6 + 9, product* 6 * 3 * 9 * 9 * 3 * 2 * 6 * 9, index + 96239936);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 2 + 6 + 9, product* 2 * 3 * 4 * 2 * 4 * 2 * 6 * 9, index + 96242432);
-body<0>(stream, sum+ 8 + 8 + 6 + 2 + 4 + 2 + 6 + 9, product* 8 * 8 * 6 * 2 * 4 * 2 * 6 * 9, index + 96242688);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 4 + 2 + 6 + 9, product* 4 * 4 * 9 * 2 * 4 * 2 * 6 * 9, index + 96242944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 2 + 6 + 9, product* 4 * 2 * 2 * 4 * 4 * 2 * 6 * 9, index + 96244224);
-body<0>(stream, sum+ 2 + 3 + 8 + 8 + 4 + 2 + 6 + 9, product* 2 * 3 * 8 * 8 * 4 * 2 * 6 * 9, index + 96248832);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 2 + 6 + 9, product* 4 * 2 * 4 * 3 * 6 * 2 * 6 * 9, index + 96263424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 6 + 2 + 6 + 9, product* 8 * 4 * 4 * 4 * 6 * 2 * 6 * 9, index + 96264448);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 2 + 6 + 9, product* 4 * 8 * 3 * 2 * 7 * 2 * 6 * 9, index + 96272384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 2 + 6 + 9, product* 2 * 3 * 4 * 4 * 7 * 2 * 6 * 9, index + 96274432);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 8 + 2 + 6 + 9, product* 4 * 2 * 6 * 2 * 8 * 2 * 6 * 9, index + 96282624);
-body<0>(stream, sum+ 8 + 4 + 6 + 3 + 8 + 2 + 6 + 9, product* 8 * 4 * 6 * 3 * 8 * 2 * 6 * 9, index + 96283648);
-body<0>(stream, sum+ 2 + 7 + 6 + 4 + 8 + 2 + 6 + 9, product* 2 * 7 * 6 * 4 * 8 * 2 * 6 * 9, index + 96284672);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 2 + 6 + 9, product* 2 * 3 * 6 * 3 * 9 * 2 * 6 * 9, index + 96293632);
-body<0>(stream, sum+ 2 + 7 + 4 + 7 + 9 + 2 + 6 + 9, product* 2 * 7 * 4 * 7 * 9 * 2 * 6 * 9, index + 96297472);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 3 + 6 + 9, product* 8 * 2 * 3 * 3 * 2 * 3 * 6 * 9, index + 96323328);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 2 + 3 + 6 + 9, product* 4 * 2 * 4 * 7 * 2 * 3 * 6 * 9, index + 96327424);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 3 + 6 + 9, product* 8 * 2 * 7 * 9 * 2 * 3 * 6 * 9, index + 96329728);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 3 + 3 + 6 + 9, product* 2 * 3 * 4 * 8 * 3 * 3 * 6 * 9, index + 96338432);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 3 + 6 + 9, product* 2 * 7 * 2 * 2 * 4 * 3 * 6 * 9, index + 96342272);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 6 + 3 + 6 + 9, product* 6 * 9 * 4 * 2 * 6 * 3 * 6 * 9, index + 96362496);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 7 + 3 + 6 + 9, product* 4 * 2 * 2 * 2 * 7 * 3 * 6 * 9, index + 96372224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 7 + 3 + 6 + 9, product* 6 * 3 * 7 * 2 * 7 * 3 * 6 * 9, index + 96372736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 7 + 3 + 6 + 9, product* 8 * 4 * 2 * 3 * 7 * 3 * 6 * 9, index + 96373248);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 8 + 3 + 6 + 9, product* 4 * 6 * 4 * 2 * 8 * 3 * 6 * 9, index + 96382464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 8 + 3 + 6 + 9, product* 2 * 3 * 2 * 3 * 8 * 3 * 6 * 9, index + 96383232);
-body<0>(stream, sum+ 4 + 6 + 8 + 8 + 8 + 3 + 6 + 9, product* 4 * 6 * 8 * 8 * 8 * 3 * 6 * 9, index + 96388864);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 4 + 6 + 9, product* 4 * 2 * 4 * 3 * 2 * 4 * 6 * 9, index + 96423424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 2 + 4 + 6 + 9, product* 8 * 4 * 4 * 4 * 2 * 4 * 6 * 9, index + 96424448);
-body<0>(stream, sum+ 4 + 6 + 6 + 3 + 3 + 4 + 6 + 9, product* 4 * 6 * 6 * 3 * 3 * 4 * 6 * 9, index + 96433664);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 4 + 6 + 9, product* 2 * 3 * 4 * 4 * 3 * 4 * 6 * 9, index + 96434432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 4 + 6 + 9, product* 4 * 2 * 2 * 6 * 3 * 4 * 6 * 9, index + 96436224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 4 + 6 + 9, product* 4 * 2 * 6 * 2 * 4 * 4 * 6 * 9, index + 96442624);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 4 + 6 + 9, product* 6 * 3 * 3 * 2 * 6 * 4 * 6 * 9, index + 96462336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 4 + 6 + 9, product* 2 * 7 * 8 * 3 * 6 * 4 * 6 * 9, index + 96463872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 4 + 6 + 9, product* 4 * 2 * 2 * 8 * 6 * 4 * 6 * 9, index + 96468224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 4 + 6 + 9, product* 2 * 3 * 8 * 2 * 7 * 4 * 6 * 9, index + 96472832);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 8 + 4 + 6 + 9, product* 4 * 2 * 4 * 7 * 8 * 4 * 6 * 9, index + 96487424);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 6 + 6 + 9, product* 6 * 3 * 3 * 2 * 2 * 6 * 6 * 9, index + 96622336);
-body<0>(stream, sum+ 8 + 4 + 8 + 2 + 2 + 6 + 6 + 9, product* 8 * 4 * 8 * 2 * 2 * 6 * 6 * 9, index + 96622848);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 6 + 6 + 9, product* 2 * 7 * 8 * 3 * 2 * 6 * 6 * 9, index + 96623872);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 6 + 6 + 9, product* 2 * 3 * 4 * 6 * 2 * 6 * 6 * 9, index + 96626432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 6 + 6 + 9, product* 4 * 4 * 9 * 6 * 2 * 6 * 6 * 9, index + 96626944);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 6 + 6 + 9, product* 2 * 3 * 8 * 2 * 3 * 6 * 6 * 9, index + 96632832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 6 + 6 + 9, product* 4 * 2 * 6 * 4 * 3 * 6 * 6 * 9, index + 96634624);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 6 + 6 + 9, product* 2 * 7 * 2 * 2 * 6 * 6 * 6 * 9, index + 96662272);
-body<0>(stream, sum+ 6 + 9 + 2 + 3 + 6 + 6 + 6 + 9, product* 6 * 9 * 2 * 3 * 6 * 6 * 6 * 9, index + 96663296);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 6 + 6 + 6 + 9, product* 2 * 3 * 8 * 4 * 6 * 6 * 6 * 9, index + 96664832);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 6 + 6 + 6 + 9, product* 4 * 2 * 6 * 6 * 6 * 6 * 6 * 9, index + 96666624);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 6 + 6 + 9, product* 2 * 7 * 2 * 4 * 9 * 6 * 6 * 9, index + 96694272);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 7 + 6 + 9, product* 2 * 3 * 4 * 2 * 2 * 7 * 6 * 9, index + 96722432);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 2 + 7 + 6 + 9, product* 4 * 4 * 9 * 2 * 2 * 7 * 6 * 9, index + 96722944);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 7 + 6 + 9, product* 4 * 2 * 2 * 4 * 2 * 7 * 6 * 9, index + 96724224);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 7 + 6 + 9, product* 2 * 7 * 2 * 6 * 2 * 7 * 6 * 9, index + 96726272);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 8 + 6 + 9, product* 2 * 7 * 2 * 2 * 2 * 8 * 6 * 9, index + 96822272);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 6 + 8 + 6 + 9, product* 4 * 4 * 7 * 3 * 6 * 8 * 6 * 9, index + 96863744);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 8 + 8 + 6 + 9, product* 4 * 2 * 2 * 4 * 8 * 8 * 6 * 9, index + 96884224);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 9 + 6 + 9, product* 4 * 2 * 6 * 2 * 2 * 9 * 6 * 9, index + 96922624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 2 + 9 + 6 + 9, product* 2 * 9 * 3 * 3 * 2 * 9 * 6 * 9, index + 96923392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 9 + 6 + 9, product* 2 * 3 * 2 * 7 * 2 * 9 * 6 * 9, index + 96927232);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 4 + 9 + 6 + 9, product* 4 * 2 * 2 * 8 * 4 * 9 * 6 * 9, index + 96948224);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 8 + 9 + 6 + 9, product* 2 * 7 * 2 * 2 * 8 * 9 * 6 * 9, index + 96982272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 2 + 7 + 9, product* 4 * 2 * 4 * 3 * 2 * 2 * 7 * 9, index + 97223424);
-body<0>(stream, sum+ 4 + 6 + 2 + 7 + 2 + 2 + 7 + 9, product* 4 * 6 * 2 * 7 * 2 * 2 * 7 * 9, index + 97227264);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 3 + 2 + 7 + 9, product* 2 * 3 * 4 * 4 * 3 * 2 * 7 * 9, index + 97234432);
-body<0>(stream, sum+ 4 + 4 + 9 + 4 + 3 + 2 + 7 + 9, product* 4 * 4 * 9 * 4 * 3 * 2 * 7 * 9, index + 97234944);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 3 + 2 + 7 + 9, product* 4 * 2 * 2 * 6 * 3 * 2 * 7 * 9, index + 97236224);
-body<0>(stream, sum+ 2 + 9 + 9 + 6 + 3 + 2 + 7 + 9, product* 2 * 9 * 9 * 6 * 3 * 2 * 7 * 9, index + 97236992);
-body<0>(stream, sum+ 8 + 4 + 2 + 7 + 3 + 2 + 7 + 9, product* 8 * 4 * 2 * 7 * 3 * 2 * 7 * 9, index + 97237248);
-body<0>(stream, sum+ 2 + 7 + 2 + 8 + 3 + 2 + 7 + 9, product* 2 * 7 * 2 * 8 * 3 * 2 * 7 * 9, index + 97238272);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 4 + 2 + 7 + 9, product* 4 * 2 * 6 * 2 * 4 * 2 * 7 * 9, index + 97242624);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 2 + 7 + 9, product* 2 * 9 * 3 * 3 * 4 * 2 * 7 * 9, index + 97243392);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 4 + 2 + 7 + 9, product* 2 * 3 * 2 * 7 * 4 * 2 * 7 * 9, index + 97247232);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 2 + 7 + 9, product* 6 * 3 * 3 * 2 * 6 * 2 * 7 * 9, index + 97262336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 6 + 2 + 7 + 9, product* 2 * 7 * 8 * 3 * 6 * 2 * 7 * 9, index + 97263872);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 6 + 2 + 7 + 9, product* 4 * 2 * 2 * 8 * 6 * 2 * 7 * 9, index + 97268224);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 7 + 2 + 7 + 9, product* 2 * 3 * 8 * 2 * 7 * 2 * 7 * 9, index + 97272832);
-body<0>(stream, sum+ 8 + 6 + 3 + 4 + 7 + 2 + 7 + 9, product* 8 * 6 * 3 * 4 * 7 * 2 * 7 * 9, index + 97274368);
-body<0>(stream, sum+ 8 + 8 + 2 + 2 + 9 + 2 + 7 + 9, product* 8 * 8 * 2 * 2 * 9 * 2 * 7 * 9, index + 97292288);
-body<0>(stream, sum+ 2 + 3 + 4 + 8 + 9 + 2 + 7 + 9, product* 2 * 3 * 4 * 8 * 9 * 2 * 7 * 9, index + 97298432);
-body<0>(stream, sum+ 6 + 9 + 4 + 2 + 2 + 3 + 7 + 9, product* 6 * 9 * 4 * 2 * 2 * 3 * 7 * 9, index + 97322496);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 3 + 7 + 9, product* 4 * 6 * 2 * 3 * 2 * 3 * 7 * 9, index + 97323264);
-body<0>(stream, sum+ 6 + 3 + 3 + 6 + 2 + 3 + 7 + 9, product* 6 * 3 * 3 * 6 * 2 * 3 * 7 * 9, index + 97326336);
-body<0>(stream, sum+ 2 + 7 + 8 + 7 + 2 + 3 + 7 + 9, product* 2 * 7 * 8 * 7 * 2 * 3 * 7 * 9, index + 97327872);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 3 + 3 + 7 + 9, product* 4 * 2 * 2 * 2 * 3 * 3 * 7 * 9, index + 97332224);
-body<0>(stream, sum+ 6 + 3 + 7 + 2 + 3 + 3 + 7 + 9, product* 6 * 3 * 7 * 2 * 3 * 3 * 7 * 9, index + 97332736);
-body<0>(stream, sum+ 8 + 4 + 2 + 3 + 3 + 3 + 7 + 9, product* 8 * 4 * 2 * 3 * 3 * 3 * 7 * 9, index + 97333248);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 3 + 3 + 7 + 9, product* 2 * 7 * 2 * 4 * 3 * 3 * 7 * 9, index + 97334272);
-body<0>(stream, sum+ 4 + 4 + 3 + 7 + 3 + 3 + 7 + 9, product* 4 * 4 * 3 * 7 * 3 * 3 * 7 * 9, index + 97337344);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 3 + 7 + 9, product* 2 * 3 * 2 * 3 * 4 * 3 * 7 * 9, index + 97343232);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 6 + 3 + 7 + 9, product* 2 * 3 * 4 * 2 * 6 * 3 * 7 * 9, index + 97362432);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 6 + 3 + 7 + 9, product* 8 * 6 * 9 * 3 * 6 * 3 * 7 * 9, index + 97363968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 3 + 7 + 9, product* 4 * 2 * 2 * 4 * 6 * 3 * 7 * 9, index + 97364224);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 8 + 3 + 7 + 9, product* 4 * 2 * 4 * 3 * 8 * 3 * 7 * 9, index + 97383424);
-body<0>(stream, sum+ 6 + 3 + 9 + 3 + 8 + 3 + 7 + 9, product* 6 * 3 * 9 * 3 * 8 * 3 * 7 * 9, index + 97383936);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 9 + 3 + 7 + 9, product* 4 * 8 * 3 * 2 * 9 * 3 * 7 * 9, index + 97392384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 9 + 3 + 7 + 9, product* 2 * 3 * 4 * 4 * 9 * 3 * 7 * 9, index + 97394432);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 4 + 7 + 9, product* 6 * 3 * 3 * 2 * 2 * 4 * 7 * 9, index + 97422336);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 2 + 4 + 7 + 9, product* 2 * 7 * 8 * 3 * 2 * 4 * 7 * 9, index + 97423872);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 2 + 4 + 7 + 9, product* 4 * 8 * 3 * 4 * 2 * 4 * 7 * 9, index + 97424384);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 4 + 7 + 9, product* 2 * 3 * 4 * 6 * 2 * 4 * 7 * 9, index + 97426432);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 4 + 7 + 9, product* 4 * 2 * 6 * 4 * 3 * 4 * 7 * 9, index + 97434624);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 4 + 7 + 9, product* 4 * 2 * 4 * 7 * 4 * 4 * 7 * 9, index + 97447424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 4 + 7 + 9, product* 2 * 7 * 2 * 2 * 6 * 4 * 7 * 9, index + 97462272);
-body<0>(stream, sum+ 2 + 9 + 3 + 7 + 2 + 6 + 7 + 9, product* 2 * 9 * 3 * 7 * 2 * 6 * 7 * 9, index + 97627392);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 2 + 6 + 7 + 9, product* 8 * 4 * 6 * 7 * 2 * 6 * 7 * 9, index + 97627648);
-body<0>(stream, sum+ 4 + 2 + 4 + 9 + 3 + 6 + 7 + 9, product* 4 * 2 * 4 * 9 * 3 * 6 * 7 * 9, index + 97639424);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 6 + 7 + 9, product* 2 * 3 * 2 * 3 * 6 * 6 * 7 * 9, index + 97663232);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 7 + 6 + 7 + 9, product* 8 * 4 * 4 * 2 * 7 * 6 * 7 * 9, index + 97672448);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 7 + 6 + 7 + 9, product* 4 * 2 * 8 * 7 * 7 * 6 * 7 * 9, index + 97677824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 7 + 6 + 7 + 9, product* 6 * 3 * 3 * 8 * 7 * 6 * 7 * 9, index + 97678336);
-body<0>(stream, sum+ 8 + 6 + 3 + 2 + 2 + 7 + 7 + 9, product* 8 * 6 * 3 * 2 * 2 * 7 * 7 * 9, index + 97722368);
-body<0>(stream, sum+ 4 + 2 + 6 + 2 + 2 + 7 + 7 + 9, product* 4 * 2 * 6 * 2 * 2 * 7 * 7 * 9, index + 97722624);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 8 + 7 + 9, product* 2 * 3 * 2 * 3 * 2 * 8 * 7 * 9, index + 97823232);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 8 + 7 + 9, product* 4 * 2 * 2 * 4 * 4 * 8 * 7 * 9, index + 97844224);
-body<0>(stream, sum+ 2 + 9 + 9 + 4 + 4 + 8 + 7 + 9, product* 2 * 9 * 9 * 4 * 4 * 8 * 7 * 9, index + 97844992);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 8 + 8 + 7 + 9, product* 2 * 3 * 2 * 7 * 8 * 8 * 7 * 9, index + 97887232);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 3 + 9 + 7 + 9, product* 6 * 3 * 3 * 4 * 3 * 9 * 7 * 9, index + 97934336);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 2 + 2 + 8 + 9, product* 6 * 3 * 3 * 2 * 2 * 2 * 8 * 9, index + 98222336);
-body<0>(stream, sum+ 2 + 3 + 4 + 6 + 2 + 2 + 8 + 9, product* 2 * 3 * 4 * 6 * 2 * 2 * 8 * 9, index + 98226432);
-body<0>(stream, sum+ 4 + 4 + 9 + 6 + 2 + 2 + 8 + 9, product* 4 * 4 * 9 * 6 * 2 * 2 * 8 * 9, index + 98226944);
-body<0>(stream, sum+ 4 + 2 + 2 + 8 + 2 + 2 + 8 + 9, product* 4 * 2 * 2 * 8 * 2 * 2 * 8 * 9, index + 98228224);
-body<0>(stream, sum+ 8 + 4 + 2 + 9 + 2 + 2 + 8 + 9, product* 8 * 4 * 2 * 9 * 2 * 2 * 8 * 9, index + 98229248);
-body<0>(stream, sum+ 2 + 3 + 8 + 2 + 3 + 2 + 8 + 9, product* 2 * 3 * 8 * 2 * 3 * 2 * 8 * 9, index + 98232832);
-body<0>(stream, sum+ 4 + 2 + 6 + 4 + 3 + 2 + 8 + 9, product* 4 * 2 * 6 * 4 * 3 * 2 * 8 * 9, index + 98234624);
-body<0>(stream, sum+ 2 + 3 + 2 + 9 + 3 + 2 + 8 + 9, product* 2 * 3 * 2 * 9 * 3 * 2 * 8 * 9, index + 98239232);
-body<0>(stream, sum+ 4 + 2 + 4 + 7 + 4 + 2 + 8 + 9, product* 4 * 2 * 4 * 7 * 4 * 2 * 8 * 9, index + 98247424);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 6 + 2 + 8 + 9, product* 2 * 7 * 2 * 2 * 6 * 2 * 8 * 9, index + 98262272);
-body<0>(stream, sum+ 8 + 4 + 6 + 7 + 6 + 2 + 8 + 9, product* 8 * 4 * 6 * 7 * 6 * 2 * 8 * 9, index + 98267648);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 6 + 2 + 8 + 9, product* 2 * 7 * 6 * 8 * 6 * 2 * 8 * 9, index + 98268672);
-body<0>(stream, sum+ 2 + 9 + 7 + 3 + 7 + 2 + 8 + 9, product* 2 * 9 * 7 * 3 * 7 * 2 * 8 * 9, index + 98273792);
-body<0>(stream, sum+ 4 + 6 + 6 + 9 + 8 + 2 + 8 + 9, product* 4 * 6 * 6 * 9 * 8 * 2 * 8 * 9, index + 98289664);
-body<0>(stream, sum+ 4 + 2 + 2 + 2 + 9 + 2 + 8 + 9, product* 4 * 2 * 2 * 2 * 9 * 2 * 8 * 9, index + 98292224);
-body<0>(stream, sum+ 2 + 7 + 2 + 4 + 9 + 2 + 8 + 9, product* 2 * 7 * 2 * 4 * 9 * 2 * 8 * 9, index + 98294272);
-body<0>(stream, sum+ 2 + 3 + 8 + 6 + 9 + 2 + 8 + 9, product* 2 * 3 * 8 * 6 * 9 * 2 * 8 * 9, index + 98296832);
-body<0>(stream, sum+ 2 + 9 + 3 + 9 + 9 + 2 + 8 + 9, product* 2 * 9 * 3 * 9 * 9 * 2 * 8 * 9, index + 98299392);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 2 + 3 + 8 + 9, product* 2 * 3 * 4 * 2 * 2 * 3 * 8 * 9, index + 98322432);
-body<0>(stream, sum+ 8 + 6 + 9 + 3 + 2 + 3 + 8 + 9, product* 8 * 6 * 9 * 3 * 2 * 3 * 8 * 9, index + 98323968);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 3 + 8 + 9, product* 4 * 2 * 2 * 4 * 2 * 3 * 8 * 9, index + 98324224);
-body<0>(stream, sum+ 6 + 3 + 7 + 4 + 2 + 3 + 8 + 9, product* 6 * 3 * 7 * 4 * 2 * 3 * 8 * 9, index + 98324736);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 2 + 3 + 8 + 9, product* 2 * 7 * 2 * 6 * 2 * 3 * 8 * 9, index + 98326272);
-body<0>(stream, sum+ 6 + 9 + 2 + 7 + 2 + 3 + 8 + 9, product* 6 * 9 * 2 * 7 * 2 * 3 * 8 * 9, index + 98327296);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 3 + 3 + 8 + 9, product* 2 * 7 * 6 * 2 * 3 * 3 * 8 * 9, index + 98332672);
-body<0>(stream, sum+ 8 + 6 + 7 + 6 + 3 + 3 + 8 + 9, product* 8 * 6 * 7 * 6 * 3 * 3 * 8 * 9, index + 98336768);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 4 + 3 + 8 + 9, product* 4 * 2 * 4 * 3 * 4 * 3 * 8 * 9, index + 98343424);
-body<0>(stream, sum+ 8 + 4 + 4 + 4 + 4 + 3 + 8 + 9, product* 8 * 4 * 4 * 4 * 4 * 3 * 8 * 9, index + 98344448);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 7 + 3 + 8 + 9, product* 8 * 2 * 7 * 7 * 7 * 3 * 8 * 9, index + 98377728);
-body<0>(stream, sum+ 4 + 8 + 3 + 4 + 8 + 3 + 8 + 9, product* 4 * 8 * 3 * 4 * 8 * 3 * 8 * 9, index + 98384384);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 4 + 8 + 9, product* 2 * 3 * 8 * 4 * 2 * 4 * 8 * 9, index + 98424832);
-body<0>(stream, sum+ 8 + 4 + 8 + 6 + 4 + 4 + 8 + 9, product* 8 * 4 * 8 * 6 * 4 * 4 * 8 * 9, index + 98446848);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 6 + 4 + 8 + 9, product* 2 * 3 * 2 * 3 * 6 * 4 * 8 * 9, index + 98463232);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 6 + 8 + 9, product* 4 * 6 * 4 * 2 * 2 * 6 * 8 * 9, index + 98622464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 6 + 8 + 9, product* 2 * 3 * 2 * 3 * 2 * 6 * 8 * 9, index + 98623232);
-body<0>(stream, sum+ 8 + 8 + 4 + 3 + 2 + 6 + 8 + 9, product* 8 * 8 * 4 * 3 * 2 * 6 * 8 * 9, index + 98623488);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 6 + 8 + 9, product* 4 * 4 * 7 * 3 * 2 * 6 * 8 * 9, index + 98623744);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 6 + 8 + 9, product* 2 * 7 * 4 * 3 * 3 * 6 * 8 * 9, index + 98633472);
-body<0>(stream, sum+ 4 + 2 + 8 + 7 + 3 + 6 + 8 + 9, product* 4 * 2 * 8 * 7 * 3 * 6 * 8 * 9, index + 98637824);
-body<0>(stream, sum+ 6 + 3 + 3 + 8 + 3 + 6 + 8 + 9, product* 6 * 3 * 3 * 8 * 3 * 6 * 8 * 9, index + 98638336);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 4 + 6 + 8 + 9, product* 2 * 3 * 4 * 2 * 4 * 6 * 8 * 9, index + 98642432);
-body<0>(stream, sum+ 2 + 7 + 2 + 6 + 4 + 6 + 8 + 9, product* 2 * 7 * 2 * 6 * 4 * 6 * 8 * 9, index + 98646272);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 6 + 6 + 8 + 9, product* 4 * 2 * 4 * 3 * 6 * 6 * 8 * 9, index + 98663424);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 7 + 6 + 8 + 9, product* 4 * 8 * 3 * 2 * 7 * 6 * 8 * 9, index + 98672384);
-body<0>(stream, sum+ 2 + 3 + 4 + 4 + 7 + 6 + 8 + 9, product* 2 * 3 * 4 * 4 * 7 * 6 * 8 * 9, index + 98674432);
-body<0>(stream, sum+ 4 + 2 + 2 + 6 + 7 + 6 + 8 + 9, product* 4 * 2 * 2 * 6 * 7 * 6 * 8 * 9, index + 98676224);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 9 + 6 + 8 + 9, product* 2 * 3 * 6 * 3 * 9 * 6 * 8 * 9, index + 98693632);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 2 + 7 + 8 + 9, product* 8 * 2 * 3 * 3 * 2 * 7 * 8 * 9, index + 98723328);
-body<0>(stream, sum+ 2 + 7 + 4 + 9 + 2 + 7 + 8 + 9, product* 2 * 7 * 4 * 9 * 2 * 7 * 8 * 9, index + 98729472);
-body<0>(stream, sum+ 8 + 2 + 7 + 9 + 2 + 7 + 8 + 9, product* 8 * 2 * 7 * 9 * 2 * 7 * 8 * 9, index + 98729728);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 4 + 7 + 8 + 9, product* 2 * 7 * 2 * 2 * 4 * 7 * 8 * 9, index + 98742272);
-body<0>(stream, sum+ 4 + 2 + 6 + 6 + 4 + 7 + 8 + 9, product* 4 * 2 * 6 * 6 * 4 * 7 * 8 * 9, index + 98746624);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 6 + 7 + 8 + 9, product* 4 * 8 * 3 * 8 * 6 * 7 * 8 * 9, index + 98768384);
-body<0>(stream, sum+ 6 + 9 + 4 + 4 + 9 + 7 + 8 + 9, product* 6 * 9 * 4 * 4 * 9 * 7 * 8 * 9, index + 98794496);
-body<0>(stream, sum+ 4 + 2 + 4 + 3 + 2 + 8 + 8 + 9, product* 4 * 2 * 4 * 3 * 2 * 8 * 8 * 9, index + 98823424);
-body<0>(stream, sum+ 4 + 2 + 8 + 9 + 2 + 8 + 8 + 9, product* 4 * 2 * 8 * 9 * 2 * 8 * 8 * 9, index + 98829824);
-body<0>(stream, sum+ 4 + 8 + 3 + 2 + 3 + 8 + 8 + 9, product* 4 * 8 * 3 * 2 * 3 * 8 * 8 * 9, index + 98832384);
-body<0>(stream, sum+ 2 + 9 + 3 + 3 + 4 + 8 + 8 + 9, product* 2 * 9 * 3 * 3 * 4 * 8 * 8 * 9, index + 98843392);
-body<0>(stream, sum+ 8 + 2 + 3 + 3 + 8 + 8 + 8 + 9, product* 8 * 2 * 3 * 3 * 8 * 8 * 8 * 9, index + 98883328);
-body<0>(stream, sum+ 4 + 6 + 2 + 3 + 2 + 9 + 8 + 9, product* 4 * 6 * 2 * 3 * 2 * 9 * 8 * 9, index + 98923264);
-body<0>(stream, sum+ 2 + 9 + 9 + 2 + 3 + 9 + 8 + 9, product* 2 * 9 * 9 * 2 * 3 * 9 * 8 * 9, index + 98932992);
-body<0>(stream, sum+ 4 + 4 + 9 + 2 + 6 + 9 + 8 + 9, product* 4 * 4 * 9 * 2 * 6 * 9 * 8 * 9, index + 98962944);
-body<0>(stream, sum+ 2 + 7 + 2 + 2 + 2 + 2 + 9 + 9, product* 2 * 7 * 2 * 2 * 2 * 2 * 9 * 9, index + 99222272);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 2 + 2 + 9 + 9, product* 2 * 3 * 8 * 4 * 2 * 2 * 9 * 9, index + 99224832);
-body<0>(stream, sum+ 6 + 7 + 3 + 7 + 3 + 2 + 9 + 9, product* 6 * 7 * 3 * 7 * 3 * 2 * 9 * 9, index + 99237376);
-body<0>(stream, sum+ 8 + 8 + 2 + 4 + 4 + 2 + 9 + 9, product* 8 * 8 * 2 * 4 * 4 * 2 * 9 * 9, index + 99244288);
-body<0>(stream, sum+ 4 + 8 + 3 + 8 + 4 + 2 + 9 + 9, product* 4 * 8 * 3 * 8 * 4 * 2 * 9 * 9, index + 99248384);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 6 + 2 + 9 + 9, product* 4 * 6 * 4 * 2 * 6 * 2 * 9 * 9, index + 99262464);
-body<0>(stream, sum+ 8 + 2 + 7 + 3 + 7 + 2 + 9 + 9, product* 8 * 2 * 7 * 3 * 7 * 2 * 9 * 9, index + 99273728);
-body<0>(stream, sum+ 2 + 3 + 4 + 2 + 8 + 2 + 9 + 9, product* 2 * 3 * 4 * 2 * 8 * 2 * 9 * 9, index + 99282432);
-body<0>(stream, sum+ 2 + 7 + 6 + 2 + 9 + 2 + 9 + 9, product* 2 * 7 * 6 * 2 * 9 * 2 * 9 * 9, index + 99292672);
-body<0>(stream, sum+ 2 + 3 + 2 + 7 + 2 + 3 + 9 + 9, product* 2 * 3 * 2 * 7 * 2 * 3 * 9 * 9, index + 99327232);
-body<0>(stream, sum+ 2 + 3 + 6 + 3 + 3 + 3 + 9 + 9, product* 2 * 3 * 6 * 3 * 3 * 3 * 9 * 9, index + 99333632);
-body<0>(stream, sum+ 8 + 2 + 7 + 7 + 3 + 3 + 9 + 9, product* 8 * 2 * 7 * 7 * 3 * 3 * 9 * 9, index + 99337728);
-body<0>(stream, sum+ 2 + 7 + 8 + 3 + 4 + 3 + 9 + 9, product* 2 * 7 * 8 * 3 * 4 * 3 * 9 * 9, index + 99343872);
-body<0>(stream, sum+ 8 + 4 + 4 + 8 + 6 + 3 + 9 + 9, product* 8 * 4 * 4 * 8 * 6 * 3 * 9 * 9, index + 99368448);
-body<0>(stream, sum+ 4 + 2 + 8 + 3 + 7 + 3 + 9 + 9, product* 4 * 2 * 8 * 3 * 7 * 3 * 9 * 9, index + 99373824);
-body<0>(stream, sum+ 6 + 3 + 3 + 4 + 7 + 3 + 9 + 9, product* 6 * 3 * 3 * 4 * 7 * 3 * 9 * 9, index + 99374336);
-body<0>(stream, sum+ 2 + 3 + 8 + 4 + 8 + 3 + 9 + 9, product* 2 * 3 * 8 * 4 * 8 * 3 * 9 * 9, index + 99384832);
-body<0>(stream, sum+ 2 + 7 + 6 + 8 + 8 + 3 + 9 + 9, product* 2 * 7 * 6 * 8 * 8 * 3 * 9 * 9, index + 99388672);
-body<0>(stream, sum+ 2 + 3 + 6 + 7 + 9 + 3 + 9 + 9, product* 2 * 3 * 6 * 7 * 9 * 3 * 9 * 9, index + 99397632);
-body<0>(stream, sum+ 4 + 6 + 4 + 2 + 2 + 4 + 9 + 9, product* 4 * 6 * 4 * 2 * 2 * 4 * 9 * 9, index + 99422464);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 2 + 4 + 9 + 9, product* 2 * 3 * 2 * 3 * 2 * 4 * 9 * 9, index + 99423232);
-body<0>(stream, sum+ 4 + 4 + 7 + 3 + 2 + 4 + 9 + 9, product* 4 * 4 * 7 * 3 * 2 * 4 * 9 * 9, index + 99423744);
-body<0>(stream, sum+ 8 + 2 + 3 + 7 + 2 + 4 + 9 + 9, product* 8 * 2 * 3 * 7 * 2 * 4 * 9 * 9, index + 99427328);
-body<0>(stream, sum+ 8 + 4 + 4 + 2 + 3 + 4 + 9 + 9, product* 8 * 4 * 4 * 2 * 3 * 4 * 9 * 9, index + 99432448);
-body<0>(stream, sum+ 2 + 7 + 4 + 3 + 3 + 4 + 9 + 9, product* 2 * 7 * 4 * 3 * 3 * 4 * 9 * 9, index + 99433472);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 4 + 4 + 9 + 9, product* 4 * 2 * 2 * 4 * 4 * 4 * 9 * 9, index + 99444224);
-body<0>(stream, sum+ 4 + 4 + 3 + 9 + 4 + 4 + 9 + 9, product* 4 * 4 * 3 * 9 * 4 * 4 * 9 * 9, index + 99449344);
-body<0>(stream, sum+ 8 + 6 + 7 + 8 + 4 + 6 + 9 + 9, product* 8 * 6 * 7 * 8 * 4 * 6 * 9 * 9, index + 99648768);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 6 + 6 + 9 + 9, product* 6 * 3 * 3 * 2 * 6 * 6 * 9 * 9, index + 99662336);
-body<0>(stream, sum+ 6 + 3 + 3 + 2 + 4 + 7 + 9 + 9, product* 6 * 3 * 3 * 2 * 4 * 7 * 9 * 9, index + 99742336);
-body<0>(stream, sum+ 2 + 3 + 2 + 3 + 4 + 7 + 9 + 9, product* 2 * 3 * 2 * 3 * 4 * 7 * 9 * 9, index + 99743232);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 6 + 7 + 9 + 9, product* 4 * 2 * 2 * 4 * 6 * 7 * 9 * 9, index + 99764224);
-body<0>(stream, sum+ 8 + 6 + 7 + 2 + 7 + 8 + 9 + 9, product* 8 * 6 * 7 * 2 * 7 * 8 * 9 * 9, index + 99872768);
-body<0>(stream, sum+ 4 + 2 + 2 + 4 + 2 + 9 + 9 + 9, product* 4 * 2 * 2 * 4 * 2 * 9 * 9 * 9, index + 99924224);
-body<0>(stream, sum+ 4 + 6 + 4 + 8 + 9 + 9 + 9 + 9, product* 4 * 6 * 4 * 8 * 9 * 9 * 9 * 9, index + 99998464);
@@ -18,6 +18,9 @@
 
 // Perform numeric quodigious checks
 #include "qlib.h"
+#include "ObservedSuffixes.h"
+#include <iostream>
+#include <sstream>
 #include <future>
 
 template<u32 length>
@@ -66,6 +69,13 @@ constexpr auto oddApprox = true;
  */
 constexpr auto evenApprox = false;
 
+/*
+ * Only the even least significant digits are walked normally, enabling this
+ * walks exactly the odd ones instead. Any number printed is one the normal
+ * runs have missed.
+ */
+constexpr auto verifyOddLastDigit = false;
+
 /*
  * The depth at which to perform a hack to speed up computation using observed
  * behavior
@@ -140,24 +150,12 @@ inline void body(std::ostream& stream, u64 sum = 0, u64 product = 1, u64 index =
 	    	// thread that spawned the children is reused below.
 	    	body<inner>(stream, sum + 2, product * 2, index + (2 * next)); // 2
 	    	stream << lowerHalf.get() << upperHalf.get();
-        } else if constexpr (observedSpecializationDepth == length && length == 2) {
-#include "Specialization2Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 3) {
-#include "Specialization3Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 4) {
-#include "Specialization4Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 5) {
-#include "Specialization5Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 6) {
-#include "Specialization6Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 7) {
-#include "Specialization7Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 8) {
-#include "Specialization8Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 9) {
-#include "Specialization9Digits.cc"
-        } else if constexpr (observedSpecializationDepth == length && length == 10) {
-#include "Specialization10Digits.cc"
+        } else if constexpr (observedSpecializationDepth == length) {
+            // only walk the suffixes which have shown up in previous runs
+            static constexpr auto& suffixes = observedSuffixes<length>;
+            for (std::size_t i = 0; i < suffixes.size(); ++i) {
+                body<0>(stream, sum + suffixes.sums[i], product * suffixes.products[i], index + suffixes.values[i]);
+            }
 	    } else {
 	    	// we use the stack to keep track of sums, products, and current indexes
 	    	// instead of starting with a whole number and breaking it apart.
@@ -169,7 +167,8 @@ inline void body(std::ostream& stream, u64 sum = 0, u64 product = 1, u64 index =
 	    	// I can always perform the odd digit checks later on at a significant
 	    	// reduction in speed cost!
             static constexpr auto incr = (length == 1) ? 2 : 1 ;
-            for (auto i = 2; i < 10; i += incr) {
+            static constexpr auto first = (length == 1 && verifyOddLastDigit) ? 3 : 2;
+            for (auto i = first; i < 10; i += incr) {
                 if ( i != 5) {
                     body<inner>(stream, sum + i, product * i, index + (i * next));
                 }
@@ -0,0 +1,9 @@
+#!/bin/bash
+# Mine the unique last N digits observed in the previous runs and turn them
+# into a table that ObservedSuffixes.h can include directly.
+# usage: ./makeSuffixTables.sh [width...] (defaults to 2 through 10)
+
+widths=${@:-2 3 4 5 6 7 8 9 10}
+for width in ${widths}; do
+	cat ../outputs/qnums*_last${width} | sort | uniq | sed -e '/^$/d' -e 's/.*/X(&)/' > ObservedSuffixes${width}.def
+done
@@ -0,0 +1,115 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef COUNTERS_H__
+#define COUNTERS_H__
+#include "qlib.h"
+#include <array>
+#include <mutex>
+#include <ostream>
+
+/*
+ * Per level counters of where the walk spends its time. These are compiled
+ * out unless COUNTERS is defined (see the Makefile) since they touch every
+ * node and leaf.
+ */
+constexpr auto countersEnabled() noexcept {
+#ifdef COUNTERS
+    return true;
+#else
+    return false;
+#endif
+}
+
+struct LevelCounters {
+    std::array<u64, 20> nodes { };
+    u64 tested = 0;
+    u64 rejectedModThree = 0;
+    u64 rejectedProduct = 0;
+    u64 rejectedSum = 0;
+    u64 matches = 0;
+    void merge(const LevelCounters& other) noexcept {
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            nodes[i] += other.nodes[i];
+        }
+        tested += other.tested;
+        rejectedModThree += other.rejectedModThree;
+        rejectedProduct += other.rejectedProduct;
+        rejectedSum += other.rejectedSum;
+        matches += other.matches;
+    }
+};
+
+/*
+ * Every thread counts into its own copy, they are only merged once a worker
+ * is done so there is no contention while walking.
+ */
+inline LevelCounters& threadCounters() noexcept {
+    static thread_local LevelCounters local;
+    return local;
+}
+
+inline std::mutex countersLock;
+inline LevelCounters globalCounters;
+
+inline void countNode(u64 position) noexcept {
+    if constexpr (countersEnabled()) {
+        ++threadCounters().nodes[position];
+    }
+}
+
+inline void countRejectedModThree(u64 leaves) noexcept {
+    if constexpr (countersEnabled()) {
+        threadCounters().rejectedModThree += leaves;
+    }
+}
+
+inline void flushCounters() noexcept {
+    if constexpr (countersEnabled()) {
+        auto& local = threadCounters();
+        {
+            std::lock_guard<std::mutex> guard(countersLock);
+            globalCounters.merge(local);
+        }
+        local = LevelCounters();
+    }
+}
+
+/*
+ * Write the counters gathered for a width as a single line of JSON and reset
+ * them for the next one.
+ */
+inline void reportCounters(std::ostream& out, u64 width, double seconds) noexcept {
+    if constexpr (countersEnabled()) {
+        const auto& c = globalCounters;
+        out << "{\"width\": " << width << ", \"seconds\": " << seconds << ", \"nodes\": [";
+        for (u64 i = 0; i < width; ++i) {
+            out << ((i > 0) ? ", " : "") << c.nodes[i];
+        }
+        out << "], \"tested\": " << c.tested
+            << ", \"rejected\": {\"modThree\": " << c.rejectedModThree
+            << ", \"product\": " << c.rejectedProduct
+            << ", \"sum\": " << c.rejectedSum << "}"
+            << ", \"matches\": " << c.matches
+            << ", \"candidatesPerSecond\": " << ((seconds > 0) ? (c.tested / seconds) : 0.0)
+            << "}" << std::endl;
+        globalCounters = LevelCounters();
+    }
+}
+
+#endif // end COUNTERS_H__
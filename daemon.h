@@ -0,0 +1,193 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef DAEMON_H__
+#define DAEMON_H__
+#include "qlib.h"
+#include <cstring>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*
+ * Plumbing for keeping the engine around between queries. Queries are lines
+ * of text sent over a unix socket and each answer is a number per line
+ * followed by an empty line, the same way the engines separate widths on
+ * stdout.
+ */
+using ResultList = std::vector<u64>;
+using SharedResults = std::shared_ptr<const ResultList>;
+
+/*
+ * Sorted results keyed by width and lower digits (zero for a whole width),
+ * computed once and then shared by every query which needs them. A query for
+ * something that is still being computed waits for it instead of starting it
+ * over.
+ */
+class ResultCache {
+    public:
+        using Key = std::tuple<u64, u64>;
+        /*
+         * Start computing the given entry in the background unless it is
+         * cached already, true if it was.
+         */
+        template<typename Compute>
+        bool prefetch(u64 width, u64 lower, Compute&& compute) {
+            std::lock_guard<std::mutex> lock(_lock);
+            auto key = std::make_tuple(width, lower);
+            if (_entries.count(key) != 0) {
+                return true;
+            }
+            _entries.emplace(key, std::async(std::launch::async, [compute]() {
+                auto results = compute();
+                return SharedResults(std::make_shared<const ResultList>(std::move(results)));
+            }).share());
+            return false;
+        }
+        template<typename Compute>
+        SharedResults get(u64 width, u64 lower, Compute&& compute) {
+            prefetch(width, lower, compute);
+            return entry(width, lower).get();
+        }
+        /*
+         * The given entry if it is done, null otherwise.
+         */
+        SharedResults ready(u64 width, u64 lower) {
+            std::lock_guard<std::mutex> lock(_lock);
+            auto it = _entries.find(std::make_tuple(width, lower));
+            if (it == _entries.end() || it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                return nullptr;
+            }
+            return it->second.get();
+        }
+        void insert(u64 width, u64 lower, ResultList results) {
+            std::promise<SharedResults> done;
+            done.set_value(std::make_shared<const ResultList>(std::move(results)));
+            std::lock_guard<std::mutex> lock(_lock);
+            _entries[std::make_tuple(width, lower)] = done.get_future().share();
+        }
+    private:
+        std::shared_future<SharedResults> entry(u64 width, u64 lower) {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _entries.at(std::make_tuple(width, lower));
+        }
+        std::mutex _lock;
+        std::map<Key, std::shared_future<SharedResults>> _entries;
+};
+
+/*
+ * One client of the daemon, reads queries a line at a time and writes the
+ * answers back.
+ */
+class Connection {
+    public:
+        explicit Connection(int fd) noexcept : _fd(fd) { }
+        Connection(const Connection&) = delete;
+        Connection(Connection&&) = delete;
+        ~Connection() {
+            close(_fd);
+        }
+        bool readLine(std::string& line) {
+            while (true) {
+                if (auto end = _pending.find('\n'); end != std::string::npos) {
+                    line = _pending.substr(0, end);
+                    _pending.erase(0, end + 1);
+                    return true;
+                }
+                std::array<char, 4096> chunk;
+                auto count = read(_fd, chunk.data(), chunk.size());
+                if (count <= 0) {
+                    return false;
+                }
+                _pending.append(chunk.data(), count);
+            }
+        }
+        bool write(const std::string& text) noexcept {
+            for (std::size_t sent = 0; sent < text.size(); ) {
+                // a client which went away must not take the daemon with it
+                auto count = send(_fd, text.data() + sent, text.size() - sent, MSG_NOSIGNAL);
+                if (count <= 0) {
+                    return false;
+                }
+                sent += count;
+            }
+            return true;
+        }
+    private:
+        int _fd;
+        std::string _pending;
+};
+
+class UnixListener {
+    public:
+        explicit UnixListener(const std::string& path) noexcept : _path(path) {
+            sockaddr_un address { };
+            address.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(address.sun_path)) {
+                return;
+            }
+            std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+            // a socket left behind by an earlier daemon would make bind fail,
+            // anything else at the path is left alone
+            if (struct stat info { }; lstat(path.c_str(), &info) == 0) {
+                if (!S_ISSOCK(info.st_mode)) {
+                    return;
+                }
+                unlink(path.c_str());
+            }
+            _fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (_fd == -1) {
+                return;
+            }
+            if (bind(_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(_fd, 16) != 0) {
+                close(_fd);
+                _fd = -1;
+            }
+        }
+        UnixListener(const UnixListener&) = delete;
+        UnixListener(UnixListener&&) = delete;
+        ~UnixListener() {
+            if (_fd != -1) {
+                close(_fd);
+                // only if it is still a socket, it may have been replaced
+                if (struct stat info { }; lstat(_path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+                    unlink(_path.c_str());
+                }
+            }
+        }
+        bool good() const noexcept { return _fd != -1; }
+        /*
+         * Wait for the next client, -1 if accepting failed.
+         */
+        int accept() noexcept {
+            return ::accept(_fd, nullptr, nullptr);
+        }
+    private:
+        std::string _path;
+        int _fd = -1;
+};
+
+#endif // end DAEMON_H__
@@ -0,0 +1,81 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+// Launch the build of a program which makes the most of the cpu it runs on.
+//
+// The engines are built with -march so they die with an illegal instruction
+// on an older cpu and leave speed on the table on a newer one. make portable
+// builds every program once per instruction set level and this launcher
+// under the plain name. It asks the cpu what it supports (cpuid, through
+// __builtin_cpu_supports) and replaces itself with the best build found next
+// to it, logging which one to stderr. A whole program is built per level
+// rather than just the leaf, tail and digit split kernels since those are
+// inlined all through the templated walk, a switch per kernel would cost
+// more than the kernels themselves.
+//
+// QUODIGIOUS_VARIANT=<name> forces a variant.
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+#ifndef PROGRAM_NAME
+#error "PROGRAM_NAME has to name the program to launch"
+#endif
+
+struct Variant {
+    const char* name;
+    const char* level;
+    bool supported;
+};
+
+int main(int, char** argv) {
+    __builtin_cpu_init();
+    // from the best to the worst, the generic build runs everywhere
+    std::array<Variant, 4> variants {{
+        { "avx512", "x86-64-v4", bool(__builtin_cpu_supports("x86-64-v4")) },
+        { "avx2", "x86-64-v3 (avx2, bmi2, fma)", bool(__builtin_cpu_supports("x86-64-v3")) },
+        { "sse42", "x86-64-v2 (sse4.2, popcnt)", bool(__builtin_cpu_supports("x86-64-v2")) },
+        { "generic", "x86-64", true },
+    }};
+    std::string directory(".");
+    if (char self[PATH_MAX]; realpath("/proc/self/exe", self) != nullptr) {
+        directory = self;
+        directory.erase(directory.rfind('/'));
+    }
+    auto forced = std::getenv("QUODIGIOUS_VARIANT");
+    for (const auto& variant : variants) {
+        if (forced != nullptr ? (std::strcmp(forced, variant.name) != 0) : !variant.supported) {
+            continue;
+        }
+        auto path = directory + "/" + PROGRAM_NAME + "-" + variant.name;
+        if (access(path.c_str(), X_OK) != 0) {
+            continue;
+        }
+        std::cerr << PROGRAM_NAME << ": running the " << variant.name << " build for " << variant.level << std::endl;
+        execv(path.c_str(), argv);
+        std::cerr << PROGRAM_NAME << ": unable to run " << path << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    std::cerr << PROGRAM_NAME << ": no build of " << PROGRAM_NAME << " for this cpu in " << directory << std::endl;
+    return 1;
+}
@@ -0,0 +1,96 @@
+#!/bin/bash
+# Differential fuzzing of the engines on random subtrees.
+#
+# Every engine can walk just the numbers of a width which end in some given
+# lower digits (-u). This picks random widths and lower digits, runs each
+# engine on that subtree and compares what they find. When they disagree the
+# subtree is narrowed down one digit at a time for as long as a narrower one
+# still shows the difference, so what gets reported is the smallest subtree
+# which reproduces it. Repeat it with
+#   echo "<width> <lower digits>" | ./<engine> -u
+#
+# The engines differ in which digits they skip on purpose: quodigious and
+# iquodigious never use fives. So numbers with a five in them are left out
+# of the comparison, and the lower digits never contain one. The lower digits
+# may also make up the whole width, which leaves a single number to check.
+#
+# usage: ./fuzz.sh [-n iterations] [-s seed]
+#   -n  number of subtrees to try (default: 100)
+#   -s  seed for picking them (default: random, always printed)
+# environment:
+#   ENGINES        engines to compare (default: quodigious iquodigious lquodigious tlquodigious)
+#   MAX_WIDTH      widest width to pick (default: 16)
+#   MAX_REMAINING  most digits left to walk in a subtree (default: 7)
+
+iterations=100
+seed=${RANDOM}
+while getopts "n:s:" opt; do
+	case ${opt} in
+		n) iterations=${OPTARG} ;;
+		s) seed=${OPTARG} ;;
+		*) echo "usage: $0 [-n iterations] [-s seed]" >&2; exit 1 ;;
+	esac
+done
+engines=${ENGINES:-quodigious iquodigious lquodigious tlquodigious}
+maxWidth=${MAX_WIDTH:-16}
+maxRemaining=${MAX_REMAINING:-7}
+digits=(2 3 4 6 7 8 9)
+work=$(mktemp -d)
+trap 'rm -rf ${work}' EXIT
+RANDOM=${seed}
+echo "fuzzing ${iterations} subtrees with seed ${seed}"
+
+# subtree <engine> <width> <lower digits>
+subtree() {
+	echo "$2 $3" | ./$1 -u 2> /dev/null | grep . | grep -v 5 | sort -n
+}
+
+# diverges <width> <lower digits>, true if any engine disagrees with the first
+diverges() {
+	local first=
+	for engine in ${engines}; do
+		subtree ${engine} $1 $2 > ${work}/${engine}
+		if [ -z "${first}" ]; then
+			first=${engine}
+		elif ! cmp -s ${work}/${first} ${work}/${engine}; then
+			return 0
+		fi
+	done
+	return 1
+}
+
+failed=0
+for (( i = 0; i < iterations; ++i )); do
+	width=$(( 2 + RANDOM % (maxWidth - 1) ))
+	shortest=$(( width > maxRemaining ? width - maxRemaining : 1 ))
+	length=$(( shortest + RANDOM % (width - shortest + 1) ))
+	lower=
+	for (( k = 0; k < length; ++k )); do
+		lower=${digits[$(( RANDOM % 7 ))]}${lower}
+	done
+	if ! diverges ${width} ${lower}; then
+		continue
+	fi
+	failed=1
+	# keep adding digits on top while the difference still shows up
+	narrowed=true
+	while ${narrowed} && [ ${#lower} -lt ${width} ]; do
+		narrowed=false
+		for digit in ${digits[@]}; do
+			if diverges ${width} ${digit}${lower}; then
+				lower=${digit}${lower}
+				narrowed=true
+				break
+			fi
+		done
+	done
+	diverges ${width} ${lower}
+	echo "DIVERGENCE width ${width} lower digits ${lower}"
+	for engine in ${engines}; do
+		echo "  ${engine}: $(wc -l < ${work}/${engine}) numbers: $(head -n 5 ${work}/${engine} | tr '\n' ' ')"
+	done
+done
+if [ ${failed} -eq 0 ]; then
+	echo "no divergences"
+fi
+exit ${failed}
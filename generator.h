@@ -0,0 +1,296 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef GENERATOR_H__
+#define GENERATOR_H__
+#include "qlib.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/*
+ * Pull based versions of the library walks. Instead of handing every number
+ * to a sink the walk stops as soon as it has found one and picks up where it
+ * left off on the next pull, so a consumer which is slow to take them never
+ * makes anything pile up. The digits are selected from the most significant
+ * one down so the numbers come out in ascending order. They search the same
+ * space as enumerate and enumerateSubtree.
+ */
+template<typename Generator>
+class GeneratorIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = u64;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const u64*;
+        using reference = const u64&;
+        GeneratorIterator() noexcept = default;
+        explicit GeneratorIterator(Generator* generator) noexcept : _generator(generator) {
+            ++(*this);
+        }
+        reference operator*() const noexcept { return _value; }
+        GeneratorIterator& operator++() noexcept {
+            if (!_generator->next(_value)) {
+                _generator = nullptr;
+            }
+            return *this;
+        }
+        bool operator==(const GeneratorIterator& other) const noexcept { return _generator == other._generator; }
+        bool operator!=(const GeneratorIterator& other) const noexcept { return _generator != other._generator; }
+    private:
+        Generator* _generator = nullptr;
+        u64 _value = 0;
+};
+
+class QuodigiousGenerator {
+    public:
+        using iterator = GeneratorIterator<QuodigiousGenerator>;
+        /*
+         * Nothing to generate.
+         */
+        QuodigiousGenerator() noexcept = default;
+        /*
+         * Every quodigious number of the given width.
+         */
+        explicit QuodigiousGenerator(u64 width) noexcept : QuodigiousGenerator(width, SubtreeState()) {
+            // the two least significant digits are paired up the same way
+            // enumerateTens does
+            _pairOnes = (width >= 10);
+        }
+        /*
+         * Every quodigious number of the given width ending in the digits of
+         * the given state.
+         */
+        QuodigiousGenerator(u64 width, const SubtreeState& lower) noexcept : _width(width), _bottom(lower.length) {
+            if (width == 0 || width > maxQuodigiousWidth || lower.length > width) {
+                return;
+            }
+            _onlyMultiplesOfThree = (width > 10);
+            _level = width - 1;
+            _sums[width] = lower.sum;
+            _products[width] = lower.product;
+            _values[width] = lower.value;
+            _done = false;
+            _fixed = (lower.length == width);
+            if (!_fixed) {
+                _choices[_level] = 0;
+            }
+        }
+        /*
+         * Walk on to the next quodigious number, false once there are none
+         * left.
+         */
+        bool next(u64& value) noexcept {
+            if (_done) {
+                return false;
+            } else if (_fixed) {
+                // every digit was given, there is just the one number to check
+                _done = true;
+                return leaf(_sums[_width], _products[_width], _values[_width], value);
+            }
+            while (true) {
+                auto position = _level;
+                // the digits above this position are in the entries above it
+                auto above = position + 1;
+                auto& choice = _choices[position];
+                if (position == _bottom) {
+                    // the least significant free digit is tried in a loop of
+                    // its own, only with the digits the rules leave over
+                    auto s = _sums[above];
+                    auto p = _products[above];
+                    auto v = _values[above];
+                    auto factor = factors10[position];
+                    const u64* digits = quodigiousDigits.data();
+                    auto available = quodigiousDigits.size();
+                    if (_pairOnes && position == 0) {
+                        digits = pairedOnes[tensDigit() % 2].data();
+                        available = pairedOnes[0].size();
+                    } else if (_onlyMultiplesOfThree) {
+                        digits = completingDigits[s % 3].data();
+                        available = ((s % 3) == 0) ? 3 : 2;
+                    }
+                    while (choice < available) {
+                        auto d = digits[choice];
+                        ++choice;
+                        if (leaf(s + d, p * d, v + (d * factor), value)) {
+                            return true;
+                        }
+                    }
+                } else if (choice < quodigiousDigits.size()) {
+                    auto d = quodigiousDigits[choice];
+                    _sums[position] = _sums[above] + d;
+                    _products[position] = _products[above] * d;
+                    _values[position] = _values[above] + (d * factors10[position]);
+                    _level = position - 1;
+                    _choices[_level] = 0;
+                    continue;
+                }
+                // this position is exhausted, move back up
+                if (above == _width) {
+                    _done = true;
+                    return false;
+                }
+                _level = above;
+                ++_choices[above];
+            }
+        }
+        iterator begin() noexcept { return iterator(this); }
+        iterator end() noexcept { return iterator(); }
+    private:
+        /*
+         * Odd tens digits are followed by a 2 or a 6 and even ones by a 4 or
+         * an 8.
+         */
+        static constexpr std::array<std::array<u64, 2>, 2> pairedOnes {{
+            { 4, 8 },
+            { 2, 6 },
+        }};
+        u64 tensDigit() const noexcept {
+            return quodigiousDigits[_choices[1]];
+        }
+        bool leaf(u64 sum, u64 product, u64 number, u64& value) const noexcept {
+            if ((!_onlyMultiplesOfThree || (sum % 3) == 0) && isQuodigious(number, sum, product)) {
+                value = number;
+                return true;
+            }
+            return false;
+        }
+        // the running state with the digits from each position on up
+        // selected, the entry at the width holds the lower digits
+        std::array<u64, maxQuodigiousWidth + 1> _sums;
+        std::array<u64, maxQuodigiousWidth + 1> _products;
+        std::array<u64, maxQuodigiousWidth + 1> _values;
+        std::array<u64, maxQuodigiousWidth + 1> _choices;
+        u64 _width = 0;
+        u64 _bottom = 0;
+        u64 _level = 0;
+        bool _onlyMultiplesOfThree = false;
+        bool _pairOnes = false;
+        bool _fixed = false;
+        bool _done = true;
+};
+
+/*
+ * Walk a width on a thread per subtree of its least significant digits and
+ * merge what they find back into ascending order. Each thread only runs
+ * ahead of the consumer by a bounded number of results and then waits for
+ * it to catch up. Dropping the generator early stops the threads.
+ */
+class MergedGenerator {
+    public:
+        using iterator = GeneratorIterator<MergedGenerator>;
+        explicit MergedGenerator(u64 width, std::size_t capacity = 1024) noexcept : _capacity(capacity) {
+            if (width == 0 || width > maxQuodigiousWidth) {
+                return;
+            }
+            if (width == 1) {
+                start(QuodigiousGenerator(width));
+            } else if (width < 10) {
+                for (auto ones : quodigiousDigits) {
+                    start(QuodigiousGenerator(width, SubtreeState { ones, ones, ones, 1 }));
+                }
+            } else {
+                // the same subtrees enumerateTens walks
+                for (auto tens : quodigiousDigits) {
+                    for (auto ones = ((tens % 2ul == 0) ? 4ul : 2ul); ones < 10ul; ones += 4ul) {
+                        start(QuodigiousGenerator(width, SubtreeState { tens + ones, tens * ones, (tens * 10) + ones, 2 }));
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < _channels.size(); ++i) {
+                refill(i);
+            }
+        }
+        MergedGenerator(const MergedGenerator&) = delete;
+        MergedGenerator(MergedGenerator&&) = delete;
+        ~MergedGenerator() {
+            for (auto& channel : _channels) {
+                std::lock_guard<std::mutex> lock(channel->lock);
+                channel->cancelled = true;
+                channel->changed.notify_all();
+            }
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+        }
+        bool next(u64& value) noexcept {
+            if (_heads.empty()) {
+                return false;
+            }
+            auto [smallest, index] = _heads.top();
+            _heads.pop();
+            value = smallest;
+            refill(index);
+            return true;
+        }
+        iterator begin() noexcept { return iterator(this); }
+        iterator end() noexcept { return iterator(); }
+    private:
+        struct Channel {
+            std::mutex lock;
+            std::condition_variable changed;
+            std::deque<u64> values;
+            bool finished = false;
+            bool cancelled = false;
+        };
+        void start(QuodigiousGenerator generator) noexcept {
+            _channels.emplace_back(std::make_unique<Channel>());
+            _workers.emplace_back([channel = _channels.back().get(), capacity = _capacity, generator]() mutable noexcept {
+                for (auto value : generator) {
+                    std::unique_lock<std::mutex> lock(channel->lock);
+                    channel->changed.wait(lock, [channel, capacity]() { return channel->cancelled || channel->values.size() < capacity; });
+                    if (channel->cancelled) {
+                        return;
+                    }
+                    channel->values.emplace_back(value);
+                    channel->changed.notify_all();
+                }
+                std::lock_guard<std::mutex> lock(channel->lock);
+                channel->finished = true;
+                channel->changed.notify_all();
+            });
+        }
+        /*
+         * Wait for the next value of the given subtree and queue it up for
+         * merging, unless it has run dry.
+         */
+        void refill(std::size_t index) noexcept {
+            auto& channel = *_channels[index];
+            std::unique_lock<std::mutex> lock(channel.lock);
+            channel.changed.wait(lock, [&channel]() { return channel.finished || !channel.values.empty(); });
+            if (!channel.values.empty()) {
+                _heads.emplace(channel.values.front(), index);
+                channel.values.pop_front();
+                channel.changed.notify_all();
+            }
+        }
+        using Head = std::tuple<u64, std::size_t>;
+        std::priority_queue<Head, std::vector<Head>, std::greater<Head>> _heads;
+        std::vector<std::unique_ptr<Channel>> _channels;
+        std::vector<std::thread> _workers;
+        std::size_t _capacity;
+};
+
+#endif // end GENERATOR_H__
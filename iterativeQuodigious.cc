@@ -0,0 +1,139 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+// Perform quodigious checks with a runtime width and no recursion at all.
+//
+// The templated engines instantiate a fully unrolled copy of the recursion for
+// every width. This one keeps an explicit stack of the running sum, product
+// and value for each digit position instead, so the whole walk is a single
+// small loop no matter how wide the number is. It searches the same space as
+// quodigious (no fives, sums divisible by three above ten digits and the same
+// choice of the two least significant digits) so the outputs are comparable.
+// The walk itself lives in qlib.h so other tools can embed it.
+#include "qlib.h"
+#include "generator.h"
+#include <iostream>
+#include <future>
+#include <string>
+#include <vector>
+
+MatchList parallelWalk(u64 width, u64 tens) noexcept {
+    MatchList list;
+    enumerateTens(width, tens, [&list](u64 value) noexcept { list.emplace_back(value); });
+    return list;
+}
+
+void initialBody(u64 width) noexcept {
+    MatchList list;
+    if (width < 10) {
+        enumerate(width, [&list](u64 value) noexcept { list.emplace_back(value); });
+    } else {
+        std::vector<std::future<MatchList>> tasks;
+        for (auto tens : quodigiousDigits) {
+            tasks.emplace_back(std::async(std::launch::async, parallelWalk, width, tens));
+        }
+        for (auto& task : tasks) {
+            auto r = task.get();
+            list.splice(list.cbegin(), r);
+        }
+    }
+    list.sort();
+    for (const auto& v : list) {
+        std::cout << v << std::endl;
+    }
+}
+
+/*
+ * Walk every number of the given width ending in the given lower digits.
+ */
+bool subtreeBody(u64 width, u64 digits) noexcept {
+    MatchList list;
+    if (!enumerateSubtree(width, digits, [&list](u64 value) noexcept { list.emplace_back(value); })) {
+        return false;
+    }
+    list.sort();
+    for (const auto& v : list) {
+        std::cout << v << std::endl;
+    }
+    return true;
+}
+
+/*
+ * Stream the numbers out as the generators find them instead of collecting
+ * and sorting them first.
+ */
+template<typename Generator>
+void generatedBody(Generator& generator) noexcept {
+    for (auto value : generator) {
+        std::cout << value << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    // -u reads "width lowerDigits" pairs and only walks those subtrees
+    // -g pulls the numbers out of the generators in generator.h
+    auto subtrees = false;
+    auto generated = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (arg == "-u") {
+            subtrees = true;
+        } else if (arg == "-g") {
+            generated = true;
+        } else {
+            std::cerr << "usage: " << argv[0] << " [-u] [-g]" << std::endl;
+            return 1;
+        }
+    }
+    while(std::cin.good()) {
+        u64 currentIndex = 0;
+        u64 digits = 0;
+        std::cin >> currentIndex;
+        if (subtrees) {
+            std::cin >> digits;
+        }
+        if (std::cin.good()) {
+            if (subtrees && generated) {
+                SubtreeState state;
+                if (!lowerDigitsState(digits, state) || state.length > currentIndex || currentIndex > maxQuodigiousWidth) {
+                    std::cerr << "Illegal subtree " << currentIndex << " " << digits << std::endl;
+                    return 1;
+                }
+                QuodigiousGenerator generator(currentIndex, state);
+                generatedBody(generator);
+            } else if (subtrees) {
+                if (!subtreeBody(currentIndex, digits)) {
+                    std::cerr << "Illegal subtree " << currentIndex << " " << digits << std::endl;
+                    return 1;
+                }
+            } else if ((currentIndex > 0) && (currentIndex <= maxQuodigiousWidth)) {
+                if (generated) {
+                    MergedGenerator generator(currentIndex);
+                    generatedBody(generator);
+                } else {
+                    initialBody(currentIndex);
+                }
+            } else {
+                std::cerr << "Illegal index " << currentIndex << std::endl;
+                return 1;
+            }
+            std::cout << std::endl;
+        }
+    }
+    return 0;
+}
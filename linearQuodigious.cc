@@ -18,51 +18,121 @@
 
 #include "qlib.h"
 #include <iostream>
+#include <string>
 
 
-void performQuodigious(uint8_t depth, u64 number = 0, u64 sum = 0, u64 product = 1) noexcept {
+/*
+ * Fill in the lowest depth digits of number, scale is the place value of the
+ * lowest digit which is still free.
+ */
+void performQuodigious(uint8_t depth, u64 number = 0, u64 sum = 0, u64 product = 1, u64 scale = 1) noexcept {
     if (depth == 0) {
         if (isQuodigious(number, sum, product)) {
             std::cout << number << std::endl;
         }
     } else {
         auto innerDepth = depth - 1;
-        auto baseFactor = factors10[innerDepth];
+        auto baseFactor = factors10[innerDepth] * scale;
         // this will eliminate multiplies
         number += (baseFactor << 1); // always will have a minimum of baseFactor * 2
         sum += 2; // always will be two more than we started with
         // hand unroll to expose more optimization surface area
-        performQuodigious(innerDepth, number, sum, product * 2);
+        performQuodigious(innerDepth, number, sum, product * 2, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 3);
+        performQuodigious(innerDepth, number, sum, product * 3, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 4);
+        performQuodigious(innerDepth, number, sum, product * 4, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 5);
+        performQuodigious(innerDepth, number, sum, product * 5, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 6);
+        performQuodigious(innerDepth, number, sum, product * 6, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 7);
+        performQuodigious(innerDepth, number, sum, product * 7, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 8);
+        performQuodigious(innerDepth, number, sum, product * 8, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious(innerDepth, number, sum, product * 9);
+        performQuodigious(innerDepth, number, sum, product * 9, scale);
     }
 }
 
-int main() {
+/*
+ * Walk every number of the given width ending in the given lower digits.
+ */
+bool performSubtree(u64 width, u64 digits) noexcept {
+    SubtreeState state;
+    if (!lowerDigitsState(digits, state) || state.length > width) {
+        return false;
+    }
+    performQuodigious(width - state.length, state.value, state.sum, state.product, factors10[state.length]);
+    return true;
+}
+
+/*
+ * Same as performQuodigious but only for the numbers in [lo, hi]. A digit
+ * whose subtree lies completely outside of the range is skipped and one
+ * completely inside of it is handed to performQuodigious, so only the
+ * subtrees along the two bounds are clipped.
+ */
+void performRange(uint8_t depth, u64 number, u64 sum, u64 product, u64 lo, u64 hi) noexcept {
+    if (depth == 0) {
+        if (isQuodigious(number, sum, product)) {
+            std::cout << number << std::endl;
+        }
+        return;
+    }
+    auto innerDepth = depth - 1;
+    auto baseFactor = factors10[innerDepth];
+    auto smallest = 2 * repunit(innerDepth);
+    auto largest = 9 * repunit(innerDepth);
+    for (auto digit = 2ul; digit < 10ul; ++digit) {
+        auto next = number + (digit * baseFactor);
+        if (next + largest < lo) {
+            continue;
+        } else if (next + smallest > hi) {
+            break;
+        } else if (next + smallest >= lo && next + largest <= hi) {
+            performQuodigious(innerDepth, next, sum + digit, product * digit);
+        } else {
+            performRange(innerDepth, next, sum + digit, product * digit, lo, hi);
+        }
+    }
+}
+
+void performRange(u64 lo, u64 hi) noexcept {
+    for (uint8_t width = 1; width < 20; ++width) {
+        performRange(width, 0, 0, 1, lo, hi);
+    }
+}
+
+int main(int argc, char** argv) {
+    // -u reads "width lowerDigits" pairs and only walks those subtrees, -r
+    // reads "lo hi" pairs and only walks the numbers in between
+    std::string mode = (argc > 1) ? argv[1] : "";
+    auto subtrees = (mode == "-u");
+    auto ranges = (mode == "-r");
     while(std::cin.good()) {
         u64 currentIndex = 0;
+        u64 argument = 0;
         std::cin >> currentIndex;
+        if (subtrees || ranges) {
+            std::cin >> argument;
+        }
         if (std::cin.good()) {
-            if ((currentIndex > 0) && (currentIndex < 20)) {
+            if (subtrees) {
+                if (!performSubtree(currentIndex, argument)) {
+                    std::cout << "Illegal subtree " << currentIndex << " " << argument << std::endl;
+                    return 1;
+                }
+            } else if (ranges) {
+                performRange(currentIndex, argument);
+            } else if ((currentIndex > 0) && (currentIndex < 20)) {
                 performQuodigious(currentIndex);
             } else {
                 std::cout << "Illegal index " << currentIndex << std::endl;
@@ -0,0 +1,168 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef MEMBERSHIP_H__
+#define MEMBERSHIP_H__
+#include "qlib.h"
+#include <array>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * Check arbitrary lists of numbers for being quodigious. The numbers are read
+ * as text, so the digit sum and product fall out of parsing each digit and
+ * never have to be split back out of the binary value. Any run of
+ * characters which are not digits separates two numbers. Like the engines a
+ * number with a zero or a one in it is never quodigious, neither is one with
+ * more than 19 digits.
+ */
+struct MembershipTotals {
+    u64 checked = 0;
+    u64 matches = 0;
+    u64 skipped = 0;
+    MembershipTotals& operator+=(const MembershipTotals& other) noexcept {
+        checked += other.checked;
+        matches += other.matches;
+        skipped += other.skipped;
+        return *this;
+    }
+};
+
+/*
+ * Parsing hands the candidates over in batches so the divisions of a batch
+ * are independent of each other and of the parser.
+ */
+class MembershipBatch {
+    public:
+        static constexpr std::size_t size = 8;
+        MembershipBatch() noexcept {
+            // so the stale entries of a partial batch never divide by zero
+            _sums.fill(1);
+            _products.fill(1);
+        }
+        void add(u64 value, u64 sum, u64 product) noexcept {
+            _values[_count] = value;
+            _sums[_count] = sum;
+            _products[_count] = product;
+            ++_count;
+        }
+        bool full() const noexcept { return _count == size; }
+        template<typename Sink>
+        void flush(Sink&& sink) noexcept {
+            std::array<bool, size> keep;
+            for (std::size_t i = 0; i < size; ++i) {
+                keep[i] = isQuodigious(_values[i], _sums[i], _products[i]);
+            }
+            for (std::size_t i = 0; i < _count; ++i) {
+                if (keep[i]) {
+                    sink(_values[i]);
+                }
+            }
+            // stale entries past the end are harmless, they only keep the
+            // loop above a fixed length
+            _count = 0;
+        }
+    private:
+        std::array<u64, size> _values { };
+        std::array<u64, size> _sums { };
+        std::array<u64, size> _products { };
+        std::size_t _count = 0;
+};
+
+template<typename Sink>
+MembershipTotals checkMembership(const char* begin, const char* end, Sink&& sink) noexcept {
+    MembershipTotals totals;
+    MembershipBatch batch;
+    auto emit = [&totals, &sink](u64 value) noexcept {
+        ++totals.matches;
+        sink(value);
+    };
+    for (auto curr = begin; curr != end; ) {
+        if (*curr < '0' || *curr > '9') {
+            ++curr;
+            continue;
+        }
+        u64 value = 0, sum = 0, product = 1, length = 0;
+        auto usable = true;
+        for (; curr != end && *curr >= '0' && *curr <= '9'; ++curr, ++length) {
+            u64 digit = *curr - '0';
+            usable = usable && (digit >= 2);
+            value = (value * 10) + digit;
+            sum += digit;
+            product *= digit;
+        }
+        ++totals.checked;
+        if (!usable || length > maxQuodigiousWidth) {
+            ++totals.skipped;
+            continue;
+        }
+        batch.add(value, sum, product);
+        if (batch.full()) {
+            batch.flush(emit);
+        }
+    }
+    batch.flush(emit);
+    return totals;
+}
+
+/*
+ * Read-only mapping of a whole file, empty if it can't be mapped.
+ */
+class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path) noexcept {
+            auto fd = open(path.c_str(), O_RDONLY);
+            if (fd == -1) {
+                return;
+            }
+            struct stat info { };
+            if (fstat(fd, &info) == 0) {
+                _good = true;
+                if (info.st_size > 0) {
+                    auto data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (data != MAP_FAILED) {
+                        madvise(data, info.st_size, MADV_SEQUENTIAL);
+                        _data = static_cast<const char*>(data);
+                        _size = info.st_size;
+                    } else {
+                        _good = false;
+                    }
+                }
+            }
+            close(fd);
+        }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&&) = delete;
+        ~MappedFile() {
+            if (_data != nullptr) {
+                munmap(const_cast<char*>(_data), _size);
+            }
+        }
+        bool good() const noexcept { return _good; }
+        const char* begin() const noexcept { return _data; }
+        const char* end() const noexcept { return _data + _size; }
+    private:
+        const char* _data = nullptr;
+        std::size_t _size = 0;
+        bool _good = false;
+};
+
+#endif // end MEMBERSHIP_H__
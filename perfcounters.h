@@ -0,0 +1,227 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef PERF_COUNTERS_H__
+#define PERF_COUNTERS_H__
+#include "qlib.h"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * Optional hardware counters read through perf_event_open. Every thread which
+ * does a phase of the work opens its own set of counters (they only count
+ * the calling thread) and adds them to the totals of that phase once it is
+ * done. Any counter the kernel or the cpu refuses to give us is simply
+ * reported as unavailable.
+ */
+enum class PerfEvent : byte {
+    Cycles,
+    Instructions,
+    BranchMisses,
+    L1InstructionMisses,
+    Count,
+};
+constexpr auto perfEventCount = static_cast<std::size_t>(PerfEvent::Count);
+
+enum class PerfPhase : byte {
+    Tables,
+    Walk,
+    Output,
+    Count,
+};
+constexpr auto perfPhaseCount = static_cast<std::size_t>(PerfPhase::Count);
+
+constexpr std::string_view toString(PerfEvent event) noexcept {
+    switch (event) {
+        case PerfEvent::Cycles: return "cycles";
+        case PerfEvent::Instructions: return "instructions";
+        case PerfEvent::BranchMisses: return "branchMisses";
+        case PerfEvent::L1InstructionMisses: return "l1iMisses";
+        default: return "unknown";
+    }
+}
+
+constexpr std::string_view toString(PerfPhase phase) noexcept {
+    switch (phase) {
+        case PerfPhase::Tables: return "tables";
+        case PerfPhase::Walk: return "walk";
+        case PerfPhase::Output: return "output";
+        default: return "unknown";
+    }
+}
+
+struct PerfTotals {
+    std::array<u64, perfEventCount> values { };
+    std::array<bool, perfEventCount> valid { };
+    void add(const PerfTotals& other) noexcept {
+        for (std::size_t i = 0; i < perfEventCount; ++i) {
+            if (other.valid[i]) {
+                values[i] += other.values[i];
+                valid[i] = true;
+            }
+        }
+    }
+};
+
+inline bool perfEnabled = false;
+inline std::mutex perfLock;
+inline std::array<PerfTotals, perfPhaseCount> perfPhases;
+
+class PerfCounters {
+    public:
+        PerfCounters() noexcept {
+            _fds.fill(-1);
+            open(PerfEvent::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            open(PerfEvent::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            open(PerfEvent::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+            open(PerfEvent::L1InstructionMisses, PERF_TYPE_HW_CACHE,
+                    PERF_COUNT_HW_CACHE_L1I | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        }
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters(PerfCounters&&) = delete;
+        ~PerfCounters() {
+            for (auto fd : _fds) {
+                if (fd != -1) {
+                    close(fd);
+                }
+            }
+        }
+        void start() noexcept {
+            for (auto fd : _fds) {
+                if (fd != -1) {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+        }
+        PerfTotals stop() noexcept {
+            PerfTotals result;
+            for (std::size_t i = 0; i < perfEventCount; ++i) {
+                if (auto fd = _fds[i]; fd != -1) {
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                    u64 value = 0;
+                    if (read(fd, &value, sizeof(value)) == sizeof(value)) {
+                        result.values[i] = value;
+                        result.valid[i] = true;
+                    }
+                }
+            }
+            return result;
+        }
+        /*
+         * Why the first counter which could not be opened failed, zero if
+         * everything opened.
+         */
+        static inline std::atomic<int> firstError { 0 };
+    private:
+        void open(PerfEvent event, u32 type, u64 config) noexcept {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.type = type;
+            attributes.config = config;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            auto fd = syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+            if (fd == -1) {
+                int expected = 0;
+                firstError.compare_exchange_strong(expected, errno);
+            } else {
+                _fds[static_cast<std::size_t>(event)] = static_cast<int>(fd);
+            }
+        }
+        std::array<int, perfEventCount> _fds;
+};
+
+/*
+ * Count everything the calling thread does while this is alive towards the
+ * given phase. Does nothing unless the counters were asked for.
+ */
+class PerfScope {
+    public:
+        explicit PerfScope(PerfPhase phase) noexcept : _phase(phase) {
+            if (perfEnabled) {
+                counters().start();
+            }
+        }
+        PerfScope(const PerfScope&) = delete;
+        PerfScope(PerfScope&&) = delete;
+        ~PerfScope() {
+            if (perfEnabled) {
+                auto totals = counters().stop();
+                std::lock_guard<std::mutex> guard(perfLock);
+                perfPhases[static_cast<std::size_t>(_phase)].add(totals);
+            }
+        }
+    private:
+        static PerfCounters& counters() noexcept {
+            static thread_local PerfCounters local;
+            return local;
+        }
+        PerfPhase _phase;
+};
+
+/*
+ * Write the counters of each phase of a width as a line of JSON next to the
+ * wall time and reset them for the next width.
+ */
+inline void reportPerf(std::ostream& out, u64 width, double seconds) noexcept {
+    if (!perfEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(perfLock);
+    out << "{\"width\": " << width << ", \"seconds\": " << seconds;
+    if (auto error = PerfCounters::firstError.load(); error != 0) {
+        out << ", \"unavailable\": \"" << std::strerror(error) << "\"";
+    }
+    for (std::size_t p = 0; p < perfPhaseCount; ++p) {
+        const auto& phase = perfPhases[p];
+        out << ", \"" << toString(static_cast<PerfPhase>(p)) << "\": {";
+        for (std::size_t e = 0; e < perfEventCount; ++e) {
+            out << ((e > 0) ? ", " : "") << "\"" << toString(static_cast<PerfEvent>(e)) << "\": ";
+            if (phase.valid[e]) {
+                out << phase.values[e];
+            } else {
+                out << "null";
+            }
+        }
+        constexpr auto cycles = static_cast<std::size_t>(PerfEvent::Cycles);
+        constexpr auto instructions = static_cast<std::size_t>(PerfEvent::Instructions);
+        out << ", \"ipc\": ";
+        if (phase.valid[cycles] && phase.valid[instructions] && phase.values[cycles] > 0) {
+            out << (double(phase.values[instructions]) / phase.values[cycles]);
+        } else {
+            out << "null";
+        }
+        out << "}";
+    }
+    out << "}" << std::endl;
+    perfPhases = { };
+}
+
+#endif // end PERF_COUNTERS_H__
@@ -0,0 +1,238 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef PROGRESS_H__
+#define PROGRESS_H__
+#include "qlib.h"
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <signal.h>
+#include <pthread.h>
+
+/*
+ * Progress of a long run is tracked in a small set of striped word blocks.
+ * Threads count on the walk into thread locals and only add what they
+ * counted since the last time to their stripe when they complete a prefix,
+ * the reporter sums the stripes up whenever it wants a snapshot. Wide widths
+ * start thousands of threads so several of them share each stripe, which is
+ * why the deltas are added and never stored. Nothing on the walk ever takes a
+ * lock.
+ */
+struct alignas(64) ProgressWord {
+    std::atomic<u64> completed { 0 };
+    std::atomic<u64> tested { 0 };
+    std::atomic<u64> matches { 0 };
+};
+constexpr auto maxProgressWords = 64ul;
+inline std::array<ProgressWord, maxProgressWords> progressWords;
+inline std::atomic<u64> progressWordsClaimed { 0 };
+inline std::atomic<u64> progressWidth { 0 };
+inline std::atomic<u64> progressTotal { 0 };
+inline std::atomic<std::chrono::steady_clock::rep> progressStart { 0 };
+
+/*
+ * What a thread has counted since it last published, these are bumped on the
+ * walk itself so they are plain thread locals.
+ */
+struct LocalProgress {
+    u64 tested = 0;
+    u64 matches = 0;
+};
+
+inline LocalProgress& localProgress() noexcept {
+    static thread_local LocalProgress local;
+    return local;
+}
+
+inline void countProgressTested(u64 count) noexcept {
+    localProgress().tested += count;
+}
+
+inline void countProgressMatch() noexcept {
+    ++localProgress().matches;
+}
+
+inline void countProgressMatches(u64 count) noexcept {
+    localProgress().matches += count;
+}
+
+/*
+ * Mark the given number of prefixes as done and publish what this thread
+ * counted since it last did.
+ */
+inline void completeProgressPrefixes(u64 count) noexcept {
+    // threads are spread over the stripes round robin
+    static thread_local ProgressWord& word = progressWords[progressWordsClaimed.fetch_add(1, std::memory_order_relaxed) % maxProgressWords];
+    auto& local = localProgress();
+    word.completed.fetch_add(count, std::memory_order_relaxed);
+    word.tested.fetch_add(local.tested, std::memory_order_relaxed);
+    word.matches.fetch_add(local.matches, std::memory_order_relaxed);
+    local = LocalProgress();
+}
+
+inline void completeProgressPrefix() noexcept {
+    completeProgressPrefixes(1);
+}
+
+/*
+ * Reset the progress words for a new width, this has to happen on the main
+ * thread before any worker threads are started. Workers are fresh threads for
+ * every width so only the counts of the main thread need to be cleared.
+ */
+inline void beginProgress(u64 width, u64 total) noexcept {
+    localProgress() = LocalProgress();
+    for (auto& word : progressWords) {
+        word.completed.store(0, std::memory_order_relaxed);
+        word.tested.store(0, std::memory_order_relaxed);
+        word.matches.store(0, std::memory_order_relaxed);
+    }
+    progressTotal.store(total, std::memory_order_relaxed);
+    progressStart.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    progressWidth.store(width, std::memory_order_release);
+}
+
+inline void endProgress() noexcept {
+    progressWidth.store(0, std::memory_order_release);
+}
+
+/*
+ * Prints snapshots of the progress words every interval and whenever the
+ * process gets a SIGUSR1. Snapshots go to stderr unless a status file is
+ * given, in which case it is rewritten each time.
+ */
+class ProgressReporter {
+    public:
+        ProgressReporter(std::chrono::seconds interval, const std::string& statusFile) :
+            _interval(interval), _statusFile(statusFile) { }
+        ProgressReporter(const ProgressReporter&) = delete;
+        ProgressReporter(ProgressReporter&&) = delete;
+        ~ProgressReporter() {
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _done = true;
+            }
+            _wake.notify_all();
+            if (_ticker.joinable()) {
+                _ticker.join();
+            }
+            if (_signals.joinable()) {
+                // wake the signal thread up so it notices we are done
+                pthread_kill(_signals.native_handle(), SIGUSR1);
+                _signals.join();
+            }
+        }
+        /*
+         * Has to be called before any other threads are started so they
+         * all inherit the blocked SIGUSR1.
+         */
+        void start() {
+            sigset_t set;
+            sigemptyset(&set);
+            sigaddset(&set, SIGUSR1);
+            pthread_sigmask(SIG_BLOCK, &set, nullptr);
+            _signals = std::thread([this, set]() {
+                while (true) {
+                    int signal = 0;
+                    sigwait(&set, &signal);
+                    {
+                        std::lock_guard<std::mutex> guard(_lock);
+                        if (_done) {
+                            return;
+                        }
+                    }
+                    report();
+                }
+            });
+            if (_interval.count() > 0) {
+                _ticker = std::thread([this]() {
+                    std::unique_lock<std::mutex> guard(_lock);
+                    while (!_wake.wait_for(guard, _interval, [this]() { return _done; })) {
+                        guard.unlock();
+                        report();
+                        guard.lock();
+                    }
+                });
+            }
+        }
+        void report() {
+            // the ticker and the signal thread can both get here
+            std::lock_guard<std::mutex> guard(_reportLock);
+            auto width = progressWidth.load(std::memory_order_acquire);
+            if (width == 0) {
+                return;
+            }
+            u64 completed = 0, tested = 0, matches = 0;
+            for (const auto& word : progressWords) {
+                completed += word.completed.load(std::memory_order_relaxed);
+                tested += word.tested.load(std::memory_order_relaxed);
+                matches += word.matches.load(std::memory_order_relaxed);
+            }
+            auto total = progressTotal.load(std::memory_order_relaxed);
+            auto now = std::chrono::steady_clock::now();
+            std::chrono::steady_clock::time_point start(std::chrono::steady_clock::duration(progressStart.load(std::memory_order_relaxed)));
+            std::chrono::duration<double> elapsed = now - start;
+            // the rate is over the time since the last snapshot of this width
+            if (width != _lastWidth || tested < _lastTested) {
+                _lastWidth = width;
+                _lastTested = 0;
+                _lastTime = start;
+            }
+            std::chrono::duration<double> sinceLast = now - _lastTime;
+            auto rate = (sinceLast.count() > 0) ? ((tested - _lastTested) / sinceLast.count()) : 0.0;
+            _lastTested = tested;
+            _lastTime = now;
+            std::ostringstream line;
+            line << "width " << width << ": " << completed << "/" << total << " prefixes ("
+                 << ((total > 0) ? (100.0 * completed / total) : 0.0) << "%), "
+                 << rate << " candidates/s, " << matches << " matches, ";
+            if (completed > 0 && completed <= total) {
+                auto remaining = static_cast<u64>(elapsed.count() * (total - completed) / completed);
+                line << "eta " << (remaining / 3600) << "h" << ((remaining / 60) % 60) << "m" << (remaining % 60) << "s";
+            } else {
+                line << "eta unknown";
+            }
+            if (_statusFile.empty()) {
+                std::cerr << line.str() << std::endl;
+            } else {
+                std::ofstream status(_statusFile, std::ios::trunc);
+                status << line.str() << std::endl;
+            }
+        }
+    private:
+        std::chrono::seconds _interval;
+        std::string _statusFile;
+        std::mutex _lock;
+        std::condition_variable _wake;
+        bool _done = false;
+        std::thread _ticker;
+        std::thread _signals;
+        std::mutex _reportLock;
+        u64 _lastWidth = 0;
+        u64 _lastTested = 0;
+        std::chrono::steady_clock::time_point _lastTime;
+};
+
+#endif // end PROGRESS_H__
@@ -18,8 +18,14 @@
 
 #ifndef QLIB_H__
 #define QLIB_H__
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <list>
+#include <new>
+#include <type_traits>
+#include <vector>
 using byte = uint8_t;
 using u64 = uint64_t;
 using u32 = uint32_t;
@@ -69,6 +75,340 @@ constexpr bool isQuodigious(u32 value, u32 sum, u32 product) noexcept {
 	return componentQuodigious<u32>(value, product) && componentQuodigious<u32>(value, sum);
 }
 
+/*
+ * The running state the engines carry down into a subtree: the sum, product
+ * and value of the digits selected so far.
+ */
+struct SubtreeState {
+    u64 sum = 0;
+    u64 product = 1;
+    u64 value = 0;
+    u64 length = 0;
+};
+
+/*
+ * Describe the subtree of every number ending in the given lower digits. The
+ * length is taken from the digits themselves, which works since zeros and
+ * ones can never show up in a quodigious number. Returns false if they do.
+ */
+constexpr bool lowerDigitsState(u64 digits, SubtreeState& state) noexcept {
+    state = SubtreeState();
+    for (state.value = digits; digits > 0; digits /= 10, ++state.length) {
+        auto digit = digits % 10;
+        if (digit < 2) {
+            return false;
+        }
+        state.sum += digit;
+        state.product *= digit;
+    }
+    return state.length > 0;
+}
+
+/*
+ * A number made up of the given count of ones, the smallest and largest
+ * digit repeated this many times bound every way to fill in that many
+ * digits.
+ */
+constexpr u64 repunit(u64 length) noexcept {
+    return (factors10[length] - 1) / 9;
+}
+
+/*
+ * Header only enumeration for embedding the search in other tools. The walk
+ * is the runtime width one iquodigious uses: it searches the same space as
+ * quodigious (no fives, only sums divisible by three above ten digits and
+ * the same choice of the two least significant digits) and hands every
+ * quodigious number it finds to a sink, which is anything callable with a
+ * u64. Sinks are template parameters so they end up inlined into the leaf.
+ * Numbers come out in no particular order. A sink which returns a bool can
+ * stop the walk by returning false, the walks then return false as well.
+ */
+inline constexpr std::array<u64, 7> quodigiousDigits { 2, 3, 4, 6, 7, 8, 9 };
+constexpr auto maxQuodigiousWidth = 19ul;
+/*
+ * The most significant digits which complete a sum to a multiple of three,
+ * indexed by the sum of the other digits mod three.
+ */
+inline constexpr std::array<std::array<u64, 3>, 3> completingDigits {{
+    { 3, 6, 9 },
+    { 2, 8, 0 },
+    { 4, 7, 0 },
+}};
+
+template<typename Sink>
+constexpr bool deliver(Sink& sink, u64 value) noexcept {
+    if constexpr (std::is_same_v<std::invoke_result_t<Sink&, u64>, bool>) {
+        return sink(value);
+    } else {
+        sink(value);
+        return true;
+    }
+}
+
+/*
+ * Walk every number whose digits below state.length and from top on up have
+ * already been selected, the state holds both. Digits are selected from least
+ * to most significant with an explicit stack, the most significant free digit
+ * is handled in its own inner loop so the stack is never touched on the way
+ * to a leaf.
+ */
+template<typename Sink>
+bool enumerateBetween(u64 width, u64 top, const SubtreeState& state, Sink&& sink) noexcept {
+    const auto onlyMultiplesOfThree = width > 10;
+    auto start = state.length;
+    if (start == top) {
+        if ((!onlyMultiplesOfThree || (state.sum % 3) == 0) && isQuodigious(state.value, state.sum, state.product)) {
+            return deliver(sink, state.value);
+        }
+        return true;
+    }
+    const auto last = top - 1;
+    const auto lastFactor = factors10[last];
+    std::array<u64, maxQuodigiousWidth + 1> sums;
+    std::array<u64, maxQuodigiousWidth + 1> products;
+    std::array<u64, maxQuodigiousWidth + 1> values;
+    std::array<byte, maxQuodigiousWidth + 1> choices;
+    auto level = start;
+    sums[level] = state.sum;
+    products[level] = state.product;
+    values[level] = state.value;
+    choices[level] = 0;
+    while (true) {
+        if (level == last) {
+            auto s = sums[level];
+            auto p = products[level];
+            auto v = values[level];
+            auto check = [&sink, s, p, v, lastFactor](auto d) noexcept {
+                auto ev = v + (d * lastFactor);
+                return !isQuodigious(ev, s + d, p * d) || deliver(sink, ev);
+            };
+            if (onlyMultiplesOfThree) {
+                for (auto d : completingDigits[s % 3]) {
+                    if (d == 0) {
+                        break;
+                    } else if (!check(d)) {
+                        return false;
+                    }
+                }
+            } else {
+                for (auto d : quodigiousDigits) {
+                    if (!check(d)) {
+                        return false;
+                    }
+                }
+            }
+        } else if (choices[level] < quodigiousDigits.size()) {
+            auto d = quodigiousDigits[choices[level]];
+            sums[level + 1] = sums[level] + d;
+            products[level + 1] = products[level] * d;
+            values[level + 1] = values[level] + (d * factors10[level]);
+            choices[level + 1] = 0;
+            ++level;
+            continue;
+        }
+        // this level is exhausted, move back down to the previous one
+        if (level == start) {
+            return true;
+        }
+        --level;
+        ++choices[level];
+    }
+}
+
+template<typename Sink>
+bool enumerateSubtree(u64 width, const SubtreeState& state, Sink&& sink) noexcept {
+    return enumerateBetween(width, width, state, sink);
+}
+
+/*
+ * Walk every number of the given width ending in the given lower digits,
+ * false if those can't be the end of such a number (not if the sink stopped
+ * the walk).
+ */
+template<typename Sink>
+bool enumerateSubtree(u64 width, u64 lowerDigits, Sink&& sink) noexcept {
+    SubtreeState state;
+    if (!lowerDigitsState(lowerDigits, state) || state.length > width || width > maxQuodigiousWidth) {
+        return false;
+    }
+    enumerateSubtree(width, state, sink);
+    return true;
+}
+
+/*
+ * Walk the numbers of a width of ten or more with the given tens digit. Even
+ * tens digits are followed by a 4 or an 8 and odd ones by a 2 or a 6, these
+ * are independent of each other so they make good units of work for
+ * threads.
+ */
+constexpr u64 firstPairedOnes(u64 tens) noexcept {
+    return (tens % 2ul == 0) ? 4ul : 2ul;
+}
+template<typename Sink>
+bool enumerateTens(u64 width, u64 tens, Sink&& sink) noexcept {
+    for (auto ones = firstPairedOnes(tens); ones < 10ul; ones += 4ul) {
+        if (!enumerateSubtree(width, SubtreeState { tens + ones, tens * ones, (tens * 10) + ones, 2 }, sink)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Sink>
+bool enumerate(u64 width, Sink&& sink) noexcept {
+    if (width == 0 || width > maxQuodigiousWidth) {
+        return true;
+    } else if (width < 10) {
+        return enumerateSubtree(width, SubtreeState(), sink);
+    } else {
+        for (auto tens : quodigiousDigits) {
+            if (!enumerateTens(width, tens, sink)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/*
+ * Walk every number of the given width which starts with the given leading
+ * digits, depth digits below them are still free.
+ */
+template<typename Sink>
+bool enumerateBelow(u64 width, u64 depth, u64 number, u64 sum, u64 product, Sink& sink) noexcept {
+    if (width < 10) {
+        return enumerateBetween(width, depth, SubtreeState { sum, product, number, 0 }, sink);
+    } else if (depth >= 2) {
+        // pick the two least significant digits the same way enumerateTens does
+        for (auto tens : quodigiousDigits) {
+            for (auto ones = firstPairedOnes(tens); ones < 10ul; ones += 4ul) {
+                if (!enumerateBetween(width, depth, SubtreeState { sum + tens + ones, product * tens * ones, number + (tens * 10) + ones, 2 }, sink)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    } else if (depth == 1) {
+        // the tens digit is already settled, only its ones digits are left
+        for (auto ones = firstPairedOnes((number / 10) % 10); ones < 10ul; ones += 4ul) {
+            if (!enumerateBetween(width, 1, SubtreeState { sum + ones, product * ones, number + ones, 1 }, sink)) {
+                return false;
+            }
+        }
+        return true;
+    } else {
+        // both are settled, a ones digit the tens digit never pairs up with
+        // would not have been walked by enumerate either
+        auto ones = number % 10;
+        auto first = firstPairedOnes((number / 10) % 10);
+        if (ones != first && ones != (first + 4)) {
+            return true;
+        }
+        return enumerateBetween(width, 0, SubtreeState { sum, product, number, 0 }, sink);
+    }
+}
+
+/*
+ * Range queries settle the digits from the most significant one down instead
+ * so that the walk can be clipped: a digit whose subtree lies completely
+ * outside of [lo, hi] is skipped and a subtree which lies completely inside
+ * of it is walked by enumerateBelow without looking at the bounds again.
+ * Only the subtrees along the two bounds are clipped so the cost follows the
+ * size of the range instead of the width.
+ */
+template<typename Sink>
+bool enumerateClipped(u64 width, u64 depth, u64 number, u64 sum, u64 product, u64 lo, u64 hi, Sink& sink) noexcept {
+    if (depth == 0) {
+        return enumerateBelow(width, 0, number, sum, product, sink);
+    }
+    auto innerDepth = depth - 1;
+    auto factor = factors10[innerDepth];
+    auto smallest = 2 * repunit(innerDepth);
+    auto largest = 9 * repunit(innerDepth);
+    for (auto d : quodigiousDigits) {
+        auto next = number + (d * factor);
+        if (next + largest < lo) {
+            continue;
+        } else if (next + smallest > hi) {
+            break;
+        } else if (next + smallest < lo || next + largest > hi) {
+            if (!enumerateClipped(width, innerDepth, next, sum + d, product * d, lo, hi, sink)) {
+                return false;
+            }
+        } else if (!enumerateBelow(width, innerDepth, next, sum + d, product * d, sink)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Every number in [lo, hi], whatever its width.
+ */
+template<typename Sink>
+bool enumerateRange(u64 lo, u64 hi, Sink&& sink) noexcept {
+    for (auto width = 1ul; width <= maxQuodigiousWidth; ++width) {
+        if (!enumerateClipped(width, width, 0, 0, 1, lo, hi, sink)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Every number of the given width in ascending order. The leading digits are
+ * stepped through in order and the digits below them are walked in one go
+ * and sorted, so a sink which stops after the first few numbers only pays
+ * for the leading digits up to where those are.
+ */
+constexpr auto ascendingBandDigits = 10ul;
+template<typename Sink>
+bool enumerateAscending(u64 width, Sink&& sink) {
+    if (width == 0 || width > maxQuodigiousWidth) {
+        return true;
+    }
+    auto depth = std::min(width, ascendingBandDigits);
+    auto leading = width - depth;
+    // the index into quodigiousDigits of each leading digit, most
+    // significant first
+    std::array<u64, maxQuodigiousWidth> choices { };
+    std::vector<u64> band;
+    auto collect = [&band](u64 value) noexcept { band.emplace_back(value); };
+    while (true) {
+        auto number = 0ul;
+        auto sum = 0ul;
+        auto product = 1ul;
+        for (auto i = 0ul; i < leading; ++i) {
+            auto d = quodigiousDigits[choices[i]];
+            number = (number * 10) + d;
+            sum += d;
+            product *= d;
+        }
+        band.clear();
+        enumerateBelow(width, depth, number * factors10[depth], sum, product, collect);
+        std::sort(band.begin(), band.end());
+        for (auto value : band) {
+            if (!deliver(sink, value)) {
+                return false;
+            }
+        }
+        // step to the next leading digits
+        auto i = leading;
+        for (; i > 0 && ++choices[i - 1] == quodigiousDigits.size(); --i) {
+            choices[i - 1] = 0;
+        }
+        if (i == 0) {
+            return true;
+        }
+    }
+}
+
+inline u64 count(u64 width) noexcept {
+    auto result = 0ul;
+    enumerate(width, [&result](u64) noexcept { ++result; });
+    return result;
+}
+
 /*
  * Order hashes are a unique design to describe the position of a given value
  * quickly, although extracting the values out requires some unpacking. The
@@ -101,6 +441,38 @@ constexpr u64 encodeDigitIntoOrderHash(u64 value, u64 digit) noexcept {
     return maskedValue | valueToInject;
 }
 
+/*
+ * Allocator which hands out cache line aligned storage, used to keep the
+ * lookup tables walked by the hot loops from straddling cache lines.
+ */
+template<typename T, std::size_t alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, alignment>;
+    };
+    AlignedAllocator() noexcept = default;
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, alignment>&) noexcept { }
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignment)));
+    }
+    void deallocate(T* ptr, std::size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+};
+
+template<typename T, typename U, std::size_t alignment>
+constexpr bool operator==(const AlignedAllocator<T, alignment>&, const AlignedAllocator<U, alignment>&) noexcept {
+    return true;
+}
+
+template<typename T, typename U, std::size_t alignment>
+constexpr bool operator!=(const AlignedAllocator<T, alignment>&, const AlignedAllocator<U, alignment>&) noexcept {
+    return false;
+}
+
 constexpr auto debugEnabled() noexcept {
 #ifdef DEBUG
     return true;
@@ -26,10 +26,37 @@
 // in the encoding so it is perfect for this design.
 // decimal would be
 #include "qlib.h"
+#include "rules.h"
+#include "suffixes.h"
+#include "counters.h"
+#include "progress.h"
+#include "perfcounters.h"
+#include "trace.h"
+#include "membership.h"
+#include "daemon.h"
+#include "subtreecache.h"
 #include <iostream>
+#include <fstream>
+#include <array>
 #include <tuple>
 #include <functional>
 #include <future>
+#include <atomic>
+#include <limits>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <cerrno>
+#include <thread>
+#include <cmath>
+#include <ctime>
+#include <unistd.h>
 
 template<u64 position>
 constexpr auto shiftAmount = position * 3;
@@ -63,6 +90,12 @@ constexpr u64 convertNumber(u64 value) noexcept {
         }() + convertNumber<nextPos>(value);
     }
 }
+/*
+ * The decimal value of a number of the given width made up entirely of twos,
+ * this is what an index of zero converts to.
+ */
+template<u64 width>
+constexpr auto allTwos = 2 * ((fastPow10<width> - 1) / 9);
 template<u64 len>
 constexpr auto shouldSkip5Digit(u64 x) noexcept {
     if constexpr (len > 4) {
@@ -72,11 +105,6 @@ constexpr auto shouldSkip5Digit(u64 x) noexcept {
     }
 }
 
-
-#define SKIP5s(x) \
-    if (shouldSkip5Digit<length>(x)) { \
-        ++x; \
-    }
 constexpr bool isDivisibleByThree(u64 value) noexcept {
     return (value % 3) == 0;
 }
@@ -86,39 +114,557 @@ constexpr bool isNotDivisibleByThree(u64 value) noexcept {
 constexpr u64 computePartialProduct(u64 a, u64 b) noexcept {
     return a * (b + 2);
 }
+/*
+ * The rules in effect for this run, they are fixed before the first width is
+ * computed so the tables built for a width can depend on them.
+ */
+RuleSet activeRules;
+bool collectStatistics = false;
+
+inline bool skipFives() noexcept {
+    return activeRules.enabled(Rule::SkipFive) && !activeRules.complemented(Rule::SkipFive);
+}
+/*
+ * When verifying skip-five only the numbers with at least one five are of
+ * interest, which is the same as the product being divisible by five.
+ */
+inline bool onlyWithFives() noexcept {
+    return activeRules.complemented(Rule::SkipFive);
+}
+inline bool onlyMultiplesOfThree(u64 width) noexcept {
+    return (width > 10) && activeRules.enabled(Rule::SumModThree) && !activeRules.complemented(Rule::SumModThree);
+}
+/*
+ * The number of leaves underneath a subtree with the given number of digits
+ * left to select.
+ */
+inline u64 leavesBelow(u64 remaining) noexcept {
+    auto result = 1ul;
+    for (auto i = 0ul; i < remaining; ++i) {
+        result *= (skipFives() ? 7ul : 8ul);
+    }
+    return result;
+}
+inline void countPruned(Rule rule, u64 remaining) noexcept {
+    if (collectStatistics) {
+        threadStatistics().prune(rule, leavesBelow(remaining));
+    }
+}
+inline void flushThreadStatistics() noexcept {
+    if (collectStatistics) {
+        flushStatistics();
+    }
+    flushCounters();
+}
 constexpr bool divisibleByProductAndSum(u64 value, u64 product, u64 sum) noexcept {
     return isQuodigious(value, sum, product);
     //return (value % product == 0) && (value % sum == 0);
 }
 
+/*
+ * The number of most significant digits which are still left to select when
+ * the sum reachability oracle is consulted by widths without a permutation
+ * tail. Widths with one consult it right above the tail instead, with the
+ * whole tail left to select. Setting this to zero disables the oracle
+ * completely.
+ */
+constexpr auto oracleDepth = 2ul;
+
+/*
+ * Since we walk from the least significant digit upward, at any given
+ * position we know the lower part L of the number and the sum of its digits.
+ * The r digits which remain form an upper part H which is shifted by the
+ * current position p. The final number can only be quodigious if there is some
+ * H whose digit sum gives a final sum S with (L + 10^p * H) % S == 0.
+ *
+ * For a given width we precompute, for each possible final sum S and each
+ * residue t = -(10^p * H) mod S, a bitmask of the upper part digit sums that
+ * require a lower part with that residue. At the oracle depth we then only
+ * have to walk the handful of possible final sums instead of every leaf
+ * underneath us.
+ */
+class SumReachabilityOracle {
+    public:
+        using Mask = u64;
+        SumReachabilityOracle(u64 width, u64 remaining, bool onlyMultiplesOfThree, bool includeFive);
+        SumReachabilityOracle(const SumReachabilityOracle&) = delete;
+        SumReachabilityOracle(SumReachabilityOracle&&) = delete;
+        ~SumReachabilityOracle() = default;
+        bool reachable(u64 sum, u64 lower) const noexcept {
+            // 32-bit division is a good deal cheaper and the lower part of
+            // the narrower widths will always fit
+            if (lower <= std::numeric_limits<u32>::max()) {
+                return scan<u32>(sum, lower);
+            } else {
+                return scan<u64>(sum, lower);
+            }
+        }
+        /*
+         * Every digit sum offset of the upper part which still leaves a sum
+         * dividing the final number, one bit each.
+         */
+        Mask reachableOffsets(u64 sum, u64 lower) const noexcept {
+            if (lower <= std::numeric_limits<u32>::max()) {
+                return collect<u32>(sum, lower);
+            } else {
+                return collect<u64>(sum, lower);
+            }
+        }
+    private:
+        template<typename T>
+        bool scan(T sum, T lower) const noexcept {
+            // the sum we are handed already accounts for a two in every
+            // position so we only need to add the offset of each upper digit
+            for (T d = 0; d <= _upperSumRange; ++d) {
+                auto finalSum = sum + d;
+                if (_onlyMultiplesOfThree && isNotDivisibleByThree(finalSum)) {
+                    continue;
+                }
+                if ((_masks[_offsets[finalSum] + (lower % finalSum)] >> d) & 1) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        template<typename T>
+        Mask collect(T sum, T lower) const noexcept {
+            Mask result = 0;
+            for (T d = 0; d <= _upperSumRange; ++d) {
+                auto finalSum = sum + d;
+                if (_onlyMultiplesOfThree && isNotDivisibleByThree(finalSum)) {
+                    continue;
+                }
+                result |= (_masks[_offsets[finalSum] + (lower % finalSum)] & (Mask(1) << d));
+            }
+            return result;
+        }
+
+        u64 _upperSumRange;
+        bool _onlyMultiplesOfThree;
+        std::vector<u64> _offsets;
+        std::vector<Mask> _masks;
+};
+
+SumReachabilityOracle::SumReachabilityOracle(u64 width, u64 remaining, bool onlyMultiplesOfThree, bool includeFive) :
+    _upperSumRange(7 * remaining),
+    _onlyMultiplesOfThree(onlyMultiplesOfThree),
+    _offsets((9 * width) + 1, 0) {
+    // each final sum S gets S residue slots, laid out back to back
+    auto total = 0ul;
+    for (auto s = 0ul; s < _offsets.size(); ++s) {
+        _offsets[s] = total;
+        total += s;
+    }
+    _masks.assign(total, 0);
+    std::vector<u64> digits;
+    for (auto digit = 2ul; digit < 10ul; ++digit) {
+        if (digit != 5 || includeFive) {
+            digits.emplace_back(digit);
+        }
+    }
+    // Walking every upper part on its own is 7^r of them for each sum, which
+    // gets slow for the deeper tails. Instead select the digits one position
+    // at a time and only track which digit sum offsets reach each residue of
+    // the shifted upper part.
+    std::vector<Mask> current, next;
+    for (auto s = (2 * width); s < _offsets.size(); ++s) {
+        current.assign(s, 0);
+        current[0] = 1;
+        for (auto i = 0ul; i < remaining; ++i) {
+            auto place = factors10[width - remaining + i] % s;
+            next.assign(s, 0);
+            for (auto r = 0ul; r < s; ++r) {
+                if (current[r] == 0) {
+                    continue;
+                }
+                for (auto digit : digits) {
+                    next[(r + (digit * place)) % s] |= (current[r] << (digit - 2));
+                }
+            }
+            current.swap(next);
+        }
+        // index by the residue the lower part needs to have for the upper
+        // parts to complete it
+        for (auto r = 0ul; r < s; ++r) {
+            _masks[_offsets[s] + ((s - r) % s)] |= current[r];
+        }
+    }
+}
+
+/*
+ * Does the given rule prune anything at all for the given width, the
+ * complement of a rule which never fires is empty.
+ */
+template<u64 width>
+constexpr bool ruleApplies(Rule rule) noexcept {
+    switch (rule) {
+        case Rule::SkipFive: return true;
+        case Rule::SumModThree: return width > 10;
+        case Rule::ParityPair: return width >= 10;
+        case Rule::SumOracle: return width > oracleDepth;
+        default: return false;
+    }
+}
+/*
+ * The range of most significant digits which can be handled by walking a table
+ * of precomputed permutations instead of recursing any further. Wider tails
+ * get more out of merging identical multisets while narrower ones keep the
+ * table small enough to stay in the L1.
+ */
+constexpr auto minTailLength = 3ul;
+constexpr auto maxTailLength = 8ul;
+constexpr auto defaultTailLength = 5ul;
+
+/*
+ * The tail length used for each width, this is either the default, provided
+ * on the command line or loaded from a previous tuning run.
+ */
+std::array<u64, 20> tailLengths {
+    defaultTailLength, defaultTailLength, defaultTailLength, defaultTailLength,
+    defaultTailLength, defaultTailLength, defaultTailLength, defaultTailLength,
+    defaultTailLength, defaultTailLength, defaultTailLength, defaultTailLength,
+    defaultTailLength, defaultTailLength, defaultTailLength, defaultTailLength,
+    defaultTailLength, defaultTailLength, defaultTailLength, defaultTailLength,
+};
+
+static_assert((7 * std::max(oracleDepth, maxTailLength)) < (sizeof(SumReachabilityOracle::Mask) * 8), "Oracle depth is too large for the mask type!");
+
+/*
+ * The oracle of the given width for the given number of remaining digits.
+ * They are built on first use, which the daemon can run into from several
+ * queries at once.
+ */
+template<u64 width>
+const SumReachabilityOracle& getOracle(u64 remaining) noexcept {
+    static constexpr auto slots = std::max(oracleDepth, maxTailLength) + 1;
+    static std::array<std::unique_ptr<SumReachabilityOracle>, slots> oracles;
+    static std::array<std::once_flag, slots> built;
+    std::call_once(built[remaining], [remaining]() {
+        oracles[remaining] = std::make_unique<SumReachabilityOracle>(width, remaining, onlyMultiplesOfThree(width), !skipFives());
+    });
+    return *oracles[remaining];
+}
+
+using TailDigits = std::array<u32, maxTailLength>;
+
+constexpr u64 binomial(u64 n, u64 k) noexcept {
+    auto result = 1ul;
+    for (auto i = 1ul; i <= k; ++i) {
+        result = (result * (n - k + i)) / i;
+    }
+    return result;
+}
+
+constexpr u64 integerPow(u64 base, u64 exponent) noexcept {
+    auto result = 1ul;
+    for (auto i = 0ul; i < exponent; ++i) {
+        result *= base;
+    }
+    return result;
+}
+
+/*
+ * Step to the next distinct ordering of the first count values, returns false
+ * once the values have wrapped back around to being sorted.
+ */
+constexpr bool nextPermutation(TailDigits& values, u64 count) noexcept {
+    if (count < 2) {
+        return false;
+    }
+    auto i = count - 1;
+    while (i > 0 && values[i - 1] >= values[i]) {
+        --i;
+    }
+    if (i == 0) {
+        return false;
+    }
+    auto j = count - 1;
+    while (values[j] <= values[i - 1]) {
+        --j;
+    }
+    auto tmp = values[i - 1];
+    values[i - 1] = values[j];
+    values[j] = tmp;
+    for (auto lo = i, hi = count - 1; lo < hi; ++lo, --hi) {
+        tmp = values[lo];
+        values[lo] = values[hi];
+        values[hi] = tmp;
+    }
+    return true;
+}
+
+/*
+ * Step to the next multiset, represented as a non decreasing sequence of
+ * indices into the digit alphabet.
+ */
+constexpr bool nextMultiset(TailDigits& values, u64 count, u64 digitCount) noexcept {
+    auto i = count;
+    while (i > 0 && values[i - 1] == (digitCount - 1)) {
+        --i;
+    }
+    if (i == 0) {
+        return false;
+    }
+    auto next = values[i - 1] + 1;
+    for (auto j = i - 1; j < count; ++j) {
+        values[j] = next;
+    }
+    return true;
+}
+
+constexpr u64 countTailPermutations(u64 length, u64 digitCount) noexcept {
+    auto count = 0ul;
+    TailDigits digits { };
+    do {
+        auto permutation = digits;
+        do {
+            ++count;
+        } while (nextPermutation(permutation, length));
+    } while (nextMultiset(digits, length, digitCount));
+    return count;
+}
+static_assert(countTailPermutations(minTailLength, 7) == integerPow(7, minTailLength), "Tail generation does not cover every ordering!");
+static_assert(countTailPermutations(defaultTailLength, 7) == integerPow(7, defaultTailLength), "Tail generation does not cover every ordering!");
+
+/*
+ * Once the sum and product of the tail digits are known, the order of those
+ * digits only changes the final number. So instead of recursing through the
+ * tail we walk every sorted multiset of tail digits once and then every
+ * distinct ordering of it.
+ *
+ * The table is laid out as a structure of arrays: the per multiset sums (in
+ * encoded form), products and permutation start indices, followed by the
+ * decimal offsets of each permutation. The multisets are grouped by their sum
+ * mod three so the three way sum check turns into picking a group.
+ *
+ * The eight digit table has millions of entries so the tables are generated
+ * once on startup rather than at compile time.
+ */
+struct PermutationTail {
+    template<typename T>
+    using Column = std::vector<T, AlignedAllocator<T>>;
+    PermutationTail(u64 length, bool includeFive);
+    PermutationTail(const PermutationTail&) = delete;
+    PermutationTail(PermutationTail&&) = delete;
+    ~PermutationTail() = default;
+    auto groupStart(u64 group) const noexcept { return groups[group]; }
+    auto groupEnd(u64 group) const noexcept { return groups[group + 1]; }
+    Column<u32> sums;
+    Column<u32> products;
+    Column<u32> starts;
+    Column<u32> offsets;
+    std::array<u32, 4> groups;
+};
+
+PermutationTail::PermutationTail(u64 length, bool includeFive) {
+    TailDigits codes { };
+    auto digitCount = 0ul;
+    for (auto code = 0ul; code < 8ul; ++code) {
+        if (includeFive || code != 3ul) {
+            codes[digitCount] = code;
+            ++digitCount;
+        }
+    }
+    auto multisetCount = binomial(length + digitCount - 1, length);
+    sums.reserve(multisetCount);
+    products.reserve(multisetCount);
+    starts.reserve(multisetCount + 1);
+    offsets.reserve(integerPow(digitCount, length));
+    for (auto group = 0ul; group < 3ul; ++group) {
+        groups[group] = sums.size();
+        TailDigits digits { };
+        do {
+            auto sum = 0ul;
+            auto product = 1ul;
+            for (auto i = 0ul; i < length; ++i) {
+                sum += codes[digits[i]];
+                product *= (codes[digits[i]] + 2);
+            }
+            if ((sum % 3) != group) {
+                continue;
+            }
+            sums.emplace_back(sum);
+            products.emplace_back(product);
+            starts.emplace_back(offsets.size());
+            auto permutation = digits;
+            do {
+                auto offset = 0ul;
+                for (auto k = length; k > 0; --k) {
+                    offset = (offset * 10) + codes[permutation[k - 1]];
+                }
+                offsets.emplace_back(offset);
+            } while (nextPermutation(permutation, length));
+        } while (nextMultiset(digits, length, digitCount));
+    }
+    groups[3] = sums.size();
+    starts.emplace_back(offsets.size());
+}
+
+template<u64 length, bool includeFive>
+const PermutationTail& getPermutationTail() noexcept {
+    static PermutationTail tail(length, includeFive);
+    return tail;
+}
+
+template<u64 width>
+constexpr bool hasPermutationTail(u64 tailLength) noexcept {
+    return (width > 10) && (tailLength >= minTailLength) && (tailLength <= maxTailLength);
+}
+
+template<u64 width, u64 length>
+const PermutationTail& selectPermutationTail() noexcept {
+    if (skipFives()) {
+        return getPermutationTail<length, !shouldSkip5Digit<width>(3ul)>();
+    } else {
+        return getPermutationTail<length, true>();
+    }
+}
+
+/*
+ * Build the table used by the given width before any threads are spun up.
+ */
+template<u64 width, u64 tail = minTailLength>
+void preparePermutationTail(u64 tailLength) noexcept {
+    if constexpr (tail <= maxTailLength) {
+        if (tail == tailLength) {
+            selectPermutationTail<width, tail>();
+        } else {
+            preparePermutationTail<width, tail + 1>(tailLength);
+        }
+    }
+}
+
+/*
+ * The position whose nodes are counted as completed prefixes for the progress
+ * reporter, set up for each width before any threads are started.
+ */
+u64 progressDepth = 0;
+/*
+ * Progress is never counted any further up than this, which keeps the check
+ * out of the nodes near the leaves. It is deep enough for any suffix in a
+ * whitelist.
+ */
+constexpr auto maxProgressDepth = u64(SuffixWhitelist::maxLength);
+struct PrefixGuard {
+    bool active;
+    ~PrefixGuard() {
+        if (active) {
+            completeProgressPrefix();
+        }
+    }
+};
+
+/*
+ * Stop walking once any this many quodigious numbers have been found (-k),
+ * zero walks everything. Which numbers make the cut depends on how the
+ * threads get scheduled, it is the count that is guaranteed and not that
+ * they are the smallest ones, -K is the one for those.
+ */
+u64 matchLimit = 0;
+std::atomic<u64> matchesFound { 0 };
+std::atomic<bool> stopWalk { false };
+/*
+ * The flag is only looked at on the way into a subtree with at least this many
+ * digits left to walk, so a stop takes effect within a few hundred thousand
+ * leaves and the leaves themselves never pay for it.
+ */
+constexpr auto stopCheckDistance = 6ul;
+inline bool walkStopped() noexcept {
+    return stopWalk.load(std::memory_order_relaxed);
+}
+inline void countMatch() noexcept {
+    if (matchLimit > 0 && (matchesFound.fetch_add(1, std::memory_order_relaxed) + 1) >= matchLimit) {
+        stopWalk.store(true, std::memory_order_relaxed);
+    }
+}
+inline void countMatches(u64 count) noexcept {
+    if (matchLimit > 0 && count > 0 && (matchesFound.fetch_add(count, std::memory_order_relaxed) + count) >= matchLimit) {
+        stopWalk.store(true, std::memory_order_relaxed);
+    }
+}
+void resetMatchLimit() noexcept {
+    matchesFound = 0;
+    stopWalk = false;
+}
+/*
+ * Print matches while keeping to the match limit, printed carries the count
+ * over from earlier calls.
+ */
+void printMatches(const MatchList& list, u64& printed) noexcept {
+    for (const auto& v : list) {
+        if (matchLimit > 0 && printed >= matchLimit) {
+            return;
+        }
+        std::cout << v << std::endl;
+        ++printed;
+    }
+}
+
 using DataTriple = std::tuple<u64, u64, u64>;
 using DataTripleList = std::list<DataTriple>;
 template<u64 position, u64 length>
 void body(MatchList& list, const DataTriple& contents) noexcept;
+/*
+ * We carry the decimal value of the number with every position we have not
+ * reached yet set to two. Selecting a digit is then just a matter of adding a
+ * multiple of the current power of ten and the leaves get the final number
+ * for free.
+ */
 template<u64 position, u64 length>
-void body(MatchList& list, u64 sum = 0, u64 product = 1, u64 index = 0) noexcept {
+void body(MatchList& list, u64 sum = 0, u64 product = 1, u64 value = allTwos<length>) noexcept {
     static_assert(length <= 19, "Can't have numbers over 19 digits on 64-bit numbers!");
     static_assert(length > 0, "Can't have length of zero!");
     static_assert(length >= position, "Position is out of bounds!");
-    static constexpr auto indexIncr = getShiftedValue<position>(1ul);
+    static constexpr auto valueIncr = fastPow10<position>;
     static constexpr auto lenGreaterAndPos = [](u64 len, u64 pos) noexcept {
         return (length > len) && (position == pos);
     };
     static constexpr auto nextPosition = position + 1;
     auto fn = [&list](auto n, auto ep, auto es) noexcept {
-        if (divisibleByProductAndSum(n, ep, es)) {
+        if (collectStatistics) {
+            ++threadStatistics().tested;
+        }
+        if constexpr (countersEnabled()) {
+            auto& counters = threadCounters();
+            ++counters.tested;
+            if (!componentQuodigious<u64>(n, ep)) {
+                ++counters.rejectedProduct;
+            } else if (!componentQuodigious<u64>(n, es)) {
+                ++counters.rejectedSum;
+            } else {
+                ++counters.matches;
+                list.emplace_back(n);
+                countProgressMatch();
+                countMatch();
+            }
+        } else if (divisibleByProductAndSum(n, ep, es)) {
             list.emplace_back(n); 
+            countProgressMatch();
+            countMatch();
         }
     };
     static constexpr auto lenPosDifference = length - position;
+    if constexpr (lenPosDifference >= stopCheckDistance) {
+        if (walkStopped()) {
+            return;
+        }
+    }
+    countNode(position);
+    PrefixGuard prefix { (position <= maxProgressDepth) && (position == progressDepth) };
     if constexpr (position == length) {
         if constexpr (length > 10) {
-            // if the number is not divisible by three then skip it
-            if (isNotDivisibleByThree(sum)) {
+            // if the number is not divisible by three then skip it (or the
+            // other way around when verifying the rule)
+            if (activeRules.enabled(Rule::SumModThree) && (isNotDivisibleByThree(sum) != activeRules.complemented(Rule::SumModThree))) {
+                countPruned(Rule::SumModThree, 0);
+                countRejectedModThree(1);
                 return;
             }
         }
-        fn(convertNumber<length>(index), product, sum);
+        if (onlyWithFives() && (product % 5) != 0) {
+            return;
+        }
+        fn(value, product, sum);
     } else if constexpr (lenGreaterAndPos(10, 2) || 
             lenGreaterAndPos(11, 3) || 
             lenGreaterAndPos(12, 4) || 
@@ -128,22 +674,32 @@ void body(MatchList& list, u64 sum = 0, u64 product = 1, u64 index = 0) noexcept
         // of execution
         auto dprod = product << 1;
         DataTripleList lower {
-            { sum, dprod, index },
-            { sum + 1, dprod + product, index + indexIncr},
-            { sum + 2, dprod + (2 * product), index + (2 * indexIncr)},
-            // ignore 3oct (5dec) digits
+            { sum, dprod, value },
+            { sum + 1, dprod + product, value + valueIncr},
+            { sum + 2, dprod + (2 * product), value + (2 * valueIncr)},
         };
+        if (skipFives()) {
+            // ignore 3oct (5dec) digits
+            countPruned(Rule::SkipFive, lenPosDifference - 1);
+        } else {
+            lower.emplace_back(sum + 3, dprod + (3 * product), value + (3 * valueIncr));
+        }
         DataTripleList upper {
-            {sum + 4, dprod + (4 * product), index + (4 * indexIncr)},
-            {sum + 5, dprod + (5 * product), index + (5 * indexIncr)},
-            {sum + 6, dprod + (6 * product), index + (6 * indexIncr)},
-            {sum + 7, dprod + (7 * product), index + (7 * indexIncr)},
+            {sum + 4, dprod + (4 * product), value + (4 * valueIncr)},
+            {sum + 5, dprod + (5 * product), value + (5 * valueIncr)},
+            {sum + 6, dprod + (6 * product), value + (6 * valueIncr)},
+            {sum + 7, dprod + (7 * product), value + (7 * valueIncr)},
         };
         auto halveIt = [](const DataTripleList& collection) noexcept {
+            PerfScope perf(PerfPhase::Walk);
+            // every entry shares the digits below this position
+            TraceScope trace("halveIt", length, position, std::get<2>(collection.front()) % factors10[position]);
             MatchList l;
             for(const auto& a : collection) {
                 body<nextPosition, length>(l, a);
             }
+            flushThreadStatistics();
+            trace.setResults(l.size());
             return l;
         };
         auto t0 = std::async(std::launch::async, halveIt, std::cref(lower)),
@@ -152,427 +708,356 @@ void body(MatchList& list, u64 sum = 0, u64 product = 1, u64 index = 0) noexcept
              l1 = t1.get();
         list.splice(list.cbegin(), l0);
         list.splice(list.cbegin(), l1);
-    } else if constexpr (length > 10 && (lenPosDifference == 5)) {
-        using p10Collection = std::tuple<u64, u64, u64, u64, u64>;
-        static constexpr auto buildTuple = [](u64 val) noexcept {
-            return p10Collection(
-                    val * fastPow10<position>, 
-                    val * fastPow10<position+1>,
-                    val * fastPow10<position+2>,
-                    val * fastPow10<position+3>,
-                    val * fastPow10<position+4>);
-        };
-        static constexpr std::array<p10Collection,8> p10s {
-            buildTuple(0),
-            buildTuple(1),
-            buildTuple(2),
-            buildTuple(3),
-            buildTuple(4),
-            buildTuple(5),
-            buildTuple(6),
-            buildTuple(7),
-        };
-
-        // this will generate a partial number but reduce the number of conversions
-        // required greatly!
-        // The last two digits are handled in a base 10 fashion without the +2 added
-        // This will make the partial converison correct (remember that a 0 becomes a 2
-        // in this model).
-        //
-        // Thus we implicitly add the offsets for each position to this base10 2 value :D
-
-        auto outerConverted = convertNumber<length>(index);
-        auto combineWithOuterConverted = [outerConverted](u64 var) noexcept {
-            auto [a0, a1, a2, a3, a4] = p10s[var]; 
-            return p10Collection(a0 + outerConverted, a1, a2, a3, a4);
-        };
-        std::array<p10Collection, 8> outerComputed {
-            combineWithOuterConverted(0),
-            combineWithOuterConverted(1),
-            combineWithOuterConverted(2),
-            combineWithOuterConverted(3),
-            combineWithOuterConverted(4),
-            combineWithOuterConverted(5),
-            combineWithOuterConverted(6),
-            combineWithOuterConverted(7),
-        };
-        static constexpr auto computeSumProduct = [](auto var, auto sum, auto product) noexcept {
-            return std::make_tuple(var + sum, computePartialProduct(product, var)); 
-        };
-
-        auto makeUltimatePackage = [&outerComputed](auto var, auto sum, auto product) noexcept {
-            return std::tuple_cat(outerComputed[var], computeSumProduct(var, sum, product));
-        };
-
-#define X(x,y,z,w,h) fn(x ## 1 + y ## 2 + z ## 3 + w ## 4 + h ## 5, ep, es)
-#define DECLARE_POSITION_VALUES(var) \
-        auto [var ## 1, var ## 2, var ## 3, var ## 4, var ## 5] = outerComputed[var]
-#define DECLARE_POSITION_VALUES2(var, sum, product) \
-        auto [var ## 1, var ## 2, var ## 3, var ## 4, var ## 5, var ## s , var ## p] = makeUltimatePackage(var, sum, product)
-        for (auto a = 0ul; a < 8ul; ++a) {
-            SKIP5s(a);
-            DECLARE_POSITION_VALUES2(a, sum, product);
-            for (auto b = a; b < 8ul; ++b) {
-                SKIP5s(b);
-                // use transitivity to reduce the amount of recomputation. 
-                // if a == b then it means that a and b can be used interchangably
-                // in the final computation so there is no need to actually perform
-                // separate computation with a and b. We can just use b (or a) in
-                // all cases where a and b need to be used. This allows us to 
-                // eliminate redundant cases. Thus speeding computation up quite
-                // a bit.
-                if (DECLARE_POSITION_VALUES2(b, as, ap); a == b) {
-                    for (auto c = b; c < 8ul; ++c) {
-                        SKIP5s(c);
-                        if (DECLARE_POSITION_VALUES2(c, bs, bp); b == c) {
-                            // a == b and b == c, => a == c. Thus a, b, and c 
-                            // can be used interchangeably. Thus the number of 
-                            // unique computations required is reduced even further
-                            // down this path
-                            for (auto d = c; d < 8ul; ++d) {
-                                SKIP5s(d);
-                                if (DECLARE_POSITION_VALUES2(d, cs, cp); c == d) {
-                                    // a == b and b == c and c == d => a == c 
-                                    // and a == d and b == d. Further reducing the
-                                    // number of required computations
-                                    //
-                                    // NOTE: This is the edge case where the number is
-                                    // like 4444444443, 999999999, 9999999998, etc.
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            // in all cases we must check this computation
-                                            X(d,d,d,d,e);
-                                            if (d != e) {
-                                                // if d != e then e is unique compared to
-                                                // every other value, thus we should perform
-                                                // computation with e in each position.
-                                                X(e,d,d,d,d); X(d,e,d,d,d); X(d,d,e,d,d); 
-                                                X(d,d,d,e,d); 
-                                            }
-                                        }
-                                    }
-                                } else {
-                                    // a == b and b == c and c != d => a == c and a != d and b != d
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            X(e,d,c,c,c); X(e,c,d,c,c); X(e,c,c,d,c);
-                                            X(e,c,c,c,d); 
-                                            X(b,b,c,d,e); X(c,e,d,c,c); X(c,e,c,d,c); 
-                                            X(c,e,c,c,d); X(c,c,e,d,c); X(c,c,e,c,d); 
-                                            if (d != e) {
-                                                X(d,e,c,c,c); X(d,c,e,c,c); X(d,c,c,e,c); 
-                                                X(d,c,c,c,e); X(c,d,e,c,c); X(c,d,c,e,c); 
-                                                X(c,d,c,c,e); X(c,c,d,e,c); X(c,c,d,c,e); 
-                                                X(c,c,c,e,d); 
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        } else {
-                            // a == b and b != c => a != c and c > b and c > a
-                            // read on for more information about the use of strict inequalities
-                            for (auto d = c; d < 8ul; ++d) {
-                                SKIP5s(d);
-                                if (DECLARE_POSITION_VALUES2(d, cs, cp); c == d) {
-                                    // a == b and b != c and c == d and a != c => a != d and b != d
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            X(e,d,c,b,b); X(e,d,b,c,b); X(e,d,b,b,c); 
-                                            X(e,b,b,d,c); X(e,b,d,c,b); X(e,b,d,b,c); 
-                                            X(b,e,b,d,c); X(b,e,d,c,b); X(b,e,c,b,d); 
-                                            X(b,b,c,d,e); 
-                                            if (d != e) {
-                                                X(d,e,c,b,b); X(d,e,b,c,b); X(d,e,b,b,c);
-                                                X(d,c,e,b,b); X(d,c,b,e,b); X(d,c,b,b,e);
-                                                X(d,b,e,c,b); X(d,b,e,b,c); X(d,b,c,e,b);
-                                                X(d,b,c,b,e); X(d,b,b,e,c); X(d,b,b,c,e);
-                                                X(b,d,e,c,b); X(b,d,e,b,c); X(b,d,c,e,b);
-                                                X(b,d,c,b,e); X(b,d,b,e,c); X(b,d,b,c,e);
-                                                X(b,b,e,d,d); X(b,b,d,e,d); 
-                                            }
-                                        }
-                                    }
-                                } else {
-                                    // a == b and b != c and c != d and a != c could
-                                    // cause problems because a could equal d and thus so
-                                    // could b. That is impossible in this case though
-                                    // as d would only ever be >= to c. In this case since
-                                    // c != d it means that d is greater than c. Thus
-                                    // it means that d != a and thus d != b. This property
-                                    // applies to all cases as we enter into further nested
-                                    // loops. Thus we get to the logic of:
-                                    //
-                                    // a == b and b != c and c != d and a != c and d > c => a != d and b != d 
-   
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            X(e,d,c,b,b); X(e,d,b,c,b); X(e,d,b,b,c); 
-                                            X(e,b,b,d,c); X(e,b,d,c,b); X(e,b,d,b,c); 
-                                            X(e,c,d,b,b); X(e,c,b,d,b); X(e,c,b,b,d); 
-                                            X(e,b,c,d,b); X(e,b,c,b,d); X(e,b,b,c,d);
-                                            X(b,b,c,d,e); 
-                                            X(b,e,d,c,b); X(b,e,c,b,d); X(b,e,b,d,c); 
-                                            X(c,e,d,b,b); X(c,e,b,d,b); X(c,e,b,b,d);
-                                            X(c,b,e,d,b); X(c,b,e,b,d); X(c,b,b,d,e);
-
-                                            X(b,e,d,b,c); X(b,e,c,d,b); X(b,e,b,c,d);
-                                            X(b,c,e,d,b); X(b,c,e,b,d); X(b,c,b,e,d); 
-                                            X(b,b,e,d,c); X(b,b,e,c,d); 
-                                            if (d != e) {
-                                                X(d,e,c,b,b); X(d,e,b,c,b); X(d,e,b,b,c);
-                                                X(d,c,e,b,b); X(d,c,b,e,b); X(d,c,b,b,e);
-                                                X(d,b,e,c,b); X(d,b,e,b,c); X(d,b,c,e,b);
-                                                X(d,b,c,b,e); X(d,b,b,e,c); X(d,b,b,c,e);
-                                                X(b,d,e,c,b); X(b,d,e,b,c); X(b,d,c,e,b);
-                                                X(b,d,c,b,e); X(b,d,b,e,c); X(b,d,b,c,e);
-                                                X(c,d,e,b,b); X(c,d,b,e,b); X(c,d,b,b,e);
-                                                X(c,b,d,e,b); X(c,b,d,b,e); X(c,b,b,e,d); 
-                                                X(b,c,d,e,b); X(b,c,d,b,e); X(b,c,b,d,e);
-                                                X(b,b,d,c,e); X(b,b,d,e,c); X(b,b,c,e,d); 
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+    } else {
+        if constexpr (hasPermutationTail<length>(lenPosDifference)) {
+            if (lenPosDifference == tailLengths[length]) {
+                // The tail positions are still twos in the value we carry.
+                // The offsets stored in the table are relative to that so we
+                // only need to shift them up to our position and add them in.
+                static constexpr auto scale = valueIncr;
+                // The oracle depth is underneath the tail so it is asked
+                // about the whole tail up front instead. It hands back the
+                // digit sums of the tail which can still divide the final
+                // number and the multisets with any other sum are skipped.
+                auto sums = ~SumReachabilityOracle::Mask(0);
+                if constexpr ((oracleDepth > 0) && (position > 0)) {
+                    static constexpr auto upperTwos = allTwos<lenPosDifference> * valueIncr;
+                    if (activeRules.enabled(Rule::SumOracle)) {
+                        sums = getOracle<length>(lenPosDifference).reachableOffsets(sum, value - upperTwos);
+                        // when verifying the oracle only the multisets it
+                        // rejects are walked
+                        if (activeRules.complemented(Rule::SumOracle)) {
+                            sums = ~sums;
+                        }
+                        if (sums == 0) {
+                            countPruned(Rule::SumOracle, lenPosDifference);
+                            return;
                         }
                     }
-                } else {
-                    for (auto c = b; c < 8ul; ++c) {
-                        SKIP5s(c);
-                        if (DECLARE_POSITION_VALUES2(c, bs, bp); b == c) {
-                            for (auto d = c; d < 8ul; ++d) {
-                                SKIP5s(d);
-                                if (DECLARE_POSITION_VALUES2(d, cs, cp); c == d) {
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            X(e,d,c,c,a); X(e,d,c,a,c); X(e,d,a,c,c); 
-                                            X(e,a,d,c,c); 
-                                            X(a,b,c,d,e); 
-                                            if (d != e) {
-                                                X(d,e,c,c,a); X(d,e,c,a,c); X(d,e,a,c,c);
-                                                X(d,c,e,c,a); X(d,c,e,a,c); X(d,c,c,e,a);
-                                                X(d,c,c,a,e); X(d,c,a,e,c); X(d,c,a,c,e);
-                                                X(a,c,c,e,d); X(c,a,d,e,c); X(c,a,d,c,e); 
-                                                X(d,a,e,d,d); X(a,e,d,d,d); X(a,d,e,d,d); 
-                                            }
-                                        }
-                                    }
-                                } else {
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            X(e,a,d,c,c); X(e,d,c,c,a); X(e,d,c,a,c); 
-                                            X(e,d,a,c,c); X(e,c,d,c,a); X(e,c,d,a,c); 
-                                            X(e,c,c,d,a); X(e,c,c,a,d); X(e,c,a,d,c); 
-                                            X(e,c,a,c,d); X(e,a,c,d,c); X(e,a,c,c,d); 
-                                            X(a,b,c,d,e); X(c,e,d,c,a); X(c,e,d,a,c); 
-                                            X(c,e,c,d,a); X(c,e,c,a,d); X(c,e,a,d,c); 
-                                            X(c,e,a,c,d); X(c,c,e,d,a); X(c,c,e,a,d); 
-                                            X(c,c,a,e,d); X(c,a,e,d,c); X(c,a,e,c,d); 
-                                            X(c,a,c,e,d); X(a,e,d,c,c); X(a,e,c,d,c); 
-                                            X(a,e,c,c,d); X(a,c,e,d,c); X(a,c,e,c,d); 
-                                            if (d != e) {
-                                                X(d,e,c,c,a); X(d,e,c,a,c); X(d,e,a,c,c);
-                                                X(d,c,e,c,a); X(d,c,e,a,c); X(d,c,c,e,a);
-                                                X(d,c,c,a,e); X(d,c,a,e,c); X(d,c,a,c,e);
-                                                X(a,c,c,e,d); X(c,a,d,e,c); X(c,a,d,c,e); 
-                                                X(d,a,e,c,c); X(d,a,c,e,c); X(d,a,c,c,e);
-                                                X(c,d,e,c,a); X(c,d,e,a,c); X(c,d,c,e,a);
-                                                X(c,d,c,a,e); X(c,d,a,e,c); X(c,d,a,c,e);
-                                                X(c,c,d,e,a); X(c,c,d,a,e); X(c,c,a,d,e);
-                                                X(a,d,e,c,c); X(a,d,c,e,c); X(a,d,c,c,e);
-                                                X(a,c,d,e,c); X(a,c,d,c,e); X(c,a,c,d,e);
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        } else {
-                            for (auto d = c; d < 8ul; ++d) {
-                                SKIP5s(d);
-                                if (DECLARE_POSITION_VALUES2(d,cs, cp); c == d) {
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-                                            X(e,d,d,b,a); X(e,d,d,a,b); X(e,d,b,d,a);
-                                            X(e,d,b,a,d); X(e,d,a,d,b); X(e,d,a,b,d);
-                                            X(e,b,d,d,a); X(e,b,d,a,d); X(e,b,a,d,d);
-                                            X(e,a,d,d,b); X(e,a,d,b,d); X(e,a,b,d,d);
-                                            X(a,b,c,d,e); X(a,e,d,d,b); X(a,e,d,b,d); 
-                                            X(a,e,b,d,d); X(b,e,d,d,a); X(b,e,d,a,d); 
-                                            X(b,e,a,d,d); X(b,a,d,d,e);
-
-                                            if (d != e) {
-                                                X(d,e,d,b,a); X(d,e,d,a,b); X(d,e,b,d,a);
-                                                X(d,e,b,a,d); X(d,e,a,d,b); X(d,e,a,b,d);
-                                                X(d,d,e,b,a); X(d,d,e,a,b); X(d,d,b,e,a);
-                                                X(d,d,b,a,e); X(d,d,a,e,b); X(d,d,a,b,e);
-                                                X(d,b,e,d,a); X(d,b,e,a,d); X(d,b,d,e,a);
-                                                X(d,b,d,a,e); X(d,b,a,e,d); X(d,b,a,d,e);
-                                                X(d,a,e,d,b); X(d,a,e,b,d); X(d,a,d,e,b);
-                                                X(d,a,d,b,e); X(d,a,b,e,d); X(d,a,b,d,e);
-
-                                                X(b,d,e,d,a); X(b,d,e,a,d); X(b,d,d,e,a);
-                                                X(b,d,d,a,e); X(b,d,a,e,d); X(b,d,a,d,e);
-                                                X(b,a,e,d,d); X(b,a,d,e,d); 
-
-                                                X(a,d,e,d,b); X(a,d,e,b,d); X(a,d,d,e,b);
-                                                X(a,d,d,b,e); X(a,d,b,e,d); X(a,d,b,d,e);
-                                                X(a,b,e,d,d); X(a,b,d,e,d); 
-                                            }
-                                        }
-                                    }
-                                } else {
-                                    for (auto e = d; e < 8ul; ++e) {
-                                        SKIP5s(e);
-                                        if (auto es = ds + e; isDivisibleByThree(es)) {
-                                            auto ep = computePartialProduct(dp, e);
-                                            DECLARE_POSITION_VALUES(e);
-
-                                            X(a,e,c,d,b); X(a,e,d,b,c); X(a,e,d,c,b); 
-                                            X(a,e,b,c,d); X(a,e,b,d,c); X(a,e,c,b,d); 
-                                            X(a,c,b,e,d); X(a,c,d,e,b); X(a,b,d,e,c);
-                                            X(a,b,c,d,e); X(a,b,d,c,e); X(a,c,d,b,e); 
-
-                                            X(b,e,c,d,a); X(b,e,d,a,c); X(b,e,d,c,a); 
-                                            X(b,e,a,c,d); X(b,e,a,d,c); X(b,e,c,a,d); 
-                                            X(b,c,d,e,a); X(b,a,c,e,d); X(b,a,d,e,c); 
-                                            X(b,c,d,a,e); X(b,c,a,d,e); X(b,a,d,c,e); 
-
-                                            X(c,e,b,d,a); X(c,e,d,a,b); X(c,e,d,b,a); 
-                                            X(c,e,a,b,d); X(c,e,a,d,b); X(c,e,b,a,d); 
-                                            X(c,a,d,e,b); X(c,b,d,e,a); X(c,b,d,a,e); 
-                                            X(c,b,a,d,e); X(c,a,d,b,e); X(c,a,b,d,e); 
-
-                                            X(e,a,b,d,c); X(e,a,c,b,d); X(e,a,c,d,b);
-                                            X(e,d,c,b,a); X(e,d,c,a,b); X(e,d,b,c,a);
-                                            X(e,d,a,b,c); X(e,d,a,c,b); X(e,d,b,a,c); 
-                                            X(e,c,b,d,a); X(e,c,d,a,b); X(e,c,d,b,a); 
-                                            X(e,c,a,b,d); X(e,c,a,d,b); X(e,c,b,a,d);
-                                            X(e,a,b,c,d); X(e,a,d,b,c); X(e,a,d,c,b); 
-                                            X(e,b,a,c,d); X(e,b,a,d,c); X(e,b,c,a,d); 
-                                            X(e,b,c,d,a); X(e,b,d,a,c); X(e,b,d,c,a); 
-
-                                            if (d != e) {
-                                                X(a,b,e,c,d); X(a,b,e,d,c); X(a,c,b,d,e);
-                                                X(a,c,e,b,d); X(a,c,e,d,b); X(a,d,b,c,e);
-                                                X(a,d,b,e,c); X(a,d,c,b,e); X(a,d,c,e,b);
-                                                X(a,d,e,b,c); X(a,d,e,c,b); X(a,b,c,e,d); 
-
-                                                X(b,a,c,d,e); X(b,a,e,c,d); X(b,a,e,d,c); 
-                                                X(b,c,a,e,d); X(b,c,e,a,d); X(b,c,e,d,a); 
-                                                X(b,d,a,c,e); X(b,d,a,e,c); X(b,d,c,a,e); 
-                                                X(b,d,c,e,a); X(b,d,e,a,c); X(b,d,e,c,a); 
-
-                                                X(c,a,b,e,d); X(c,a,e,b,d); X(c,a,e,d,b); 
-                                                X(c,b,a,e,d); X(c,d,e,a,b); X(c,d,e,b,a); 
-                                                X(c,b,e,a,d); X(c,b,e,d,a); X(c,d,a,b,e);
-                                                X(c,d,a,e,b); X(c,d,b,a,e); X(c,d,b,e,a);
-
-                                                X(d,a,b,e,c); X(d,a,c,b,e); X(d,a,c,e,b);
-                                                X(d,a,e,b,c); X(d,a,e,c,b); X(d,b,a,c,e);
-                                                X(d,b,a,e,c); X(d,b,c,a,e); X(d,b,c,e,a);
-                                                X(d,b,e,a,c); X(d,b,e,c,a); X(d,c,a,b,e);
-                                                X(d,c,a,e,b); X(d,c,b,a,e); X(d,c,b,e,a);
-                                                X(d,c,e,a,b); X(d,c,e,b,a); X(d,e,a,b,c);
-                                                X(d,e,a,c,b); X(d,e,b,a,c); X(d,e,b,c,a);
-                                                X(d,e,c,a,b); X(d,e,c,b,a); X(d,a,b,c,e);
-                                            }
-                                        }
-                                    }
-                                }
+                }
+                const auto& tail = selectPermutationTail<length, lenPosDifference>();
+                auto converted = value;
+                auto walkGroup = [&tail, &fn, converted, sum, product, sums](auto group) noexcept {
+                    countProgressTested(tail.starts[tail.groupEnd(group)] - tail.starts[tail.groupStart(group)]);
+                    for (auto m = tail.groupStart(group); m < tail.groupEnd(group); ++m) {
+                        if (((sums >> tail.sums[m]) & 1) == 0) {
+                            if (collectStatistics) {
+                                threadStatistics().prune(Rule::SumOracle, tail.starts[m + 1] - tail.starts[m]);
                             }
+                            continue;
+                        }
+                        auto es = sum + tail.sums[m];
+                        auto ep = product * tail.products[m];
+                        if (onlyWithFives() && (ep % 5) != 0) {
+                            continue;
+                        }
+                        for (auto p = tail.starts[m]; p < tail.starts[m + 1]; ++p) {
+                            fn(converted + (tail.offsets[p] * scale), ep, es);
                         }
                     }
+                };
+                if (collectStatistics && skipFives()) {
+                    threadStatistics().prune(Rule::SkipFive, integerPow(8, lenPosDifference) - integerPow(7, lenPosDifference));
                 }
+                if (activeRules.complemented(Rule::SumModThree)) {
+                    // only walk the multisets the rule would have skipped
+                    auto group = (3 - (sum % 3)) % 3;
+                    walkGroup((group + 1) % 3);
+                    walkGroup((group + 2) % 3);
+                } else if (activeRules.enabled(Rule::SumModThree)) {
+                    // only walk the multisets which make the final sum divisible by three
+                    auto group = (3 - (sum % 3)) % 3;
+                    walkGroup(group);
+                    if (collectStatistics || countersEnabled()) {
+                        auto walked = tail.starts[tail.groupEnd(group)] - tail.starts[tail.groupStart(group)];
+                        countRejectedModThree(tail.offsets.size() - walked);
+                        if (collectStatistics) {
+                            threadStatistics().prune(Rule::SumModThree, tail.offsets.size() - walked);
+                        }
+                    }
+                } else {
+                    walkGroup(0);
+                    walkGroup(1);
+                    walkGroup(2);
+                }
+                return;
             }
         }
-#undef DECLARE_POSITION_VALUES
-#undef X
-    } else {
+        if constexpr ((oracleDepth > 0) && (lenPosDifference == oracleDepth) && (position > 0)) {
+            // no need to walk the remaining digits if none of them can
+            // produce a sum which divides the final number
+            // the positions above us are all still twos
+            static constexpr auto upperTwos = allTwos<lenPosDifference> * valueIncr;
+            // when verifying the oracle only the subtrees it rejects are walked
+            if (activeRules.enabled(Rule::SumOracle) &&
+                    (getOracle<length>(oracleDepth).reachable(sum, value - upperTwos) == activeRules.complemented(Rule::SumOracle))) {
+                countPruned(Rule::SumOracle, lenPosDifference);
+                return;
+            }
+        }
+        if constexpr (lenPosDifference == 2) {
+            countProgressTested(skipFives() ? 49 : 64);
+        } else if constexpr (length == 1) {
+            countProgressTested(skipFives() ? 7 : 8);
+        }
         auto dprod = product << 1;
-        body<nextPosition, length>(list, sum, dprod, index + (0 * indexIncr)); // 0
+        body<nextPosition, length>(list, sum, dprod, value); // 0
         ++sum;
         dprod += product;
-        body<nextPosition, length>(list, sum, dprod, index + (1 * indexIncr)); // 1
+        value += valueIncr;
+        body<nextPosition, length>(list, sum, dprod, value); // 1
         ++sum;
         dprod += product;
-        body<nextPosition, length>(list, sum, dprod, index + (2 * indexIncr)); // 2
-        sum += 2;
-        dprod += (2 * product);
-        body<nextPosition, length>(list, sum, dprod, index + (4 * indexIncr)); // 4
+        value += valueIncr;
+        body<nextPosition, length>(list, sum, dprod, value); // 2
         ++sum;
         dprod += product;
-        body<nextPosition, length>(list, sum, dprod, index + (5 * indexIncr)); // 5
+        value += valueIncr;
+        if (skipFives()) {
+            countPruned(Rule::SkipFive, lenPosDifference - 1);
+        } else {
+            body<nextPosition, length>(list, sum, dprod, value); // 3
+        }
         ++sum;
         dprod += product;
-        body<nextPosition, length>(list, sum, dprod, index + (6 * indexIncr)); // 6
+        value += valueIncr;
+        body<nextPosition, length>(list, sum, dprod, value); // 4
         ++sum;
         dprod += product;
-        body<nextPosition, length>(list, sum, dprod, index + (7 * indexIncr)); // 7
-#if 0
-        body<nextPosition, length>(list, sum + 0, dprod + (0 * product), index + (0 * indexIncr));
-        body<nextPosition, length>(list, sum + 1, dprod + (1 * product), index + (1 * indexIncr));
-        body<nextPosition, length>(list, sum + 2, dprod + (2 * product), index + (2 * indexIncr));
-        body<nextPosition, length>(list, sum + 4, dprod + (4 * product), index + (4 * indexIncr));
-        body<nextPosition, length>(list, sum + 5, dprod + (5 * product), index + (5 * indexIncr));
-        body<nextPosition, length>(list, sum + 6, dprod + (6 * product), index + (6 * indexIncr));
-        body<nextPosition, length>(list, sum + 7, dprod + (7 * product), index + (7 * indexIncr));
-#endif
-    }
-}
-#undef SKIP5s
+        value += valueIncr;
+        body<nextPosition, length>(list, sum, dprod, value); // 5
+        ++sum;
+        dprod += product;
+        value += valueIncr;
+        body<nextPosition, length>(list, sum, dprod, value); // 6
+        ++sum;
+        dprod += product;
+        value += valueIncr;
+        body<nextPosition, length>(list, sum, dprod, value); // 7
+    }
+}
 template<u64 position, u64 length>
 void body(MatchList& list, const DataTriple& contents) noexcept {
-    auto [sum, prod, ind] = contents;
-    body<position, length>(list, sum, prod, ind);
+    auto [sum, prod, value] = contents;
+    body<position, length>(list, sum, prod, value);
+}
+
+/*
+ * Is the given ones digit walked below the given tens digit, once the numbers
+ * are wide enough to be split up by their tens digit.
+ */
+inline bool walksOnes(u64 tens, u64 ones) noexcept {
+    if (ones == 5ul && skipFives()) {
+        return false;
+    }
+    // using the frequency analysis I did before for loops64.cc I found
+    // that on even digits that 4 and 8 are used while odd digits use 2
+    // and 6. This is a frequency analysis job only :D
+    auto paired = (tens % 2ul == 0) ? (ones == 4ul || ones == 8ul) : (ones == 2ul || ones == 6ul);
+    if (activeRules.complemented(Rule::ParityPair)) {
+        // walk exactly the ones digits the heuristic skips
+        return !paired;
+    } else if (activeRules.enabled(Rule::ParityPair)) {
+        return paired;
+    } else {
+        return true;
+    }
 }
 
 template<auto width>
 MatchList parallelBody(u64 base) noexcept {
+    PerfScope perf(PerfPhase::Walk);
+    TraceScope trace("parallelBody", width, 1, base);
     MatchList list;
     auto start = (base - 2ul);
-    auto index = start << 3;
     static constexpr auto addon = width << 1;
     auto startPlusAddon = start + addon;
-    // using the frequency analysis I did before for loops64.cc I found
-    // that on even digits that 4 and 8 are used while odd digits use 2
-    // and 6. This is a frequency analysis job only :D
-    for (auto i = ((base % 2ul == 0) ? 4ul : 2ul); i < 10ul; i += 4ul) {
+    auto value = allTwos<width> + (start * 10);
+    auto walkOnes = [&](auto i) noexcept {
         auto j = i - 2ul;
-        body<2, width>(list, startPlusAddon + j, base * i, index + j);
+        body<2, width>(list, startPlusAddon + j, base * i, value + j);
+    };
+    for (auto i = 2ul; i < 10ul; ++i) {
+        if (walksOnes(base, i)) {
+            walkOnes(i);
+        }
+    }
+    if (collectStatistics && activeRules.enabled(Rule::ParityPair) && !activeRules.complemented(Rule::ParityPair)) {
+        threadStatistics().prune(Rule::ParityPair, (skipFives() ? 5ul : 6ul) * leavesBelow(width - 2));
+    }
+    flushThreadStatistics();
+    trace.setResults(list.size());
+    return list;
+}
+
+/*
+ * Walked subtrees are looked up in and stored to this when -C is given. The
+ * statistics and counters describe the walk itself so it is skipped while
+ * they are collected.
+ */
+SubtreeCache subtreeCache;
+inline bool usesSubtreeCache() noexcept {
+    return subtreeCache.enabled() && !collectStatistics && !countersEnabled();
+}
+
+/*
+ * The state of every rule which has a say in what is found at the given
+ * width. Turning an exact rule off doesn't change the results so those only
+ * show up while being verified. Parity pairs are only applied when the two
+ * least significant digits are chosen by the engine itself.
+ */
+template<u64 width>
+std::string ruleKey(bool pairsOnes) {
+    std::string key;
+    for (const auto& r : rules) {
+        if (!ruleApplies<width>(r.rule) || (r.rule == Rule::ParityPair && !pairsOnes)) {
+            continue;
+        }
+        if (activeRules.complemented(r.rule)) {
+            key += std::string(r.name) + ":verify,";
+        } else if (!r.exact) {
+            key += std::string(r.name) + (activeRules.enabled(r.rule) ? ":on," : ":off,");
+        }
+    }
+    return key;
+}
+
+/*
+ * The number of progress prefixes the walk above the given number of fixed
+ * lower digits would have completed.
+ */
+inline u64 prefixesAbove(u64 length) noexcept {
+    if (length > progressDepth) {
+        return 0;
+    }
+    return integerPow(skipFives() ? 7ul : 8ul, progressDepth - length);
+}
+
+/*
+ * A subtree loaded from the cache still counts towards the progress and the
+ * match limit, as if it had just been walked.
+ */
+inline void creditCachedSubtree(u64 prefixes, const MatchList& list) noexcept {
+    countProgressMatches(list.size());
+    completeProgressPrefixes(prefixes);
+    countMatches(list.size());
+}
+
+/*
+ * parallelBody going through the subtree cache. A walk which was stopped
+ * early by -k is incomplete so it is never stored.
+ */
+template<auto width>
+MatchList cachedParallelBody(u64 base) noexcept {
+    if (!usesSubtreeCache()) {
+        return parallelBody<width>(base);
+    }
+    auto key = subtreeCache.key(width, "tens=" + std::to_string(base), ruleKey<width>(true));
+    MatchList list;
+    if (walkStopped()) {
+        // the match limit was reached already, the walk would bail out too
+        return list;
+    }
+    if (subtreeCache.load(key, list)) {
+        auto pairs = 0ul;
+        for (auto ones = 2ul; ones < 10ul; ++ones) {
+            if (walksOnes(base, ones)) {
+                ++pairs;
+            }
+        }
+        creditCachedSubtree(pairs * prefixesAbove(2), list);
+        return list;
+    }
+    list = parallelBody<width>(base);
+    if (!walkStopped()) {
+        subtreeCache.store(key, list);
     }
     return list;
 }
 
+/*
+ * Build the tables used by the given width before any threads are spun up.
+ */
+template<u64 width>
+void prepareTables() noexcept {
+    if constexpr ((oracleDepth > 0) && (width > oracleDepth)) {
+        if (hasPermutationTail<width>(tailLengths[width])) {
+            getOracle<width>(tailLengths[width]);
+        } else {
+            getOracle<width>(oracleDepth);
+        }
+    }
+    preparePermutationTail<width>(tailLengths[width]);
+}
+
+/*
+ * The number of prefixes of the given number of digits the engine walks
+ * under the active rules.
+ */
+template<u64 width>
+u64 prefixCount(u64 depth) noexcept {
+    auto digitCount = skipFives() ? 7ul : 8ul;
+    auto count = 1ul;
+    auto k = 0ul;
+    if (width >= 10 && depth >= 2) {
+        count = 0;
+        for (auto tens = 2ul; tens < 10ul; ++tens) {
+            for (auto ones = 2ul; ones < 10ul; ++ones) {
+                if ((tens != 5ul || !skipFives()) && walksOnes(tens, ones)) {
+                    ++count;
+                }
+            }
+        }
+        k = 2;
+    }
+    for (; k < depth; ++k) {
+        count *= digitCount;
+    }
+    return count;
+}
+
+/*
+ * Count progress at a position which is always visited: below both the
+ * oracle and the permutation tail.
+ */
+template<u64 width>
+void prepareProgress() noexcept {
+    auto lowest = (width > oracleDepth) ? (width - oracleDepth) : 0ul;
+    if (hasPermutationTail<width>(tailLengths[width])) {
+        lowest = std::min(lowest, width - tailLengths[width]);
+    }
+    progressDepth = std::min(maxProgressDepth - 1, lowest);
+    beginProgress(width, prefixCount<width>(progressDepth));
+}
+
 template<u64 width>
 void initialBody() noexcept {
     MatchList list;
+    auto verified = std::find_if(rules.begin(), rules.end(), [](const auto& r) { return activeRules.complemented(r.rule); });
+    if (verified != rules.end() && !ruleApplies<width>(verified->rule)) {
+        std::cerr << "width " << width << ": " << verified->name << " does not prune anything, nothing to verify" << std::endl;
+        return;
+    }
+    auto begin = std::chrono::steady_clock::now();
+    {
+        PerfScope perf(PerfPhase::Tables);
+        TraceScope trace("tables", width, 0, 0);
+        prepareTables<width>();
+        prepareProgress<width>();
+    }
+    resetMatchLimit();
+    auto cacheHits = subtreeCache.hits();
+    auto cacheMisses = subtreeCache.misses();
+    auto found = 0ul;
     if constexpr (width < 10) {
+        PerfScope perf(PerfPhase::Walk);
+        TraceScope trace("body", width, 0, 0);
         body<0, width>(list, width * 2);
+        flushThreadStatistics();
+        trace.setResults(list.size());
     } else {
         auto mkfuture = [](auto base) {
-            return std::async(std::launch::async, parallelBody<width>, base);
+            return std::async(std::launch::async, cachedParallelBody<width>, base);
         };
         auto t0 = mkfuture(2),
              t1 = mkfuture(3),
@@ -581,12 +1066,20 @@ void initialBody() noexcept {
              t4 = mkfuture(7),
              t5 = mkfuture(8),
              t6 = mkfuture(9);
+        if (skipFives()) {
+            countPruned(Rule::SkipFive, width - 1);
+        } else {
+            auto r = mkfuture(5).get();
+            if constexpr (width == 19) {
+                printMatches(r, found);
+            } else {
+                list.splice(list.cbegin(), r);
+            }
+        }
         if constexpr (width == 19) {
-            auto printSplice = [](auto& thing) {
+            auto printSplice = [&found](auto& thing) {
                 auto r = thing.get();
-                for (const auto& v : r) {
-                    std::cout << v << std::endl;
-                }
+                printMatches(r, found);
             };
             printSplice(t0); printSplice(t1);
             printSplice(t2); printSplice(t3);
@@ -604,20 +1097,972 @@ void initialBody() noexcept {
         }
     } 
     if constexpr (width != 19) {
+        PerfScope perf(PerfPhase::Output);
+        TraceScope trace("output", width, 0, 0);
+        trace.setResults(list.size());
         list.sort();
-        for (const auto& v : list) {
-            std::cout << v << std::endl;
+        printMatches(list, found);
+    }
+    endProgress();
+    flushThreadStatistics();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    if (collectStatistics) {
+        reportStatistics(std::cerr, width, activeRules, elapsed.count());
+    }
+    reportCounters(std::cerr, width, elapsed.count());
+    reportPerf(std::cerr, width, elapsed.count());
+    if (usesSubtreeCache() && width >= 10) {
+        std::cerr << "width " << width << ": " << (subtreeCache.hits() - cacheHits) << " subtrees loaded from the cache, "
+                  << (subtreeCache.misses() - cacheMisses) << " walked" << std::endl;
+    }
+    if (verified != rules.end()) {
+        std::cerr << "width " << width << ": " << found << " quodigious numbers skipped by " << verified->name
+                  << ((found == 0) ? ", complete" : ", INCOMPLETE") << std::endl;
+    }
+}
+
+/*
+ * The suffixes to walk in approximate mode, empty unless a whitelist was
+ * loaded.
+ */
+SuffixWhitelist whitelist;
+
+/*
+ * The position to start at is only known at runtime so find the matching
+ * instantiation of body here.
+ */
+template<u64 width, u64 position = 0>
+void bodyAt(MatchList& list, u64 start, u64 sum, u64 product, u64 value) noexcept {
+    if constexpr (position < width) {
+        if (position == start) {
+            body<position, width>(list, sum, product, value);
+        } else {
+            bodyAt<width, position + 1>(list, start, sum, product, value);
+        }
+    }
+}
+
+/*
+ * Pick up the walk right above the given lower digits, lower holds them in
+ * decimal. Lower digits with a zero or a one in them are ignored.
+ */
+template<u64 width>
+void walkAbove(MatchList& list, u64 lower, u64 length) noexcept {
+    auto sum = 2 * width;
+    auto product = 1ul;
+    auto value = allTwos<width>;
+    for (auto k = 0ul; k < length; ++k, lower /= 10) {
+        auto digit = lower % 10;
+        if (digit < 2) {
+            return;
+        }
+        sum += (digit - 2);
+        product *= digit;
+        value += ((digit - 2) * factors10[k]);
+    }
+    bodyAt<width>(list, length, sum, product, value);
+}
+
+/*
+ * Walk every number ending in the given lower digits on the calling thread,
+ * false if they can't end a number of this width.
+ */
+template<u64 width>
+bool collectSubtree(MatchList& list, u64 digits) noexcept {
+    SubtreeState state;
+    if (!lowerDigitsState(digits, state) || state.length > width) {
+        return false;
+    }
+    if (state.length == width) {
+        // every digit was given, there is just the one number to check
+        if (isQuodigious(state.value, state.sum, state.product)) {
+            list.emplace_back(state.value);
+            countMatch();
+        }
+        return true;
+    }
+    std::string key;
+    if (usesSubtreeCache()) {
+        key = subtreeCache.key(width, "lower=" + std::to_string(digits), ruleKey<width>(false));
+        if (subtreeCache.load(key, list)) {
+            creditCachedSubtree(prefixesAbove(state.length), list);
+            return true;
+        }
+    }
+    prepareTables<width>();
+    walkAbove<width>(list, digits, state.length);
+    flushThreadStatistics();
+    list.sort();
+    if (!key.empty() && !walkStopped()) {
+        subtreeCache.store(key, list);
+    }
+    return true;
+}
+
+template<u64 width>
+bool subtreeBody(u64 digits) noexcept {
+    resetMatchLimit();
+    MatchList list;
+    if (!collectSubtree<width>(list, digits)) {
+        return false;
+    }
+    auto printed = 0ul;
+    printMatches(list, printed);
+    return true;
+}
+
+/*
+ * Walk a whole width and hand back what was found instead of printing it.
+ */
+template<u64 width>
+MatchList collectWidth() noexcept {
+    resetMatchLimit();
+    prepareTables<width>();
+    MatchList list;
+    if constexpr (width < 10) {
+        body<0, width>(list, width * 2);
+    } else {
+        std::vector<std::future<MatchList>> tasks;
+        for (auto tens = 2ul; tens < 10ul; ++tens) {
+            if (tens != 5ul || !skipFives()) {
+                tasks.emplace_back(std::async(std::launch::async, cachedParallelBody<width>, tens));
+            }
+        }
+        for (auto& task : tasks) {
+            auto r = task.get();
+            list.splice(list.cbegin(), r);
+        }
+    }
+    flushThreadStatistics();
+    list.sort();
+    return list;
+}
+
+/*
+ * Walk every given suffix whose position modulo stride is offset.
+ */
+template<u64 width>
+MatchList suffixBody(const std::vector<u64>& suffixes, u64 offset, u64 stride) noexcept {
+    TraceScope trace("suffixBody", width, whitelist.getLength(), offset);
+    MatchList list;
+    auto length = whitelist.getLength();
+    for (auto i = offset; i < suffixes.size() && !walkStopped(); i += stride) {
+        walkAbove<width>(list, suffixes[i], length);
+    }
+    flushThreadStatistics();
+    trace.setResults(list.size());
+    return list;
+}
+
+/*
+ * Only walk the numbers ending in a whitelisted suffix. This is only as good
+ * as the result set the whitelist was mined from so the assumption it makes is
+ * spelled out on stderr.
+ */
+template<u64 width>
+void approximateBody() noexcept {
+    auto length = whitelist.getLength();
+    if (length >= width) {
+        std::cerr << "width " << width << ": suffixes are " << length << " digits long, nothing to walk" << std::endl;
+        return;
+    }
+    // the whitelist may have been mined from numbers with fives in them, the
+    // walk above each suffix would never select one so neither do we
+    std::vector<u64> suffixes;
+    for (auto suffix : whitelist.getSuffixes()) {
+        auto hasFive = false;
+        for (auto rest = suffix; rest > 0; rest /= 10) {
+            hasFive = hasFive || ((rest % 10) == 5);
+        }
+        if (!hasFive || !skipFives()) {
+            suffixes.emplace_back(suffix);
+        }
+    }
+    std::cerr << "width " << width << ": approximate, assuming every quodigious number ends in one of "
+              << suffixes.size() << " of the " << integerPow(skipFives() ? 7 : 8, length) << " possible "
+              << length << " digit suffixes, mined from " << whitelist.getMined() << " numbers of width "
+              << whitelist.getMinWidth() << "-" << whitelist.getMaxWidth() << std::endl;
+    prepareTables<width>();
+    // every suffix is a prefix as far as progress is concerned
+    progressDepth = length;
+    beginProgress(width, suffixes.size());
+    resetMatchLimit();
+    MatchList list;
+    auto begin = std::chrono::steady_clock::now();
+    if constexpr (width < 10) {
+        list = suffixBody<width>(suffixes, 0, 1);
+    } else {
+        static constexpr auto stride = 7ul;
+        std::vector<std::future<MatchList>> tasks;
+        for (auto offset = 0ul; offset < stride; ++offset) {
+            tasks.emplace_back(std::async(std::launch::async, suffixBody<width>, std::cref(suffixes), offset, stride));
+        }
+        for (auto& task : tasks) {
+            auto r = task.get();
+            list.splice(list.cbegin(), r);
+        }
+    }
+    endProgress();
+    list.sort();
+    auto printed = 0ul;
+    printMatches(list, printed);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    reportCounters(std::cerr, width, elapsed.count());
+}
+
+/*
+ * The number of digits left to walk underneath each sampled prefix.
+ */
+constexpr auto sampleSubtreeDigits = 7ul;
+
+/*
+ * Estimate how many numbers a width has and how much cpu time it takes to
+ * find them without walking all of it. Random prefixes (the least significant
+ * digits, which are picked first) are drawn from exactly the set the engine
+ * would walk under the active rules, the subtree above each one is walked
+ * with the normal recursion and the mean is scaled up by the number of
+ * prefixes. The intervals are the usual 95% normal approximation.
+ *
+ * A line of the form
+ * <width> <depth> <prefixes> <samples> <count> <low> <high> <cpu seconds> <low> <high>
+ * is written to stdout for anything which needs a cost per width.
+ */
+template<u64 width>
+void estimateBody(u64 samples, u64 seed) noexcept {
+    resetMatchLimit();
+    prepareTables<width>();
+    auto depth = (width > sampleSubtreeDigits) ? (width - sampleSubtreeDigits) : 0ul;
+    std::vector<u64> digits;
+    for (auto d = 2ul; d < 10ul; ++d) {
+        if (d != 5ul || !skipFives()) {
+            digits.emplace_back(d);
+        }
+    }
+    // the two lowest digits are picked together once the tens digit
+    // decides which ones digits are walked
+    std::vector<u64> lowest;
+    auto split = (width >= 10) && (depth >= 2);
+    if (split) {
+        for (auto tens : digits) {
+            for (auto ones = 2ul; ones < 10ul; ++ones) {
+                if (walksOnes(tens, ones)) {
+                    lowest.emplace_back((tens * 10) + ones);
+                }
+            }
+        }
+    }
+    double prefixes = prefixCount<width>(depth);
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<u64> pickDigit(0, digits.size() - 1);
+    std::uniform_int_distribution<u64> pickLowest(0, split ? lowest.size() - 1 : 0);
+    auto countSum = 0.0, countSquares = 0.0, timeSum = 0.0, timeSquares = 0.0;
+    for (auto i = 0ul; i < samples; ++i) {
+        auto lower = split ? lowest[pickLowest(generator)] : 0ul;
+        for (auto k = (split ? 2ul : 0ul); k < depth; ++k) {
+            lower += digits[pickDigit(generator)] * factors10[k];
+        }
+        MatchList list;
+        auto begin = std::clock();
+        walkAbove<width>(list, lower, depth);
+        double elapsed = double(std::clock() - begin) / CLOCKS_PER_SEC;
+        double count = list.size();
+        countSum += count;
+        countSquares += count * count;
+        timeSum += elapsed;
+        timeSquares += elapsed * elapsed;
+    }
+    flushThreadStatistics();
+    auto interval = [samples, prefixes](auto sum, auto squares) noexcept {
+        auto mean = sum / samples;
+        auto variance = (samples > 1) ? std::max(0.0, (squares - (sum * mean)) / (samples - 1)) : 0.0;
+        auto half = 1.96 * std::sqrt(variance / samples);
+        return std::make_tuple(prefixes * mean, prefixes * std::max(0.0, mean - half), prefixes * (mean + half));
+    };
+    auto [count, countLow, countHigh] = interval(countSum, countSquares);
+    auto [cpu, cpuLow, cpuHigh] = interval(timeSum, timeSquares);
+    std::cerr << "width " << width << ": " << samples << " of " << prefixes << " prefixes " << depth
+              << " digits long sampled (seed " << seed << "), ~" << count << " numbers [" << countLow << ", "
+              << countHigh << "], ~" << cpu << " cpu seconds [" << cpuLow << ", " << cpuHigh << "]" << std::endl;
+    std::cout << width << " " << depth << " " << prefixes << " " << samples << " "
+              << count << " " << countLow << " " << countHigh << " "
+              << cpu << " " << cpuLow << " " << cpuHigh << std::endl;
+}
+
+/*
+ * Time a subtree deep enough that every tail length applies to it with each
+ * tail length and keep the fastest one for the given width.
+ */
+constexpr auto tuningRepetitions = 5;
+template<u64 width>
+u64 tuneWidth() noexcept {
+    static_assert(hasPermutationTail<width>(maxTailLength), "Tuning only makes sense when the permutation tail is used!");
+    static constexpr auto position = width - maxTailLength;
+    auto best = defaultTailLength;
+    auto bestTime = std::chrono::steady_clock::duration::max();
+    for (auto tail = minTailLength; tail <= maxTailLength; ++tail) {
+        tailLengths[width] = tail;
+        prepareTables<width>();
+        auto fastest = std::chrono::steady_clock::duration::max();
+        for (auto i = 0; i < tuningRepetitions; ++i) {
+            MatchList list;
+            auto start = std::chrono::steady_clock::now();
+            // all twos in the positions below us
+            body<position, width>(list, width * 2, 1ul << position, allTwos<width>);
+            fastest = std::min(fastest, std::chrono::steady_clock::now() - start);
+        }
+        std::cerr << "width " << width << " tail " << tail << ": "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(fastest).count()
+                  << " us" << std::endl;
+        if (fastest < bestTime) {
+            bestTime = fastest;
+            best = tail;
+        }
+    }
+    tailLengths[width] = best;
+    return best;
+}
+
+/*
+ * Microbenchmarks of the leaf kernels for the benchmark suite. Each one is
+ * run tuningRepetitions times and the fastest run is written to stdout as a
+ * line of JSON in nanoseconds per operation.
+ */
+constexpr auto benchmarkOperations = 1ul << 20;
+constexpr auto benchmarkWidth = 12ul;
+volatile u64 benchmarkSink = 0;
+
+template<typename Operation>
+void microBenchmark(const std::string& name, u64 operations, Operation operation) noexcept {
+    auto fastest = std::chrono::steady_clock::duration::max();
+    for (auto i = 0; i < tuningRepetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        benchmarkSink += operation();
+        fastest = std::min(fastest, std::chrono::steady_clock::now() - start);
+    }
+    std::chrono::duration<double, std::nano> elapsed = fastest;
+    std::cout << "{\"name\": \"micro/" << name << "\", \"value\": " << (elapsed.count() / operations)
+              << ", \"unit\": \"ns\"}" << std::endl;
+}
+
+void runMicroBenchmarks() noexcept {
+    // random numbers of the benchmark width made up of legal digits
+    std::mt19937_64 generator(benchmarkWidth);
+    std::uniform_int_distribution<u64> pickCode(0, 6);
+    std::vector<u64> values, sums, products, indices, codes;
+    for (auto i = 0ul; i < benchmarkOperations; ++i) {
+        auto value = 0ul, sum = 0ul, product = 1ul, index = 0ul;
+        for (auto k = 0ul; k < benchmarkWidth; ++k) {
+            auto code = pickCode(generator);
+            code += (code >= 3) ? 1 : 0;
+            value += (code + 2) * factors10[k];
+            sum += code + 2;
+            product *= code + 2;
+            index |= code << (3 * k);
         }
+        values.emplace_back(value);
+        sums.emplace_back(sum);
+        products.emplace_back(product);
+        indices.emplace_back(index);
+        codes.emplace_back(index & 0b111);
     }
+    microBenchmark("isQuodigious", benchmarkOperations, [&]() noexcept {
+        auto found = 0ul;
+        for (auto i = 0ul; i < benchmarkOperations; ++i) {
+            found += isQuodigious(values[i], sums[i], products[i]) ? 1 : 0;
+        }
+        return found;
+    });
+    microBenchmark("convertNumber", benchmarkOperations, [&]() noexcept {
+        auto total = 0ul;
+        for (auto i = 0ul; i < benchmarkOperations; ++i) {
+            total += convertNumber<benchmarkWidth>(indices[i]);
+        }
+        return total;
+    });
+    microBenchmark("computePartialProduct", benchmarkOperations, [&]() noexcept {
+        auto total = 0ul;
+        for (auto i = 0ul; i < benchmarkOperations; ++i) {
+            total += computePartialProduct(products[i], codes[i]);
+        }
+        return total;
+    });
+    // walk the whole default tail as if it sat on top of a number of the
+    // benchmark width, this is the innermost loop of the engine
+    const auto& tail = getPermutationTail<defaultTailLength, false>();
+    static constexpr auto scale = fastPow10<benchmarkWidth - defaultTailLength>;
+    auto passes = (benchmarkOperations / tail.offsets.size()) + 1;
+    microBenchmark("permutationTail", passes * tail.offsets.size(), [&]() noexcept {
+        auto found = 0ul;
+        for (auto pass = 0ul; pass < passes; ++pass) {
+            auto sum = (2 * benchmarkWidth) + pass;
+            auto product = 1ul << (benchmarkWidth - defaultTailLength);
+            for (auto m = 0ul; m + 1 < tail.starts.size(); ++m) {
+                auto es = sum + tail.sums[m];
+                auto ep = product * tail.products[m];
+                for (auto p = tail.starts[m]; p < tail.starts[m + 1]; ++p) {
+                    found += isQuodigious(allTwos<benchmarkWidth> + (tail.offsets[p] * scale), es, ep) ? 1 : 0;
+                }
+            }
+        }
+        return found;
+    });
 }
 
-int main() {
+std::string cpuModel() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            if (auto start = line.find_first_not_of(" \t", line.find(':') + 1); start != std::string::npos) {
+                return line.substr(start);
+            }
+        }
+    }
+    return "unknown";
+}
+
+/*
+ * The tuning file has one line per cpu model and width of the form:
+ * <width> <tail length> <cpu model>
+ */
+using TuningTable = std::map<std::tuple<std::string, u64>, u64>;
+TuningTable loadTuning(const std::string& path) {
+    TuningTable table;
+    std::ifstream input(path);
+    u64 width = 0;
+    u64 tail = 0;
+    std::string model;
+    while (input >> width >> tail >> std::ws && std::getline(input, model)) {
+        table[std::make_tuple(model, width)] = tail;
+    }
+    return table;
+}
+
+void saveTuning(const std::string& path, const TuningTable& table) {
+    std::ofstream output(path);
+    for (const auto& [key, tail] : table) {
+        auto [model, width] = key;
+        output << width << " " << tail << " " << model << std::endl;
+    }
+}
+
+/*
+ * Print the numbers in the given file (or stdin for -) which are
+ * quodigious, in the order they show up in.
+ */
+int membershipBody(const std::string& path) noexcept {
+    std::string output;
+    auto sink = [&output](u64 value) noexcept {
+        output += std::to_string(value);
+        output += '\n';
+        if (output.size() > (1ul << 16)) {
+            std::cout << output;
+            output.clear();
+        }
+    };
+    auto begin = std::chrono::steady_clock::now();
+    MembershipTotals totals;
+    if (path == "-") {
+        // every chunk is checked as soon as it arrives, only a number which
+        // is cut off at the end of it is carried over into the next one
+        std::string pending;
+        std::array<char, 1 << 16> chunk;
+        auto isDigit = [](char c) noexcept { return c >= '0' && c <= '9'; };
+        for (ssize_t count = 0; (count = read(STDIN_FILENO, chunk.data(), chunk.size())) > 0; ) {
+            pending.append(chunk.data(), count);
+            auto complete = pending.size();
+            while (complete > 0 && isDigit(pending[complete - 1])) {
+                --complete;
+            }
+            totals += checkMembership(pending.data(), pending.data() + complete, sink);
+            pending.erase(0, complete);
+            std::cout << output << std::flush;
+            output.clear();
+        }
+        totals += checkMembership(pending.data(), pending.data() + pending.size(), sink);
+    } else {
+        MappedFile file(path);
+        if (!file.good()) {
+            std::cerr << "Unable to map " << path << std::endl;
+            return 1;
+        }
+        totals = checkMembership(file.begin(), file.end(), sink);
+    }
+    std::cout << output << std::flush;
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    std::cerr << "checked " << totals.checked << " numbers (" << totals.skipped << " with a 0 or 1 or too wide), "
+              << totals.matches << " quodigious, " << elapsed.count() << "s ("
+              << ((elapsed.count() > 0) ? (totals.checked / elapsed.count()) : 0.0) << " numbers/s)" << std::endl;
+    return 0;
+}
+
+/*
+ * Results of whole widths and of subtrees, kept for as long as the daemon
+ * runs. They are cached apart so no subtree can ever stand in for a width.
+ */
+ResultCache resultCache;
+ResultCache subtreeResults;
+
+ResultList computeWidth(u64 width) noexcept {
+    MatchList list;
+    switch (width) {
+#define X(ind) case ind : list = collectWidth< ind > (); break;
+        X(1);  X(2);  X(3);  X(4);  X(5);
+        X(6);  X(7);  X(8);  X(9);  X(10);
+        X(11); X(12); X(13); X(14); X(15);
+        X(16); X(17); X(18); X(19);
+#undef X
+        default: break;
+    }
+    return ResultList(list.begin(), list.end());
+}
+
+ResultList computeSubtree(u64 width, u64 digits) noexcept {
+    MatchList list;
+    switch (width) {
+#define X(ind) case ind : collectSubtree< ind > (list, digits); break;
+        X(1);  X(2);  X(3);  X(4);  X(5);
+        X(6);  X(7);  X(8);  X(9);  X(10);
+        X(11); X(12); X(13); X(14); X(15);
+        X(16); X(17); X(18); X(19);
+#undef X
+        default: break;
+    }
+    return ResultList(list.begin(), list.end());
+}
+
+/*
+ * Start the cache off with the widths already stored in outputs/. These
+ * hold every quodigious number, so the ones the active rules would never
+ * have found are dropped to keep the answers the same as a fresh walk. When
+ * a rule is being verified the walk finds something else entirely and
+ * nothing is loaded.
+ */
+u64 seedResultCache(const std::string& directory) noexcept {
+    if (std::any_of(rules.begin(), rules.end(), [](const auto& r) { return activeRules.complemented(r.rule); })) {
+        return 0;
+    }
+    auto seeded = 0ul;
+    for (auto width = 1ul; width <= maxQuodigiousWidth; ++width) {
+        std::ifstream input(directory + "/qnums" + std::to_string(width));
+        if (!input) {
+            continue;
+        }
+        ResultList results;
+        for (u64 value = 0; input >> value; ) {
+            auto digits = std::to_string(value);
+            if (digits.size() == width && (!skipFives() || digits.find('5') == std::string::npos)) {
+                results.emplace_back(value);
+            }
+        }
+        std::sort(results.begin(), results.end());
+        results.erase(std::unique(results.begin(), results.end()), results.end());
+        resultCache.insert(width, 0, std::move(results));
+        ++seeded;
+    }
+    return seeded;
+}
+
+void appendResults(std::string& output, ResultList::const_iterator begin, ResultList::const_iterator end) {
+    for (auto it = begin; it != end; ++it) {
+        output += std::to_string(*it);
+        output += '\n';
+    }
+}
+
+/*
+ * Answer a single query, every answer ends with an empty line:
+ *   enumerate <width>               every number of the width
+ *   count <width>                   how many there are
+ *   subtree <width> <lower digits>  the numbers ending in the given digits
+ *   range <lo> <hi>                 every number in between, of any width
+ *   member <numbers>...             the given numbers which are quodigious
+ *   prefetch <width>                start walking the width in the background,
+ *                                   answers cached, running or started
+ * Malformed queries get a line starting with "error:" instead.
+ */
+std::string answerQuery(const std::string& query) {
+    std::istringstream input(query);
+    std::string command;
+    input >> command;
+    u64 first = 0;
+    u64 second = 0;
+    auto validWidth = [](u64 width) noexcept { return width > 0 && width <= maxQuodigiousWidth; };
+    auto validSubtree = [](u64 width, u64 digits) noexcept {
+        SubtreeState state;
+        return lowerDigitsState(digits, state) && state.length <= width;
+    };
+    auto byWidth = [](u64 width) { return [width]() { return computeWidth(width); }; };
+    std::string output;
+    if ((command == "enumerate" || command == "count") && (input >> first) && validWidth(first)) {
+        auto results = resultCache.get(first, 0, byWidth(first));
+        if (command == "count") {
+            output += std::to_string(results->size()) + '\n';
+        } else {
+            appendResults(output, results->cbegin(), results->cend());
+        }
+    } else if (command == "prefetch" && (input >> first) && validWidth(first)) {
+        if (resultCache.ready(first, 0)) {
+            output += "cached\n";
+        } else {
+            output += resultCache.prefetch(first, 0, byWidth(first)) ? "running\n" : "started\n";
+        }
+    } else if (command == "subtree" && (input >> first >> second) && validWidth(first) && validSubtree(first, second)) {
+        auto results = subtreeResults.get(first, second, [first, second]() { return computeSubtree(first, second); });
+        appendResults(output, results->cbegin(), results->cend());
+    } else if (command == "range" && (input >> first >> second)) {
+        for (auto width = 1ul; width <= maxQuodigiousWidth; ++width) {
+            if ((9 * repunit(width)) < first || (2 * repunit(width)) > second) {
+                continue;
+            }
+            if (auto results = resultCache.ready(width, 0); results) {
+                appendResults(output, std::lower_bound(results->cbegin(), results->cend(), first),
+                              std::upper_bound(results->cbegin(), results->cend(), second));
+            } else {
+                // only the part of the width in the range gets walked, the
+                // same way -r does it
+                ResultList walked;
+                auto sink = [&walked](u64 value) noexcept { walked.emplace_back(value); };
+                enumerateClipped(width, width, 0, 0, 1, first, second, sink);
+                std::sort(walked.begin(), walked.end());
+                appendResults(output, walked.cbegin(), walked.cend());
+            }
+        }
+    } else if (command == "member") {
+        std::string numbers;
+        std::getline(input, numbers);
+        checkMembership(numbers.data(), numbers.data() + numbers.size(), [&output](u64 value) noexcept {
+            output += std::to_string(value);
+            output += '\n';
+        });
+    } else {
+        output += "error: unknown or malformed query \"" + query + "\"\n";
+    }
+    output += '\n';
+    return output;
+}
+
+void serveClient(int fd) noexcept {
+    Connection client(fd);
+    for (std::string query; client.readLine(query); ) {
+        auto begin = std::chrono::steady_clock::now();
+        auto answer = answerQuery(query);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        std::ostringstream log;
+        log << "daemon: " << query << " answered in " << elapsed.count() << "s" << std::endl;
+        std::cerr << log.str();
+        if (!client.write(answer)) {
+            return;
+        }
+    }
+}
+
+/*
+ * Keep the tables and whatever has been walked so far around and answer
+ * queries on the given unix socket until killed, every client gets a thread
+ * of its own.
+ */
+int daemonBody(const std::string& path) noexcept {
+    UnixListener listener(path);
+    if (!listener.good()) {
+        std::cerr << "Unable to listen on " << path << ", it has to be a free path or a stale socket" << std::endl;
+        return 1;
+    }
+    auto seeded = seedResultCache("outputs");
+    std::cerr << "daemon: listening on " << path << ", " << seeded << " widths loaded from outputs/" << std::endl;
+    while (true) {
+        auto fd = listener.accept();
+        if (fd == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Unable to accept a connection on " << path << std::endl;
+            return 1;
+        }
+        std::thread(serveClient, fd).detach();
+    }
+}
+
+/*
+ * Print the smallest count quodigious numbers of the given width. The engine
+ * settles the least significant digits first so it can't produce them in
+ * order, the ascending library walk can and stops as soon as it has them.
+ */
+void firstBody(u64 width, u64 count) noexcept {
+    auto printed = 0ul;
+    enumerateAscending(width, [&printed, count](u64 value) noexcept {
+        std::cout << value << std::endl;
+        return ++printed < count;
+    });
+}
+
+void usage(const char* name) {
+    std::cerr << "usage: " << name << " [-t tailLength] [-f tuningFile] [-T] [-x rule]... [-V rule] [-S] [-w whitelist [-M length]] [-E samples [-s seed]] [-p seconds] [-P statusFile] [-B] [-H] [-R traceFile] [-k count | -K count] [-C cacheDir] [-u | -r | -m file | -D socket]" << std::endl
+              << "  -t  use the given tail length (" << minTailLength << "-" << maxTailLength
+              << ", 0 disables the tail) for every width" << std::endl
+              << "  -f  file to load and store tuned tail lengths (default: quodigious.tune)" << std::endl
+              << "  -T  tune the tail length of the widths read from stdin instead of computing them" << std::endl
+              << "  -x  disable the given pruning rule, can be repeated" << std::endl
+              << "  -V  only walk the part of the search space the given rule prunes and report" << std::endl
+              << "      any quodigious numbers found there" << std::endl
+              << "  -S  print how much each pruning rule cut out to stderr after each width" << std::endl
+              << "  -w  only walk numbers ending in one of the suffixes in the given whitelist" << std::endl
+              << "  -M  mine the suffixes of the given length (1-" << SuffixWhitelist::maxLength
+              << ") from the numbers read from stdin into the whitelist instead" << std::endl
+              << "  -E  estimate the count and cpu time of each width from the given number of samples" << std::endl
+              << "  -s  seed the estimator with the given value instead of a random one" << std::endl
+              << "  -p  report progress every given number of seconds, SIGUSR1 always reports it" << std::endl
+              << "  -P  write progress reports to the given status file instead of stderr" << std::endl
+              << "  -B  run the leaf kernel microbenchmarks and print them as JSON" << std::endl
+              << "  -H  print the hardware counters of each phase as JSON to stderr after each width" << std::endl
+              << "  -R  record when each task starts and ends and write it to the given file in the" << std::endl
+              << "      Chrome trace event format" << std::endl
+              << "  -k  stop a walk once any given number of quodigious numbers have been found, these" << std::endl
+              << "      are not necessarily the smallest ones; -k 1 answers whether there are any" << std::endl
+              << "  -K  only print the given number of smallest quodigious numbers of each width, the" << std::endl
+              << "      leading digits are walked in order so this stops early (default rules only)" << std::endl
+              << "  -C  look walked subtrees up in the given directory before walking them and store" << std::endl
+              << "      them there afterwards, entries are keyed by width, subtree, rules and binary" << std::endl
+              << "  -u  read \"width lowerDigits\" pairs from stdin and only walk the numbers of that" << std::endl
+              << "      width ending in those digits" << std::endl
+              << "  -r  read \"lo hi\" pairs from stdin and only walk the numbers in between, these are" << std::endl
+              << "      walked from the most significant digit down so the walk can be clipped" << std::endl
+              << "      (default rules only)" << std::endl
+              << "  -m  print the numbers in the given file (- for stdin) which are quodigious" << std::endl
+              << "  -D  stay up and answer enumerate, count, subtree, range, member and prefetch" << std::endl
+              << "      queries on the given unix socket, a line each (default rules only)" << std::endl
+              << "rules:" << std::endl;
+    for (const auto& r : rules) {
+        std::cerr << "  " << r.name << " (" << (r.exact ? "exact" : "heuristic") << "): " << r.description << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string tuningFile = "quodigious.tune";
+    auto forceTail = false;
+    auto tune = false;
+    std::string whitelistFile;
+    auto mineLength = 0ul;
+    auto estimateSamples = 0ul;
+    u64 seed = std::random_device()();
+    auto progressInterval = 0ul;
+    std::string statusFile;
+    std::string traceFile;
+    auto subtrees = false;
+    auto ranges = false;
+    std::string membershipFile;
+    std::string socketPath;
+    auto firstLimit = 0ul;
+    for (int opt = 0; (opt = getopt(argc, argv, "t:f:Tx:V:Sw:M:E:s:p:P:BHR:k:K:C:urm:D:")) != -1; ) {
+        switch (opt) {
+            case 't': {
+                auto tail = std::stoul(optarg);
+                if (tail != 0 && (tail < minTailLength || tail > maxTailLength)) {
+                    std::cerr << "Illegal tail length " << tail << std::endl;
+                    return 1;
+                }
+                tailLengths.fill(tail);
+                forceTail = true;
+                break;
+            }
+            case 'f':
+                tuningFile = optarg;
+                break;
+            case 'T':
+                tune = true;
+                break;
+            case 'x':
+                if (!activeRules.disable(optarg)) {
+                    std::cerr << "Unknown rule " << optarg << std::endl;
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'V':
+                if (!activeRules.complement(optarg)) {
+                    std::cerr << "Can't verify rule " << optarg << ", it is unknown or another rule is already being verified" << std::endl;
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'S':
+                collectStatistics = true;
+                break;
+            case 'w':
+                whitelistFile = optarg;
+                break;
+            case 'M':
+                mineLength = std::stoul(optarg);
+                break;
+            case 'E':
+                estimateSamples = std::stoul(optarg);
+                break;
+            case 's':
+                seed = std::stoul(optarg);
+                break;
+            case 'p':
+                progressInterval = std::stoul(optarg);
+                break;
+            case 'P':
+                statusFile = optarg;
+                break;
+            case 'B':
+                runMicroBenchmarks();
+                return 0;
+            case 'H':
+                perfEnabled = true;
+                break;
+            case 'R':
+                traceFile = optarg;
+                tracingEnabled = true;
+                break;
+            case 'k':
+                matchLimit = std::stoul(optarg);
+                break;
+            case 'K':
+                firstLimit = std::stoul(optarg);
+                break;
+            case 'C':
+                if (!subtreeCache.open(optarg)) {
+                    std::cerr << "Unable to use " << optarg << " as a cache directory" << std::endl;
+                    return 1;
+                }
+                break;
+            case 'u':
+                subtrees = true;
+                break;
+            case 'r':
+                ranges = true;
+                break;
+            case 'm':
+                membershipFile = optarg;
+                break;
+            case 'D':
+                socketPath = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (matchLimit > 0 && (!socketPath.empty() || estimateSamples > 0)) {
+        std::cerr << "-k can't be combined with -D or -E, they need complete walks" << std::endl;
+        return 1;
+    }
+    auto defaultRules = (activeRules.getMask() == RuleSet().getMask()) && !activeRules.verifying();
+    if (firstLimit > 0 && !defaultRules) {
+        std::cerr << "-K walks with the default rules only, it can't be combined with -x or -V" << std::endl;
+        return 1;
+    }
+    if ((ranges || !socketPath.empty()) && !defaultRules) {
+        // ranges are walked by the library, which only knows the default rules
+        std::cerr << "-r and -D walk ranges with the default rules only, they can't be combined with -x or -V" << std::endl;
+        return 1;
+    }
+    if (!membershipFile.empty()) {
+        return membershipBody(membershipFile);
+    }
+    if (mineLength != 0) {
+        if (whitelistFile.empty()) {
+            std::cerr << "Mining suffixes needs a whitelist file to write to" << std::endl;
+            usage(argv[0]);
+            return 1;
+        }
+        if (!whitelist.mine(std::cin, mineLength)) {
+            std::cerr << "Unable to mine " << mineLength << " digit suffixes from stdin" << std::endl;
+            return 1;
+        }
+        if (!whitelist.save(whitelistFile)) {
+            std::cerr << "Unable to write " << whitelistFile << std::endl;
+            return 1;
+        }
+        std::cerr << "Mined " << whitelist.getSuffixes().size() << " unique " << mineLength << " digit suffixes from "
+                  << whitelist.getMined() << " numbers into " << whitelistFile << std::endl;
+        return 0;
+    }
+    if (!whitelistFile.empty() && !whitelist.load(whitelistFile)) {
+        std::cerr << "Unable to load suffix whitelist " << whitelistFile << std::endl;
+        return 1;
+    }
+    ProgressReporter reporter(std::chrono::seconds(progressInterval), statusFile);
+    reporter.start();
+    auto model = cpuModel();
+    auto tuning = loadTuning(tuningFile);
+    if (!forceTail && !tune) {
+        for (const auto& [key, tail] : tuning) {
+            if (auto [m, width] = key; m == model && width < tailLengths.size()) {
+                tailLengths[width] = tail;
+            }
+        }
+    }
+    if (!socketPath.empty()) {
+        return daemonBody(socketPath);
+    }
     while(std::cin.good()) {
         u64 currentIndex = 0;
+        u64 digits = 0;
         std::cin >> currentIndex;
+        if (subtrees || ranges) {
+            std::cin >> digits;
+        }
         if (std::cin.good()) {
+            if (ranges) {
+                // the octal walk settles the least significant digits first
+                // so it can't be clipped by the bounds, use the library walk
+                MatchList list;
+                enumerateRange(currentIndex, digits, [&list](u64 value) noexcept {
+                    list.emplace_back(value);
+                    return (matchLimit == 0) || (list.size() < matchLimit);
+                });
+                list.sort();
+                auto printed = 0ul;
+                printMatches(list, printed);
+                std::cout << std::endl;
+                continue;
+            }
+            if (subtrees) {
+                auto walked = false;
+                switch(currentIndex) {
+#define X(ind) case ind : walked = subtreeBody< ind > (digits); break;
+                    X(1);  X(2);  X(3);  X(4);  X(5);
+                    X(6);  X(7);  X(8);  X(9);  X(10);
+                    X(11); X(12); X(13); X(14); X(15);
+                    X(16); X(17); X(18); X(19);
+#undef X
+                    default: break;
+                }
+                if (!walked) {
+                    std::cerr << "Illegal subtree " << currentIndex << " " << digits << std::endl;
+                    return 1;
+                }
+                std::cout << std::endl;
+                continue;
+            }
+            if (tune) {
+                switch(currentIndex) {
+#define X(ind) case ind : tuning[std::make_tuple(model, ind)] = tuneWidth< ind > (); break;
+                    X(11); X(12); X(13); X(14); X(15);
+                    X(16); X(17); X(18); X(19);
+#undef X
+                    default:
+                        std::cerr << "Width " << currentIndex << " does not use the permutation tail, skipping" << std::endl;
+                        continue;
+                }
+                std::cout << currentIndex << " " << tailLengths[currentIndex] << std::endl;
+                saveTuning(tuningFile, tuning);
+                continue;
+            }
+            if (firstLimit > 0 && currentIndex > 0 && currentIndex <= maxQuodigiousWidth) {
+                firstBody(currentIndex, firstLimit);
+                std::cout << std::endl;
+                continue;
+            }
             switch(currentIndex) {
-#define X(ind) case ind : initialBody< ind > (); break;
+#define X(ind) case ind : \
+                    if (estimateSamples > 0) { estimateBody< ind > (estimateSamples, seed); } \
+                    else if (whitelist.getLength() > 0) { approximateBody< ind > (); } \
+                    else { initialBody< ind > (); } \
+                    break;
                 X(1);  X(2);  X(3);  X(4);  X(5);
                 X(6);  X(7);  X(8);  X(9);  X(10);
                 X(11); X(12); X(13); X(14); X(15);
@@ -630,5 +2075,9 @@ int main() {
             std::cout << std::endl;
         }
     }
+    if (tracingEnabled && !writeTrace(traceFile)) {
+        std::cerr << "Unable to write trace " << traceFile << std::endl;
+        return 1;
+    }
     return 0;
 }
@@ -0,0 +1,233 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef RULES_H__
+#define RULES_H__
+#include "qlib.h"
+#include <array>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+
+/*
+ * Every way the engines cut down the search space is listed here. Exact rules
+ * only ever throw away numbers which can't be quodigious, heuristic rules
+ * are based on observations of previous runs and could miss numbers.
+ */
+enum class Rule : byte {
+    SkipFive,
+    SumModThree,
+    ParityPair,
+    SumOracle,
+    Count,
+};
+constexpr auto ruleCount = static_cast<std::size_t>(Rule::Count);
+
+/*
+ * Where in the digit tree a rule is applied
+ */
+enum class RuleDepth : byte {
+    EveryPosition,
+    Leaf,
+    LowestDigits,
+    AboveLeaves,
+};
+
+/*
+ * What a rule needs to know about the partially built number, this is a
+ * bitmask.
+ */
+enum RuleState : byte {
+    Digit = 0b0001,
+    DigitSum = 0b0010,
+    DigitProduct = 0b0100,
+    Value = 0b1000,
+};
+
+struct RuleDescription {
+    Rule rule;
+    std::string_view name;
+    bool exact;
+    RuleDepth depth;
+    byte state;
+    std::string_view description;
+};
+
+inline constexpr std::array<RuleDescription, ruleCount> rules {{
+    { Rule::SkipFive, "skip-five", false, RuleDepth::EveryPosition, Digit,
+        "never select the digit five" },
+    { Rule::SumModThree, "sum-mod-three", false, RuleDepth::Leaf, DigitSum,
+        "above ten digits only keep numbers whose digit sum is divisible by three" },
+    { Rule::ParityPair, "parity-pair", false, RuleDepth::LowestDigits, Digit,
+        "from ten digits up even tens digits are followed by 4 or 8 and odd ones by 2 or 6" },
+    { Rule::SumOracle, "sum-oracle", true, RuleDepth::AboveLeaves, DigitSum | Value,
+        "drop subtrees where no choice of the remaining digits gives a sum which divides the number" },
+}};
+
+constexpr const RuleDescription& describe(Rule rule) noexcept {
+    return rules[static_cast<std::size_t>(rule)];
+}
+
+constexpr std::string_view toString(RuleDepth depth) noexcept {
+    switch (depth) {
+        case RuleDepth::EveryPosition: return "every position";
+        case RuleDepth::Leaf: return "leaf";
+        case RuleDepth::LowestDigits: return "lowest digits";
+        case RuleDepth::AboveLeaves: return "above leaves";
+    }
+    return "unknown";
+}
+
+/*
+ * The rules enabled for a given run, everything is enabled by default.
+ *
+ * A single rule can also be complemented: instead of skipping the part of the
+ * search space it prunes, only that part is walked. This is how a heuristic
+ * run gets verified as complete.
+ */
+class RuleSet {
+    public:
+        constexpr RuleSet() noexcept : _mask((1u << ruleCount) - 1), _complement(0) { }
+        constexpr bool enabled(Rule rule) const noexcept {
+            return (_mask >> static_cast<byte>(rule)) & 1u;
+        }
+        constexpr void enable(Rule rule) noexcept {
+            _mask |= (1u << static_cast<byte>(rule));
+        }
+        constexpr void disable(Rule rule) noexcept {
+            _mask &= ~(1u << static_cast<byte>(rule));
+        }
+        /*
+         * Disable the rule with the given name, returns false if there is no
+         * such rule.
+         */
+        constexpr bool disable(std::string_view name) noexcept {
+            for (const auto& r : rules) {
+                if (r.name == name) {
+                    disable(r.rule);
+                    return true;
+                }
+            }
+            return false;
+        }
+        constexpr bool complemented(Rule rule) const noexcept {
+            return ((_complement & _mask) >> static_cast<byte>(rule)) & 1u;
+        }
+        constexpr bool verifying() const noexcept {
+            return (_complement & _mask) != 0;
+        }
+        /*
+         * Only walk the part of the search space the named rule prunes,
+         * returns false if there is no such rule or another rule is already
+         * being complemented.
+         */
+        constexpr bool complement(std::string_view name) noexcept {
+            if (verifying()) {
+                return false;
+            }
+            for (const auto& r : rules) {
+                if (r.name == name) {
+                    enable(r.rule);
+                    _complement = (1u << static_cast<byte>(r.rule));
+                    return true;
+                }
+            }
+            return false;
+        }
+        constexpr bool onlyExact() const noexcept {
+            for (const auto& r : rules) {
+                if (!r.exact && enabled(r.rule)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        constexpr auto getMask() const noexcept { return _mask; }
+    private:
+        u32 _mask;
+        u32 _complement;
+};
+
+/*
+ * How much of the search space each rule has cut out. A node is a single
+ * point in the digit tree where the rule fired, leaves are the number of
+ * candidates which were never tested because of it. Each thread keeps its
+ * own copy and merges it in once its work is done.
+ */
+struct RuleStatistics {
+    std::array<u64, ruleCount> nodes { };
+    std::array<u64, ruleCount> leaves { };
+    u64 tested = 0;
+    void prune(Rule rule, u64 leafCount) noexcept {
+        auto index = static_cast<std::size_t>(rule);
+        ++nodes[index];
+        leaves[index] += leafCount;
+    }
+    void merge(const RuleStatistics& other) noexcept {
+        for (std::size_t i = 0; i < ruleCount; ++i) {
+            nodes[i] += other.nodes[i];
+            leaves[i] += other.leaves[i];
+        }
+        tested += other.tested;
+    }
+};
+
+inline RuleStatistics& threadStatistics() noexcept {
+    static thread_local RuleStatistics local;
+    return local;
+}
+
+inline std::mutex statisticsLock;
+inline RuleStatistics globalStatistics;
+
+/*
+ * Fold the statistics of the calling thread into the global ones.
+ */
+inline void flushStatistics() noexcept {
+    auto& local = threadStatistics();
+    {
+        std::lock_guard<std::mutex> guard(statisticsLock);
+        globalStatistics.merge(local);
+    }
+    local = RuleStatistics();
+}
+
+/*
+ * Print the statistics gathered for a width. The time saved is an estimate
+ * based on the average time spent on each leaf that was actually tested.
+ */
+inline void reportStatistics(std::ostream& out, u64 width, const RuleSet& active, double seconds) noexcept {
+    auto perLeaf = globalStatistics.tested > 0 ? (seconds / globalStatistics.tested) : 0.0;
+    out << "width " << width << ": " << globalStatistics.tested << " leaves tested in " << seconds << " s" << std::endl;
+    for (const auto& r : rules) {
+        auto index = static_cast<std::size_t>(r.rule);
+        out << "  " << r.name << " (" << (r.exact ? "exact" : "heuristic") << ", " << toString(r.depth) << ")";
+        if (active.complemented(r.rule)) {
+            out << ": complemented" << std::endl;
+        } else if (active.enabled(r.rule)) {
+            out << ": " << globalStatistics.nodes[index] << " nodes, "
+                << globalStatistics.leaves[index] << " leaves pruned, ~"
+                << (globalStatistics.leaves[index] * perLeaf) << " s saved" << std::endl;
+        } else {
+            out << ": disabled" << std::endl;
+        }
+    }
+    globalStatistics = RuleStatistics();
+}
+
+#endif // end RULES_H__
@@ -0,0 +1,149 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef SUBTREECACHE_H__
+#define SUBTREECACHE_H__
+#include "qlib.h"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * On disk cache of the numbers found in a subtree. Every entry is named after
+ * a hash of a key which spells out everything its contents depend on: the
+ * width, which subtree it is, the state of each rule that applies to it and
+ * the engine binary itself. Changing any of those just means looking for a
+ * different file, stale entries are never overwritten or checked for. The
+ * key is also the first line of each file so a hash collision is caught on
+ * loading.
+ */
+constexpr u64 fnvOffsetBasis = 0xcbf29ce484222325ul;
+constexpr u64 fnvPrime = 0x100000001b3ul;
+
+constexpr u64 fnv1a(const char* data, std::size_t count, u64 hash = fnvOffsetBasis) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        hash ^= static_cast<byte>(data[i]);
+        hash *= fnvPrime;
+    }
+    return hash;
+}
+
+inline std::string toHex(u64 value) {
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string result(16, '0');
+    for (auto i = 16; i > 0; --i, value >>= 4) {
+        result[i - 1] = digits[value & 0xf];
+    }
+    return result;
+}
+
+/*
+ * Hash of the running executable, any rebuild which changes the engine
+ * changes it as well.
+ */
+inline std::string engineVersion() {
+    std::ifstream self("/proc/self/exe", std::ios::binary);
+    std::array<char, 1 << 16> chunk;
+    auto hash = fnvOffsetBasis;
+    while (self.read(chunk.data(), chunk.size()) || self.gcount() > 0) {
+        hash = fnv1a(chunk.data(), self.gcount(), hash);
+    }
+    return toHex(hash);
+}
+
+class SubtreeCache {
+    public:
+        SubtreeCache() = default;
+        /*
+         * Use the given directory, it is created if it doesn't exist yet.
+         * Returns false if it can't be used.
+         */
+        bool open(const std::string& directory) {
+            if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+                return false;
+            }
+            _directory = directory;
+            _version = engineVersion();
+            return true;
+        }
+        bool enabled() const noexcept { return !_directory.empty(); }
+        /*
+         * Spell out the key of a subtree, rules lists the state of the rules
+         * which have any say over its contents.
+         */
+        std::string key(u64 width, const std::string& subtree, const std::string& rules) const {
+            std::ostringstream key;
+            key << "width=" << width << " subtree=" << subtree << " rules=" << rules << " engine=" << _version;
+            return key.str();
+        }
+        template<typename List>
+        bool load(const std::string& key, List& list) {
+            std::ifstream input(path(key));
+            std::string stored;
+            if (!input || !std::getline(input, stored) || stored != key) {
+                ++_misses;
+                return false;
+            }
+            for (u64 value = 0; input >> value; ) {
+                list.emplace_back(value);
+            }
+            ++_hits;
+            return true;
+        }
+        /*
+         * Entries are written under a temporary name and renamed into place
+         * so a run which gets killed never leaves half of one behind.
+         */
+        template<typename List>
+        void store(const std::string& key, const List& list) {
+            auto target = path(key);
+            auto temporary = target + ".tmp" + std::to_string(getpid()) + "." + std::to_string(++_stores);
+            {
+                std::ofstream output(temporary);
+                output << key << '\n';
+                for (const auto& value : list) {
+                    output << value << '\n';
+                }
+                output.close();
+                if (!output) {
+                    std::remove(temporary.c_str());
+                    return;
+                }
+            }
+            std::rename(temporary.c_str(), target.c_str());
+        }
+        u64 hits() const noexcept { return _hits; }
+        u64 misses() const noexcept { return _misses; }
+    private:
+        std::string path(const std::string& key) const {
+            return _directory + "/" + toHex(fnv1a(key.data(), key.size()));
+        }
+        std::string _directory;
+        std::string _version;
+        std::atomic<u64> _hits { 0 };
+        std::atomic<u64> _misses { 0 };
+        std::atomic<u64> _stores { 0 };
+};
+
+#endif // end SUBTREECACHE_H__
@@ -0,0 +1,150 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef SUFFIXES_H__
+#define SUFFIXES_H__
+#include "qlib.h"
+#include <algorithm>
+#include <fstream>
+#include <istream>
+#include <string>
+#include <vector>
+
+/*
+ * The last few digits of the quodigious numbers found so far, mined from a
+ * previous result set. This replaces sorting and uniq'ing the qnums*_lastN
+ * files by hand and compiling them into the program.
+ *
+ * On disk the whitelist is a small header followed by the sorted suffixes:
+ *
+ * "QSFX" | u32 version | u32 length | u32 minimum width | u32 maximum width |
+ * u64 numbers mined | u64 count | u64 suffixes[count]
+ */
+class SuffixWhitelist {
+    public:
+        static constexpr u32 maxLength = 8;
+        static constexpr u32 version = 1;
+        SuffixWhitelist() = default;
+        /*
+         * Collect the unique suffixes of the given length from every number
+         * read from the stream, blank lines and numbers which are too short
+         * are skipped.
+         */
+        bool mine(std::istream& input, u32 length) {
+            if (length == 0 || length > maxLength) {
+                return false;
+            }
+            _length = length;
+            _minWidth = 0;
+            _maxWidth = 0;
+            _mined = 0;
+            _suffixes.clear();
+            std::string line;
+            while (std::getline(input, line)) {
+                auto start = line.find_first_not_of(" \t");
+                if (start == std::string::npos) {
+                    continue;
+                }
+                auto end = line.find_first_not_of("0123456789", start);
+                auto digits = line.substr(start, end - start);
+                if (digits.size() < length || digits.size() > 19) {
+                    continue;
+                }
+                _minWidth = (_mined == 0) ? digits.size() : std::min<u32>(_minWidth, digits.size());
+                _maxWidth = std::max<u32>(_maxWidth, digits.size());
+                ++_mined;
+                _suffixes.emplace_back(std::stoul(digits.substr(digits.size() - length)));
+            }
+            std::sort(_suffixes.begin(), _suffixes.end());
+            _suffixes.erase(std::unique(_suffixes.begin(), _suffixes.end()), _suffixes.end());
+            return _mined > 0;
+        }
+        bool save(const std::string& path) const {
+            std::ofstream output(path, std::ios::binary);
+            u64 count = _suffixes.size();
+            output.write("QSFX", 4);
+            write(output, version);
+            write(output, _length);
+            write(output, _minWidth);
+            write(output, _maxWidth);
+            write(output, _mined);
+            write(output, count);
+            output.write(reinterpret_cast<const char*>(_suffixes.data()), count * sizeof(u64));
+            return output.good();
+        }
+        bool load(const std::string& path) {
+            std::ifstream input(path, std::ios::binary);
+            char magic[4] = { };
+            u32 fileVersion = 0;
+            u64 count = 0;
+            input.read(magic, 4);
+            read(input, fileVersion);
+            read(input, _length);
+            read(input, _minWidth);
+            read(input, _maxWidth);
+            read(input, _mined);
+            read(input, count);
+            if (!input.good() || !std::equal(magic, magic + 4, "QSFX") || fileVersion != version ||
+                    _length == 0 || _length > maxLength) {
+                return false;
+            }
+            // the count can't be trusted until the file is known to hold
+            // that many suffixes, there are only so many of any length anyway
+            auto start = input.tellg();
+            input.seekg(0, std::ios::end);
+            auto available = static_cast<u64>(input.tellg() - start) / sizeof(u64);
+            input.seekg(start);
+            if (!input.good() || count > possibleSuffixes(_length) || count > available) {
+                return false;
+            }
+            _suffixes.resize(count);
+            input.read(reinterpret_cast<char*>(_suffixes.data()), count * sizeof(u64));
+            return input.good();
+        }
+        auto getLength() const noexcept { return _length; }
+        auto getMinWidth() const noexcept { return _minWidth; }
+        auto getMaxWidth() const noexcept { return _maxWidth; }
+        auto getMined() const noexcept { return _mined; }
+        const auto& getSuffixes() const noexcept { return _suffixes; }
+    private:
+        /*
+         * Every digit but zero and one can show up in a suffix.
+         */
+        static constexpr u64 possibleSuffixes(u32 length) noexcept {
+            u64 result = 1;
+            for (u32 i = 0; i < length; ++i) {
+                result *= 8;
+            }
+            return result;
+        }
+        template<typename T>
+        static void write(std::ostream& output, T value) {
+            output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+        template<typename T>
+        static void read(std::istream& input, T& value) {
+            input.read(reinterpret_cast<char*>(&value), sizeof(T));
+        }
+        u32 _length = 0;
+        u32 _minWidth = 0;
+        u32 _maxWidth = 0;
+        u64 _mined = 0;
+        std::vector<u64> _suffixes;
+};
+
+#endif // end SUFFIXES_H__
@@ -18,10 +18,16 @@
 
 #include "qlib.h"
 #include <iostream>
+#include <string>
 
 
-template<uint8_t depth, bool includeFive = true>
-void performQuodigious(u64 number = 0, u64 sum = 0, u64 product = 1) noexcept {
+/*
+ * Fill in the lowest depth digits of number. When scaled, scale is the place
+ * value of the lowest digit which is still free, otherwise it is one and
+ * ignored so the place values stay compile time constants.
+ */
+template<uint8_t depth, bool includeFive = true, bool scaled = false>
+void performQuodigious(u64 number = 0, u64 sum = 0, u64 product = 1, u64 scale = 1) noexcept {
     static_assert(depth < 20, "Too large of a number");
     if constexpr (depth == 0) {
         if (isQuodigious(number, sum, product)) {
@@ -29,38 +35,39 @@ void performQuodigious(u64 number = 0, u64 sum = 0, u64 product = 1) noexcept {
         }
     } else {
         static constexpr auto innerDepth = depth - 1;
-        static constexpr auto baseFactor = factors10[innerDepth];
+        static constexpr auto fixedFactor = factors10[innerDepth];
+        const auto baseFactor = scaled ? (fixedFactor * scale) : fixedFactor;
         // this will eliminate multiplies
         number += (baseFactor << 1); // always will have a minimum of baseFactor * 2
         sum += 2; // always will be two more than we started with
         // hand unroll to expose more optimization surface area
-        performQuodigious<innerDepth>(number, sum, product * 2);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 2, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious<innerDepth>(number, sum, product * 3);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 3, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious<innerDepth>(number, sum, product * 4);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 4, scale);
         if constexpr (includeFive) {
             number += baseFactor;
             ++sum;
-            performQuodigious<innerDepth>(number, sum, product * 5);
+            performQuodigious<innerDepth, true, scaled>(number, sum, product * 5, scale);
             number += baseFactor;
             ++sum;
         } else {
             number += (baseFactor << 1);
             sum += 2;
         }
-        performQuodigious<innerDepth>(number, sum, product * 6);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 6, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious<innerDepth>(number, sum, product * 7);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 7, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious<innerDepth>(number, sum, product * 8);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 8, scale);
         number += baseFactor;
         ++sum;
-        performQuodigious<innerDepth>(number, sum, product * 9);
+        performQuodigious<innerDepth, true, scaled>(number, sum, product * 9, scale);
     }
 }
 void performQuodigious(uint8_t depth) noexcept {
@@ -80,12 +87,99 @@ void performQuodigious(uint8_t depth) noexcept {
 #undef X
     }
 }
-int main() {
+/*
+ * Walk every number of the given width ending in the given lower digits.
+ */
+bool performSubtree(u64 width, u64 digits) noexcept {
+    SubtreeState state;
+    if (!lowerDigitsState(digits, state) || state.length > width) {
+        return false;
+    }
+    auto scale = factors10[state.length];
+    switch (width - state.length) {
+#define X(length) case length : performQuodigious<length, true, true> (state.value, state.sum, state.product, scale); break
+        X(0);
+        X(1);  X(2);
+        X(3);  X(4);
+        X(5);  X(6); 
+        X(7);  X(8); 
+        X(9);  X(10); 
+        X(11); X(12);
+        X(13); X(14);
+        X(15); X(16);
+        X(17); X(18);
+        default: return false;
+#undef X
+    }
+    return true;
+}
+/*
+ * Same as performQuodigious but only for the numbers in [lo, hi]. A digit
+ * whose subtree lies completely outside of the range is skipped and one
+ * completely inside of it is handed to performQuodigious, so only the
+ * subtrees along the two bounds are clipped.
+ */
+template<uint8_t depth>
+void performRange(u64 number, u64 sum, u64 product, u64 lo, u64 hi) noexcept {
+    if constexpr (depth == 0) {
+        if (isQuodigious(number, sum, product)) {
+            std::cout << number << std::endl;
+        }
+    } else {
+        static constexpr auto innerDepth = depth - 1;
+        static constexpr auto baseFactor = factors10[innerDepth];
+        static constexpr auto smallest = 2 * repunit(innerDepth);
+        static constexpr auto largest = 9 * repunit(innerDepth);
+        for (auto digit = 2ul; digit < 10ul; ++digit) {
+            auto next = number + (digit * baseFactor);
+            if (next + largest < lo) {
+                continue;
+            } else if (next + smallest > hi) {
+                break;
+            } else if (next + smallest >= lo && next + largest <= hi) {
+                performQuodigious<innerDepth>(next, sum + digit, product * digit);
+            } else {
+                performRange<innerDepth>(next, sum + digit, product * digit, lo, hi);
+            }
+        }
+    }
+}
+void performRange(u64 lo, u64 hi) noexcept {
+#define X(length) performRange<length> (0, 0, 1, lo, hi)
+    X(1);  X(2);
+    X(3);  X(4);
+    X(5);  X(6); 
+    X(7);  X(8); 
+    X(9);  X(10); 
+    X(11); X(12);
+    X(13); X(14);
+    X(15); X(16);
+    X(17); X(18);
+    X(19); 
+#undef X
+}
+int main(int argc, char** argv) {
+    // -u reads "width lowerDigits" pairs and only walks those subtrees, -r
+    // reads "lo hi" pairs and only walks the numbers in between
+    std::string mode = (argc > 1) ? argv[1] : "";
+    auto subtrees = (mode == "-u");
+    auto ranges = (mode == "-r");
     while(std::cin.good()) {
         u64 currentIndex = 0;
+        u64 argument = 0;
         std::cin >> currentIndex;
+        if (subtrees || ranges) {
+            std::cin >> argument;
+        }
         if (std::cin.good()) {
-            if ((currentIndex > 0) && (currentIndex < 20)) {
+            if (subtrees) {
+                if (!performSubtree(currentIndex, argument)) {
+                    std::cout << "Illegal subtree " << currentIndex << " " << argument << std::endl;
+                    return 1;
+                }
+            } else if (ranges) {
+                performRange(currentIndex, argument);
+            } else if ((currentIndex > 0) && (currentIndex < 20)) {
                 performQuodigious(currentIndex);
             } else {
                 std::cout << "Illegal index " << currentIndex << std::endl;
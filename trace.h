@@ -0,0 +1,129 @@
+//  Copyright (c) 2017 Joshua Scoggins
+//
+//  This software is provided 'as-is', without any express or implied
+//  warranty. In no event will the authors be held liable for any damages
+//  arising from the use of this software.
+//
+//  Permission is granted to anyone to use this software for any purpose,
+//  including commercial applications, and to alter it and redistribute it
+//  freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//     claim that you wrote the original software. If you use this software
+//     in a product, an acknowledgment in the product documentation would be
+//     appreciated but is not required.
+//  2. Altered source versions must be plainly marked as such, and must not be
+//     misrepresented as being the original software.
+//  3. This notice may not be removed or altered from any source distribution.
+
+#ifndef TRACE_H__
+#define TRACE_H__
+#include "qlib.h"
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * Optional timeline of every task the engine schedules. Each thread records
+ * into its own ring buffer (the oldest events are dropped once it is full)
+ * so recording never takes a lock, the buffers outlive their threads and are
+ * written out as Chrome trace event JSON at the end of the run. Load the file
+ * in chrome://tracing or Perfetto to see stragglers and idle gaps.
+ */
+struct TraceEvent {
+    const char* name;
+    u64 width;
+    u64 position;
+    u64 prefix;
+    u64 results;
+    std::chrono::steady_clock::duration begin;
+    std::chrono::steady_clock::duration end;
+};
+
+class TraceBuffer {
+    public:
+        static constexpr std::size_t capacity = 1024;
+        explicit TraceBuffer(u64 thread) noexcept : _thread(thread) { }
+        void record(const TraceEvent& event) {
+            if (_events.size() < capacity) {
+                _events.emplace_back(event);
+            } else {
+                _events[_next] = event;
+                _next = (_next + 1) % capacity;
+            }
+        }
+        auto getThread() const noexcept { return _thread; }
+        const auto& getEvents() const noexcept { return _events; }
+    private:
+        u64 _thread;
+        std::size_t _next = 0;
+        std::vector<TraceEvent> _events;
+};
+
+inline bool tracingEnabled = false;
+inline std::mutex traceLock;
+inline std::vector<std::unique_ptr<TraceBuffer>> traceBuffers;
+inline const auto traceStart = std::chrono::steady_clock::now();
+
+inline TraceBuffer& threadTraceBuffer() {
+    static thread_local TraceBuffer* local = nullptr;
+    if (local == nullptr) {
+        // only once per thread
+        std::lock_guard<std::mutex> guard(traceLock);
+        traceBuffers.emplace_back(std::make_unique<TraceBuffer>(traceBuffers.size()));
+        local = traceBuffers.back().get();
+    }
+    return *local;
+}
+
+/*
+ * Records a single task from construction to destruction.
+ */
+class TraceScope {
+    public:
+        TraceScope(const char* name, u64 width, u64 position, u64 prefix) noexcept {
+            if (tracingEnabled) {
+                _event = { name, width, position, prefix, 0, std::chrono::steady_clock::now() - traceStart, { } };
+            }
+        }
+        TraceScope(const TraceScope&) = delete;
+        TraceScope(TraceScope&&) = delete;
+        ~TraceScope() {
+            if (tracingEnabled) {
+                _event.end = std::chrono::steady_clock::now() - traceStart;
+                threadTraceBuffer().record(_event);
+            }
+        }
+        void setResults(u64 results) noexcept { _event.results = results; }
+    private:
+        TraceEvent _event { };
+};
+
+/*
+ * Each width shows up as its own process in the viewer.
+ */
+inline bool writeTrace(const std::string& path) {
+    std::ofstream output(path);
+    std::lock_guard<std::mutex> guard(traceLock);
+    output << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    auto first = true;
+    for (const auto& buffer : traceBuffers) {
+        for (const auto& event : buffer->getEvents()) {
+            std::chrono::duration<double, std::micro> begin = event.begin;
+            std::chrono::duration<double, std::micro> duration = event.end - event.begin;
+            output << (first ? "\n" : ",\n")
+                   << "{\"name\": \"" << event.name << "\", \"ph\": \"X\", \"pid\": " << event.width
+                   << ", \"tid\": " << buffer->getThread() << ", \"ts\": " << begin.count()
+                   << ", \"dur\": " << duration.count() << ", \"args\": {\"position\": " << event.position
+                   << ", \"prefix\": " << event.prefix << ", \"results\": " << event.results << "}}";
+            first = false;
+        }
+    }
+    output << "\n]}" << std::endl;
+    return output.good();
+}
+
+#endif // end TRACE_H__